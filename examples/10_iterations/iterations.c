@@ -7,72 +7,386 @@
  * AUTHOR  : Bazso Akos
  * VERSION : 1.0, 12 May 2019
  *           1.1, 20 Nov 2019
+ *           1.2, 14 Oct 2026 -- all pairs of methods, multithreaded batches,
+ *                               binary raster output with time per solve
  * COMPILE : use Makefile
+ * USAGE   : iterations [-m nma] [-e necc] [-E emax] [-s starter]
+ *                      [-i solver] [-r reps] [-j threads] [-o file]
+ *           -m  resolution in eccentric anomaly 0 < E < pi (default 256)
+ *           -e  resolution in eccentricity 0 < e < emax (default 64)
+ *           -E  upper limit of eccentricity (default 0.999)
+ *           -s  starter method (number of enum kes_stm_e, name, e.g.
+ *               "es04", or "all" (default))
+ *           -i  solver method (number of enum kes_sol_e, name, e.g.
+ *               "mikkola", "auto", or "all" (default))
+ *           -r  repetitions of the time measurement, best is taken
+ *               (default 3, 0 = no timing)
+ *           -j  number of threads (default 0 = all processors)
+ *           -o  output file (default iterations.qmap)
+ *           the grid holds cell centers, M is computed from the reference
+ *           E_ref; errors and iterations are evaluated by kesolver_batch_mt()
+ *           for the whole grid, the time per solve by kesolver_batch() on
+ *           tiles of TILE cells along M in a single thread;
+ *           solver methods with their own starter are run with "es00" only
+ *           if all starters are selected; "all" solvers include "auto";
+ *           a summary line per pair of methods goes to stderr
+ * FORMAT  : little-endian output file, 64 bytes header
+ *               char     magic[8] = "KESQMAP1"
+ *               uint32_t nma, necc, nrec, nlayer (= 3)
+ *               double   emax
+ *               (zero padding)
+ *           followed by nrec records of 16 + 12 * necc * nma bytes
+ *               int32_t  starter, solver, failures, max. iterations
+ *               float    relative error |E_ref - E| / E_ref [necc][nma]
+ *               float    number of iterations [necc][nma]
+ *               float    time per solve in ns [necc][nma]
+ *           i.e. layers are row-major with M running fastest, as read by
+ *           iterations.plt
  ******************************************************************************/
+/* POSIX clock_gettime() */
+#define _XOPEN_SOURCE 700
+
 /* include library header file */
 #include "libkes.h"
 
-#include <stdio.h>
 #include <math.h>
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+
+/* number of cells along M timed together */
+#define TILE    16
+
+/* number of layers per record, size of file and record headers */
+#define NLAYER  3
+#define HEADER  64
+#define RECHEAD 16
+
+/* names of methods, in order of enums kes_stm_e and kes_sol_e */
+static const char* stm_name[KES_STM_TOTAL] = {
+    "none", "es00", "es01", "es02", "es03", "es04", "es05", "es06", "es07",
+    "es08", "es09", "es10", "es11", "es12", "es13", "es14", "es15"
+};
+static const char* sol_name[KES_SOL_TOTAL] = {
+    "none", "bisect", "danbur4", "danbur5", "fixedp", "halley", "lagcon",
+    "markley", "mikkola", "newrap", "nijenh", "secant", "wegsec", "brent",
+    "cordic", "fukush", "eks", "hybrid"
+};
+
+/* solver methods ignoring the starter, same list as examples/14_autotune */
+static int own_starter(const kes_sol_e iter)
+{
+    return( (iter == KES_SOL_BISECT)  || (iter == KES_SOL_MARKLEY) ||
+            (iter == KES_SOL_MIKKOLA) || (iter == KES_SOL_NIJENH)  ||
+            (iter == KES_SOL_SECANT)  || (iter == KES_SOL_BRENT)   ||
+            (iter == KES_SOL_CORDIC)  || (iter == KES_SOL_FUKUSH)  ||
+            (iter == KES_SOL_EKS) );
+} // end own_starter
+
+/* method from number or name, -1 for "all", -2 for unknown names */
+static int parse_method(const char* arg, const char** names, const int total)
+{
+    if ( !strcmp(arg, "all") )
+    {
+        return -1;
+    } // end if
+    if ( (names == sol_name) && !strcmp(arg, "auto") )
+    {
+        return KES_SOL_AUTO;
+    } // end if
+    for (int k = 1; k < total; k++)
+    {
+        if ( !strcmp(arg, names[k]) )
+        {
+            return k;
+        } // end if
+    } // end for
+
+    char*      end;
+    const long k = strtol(arg, &end, 10);
+    return( ((*end == '\0') && (k > 0) && (k < total)) ? (int)k : -2 );
+} // end parse_method
+
+/* wall clock time in nanoseconds */
+static double now_ns(void)
+{
+    struct timespec t;
+    clock_gettime(CLOCK_MONOTONIC, &t);
+    return( 1E9 * (double)t.tv_sec + (double)t.tv_nsec );
+} // end now_ns
+
+/* write 32-bit words and doubles in little-endian byte order */
+static void put_u32(unsigned char* p, const uint32_t v)
+{
+    for (int b = 0; b < 4; b++)
+    {
+        p[b] = (unsigned char)(v >> (8 * b));
+    } // end for
+} // end put_u32
+
+static void put_f64(unsigned char* p, const double v)
+{
+    uint64_t u;
+    memcpy(&u, &v, sizeof(u));
+    for (int b = 0; b < 8; b++)
+    {
+        p[b] = (unsigned char)(u >> (8 * b));
+    } // end for
+} // end put_f64
+
+static int write_floats(FILE* out, const float* v, const size_t n)
+{
+    unsigned char buf[4 * TILE];
+
+    for (size_t k = 0; k < n; k += TILE)
+    {
+        const size_t m = ((n - k < TILE) ? n - k : TILE);
+        for (size_t l = 0; l < m; l++)
+        {
+            uint32_t u;
+            memcpy(&u, v + k + l, sizeof(u));
+            put_u32(buf + 4 * l, u);
+        } // end for(l)
+        if ( fwrite(buf, 4, m, out) != m )
+        {
+            return 0;
+        } // end if
+    } // end for(k)
+
+    return 1;
+} // end write_floats
+
+/* pairs of methods to map, returns number of pairs */
+static int make_pairs(
+    const int s, const int t, kes_stm_e* init, kes_sol_e* iter)
+{
+    int np = 0;
+
+    /* automatic selection ignores the starter */
+    if ( t == KES_SOL_AUTO )
+    {
+        init[0] = KES_STM_NONE;
+        iter[0] = KES_SOL_AUTO;
+        return 1;
+    } // end if
+
+    for (int j = ((t < 0) ? KES_SOL_NONE + 1 : t);
+             j <= ((t < 0) ? KES_SOL_TOTAL - 1 : t); j++)
+    {
+        for (int i = ((s < 0) ? KES_STM_NONE + 1 : s);
+                 i <= ((s < 0) ? KES_STM_TOTAL - 1 : s); i++)
+        {
+            if ( (s < 0) && (i != KES_STM_ES00) && own_starter((kes_sol_e)j) )
+            {
+                continue;
+            } // end if
+            init[np] = (kes_stm_e)i;
+            iter[np] = (kes_sol_e)j;
+            np++;
+        } // end for(i)
+    } // end for(j)
+
+    /* current dispatch of the automatic selection */
+    if ( t < 0 )
+    {
+        init[np] = KES_STM_NONE;
+        iter[np] = KES_SOL_AUTO;
+        np++;
+    } // end if
 
-int main(void)
+    return np;
+} // end make_pairs
+
+static int usage(void)
+{
+    fprintf(stderr, "usage: iterations [-m nma] [-e necc] [-E emax] "
+            "[-s starter] [-i solver] [-r reps] [-j threads] [-o file]\n");
+    return 1;
+} // end usage
+
+int main(int argc, char* argv[])
 {
-    static const kes_stm_e init = KES_STM_ES04;     // starter method
-    static const kes_sol_e iter = KES_SOL_MIKKOLA;  // solver method
-    static const double    pi   = 3.141592653589793;
-    static const int       imax = 256; // resolution along x-axis = mean anomaly
-    static const int       jmax =  64; // resolution along y-axis = eccentricity
-    static kes_err_e       status;
-    static kes_input_t     data;
-
-    /* show info header */
-    fprintf(
-        stdout,
-        "# %s: starter = %d, solver = %d\n"
-        "# resolution in (M,e) = (%d, %d)\n"
-        "# columns:\n"
-        "#\t(1) mean anomaly M [radians],\n"
-        "#\t(2) eccentricity ecc [none],\n"
-        "#\t(3) reference solution E_ref [radians],\n"
-        "#\t(4) output solution E_out (from kesolver) [radians],\n"
-        "#\t(5) relative error |E_ref - E_out| / E_ref [none],\n"
-        "#\t(6) number of iterations [integer]\n"
-        "# (1)    (2)      (3)      (4)      (5)           (6)\n",
-        __FILE__, init, iter, imax, jmax
-    );
-
-    /* loop over reference eccentric anomaly */
-    for (register int i = 0; i <= imax; i++)
-    {
-        /* reference value for eccentric anomaly */
-        const double ref = pi* (double)i / imax;
-
-        /* loop over eccentricity */
-        for (register int j = 0; j < jmax; j++)
-        {
-            /* current value of eccentricity */
-            const double ecc = (double)j / jmax;
-
-            /* current value of mean anomaly */
-            const double ma  = ref - ecc * sin(ref);
-
-            /* solution from kesolver() */
-            const double sol = kesolver(ecc, ma, init, iter, &data, &status);
-
-            /* relative error of numerical solution */
-            const double abserr = fabs(ref - sol);
-            const double relerr = ((ref > 0.0) ? abserr / ref : abserr);
-
-            fprintf(
-                stdout,
-                "%lf %lf %lf %lf %e %3d\n",
-                ma, ecc, ref, sol, relerr, data.iterations
-            );
+    /* default parameters */
+    int         nma     = 256;               // resolution along x-axis
+    int         necc    = 64;                // resolution along y-axis
+    double      emax    = 0.999;             // upper limit of eccentricity
+    int         s       = -1;                // starter method, -1 = all
+    int         t       = -1;                // solver method, -1 = all
+    int         reps    = 3;                 // repetitions of timing
+    int         threads = 0;                 // number of threads
+    const char* file    = "iterations.qmap"; // output file
+
+    for (int a = 1; a < argc; a++)
+    {
+        if ( !strcmp(argv[a], "-m") && (a + 1 < argc) )
+        {
+            nma = atoi(argv[++a]);
+        } // end if
+        else if ( !strcmp(argv[a], "-e") && (a + 1 < argc) )
+        {
+            necc = atoi(argv[++a]);
+        } // end if
+        else if ( !strcmp(argv[a], "-E") && (a + 1 < argc) )
+        {
+            emax = atof(argv[++a]);
+        } // end if
+        else if ( !strcmp(argv[a], "-s") && (a + 1 < argc) )
+        {
+            s = parse_method(argv[++a], stm_name, KES_STM_TOTAL);
+        } // end if
+        else if ( !strcmp(argv[a], "-i") && (a + 1 < argc) )
+        {
+            t = parse_method(argv[++a], sol_name, KES_SOL_TOTAL);
+        } // end if
+        else if ( !strcmp(argv[a], "-r") && (a + 1 < argc) )
+        {
+            reps = atoi(argv[++a]);
+        } // end if
+        else if ( !strcmp(argv[a], "-j") && (a + 1 < argc) )
+        {
+            threads = atoi(argv[++a]);
+        } // end if
+        else if ( !strcmp(argv[a], "-o") && (a + 1 < argc) )
+        {
+            file = argv[++a];
+        } // end if
+        else
+        {
+            return usage();
+        } // end else
+    } // end for
+
+    if ( (nma < 1) || (necc < 1) || !(emax > 0.0) || !(emax < 1.0) ||
+         (s < -1) || (t < -1) || (reps < 0) ||
+         (kes_set_threads(threads) != KES_ERR_NOERR) )
+    {
+        fprintf(stderr, "iterations: invalid parameters\n");
+        return usage();
+    } // end if
+
+    /* grid of cell centers, M from the reference solution */
+    const size_t n    = (size_t)nma * (size_t)necc;
+    double*      ecc  = malloc(n * sizeof(double));
+    double*      ma   = malloc(n * sizeof(double));
+    double*      ref  = malloc(n * sizeof(double));
+    double*      ea   = malloc(n * sizeof(double));
+    int*         it   = malloc(n * sizeof(int));
+    kes_err_e*   st   = malloc(n * sizeof(kes_err_e));
+    float*       lay  = malloc(NLAYER * n * sizeof(float));
+    kes_stm_e    init[KES_STM_TOTAL * KES_SOL_TOTAL + 1];
+    kes_sol_e    iter[KES_STM_TOTAL * KES_SOL_TOTAL + 1];
+    if ( !ecc || !ma || !ref || !ea || !it || !st || !lay )
+    {
+        fprintf(stderr, "iterations: out of memory\n");
+        return 1;
+    } // end if
+
+    for (int j = 0; j < necc; j++)
+    {
+        for (int i = 0; i < nma; i++)
+        {
+            const size_t k = (size_t)j * nma + i;
+            ecc[k] = emax * (j + 0.5) / necc;
+            ref[k] = 3.141592653589793 * (i + 0.5) / nma;
+            ma[k]  = ref[k] - ecc[k] * sin(ref[k]);
+        } // end for(i)
+    } // end for(j)
+
+    const int np = make_pairs(s, t, init, iter);
+
+    /* file header */
+    FILE* out = fopen(file, "wb");
+    if ( out == NULL )
+    {
+        fprintf(stderr, "iterations: cannot open %s\n", file);
+        return 1;
+    } // end if
+
+    unsigned char head[HEADER] = "KESQMAP1";
+    put_u32(head +  8, (uint32_t)nma);
+    put_u32(head + 12, (uint32_t)necc);
+    put_u32(head + 16, (uint32_t)np);
+    put_u32(head + 20, NLAYER);
+    put_f64(head + 24, emax);
+    int ok = (fwrite(head, 1, HEADER, out) == HEADER);
+
+    kes_input_t data = kes_new_input();
+    fprintf(stderr, "# %d x %d grid, %d pairs of methods\n"
+            "# rec starter solver   failures  max.iter  mean.iter  "
+            "max.relerr  ns/solve\n", nma, necc, np);
+
+    for (int r = 0; ok && (r < np); r++)
+    {
+        /* errors and iterations of whole grid on all threads */
+        kesolver_batch_mt(n, ecc, 1, ma, ea, init[r], iter[r], &data, st, it);
+
+        int    nfail = 0, maxit = 0;
+        double sumit = 0.0, maxerr = 0.0;
+        for (size_t k = 0; k < n; k++)
+        {
+            const double err = fabs(ref[k] - ea[k]) / ref[k];
+            const int    fail = ((st[k] != KES_ERR_NOERR) ||
+                                 (it[k] >= data.maxiter));
+
+            nfail += fail;
+            maxit  = ((it[k] > maxit) ? it[k] : maxit);
+            sumit += it[k];
+            maxerr = (!(err <= maxerr) ? err : maxerr);
+            lay[k]     = (float)err;
+            lay[n + k] = (float)it[k];
+        } // end for(k)
+
+        /* time per solve, tiles along M of one eccentricity */
+        double sumns = 0.0;
+        for (int j = 0; j < necc; j++)
+        {
+            for (int i = 0; i < nma; i += TILE)
+            {
+                const size_t k    = (size_t)j * nma + i;
+                const size_t m    = ((nma - i < TILE) ? nma - i : TILE);
+                double       best = 0.0;
+
+                for (int l = 0; l < reps; l++)
+                {
+                    const double t0 = now_ns();
+                    kesolver_batch(m, ecc + k, 1, ma + k, ea + k, init[r],
+                                   iter[r], &data, NULL, NULL);
+                    const double ns = (now_ns() - t0) / m;
+                    best = (((l == 0) || (ns < best)) ? ns : best);
+                } // end for(l)
+
+                for (size_t l = 0; l < m; l++)
+                {
+                    lay[2 * n + k + l] = (float)best;
+                } // end for(l)
+                sumns += best * m;
+            } // end for(i)
         } // end for(j)
 
-        /* add empty line to start new data block for gnuplot format */
-        fprintf(stdout, "\n");
-    } // end for(i)
+        /* record header and layers */
+        unsigned char rec[RECHEAD];
+        put_u32(rec +  0, (uint32_t)init[r]);
+        put_u32(rec +  4, (uint32_t)iter[r]);
+        put_u32(rec +  8, (uint32_t)nfail);
+        put_u32(rec + 12, (uint32_t)maxit);
+        ok = ( (fwrite(rec, 1, RECHEAD, out) == RECHEAD) &&
+               write_floats(out, lay, NLAYER * n) );
+
+        fprintf(stderr, "%5d %-7s %-8s %9d %9d %10.2f %11.2e %9.1f\n",
+                r, stm_name[init[r]],
+                ((iter[r] == KES_SOL_AUTO) ? "auto" : sol_name[iter[r]]),
+                nfail, maxit, sumit / n, maxerr, sumns / n);
+    } // end for(r)
+
+    if ( (fclose(out) != 0) || !ok )
+    {
+        fprintf(stderr, "iterations: cannot write %s\n", file);
+        return 1;
+    } // end if
+
+    free(ecc); free(ma); free(ref); free(ea); free(it); free(st); free(lay);
 
     return 0;
 } // end main
@@ -4,25 +4,42 @@
 # Bazso Akos
 # V1.0, 12 May 2019 -- initial script
 # V1.1, 20 Nov 2019 -- modified order of columns
+# V1.2, 14 Oct 2026 -- binary raster output of all pairs of methods, e.g.
+#                      gnuplot -e "rec=5" iterations.plt
 # -----------------------------------------------------------------------------
 
 reset
-
-# TODO change input/output file name here
-filename="mikkola"
+set macros
+
+# TODO change input file, record and grid of the iterations run here,
+# the records are listed on stderr by iterations
+if (!exists("filename")) filename="iterations.qmap"
+if (!exists("rec"))      rec=0
+if (!exists("nma"))      nma=256
+if (!exists("necc"))     necc=64
+if (!exists("emax"))     emax=0.999
+
+# offsets of layers (error, iterations, time) of the record in bytes
+layer(l) = sprintf("skip=%d", 64 + rec * (16 + 12 * necc * nma) + 16 \
+                   + l * 4 * necc * nma)
+sk0 = layer(0)
+sk1 = layer(1)
+sk2 = layer(2)
+fmt = sprintf("array=(%d,%d) format='%%float32' endian=little " \
+              . "dx=%g dy=%g origin=(%g,%g)", nma, necc, pi / nma, \
+              emax / necc, 0.5 * pi / nma, 0.5 * emax / necc)
 
 # -----------------------------------------------------------------------------
 
 # --- terminal settings ---
-set term pngcairo enh size 1000,1200 font ",20"
-set out filename.".png"
+set term pngcairo enh size 1000,1800 font ",20"
+set out sprintf("%s.%d.png", filename, rec)
 
 # -----------------------------------------------------------------------------
 
 # --- general settings ---
 set border lt -1 lw 2
 unset key
-set pm3d map interp 0,0
 set tics out nomir scale 1.5
 
 # -----------------------------------------------------------------------------
@@ -35,7 +52,7 @@ set mxtic 2
 set format x "%.1P"
 
 set ylabel "eccentricity"
-set yrange [0:1]
+set yrange [0:emax]
 set ytics 0.2
 set mytic 2
 set format y "%.1f"
@@ -44,18 +61,24 @@ set cbtics 1 in mir scale 2
 
 # -----------------------------------------------------------------------------
 
-set multi layout 2,1
+set multi layout 3,1
 
 # --- plot #1 ---
 set cblabel "log_{10} relative error"
 set title "(a) relative error"
-sp filename.".dat" u 3:2:(log10($5)) not
+plot filename binary @sk0 @fmt u (log10($1 + 1E-17)) w image not
 
 # --- plot #2 ---
 set cblabel "number of iterations"
 #set cbtics 10
 set title "(b) number of iterations"
-sp filename.".dat" u 3:2:6 not
+plot filename binary @sk1 @fmt u 1 w image not
+
+# --- plot #3 ---
+set cblabel "time per solve [ns]"
+set cbtics autofreq
+set title "(c) time per solve"
+plot filename binary @sk2 @fmt u 1 w image not
 
 unset multi
 
@@ -0,0 +1,63 @@
+/*******************************************************************************
+ * PROGRAM : batch.c
+ * PURPOSE : an example on how to solve Kepler's Equation for whole arrays
+ *           of mean anomalies with a single call to kesolver_batch()
+ * AUTHOR  : Bazso Akos
+ * VERSION : 1.0, 14 Oct 2026
+ * COMPILE : use Makefile
+ ******************************************************************************/
+/* include library header file */
+#include "libkes.h"
+
+#include <stdio.h>
+
+#define NBR 8
+
+int main(void)
+{
+    /* input parameters, shared by all elements and not modified */
+    const kes_input_t data = kes_new_input();
+
+    /* common eccentricity and arrays of mean anomalies */
+    const double ecc = 0.567;
+    double ma[NBR], ea[NBR];
+    int    iter[NBR];
+
+    for (int i = 0; i < NBR; i++)
+    {
+        ma[i] = 0.4 * i;
+    } // end for
+
+    /* solve for all mean anomalies at once;
+     * NOTE stride 0 means the same eccentricity for all elements
+     */
+    const kes_err_e err = kesolver_batch(
+        NBR,            // number of elements
+        &ecc,           // eccentricity
+        0,              // stride of eccentricity array
+        ma,             // mean anomalies
+        ea,             // solutions
+        KES_STM_ES04,   // starter method
+        KES_SOL_HALLEY, // solver method
+        &data,          // input parameters
+        NULL,           // per-element error codes are not needed
+        iter            // per-element number of iterations
+    );
+
+    /* show results */
+    if ( err == KES_ERR_NOERR )
+    {
+        for (int i = 0; i < NBR; i++)
+        {
+            printf(
+                "M = %f, E = %.15f, iterations = %d\n", ma[i], ea[i], iter[i]
+            );
+        } // end for
+    } // end if
+    else
+    {
+        kes_show_error( err );
+    } // end else
+
+    return 0;
+} // end main
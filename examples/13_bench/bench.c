@@ -0,0 +1,360 @@
+/*******************************************************************************
+ * PROGRAM : bench.c
+ * PURPOSE : benchmark of all pairs of starter and solver methods over a grid
+ *           in the (M,e) plane and over random distributions of (E,e);
+ *           reports throughput of kesolver() and kesolver_batch(),
+ *           p50/p99 latency of single solves, iterations and max. error,
+ *           and the same for kesolver() with the lean convergence test
+ *           KES_CONV_LEAN (one sin/cos pair per iteration instead of an
+ *           extra sin for the residual, usually one more iteration)
+ * AUTHOR  : Bazso Akos
+ * VERSION : 1.0, 14 Oct 2026
+ * COMPILE : use Makefile
+ * USAGE   : bench [-g nM ne] [-n nrand] [-r reps] [-s seed] [-o basename]
+ *           results are written as CSV to stdout, or to basename.csv and
+ *           basename.json if option -o is given
+ ******************************************************************************/
+/* POSIX clock_gettime() and M_PI */
+#define _XOPEN_SOURCE 700
+
+/* include library header file */
+#include "libkes.h"
+
+#include <math.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+
+/* distributions of test problems */
+typedef enum
+{
+    DIST_GRID = 0, // regular grid in (E,e) as in example 10_iterations
+    DIST_UNIFORM,  // random E in [0,2pi), e in [0,1)
+    DIST_HIGH,     // random E in [0,2pi), e in [0.9,1)
+    DIST_TOTAL
+} dist_e;
+
+static const char* dist_name[DIST_TOTAL] = { "grid", "uniform", "high" };
+
+/* results for one pair of methods and one distribution */
+typedef struct
+{
+    double ns_scalar; // mean time per solve of kesolver() [ns]
+    double ns_batch;  // mean time per solve of kesolver_batch() [ns]
+    double p50;       // median latency of single solves [ns]
+    double p99;       // 99th percentile of latency of single solves [ns]
+    double iter_mean; // mean number of iterations
+    int    iter_max;  // max. number of iterations
+    double err_max;   // max. absolute error |E_out - E_ref| [radians]
+    double ns_lean;   // same as ns_scalar with KES_CONV_LEAN [ns]
+    double iter_lean; // same as iter_mean with KES_CONV_LEAN
+    double err_lean;  // same as err_max with KES_CONV_LEAN [radians]
+} result_t;
+
+/* xorshift64* generator, reproducible on all platforms */
+static unsigned long long rng_state = 88172645463325252ULL;
+
+static double rng_uniform(void)
+{
+    rng_state ^= rng_state >> 12;
+    rng_state ^= rng_state << 25;
+    rng_state ^= rng_state >> 27;
+    return( (double)((rng_state * 2685821657736338717ULL) >> 11) *
+            (1.0 / 9007199254740992.0) );
+} // end rng_uniform
+
+/* wall clock time in nanoseconds */
+static double now_ns(void)
+{
+    struct timespec t;
+    clock_gettime(CLOCK_MONOTONIC, &t);
+    return( 1E9 * (double)t.tv_sec + (double)t.tv_nsec );
+} // end now_ns
+
+static int cmp_double(const void* a, const void* b)
+{
+    const double x = *(const double*)a;
+    const double y = *(const double*)b;
+    return( (x > y) - (x < y) );
+} // end cmp_double
+
+/* fill arrays with test problems, reference solution eref */
+static size_t make_problems(
+    const dist_e dist, const int nm, const int ne, const size_t nrand,
+    double* ecc, double* ma, double* eref)
+{
+    size_t n = 0;
+
+    if ( dist == DIST_GRID )
+    {
+        for (int i = 0; i <= nm; i++)
+        {
+            for (int j = 0; j < ne; j++)
+            {
+                eref[n] = M_PI * (double)i / nm;
+                ecc[n]  = (double)j / ne;
+                ma[n]   = eref[n] - ecc[n] * sin(eref[n]);
+                ++n;
+            } // end for(j)
+        } // end for(i)
+    } // end if
+    else
+    {
+        const double e0 = ((dist == DIST_HIGH) ? 0.9 : 0.0);
+
+        for (n = 0; n < nrand; n++)
+        {
+            eref[n] = 2.0 * M_PI * rng_uniform();
+            ecc[n]  = e0 + (1.0 - e0) * rng_uniform();
+            ma[n]   = eref[n] - ecc[n] * sin(eref[n]);
+        } // end for
+    } // end else
+
+    return( n );
+} // end make_problems
+
+/* benchmark one pair of methods, returns 0 if the pair is not valid */
+static int run_pair(
+    const kes_stm_e init, const kes_sol_e iter, const size_t n, const int reps,
+    const double* ecc, const double* ma, const double* eref, double* ea,
+    double* lat, const double overhead, result_t* res)
+{
+    kes_input_t data = kes_new_input();
+    kes_err_e   status;
+
+    /* check pair once */
+    kesolver(0.5, 1.0, init, iter, &data, &status);
+    if ( status != KES_ERR_NOERR )
+    {
+        return( 0 );
+    } // end if
+
+    /* accuracy, iterations and latency of single solves */
+    long itsum = 0;
+    res->iter_max = 0;
+    res->err_max  = 0.0;
+    for (size_t i = 0; i < n; i++)
+    {
+        const double t0  = now_ns();
+        const double sol = kesolver(ecc[i], ma[i], init, iter, &data, &status);
+        const double t1  = now_ns();
+
+        lat[i] = t1 - t0 - overhead;
+
+        /* NOTE compare on the circle, E_ref close to 2pi may give E_out ~ 0 */
+        const double err = fabs(remainder(sol - eref[i], 2.0 * M_PI));
+        res->err_max  = ((err > res->err_max) ? err : res->err_max);
+        res->iter_max = ((data.iterations > res->iter_max) ?
+                         data.iterations : res->iter_max);
+        itsum += data.iterations;
+    } // end for
+    res->iter_mean = (double)itsum / n;
+
+    qsort(lat, n, sizeof(double), cmp_double);
+    res->p50 = lat[n / 2];
+    res->p99 = lat[(size_t)(0.99 * (n - 1))];
+
+    /* throughput of scalar solver without timer calls */
+    double t0 = now_ns();
+    for (int r = 0; r < reps; r++)
+    {
+        for (size_t i = 0; i < n; i++)
+        {
+            ea[i] = kesolver(ecc[i], ma[i], init, iter, &data, &status);
+        } // end for(i)
+    } // end for(r)
+    res->ns_scalar = (now_ns() - t0) / ((double)reps * n);
+
+    /* throughput of batch solver */
+    t0 = now_ns();
+    for (int r = 0; r < reps; r++)
+    {
+        kesolver_batch(n, ecc, 1, ma, ea, init, iter, &data, NULL, NULL);
+    } // end for(r)
+    res->ns_batch = (now_ns() - t0) / ((double)reps * n);
+
+    /* trade-off of lean convergence test: fewer sin per iteration,
+     * but the residual of the previous iterate stops the iterations
+     */
+    kes_input_t lean = kes_new_input( .conv = KES_CONV_LEAN );
+    itsum         = 0;
+    res->err_lean = 0.0;
+    for (size_t i = 0; i < n; i++)
+    {
+        const double sol = kesolver(ecc[i], ma[i], init, iter, &lean, &status);
+        const double err = fabs(remainder(sol - eref[i], 2.0 * M_PI));
+        res->err_lean = ((err > res->err_lean) ? err : res->err_lean);
+        itsum += lean.iterations;
+    } // end for
+    res->iter_lean = (double)itsum / n;
+
+    t0 = now_ns();
+    for (int r = 0; r < reps; r++)
+    {
+        for (size_t i = 0; i < n; i++)
+        {
+            ea[i] = kesolver(ecc[i], ma[i], init, iter, &lean, &status);
+        } // end for(i)
+    } // end for(r)
+    res->ns_lean = (now_ns() - t0) / ((double)reps * n);
+
+    return( 1 );
+} // end run_pair
+
+int main(int argc, char* argv[])
+{
+    /* default parameters */
+    int         nm    = 256;   // grid resolution in E
+    int         ne    = 64;    // grid resolution in e
+    size_t      nrand = 16384; // number of random problems
+    int         reps  = 5;     // repetitions of throughput measurements
+    const char* base  = NULL;  // basename of output files
+
+    for (int a = 1; a < argc; a++)
+    {
+        if ( !strcmp(argv[a], "-g") && (a + 2 < argc) )
+        {
+            nm = atoi(argv[++a]);
+            ne = atoi(argv[++a]);
+        } // end if
+        else if ( !strcmp(argv[a], "-n") && (a + 1 < argc) )
+        {
+            nrand = (size_t)atol(argv[++a]);
+        } // end if
+        else if ( !strcmp(argv[a], "-r") && (a + 1 < argc) )
+        {
+            reps = atoi(argv[++a]);
+        } // end if
+        else if ( !strcmp(argv[a], "-s") && (a + 1 < argc) )
+        {
+            rng_state = strtoull(argv[++a], NULL, 10) | 1ULL;
+        } // end if
+        else if ( !strcmp(argv[a], "-o") && (a + 1 < argc) )
+        {
+            base = argv[++a];
+        } // end if
+        else
+        {
+            fprintf(stderr, "usage: %s [-g nM ne] [-n nrand] [-r reps] "
+                    "[-s seed] [-o basename]\n", argv[0]);
+            return 1;
+        } // end else
+    } // end for
+
+    if ( (nm < 1) || (ne < 1) || (nrand < 1) || (reps < 1) )
+    {
+        fprintf(stderr, "%s: invalid parameters\n", argv[0]);
+        return 1;
+    } // end if
+
+    /* allocate work space for largest distribution */
+    const size_t nmax = (((size_t)(nm + 1) * ne > nrand) ?
+                         (size_t)(nm + 1) * ne : nrand);
+    double* ecc  = malloc(nmax * sizeof(double));
+    double* ma   = malloc(nmax * sizeof(double));
+    double* eref = malloc(nmax * sizeof(double));
+    double* ea   = malloc(nmax * sizeof(double));
+    double* lat  = malloc(nmax * sizeof(double));
+    if ( !ecc || !ma || !eref || !ea || !lat )
+    {
+        fprintf(stderr, "%s: out of memory\n", argv[0]);
+        return 1;
+    } // end if
+
+    /* overhead of timer calls: median of empty measurements */
+    for (size_t i = 0; i < nmax; i++)
+    {
+        const double t0 = now_ns();
+        lat[i] = now_ns() - t0;
+    } // end for
+    qsort(lat, nmax, sizeof(double), cmp_double);
+    const double overhead = lat[nmax / 2];
+
+    /* output streams */
+    FILE* csv  = stdout;
+    FILE* json = NULL;
+    if ( base != NULL )
+    {
+        char name[1024];
+        snprintf(name, sizeof(name), "%s.csv", base);
+        csv  = fopen(name, "w");
+        snprintf(name, sizeof(name), "%s.json", base);
+        json = fopen(name, "w");
+        if ( !csv || !json )
+        {
+            fprintf(stderr, "%s: cannot open output files\n", argv[0]);
+            return 1;
+        } // end if
+    } // end if
+
+    fprintf(csv, "dist,n,starter,solver,ns_scalar,msolves_scalar,ns_batch,"
+            "msolves_batch,p50_ns,p99_ns,iter_mean,iter_max,err_max,"
+            "ns_lean,iter_lean,err_lean\n");
+    if ( json != NULL )
+    {
+        fprintf(json, "{\n  \"library\": \"libkes %d.%d\",\n"
+                "  \"isa\": \"%s\",\n"
+                "  \"grid\": [%d, %d],\n  \"nrand\": %lu,\n"
+                "  \"reps\": %d,\n  \"timer_overhead_ns\": %.1f,\n"
+                "  \"results\": [",
+                kes_get_major_version(), kes_get_minor_version(),
+                kes_get_isa(), nm, ne, (unsigned long)nrand, reps, overhead);
+    } // end if
+
+    int first = 1;
+    for (int d = 0; d < DIST_TOTAL; d++)
+    {
+        const size_t n = make_problems((dist_e)d, nm, ne, nrand,
+                                       ecc, ma, eref);
+
+        for (int s = KES_STM_NONE + 1; s < KES_STM_TOTAL; s++)
+        {
+            for (int t = KES_SOL_NONE + 1; t < KES_SOL_TOTAL; t++)
+            {
+                result_t res;
+                if ( !run_pair((kes_stm_e)s, (kes_sol_e)t, n, reps, ecc, ma,
+                               eref, ea, lat, overhead, &res) )
+                {
+                    continue;
+                } // end if
+
+                fprintf(csv, "%s,%lu,%d,%d,%.2f,%.3f,%.2f,%.3f,%.1f,%.1f,"
+                        "%.3f,%d,%.3e,%.2f,%.3f,%.3e\n", dist_name[d],
+                        (unsigned long)n, s, t, res.ns_scalar,
+                        1E3 / res.ns_scalar, res.ns_batch, 1E3 / res.ns_batch,
+                        res.p50, res.p99, res.iter_mean, res.iter_max,
+                        res.err_max, res.ns_lean, res.iter_lean,
+                        res.err_lean);
+
+                if ( json != NULL )
+                {
+                    fprintf(json, "%s\n    {\"dist\": \"%s\", \"n\": %lu, "
+                            "\"starter\": %d, \"solver\": %d, "
+                            "\"ns_scalar\": %.2f, \"ns_batch\": %.2f, "
+                            "\"p50_ns\": %.1f, \"p99_ns\": %.1f, "
+                            "\"iter_mean\": %.3f, \"iter_max\": %d, "
+                            "\"err_max\": %.3e, \"ns_lean\": %.2f, "
+                            "\"iter_lean\": %.3f, \"err_lean\": %.3e}",
+                            (first ? "" : ","),
+                            dist_name[d], (unsigned long)n, s, t,
+                            res.ns_scalar, res.ns_batch, res.p50, res.p99,
+                            res.iter_mean, res.iter_max, res.err_max,
+                            res.ns_lean, res.iter_lean, res.err_lean);
+                    first = 0;
+                } // end if
+            } // end for(t)
+        } // end for(s)
+    } // end for(d)
+
+    if ( json != NULL )
+    {
+        fprintf(json, "\n  ]\n}\n");
+        fclose(json);
+        fclose(csv);
+    } // end if
+
+    free(ecc); free(ma); free(eref); free(ea); free(lat);
+
+    return 0;
+} // end main
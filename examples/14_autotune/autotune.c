@@ -0,0 +1,325 @@
+/*******************************************************************************
+ * PROGRAM : autotune.c
+ * PURPOSE : regenerate the dispatch table of KES_SOL_AUTO for the hardware
+ *           at hand; for each region of (e,M) the fastest pair of starter
+ *           and solver method is selected, which reaches the tolerance for
+ *           all sampled problems of that region
+ * AUTHOR  : Bazso Akos
+ * VERSION : 1.0, 14 Oct 2026
+ * COMPILE : use Makefile
+ * USAGE   : autotune [-n nsample] [-r reps] [-t tol] [-s seed] [-o file]
+ *           the table is written as C initializer to stdout or to file,
+ *           ready to replace the built-in table in src/autosel.c or to be
+ *           passed to kes_set_auto_table(); a summary goes to stderr
+ ******************************************************************************/
+/* POSIX clock_gettime() and M_PI */
+#define _XOPEN_SOURCE 700
+
+/* include library header file */
+#include "libkes.h"
+
+#include <math.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+
+/* names of methods as used in the source code */
+static const char* sol_name[KES_SOL_TOTAL] = {
+    "KES_SOL_NONE",    "KES_SOL_BISECT",  "KES_SOL_DANBUR4", "KES_SOL_DANBUR5",
+    "KES_SOL_FIXEDP",  "KES_SOL_HALLEY",  "KES_SOL_LAGCON",  "KES_SOL_MARKLEY",
+    "KES_SOL_MIKKOLA", "KES_SOL_NEWRAP",  "KES_SOL_NIJENH",  "KES_SOL_SECANT",
+    "KES_SOL_WEGSEC",  "KES_SOL_BRENT",   "KES_SOL_CORDIC",  "KES_SOL_FUKUSH",
+    "KES_SOL_EKS",     "KES_SOL_HYBRID"
+};
+
+/* solvers of distinct order for the hyperbolic case, see kes_hyp_order() */
+static const kes_sol_e hyp_list[4] = {
+    KES_SOL_NEWRAP, KES_SOL_HALLEY, KES_SOL_DANBUR4, KES_SOL_DANBUR5
+};
+
+/* relative improvement of time required to replace the selected pair */
+#define MARGIN 0.97
+
+/* solver methods ignoring the starter, only tested with KES_STM_ES00 */
+static int own_starter(const kes_sol_e iter)
+{
+    return( (iter == KES_SOL_BISECT)  || (iter == KES_SOL_MARKLEY) ||
+            (iter == KES_SOL_MIKKOLA) || (iter == KES_SOL_NIJENH)  ||
+            (iter == KES_SOL_SECANT)  || (iter == KES_SOL_BRENT)   ||
+            (iter == KES_SOL_CORDIC)  || (iter == KES_SOL_FUKUSH)  ||
+            (iter == KES_SOL_EKS) );
+} // end own_starter
+
+/* xorshift64* generator, reproducible on all platforms */
+static unsigned long long rng_state = 88172645463325252ULL;
+
+static double rng_uniform(void)
+{
+    rng_state ^= rng_state >> 12;
+    rng_state ^= rng_state << 25;
+    rng_state ^= rng_state >> 27;
+    return( (double)((rng_state * 2685821657736338717ULL) >> 11) *
+            (1.0 / 9007199254740992.0) );
+} // end rng_uniform
+
+/* wall clock time in nanoseconds */
+static double now_ns(void)
+{
+    struct timespec t;
+    clock_gettime(CLOCK_MONOTONIC, &t);
+    return( 1E9 * (double)t.tv_sec + (double)t.tv_nsec );
+} // end now_ns
+
+/* sample problems of elliptic region (i,j) by rejection of E in [0,pi],
+ * NOTE excluding parabolic orbits |e - 1| <= 1E-10
+ */
+static void make_region(
+    const int i, const int j, const size_t n, double* ecc, double* ma)
+{
+    const double e0 = kes_auto_ecc[i];
+    const double e1 = fmin(kes_auto_ecc[i + 1], 1.0 - 1E-9);
+    const double m0 = kes_auto_ma[j],  m1 = kes_auto_ma[j + 1];
+
+    for (size_t k = 0; k < n; )
+    {
+        const double e = e0 + (e1 - e0) * rng_uniform();
+        const double x = M_PI * rng_uniform();
+        const double m = x - e * sin(x);
+
+        if ( (e < e1) && (m >= m0) && (m < m1) )
+        {
+            ecc[k] = e;
+            ma[k]  = m;
+            ++k;
+        } // end if
+    } // end for
+} // end make_region
+
+/* sample hyperbolic problems, 1 < e < 10 and 0 <= H < 10 */
+static void make_hyp(const size_t n, double* ecc, double* ma)
+{
+    for (size_t k = 0; k < n; k++)
+    {
+        const double h = 10.0 * rng_uniform();
+        ecc[k] = 1.0 + 1E-6 + 9.0 * rng_uniform();
+        ma[k]  = ecc[k] * sinh(h) - h;
+    } // end for
+} // end make_hyp
+
+/* time per solve of one pair of methods [ns], or -1 if the pair does not
+ * reach the tolerance "tol" of the residual for all problems (0 = no check)
+ */
+static double run_pair(
+    const kes_stm_e init, const kes_sol_e iter, const size_t n, const int reps,
+    const double tol, const double* ecc, const double* ma, double* ea)
+{
+    kes_input_t data = kes_new_input();
+    kes_err_e   status;
+
+    /* accuracy check, NOTE residuals relative to max(1, |E|, |M|) */
+    for (size_t k = 0; (tol > 0.0) && (k < n); k++)
+    {
+        const double x = kesolver(ecc[k], ma[k], init, iter, &data, &status);
+        const double f = ((ecc[k] < 1.0) ? x - ecc[k] * sin(x) - ma[k] :
+                          ecc[k] * sinh(x) - x - ma[k]);
+
+        if ( (status != KES_ERR_NOERR) || (data.iterations >= data.maxiter) ||
+             !(fabs(f) <= tol * fmax(1.0, fmax(fabs(x), fabs(ma[k])))) )
+        {
+            return( -1.0 );
+        } // end if
+    } // end for
+
+    /* best of several repetitions */
+    double best = HUGE_VAL;
+    for (int r = 0; r < reps; r++)
+    {
+        const double t0 = now_ns();
+        for (size_t k = 0; k < n; k++)
+        {
+            ea[k] = kesolver(ecc[k], ma[k], init, iter, &data, &status);
+        } // end for(k)
+        const double t = (now_ns() - t0) / n;
+        best = ((t < best) ? t : best);
+    } // end for(r)
+
+    return( best );
+} // end run_pair
+
+/* mean time per solve of kesolver() with KES_SOL_AUTO [ns] */
+static double run_auto(
+    const size_t n, const int reps, const double* ecc, const double* ma,
+    double* ea)
+{
+    return( run_pair(KES_STM_NONE, KES_SOL_AUTO, n, reps, 0.0, ecc, ma, ea) );
+} // end run_auto
+
+int main(int argc, char* argv[])
+{
+    /* default parameters */
+    size_t      n    = 2048;  // problems per region
+    int         reps = 5;     // repetitions of time measurements
+    double      tol  = 1E-14; // tolerance of residual
+    const char* file = NULL;  // output file
+
+    for (int a = 1; a < argc; a++)
+    {
+        if ( !strcmp(argv[a], "-n") && (a + 1 < argc) )
+        {
+            n = (size_t)atol(argv[++a]);
+        } // end if
+        else if ( !strcmp(argv[a], "-r") && (a + 1 < argc) )
+        {
+            reps = atoi(argv[++a]);
+        } // end if
+        else if ( !strcmp(argv[a], "-t") && (a + 1 < argc) )
+        {
+            tol = atof(argv[++a]);
+        } // end if
+        else if ( !strcmp(argv[a], "-s") && (a + 1 < argc) )
+        {
+            rng_state = strtoull(argv[++a], NULL, 10) | 1ULL;
+        } // end if
+        else if ( !strcmp(argv[a], "-o") && (a + 1 < argc) )
+        {
+            file = argv[++a];
+        } // end if
+        else
+        {
+            fprintf(stderr, "usage: %s [-n nsample] [-r reps] [-t tol] "
+                    "[-s seed] [-o file]\n", argv[0]);
+            return 1;
+        } // end else
+    } // end for
+
+    if ( (n < 1) || (reps < 1) || !(tol > 0.0) )
+    {
+        fprintf(stderr, "%s: invalid parameters\n", argv[0]);
+        return 1;
+    } // end if
+
+    /* elliptic problems of all regions, followed by hyperbolic problems */
+    const size_t nall = n * KES_AUTO_ECC_BINS * KES_AUTO_MA_BINS;
+    double* ecc = malloc((nall + n) * sizeof(double));
+    double* ma  = malloc((nall + n) * sizeof(double));
+    double* ea  = malloc((nall + n) * sizeof(double));
+    if ( !ecc || !ma || !ea )
+    {
+        fprintf(stderr, "%s: out of memory\n", argv[0]);
+        return 1;
+    } // end if
+
+    /* start from built-in table, keep entries without any valid pair */
+    kes_auto_table_t tab;
+    kes_set_auto_table(NULL);
+    kes_get_auto_table(&tab);
+
+    /* elliptic regions: test all pairs of methods */
+    for (int i = 0; i < KES_AUTO_ECC_BINS; i++)
+    {
+        for (int j = 0; j < KES_AUTO_MA_BINS; j++)
+        {
+            double* e = ecc + (i * KES_AUTO_MA_BINS + j) * n;
+            double* m = ma  + (i * KES_AUTO_MA_BINS + j) * n;
+            make_region(i, j, n, e, m);
+
+            double best = HUGE_VAL;
+            for (int s = KES_STM_NONE + 1; s < KES_STM_TOTAL; s++)
+            {
+                for (int t = KES_SOL_NONE + 1; t < KES_SOL_TOTAL; t++)
+                {
+                    if ( (s != KES_STM_ES00) && own_starter((kes_sol_e)t) )
+                    {
+                        continue;
+                    } // end if
+
+                    const double ns = run_pair((kes_stm_e)s, (kes_sol_e)t,
+                                               n, reps, tol, e, m, ea);
+                    /* NOTE replace only if clearly faster, keeps the
+                     * selection stable against noise of the timings
+                     */
+                    if ( (ns >= 0.0) && (ns < MARGIN * best) )
+                    {
+                        best = ns;
+                        tab.ell[i][j].init = (kes_stm_e)s;
+                        tab.ell[i][j].iter = (kes_sol_e)t;
+                    } // end if
+                } // end for(t)
+            } // end for(s)
+
+            fprintf(stderr, "%.2f <= e < %.2f, %.1f <= M < %.1f: "
+                    "KES_STM_ES%02d, %-16s %7.1f ns\n",
+                    kes_auto_ecc[i], kes_auto_ecc[i + 1],
+                    kes_auto_ma[j], kes_auto_ma[j + 1],
+                    (int)tab.ell[i][j].init - 1, sol_name[tab.ell[i][j].iter],
+                    best);
+        } // end for(j)
+    } // end for(i)
+
+    /* hyperbolic case: built-in starter, test solvers of distinct order */
+    {
+        double* e = ecc + nall;
+        double* m = ma  + nall;
+        make_hyp(n, e, m);
+
+        double best = HUGE_VAL;
+        for (int t = 0; t < 4; t++)
+        {
+            const double ns = run_pair(KES_STM_ES04, hyp_list[t], n, reps,
+                                       tol, e, m, ea);
+            if ( (ns >= 0.0) && (ns < best) )
+            {
+                best    = ns;
+                tab.hyp = hyp_list[t];
+            } // end if
+        } // end for(t)
+
+        fprintf(stderr, "hyperbolic: %-16s %7.1f ns\n",
+                sol_name[tab.hyp], best);
+    } // end block
+
+    /* write table in the format of src/autosel.c */
+    FILE* out = stdout;
+    if ( (file != NULL) && ((out = fopen(file, "w")) == NULL) )
+    {
+        fprintf(stderr, "%s: cannot open %s\n", argv[0], file);
+        return 1;
+    } // end if
+
+    fprintf(out, "/* built-in dispatch table, generated by "
+            "examples/14_autotune */\nstatic const kes_auto_table_t "
+            "auto_default = {\n    .ell = {\n");
+    for (int i = 0; i < KES_AUTO_ECC_BINS; i++)
+    {
+        fprintf(out, "        /* %g <= ecc < %g */\n        {",
+                kes_auto_ecc[i], kes_auto_ecc[i + 1]);
+        for (int j = 0; j < KES_AUTO_MA_BINS; j++)
+        {
+            fprintf(out, "{KES_STM_ES%02d, %s}%s",
+                    (int)tab.ell[i][j].init - 1, sol_name[tab.ell[i][j].iter],
+                    ((j == KES_AUTO_MA_BINS - 1) ? "}" :
+                     ((j % 2) ? ",\n         " : ", ")));
+        } // end for(j)
+        fprintf(out, "%s\n", ((i == KES_AUTO_ECC_BINS - 1) ? "" : ","));
+    } // end for(i)
+    fprintf(out, "    },\n    .hyp = %s\n};\n", sol_name[tab.hyp]);
+
+    if ( out != stdout )
+    {
+        fclose(out);
+    } // end if
+
+    /* compare built-in and regenerated table over all elliptic samples */
+    const double nsdef = run_auto(nall, reps, ecc, ma, ea);
+    if ( kes_set_auto_table(&tab) == KES_ERR_NOERR )
+    {
+        const double nsnew = run_auto(nall, reps, ecc, ma, ea);
+        fprintf(stderr, "KES_SOL_AUTO: built-in table %.1f ns, "
+                "regenerated table %.1f ns per solve\n", nsdef, nsnew);
+    } // end if
+
+    free(ecc); free(ma); free(ea);
+
+    return 0;
+} // end main
@@ -0,0 +1,50 @@
+/*******************************************************************************
+ * PROGRAM : inline.c
+ * PURPOSE : an example on how to use the header-only solvers of libkes_inline.h
+ *           for a fixed pair of starter and solver methods in a loop which the
+ *           compiler can vectorize, compared with results of kesolver()
+ * AUTHOR  : Bazso Akos
+ * VERSION : 1.0, 14 Oct 2026
+ * COMPILE : use Makefile
+ ******************************************************************************/
+/* include library header files */
+#include "libkes.h"
+#include "libkes_inline.h"
+
+#include <math.h>
+#include <stdio.h>
+
+#define NBR 8
+
+int main(void)
+{
+    /* input parameters for kesolver() with the same fixed iterations */
+    kes_input_t data = kes_new_input();
+    data.fixiter = KES_FIX_AUTO;
+    kes_err_e status;
+
+    /* common eccentricity and arrays of mean anomalies */
+    const double ecc = 0.567;
+    double ma[NBR], ea[NBR];
+
+    for (int i = 0; i < NBR; i++)
+    {
+        ma[i] = 0.8 * i;
+    } // end for
+
+    /* no function calls inside the loop after inlining */
+    for (int i = 0; i < NBR; i++)
+    {
+        ea[i] = kes_solve_es08_danbur5(ecc, ma[i]);
+    } // end for
+
+    printf("  i       ma                 inline             kesolver\n");
+    for (int i = 0; i < NBR; i++)
+    {
+        const double ref = kesolver(ecc, ma[i], KES_STM_ES08, KES_SOL_DANBUR5,
+                                    &data, &status);
+        printf("%3d  %.15f  %.15f  %.15f\n", i, ma[i], ea[i], ref);
+    } // end for
+
+    return 0;
+} // end main
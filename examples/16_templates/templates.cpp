@@ -0,0 +1,59 @@
+/*******************************************************************************
+ * PROGRAM : templates.cpp
+ * PURPOSE : an example on how to use the C++ templates of libkes.hpp with
+ *           starter, solver and stopping criterion selected at compile time,
+ *           for single values, ranges and with std::transform
+ * AUTHOR  : Bazso Akos
+ * VERSION : 1.0, 14 Oct 2026
+ * COMPILE : use Makefile
+ ******************************************************************************/
+/* include library header files */
+#include "libkes.h"
+#include "libkes.hpp"
+
+#include <algorithm>
+#include <cstdio>
+#include <vector>
+
+int main(void)
+{
+    const double ecc = 0.567;
+    const double ma  = 1.234;
+
+    /* single solve, converged to |dx| <= 1E-14 */
+    const double ea = kes::solve<kes::starter::S08, kes::solver::Halley,
+                                 kes::Tol<14>>(ecc, ma);
+
+    /* same problem with the C library for comparison */
+    kes_input_t data = kes_new_input();
+    kes_err_e   status;
+    const double ref = kesolver(ecc, ma, KES_STM_ES08, KES_SOL_HALLEY,
+                                &data, &status);
+
+    std::printf("kes::solve : %.15f\nkesolver   : %.15f\n", ea, ref);
+
+    /* range of mean anomalies, fixed number of iterations */
+    std::vector<double> mas(8), eas(8);
+    for (std::size_t i = 0; i < mas.size(); i++)
+    {
+        mas[i] = 0.8 * i;
+    } // end for
+    kes::solve<kes::starter::S08, kes::solver::Danby5, kes::Fixed<7>>(
+        ecc, mas.begin(), mas.end(), eas.begin());
+
+    /* the same with a function object; for large arrays add the execution
+     * policy std::execution::par_unseq of C++17 as first argument
+     */
+    typedef kes::kepler<kes::starter::S08, kes::solver::Danby5,
+                        kes::Fixed<7>> kepler_t;
+    std::vector<double> eas2(mas.size());
+    std::transform(mas.begin(), mas.end(), eas2.begin(), kepler_t{ecc});
+
+    for (std::size_t i = 0; i < mas.size(); i++)
+    {
+        std::printf("%3d  %.15f  %.15f  %.15f\n",
+                    (int)i, mas[i], eas[i], eas2[i]);
+    } // end for
+
+    return 0;
+} // end main
@@ -0,0 +1,72 @@
+/*******************************************************************************
+ * PROGRAM : state.c
+ * PURPOSE : an example on how to convert orbital elements and mean anomalies
+ *           to Cartesian position and velocity with kes_elements_to_state(),
+ *           for a common orbit and for an array of orbits
+ * AUTHOR  : Bazso Akos
+ * VERSION : 1.0, 14 Oct 2026
+ * COMPILE : use Makefile
+ ******************************************************************************/
+/* include library header file */
+#include "libkes.h"
+
+#include <stdio.h>
+
+#define NBR 4
+
+int main(void)
+{
+    /* gravitational parameter of the Earth [km^3/s^2] */
+    const double mu = 398600.4418;
+
+    /* one orbit, four epochs: semi-major axis [km], angles in radians */
+    double a    = 26560.0;
+    double ecc  = 0.01;
+    double inc  = 0.96;
+    double node = 1.0;
+    double argp = 0.5;
+    double ma[NBR] = { 0.0, 1.5, 3.0, 4.5 };
+
+    /* stride 0: elements common to all mean anomalies */
+    const kes_elements_t orbit = { &a, &ecc, &inc, &node, &argp, 0 };
+
+    /* output in structure-of-arrays layout */
+    double x[NBR], y[NBR], z[NBR], vx[NBR], vy[NBR], vz[NBR];
+    kes_state_t state = { x, y, z, vx, vy, vz };
+
+    kes_err_e err = kes_elements_to_state(NBR, mu, &orbit, ma, &state,
+                                          KES_STM_ES04, KES_SOL_DANBUR5,
+                                          NULL, NULL);
+
+    printf("common orbit (status %d):\n", err);
+    for (int i = 0; i < NBR; i++)
+    {
+        printf("  r = (%10.3f, %10.3f, %10.3f) km,"
+               "  v = (%7.4f, %7.4f, %7.4f) km/s\n",
+               x[i], y[i], z[i], vx[i], vy[i], vz[i]);
+    } // end for
+
+    /* four orbits at one epoch each, the last one hyperbolic (a < 0) */
+    double av[NBR]    = { 7000.0, 26560.0, 42164.0, -20000.0 };
+    double eccv[NBR]  = { 0.001, 0.01, 0.0, 1.5 };
+    double incv[NBR]  = { 1.7, 0.96, 0.0, 0.5 };
+    double nodev[NBR] = { 0.0, 1.0, 0.0, 2.0 };
+    double argpv[NBR] = { 0.0, 0.5, 0.0, 1.0 };
+    kes_err_e status[NBR];
+
+    /* stride 1: arrays of orbits */
+    const kes_elements_t orbits = { av, eccv, incv, nodev, argpv, 1 };
+
+    err = kes_elements_to_state(NBR, mu, &orbits, ma, &state,
+                                KES_STM_ES04, KES_SOL_DANBUR5, NULL, status);
+
+    printf("array of orbits (status %d):\n", err);
+    for (int i = 0; i < NBR; i++)
+    {
+        printf("  r = (%10.3f, %10.3f, %10.3f) km,"
+               "  v = (%7.4f, %7.4f, %7.4f) km/s  [%d]\n",
+               x[i], y[i], z[i], vx[i], vy[i], vz[i], status[i]);
+    } // end for
+
+    return 0;
+} // end main
@@ -0,0 +1,63 @@
+/*******************************************************************************
+ * PROGRAM : table.c
+ * PURPOSE : an example on how to attach a piecewise Chebyshev table to a
+ *           solver plan with kes_plan_table_init(), for one orbit evaluated
+ *           at many epochs, and how to query its memory footprint
+ * AUTHOR  : Bazso Akos
+ * VERSION : 1.0, 14 Oct 2026
+ * COMPILE : use Makefile
+ ******************************************************************************/
+/* include library header file */
+#include "libkes.h"
+
+#include <math.h>
+#include <stdio.h>
+
+#define NBR 8
+
+int main(void)
+{
+    const double ecc = 0.9;
+    double       ma[NBR], ea[NBR], et[NBR];
+
+    /* mean anomalies of a time sequence M = n*t, over more than one orbit */
+    for (int i = 0; i < NBR; i++)
+    {
+        ma[i] = 1E-3 + 1.7 * i;
+    } // end for
+
+    /* iterative solutions with the plan */
+    kes_plan_t plan;
+    kes_err_e  err = kes_plan_init(&plan, ecc, KES_STM_ES04, KES_SOL_DANBUR5,
+                                   NULL);
+    if ( err != KES_ERR_NOERR )
+    {
+        kes_show_error(err);
+        return 1;
+    } // end if
+    kes_plan_solve_batch(&plan, ma, ea, NBR);
+
+    /* fit E(M) once with the default tolerance, then solve from the table */
+    err = kes_plan_table_init(&plan, 0.0);
+    if ( err != KES_ERR_NOERR )
+    {
+        kes_show_error(err);
+        return 1;
+    } // end if
+    printf("table for ecc = %g takes %lu bytes\n\n", ecc,
+           (unsigned long)kes_plan_table_bytes(&plan));
+
+    kes_plan_solve_batch(&plan, ma, et, NBR);
+
+    printf("%8s %22s %22s %10s\n", "M", "E (iterative)", "E (table)", "diff");
+    for (int i = 0; i < NBR; i++)
+    {
+        printf("%8.3f %22.16f %22.16f %10.2e\n", ma[i], ea[i], et[i],
+               fabs(et[i] - ea[i]));
+    } // end for
+
+    /* release the table, the plan iterates again */
+    kes_plan_table_free(&plan);
+
+    return 0;
+} // end main
@@ -0,0 +1,686 @@
+/*******************************************************************************
+ * PROGRAM : kes.c
+ * PURPOSE : command-line solver for streams of (e,M) records, e.g. as a stage
+ *           of a pipeline; input files are memory-mapped, the records are
+ *           solved in blocks with kesolver_batch_mt() and the solutions E,
+ *           optionally true anomaly nu and iterations, are written as text
+ *           (CSV) or as raw little-endian doubles
+ * AUTHOR  : Bazso Akos
+ * VERSION : 1.0, 14 Oct 2026
+ * COMPILE : use Makefile
+ * USAGE   : kes [-b] [-B] [-e ecc] [-s starter] [-m solver] [-j threads]
+ *               [-n] [-i] [-o outfile] [infile]
+ *           -b  input is raw binary, 2 doubles (e,M) per record, or 1 double
+ *               (M) with option -e; default is text with numbers separated
+ *               by commas, semicolons or white space, lines starting with
+ *               '#' and a header line are skipped
+ *           -B  binary output, 1 to 3 doubles per record: E [nu] [iter]
+ *           -e  common eccentricity, input records hold only M
+ *           -s  starter method (number of enum kes_stm_e, default 5 = S4)
+ *           -m  solver method (number of enum kes_sol_e or name, e.g.
+ *               "danbur5" (default), "newrap" or "auto")
+ *           -j  number of threads (default 0 = all processors)
+ *           -n  also output the true anomaly nu
+ *           -i  also output the number of iterations
+ *           -o  output file (memory-mapped), default is stdout
+ *           input is read from stdin if infile is missing or "-";
+ *           failed records are written as NAN and counted on stderr
+ ******************************************************************************/
+/* POSIX mmap(), posix_madvise() and ftruncate() */
+#define _XOPEN_SOURCE 700
+
+/* include library header file */
+#include "libkes.h"
+
+#include <errno.h>
+#include <fcntl.h>
+#include <math.h>
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+/* number of records solved per call of kesolver_batch_mt() */
+#define BLOCK    65536
+
+/* size of read buffer for stdin, max. length of text lines */
+#define BUFSIZE  (1 << 20)
+#define LINESIZE 256
+
+/* upper bound of characters of one text output record */
+#define RECSIZE  80
+
+/* names of solver methods, in order of enum kes_sol_e */
+static const char* sol_name[KES_SOL_TOTAL] = {
+    "none", "bisect", "danbur4", "danbur5", "fixedp", "halley", "lagcon",
+    "markley", "mikkola", "newrap", "nijenh", "secant", "wegsec", "brent",
+    "cordic", "fukush", "eks", "hybrid"
+};
+
+/* input stream, either a memory-mapped file or a buffer filled from stdin */
+typedef struct
+{
+    const char* data;   // start of input data
+    size_t      size;   // number of valid bytes at data
+    size_t      pos;    // read position
+    int         eof;    // no more data beyond size
+    int         mapped; // data is a memory-mapped file
+    char*       buf;    // read buffer for stdin
+    size_t      line;   // current line number of text input
+    int         header; // no record read yet, a header line may be skipped
+} source_t;
+
+/* output stream, either a memory-mapped file or a stdio stream */
+typedef struct
+{
+    FILE*  fp;   // stdio stream if not mapped
+    int    fd;   // file descriptor of mapped file
+    char*  map;  // start of mapped file (or NULL)
+    size_t size; // size of mapped file
+    size_t pos;  // write position
+} sink_t;
+
+/******************************************************************************/
+
+/* raw binary data is little-endian, swap bytes on big-endian hosts */
+static int host_big_endian(void)
+{
+    const uint32_t one = 1;
+    return( *(const unsigned char*)&one == 0 );
+} // end host_big_endian
+
+static double load_double(const char* p, const int swap)
+{
+    unsigned char b[8];
+    double        x;
+
+    memcpy(b, p, 8);
+    if ( swap )
+    {
+        for (int k = 0; k < 4; k++)
+        {
+            const unsigned char t = b[k];
+            b[k] = b[7 - k];
+            b[7 - k] = t;
+        } // end for
+    } // end if
+    memcpy(&x, b, 8);
+
+    return( x );
+} // end load_double
+
+static void store_double(char* p, const double x, const int swap)
+{
+    unsigned char b[8];
+
+    memcpy(b, &x, 8);
+    if ( swap )
+    {
+        for (int k = 0; k < 4; k++)
+        {
+            const unsigned char t = b[k];
+            b[k] = b[7 - k];
+            b[7 - k] = t;
+        } // end for
+    } // end if
+    memcpy(p, b, 8);
+
+    return;
+} // end store_double
+
+/******************************************************************************/
+
+/* open input, map regular files, returns 0 on failure */
+static int source_open(source_t* src, const char* name)
+{
+    memset(src, 0, sizeof(*src));
+    src->header = 1;
+
+    if ( (name != NULL) && strcmp(name, "-") )
+    {
+        struct stat st;
+        const int   fd = open(name, O_RDONLY);
+
+        if ( (fd < 0) || (fstat(fd, &st) != 0) )
+        {
+            fprintf(stderr, "kes: cannot open %s: %s\n", name, strerror(errno));
+            return( 0 );
+        } // end if
+
+        src->size   = (size_t)st.st_size;
+        src->eof    = 1;
+        src->mapped = 1;
+        if ( src->size > 0 )
+        {
+            void* p = mmap(NULL, src->size, PROT_READ, MAP_PRIVATE, fd, 0);
+            if ( p == MAP_FAILED )
+            {
+                fprintf(stderr, "kes: cannot map %s: %s\n", name,
+                        strerror(errno));
+                close(fd);
+                return( 0 );
+            } // end if
+            posix_madvise(p, src->size, POSIX_MADV_SEQUENTIAL);
+            src->data = p;
+        } // end if
+        close(fd);
+    } // end if
+    else
+    {
+        src->buf = malloc(BUFSIZE);
+        if ( src->buf == NULL )
+        {
+            fprintf(stderr, "kes: out of memory\n");
+            return( 0 );
+        } // end if
+        src->data = src->buf;
+    } // end else
+
+    return( 1 );
+} // end source_open
+
+static void source_close(source_t* src)
+{
+    if ( src->mapped && (src->size > 0) )
+    {
+        munmap((void*)src->data, src->size);
+    } // end if
+    free(src->buf);
+
+    return;
+} // end source_close
+
+/* move unread bytes of stdin buffer to front and read more,
+ * returns 0 if the buffer is full
+ */
+static int source_fill(source_t* src)
+{
+    const size_t rest = src->size - src->pos;
+
+    if ( rest == BUFSIZE )
+    {
+        return( 0 );
+    } // end if
+
+    memmove(src->buf, src->buf + src->pos, rest);
+    src->size = rest;
+    src->pos  = 0;
+
+    const size_t got = fread(src->buf + rest, 1, BUFSIZE - rest, stdin);
+    src->size += got;
+    if ( got == 0 )
+    {
+        src->eof = 1;
+    } // end if
+
+    return( 1 );
+} // end source_fill
+
+/* upper bound of number of records of a mapped file, 0 if unknown */
+static size_t source_bound(const source_t* src, const int binary,
+                           const size_t recbytes)
+{
+    if ( !src->mapped )
+    {
+        return( 0 );
+    } // end if
+    if ( binary )
+    {
+        return( src->size / recbytes );
+    } // end if
+
+    size_t      n = 1;
+    const char* p = src->data;
+    const char* e = src->data + src->size;
+    while ( (p < e) && ((p = memchr(p, '\n', (size_t)(e - p))) != NULL) )
+    {
+        ++n;
+        ++p;
+    } // end while
+
+    return( n );
+} // end source_bound
+
+/* parse one line of text input into ncol numbers,
+ * returns 1 for a record, 0 for a skipped line, -1 for a bad record
+ */
+static int parse_line(source_t* src, const char* p, const size_t len,
+                      const int ncol, double* val)
+{
+    char tmp[LINESIZE];
+
+    ++src->line;
+    if ( len >= LINESIZE )
+    {
+        return( -1 );
+    } // end if
+    memcpy(tmp, p, len);
+    tmp[len] = '\0';
+
+    /* skip empty lines and comments */
+    char* s = tmp + strspn(tmp, " \t\r");
+    if ( (*s == '\0') || (*s == '#') )
+    {
+        return( 0 );
+    } // end if
+
+    for (int k = 0; k < ncol; k++)
+    {
+        char* end;
+        s += strspn(s, " \t\r,;");
+        val[k] = strtod(s, &end);
+        if ( end == s )
+        {
+            /* NOTE a first line that is not a record is taken as header */
+            if ( src->header )
+            {
+                src->header = 0;
+                return( 0 );
+            } // end if
+            return( -1 );
+        } // end if
+        s = end;
+    } // end for
+    src->header = 0;
+
+    return( 1 );
+} // end parse_line
+
+/* read up to max records into arrays ecc (if ncol = 2) and ma,
+ * returns number of records, sets *bad on malformed input
+ */
+static size_t source_read(source_t* src, const int binary, const int ncol,
+                          const int swap, double* ecc, double* ma,
+                          const size_t max, int* bad)
+{
+    const size_t recbytes = 8 * (size_t)ncol;
+    size_t       n        = 0;
+
+    while ( (n < max) && !*bad )
+    {
+        const size_t rest = src->size - src->pos;
+        const char*  p    = src->data + src->pos;
+
+        if ( binary )
+        {
+            if ( rest < recbytes )
+            {
+                if ( !src->eof )
+                {
+                    source_fill(src);
+                    continue;
+                } // end if
+                *bad = (rest > 0);
+                break;
+            } // end if
+
+            if ( ncol == 2 )
+            {
+                ecc[n] = load_double(p, swap);
+            } // end if
+            ma[n++] = load_double(p + recbytes - 8, swap);
+            src->pos += recbytes;
+        } // end if
+        else
+        {
+            const char* nl = ((rest > 0) ? memchr(p, '\n', rest) : NULL);
+
+            if ( (nl == NULL) && !src->eof )
+            {
+                if ( !source_fill(src) )
+                {
+                    *bad = 1;
+                } // end if
+                continue;
+            } // end if
+            if ( (nl == NULL) && (rest == 0) )
+            {
+                break;
+            } // end if
+
+            const size_t len = ((nl != NULL) ? (size_t)(nl - p) : rest);
+            double       val[2];
+            const int    ret = parse_line(src, p, len, ncol, val);
+
+            src->pos += len + (nl != NULL);
+            if ( ret < 0 )
+            {
+                *bad = 1;
+            } // end if
+            else if ( ret > 0 )
+            {
+                if ( ncol == 2 )
+                {
+                    ecc[n] = val[0];
+                } // end if
+                ma[n++] = val[ncol - 1];
+            } // end if
+        } // end else
+    } // end while
+
+    return( n );
+} // end source_read
+
+/******************************************************************************/
+
+/* open output, map a file of (upper bound) size bytes if size > 0,
+ * returns 0 on failure
+ */
+static int sink_open(sink_t* out, const char* name, const size_t size)
+{
+    memset(out, 0, sizeof(*out));
+    out->fp = stdout;
+    out->fd = -1;
+
+    if ( name == NULL )
+    {
+        return( 1 );
+    } // end if
+
+    if ( size == 0 )
+    {
+        out->fp = fopen(name, "wb");
+        if ( out->fp == NULL )
+        {
+            fprintf(stderr, "kes: cannot open %s: %s\n", name, strerror(errno));
+            return( 0 );
+        } // end if
+        return( 1 );
+    } // end if
+
+    out->fd = open(name, O_RDWR | O_CREAT | O_TRUNC, 0644);
+    if ( (out->fd < 0) || (ftruncate(out->fd, (off_t)size) != 0) )
+    {
+        fprintf(stderr, "kes: cannot create %s: %s\n", name, strerror(errno));
+        return( 0 );
+    } // end if
+
+    void* p = mmap(NULL, size, PROT_READ | PROT_WRITE, MAP_SHARED, out->fd, 0);
+    if ( p == MAP_FAILED )
+    {
+        fprintf(stderr, "kes: cannot map %s: %s\n", name, strerror(errno));
+        return( 0 );
+    } // end if
+    out->map  = p;
+    out->size = size;
+    out->fp   = NULL;
+
+    return( 1 );
+} // end sink_open
+
+/* unmap output and truncate to bytes written, returns 0 on failure */
+static int sink_close(sink_t* out)
+{
+    int ok = 1;
+
+    if ( out->map != NULL )
+    {
+        munmap(out->map, out->size);
+        ok = (ftruncate(out->fd, (off_t)out->pos) == 0);
+        ok = (close(out->fd) == 0) && ok;
+    } // end if
+    else if ( out->fp != stdout )
+    {
+        ok = (fclose(out->fp) == 0);
+    } // end if
+    else
+    {
+        ok = (fflush(stdout) == 0);
+    } // end else
+
+    return( ok );
+} // end sink_close
+
+static void sink_write(sink_t* out, const char* p, const size_t len)
+{
+    if ( out->map != NULL )
+    {
+        memcpy(out->map + out->pos, p, len);
+        out->pos += len;
+    } // end if
+    else
+    {
+        fwrite(p, 1, len, out->fp);
+    } // end else
+
+    return;
+} // end sink_write
+
+/* write one output record E [nu] [iter] */
+static void sink_record(sink_t* out, const int binary, const int swap,
+                        const double* val, const int nval)
+{
+    char   rec[RECSIZE];
+    size_t len = 0;
+
+    for (int k = 0; k < nval; k++)
+    {
+        if ( binary )
+        {
+            store_double(rec + len, val[k], swap);
+            len += 8;
+        } // end if
+        else
+        {
+            len += (size_t)snprintf(rec + len, RECSIZE - len, "%s%.17g",
+                                    (k ? "," : ""), val[k]);
+        } // end else
+    } // end for
+    if ( !binary )
+    {
+        rec[len++] = '\n';
+    } // end if
+
+    sink_write(out, rec, len);
+
+    return;
+} // end sink_record
+
+/******************************************************************************/
+
+static int usage(void)
+{
+    fprintf(stderr, "usage: kes [-b] [-B] [-e ecc] [-s starter] [-m solver] "
+            "[-j threads] [-n] [-i] [-o outfile] [infile]\n");
+    return 1;
+} // end usage
+
+int main(int argc, char* argv[])
+{
+    /* default parameters */
+    int         binin   = 0;               // raw binary input
+    int         binout  = 0;               // raw binary output
+    int         common  = 0;               // common eccentricity given
+    double      e0      = 0.0;             // common eccentricity
+    kes_stm_e   init    = KES_STM_ES04;    // starter method
+    kes_sol_e   iter    = KES_SOL_DANBUR5; // solver method
+    int         threads = 0;               // number of threads
+    int         withnu  = 0;               // output true anomaly
+    int         withit  = 0;               // output iterations
+    const char* inname  = NULL;            // input file
+    const char* outname = NULL;            // output file
+
+    for (int a = 1; a < argc; a++)
+    {
+        if ( !strcmp(argv[a], "-b") )
+        {
+            binin = 1;
+        } // end if
+        else if ( !strcmp(argv[a], "-B") )
+        {
+            binout = 1;
+        } // end if
+        else if ( !strcmp(argv[a], "-e") && (a + 1 < argc) )
+        {
+            common = 1;
+            e0     = strtod(argv[++a], NULL);
+        } // end if
+        else if ( !strcmp(argv[a], "-s") && (a + 1 < argc) )
+        {
+            init = (kes_stm_e)atoi(argv[++a]);
+        } // end if
+        else if ( !strcmp(argv[a], "-m") && (a + 1 < argc) )
+        {
+            const char* name = argv[++a];
+
+            iter = (kes_sol_e)atoi(name);
+            if ( !strcmp(name, "auto") )
+            {
+                iter = KES_SOL_AUTO;
+            } // end if
+            for (int t = KES_SOL_NONE + 1; t < KES_SOL_TOTAL; t++)
+            {
+                if ( !strcmp(name, sol_name[t]) )
+                {
+                    iter = (kes_sol_e)t;
+                } // end if
+            } // end for
+        } // end if
+        else if ( !strcmp(argv[a], "-j") && (a + 1 < argc) )
+        {
+            threads = atoi(argv[++a]);
+        } // end if
+        else if ( !strcmp(argv[a], "-n") )
+        {
+            withnu = 1;
+        } // end if
+        else if ( !strcmp(argv[a], "-i") )
+        {
+            withit = 1;
+        } // end if
+        else if ( !strcmp(argv[a], "-o") && (a + 1 < argc) )
+        {
+            outname = argv[++a];
+        } // end if
+        else if ( (argv[a][0] != '-') || !strcmp(argv[a], "-") )
+        {
+            inname = argv[a];
+        } // end if
+        else
+        {
+            return usage();
+        } // end else
+    } // end for
+
+    /* check methods once before reading any input */
+    kes_input_t data = kes_new_input();
+    kes_err_e   err;
+    kesolver(0.5, 1.0, init, iter, &data, &err);
+    if ( (err == KES_ERR_NOERR) && (kes_set_threads(threads) != KES_ERR_NOERR) )
+    {
+        err = KES_ERR_BADVAL;
+    } // end if
+    if ( err != KES_ERR_NOERR )
+    {
+        kes_show_error( err );
+        return usage();
+    } // end if
+    data = kes_new_input();
+
+    /* open input and output */
+    const int ncol = (common ? 1 : 2);
+    const int nval = 1 + withnu + withit;
+    const int swap = host_big_endian();
+    source_t  src;
+    sink_t    out;
+
+    if ( !source_open(&src, inname) )
+    {
+        return 1;
+    } // end if
+
+    const size_t bound = source_bound(&src, binin, 8 * (size_t)ncol);
+    const size_t size  = bound * (binout ? 8 * (size_t)nval : RECSIZE);
+    if ( !sink_open(&out, outname, size) )
+    {
+        source_close(&src);
+        return 1;
+    } // end if
+
+    /* work space for one block of records */
+    double*    ecc    = malloc(BLOCK * sizeof(double));
+    double*    ma     = malloc(BLOCK * sizeof(double));
+    double*    ea     = malloc(BLOCK * sizeof(double));
+    int*       count  = malloc(BLOCK * sizeof(int));
+    kes_err_e* status = malloc(BLOCK * sizeof(kes_err_e));
+    if ( !ecc || !ma || !ea || !count || !status )
+    {
+        fprintf(stderr, "kes: out of memory\n");
+        return 1;
+    } // end if
+
+    /* solve block by block */
+    size_t total = 0;
+    size_t nfail = 0;
+    int    bad   = 0;
+    size_t n;
+
+    while ( (n = source_read(&src, binin, ncol, swap, ecc, ma, BLOCK, &bad)) )
+    {
+        kesolver_batch_mt(n, (common ? &e0 : ecc), (common ? 0 : 1), ma, ea,
+                          init, iter, &data, status, count);
+
+        for (size_t i = 0; i < n; i++)
+        {
+            const double e = (common ? e0 : ecc[i]);
+            double       val[3];
+            int          k = 0;
+
+            if ( status[i] != KES_ERR_NOERR )
+            {
+                ++nfail;
+                ea[i] = NAN;
+            } // end if
+
+            val[k++] = ea[i];
+            if ( withnu )
+            {
+                val[k++] = ((status[i] == KES_ERR_NOERR) ?
+                            kes_trueanom(e, ea[i]) : NAN);
+            } // end if
+            if ( withit )
+            {
+                val[k++] = (double)count[i];
+            } // end if
+
+            sink_record(&out, binout, swap, val, nval);
+        } // end for
+
+        total += n;
+    } // end while
+
+    int ret = 0;
+    if ( bad )
+    {
+        if ( binin )
+        {
+            fprintf(stderr, "kes: incomplete record at end of input\n");
+        } // end if
+        else
+        {
+            fprintf(stderr, "kes: bad record in line %lu\n",
+                    (unsigned long)src.line);
+        } // end else
+        ret = 1;
+    } // end if
+    if ( nfail > 0 )
+    {
+        fprintf(stderr, "kes: %lu of %lu records failed\n",
+                (unsigned long)nfail, (unsigned long)total);
+        ret = 1;
+    } // end if
+    if ( !sink_close(&out) )
+    {
+        fprintf(stderr, "kes: cannot write output: %s\n", strerror(errno));
+        ret = 1;
+    } // end if
+
+    source_close(&src);
+    kes_pool_free();
+    free(ecc); free(ma); free(ea); free(count); free(status);
+
+    return ret;
+} // end main
@@ -0,0 +1,75 @@
+/*******************************************************************************
+ * PROGRAM : gpu.c
+ * PURPOSE : an example on how to solve Kepler's Equation for a batch of
+ *           elements resident on an OpenCL device, e.g. new mean anomalies
+ *           of the same orbits in every step; without a device the same
+ *           calls are solved by the host
+ * AUTHOR  : Bazso Akos
+ * VERSION : 1.0, 14 Oct 2026
+ * COMPILE : use Makefile
+ ******************************************************************************/
+/* include library header file */
+#include "libkes.h"
+
+#include <stdio.h>
+
+#define NBR   8
+#define STEPS 3
+
+int main(void)
+{
+    double ecc[NBR], ma[NBR], ea[NBR];
+    int    iter[NBR];
+
+    printf("OpenCL device available: %s\n\n",
+           (kes_gpu_available() ? "yes" : "no"));
+
+    /* batch of NBR elements, device buffers if possible */
+    kes_err_e  err;
+    kes_gpu_t* gpu = kes_gpu_new(NBR, &err);
+    if ( gpu == NULL )
+    {
+        kes_show_error( err );
+        return 1;
+    } // end if
+
+    /* upload eccentricities once, they stay resident */
+    for (int i = 0; i < NBR; i++)
+    {
+        ecc[i] = 0.1 * i + 0.05;
+    } // end for
+    kes_gpu_upload(gpu, ecc, 1, NULL);
+
+    for (int s = 0; s < STEPS; s++)
+    {
+        /* new mean anomalies of the same orbits */
+        for (int i = 0; i < NBR; i++)
+        {
+            ma[i] = 0.5 + 1.5 * s + 0.1 * i;
+        } // end for
+        kes_gpu_upload(gpu, NULL, 0, ma);
+
+        err = kes_gpu_solve(gpu, KES_STM_ES04, KES_SOL_DANBUR5, NULL);
+        if ( err == KES_ERR_NOERR )
+        {
+            err = kes_gpu_download(gpu, ea, NULL, iter);
+        } // end if
+        if ( err != KES_ERR_NOERR )
+        {
+            kes_show_error( err );
+            break;
+        } // end if
+
+        printf("step %d\n", s);
+        for (int i = 0; i < NBR; i++)
+        {
+            printf("e = %.2f, M = %.2f, E = %.15f, iterations = %d\n",
+                   ecc[i], ma[i], ea[i], iter[i]);
+        } // end for
+        printf("\n");
+    } // end for
+
+    kes_gpu_free(gpu);
+
+    return 0;
+} // end main
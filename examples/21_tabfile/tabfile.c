@@ -0,0 +1,54 @@
+/*******************************************************************************
+ * PROGRAM : tabfile.c
+ * PURPOSE : an example on how to share the lookup table of starter
+ *           KES_STM_ES15 between processes by a memory-mapped table file;
+ *           the file is validated and regenerated if it does not match the
+ *           library, e.g. after a change of version or table parameters
+ * AUTHOR  : Bazso Akos
+ * VERSION : 1.0, 14 Oct 2026
+ * COMPILE : use Makefile
+ * USAGE   : tabfile [path], default path is libkes.tab
+ ******************************************************************************/
+/* include library header file */
+#include "libkes.h"
+
+#include <stdio.h>
+
+int main(int argc, char* argv[])
+{
+    const char* path = ((argc > 1) ? argv[1] : "libkes.tab");
+
+    /* map existing file, or write a new one and map that */
+    kes_err_e err = kes_table_load(path);
+    if ( err == KES_ERR_NOERR )
+    {
+        printf("table file %s is valid\n", path);
+    } // end if
+    else
+    {
+        printf("table file %s is missing or outdated, regenerating\n", path);
+
+        err = kes_table_save(path);
+        if ( err == KES_ERR_NOERR )
+        {
+            err = kes_table_load(path);
+        } // end if
+        if ( err != KES_ERR_NOERR )
+        {
+            kes_show_error( err );
+            return 1;
+        } // end if
+    } // end else
+
+    /* starter values from the shared table */
+    for (int i = 1; i <= 4; i++)
+    {
+        const double ecc = 0.2 * i;
+        const double ma  = 0.5 * i;
+        const double E0  = kes_starter(ecc, ma, KES_STM_ES15, &err);
+
+        printf("e = %.1f, M = %.1f, E0 = %.15f\n", ecc, ma, E0);
+    } // end for
+
+    return 0;
+} // end main
@@ -0,0 +1,44 @@
+#!/usr/bin/env python3
+# =============================================================================
+# PROGRAM : demo.py
+# PURPOSE : an example on how to solve Kepler's Equation for arrays from
+#           Python with the extension module pykes; numpy arrays are passed
+#           without copies, the standard module array serves without numpy
+# AUTHOR  : Bazso Akos
+# VERSION : 1.0, 14 Oct 2026
+# COMPILE : use Makefile, then PYTHONPATH=. python3 demo.py
+# =============================================================================
+import math
+import pykes
+
+NBR = 8
+
+try:
+    import numpy as np
+    ma = np.linspace(0.0, 2.0 * math.pi, NBR)
+    ecc = np.linspace(0.05, 0.95, NBR)
+    nit = np.zeros(NBR, dtype=np.intc)
+except ImportError:
+    from array import array
+    ma = array('d', (2.0 * math.pi * i / (NBR - 1) for i in range(NBR)))
+    ecc = array('d', (0.05 + 0.9 * i / (NBR - 1) for i in range(NBR)))
+    nit = array('i', [0] * NBR)
+
+# scalar eccentricity broadcast against all mean anomalies
+ea = pykes.solve(0.5, ma)
+for m, e in zip(ma, ea):
+    print("e = 0.50, M = %.4f, E = %.15f" % (m, e))
+print()
+
+# one eccentricity per element, chosen methods, iterations written to nit
+ea = pykes.solve(ecc, ma, init=pykes.STM_ES08, iter=pykes.SOL_HALLEY,
+                 iterations=nit)
+for e, m, x, k in zip(ecc, ma, ea, nit):
+    print("e = %.2f, M = %.4f, E = %.15f, iterations = %d" % (e, m, x, k))
+print()
+
+# failing elements raise pykes.error unless a status array is given
+try:
+    pykes.solve(-0.1, ma, out=ea)
+except pykes.error as err:
+    print("pykes.error: %s (code %d)" % (err, err.code))
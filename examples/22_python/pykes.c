@@ -0,0 +1,485 @@
+/*******************************************************************************
+ * PROGRAM : pykes.c
+ * PURPOSE : Python extension module for the batch solver of libkes; arrays
+ *           (e.g. numpy.ndarray of float64) are passed by the buffer protocol
+ *           without copies to kesolver_batch_mt(), a scalar eccentricity is
+ *           broadcast against the mean anomalies and the interpreter lock is
+ *           released while the elements are solved
+ * AUTHOR  : Bazso Akos
+ * VERSION : 1.0, 14 Oct 2026
+ * COMPILE : use Makefile, then e.g. PYTHONPATH=. python3 demo.py
+ ******************************************************************************/
+#define PY_SSIZE_T_CLEAN
+#include <Python.h>
+
+/* include library header file */
+#include "libkes.h"
+
+#include <string.h>
+
+/******************************************************************************/
+
+/* name and value of the constants exported to Python */
+typedef struct {
+    const char* name;
+    long        value;
+} pykes_const_t;
+
+static const pykes_const_t list_of_consts[] = {
+    {"STM_ES00", KES_STM_ES00}, {"STM_ES01", KES_STM_ES01},
+    {"STM_ES02", KES_STM_ES02}, {"STM_ES03", KES_STM_ES03},
+    {"STM_ES04", KES_STM_ES04}, {"STM_ES05", KES_STM_ES05},
+    {"STM_ES06", KES_STM_ES06}, {"STM_ES07", KES_STM_ES07},
+    {"STM_ES08", KES_STM_ES08}, {"STM_ES09", KES_STM_ES09},
+    {"STM_ES10", KES_STM_ES10}, {"STM_ES11", KES_STM_ES11},
+    {"STM_ES12", KES_STM_ES12}, {"STM_ES13", KES_STM_ES13},
+    {"STM_ES14", KES_STM_ES14}, {"STM_ES15", KES_STM_ES15},
+    {"SOL_BISECT",  KES_SOL_BISECT},  {"SOL_DANBUR4", KES_SOL_DANBUR4},
+    {"SOL_DANBUR5", KES_SOL_DANBUR5}, {"SOL_FIXEDP",  KES_SOL_FIXEDP},
+    {"SOL_HALLEY",  KES_SOL_HALLEY},  {"SOL_LAGCON",  KES_SOL_LAGCON},
+    {"SOL_MARKLEY", KES_SOL_MARKLEY}, {"SOL_MIKKOLA", KES_SOL_MIKKOLA},
+    {"SOL_NEWRAP",  KES_SOL_NEWRAP},  {"SOL_NIJENH",  KES_SOL_NIJENH},
+    {"SOL_SECANT",  KES_SOL_SECANT},  {"SOL_WEGSEC",  KES_SOL_WEGSEC},
+    {"SOL_BRENT",   KES_SOL_BRENT},   {"SOL_CORDIC",  KES_SOL_CORDIC},
+    {"SOL_FUKUSH",  KES_SOL_FUKUSH},  {"SOL_EKS",     KES_SOL_EKS},
+    {"SOL_HYBRID",  KES_SOL_HYBRID},
+    {"SOL_AUTO",    KES_SOL_AUTO},
+    {"ERR_NOERR",  KES_ERR_NOERR},  {"ERR_BADECC",  KES_ERR_BADECC},
+    {"ERR_BADVAL", KES_ERR_BADVAL}, {"ERR_BADSTM",  KES_ERR_BADSTM},
+    {"ERR_BADSOL", KES_ERR_BADSOL}, {"ERR_BADTOL",  KES_ERR_BADTOL},
+    {NULL, 0}
+};
+
+/* messages of the exceptions for the error codes of enum kes_err_e */
+static const char* err_text[KES_ERR_TOTAL] = {
+    [KES_ERR_NOERR]   = "no error",
+    [KES_ERR_BADECC]  = "bad value for eccentricity",
+    [KES_ERR_BADVAL]  = "bad value for parameter (INF or NaN)",
+    [KES_ERR_BADSTM]  = "bad starter method",
+    [KES_ERR_BADSOL]  = "bad solver method",
+    [KES_ERR_BADTOL]  = "bad value for error tolerance",
+    [KES_ERR_BADFILE] = "bad or outdated table file",
+    [KES_ERR_NOMEM]   = "out of memory"
+};
+
+/* exception raised for failing elements, attribute "code" = kes_err_e */
+static PyObject* pykes_error = NULL;
+
+/******************************************************************************/
+
+/*******************************************************************************
+ * FUNCTION    : pykes_get_buffer
+ * DESCRIPTION : request a C-contiguous buffer of items with format "fmt"
+ *               ('d' = double, 'i' = int) from object "obj"
+ * INPUT       : object, writable flag, item format, name of argument
+ * OUTPUT      : 0 on success (release "view" afterwards), -1 with exception
+ ******************************************************************************/
+static int pykes_get_buffer(
+    PyObject*   obj,
+    Py_buffer*  view,
+    const int   writable,
+    const char  fmt,
+    const char* name
+    )
+{
+    const int flags = PyBUF_C_CONTIGUOUS | PyBUF_FORMAT |
+                      (writable ? PyBUF_WRITABLE : 0);
+
+    if ( PyObject_GetBuffer(obj, view, flags) != 0 )
+    {
+        return( -1 );
+    } // end if
+
+    /* native or little-endian byte order on a little-endian host */
+    const char* f = ((view->format != NULL) ? view->format : "B");
+    if ( (f[0] == '@') || (f[0] == '=') ||
+         ((f[0] == '<') && (PY_LITTLE_ENDIAN)) )
+    {
+        ++f;
+    } // end if
+
+    const size_t size = ((fmt == 'd') ? sizeof(double) : sizeof(int));
+    if ( (f[0] != fmt) || (f[1] != '\0') || ((size_t)view->itemsize != size) )
+    {
+        PyErr_Format(
+            PyExc_TypeError, "%s: expected buffer of %s, got format '%s'",
+            name, ((fmt == 'd') ? "float64" : "int32"), view->format
+        );
+        PyBuffer_Release(view);
+        return( -1 );
+    } // end if
+
+    return( 0 );
+} // end pykes_get_buffer
+
+/******************************************************************************/
+
+/*******************************************************************************
+ * FUNCTION    : pykes_new_output
+ * DESCRIPTION : create a float64 array with the shape of buffer "like",
+ *               a numpy.ndarray if numpy can be imported, otherwise a
+ *               memoryview on a bytearray
+ * INPUT       : buffer whose shape is copied
+ * OUTPUT      : new reference to array or NULL with exception
+ ******************************************************************************/
+static PyObject* pykes_new_output(const Py_buffer* like)
+{
+    PyObject* shape = PyTuple_New(like->ndim);
+    if ( shape == NULL )
+    {
+        return( NULL );
+    } // end if
+    for (int k = 0; k < like->ndim; k++)
+    {
+        PyTuple_SET_ITEM(shape, k, PyLong_FromSsize_t(like->shape[k]));
+    } // end for
+
+    PyObject* out   = NULL;
+    PyObject* numpy = PyImport_ImportModule("numpy");
+    if ( numpy != NULL )
+    {
+        out = PyObject_CallMethod(numpy, "empty", "(Os)", shape, "float64");
+        Py_DECREF(numpy);
+    }
+    else
+    {
+        PyErr_Clear();
+        PyObject* bytes = PyByteArray_FromStringAndSize(NULL, like->len);
+        if ( bytes != NULL )
+        {
+            PyObject* view = PyMemoryView_FromObject(bytes);
+            if ( view != NULL )
+            {
+                out = PyObject_CallMethod(view, "cast", "(sO)", "d", shape);
+                Py_DECREF(view);
+            } // end if
+            Py_DECREF(bytes);
+        } // end if
+    } // end if
+
+    Py_DECREF(shape);
+
+    return( out );
+} // end pykes_new_output
+
+/******************************************************************************/
+
+/* buffers of one call of solve(), held until the end of the call, i.e. they
+ * cannot be resized by other Python threads while the interpreter lock is
+ * released
+ */
+typedef struct {
+    Py_buffer ma;    ///< mean anomalies
+    Py_buffer ecc;   ///< eccentricities (unused for a scalar)
+    Py_buffer ea;    ///< eccentric anomalies
+    Py_buffer iter;  ///< iterations (optional)
+    Py_buffer stat;  ///< error codes (optional)
+} pykes_buffers_t;
+
+/*******************************************************************************
+ * FUNCTION    : pykes_get_count
+ * DESCRIPTION : request buffer "view" of optional argument "obj" (Py_None =
+ *               not given) with "n" items of format "fmt"
+ * INPUT       : object, item format, number of items, name of argument
+ * OUTPUT      : 0 on success, -1 with exception
+ ******************************************************************************/
+static int pykes_get_count(
+    PyObject*    obj,
+    Py_buffer*   view,
+    const int    writable,
+    const char   fmt,
+    const size_t n,
+    const char*  name
+    )
+{
+    if ( obj == Py_None )
+    {
+        return( 0 );
+    } // end if
+    if ( pykes_get_buffer(obj, view, writable, fmt, name) != 0 )
+    {
+        return( -1 );
+    } // end if
+    if ( (size_t)(view->len / view->itemsize) != n )
+    {
+        PyErr_Format(
+            PyExc_ValueError, "%s: %zd elements, expected %zu",
+            name, view->len / view->itemsize, n
+        );
+        return( -1 );
+    } // end if
+
+    return( 0 );
+} // end pykes_get_count
+
+/******************************************************************************/
+
+/*******************************************************************************
+ * FUNCTION    : pykes_release
+ * DESCRIPTION : release all buffers of one call of solve()
+ * INPUT       : buffers
+ * OUTPUT      : none
+ ******************************************************************************/
+static void pykes_release(pykes_buffers_t* buf)
+{
+    Py_buffer* list[] = { &buf->ma, &buf->ecc, &buf->ea, &buf->iter,
+                          &buf->stat };
+
+    for (size_t k = 0; k < sizeof(list) / sizeof(list[0]); k++)
+    {
+        if ( list[k]->obj != NULL )
+        {
+            PyBuffer_Release(list[k]);
+        } // end if
+    } // end for
+} // end pykes_release
+
+/******************************************************************************/
+
+/*******************************************************************************
+ * FUNCTION    : pykes_raise
+ * DESCRIPTION : raise pykes.error with message and attribute "code"
+ * INPUT       : error code from enum kes_err_e
+ * OUTPUT      : none
+ ******************************************************************************/
+static void pykes_raise(const kes_err_e err)
+{
+    const char* text = (((err > KES_ERR_NOERR) && (err < KES_ERR_TOTAL)) ?
+                        err_text[err] : "unknown error");
+
+    PyObject* exc  = PyObject_CallFunction(pykes_error, "s", text);
+    PyObject* code = PyLong_FromLong((long)err);
+    if ( (exc != NULL) && (code != NULL) )
+    {
+        PyObject_SetAttrString(exc, "code", code);
+        PyErr_SetObject(pykes_error, exc);
+    } // end if
+    Py_XDECREF(code);
+    Py_XDECREF(exc);
+} // end pykes_raise
+
+/******************************************************************************/
+
+/*******************************************************************************
+ * FUNCTION    : pykes_solve
+ * DESCRIPTION : Python function solve(e, M, out=None, init, iter, tolf, tolx,
+ *               maxiter, iterations=None, status=None)
+ * INPUT       : see docstring
+ * OUTPUT      : array of eccentric anomalies ("out" if given)
+ ******************************************************************************/
+static PyObject* pykes_solve(PyObject* self, PyObject* args, PyObject* kwds)
+{
+    static char* kwlist[] = {
+        "e", "M", "out", "init", "iter", "tolf", "tolx", "maxiter",
+        "iterations", "status", NULL
+    };
+
+    PyObject* obj_ecc  = NULL;
+    PyObject* obj_ma   = NULL;
+    PyObject* obj_out  = Py_None;
+    PyObject* obj_iter = Py_None;
+    PyObject* obj_stat = Py_None;
+    int       init     = KES_STM_ES04;
+    int       iter     = KES_SOL_DANBUR5;
+    double    tolf     = 0.0;
+    double    tolx     = 0.0;
+    int       maxiter  = 0;
+
+    (void)self;
+
+    if ( !PyArg_ParseTupleAndKeywords(
+            args, kwds, "OO|O$iiddiOO", kwlist, &obj_ecc, &obj_ma, &obj_out,
+            &init, &iter, &tolf, &tolx, &maxiter, &obj_iter, &obj_stat) )
+    {
+        return( NULL );
+    } // end if
+
+    kes_input_t data = kes_new_input();
+    /* settings not given (zero) keep the defaults of the library */
+    if ( ((tolf != 0.0) && (kes_set_tolf(&data, tolf) != KES_ERR_NOERR)) ||
+         ((tolx != 0.0) && (kes_set_tolx(&data, tolx) != KES_ERR_NOERR)) ||
+         ((maxiter != 0) &&
+          (kes_set_maxiter(&data, maxiter) != KES_ERR_NOERR)) )
+    {
+        PyErr_SetString(PyExc_ValueError, "bad tolf, tolx or maxiter");
+        return( NULL );
+    } // end if
+
+    pykes_buffers_t buf = { {0}, {0}, {0}, {0}, {0} };
+    if ( pykes_get_buffer(obj_ma, &buf.ma, 0, 'd', "M") != 0 )
+    {
+        return( NULL );
+    } // end if
+    const size_t n = (size_t)(buf.ma.len / buf.ma.itemsize);
+
+    /* eccentricity: scalar or one-element buffer broadcast, or one per M */
+    double        e0     = 0.0;
+    const double* ecc    = &e0;
+    size_t        incecc = 0;
+    int           fail   = 0;
+    if ( PyFloat_Check(obj_ecc) || PyLong_Check(obj_ecc) )
+    {
+        e0   = PyFloat_AsDouble(obj_ecc);
+        fail = (PyErr_Occurred() != NULL);
+    }
+    else
+    {
+        fail = pykes_get_buffer(obj_ecc, &buf.ecc, 0, 'd', "e");
+        if ( !fail )
+        {
+            const size_t necc = (size_t)(buf.ecc.len / buf.ecc.itemsize);
+            if ( (necc != 1) && (necc != n) )
+            {
+                PyErr_Format(
+                    PyExc_ValueError, "e: cannot broadcast %zu elements to %zu",
+                    necc, n
+                );
+                fail = 1;
+            } // end if
+            ecc    = (const double*)buf.ecc.buf;
+            incecc = ((necc == 1) ? 0 : 1);
+        } // end if
+    } // end if
+
+    /* output array, allocated with the shape of M if not given */
+    PyObject* out = NULL;
+    if ( !fail )
+    {
+        if ( obj_out == Py_None )
+        {
+            out = pykes_new_output(&buf.ma);
+        }
+        else
+        {
+            out = obj_out;
+            Py_INCREF(out);
+        } // end if
+        fail = ((out == NULL) ||
+                (pykes_get_count(out, &buf.ea, 1, 'd', n, "out") != 0) ||
+                (pykes_get_count(obj_iter, &buf.iter, 1, 'i', n,
+                                 "iterations") != 0) ||
+                (pykes_get_count(obj_stat, &buf.stat, 1, 'i', n,
+                                 "status") != 0));
+    } // end if
+
+    if ( !fail )
+    {
+        kes_err_e err;
+        Py_BEGIN_ALLOW_THREADS
+        err = kesolver_batch_mt(
+            n, ecc, incecc, (const double*)buf.ma.buf, (double*)buf.ea.buf,
+            (kes_stm_e)init, (kes_sol_e)iter, &data,
+            (kes_err_e*)buf.stat.buf, (int*)buf.iter.buf
+        );
+        Py_END_ALLOW_THREADS
+
+        /* failures are reported per element if a status array was given */
+        if ( (err != KES_ERR_NOERR) && (obj_stat == Py_None) )
+        {
+            pykes_raise(err);
+            fail = 1;
+        } // end if
+    } // end if
+
+    pykes_release(&buf);
+    if ( fail )
+    {
+        Py_XDECREF(out);
+        return( NULL );
+    } // end if
+
+    return( out );
+} // end pykes_solve
+
+/******************************************************************************/
+
+/*******************************************************************************
+ * FUNCTION    : pykes_set_threads
+ * DESCRIPTION : Python function set_threads(n), 0 = online processors
+ * INPUT       : number of threads
+ * OUTPUT      : None
+ ******************************************************************************/
+static PyObject* pykes_set_threads(PyObject* self, PyObject* args)
+{
+    int nthreads = 0;
+
+    (void)self;
+
+    if ( !PyArg_ParseTuple(args, "i", &nthreads) )
+    {
+        return( NULL );
+    } // end if
+    if ( kes_set_threads(nthreads) != KES_ERR_NOERR )
+    {
+        PyErr_SetString(PyExc_ValueError, "bad number of threads");
+        return( NULL );
+    } // end if
+
+    Py_RETURN_NONE;
+} // end pykes_set_threads
+
+/******************************************************************************/
+
+PyDoc_STRVAR(pykes_solve_doc,
+"solve(e, M, out=None, *, init=STM_ES04, iter=SOL_DANBUR5, tolf=0,\n"
+"      tolx=0, maxiter=0, iterations=None, status=None)\n"
+"\n"
+"Solve Kepler's equation E - e sin E = M for all elements of M.\n"
+"\n"
+"M, and e if it is not a scalar, are C-contiguous buffers of float64\n"
+"(e.g. numpy arrays), e is broadcast if it has a single element. The\n"
+"eccentric anomalies are written to out, a writable float64 buffer of\n"
+"the size of M, or to a new array. Optional int32 buffers receive the\n"
+"iterations and the error codes (ERR_*) per element; without status a\n"
+"failing element raises pykes.error with attribute code. The arrays are\n"
+"not copied and the solve runs in threads of libkes without the GIL.\n"
+"tolf, tolx and maxiter = 0 keep the defaults of libkes (1e-15, 100).");
+
+PyDoc_STRVAR(pykes_set_threads_doc,
+"set_threads(n)\n"
+"\n"
+"Set the number of threads of the batch solver, 0 = online processors.");
+
+static PyMethodDef pykes_methods[] = {
+    {"solve", (PyCFunction)(void(*)(void))pykes_solve,
+     METH_VARARGS | METH_KEYWORDS, pykes_solve_doc},
+    {"set_threads", pykes_set_threads, METH_VARARGS, pykes_set_threads_doc},
+    {NULL, NULL, 0, NULL}
+};
+
+static struct PyModuleDef pykes_module = {
+    PyModuleDef_HEAD_INIT, "pykes",
+    "Python bindings for the batch solver of libkes", -1, pykes_methods,
+    NULL, NULL, NULL, NULL
+};
+
+/*******************************************************************************
+ * FUNCTION    : PyInit_pykes
+ * DESCRIPTION : create module object with functions and constants
+ * INPUT       : none
+ * OUTPUT      : new module or NULL
+ ******************************************************************************/
+PyMODINIT_FUNC PyInit_pykes(void)
+{
+    PyObject* mod = PyModule_Create(&pykes_module);
+    if ( mod == NULL )
+    {
+        return( NULL );
+    } // end if
+
+    for (const pykes_const_t* c = list_of_consts; c->name != NULL; c++)
+    {
+        PyModule_AddIntConstant(mod, c->name, c->value);
+    } // end for
+
+    pykes_error = PyErr_NewException("pykes.error", PyExc_RuntimeError, NULL);
+    if ( pykes_error == NULL )
+    {
+        Py_DECREF(mod);
+        return( NULL );
+    } // end if
+    Py_INCREF(pykes_error);
+    PyModule_AddObject(mod, "error", pykes_error);
+
+    return( mod );
+} // end PyInit_pykes
@@ -0,0 +1,95 @@
+/*******************************************************************************
+ * PROGRAM : async.c
+ * PURPOSE : an example on how to overlap solving Kepler's Equation with
+ *           input and output by double buffering: while the thread pool
+ *           solves one block with kes_submit(), the next block is read
+ * AUTHOR  : Bazso Akos
+ * VERSION : 1.0, 14 Oct 2026
+ * COMPILE : use Makefile
+ ******************************************************************************/
+/* include library header file */
+#include "libkes.h"
+
+#include <stdio.h>
+
+#define BLOCK  4096
+#define BLOCKS 8
+
+/* two buffers of mean anomalies and solutions */
+static double ma[2][BLOCK];
+static double ea[2][BLOCK];
+
+/* stands for reading the next block from a file */
+static void read_block(double* buf, const int blk)
+{
+    for (int i = 0; i < BLOCK; i++)
+    {
+        buf[i] = 1E-3 * (blk * BLOCK + i);
+    } // end for
+} // end read_block
+
+/* called by a thread of the pool as soon as a block is solved */
+static void solved(const kes_batch_t* batch, const kes_err_e err, void* arg)
+{
+    printf("block %d: %zu elements solved, E[0] = %.15f%s\n",
+           *(const int*)arg, batch->n, batch->ea[0],
+           ((err == KES_ERR_NOERR) ? "" : " (error)"));
+} // end solved
+
+/* wait for a block, keep the first error */
+static void finish(kes_job_t** job, kes_err_e* err)
+{
+    if ( *job != NULL )
+    {
+        const kes_err_e e = kes_wait(*job);
+        if ( *err == KES_ERR_NOERR )
+        {
+            *err = e;
+        } // end if
+        *job = NULL;
+    } // end if
+} // end finish
+
+int main(void)
+{
+    const double ecc = 0.65;
+    int          blk_id[2];
+    kes_job_t*   job[2] = { NULL, NULL };
+    kes_err_e    err    = KES_ERR_NOERR;
+
+    read_block(ma[0], 0);
+    for (int blk = 0; blk < BLOCKS; blk++)
+    {
+        const int cur = blk % 2;
+
+        /* solve current block in the background */
+        const kes_batch_t batch = {
+            .n = BLOCK, .ecc = &ecc, .incecc = 0, .ma = ma[cur],
+            .ea = ea[cur], .init = KES_STM_ES04, .iter = KES_SOL_DANBUR5
+        };
+        blk_id[cur] = blk;
+        job[cur]    = kes_submit(&batch, solved, &blk_id[cur]);
+        if ( job[cur] == NULL )
+        {
+            return 1;
+        } // end if
+
+        /* read next block into the other buffer, which must be free */
+        if ( blk + 1 < BLOCKS )
+        {
+            finish(&job[1 - cur], &err);
+            read_block(ma[1 - cur], blk + 1);
+        } // end if
+    } // end for
+
+    finish(&job[0], &err);
+    finish(&job[1], &err);
+    if ( err != KES_ERR_NOERR )
+    {
+        kes_show_error( err );
+    } // end if
+
+    kes_pool_free();
+
+    return 0;
+} // end main
@@ -0,0 +1,602 @@
+/*******************************************************************************
+ * PROGRAM : regress.c
+ * PURPOSE : accuracy and speed regression check of all solver methods
+ *           against reference solutions; reference values E are chosen on a
+ *           grid in (E,e) including the high-eccentricity corner, the mean
+ *           anomaly M = E - e*sin(E) is evaluated in extended precision and
+ *           the reference is corrected for the rounding of M to double;
+ *           the program fails (exit status 1) if the error of kesolver() or
+ *           kesolver_batch() exceeds a fixed limit in units of tolx, or if
+ *           the time per solve regresses against a baseline file beyond a
+ *           factor; a grid over 0.8 < e <= 0.99 and 0 < M <= pi is solved
+ *           with every pair of starter and solver method and fails if a
+ *           solve runs to maxiter or leaves the bracket M <= E <= M + e;
+ *           a grid over 1 < e <= 1E7 and -20 <= H <= 20 is solved with
+ *           every hyperbolic starter and fails likewise if a solve runs to
+ *           maxiter or misses H
+ * AUTHOR  : Bazso Akos
+ * VERSION : 1.0, 14 Oct 2026
+ * COMPILE : use Makefile
+ * USAGE   : regress [-b file] [-w] [-t factor] [-r reps] [-g nE ne]
+ *           [-i starter]
+ *           -b baseline file (default regress.base), written if missing
+ *           -w write a new baseline instead of checking the times
+ *           -t factor for time per solve (default 1.5)
+ *           -r repetitions of timing runs, the fastest counts (default 5)
+ *           -g size of the regular grid in [0,2pi) x [0,1)
+ *           -i starter method (default KES_STM_ES04)
+ ******************************************************************************/
+/* POSIX clock_gettime() and M_PI */
+#define _XOPEN_SOURCE 700
+
+/* include library header file */
+#include "libkes.h"
+
+#include <math.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+
+/* number of eccentricities 1 - 10^(-k) and of anomalies in (0,1] of the
+ * high-eccentricity corner
+ */
+#define CORNER_ECC 6
+#define CORNER_E   128
+
+/* limit of the error in units of tolx, the error |E_out - E_ref| is scaled
+ * by 1 - e*cos(E_ref), i.e. it is the error of M = E - e*sin(E) and does not
+ * grow with the condition of the problem in the high-eccentricity corner;
+ * solvers stop as soon as their step criterion is met, up to about 60 tolx
+ */
+#define ERR_LIMIT  100.0
+
+/* looser limit of the fixed-point iteration, which converges linearly by a
+ * factor e per step and stops at maxiter for e close to 1, i.e. its limit
+ * only catches failures like NaN or a wrong branch (in radians of M)
+ */
+#define ERR_LOOSE  0.25
+
+/* grid of eccentricities in (0.8,0.99] and of mean anomalies in (0,pi] of
+ * the iteration bound check
+ */
+#define BOUND_ECC  201
+#define BOUND_MA   400
+
+/* grid of eccentricities in (1,1E7] and of hyperbolic anomalies in [-20,20]
+ * of the hyperbolic starter check, limit of the error relative to max(1,|H|)
+ */
+#define HYP_ECC    161
+#define HYP_H      401
+#define HYP_LIMIT  1E-12
+
+/* number of methods checked: all solvers and the automatic selection */
+#define NBR_METHODS KES_SOL_TOTAL
+
+/* names of solver methods, in order of enum kes_sol_e, "auto" takes the
+ * place of KES_SOL_NONE */
+static const char* sol_name[NBR_METHODS] = {
+    "auto", "bisect", "danbur4", "danbur5", "fixedp", "halley", "lagcon",
+    "markley", "mikkola", "newrap", "nijenh", "secant", "wegsec", "brent",
+    "cordic", "fukush", "eks", "hybrid"
+};
+
+/* results of one method */
+typedef struct
+{
+    int    valid;      // result available
+    double err_scalar; // max. error |E_out - E_ref| of kesolver() [radians]
+    double err_batch;  // same for kesolver_batch() [radians]
+    double err_tol;    // max. scaled error of both, see ERR_LIMIT [tolx]
+    double ns_scalar;  // time per solve of kesolver() [ns]
+    double ns_batch;   // time per solve of kesolver_batch() [ns]
+} result_t;
+
+/* wall clock time in nanoseconds */
+static double now_ns(void)
+{
+    struct timespec t;
+    clock_gettime(CLOCK_MONOTONIC, &t);
+    return( 1E9 * (double)t.tv_sec + (double)t.tv_nsec );
+} // end now_ns
+
+/* add one test problem with reference E, the reference is moved to the
+ * exact solution for the mean anomaly rounded to double
+ */
+static void add_problem(
+    const long double E, const double e, size_t* n,
+    double* ecc, double* ma, long double* eref)
+{
+    const long double m  = E - e * sinl(E);
+    const double      md = (double)m;
+
+    ecc[*n]  = e;
+    ma[*n]   = md;
+    eref[*n] = E + ((long double)md - m) / (1.0L - e * cosl(E));
+    ++(*n);
+} // end add_problem
+
+/* regular grid and high-eccentricity corner, returns number of problems */
+static size_t make_problems(
+    const int nE, const int ne, double* ecc, double* ma, long double* eref)
+{
+    const long double pi = 3.141592653589793238462643383279503L;
+    size_t n = 0;
+
+    for (int i = 0; i < nE; i++)
+    {
+        for (int j = 0; j < ne; j++)
+        {
+            add_problem(2.0L * pi * i / nE, (double)j / ne, &n, ecc, ma, eref);
+        } // end for(j)
+    } // end for(i)
+
+    /* corner: E from 1E-6 to 1 on a logarithmic scale;
+     * NOTE no negative M, the solvers reduce it to 2pi - |M| and the rounding
+     *      of 2pi is amplified by up to 1 / (1 - e*cos(E)) ~ 1E6
+     */
+    for (int k = 1; k <= CORNER_ECC; k++)
+    {
+        const double e = 1.0 - pow(10.0, -k);
+
+        for (int i = 0; i < CORNER_E; i++)
+        {
+            const long double E = powl(10.0L, -6.0L + 6.0L * i / (CORNER_E-1));
+            add_problem(E, e, &n, ecc, ma, eref);
+        } // end for(i)
+    } // end for(k)
+
+    return( n );
+} // end make_problems
+
+/* max. error on the circle, E_ref close to 2pi may give E_out ~ 0, and max.
+ * error scaled by 1 - e*cos(E_ref) in "scaled"; NaN results are kept
+ */
+static double max_error(
+    const size_t n, const double* ecc, const double* ea,
+    const long double* eref, double* scaled)
+{
+    const long double pi2 = 6.283185307179586476925286766559006L;
+    double emax = 0.0;
+    double smax = 0.0;
+
+    for (size_t i = 0; i < n; i++)
+    {
+        const long double err = fabsl(remainderl(ea[i] - eref[i], pi2));
+        const long double sca = err * (1.0L - ecc[i] * cosl(eref[i]));
+        emax = (((double)err <= emax) ? emax : (double)err);
+        smax = (((double)sca <= smax) ? smax : (double)sca);
+    } // end for
+
+    *scaled = smax;
+    return( emax );
+} // end max_error
+
+/* check one method, returns 0 if the method is not valid */
+static int run_method(
+    const kes_stm_e init, const kes_sol_e iter, const size_t n, const int reps,
+    const double* ecc, const double* ma, const long double* eref, double* ea,
+    result_t* res)
+{
+    kes_input_t data = kes_new_input();
+    kes_err_e   status;
+
+    /* check method once */
+    kesolver(0.5, 1.0, init, iter, &data, &status);
+    if ( status != KES_ERR_NOERR )
+    {
+        return( 0 );
+    } // end if
+
+    /* accuracy and time of scalar solver, fastest repetition */
+    res->ns_scalar = HUGE_VAL;
+    for (int r = 0; r < reps; r++)
+    {
+        const double t0 = now_ns();
+        for (size_t i = 0; i < n; i++)
+        {
+            ea[i] = kesolver(ecc[i], ma[i], init, iter, &data, &status);
+        } // end for(i)
+        const double t = (now_ns() - t0) / n;
+        res->ns_scalar = ((t < res->ns_scalar) ? t : res->ns_scalar);
+    } // end for(r)
+    double sca_scalar, sca_batch;
+    res->err_scalar = max_error(n, ecc, ea, eref, &sca_scalar);
+
+    /* accuracy and time of batch solver */
+    res->ns_batch = HUGE_VAL;
+    for (int r = 0; r < reps; r++)
+    {
+        const double t0 = now_ns();
+        kesolver_batch(n, ecc, 1, ma, ea, init, iter, &data, NULL, NULL);
+        const double t = (now_ns() - t0) / n;
+        res->ns_batch = ((t < res->ns_batch) ? t : res->ns_batch);
+    } // end for(r)
+    res->err_batch = max_error(n, ecc, ea, eref, &sca_batch);
+    res->err_tol   = ((sca_batch <= sca_scalar) ? sca_scalar : sca_batch) /
+                     data.tolx;
+
+    res->valid = 1;
+
+    return( 1 );
+} // end run_method
+
+/* iteration bound of one pair of methods on the grid of BOUND_ECC x BOUND_MA
+ * problems: number of solves of kesolver() and kesolver_batch() that run to
+ * maxiter or leave the bracket M <= E <= M + e, -1 if the pair is not valid
+ */
+static long run_bound(
+    const kes_stm_e init, const kes_sol_e iter, const size_t n,
+    const double* ecc, const double* ma, double* ea, int* count)
+{
+    kes_input_t data = kes_new_input();
+    kes_err_e   status;
+    long        fails = 0;
+
+    kesolver(0.5, 1.0, init, iter, &data, &status);
+    if ( status != KES_ERR_NOERR )
+    {
+        return( -1 );
+    } // end if
+
+    /* NOTE the slack covers rounding of E close to M or M + e */
+    for (size_t i = 0; i < n; i++)
+    {
+        const double e = kesolver(ecc[i], ma[i], init, iter, &data, &status);
+        fails += ((data.iterations >= data.maxiter) ||
+                  !((e >= ma[i] - 1E-12) && (e <= ma[i] + ecc[i] + 1E-12)));
+    } // end for
+
+    kesolver_batch(n, ecc, 1, ma, ea, init, iter, &data, NULL, count);
+    for (size_t i = 0; i < n; i++)
+    {
+        fails += ((count[i] >= data.maxiter) ||
+                  !((ea[i] >= ma[i] - 1E-12) &&
+                    (ea[i] <= ma[i] + ecc[i] + 1E-12)));
+    } // end for
+
+    return( fails );
+} // end run_bound
+
+/* hyperbolic starter check of one pair of methods on the grid of HYP_ECC x
+ * HYP_H problems: number of solves of kesolver() and kesolver_batch() that
+ * run to maxiter or miss the hyperbolic anomaly "h" of the problem
+ */
+static long run_hyp(
+    const kes_hstm_e hinit, const kes_sol_e iter, const size_t n,
+    const double* ecc, const double* ma, const double* h, double* ea,
+    int* count)
+{
+    kes_input_t data = kes_new_input();
+    kes_err_e   status;
+    long        fails = 0;
+
+    kes_set_hstarter(&data, hinit);
+    for (size_t i = 0; i < n; i++)
+    {
+        const double e = kesolver(ecc[i], ma[i], KES_STM_ES04, iter, &data,
+                                  &status);
+        fails += ((status != KES_ERR_NOERR) ||
+                  (data.iterations >= data.maxiter) ||
+                  !(fabs(e - h[i]) <= HYP_LIMIT * fmax(1.0, fabs(h[i]))));
+    } // end for
+
+    kesolver_batch(n, ecc, 1, ma, ea, KES_STM_ES04, iter, &data, NULL, count);
+    for (size_t i = 0; i < n; i++)
+    {
+        fails += ((count[i] >= data.maxiter) ||
+                  !(fabs(ea[i] - h[i]) <= HYP_LIMIT * fmax(1.0, fabs(h[i]))));
+    } // end for
+
+    return( fails );
+} // end run_hyp
+
+/* read baseline file, returns 0 if it cannot be read */
+static int read_baseline(const char* path, const int init, result_t* base)
+{
+    FILE* fp = fopen(path, "r");
+    if ( fp == NULL )
+    {
+        return( 0 );
+    } // end if
+
+    char line[256];
+    int  stm = -1;
+    while ( fgets(line, sizeof(line), fp) != NULL )
+    {
+        char     name[32];
+        result_t r = { .valid = 1 };
+
+        if ( sscanf(line, "# starter %d", &stm) == 1 )
+        {
+            continue;
+        } // end if
+        if ( (line[0] == '#') ||
+             (sscanf(line, "%31s %lf %lf %lf %lf", name, &r.err_scalar,
+                     &r.err_batch, &r.ns_scalar, &r.ns_batch) != 5) )
+        {
+            continue;
+        } // end if
+        for (int k = 0; k < NBR_METHODS; k++)
+        {
+            if ( !strcmp(name, sol_name[k]) )
+            {
+                base[k] = r;
+            } // end if
+        } // end for
+    } // end while
+    fclose(fp);
+
+    /* NOTE a baseline of another starter method cannot be compared */
+    return( stm == init );
+} // end read_baseline
+
+/* write baseline file, returns 0 on failure */
+static int write_baseline(
+    const char* path, const int init, const size_t n, const result_t* res)
+{
+    FILE* fp = fopen(path, "w");
+    if ( fp == NULL )
+    {
+        return( 0 );
+    } // end if
+
+    fprintf(fp, "# baseline of regress, %zu problems\n", n);
+    fprintf(fp, "# starter %d\n", init);
+    fprintf(fp, "# solver err_scalar err_batch ns_scalar ns_batch\n");
+    for (int k = 0; k < NBR_METHODS; k++)
+    {
+        if ( res[k].valid )
+        {
+            fprintf(fp, "%-8s %.3e %.3e %.1f %.1f\n", sol_name[k],
+                    res[k].err_scalar, res[k].err_batch, res[k].ns_scalar,
+                    res[k].ns_batch);
+        } // end if
+    } // end for
+
+    return( fclose(fp) == 0 );
+} // end write_baseline
+
+int main(int argc, char* argv[])
+{
+    const char* path   = "regress.base";
+    int         write  = 0;
+    double      tfac   = 1.5;
+    int         reps   = 5;
+    int         nE     = 256;
+    int         ne     = 64;
+    int         init   = KES_STM_ES04;
+
+    for (int a = 1; a < argc; a++)
+    {
+        if ( !strcmp(argv[a], "-b") && (a + 1 < argc) )
+        {
+            path = argv[++a];
+        }
+        else if ( !strcmp(argv[a], "-w") )
+        {
+            write = 1;
+        }
+        else if ( !strcmp(argv[a], "-t") && (a + 1 < argc) )
+        {
+            tfac = atof(argv[++a]);
+        }
+        else if ( !strcmp(argv[a], "-r") && (a + 1 < argc) )
+        {
+            reps = atoi(argv[++a]);
+        }
+        else if ( !strcmp(argv[a], "-g") && (a + 2 < argc) )
+        {
+            nE = atoi(argv[++a]);
+            ne = atoi(argv[++a]);
+        }
+        else if ( !strcmp(argv[a], "-i") && (a + 1 < argc) )
+        {
+            init = atoi(argv[++a]);
+        }
+        else
+        {
+            fprintf(stderr, "usage: %s [-b file] [-w] [-t factor] "
+                    "[-r reps] [-g nE ne] [-i starter]\n", argv[0]);
+            return 2;
+        } // end if
+    } // end for
+    if ( (nE < 1) || (ne < 1) || (reps < 1) || (tfac < 1.0) ||
+         (init <= KES_STM_NONE) || (init >= KES_STM_TOTAL) )
+    {
+        fprintf(stderr, "%s: invalid parameters\n", argv[0]);
+        return 2;
+    } // end if
+
+    /* test problems */
+    const size_t nmax = (size_t)nE * ne + CORNER_ECC * CORNER_E;
+    double*      ecc  = malloc(nmax * sizeof(double));
+    double*      ma   = malloc(nmax * sizeof(double));
+    double*      ea   = malloc(nmax * sizeof(double));
+    long double* eref = malloc(nmax * sizeof(long double));
+    if ( (ecc == NULL) || (ma == NULL) || (ea == NULL) || (eref == NULL) )
+    {
+        fprintf(stderr, "%s: out of memory\n", argv[0]);
+        return 2;
+    } // end if
+    const size_t n = make_problems(nE, ne, ecc, ma, eref);
+
+    /* baseline, written if missing */
+    result_t base[NBR_METHODS] = { { 0 } };
+    if ( !write && !read_baseline(path, init, base) )
+    {
+        printf("no baseline for starter %d in %s, writing it\n", init, path);
+        write = 1;
+    } // end if
+
+    /* run all methods, index 0 is the automatic selection */
+    result_t res[NBR_METHODS] = { { 0 } };
+    int      fails = 0;
+    printf("# %zu problems, starter %d\n", n, init);
+    printf("# solver  err_scalar err_batch  err/tolx  ns_scalar ns_batch  "
+           "check\n");
+    for (int k = 0; k < NBR_METHODS; k++)
+    {
+        const kes_sol_e iter = ((k == 0) ? KES_SOL_AUTO : (kes_sol_e)k);
+        if ( !run_method((kes_stm_e)init, iter, n, reps, ecc, ma, eref, ea,
+                         &res[k]) )
+        {
+            continue;
+        } // end if
+
+        /* fixed limit of the error, with or without baseline */
+        const double limit = ((iter == KES_SOL_FIXEDP) ?
+                              ERR_LOOSE / KES_STD_TOL : ERR_LIMIT);
+        const int    err   = !(res[k].err_tol <= limit);
+
+        /* time per solve against the baseline of this machine */
+        int slow = 0;
+        if ( !write && base[k].valid )
+        {
+            slow = ((res[k].ns_scalar > tfac * base[k].ns_scalar) ||
+                    (res[k].ns_batch  > tfac * base[k].ns_batch));
+        } // end if
+
+        const char* check = (err ? (slow ? "FAIL(err,time)" : "FAIL(err)") :
+                             (slow ? "FAIL(time)" :
+                              ((!write && !base[k].valid) ? "new" :
+                               ((limit > ERR_LIMIT) ? "ok(loose)" : "ok"))));
+        fails += (err || slow);
+
+        printf("%-8s  %.3e  %.3e  %8.3g  %9.1f %8.1f  %s\n", sol_name[k],
+               res[k].err_scalar, res[k].err_batch, res[k].err_tol,
+               res[k].ns_scalar, res[k].ns_batch, check);
+    } // end for
+
+    /* iteration bound of all pairs of methods in the corner, NOTE the
+     * fixed-point iteration converges linearly and runs to maxiter there
+     */
+    const size_t nb    = (size_t)BOUND_ECC * BOUND_MA;
+    double*      becc  = malloc(nb * sizeof(double));
+    double*      bma   = malloc(nb * sizeof(double));
+    double*      bea   = malloc(nb * sizeof(double));
+    int*         count = malloc(nb * sizeof(int));
+    if ( (becc == NULL) || (bma == NULL) || (bea == NULL) || (count == NULL) )
+    {
+        fprintf(stderr, "%s: out of memory\n", argv[0]);
+        return 2;
+    } // end if
+    for (int i = 0; i < BOUND_ECC; i++)
+    {
+        for (int j = 0; j < BOUND_MA; j++)
+        {
+            becc[i * BOUND_MA + j] = 0.8 + 0.19 * (i + 1) / BOUND_ECC;
+            bma[i * BOUND_MA + j]  = M_PI * (j + 1) / BOUND_MA;
+        } // end for(j)
+    } // end for(i)
+
+    printf("# iteration bound, %zu problems, 0.8 < e <= 0.99, 0 < M <= pi\n",
+           nb);
+    printf("# solver  starters  maxiter/bracket  check\n");
+    for (int k = 0; k < NBR_METHODS; k++)
+    {
+        const kes_sol_e iter = ((k == 0) ? KES_SOL_AUTO : (kes_sol_e)k);
+        if ( !res[k].valid || (iter == KES_SOL_FIXEDP) )
+        {
+            continue;
+        } // end if
+
+        long nfail = 0;
+        int  nstm  = 0;
+        for (int s = KES_STM_NONE + 1; s < KES_STM_TOTAL; s++)
+        {
+            const long f = run_bound((kes_stm_e)s, iter, nb, becc, bma, bea,
+                                     count);
+            if ( f >= 0 )
+            {
+                nfail += f;
+                nstm++;
+            } // end if
+        } // end for(s)
+
+        fails += (nfail > 0);
+        printf("%-8s  %8d  %15ld  %s\n", sol_name[k], nstm, nfail,
+               ((nfail > 0) ? "FAIL(bound)" : "ok"));
+    } // end for
+
+    free(becc);
+    free(bma);
+    free(bea);
+    free(count);
+
+    /* all hyperbolic starters with the iterations of order 2 to 5, NOTE the
+     * other solvers fall back to Halley's method in the hyperbolic case
+     */
+    static const kes_sol_e hyp_sol[4] = {
+        KES_SOL_NEWRAP, KES_SOL_HALLEY, KES_SOL_DANBUR4, KES_SOL_DANBUR5
+    };
+    const size_t nh    = (size_t)HYP_ECC * HYP_H;
+    double*      hecc  = malloc(nh * sizeof(double));
+    double*      hma   = malloc(nh * sizeof(double));
+    double*      hh    = malloc(nh * sizeof(double));
+    double*      hea   = malloc(nh * sizeof(double));
+    int*         hcnt  = malloc(nh * sizeof(int));
+    if ( (hecc == NULL) || (hma == NULL) || (hh == NULL) || (hea == NULL) ||
+         (hcnt == NULL) )
+    {
+        fprintf(stderr, "%s: out of memory\n", argv[0]);
+        return 2;
+    } // end if
+    for (int i = 0; i < HYP_ECC; i++)
+    {
+        /* e - 1 logarithmically from about 1E-9 to 1E7 - 1 */
+        const double e = 1.0 + (1E7 - 1.0) *
+                         pow(10.0, 16.0 * (i - (HYP_ECC - 1)) / (HYP_ECC - 1));
+        for (int j = 0; j < HYP_H; j++)
+        {
+            const double h = 40.0 * j / (HYP_H - 1) - 20.0;
+            hecc[i * HYP_H + j] = e;
+            hh[i * HYP_H + j]   = h;
+            hma[i * HYP_H + j]  = e * sinh(h) - h;
+        } // end for(j)
+    } // end for(i)
+
+    printf("# hyperbolic starters, %zu problems, 1 < e <= 1E7, "
+           "-20 <= H <= 20\n", nh);
+    printf("# starter  solver   maxiter/error  check\n");
+    for (int s = KES_HSTM_BOUND; s < KES_HSTM_TOTAL; s++)
+    {
+        for (int k = 0; k < 4; k++)
+        {
+            const long f = run_hyp((kes_hstm_e)s, hyp_sol[k], nh, hecc, hma,
+                                   hh, hea, hcnt);
+            fails += (f > 0);
+            printf("%9d  %-8s  %13ld  %s\n", s, sol_name[hyp_sol[k]], f,
+                   ((f > 0) ? "FAIL(hyp)" : "ok"));
+        } // end for(k)
+    } // end for(s)
+
+    free(hecc);
+    free(hma);
+    free(hh);
+    free(hea);
+    free(hcnt);
+
+    if ( write && !write_baseline(path, init, n, res) )
+    {
+        fprintf(stderr, "%s: cannot write %s\n", argv[0], path);
+        fails = 1;
+    } // end if
+    else if ( write )
+    {
+        printf("baseline written to %s\n", path);
+    } // end if
+
+    free(ecc);
+    free(ma);
+    free(ea);
+    free(eref);
+
+    if ( fails > 0 )
+    {
+        printf("%d method(s) regressed\n", fails);
+        return 1;
+    } // end if
+
+    return 0;
+} // end main
@@ -0,0 +1,55 @@
+/*******************************************************************************
+ * PROGRAM : fixpt.c
+ * PURPOSE : an example on how to solve Kepler's Equation in fixed point with
+ *           kesolver_fix(), as on processors without floating-point unit,
+ *           compared on the host with kesolver() in double precision
+ * AUTHOR  : Bazso Akos
+ * VERSION : 1.0, 14 Oct 2026
+ * COMPILE : use Makefile
+ ******************************************************************************/
+/* include library header file */
+#include "libkes.h"
+
+#include <math.h>
+#include <stdio.h>
+
+#define NMA 10000
+
+int main(void)
+{
+    const double eccs[] = { 0.0, 0.1, 0.5, 0.9, 0.99, 0.999, 0.9999, 0.99999 };
+    const int    necc   = sizeof(eccs) / sizeof(eccs[0]);
+    const double twopi  = 6.283185307179586;
+
+    kes_input_t data = kes_new_input();
+
+    printf("%10s %14s %14s\n", "ecc", "max |dE|", "max |f(E)|");
+    for (int k = 0; k < necc; k++)
+    {
+        const kes_q30_t ecc = KES_Q30_FROM(eccs[k]);
+        const double    e   = (double)ecc / KES_Q30_ONE;
+        double          maxerr = 0.0, maxres = 0.0;
+
+        for (int i = 0; i < NMA; i++)
+        {
+            /* mean anomaly as binary angle, and exactly the same in radians */
+            const kes_bam_t mb = KES_BAM_FROM(twopi * i / NMA);
+            const double    ma = KES_BAM_TO(mb);
+
+            kes_err_e       err;
+            const kes_bam_t eb = kesolver_fix(ecc, mb, &err);
+            const double    ea = kesolver(e, ma, KES_STM_ES13, KES_SOL_DANBUR5,
+                                              &data, &err);
+
+            /* error and residual in radians, modulo one turn */
+            const double ef  = KES_BAM_TO(eb);
+            const double de  = fabs(remainder(ef - ea, twopi));
+            const double res = fabs(remainder(ef - e * sin(ef) - ma, twopi));
+            if (de > maxerr) maxerr = de;
+            if (res > maxres) maxres = res;
+        } // end for
+        printf("%10g %14.3e %14.3e\n", eccs[k], maxerr, maxres);
+    } // end for
+
+    return 0;
+} // end main
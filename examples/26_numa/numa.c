@@ -0,0 +1,75 @@
+/*******************************************************************************
+ * PROGRAM : numa.c
+ * PURPOSE : an example on how to solve a large resident batch on a machine
+ *           with several memory nodes: the arrays are spread over the nodes
+ *           by kes_numa_alloc(), and kesolver_batch_mt() solves each part
+ *           on the processors of its node; the time is compared with the
+ *           NUMA-aware scheduling disabled by kes_set_numa()
+ * AUTHOR  : Bazso Akos
+ * VERSION : 1.0, 14 Oct 2026
+ * COMPILE : use Makefile
+ * USAGE   : numa [n], default n = 10^7 elements
+ ******************************************************************************/
+/* POSIX clock_gettime() */
+#define _XOPEN_SOURCE 700
+
+/* include library header file */
+#include "libkes.h"
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <time.h>
+
+/* wall clock time in seconds */
+static double now_s(void)
+{
+    struct timespec t;
+    clock_gettime(CLOCK_MONOTONIC, &t);
+    return( (double)t.tv_sec + 1E-9 * (double)t.tv_nsec );
+} // end now_s
+
+int main(int argc, char* argv[])
+{
+    const size_t n = ((argc > 1) ? (size_t)atol(argv[1]) : 10000000);
+
+    /* first touch of the pages on all nodes, before any other access */
+    double* ecc = kes_numa_alloc(n * sizeof(double));
+    double* ma  = kes_numa_alloc(n * sizeof(double));
+    double* ea  = kes_numa_alloc(n * sizeof(double));
+    if ( !ecc || !ma || !ea )
+    {
+        fprintf(stderr, "numa: out of memory\n");
+        return 1;
+    } // end if
+
+    for (size_t i = 0; i < n; i++)
+    {
+        ecc[i] = 0.9 * (double)(i % 1000) / 1000.0;
+        ma[i]  = 6.283185307179586 * (double)(i % 997) / 997.0;
+    } // end for
+
+    printf("%d thread(s), %d memory node(s)\n",
+           kes_get_threads(), kes_get_numa_nodes());
+
+    for (int enable = 1; enable >= 0; enable--)
+    {
+        kes_set_numa(enable);
+
+        /* first call starts the pool, second one is timed */
+        kesolver_batch_mt(n, ecc, 1, ma, ea, KES_STM_ES04, KES_SOL_MARKLEY,
+                          NULL, NULL, NULL);
+        const double t0 = now_s();
+        kesolver_batch_mt(n, ecc, 1, ma, ea, KES_STM_ES04, KES_SOL_MARKLEY,
+                          NULL, NULL, NULL);
+        const double t = now_s() - t0;
+
+        printf("NUMA-aware scheduling %s: %.3f s, %.2f ns per element\n",
+               (enable ? "on " : "off"), t, 1E9 * t / (double)n);
+    } // end for
+
+    kes_numa_free(ecc);
+    kes_numa_free(ma);
+    kes_numa_free(ea);
+
+    return 0;
+} // end main
@@ -0,0 +1,123 @@
+/*******************************************************************************
+ * PROGRAM : arena.c
+ * PURPOSE : an example on how to keep the library off the heap: the tables
+ *           of several solver plans are built one after the other in a
+ *           single arena, and batches are submitted to the thread pool
+ *           with a caller-provided workspace; a counting allocator set by
+ *           kes_set_allocator() shows that solving allocates nothing
+ * AUTHOR  : Bazso Akos
+ * VERSION : 1.0, 14 Oct 2026
+ * COMPILE : use Makefile
+ * USAGE   : arena
+ ******************************************************************************/
+/* include library header file */
+#include "libkes.h"
+
+#include <stdio.h>
+#include <stdlib.h>
+
+/* number of orbits and of epochs per orbit */
+#define NORB 4
+#define NEPO 4096
+
+/* counters of the allocator below */
+static size_t nalloc = 0;
+static size_t nbytes = 0;
+
+/* allocator that counts the calls before passing them to malloc() */
+static void* count_alloc(void* ctx, size_t size)
+{
+    (void)ctx;
+    ++nalloc;
+    nbytes += size;
+    return( malloc(size) );
+} // end count_alloc
+
+static void count_release(void* ctx, void* ptr, size_t size)
+{
+    (void)ctx;
+    (void)size;
+    free(ptr);
+} // end count_release
+
+int main(void)
+{
+    const double ecc[NORB] = { 0.0167, 0.2056, 0.6, 0.967 };
+    kes_plan_t   plan[NORB];
+    kes_err_e    err;
+
+    /* workspace sizes of all tables, one arena holds them back to back */
+    size_t total = 0;
+    for (int k = 0; k < NORB; k++)
+    {
+        kes_plan_init(&plan[k], ecc[k], KES_STM_ES04, KES_SOL_NEWRAP, NULL);
+        const size_t size = kes_plan_table_size(&plan[k], 0.0, &err);
+        total += (size + KES_ARENA_ALIGN - 1) / KES_ARENA_ALIGN *
+                 KES_ARENA_ALIGN;
+    } // end for
+
+    void*       buf = malloc(total + KES_ARENA_ALIGN);
+    kes_arena_t arena;
+    if ( (buf == NULL) ||
+         (kes_arena_init(&arena, buf, total + KES_ARENA_ALIGN) !=
+          KES_ERR_NOERR) )
+    {
+        fprintf(stderr, "arena: out of memory\n");
+        return 1;
+    } // end if
+
+    for (int k = 0; k < NORB; k++)
+    {
+        const size_t size = kes_plan_table_size(&plan[k], 0.0, &err);
+        err = kes_plan_table_init_ws(&plan[k], 0.0,
+                                     kes_arena_alloc(&arena, size), size);
+        printf("e = %6.4f: table of %5zu bytes, %s\n", ecc[k], size,
+               ((err == KES_ERR_NOERR) ? "ok" : "failed"));
+    } // end for
+    printf("arena: %zu of %zu bytes used\n", kes_arena_used(&arena), total);
+
+    /* from here on every allocation of the library is counted */
+    const kes_alloc_t counter = { count_alloc, NULL, count_release, NULL };
+    kes_set_allocator(&counter);
+
+    static double ma[NEPO], ea[NORB][NEPO];
+    for (int i = 0; i < NEPO; i++)
+    {
+        ma[i] = 6.283185307179586 * (double)i / NEPO;
+    } // end for
+    for (int k = 0; k < NORB; k++)
+    {
+        kes_plan_solve_batch(&plan[k], ma, ea[k], NEPO);
+    } // end for
+    printf("solving with the tables: %zu allocations\n", nalloc);
+
+    /* asynchronous batch in a workspace, pool threads are started once */
+    const kes_batch_t batch = {
+        .n = NEPO, .ecc = &ecc[3], .incecc = 0, .ma = ma, .ea = ea[3],
+        .init = KES_STM_ES04, .iter = KES_SOL_NEWRAP, .data = NULL,
+        .status = NULL, .iterations = NULL
+    };
+    const size_t wsize = kes_submit_size(&batch);
+    double*      ws    = malloc(wsize);
+    for (int r = 0; r < 3; r++)
+    {
+        const size_t before = nalloc;
+        err = kes_wait(kes_submit_ws(&batch, NULL, NULL, ws, wsize));
+        printf("kes_submit_ws() #%d (%zu bytes of workspace): %zu "
+               "allocations, error %d\n", r + 1, wsize, nalloc - before, err);
+    } // end for
+
+    /* tables in the arena are detached, the arena is released at once */
+    for (int k = 0; k < NORB; k++)
+    {
+        kes_plan_table_free(&plan[k]);
+    } // end for
+    kes_pool_free();
+    kes_set_allocator(NULL);
+    printf("total: %zu allocations of %zu bytes\n", nalloc, nbytes);
+
+    free(ws);
+    free(buf);
+
+    return 0;
+} // end main
@@ -0,0 +1,106 @@
+/*******************************************************************************
+ * PROGRAM : strided.c
+ * PURPOSE : an example on how to solve the Kepler Equation for a catalog of
+ *           orbit element structures in place: kesolver_batch_strided()
+ *           reads e and M and writes E through byte strides, compared with
+ *           copying the members to separate arrays for kesolver_batch()
+ * AUTHOR  : Bazso Akos
+ * VERSION : 1.0, 14 Oct 2026
+ * COMPILE : use Makefile
+ * USAGE   : strided [n], default n = 10^6 orbits
+ ******************************************************************************/
+/* POSIX clock_gettime() */
+#define _XOPEN_SOURCE 700
+
+/* include library header file */
+#include "libkes.h"
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <time.h>
+
+/* orbit elements of one object of the catalog */
+typedef struct
+{
+    double a;     // semi-major axis
+    double e;     // eccentricity
+    double inc;   // inclination
+    double node;  // longitude of ascending node
+    double peri;  // argument of pericenter
+    double ma;    // mean anomaly at epoch
+    double n;     // mean motion
+    double ea;    // eccentric anomaly at epoch, solved below
+} orbit_t;
+
+/* wall clock time in seconds */
+static double now_s(void)
+{
+    struct timespec t;
+    clock_gettime(CLOCK_MONOTONIC, &t);
+    return( (double)t.tv_sec + 1E-9 * (double)t.tv_nsec );
+} // end now_s
+
+int main(int argc, char* argv[])
+{
+    const size_t n = ((argc > 1) ? (size_t)atol(argv[1]) : 1000000);
+
+    orbit_t* cat = malloc(n * sizeof(orbit_t));
+    double*  ecc = malloc(n * sizeof(double));
+    double*  ma  = malloc(n * sizeof(double));
+    double*  ea  = malloc(n * sizeof(double));
+    if ( !cat || !ecc || !ma || !ea )
+    {
+        fprintf(stderr, "strided: out of memory\n");
+        return 1;
+    } // end if
+
+    for (size_t i = 0; i < n; i++)
+    {
+        cat[i].a  = 1.0 + (double)(i % 50);
+        cat[i].e  = 0.95 * (double)(i % 1000) / 1000.0;
+        cat[i].ma = 6.283185307179586 * (double)(i % 997) / 997.0;
+        cat[i].ea = 0.0;
+        ecc[i]    = ma[i] = ea[i] = 0.0; // NOTE first touch before timing
+    } // end for
+
+    /* copy members out, solve, copy solutions back */
+    const double t0 = now_s();
+    for (size_t i = 0; i < n; i++)
+    {
+        ecc[i] = cat[i].e;
+        ma[i]  = cat[i].ma;
+    } // end for
+    kesolver_batch(n, ecc, 1, ma, ea, KES_STM_ES04, KES_SOL_MARKLEY,
+                   NULL, NULL, NULL);
+    for (size_t i = 0; i < n; i++)
+    {
+        cat[i].ea = ea[i];
+    } // end for
+    const double t1 = now_s();
+
+    /* solve the catalog in place */
+    kesolver_batch_strided(n, &cat[0].e, sizeof(orbit_t),
+                           &cat[0].ma, sizeof(orbit_t),
+                           &cat[0].ea, sizeof(orbit_t),
+                           KES_STM_ES04, KES_SOL_MARKLEY, NULL, NULL, NULL);
+    const double t2 = now_s();
+
+    size_t diff = 0;
+    for (size_t i = 0; i < n; i++)
+    {
+        diff += (cat[i].ea != ea[i]);
+    } // end for
+
+    printf("copy and kesolver_batch(): %.2f ns per orbit\n",
+           1E9 * (t1 - t0) / (double)n);
+    printf("kesolver_batch_strided():  %.2f ns per orbit\n",
+           1E9 * (t2 - t1) / (double)n);
+    printf("%zu of %zu solutions differ\n", diff, n);
+
+    free(cat);
+    free(ecc);
+    free(ma);
+    free(ea);
+
+    return 0;
+} // end main
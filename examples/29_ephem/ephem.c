@@ -0,0 +1,106 @@
+/*******************************************************************************
+ * PROGRAM : ephem.c
+ * PURPOSE : an example on how to compute the eccentric anomalies of many
+ *           orbits on a common time grid: kes_ephem_run() fills the K x T
+ *           matrix tile by tile with solver plans and warm starts, compared
+ *           with calling kesolver() for every orbit and epoch
+ * AUTHOR  : Bazso Akos
+ * VERSION : 1.0, 14 Oct 2026
+ * COMPILE : use Makefile
+ * USAGE   : ephem [K] [T], default K = 1000 orbits, T = 1440 epochs
+ ******************************************************************************/
+/* POSIX clock_gettime() */
+#define _XOPEN_SOURCE 700
+
+/* include library header file */
+#include "libkes.h"
+
+#include <math.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <time.h>
+
+/* wall clock time in seconds */
+static double now_s(void)
+{
+    struct timespec t;
+    clock_gettime(CLOCK_MONOTONIC, &t);
+    return( (double)t.tv_sec + 1E-9 * (double)t.tv_nsec );
+} // end now_s
+
+int main(int argc, char* argv[])
+{
+    const size_t norb  = ((argc > 1) ? (size_t)atol(argv[1]) : 1000);
+    const size_t ntime = ((argc > 2) ? (size_t)atol(argv[2]) : 1440);
+
+    double* ecc  = malloc(norb * sizeof(double));
+    double* ma0  = malloc(norb * sizeof(double));
+    double* nmot = malloc(norb * sizeof(double));
+    double* t    = malloc(ntime * sizeof(double));
+    double* ea   = calloc(norb * ntime, sizeof(double));
+    double* ref  = calloc(norb * ntime, sizeof(double));
+    if ( !ecc || !ma0 || !nmot || !t || !ea || !ref )
+    {
+        fprintf(stderr, "ephem: out of memory\n");
+        return 1;
+    } // end if
+
+    /* constellation of orbits with periods of 90 minutes to 1 day */
+    for (size_t k = 0; k < norb; k++)
+    {
+        ecc[k]  = 0.9 * (double)(k % 100) / 100.0;
+        ma0[k]  = 6.283185307179586 * (double)(k % 997) / 997.0;
+        nmot[k] = 6.283185307179586 / (90.0 + (double)(k % 1351));
+    } // end for
+
+    /* one epoch per minute */
+    for (size_t j = 0; j < ntime; j++)
+    {
+        t[j] = (double)j;
+    } // end for
+
+    kes_input_t data = kes_new_input();
+
+    /* every orbit and epoch on its own */
+    const double t0 = now_s();
+    for (size_t k = 0; k < norb; k++)
+    {
+        for (size_t j = 0; j < ntime; j++)
+        {
+            kes_err_e err;
+            ref[k * ntime + j] = kesolver(ecc[k], ma0[k] + nmot[k] * t[j],
+                                          KES_STM_ES04, KES_SOL_NEWRAP,
+                                          &data, &err);
+        } // end for
+    } // end for
+    const double t1 = now_s();
+
+    /* whole matrix at once */
+    const kes_err_e err = kes_ephem_run(norb, ecc, ma0, nmot, ntime, t,
+                                        ea, ntime, KES_STM_ES04,
+                                        KES_SOL_NEWRAP, &data, NULL);
+    const double t2 = now_s();
+
+    double diff = 0.0;
+    for (size_t i = 0; i < norb * ntime; i++)
+    {
+        diff = fmax(diff, fabs(ea[i] - ref[i]));
+    } // end for
+
+    printf("kesolver():      %.2f ns per element\n",
+           1E9 * (t1 - t0) / (double)(norb * ntime));
+    printf("kes_ephem_run(): %.2f ns per element (error code %d)\n",
+           1E9 * (t2 - t1) / (double)(norb * ntime), (int)err);
+    printf("max. difference: %.3E\n", diff);
+
+    kes_pool_free();
+
+    free(ecc);
+    free(ma0);
+    free(nmot);
+    free(t);
+    free(ea);
+    free(ref);
+
+    return 0;
+} // end main
@@ -0,0 +1,457 @@
+/***************************************************************************//**
+ * @file    alloc.c
+ * @brief   pluggable memory allocator and arena of the library
+ * @details every allocation of the library goes through one allocator,
+ *          malloc() and free() by default; the arena hands out blocks of a
+ *          caller-provided buffer by advancing an atomic offset, i.e. the
+ *          tables, pools and caches made from one arena are contiguous
+ *          and need no heap at all
+ * @author  Bazso Akos
+ * @version 2026.10
+ *
+ * @copyright
+ * Copyright (C) 2019 Bazso Akos
+ *
+ * This file is part of libkes.
+ *
+ * libkes is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * libkes is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with libkes.  If not, see <https://www.gnu.org/licenses/>.
+ *
+ ******************************************************************************/
+/* include standard headers */
+#include <stdint.h>
+#include <stdlib.h>
+#include <string.h>
+
+/* include module headers */
+#include "alloc.h"
+
+/******************************************************************************/
+
+/*******************************************************************************
+ * FUNCTION    : kes_heap_alloc
+ * DESCRIPTION : default allocator, see kes_alloc_t
+ * INPUT       : context "ctx" (unused), number of bytes "size"
+ * OUTPUT      : pointer to memory, NULL if out of memory
+ ******************************************************************************/
+static void* kes_heap_alloc(
+    void*  ctx,
+    size_t size
+    )
+{
+    (void)ctx;
+
+    return( malloc( size ) );
+} // end kes_heap_alloc
+
+/******************************************************************************/
+
+/*******************************************************************************
+ * FUNCTION    : kes_heap_resize
+ * DESCRIPTION : default allocator, see kes_alloc_t
+ * INPUT       : context "ctx" (unused), pointer "ptr" to block, old and new
+ *               number of bytes "oldsize" (unused) and "size"
+ * OUTPUT      : pointer to memory, NULL if out of memory
+ ******************************************************************************/
+static void* kes_heap_resize(
+    void*  ctx,
+    void*  ptr,
+    size_t oldsize,
+    size_t size
+    )
+{
+    (void)ctx;
+    (void)oldsize;
+
+    return( realloc( ptr, size ) );
+} // end kes_heap_resize
+
+/******************************************************************************/
+
+/*******************************************************************************
+ * FUNCTION    : kes_heap_release
+ * DESCRIPTION : default allocator, see kes_alloc_t
+ * INPUT       : context "ctx" (unused), pointer "ptr" to block, number of
+ *               bytes "size" (unused)
+ * OUTPUT      : none
+ ******************************************************************************/
+static void kes_heap_release(
+    void*  ctx,
+    void*  ptr,
+    size_t size
+    )
+{
+    (void)ctx;
+    (void)size;
+
+    free( ptr );
+} // end kes_heap_release
+
+/******************************************************************************/
+
+/* default allocator */
+static const kes_alloc_t kes_heap = {
+    .alloc   = kes_heap_alloc,
+    .resize  = kes_heap_resize,
+    .release = kes_heap_release,
+    .ctx     = NULL
+};
+
+/* current allocator of the library, see kes_set_allocator() */
+static kes_alloc_t kes_alloc_cur = {
+    .alloc   = kes_heap_alloc,
+    .resize  = kes_heap_resize,
+    .release = kes_heap_release,
+    .ctx     = NULL
+};
+
+/******************************************************************************/
+
+/*******************************************************************************
+ * FUNCTION    : kes_set_allocator
+ * DESCRIPTION : set the memory allocator of the library
+ * INPUT       : pointer "alloc" to allocator (NULL = malloc() and free())
+ * OUTPUT      : error code from kes_err_e
+ ******************************************************************************/
+kes_err_e kes_set_allocator(const kes_alloc_t* alloc)
+{
+    if ( alloc == NULL )
+    {
+        kes_alloc_cur = kes_heap;
+        return( KES_ERR_NOERR );
+    } // end if
+
+    /* exception: allocator without allocation */
+    if ( alloc->alloc == NULL )
+    {
+        return( KES_ERR_BADVAL );
+    } // end if
+
+    kes_alloc_cur = *alloc;
+
+    return( KES_ERR_NOERR );
+} // end kes_set_allocator
+
+/******************************************************************************/
+
+/*******************************************************************************
+ * FUNCTION    : kes_get_allocator
+ * DESCRIPTION : get the current memory allocator of the library
+ * INPUT       : pointer "alloc" to return the allocator
+ * OUTPUT      : none
+ ******************************************************************************/
+void kes_get_allocator(kes_alloc_t* alloc)
+{
+    *alloc = kes_alloc_cur;
+} // end kes_get_allocator
+
+/******************************************************************************/
+
+/*******************************************************************************
+ * FUNCTION    : kes_arena_init
+ * DESCRIPTION : initialize an arena on a caller-provided buffer
+ * INPUT       : pointer "arena" to arena, buffer "buf" and its number of
+ *               bytes "size"
+ * OUTPUT      : error code from kes_err_e
+ ******************************************************************************/
+kes_err_e kes_arena_init(
+    kes_arena_t* arena,
+    void*        buf,
+    const size_t size
+    )
+{
+    arena->base = NULL;
+    arena->size = 0;
+    arena->used = 0;
+
+    /* exception: missing buffer */
+    if ( (buf == NULL) && (size > 0) )
+    {
+        return( KES_ERR_BADVAL );
+    } // end if
+
+    if ( buf != NULL )
+    {
+        const uintptr_t addr = (uintptr_t)buf;
+        const size_t    pad  = (size_t)((KES_ARENA_ALIGN -
+                                         addr % KES_ARENA_ALIGN) %
+                                        KES_ARENA_ALIGN);
+        arena->base = (unsigned char*)buf + ((pad < size) ? pad : size);
+        arena->size = ((pad < size) ? size - pad : 0);
+    } // end if
+
+    return( KES_ERR_NOERR );
+} // end kes_arena_init
+
+/******************************************************************************/
+
+/*******************************************************************************
+ * FUNCTION    : kes_arena_alloc
+ * DESCRIPTION : allocate a block from an arena
+ * INPUT       : pointer "arena" to arena, number of bytes "size"
+ * OUTPUT      : pointer to memory, NULL if the arena is full
+ * NOTE the offset is advanced by compare and swap, concurrent callers get
+ *      distinct blocks
+ ******************************************************************************/
+void* kes_arena_alloc(
+    kes_arena_t* arena,
+    const size_t size
+    )
+{
+    /* exception: size would overflow when rounded */
+    if ( size > arena->size )
+    {
+        return( NULL );
+    } // end if
+
+    const size_t len  = KES_WS_ROUND( ((size > 0) ? size : 1) );
+    size_t       used = __atomic_load_n( &arena->used, __ATOMIC_RELAXED );
+    do
+    {
+        if ( len > arena->size - used )
+        {
+            return( NULL );
+        } // end if
+    } while ( !__atomic_compare_exchange_n( &arena->used, &used, used + len,
+                                            1, __ATOMIC_RELAXED,
+                                            __ATOMIC_RELAXED ) );
+
+    return( arena->base + used );
+} // end kes_arena_alloc
+
+/******************************************************************************/
+
+/*******************************************************************************
+ * FUNCTION    : kes_arena_reset
+ * DESCRIPTION : release all blocks of an arena at once
+ * INPUT       : pointer "arena" to arena
+ * OUTPUT      : none
+ ******************************************************************************/
+void kes_arena_reset(kes_arena_t* arena)
+{
+    __atomic_store_n( &arena->used, 0, __ATOMIC_RELAXED );
+} // end kes_arena_reset
+
+/******************************************************************************/
+
+/*******************************************************************************
+ * FUNCTION    : kes_arena_used
+ * DESCRIPTION : number of bytes handed out by an arena
+ * INPUT       : pointer "arena" to arena
+ * OUTPUT      : number of bytes including alignment
+ ******************************************************************************/
+size_t kes_arena_used(const kes_arena_t* arena)
+{
+    return( __atomic_load_n( &arena->used, __ATOMIC_RELAXED ) );
+} // end kes_arena_used
+
+/******************************************************************************/
+
+/*******************************************************************************
+ * FUNCTION    : kes_arena_cb_alloc
+ * DESCRIPTION : allocation callback of kes_arena_allocator()
+ * INPUT       : arena "ctx", number of bytes "size"
+ * OUTPUT      : pointer to memory, NULL if the arena is full
+ ******************************************************************************/
+static void* kes_arena_cb_alloc(
+    void*  ctx,
+    size_t size
+    )
+{
+    return( kes_arena_alloc( (kes_arena_t*)ctx, size ) );
+} // end kes_arena_cb_alloc
+
+/******************************************************************************/
+
+/*******************************************************************************
+ * FUNCTION    : kes_arena_cb_resize
+ * DESCRIPTION : reallocation callback of kes_arena_allocator()
+ * INPUT       : arena "ctx", pointer "ptr" to block, old and new number of
+ *               bytes "oldsize" and "size"
+ * OUTPUT      : pointer to memory, NULL if the arena is full
+ * NOTE the last block of the arena is resized in place, others are copied
+ ******************************************************************************/
+static void* kes_arena_cb_resize(
+    void*  ctx,
+    void*  ptr,
+    size_t oldsize,
+    size_t size
+    )
+{
+    kes_arena_t* arena = (kes_arena_t*)ctx;
+
+    if ( ptr == NULL )
+    {
+        return( kes_arena_alloc( arena, size ) );
+    } // end if
+
+    /* last block: move the end of the used range */
+    if ( size <= arena->size )
+    {
+        const size_t off  = (size_t)((unsigned char*)ptr - arena->base);
+        size_t       used = off + KES_WS_ROUND( ((oldsize > 0) ? oldsize : 1) );
+        const size_t len  = KES_WS_ROUND( ((size > 0) ? size : 1) );
+        if ( (len <= arena->size - off) &&
+             __atomic_compare_exchange_n( &arena->used, &used, off + len, 0,
+                                          __ATOMIC_RELAXED,
+                                          __ATOMIC_RELAXED ) )
+        {
+            return( ptr );
+        } // end if
+    } // end if
+
+    /* shrinking block in the middle: keep it */
+    if ( size <= oldsize )
+    {
+        return( ptr );
+    } // end if
+
+    void* res = kes_arena_alloc( arena, size );
+    if ( res != NULL )
+    {
+        memcpy( res, ptr, ((oldsize < size) ? oldsize : size) );
+    } // end if
+
+    return( res );
+} // end kes_arena_cb_resize
+
+/******************************************************************************/
+
+/*******************************************************************************
+ * FUNCTION    : kes_arena_allocator
+ * DESCRIPTION : allocator that takes its memory from an arena
+ * INPUT       : pointer "arena" to arena
+ * OUTPUT      : allocator structure, blocks are released by kes_arena_reset()
+ ******************************************************************************/
+kes_alloc_t kes_arena_allocator(kes_arena_t* arena)
+{
+    const kes_alloc_t res = {
+        .alloc   = kes_arena_cb_alloc,
+        .resize  = kes_arena_cb_resize,
+        .release = NULL,
+        .ctx     = arena
+    };
+
+    return( res );
+} // end kes_arena_allocator
+
+/******************************************************************************/
+
+/*******************************************************************************
+ * FUNCTION    : kes_mem_alloc
+ * DESCRIPTION : allocate memory from the current allocator
+ * INPUT       : pointer "alloc" to return the allocator, number of bytes
+ *               "size"
+ * OUTPUT      : pointer to memory, NULL if out of memory
+ ******************************************************************************/
+void* kes_mem_alloc(
+    kes_alloc_t* alloc,
+    const size_t size
+    )
+{
+    *alloc = kes_alloc_cur;
+
+    return( alloc->alloc( alloc->ctx, size ) );
+} // end kes_mem_alloc
+
+/******************************************************************************/
+
+/*******************************************************************************
+ * FUNCTION    : kes_mem_calloc
+ * DESCRIPTION : allocate zero-initialized memory from the current allocator
+ * INPUT       : pointer "alloc" to return the allocator, number of elements
+ *               "count" and bytes per element "size"
+ * OUTPUT      : pointer to memory, NULL if out of memory
+ * NOTE the default allocator uses calloc(), i.e. fresh pages are not touched
+ ******************************************************************************/
+void* kes_mem_calloc(
+    kes_alloc_t* alloc,
+    const size_t count,
+    const size_t size
+    )
+{
+    *alloc = kes_alloc_cur;
+
+    /* exception: number of bytes overflows */
+    if ( (size > 0) && (count > SIZE_MAX / size) )
+    {
+        return( NULL );
+    } // end if
+
+    if ( alloc->alloc == kes_heap_alloc )
+    {
+        return( calloc( count, size ) );
+    } // end if
+
+    void* res = alloc->alloc( alloc->ctx, count * size );
+    if ( res != NULL )
+    {
+        memset( res, 0, count * size );
+    } // end if
+
+    return( res );
+} // end kes_mem_calloc
+
+/******************************************************************************/
+
+/*******************************************************************************
+ * FUNCTION    : kes_mem_resize
+ * DESCRIPTION : resize memory from an allocator
+ * INPUT       : pointer "alloc" to allocator of the block, pointer "ptr" to
+ *               block (or NULL), old and new number of bytes "oldsize" and
+ *               "size"
+ * OUTPUT      : pointer to memory, NULL if out of memory (block is kept)
+ ******************************************************************************/
+void* kes_mem_resize(
+    const kes_alloc_t* alloc,
+    void*              ptr,
+    const size_t       oldsize,
+    const size_t       size
+    )
+{
+    if ( alloc->resize != NULL )
+    {
+        return( alloc->resize( alloc->ctx, ptr, oldsize, size ) );
+    } // end if
+
+    /* allocator without resize: allocate, copy and release */
+    void* res = alloc->alloc( alloc->ctx, size );
+    if ( (res != NULL) && (ptr != NULL) )
+    {
+        memcpy( res, ptr, ((oldsize < size) ? oldsize : size) );
+        kes_mem_free( alloc, ptr, oldsize );
+    } // end if
+
+    return( res );
+} // end kes_mem_resize
+
+/******************************************************************************/
+
+/*******************************************************************************
+ * FUNCTION    : kes_mem_free
+ * DESCRIPTION : release memory to an allocator
+ * INPUT       : pointer "alloc" to allocator of the block, pointer "ptr" to
+ *               block (or NULL), number of bytes "size"
+ * OUTPUT      : none
+ ******************************************************************************/
+void kes_mem_free(
+    const kes_alloc_t* alloc,
+    void*              ptr,
+    const size_t       size
+    )
+{
+    if ( (ptr != NULL) && (alloc->release != NULL) )
+    {
+        alloc->release( alloc->ctx, ptr, size );
+    } // end if
+} // end kes_mem_free
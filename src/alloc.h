@@ -0,0 +1,231 @@
+/***************************************************************************//**
+ * @file    alloc.h
+ * @brief   pluggable memory allocator and arena of the library
+ * @author  Bazso Akos
+ * @version 2026.10
+ *
+ * @copyright
+ * Copyright (C) 2019 Bazso Akos
+ *
+ * This file is part of libkes.
+ *
+ * libkes is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * libkes is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with libkes.  If not, see <https://www.gnu.org/licenses/>.
+ *
+ ******************************************************************************/
+#pragma once
+#ifndef KES_ALLOC__H
+#define KES_ALLOC__H
+
+/* include standard headers */
+#include <stddef.h>
+
+/* include module headers */
+#include "error.h"
+
+/******************************************************************************/
+
+/*** declare macro constants ***/
+
+/* alignment of arena blocks and workspace buffers (cache line) */
+#define KES_ARENA_ALIGN 64
+
+/* round a workspace size up to a multiple of KES_ARENA_ALIGN */
+#define KES_WS_ROUND(size) \
+    (((size) + KES_ARENA_ALIGN - 1) / KES_ARENA_ALIGN * KES_ARENA_ALIGN)
+
+/******************************************************************************/
+
+/*** declare data structures ***/
+
+/*!
+ * @brief memory allocator used by the library
+ * @details all memory of tables, the thread pool, the result cache, the
+ * statistics and profiles and of the GPU batches is obtained from the
+ * current allocator, see kes_set_allocator(); \a alloc returns memory
+ * aligned for any type or NULL, \a resize may be NULL (the library then
+ * allocates, copies and releases), \a release may be NULL if memory is
+ * reclaimed as a whole (e.g. by kes_arena_reset()); every callback gets the
+ * \a ctx pointer and the size of the block as requested before
+ */
+typedef struct
+{
+    void* (*alloc)(void* ctx, size_t size);                ///< allocate
+    void* (*resize)(void* ctx, void* ptr, size_t oldsize,
+                    size_t size);                          ///< reallocate
+    void  (*release)(void* ctx, void* ptr, size_t size);   ///< release
+    void*  ctx;                                            ///< user data
+} kes_alloc_t;
+
+
+/*!
+ * @brief bump allocator on a caller-provided buffer
+ * @details blocks are carved from the buffer one after the other, aligned
+ * to KES_ARENA_ALIGN bytes, and only released together by
+ * kes_arena_reset(); the last block grows in place; allocation is
+ * lock-free and may be called from several threads
+ */
+typedef struct
+{
+    unsigned char* base;   ///< first aligned byte of the buffer
+    size_t         size;   ///< usable bytes from base
+    size_t         used;   ///< bytes already handed out
+} kes_arena_t;
+
+/******************************************************************************/
+
+/*** function declarations ***/
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/*!
+ * @brief set the memory allocator of the library
+ * @details all later allocations use \a alloc, NULL restores malloc() and
+ * free(); every table, cache, GPU batch, job and thread table keeps the
+ * allocator it was obtained from and is released by it, i.e. the allocator
+ * may be switched at any time, but an arena must outlive all blocks taken
+ * from it; NOTE not thread-safe, call before solving in other threads
+ * @param[in] alloc pointer to allocator (or NULL for the default)
+ * @return error code from enum #kes_err_e;
+ * KES_ERR_NOERR indicates success, KES_ERR_BADVAL a missing alloc callback
+ */
+kes_err_e kes_set_allocator(const kes_alloc_t* alloc);
+
+
+/*!
+ * @brief get the current memory allocator of the library
+ * @param[out] alloc pointer to return the allocator
+ */
+void kes_get_allocator(kes_alloc_t* alloc);
+
+
+/*!
+ * @brief initialize an arena on a caller-provided buffer
+ * @details the arena uses the buffer from its first byte aligned to
+ * KES_ARENA_ALIGN; the buffer must stay valid while blocks are in use
+ * @param[out] arena pointer to arena
+ * @param[in] buf buffer (may be NULL if size = 0)
+ * @param[in] size number of bytes of the buffer
+ * @return error code from enum #kes_err_e;
+ * KES_ERR_NOERR indicates success, KES_ERR_BADVAL indicates error
+ */
+kes_err_e kes_arena_init(
+    kes_arena_t* arena,
+    void*        buf,
+    const size_t size
+);
+
+
+/*!
+ * @brief allocate a block from an arena
+ * @param[in,out] arena pointer to arena from kes_arena_init()
+ * @param[in] size number of bytes
+ * @return pointer aligned to KES_ARENA_ALIGN, NULL if the arena is full
+ */
+void* kes_arena_alloc(
+    kes_arena_t* arena,
+    const size_t size
+);
+
+
+/*!
+ * @brief release all blocks of an arena at once
+ * @param[in,out] arena pointer to arena from kes_arena_init()
+ */
+void kes_arena_reset(kes_arena_t* arena);
+
+
+/*!
+ * @brief number of bytes handed out by an arena
+ * @details includes the padding for alignment, i.e. the buffer size an
+ * arena needs for the same sequence of allocations
+ * @param[in] arena pointer to arena from kes_arena_init()
+ * @return number of bytes used since kes_arena_init() or kes_arena_reset()
+ */
+size_t kes_arena_used(const kes_arena_t* arena);
+
+
+/*!
+ * @brief allocator that takes its memory from an arena
+ * @details for kes_set_allocator(); blocks are released by
+ * kes_arena_reset() only, the arena must outlive all of them
+ * @param[in] arena pointer to arena from kes_arena_init()
+ * @return allocator structure
+ */
+kes_alloc_t kes_arena_allocator(kes_arena_t* arena);
+
+
+/*!
+ * @brief allocate memory from the current allocator
+ * @param[out] alloc pointer to return a copy of the current allocator, for
+ * kes_mem_resize() and kes_mem_free() of the block
+ * @param[in] size number of bytes
+ * @return pointer to memory, NULL if out of memory
+ */
+void* kes_mem_alloc(
+    kes_alloc_t* alloc,
+    const size_t size
+);
+
+
+/*!
+ * @brief allocate zero-initialized memory from the current allocator
+ * @param[out] alloc pointer to return a copy of the current allocator
+ * @param[in] count number of elements
+ * @param[in] size number of bytes per element
+ * @return pointer to memory, NULL if out of memory
+ */
+void* kes_mem_calloc(
+    kes_alloc_t* alloc,
+    const size_t count,
+    const size_t size
+);
+
+
+/*!
+ * @brief resize memory from an allocator
+ * @param[in] alloc allocator of the block, see kes_mem_alloc()
+ * @param[in] ptr pointer from kes_mem_alloc() (or NULL)
+ * @param[in] oldsize number of bytes of the block
+ * @param[in] size new number of bytes
+ * @return pointer to memory, NULL if out of memory (the block is kept)
+ */
+void* kes_mem_resize(
+    const kes_alloc_t* alloc,
+    void*              ptr,
+    const size_t       oldsize,
+    const size_t       size
+);
+
+
+/*!
+ * @brief release memory to an allocator
+ * @param[in] alloc allocator of the block, see kes_mem_alloc()
+ * @param[in] ptr pointer from kes_mem_alloc() (or NULL)
+ * @param[in] size number of bytes of the block
+ */
+void kes_mem_free(
+    const kes_alloc_t* alloc,
+    void*              ptr,
+    const size_t       size
+);
+
+#ifdef __cplusplus
+}
+#endif
+
+/******************************************************************************/
+
+#endif  /* KES_ALLOC__H */
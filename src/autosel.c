@@ -0,0 +1,218 @@
+/***************************************************************************//**
+ * @file    autosel.c
+ * @brief   automatic selection of starter and solver methods
+ * @author  Bazso Akos
+ * @version 2026.10
+ *
+ * @copyright
+ * Copyright (C) 2019 Bazso Akos
+ *
+ * This file is part of libkes.
+ *
+ * libkes is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * libkes is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with libkes.  If not, see <https://www.gnu.org/licenses/>.
+ *
+ ******************************************************************************/
+/* include standard headers */
+#include <math.h>
+
+/* include module headers */
+#include "autosel.h"
+#include "const.h"
+#include "utils.h"
+
+/******************************************************************************/
+
+/* use verbose debug output? 0 = no (default), 1 = yes */
+#define KES_AUTOSEL_DEBUG 0
+
+/******************************************************************************/
+
+/* boundaries of eccentricity bands, the last band contains the
+ * near-parabolic orbits KES_NEARPAR_ECC < ecc < 1
+ */
+const double kes_auto_ecc[KES_AUTO_ECC_BINS + 1] = {
+    0.0, 0.3, 0.5, 0.7, 0.8, 0.9, 0.95, KES_NEARPAR_ECC, 1.0
+};
+
+/* boundaries of bands of reduced mean anomaly, cf. region logic in nijenh.c */
+const double kes_auto_ma[KES_AUTO_MA_BINS + 1] = {
+    0.0, 0.1, 0.4, 1.5, M_PI
+};
+
+/* built-in dispatch table, generated by examples/14_autotune,
+ * NOTE starters are ignored by Markley's, Mikkola's and Nijenhuis' method
+ */
+static const kes_auto_table_t auto_default = {
+    .ell = {
+        /* 0 <= ecc < 0.3 */
+        {{KES_STM_ES07, KES_SOL_DANBUR4}, {KES_STM_ES00, KES_SOL_NIJENH},
+         {KES_STM_ES00, KES_SOL_NIJENH}, {KES_STM_ES00, KES_SOL_NIJENH}},
+        /* 0.3 <= ecc < 0.5 */
+        {{KES_STM_ES07, KES_SOL_DANBUR4}, {KES_STM_ES15, KES_SOL_NEWRAP},
+         {KES_STM_ES00, KES_SOL_NIJENH}, {KES_STM_ES00, KES_SOL_NIJENH}},
+        /* 0.5 <= ecc < 0.7 */
+        {{KES_STM_ES07, KES_SOL_DANBUR5}, {KES_STM_ES12, KES_SOL_DANBUR4},
+         {KES_STM_ES00, KES_SOL_NIJENH}, {KES_STM_ES15, KES_SOL_NEWRAP}},
+        /* 0.7 <= ecc < 0.8 */
+        {{KES_STM_ES07, KES_SOL_HALLEY}, {KES_STM_ES15, KES_SOL_HALLEY},
+         {KES_STM_ES00, KES_SOL_NIJENH}, {KES_STM_ES06, KES_SOL_DANBUR4}},
+        /* 0.8 <= ecc < 0.9 */
+        {{KES_STM_ES07, KES_SOL_DANBUR4}, {KES_STM_ES04, KES_SOL_DANBUR5},
+         {KES_STM_ES00, KES_SOL_NIJENH}, {KES_STM_ES06, KES_SOL_LAGCON}},
+        /* 0.9 <= ecc < 0.95 */
+        {{KES_STM_ES15, KES_SOL_HALLEY}, {KES_STM_ES00, KES_SOL_MIKKOLA},
+         {KES_STM_ES00, KES_SOL_NIJENH}, {KES_STM_ES00, KES_SOL_NIJENH}},
+        /* 0.95 <= ecc < 0.99 */
+        {{KES_STM_ES00, KES_SOL_MIKKOLA}, {KES_STM_ES00, KES_SOL_MIKKOLA},
+         {KES_STM_ES00, KES_SOL_NIJENH}, {KES_STM_ES00, KES_SOL_NIJENH}},
+        /* 0.99 <= ecc < 1 */
+        {{KES_STM_ES00, KES_SOL_MARKLEY}, {KES_STM_ES00, KES_SOL_MARKLEY},
+         {KES_STM_ES00, KES_SOL_NIJENH}, {KES_STM_ES00, KES_SOL_NIJENH}}
+    },
+    .hyp = KES_SOL_DANBUR4
+};
+
+/* active dispatch table */
+static kes_auto_table_t auto_table = auto_default;
+
+/******************************************************************************/
+
+/*******************************************************************************
+ * FUNCTION    : kes_auto_band
+ * DESCRIPTION : find band of a value in a list of boundaries
+ * INPUT       : - value "x"
+ *               - boundaries "edge" of "bins" bands
+ * OUTPUT      : index of band (0 <= index < bins), values outside of the
+ *               boundaries and invalid numbers map to the first or last band
+ ******************************************************************************/
+static inline int kes_auto_band(
+    const double  x,
+    const double* edge,
+    const int     bins
+    )
+{
+    int i = 0;
+
+    while ( (i < bins - 1) && (x >= edge[i + 1]) )
+    {
+        ++i;
+    } // end while
+
+    return( i );
+} // end kes_auto_band
+
+/******************************************************************************/
+
+/*******************************************************************************
+ * FUNCTION    : kes_auto_select
+ * DESCRIPTION : select starter and solver method for KES_SOL_AUTO
+ * INPUT       : - eccentricity "ecc"
+ *               - mean anomaly "ma" (in radians)
+ *               - pointers "init" and "iter" to return selected methods
+ * OUTPUT      : none
+ ******************************************************************************/
+void kes_auto_select(
+    const double ecc,
+    const double ma,
+    kes_stm_e*   init,
+    kes_sol_e*   iter
+    )
+{
+    kes_err_e err;
+
+    /* hyperbolic case: built-in starter, only the solver is selected */
+    if ( (ecc > 1.0) && (kes_check_ecc( ecc, &err ) == KES_ECC_HYP) )
+    {
+        *init = KES_STM_ES04;
+        *iter = auto_table.hyp;
+        return;
+    } // end if
+
+    const int i = kes_auto_band( ecc, kes_auto_ecc, KES_AUTO_ECC_BINS );
+    const int j = kes_auto_band( fabs( kes_reduce( ma ) ),
+                                 kes_auto_ma, KES_AUTO_MA_BINS );
+
+    *init = auto_table.ell[i][j].init;
+    *iter = auto_table.ell[i][j].iter;
+} // end kes_auto_select
+
+/******************************************************************************/
+
+/*******************************************************************************
+ * FUNCTION    : kes_set_auto_table
+ * DESCRIPTION : replace the dispatch table of KES_SOL_AUTO
+ * INPUT       : pointer "table" to new dispatch table (or NULL for defaults)
+ * OUTPUT      : error code from enum kes_err_e
+ ******************************************************************************/
+kes_err_e kes_set_auto_table(const kes_auto_table_t* table)
+{
+    /* restore built-in defaults */
+    if ( table == NULL )
+    {
+        auto_table = auto_default;
+        return( KES_ERR_NOERR );
+    } // end if
+
+    /* exception: check all entries before changing the active table */
+    for (int i = 0; i < KES_AUTO_ECC_BINS; i++)
+    {
+        for (int j = 0; j < KES_AUTO_MA_BINS; j++)
+        {
+            const kes_auto_pair_t p = table->ell[i][j];
+
+            if ( (p.init <= KES_STM_NONE) || (p.init >= KES_STM_TOTAL) )
+            {
+#if KES_AUTOSEL_DEBUG
+    kes_show_error( KES_ERR_BADSTM );
+#endif
+                return( KES_ERR_BADSTM );
+            } // end if
+
+            if ( (p.iter <= KES_SOL_NONE) || (p.iter >= KES_SOL_TOTAL) )
+            {
+#if KES_AUTOSEL_DEBUG
+    kes_show_error( KES_ERR_BADSOL );
+#endif
+                return( KES_ERR_BADSOL );
+            } // end if
+        } // end for(j)
+    } // end for(i)
+
+    if ( (table->hyp <= KES_SOL_NONE) || (table->hyp >= KES_SOL_TOTAL) )
+    {
+#if KES_AUTOSEL_DEBUG
+    kes_show_error( KES_ERR_BADSOL );
+#endif
+        return( KES_ERR_BADSOL );
+    } // end if
+
+    auto_table = *table;
+
+    return( KES_ERR_NOERR );
+} // end kes_set_auto_table
+
+/******************************************************************************/
+
+/*******************************************************************************
+ * FUNCTION    : kes_get_auto_table
+ * DESCRIPTION : get a copy of the active dispatch table of KES_SOL_AUTO
+ * INPUT       : pointer "table" to return dispatch table
+ * OUTPUT      : none
+ ******************************************************************************/
+void kes_get_auto_table(kes_auto_table_t* table)
+{
+    *table = auto_table;
+} // end kes_get_auto_table
+
+/******************************************************************************/
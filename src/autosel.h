@@ -0,0 +1,137 @@
+/***************************************************************************//**
+ * @file    autosel.h
+ * @brief   automatic selection of starter and solver methods
+ * @author  Bazso Akos
+ * @version 2026.10
+ *
+ * @copyright
+ * Copyright (C) 2019 Bazso Akos
+ *
+ * This file is part of libkes.
+ *
+ * libkes is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * libkes is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with libkes.  If not, see <https://www.gnu.org/licenses/>.
+ *
+ ******************************************************************************/
+#pragma once
+#ifndef KES_AUTOSEL__H
+#define KES_AUTOSEL__H
+
+/* include module headers */
+#include "error.h"
+#include "solver.h"
+#include "starter.h"
+
+/******************************************************************************/
+
+/*** declare macro constants ***/
+
+/* number of eccentricity bands of the dispatch table, see kes_auto_ecc */
+#define KES_AUTO_ECC_BINS 8
+
+/* number of bands of reduced mean anomaly, see kes_auto_ma */
+#define KES_AUTO_MA_BINS  4
+
+/******************************************************************************/
+
+/*** declare data structures ***/
+
+/*!
+ * @brief pair of starter and solver method selected for a region
+ */
+typedef struct
+{
+    kes_stm_e init; ///< starter method
+    kes_sol_e iter; ///< solver method
+} kes_auto_pair_t;
+
+
+/*!
+ * @brief dispatch table of KES_SOL_AUTO
+ * @details entry ell[i][j] is used for elliptic orbits with
+ * kes_auto_ecc[i] <= ecc < kes_auto_ecc[i + 1] and reduced mean anomaly
+ * kes_auto_ma[j] <= |ma| < kes_auto_ma[j + 1], reduced to -pi <= ma < pi
+ */
+typedef struct
+{
+    kes_auto_pair_t ell[KES_AUTO_ECC_BINS][KES_AUTO_MA_BINS]; ///< elliptic
+    kes_sol_e       hyp; ///< solver method for hyperbolic orbits
+} kes_auto_table_t;
+
+/******************************************************************************/
+
+/*** declare global variables ***/
+
+/*!
+ * @brief boundaries of the eccentricity bands of the dispatch table
+ */
+extern const double kes_auto_ecc[KES_AUTO_ECC_BINS + 1];
+
+/*!
+ * @brief boundaries of the bands of reduced mean anomaly (in radians)
+ */
+extern const double kes_auto_ma[KES_AUTO_MA_BINS + 1];
+
+/******************************************************************************/
+
+/*** function declarations ***/
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/*!
+ * @brief select starter and solver method for KES_SOL_AUTO
+ * @details looks up the region of (ecc, ma) in the dispatch table;
+ * circular, parabolic and invalid eccentricities get the entry of the
+ * lowest region, which solves them as any other pair of methods
+ * @param[in] ecc eccentricity
+ * @param[in] ma mean anomaly (in radians)
+ * @param[out] init pointer to return starter method
+ * @param[out] iter pointer to return solver method
+ */
+void kes_auto_select(
+    const double ecc,
+    const double ma,
+    kes_stm_e*   init,
+    kes_sol_e*   iter
+);
+
+
+/*!
+ * @brief replace the dispatch table of KES_SOL_AUTO
+ * @details the table is copied, e.g. the output of the tuning program
+ * examples/14_autotune for the hardware at hand; NOTE not thread-safe,
+ * call before solving with KES_SOL_AUTO in other threads
+ * @param[in] table pointer to structure of type #kes_auto_table_t
+ * (or NULL to restore the built-in defaults)
+ * @return error code from enum #kes_err_e;
+ * KES_ERR_NOERR indicates success, KES_ERR_BADSTM or KES_ERR_BADSOL
+ * indicates an invalid entry (the active table is not changed)
+ */
+kes_err_e kes_set_auto_table(const kes_auto_table_t* table);
+
+
+/*!
+ * @brief get a copy of the active dispatch table of KES_SOL_AUTO
+ * @param[out] table pointer to structure of type #kes_auto_table_t
+ */
+void kes_get_auto_table(kes_auto_table_t* table);
+
+#ifdef __cplusplus
+}
+#endif
+
+/******************************************************************************/
+
+#endif  /* KES_AUTOSEL__H */
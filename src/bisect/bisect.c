@@ -30,6 +30,7 @@
 /* include module headers */
 #include "bisect.h"
 #include "debug.h"
+#include "trace.h"
 #include "kepeq.h"
 
 /******************************************************************************/
@@ -55,26 +56,26 @@ int bisect(
     double       xl, xr, x;      /* interval: xl <= x <= xr */
     double       fl, fr, fx;     /* fl = f(xl), fr = f(xr), fx = f(x) */
 
-    /* correction factor for absolute error deltaf */
-    const double corr = ecc / (1.0 - ecc);
+    /* correction factor for absolute error deltaf (precomputed if available) */
+    const double corr = ((res->terms != NULL) ?
+                         res->terms->corr : ecc / (1.0 - ecc));
 
     /* reset error residuals */
     deltax = deltaf = 0.0;
-#if KES_SHOW_ITER_STATS
     res->nbrSinEval = res->nbrCosEval = res->nbrFktEval = 0;
-#endif
 
-#if KES_ITER_DEBUG
-    KES_DEBUG_STM("bisect", ecc, ma, starter);
-#endif
+    /* trace iteration process? */
+    const int trace = kes_trace_begin();
+
+    /* NOTE given starter is overridden by the bracketing interval */
+    (void)starter;
 
     /* define lower and upper limits for solution, override given starter */
     xl = ma;
     xr = ma + ecc;
     deltax = fabs(xr - xl);
-#if KES_ITER_DEBUG
-    KES_DEBUG_SOL("bisect", count, deltax, 0.0);
-#endif
+    kes_trace_step( trace, KES_SOL_BISECT, count, ecc, ma, 0.5 * (xl + xr),
+                    deltax, 0.0 );
 
     /* check if interval width is small enough */
     if ( deltax < res->tolx )
@@ -85,9 +86,7 @@ int bisect(
 
     /* check if f(xl) is a solution */
     fl = kes_keq_ell( ecc, ma, xl );
-#if KES_SHOW_ITER_STATS
     ++(res->nbrSinEval); ++(res->nbrFktEval);
-#endif
     if ( fabs(fl) < res->tolf )
     {
         res->result = xl;
@@ -96,9 +95,7 @@ int bisect(
 
     /* check if f(xr) is a solution */
     fr = kes_keq_ell( ecc, ma, xr );
-#if KES_SHOW_ITER_STATS
     ++(res->nbrSinEval); ++(res->nbrFktEval);
-#endif
     if ( fabs(fr) < res->tolf )
     {
         res->result = xr;
@@ -113,9 +110,7 @@ int bisect(
 
         /* function value at midpoint */
         fx = kes_keq_ell( ecc, ma, x );
-#if KES_SHOW_ITER_STATS
         ++(res->nbrSinEval); ++(res->nbrFktEval);
-#endif
 
         /* modify interval border */
         ((fl * fx < 0.0) ? (xr = x, fr = fx) : (xl = x, fl = fx));
@@ -126,9 +121,8 @@ int bisect(
         deltax = fabs(xr - xl);
         deltaf = fabs(fx) * corr;
 
-#if KES_ITER_DEBUG
-    KES_DEBUG_SOL("bisect", count, deltax, deltaf);
-#endif
+        kes_trace_step( trace, KES_SOL_BISECT, count, ecc, ma,
+                        x, deltax, deltaf );
     } while (
         (deltax > res->tolx) &&
         (deltaf > res->tolf) &&
@@ -0,0 +1,270 @@
+/*******************************************************************************
+ * @file    brent.c
+ * @brief   solver method KES_SOL_BRENT = Brent's method
+ * @author  Bazso Akos
+ * @version 1.0, 14 Oct 2026
+ *
+ * @copyright
+ * Copyright (C) 2019 Bazso Akos
+ *
+ * This file is part of libkes.
+ *
+ * libkes is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * libkes is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with libkes.  If not, see <https://www.gnu.org/licenses/>.
+ *
+ ******************************************************************************/
+/* include standard headers */
+#include <float.h>
+#include <math.h>
+
+/* include module headers */
+#include "brent.h"
+#include "const.h"
+#include "debug.h"
+#include "trace.h"
+#include "kepeq.h"
+#include "utils.h"
+
+/******************************************************************************/
+
+/*******************************************************************************
+ *  FUNCTION    : brent_bracket
+ *  DESCRIPTION : provable bounds of the solution E(M) of the elliptic Kepler
+ *                Equation in 0 <= M <= pi, i.e. E - M = e * sin(E) with
+ *                sin(x) concave on [0,pi]:
+ *                - upper bounds from sin(E) <= E, sin(E) <= 1,
+ *                  sin(E) <= pi - E (starters S4, S6, S7) and from the
+ *                  tangent sin(E) <= sin(M) + cos(M) * (E - M)
+ *                - lower bounds from the chord
+ *                  sin(E) >= sin(M) * (pi - E) / (pi - M) for M <= E <= pi
+ *                  and from sin(E) >= E - E^3 / 6 (root of the cubic, see
+ *                  starter S10)
+ *  INPUT       : - eccentricity "ecc" (0 < ecc < 1)
+ *                - reduced mean anomaly "ma" (0 <= ma <= pi)
+ *                - pointers "lo" and "hi" to return the bounds
+ *  OUTPUT      : none
+ ******************************************************************************/
+static inline void brent_bracket(
+    const double ecc,
+    const double ma,
+    double*      lo,
+    double*      hi
+    )
+{
+    double es, ec; /* e * sin(M), e * cos(M) */
+
+    kes_sincos( &es, &ec, ma, ecc );
+
+    /* upper bound: min{S7, tangent} */
+    double up = fmin( ma / (1.0 - ecc), ma + ecc );
+    up = fmin( up, (ma + ecc * M_PI) / (1.0 + ecc) );
+    up = fmin( up, ma + es / (1.0 - ec) );
+
+    /* lower bound: max{M, chord} */
+    const double k  = ((ma < M_PI) ? es / (M_PI - ma) : ecc);
+    double       lw = fmax( ma, (ma + k * M_PI) / (1.0 + k) );
+
+    /* NOTE the cubic is only tight (and well conditioned) for high ecc */
+    if ( ecc > 0.5 )
+    {
+        const double q = 2.0 * (1.0 - ecc) / ecc;
+        const double r = 3.0 * ma / ecc;
+        const double s = cbrt(sqrt(q*q*q + r*r) + r);
+        lw = fmax( lw, s - q / s );
+    } // end if
+
+    *lo = lw;
+    *hi = fmax( up, lw );
+} // end brent_bracket
+
+/******************************************************************************/
+
+/*******************************************************************************
+ *  FUNCTION    : brent
+ *  DESCRIPTION : Brent's method = bracketing with inverse quadratic
+ *                interpolation, secant and bisection steps
+ *  INPUT       : - eccentricity "ecc"
+ *                - mean anomaly "ma" in radians
+ *                - "starter" value for first iteration
+ *                - "res" for results
+ *  OUTPUT      : number of iterations
+ ******************************************************************************/
+int brent(
+    const double ecc,
+    const double ma,
+    const double starter,
+    kes_input_t* res
+    )
+{
+    register int count = 0;      /* iteration counter */
+    double       deltax, deltaf; /* error residuals */
+    double       a, b, c;        /* b = best point, root between b and c,
+                                    a = previous value of b */
+    double       fa, fb, fc;     /* fa = f(a), fb = f(b), fc = f(c) */
+    double       d, e;           /* last step and step before last */
+
+    /* correction factor for absolute error deltaf (precomputed if available) */
+    const double corr = ((res->terms != NULL) ?
+                         res->terms->corr : ecc / (1.0 - ecc));
+
+    /* reset error residuals */
+    deltax = deltaf = 0.0;
+    res->nbrSinEval = res->nbrCosEval = res->nbrFktEval = 0;
+
+    /* trace iteration process? */
+    const int trace = kes_trace_begin();
+
+    /* NOTE given starter is overridden by the bracketing interval */
+    (void)starter;
+
+    /* define lower and upper limits for solution, override given starter */
+    brent_bracket( ecc, ma, &a, &b );
+    ++(res->nbrSinEval); ++(res->nbrCosEval);
+    deltax = fabs(b - a);
+    kes_trace_step( trace, KES_SOL_BRENT, count, ecc, ma, 0.5 * (a + b),
+                    deltax, 0.0 );
+
+    /* check if interval width is small enough */
+    if ( deltax < res->tolx )
+    {
+        res->result = 0.5 * (a + b);
+        return( 1 );
+    } // end if
+
+    /* check if f(a) is a solution, widen interval if roundoff in the
+     * bounds gives the wrong sign: f(M) = -e * sin(M) <= 0
+     */
+    fa = kes_keq_ell( ecc, ma, a );
+    ++(res->nbrSinEval); ++(res->nbrFktEval);
+    if ( fabs(fa) * corr < res->tolf )
+    {
+        res->result = a;
+        return( 1 );
+    } // end if
+    if ( fa > 0.0 )
+    {
+        a  = ma;
+        fa = kes_keq_ell( ecc, ma, a );
+        ++(res->nbrSinEval); ++(res->nbrFktEval);
+    } // end if
+
+    /* check if f(b) is a solution, likewise f(M + e) >= 0 */
+    fb = kes_keq_ell( ecc, ma, b );
+    ++(res->nbrSinEval); ++(res->nbrFktEval);
+    if ( fabs(fb) * corr < res->tolf )
+    {
+        res->result = b;
+        return( 1 );
+    } // end if
+    if ( fb < 0.0 )
+    {
+        b  = ma + ecc;
+        fb = kes_keq_ell( ecc, ma, b );
+        ++(res->nbrSinEval); ++(res->nbrFktEval);
+    } // end if
+
+    /* start with b as best point and c = a on the other side of the root */
+    c  = a;  fc = fa;
+    d  = e = b - a;
+
+    /* main iteration loop */
+    do
+    {
+        /* keep b as the point with the smallest residual */
+        if ( fabs(fc) < fabs(fb) )
+        {
+            a = b;  fa = fb;
+            b = c;  fb = fc;
+            c = a;  fc = fa;
+        } // end if
+
+        const double tol = 2.0 * DBL_EPSILON * fabs(b) + 0.5 * res->tolx;
+        const double xm  = 0.5 * (c - b);
+
+        /* interpolation if the last but one step decreased enough */
+        if ( (fabs(e) >= tol) && (fabs(fa) > fabs(fb)) )
+        {
+            const double s = fb / fa;
+            double       p, q;
+
+            if ( a == c )
+            {
+                /* secant step */
+                p = 2.0 * xm * s;
+                q = 1.0 - s;
+            } // end if
+            else
+            {
+                /* inverse quadratic interpolation */
+                const double t = fa / fc;
+                const double r = fb / fc;
+                p = s * (2.0 * xm * t * (t - r) - (b - a) * (r - 1.0));
+                q = (t - 1.0) * (r - 1.0) * (s - 1.0);
+            } // end else
+            ((p > 0.0) ? (q = -q) : (p = -p));
+
+            /* accept step only if it falls well inside the bracket */
+            if ( 2.0 * p < fmin(3.0 * xm * q - fabs(tol * q), fabs(e * q)) )
+            {
+                e = d;
+                d = p / q;
+            } // end if
+            else
+            {
+                d = e = xm;
+            } // end else
+        } // end if
+        else
+        {
+            /* bisection step */
+            d = e = xm;
+        } // end else
+
+        /* new approximation point, at least tol away from b */
+        a  = b;  fa = fb;
+        b += ((fabs(d) > tol) ? d : copysign(tol, xm));
+
+        /* function value at new point */
+        fb = kes_keq_ell( ecc, ma, b );
+        ++(res->nbrSinEval); ++(res->nbrFktEval);
+
+        /* keep the root between b and c */
+        if ( (fb > 0.0) == (fc > 0.0) )
+        {
+            c = a;  fc = fa;
+            d = e = b - a;
+        } // end if
+
+        ++count;
+
+        /* update error residuals */
+        deltax = fabs(c - b);
+        deltaf = fabs(fb) * corr;
+
+        kes_trace_step( trace, KES_SOL_BRENT, count, ecc, ma,
+                        b, deltax, deltaf );
+    } while (
+        (deltax > res->tolx + 4.0 * DBL_EPSILON * fabs(b)) &&
+        (deltaf > res->tolf) &&
+        (count  < res->maxiter)
+    ); // end do
+
+    /* results */
+    res->result = b;
+    res->errDF  = deltaf;
+    res->errDX  = deltax;
+
+    return( count );
+} // end brent
+
+/******************************************************************************/
@@ -0,0 +1,67 @@
+/***************************************************************************//**
+ * @file    brent.h
+ * @brief   Brent's method (safeguarded bracketing with inverse interpolation)
+ * @details after description in:
+ * Brent (1973), Algorithms for Minimization without Derivatives, chapter 4
+ * @author  Bazso Akos
+ *
+ * @copyright
+ * Copyright (C) 2019 Bazso Akos
+ *
+ * This file is part of libkes.
+ *
+ * libkes is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * libkes is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with libkes.  If not, see <https://www.gnu.org/licenses/>.
+ *
+ ******************************************************************************/
+#pragma once
+#ifndef KES_SOL_BRENT__H
+#define KES_SOL_BRENT__H
+
+/* include module headers */
+#include "input.h"
+
+/******************************************************************************/
+
+/*** function declarations ***/
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/*!
+ * @brief iteration function for Brent's method
+ * @details the root is bracketed by provable bounds of E(M) that are much
+ * tighter than [M, M+e], each iteration takes the inverse quadratic or
+ * linear interpolation step if it stays well inside the bracket and a
+ * bisection step otherwise, i.e. convergence is guaranteed
+ * @param[in] ecc eccentricity
+ * @param[in] ma reduced mean anomaly (0 <= ma <= pi)
+ * @param[in] starter starting value for first iteration (ignored)
+ * @param[out] res iteration results and statistics
+ * @return number of iterations
+ */
+int brent(
+    const double ecc,
+    const double ma,
+    const double starter,
+    kes_input_t* res
+);
+
+#ifdef __cplusplus
+}
+#endif
+
+/******************************************************************************/
+
+#endif  /* KES_SOL_BRENT__H */
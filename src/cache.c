@@ -0,0 +1,532 @@
+/***************************************************************************//**
+ * @file    cache.c
+ * @brief   optional cache of solutions for repeated (ecc, ma) queries
+ * @details open addressing with a short probe sequence, every entry is
+ *          guarded by its own sequence counter (odd while being written),
+ *          i.e. readers never wait and writers skip busy entries; the
+ *          counters are sharded by hash to avoid contention between threads
+ * @author  Bazso Akos
+ * @version 2026.10
+ *
+ * @copyright
+ * Copyright (C) 2019 Bazso Akos
+ *
+ * This file is part of libkes.
+ *
+ * libkes is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * libkes is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with libkes.  If not, see <https://www.gnu.org/licenses/>.
+ *
+ ******************************************************************************/
+/* include standard headers */
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+/* include module headers */
+#include "cache.h"
+#include "alloc.h"
+
+/******************************************************************************/
+
+/* use verbose debug output? 0 = no (default), 1 = yes */
+#define KES_CACHE_DEBUG 0
+
+/* number of words of the key of an entry */
+#define KES_CACHE_KEYLEN 5
+
+/* number of consecutive entries searched for a key */
+#define KES_CACHE_WAYS   4
+
+/* number of shards of the counters (power of 2) */
+#define KES_CACHE_SHARDS 16
+
+/* packed word of the key of an empty entry, not used by any valid key */
+#define KES_CACHE_EMPTY  ((uint64_t)1 << 63)
+
+/******************************************************************************/
+
+/* one cached solution, all members are accessed atomically */
+typedef struct
+{
+    uint64_t seq;                   ///< version, odd while written
+    uint64_t key[KES_CACHE_KEYLEN]; ///< ecc, ma, tolf, tolx, packed params
+    uint64_t result;                ///< bit pattern of the solution
+    uint64_t err;                   ///< errDF and errDX as floats
+    uint64_t iterations;            ///< number of iterations
+} kes_cache_entry_t;
+
+/* counters of one shard, padded to a cache line */
+typedef struct
+{
+    uint64_t hits;
+    uint64_t misses;
+    uint64_t inserts;
+    uint64_t pad[5];
+} kes_cache_shard_t;
+
+/* table of the cache */
+struct kes_cache_s
+{
+    kes_cache_shard_t  shard[KES_CACHE_SHARDS]; ///< sharded counters
+    size_t             mask;                    ///< capacity - 1
+    kes_cache_entry_t* entry;                   ///< array of entries
+    kes_alloc_t        alloc;                   ///< allocator of the table
+};
+
+/* offset of the entries behind the table in one block */
+#define KES_CACHE_HEAD KES_WS_ROUND( sizeof(struct kes_cache_s) )
+
+/* current cache (or NULL if disabled) */
+kes_cache_t* kes_cache_table = NULL;
+
+/******************************************************************************/
+
+/*******************************************************************************
+ * FUNCTION    : kes_cache_bits
+ * DESCRIPTION : bit pattern of a double
+ * INPUT       : value "x"
+ * OUTPUT      : bit pattern of "x"
+ ******************************************************************************/
+static inline uint64_t kes_cache_bits(const double x)
+{
+    uint64_t u;
+    memcpy( &u, &x, sizeof(u) );
+    return( u );
+} // end kes_cache_bits
+
+/******************************************************************************/
+
+/*******************************************************************************
+ * FUNCTION    : kes_cache_key
+ * DESCRIPTION : build the key of a request, all inputs which change the
+ *               solution are part of the key
+ * INPUT       : - eccentricity "ecc" and mean anomaly "ma"
+ *               - starter method "init" and solver method "iter"
+ *               - request of kes_plan_solve() "plan" (1) or kesolver() (0)
+ *               - pointer "data" to checked input parameters
+ *               - array "key" of KES_CACHE_KEYLEN words
+ * OUTPUT      : 1 if the key is valid, 0 if the parameters do not fit
+ ******************************************************************************/
+static int kes_cache_key(
+    const double       ecc,
+    const double       ma,
+    const kes_stm_e    init,
+    const kes_sol_e    iter,
+    const int          plan,
+    const kes_input_t* data,
+    uint64_t*          key
+    )
+{
+    /* NOTE layout of the packed word: maxiter (bits 0-28), hinit (29-31),
+     *      fixiter (32-43), init (44-49), iter (50-54), trig (55-56),
+     *      conv (57-58), stop (59-61), plan (62)
+     */
+    if (
+        (data->maxiter < 0) || (data->maxiter > 0x1FFFFFFF) ||
+        ((unsigned)data->hinit > 0x7) || (data->fixiter < 0) ||
+        (data->fixiter > 0xFFF) || ((unsigned)init > 0x3F) ||
+        ((unsigned)iter > 0x1F) || ((unsigned)data->trig > 0x3) ||
+        ((unsigned)data->conv > 0x3) || ((unsigned)data->stop > 0x7)
+    ) {
+        return( 0 );
+    } // end if
+
+    key[0] = kes_cache_bits( ecc );
+    key[1] = kes_cache_bits( ma );
+    key[2] = kes_cache_bits( data->tolf );
+    key[3] = kes_cache_bits( data->tolx );
+    key[4] = ((uint64_t)(uint32_t)data->maxiter)       |
+             ((uint64_t)data->hinit            << 29) |
+             ((uint64_t)data->fixiter          << 32) |
+             ((uint64_t)init                   << 44) |
+             ((uint64_t)iter                   << 50) |
+             ((uint64_t)data->trig             << 55) |
+             ((uint64_t)data->conv             << 57) |
+             ((uint64_t)data->stop             << 59) |
+             ((uint64_t)(plan != 0)            << 62);
+
+    return( 1 );
+} // end kes_cache_key
+
+/******************************************************************************/
+
+/*******************************************************************************
+ * FUNCTION    : kes_cache_hash
+ * DESCRIPTION : hash of a key (multiply and xor-shift mixing)
+ * INPUT       : array "key" of KES_CACHE_KEYLEN words
+ * OUTPUT      : hash value
+ ******************************************************************************/
+static uint64_t kes_cache_hash(const uint64_t* key)
+{
+    uint64_t h = 0x9E3779B97F4A7C15ULL;
+
+    for (int k = 0; k < KES_CACHE_KEYLEN; k++)
+    {
+        h  = (h ^ key[k]) * 0xBF58476D1CE4E5B9ULL;
+        h ^= h >> 31;
+    } // end for
+    h *= 0x94D049BB133111EBULL;
+    h ^= h >> 29;
+
+    return( h );
+} // end kes_cache_hash
+
+/******************************************************************************/
+
+/*******************************************************************************
+ * FUNCTION    : kes_cache_count
+ * DESCRIPTION : increment a counter of a shard
+ * INPUT       : pointer "cnt" to counter
+ * OUTPUT      : none
+ ******************************************************************************/
+static inline void kes_cache_count(uint64_t* cnt)
+{
+    __atomic_fetch_add( cnt, 1, __ATOMIC_RELAXED );
+} // end kes_cache_count
+
+/******************************************************************************/
+
+/*******************************************************************************
+ * FUNCTION    : kes_cache_match
+ * DESCRIPTION : compare the key of an entry, only valid while its sequence
+ *               counter does not change
+ * INPUT       : - pointer "e" to entry
+ *               - array "key" of KES_CACHE_KEYLEN words
+ * OUTPUT      : 1 if the keys are equal, 0 otherwise
+ ******************************************************************************/
+static inline int kes_cache_match(
+    const kes_cache_entry_t* e,
+    const uint64_t*          key
+    )
+{
+    for (int k = 0; k < KES_CACHE_KEYLEN; k++)
+    {
+        if ( __atomic_load_n( &e->key[k], __ATOMIC_RELAXED ) != key[k] )
+        {
+            return( 0 );
+        } // end if
+    } // end for
+
+    return( 1 );
+} // end kes_cache_match
+
+/******************************************************************************/
+
+/*******************************************************************************
+ * FUNCTION    : kes_set_cache
+ * DESCRIPTION : enable, resize or disable the cache of solutions
+ * INPUT       : number of entries "capacity" (0 = disable)
+ * OUTPUT      : KES_ERR_NOERR on success, KES_ERR_BADVAL on error
+ ******************************************************************************/
+kes_err_e kes_set_cache(const size_t capacity)
+{
+    kes_cache_t* cache = NULL;
+
+#if !KES_CACHE
+    if ( capacity > 0 )
+    {
+        return( KES_ERR_BADVAL );
+    } // end if
+#endif
+
+    /* check capacity */
+    if ( capacity > KES_CACHE_MAXCAP )
+    {
+#if KES_CACHE_DEBUG
+    fprintf( stderr, "cache: bad capacity %zu\n", capacity );
+#endif
+        return( KES_ERR_BADVAL );
+    } // end if
+
+    /* new table with a power of 2 entries */
+    if ( capacity > 0 )
+    {
+        size_t cap = KES_CACHE_WAYS;
+        while ( cap < capacity )
+        {
+            cap *= 2;
+        } // end while
+
+        /* NOTE entries follow the table in the same block */
+        kes_alloc_t alloc;
+        cache = (kes_cache_t*)kes_mem_calloc( &alloc, 1, KES_CACHE_HEAD +
+                                              cap * sizeof(kes_cache_entry_t) );
+        if ( cache == NULL )
+        {
+            return( KES_ERR_NOMEM );
+        } // end if
+
+        cache->mask  = cap - 1;
+        cache->entry = (kes_cache_entry_t*)((unsigned char*)cache +
+                                            KES_CACHE_HEAD);
+        cache->alloc = alloc;
+    } // end if
+
+    /* replace old table */
+    kes_cache_t* old = __atomic_exchange_n( &kes_cache_table, cache,
+                                            __ATOMIC_ACQ_REL );
+    if ( old != NULL )
+    {
+        const kes_alloc_t alloc = old->alloc;
+        kes_mem_free( &alloc, old, KES_CACHE_HEAD +
+                      (old->mask + 1) * sizeof(kes_cache_entry_t) );
+    } // end if
+
+    return( KES_ERR_NOERR );
+} // end kes_set_cache
+
+/******************************************************************************/
+
+/*******************************************************************************
+ * FUNCTION    : kes_cache_reset
+ * DESCRIPTION : remove all entries of the cache and clear its counters
+ * INPUT       : none
+ * OUTPUT      : none
+ ******************************************************************************/
+void kes_cache_reset(void)
+{
+    kes_cache_t* cache = kes_cache_begin();
+
+    if ( cache == NULL )
+    {
+        return;
+    } // end if
+
+    /* mark entries empty, NOTE entries being written are skipped and the
+     * sequence counters keep increasing, a reader can not see a new entry
+     * with the counter of an old one
+     */
+    for (size_t i = 0; i <= cache->mask; i++)
+    {
+        kes_cache_entry_t* e = &cache->entry[i];
+        uint64_t           s = __atomic_load_n( &e->seq, __ATOMIC_RELAXED );
+        if (
+            ((s & 1) == 0) &&
+            __atomic_compare_exchange_n( &e->seq, &s, s + 1, 0,
+                                         __ATOMIC_ACQUIRE, __ATOMIC_RELAXED )
+        ) {
+            __atomic_thread_fence( __ATOMIC_RELEASE );
+            __atomic_store_n( &e->key[KES_CACHE_KEYLEN - 1], KES_CACHE_EMPTY,
+                              __ATOMIC_RELAXED );
+            __atomic_store_n( &e->seq, s + 2, __ATOMIC_RELEASE );
+        } // end if
+    } // end for
+
+    for (int k = 0; k < KES_CACHE_SHARDS; k++)
+    {
+        __atomic_store_n( &cache->shard[k].hits,    0, __ATOMIC_RELAXED );
+        __atomic_store_n( &cache->shard[k].misses,  0, __ATOMIC_RELAXED );
+        __atomic_store_n( &cache->shard[k].inserts, 0, __ATOMIC_RELAXED );
+    } // end for
+} // end kes_cache_reset
+
+/******************************************************************************/
+
+/*******************************************************************************
+ * FUNCTION    : kes_get_cache_stats
+ * DESCRIPTION : get the counters of the cache summed over all shards
+ * INPUT       : pointer "stats" to structure of type kes_cache_stats_t
+ * OUTPUT      : KES_ERR_NOERR on success, KES_ERR_BADVAL on error
+ ******************************************************************************/
+kes_err_e kes_get_cache_stats(kes_cache_stats_t* stats)
+{
+    if ( stats == NULL )
+    {
+        return( KES_ERR_BADVAL );
+    } // end if
+
+    memset( stats, 0, sizeof(kes_cache_stats_t) );
+
+    kes_cache_t* cache = kes_cache_begin();
+    if ( cache != NULL )
+    {
+        stats->capacity = cache->mask + 1;
+        for (int k = 0; k < KES_CACHE_SHARDS; k++)
+        {
+            const kes_cache_shard_t* s = &cache->shard[k];
+            stats->hits    += __atomic_load_n( &s->hits,    __ATOMIC_RELAXED );
+            stats->misses  += __atomic_load_n( &s->misses,  __ATOMIC_RELAXED );
+            stats->inserts += __atomic_load_n( &s->inserts, __ATOMIC_RELAXED );
+        } // end for
+    } // end if
+
+    return( KES_ERR_NOERR );
+} // end kes_get_cache_stats
+
+/******************************************************************************/
+
+/*******************************************************************************
+ * FUNCTION    : kes_cache_lookup
+ * DESCRIPTION : look up a solution in the cache
+ * INPUT       : - table "cache" of the cache
+ *               - eccentricity "ecc" and mean anomaly "ma"
+ *               - starter method "init" and solver method "iter"
+ *               - request of kes_plan_solve() "plan" (1) or kesolver() (0)
+ *               - pointer "data" to checked input parameters, the outputs
+ *                 are set on a hit
+ * OUTPUT      : 1 on a hit, 0 otherwise
+ ******************************************************************************/
+int kes_cache_lookup(
+    kes_cache_t*    cache,
+    const double    ecc,
+    const double    ma,
+    const kes_stm_e init,
+    const kes_sol_e iter,
+    const int       plan,
+    kes_input_t*    data
+    )
+{
+    uint64_t key[KES_CACHE_KEYLEN];
+
+    if ( !kes_cache_key( ecc, ma, init, iter, plan, data, key ) )
+    {
+        return( 0 );
+    } // end if
+
+    const uint64_t     h     = kes_cache_hash( key );
+    kes_cache_shard_t* shard = &cache->shard[h & (KES_CACHE_SHARDS - 1)];
+
+    for (size_t w = 0; w < KES_CACHE_WAYS; w++)
+    {
+        const kes_cache_entry_t* e = &cache->entry[(h + w) & cache->mask];
+
+        /* skip entries being written, NOTE empty entries do not match */
+        const uint64_t s = __atomic_load_n( &e->seq, __ATOMIC_ACQUIRE );
+        if ( (s == 0) || (s & 1) )
+        {
+            continue;
+        } // end if
+
+        /* read the entry, valid if the sequence counter did not change */
+        const int      same = kes_cache_match( e, key );
+        const uint64_t res  = __atomic_load_n( &e->result, __ATOMIC_RELAXED );
+        const uint64_t err  = __atomic_load_n( &e->err, __ATOMIC_RELAXED );
+        const uint64_t it   = __atomic_load_n( &e->iterations,
+                                               __ATOMIC_RELAXED );
+        __atomic_thread_fence( __ATOMIC_ACQUIRE );
+        if ( !same || (__atomic_load_n( &e->seq, __ATOMIC_RELAXED ) != s) )
+        {
+            continue;
+        } // end if
+
+        /* hit: outputs of the stored solve, no evaluations */
+        const uint32_t df = (uint32_t)err;
+        const uint32_t dx = (uint32_t)(err >> 32);
+        float          f;
+        memcpy( &data->result, &res, sizeof(double) );
+        memcpy( &f, &df, sizeof(float) );
+        data->errDF = f;
+        memcpy( &f, &dx, sizeof(float) );
+        data->errDX      = f;
+        data->iterations = (int)it;
+        data->nbrSinEval = data->nbrCosEval = data->nbrFktEval = 0;
+
+        kes_cache_count( &shard->hits );
+        return( 1 );
+    } // end for
+
+    kes_cache_count( &shard->misses );
+    return( 0 );
+} // end kes_cache_lookup
+
+/******************************************************************************/
+
+/*******************************************************************************
+ * FUNCTION    : kes_cache_insert
+ * DESCRIPTION : store a successful solution in the cache, the entry of the
+ *               same key, an empty entry or an entry chosen by the hash is
+ *               replaced; busy entries are skipped, i.e. the solution may
+ *               not be stored
+ * INPUT       : - table "cache" of the cache
+ *               - eccentricity "ecc" and mean anomaly "ma"
+ *               - starter method "init" and solver method "iter"
+ *               - request of kes_plan_solve() "plan" (1) or kesolver() (0)
+ *               - pointer "data" to checked input parameters and outputs
+ * OUTPUT      : none
+ ******************************************************************************/
+void kes_cache_insert(
+    kes_cache_t*       cache,
+    const double       ecc,
+    const double       ma,
+    const kes_stm_e    init,
+    const kes_sol_e    iter,
+    const int          plan,
+    const kes_input_t* data
+    )
+{
+    uint64_t key[KES_CACHE_KEYLEN];
+
+    if ( !kes_cache_key( ecc, ma, init, iter, plan, data, key ) )
+    {
+        return;
+    } // end if
+
+    const uint64_t h = kes_cache_hash( key );
+
+    /* choose entry: same key, else first empty, else by hash */
+    kes_cache_entry_t* e = NULL;
+    for (size_t w = 0; (w < KES_CACHE_WAYS) && (e == NULL); w++)
+    {
+        kes_cache_entry_t* c = &cache->entry[(h + w) & cache->mask];
+        const uint64_t     s = __atomic_load_n( &c->seq, __ATOMIC_ACQUIRE );
+        if (
+            (s == 0) ||
+            (((s & 1) == 0) &&
+             (kes_cache_match( c, key ) ||
+              (__atomic_load_n( &c->key[KES_CACHE_KEYLEN - 1],
+                                __ATOMIC_RELAXED ) == KES_CACHE_EMPTY)))
+        ) {
+            e = c;
+        } // end if
+    } // end for
+    if ( e == NULL )
+    {
+        e = &cache->entry[(h + (h >> 32) % KES_CACHE_WAYS) & cache->mask];
+    } // end if
+
+    /* lock entry by an odd sequence counter, skip if busy */
+    uint64_t s = __atomic_load_n( &e->seq, __ATOMIC_RELAXED );
+    if (
+        (s & 1) ||
+        !__atomic_compare_exchange_n( &e->seq, &s, s + 1, 0,
+                                      __ATOMIC_ACQUIRE, __ATOMIC_RELAXED )
+    ) {
+        return;
+    } // end if
+    __atomic_thread_fence( __ATOMIC_RELEASE );
+
+    /* residuals rounded to float */
+    const float df = (float)data->errDF;
+    const float dx = (float)data->errDX;
+    uint32_t    udf, udx;
+    memcpy( &udf, &df, sizeof(float) );
+    memcpy( &udx, &dx, sizeof(float) );
+
+    for (int k = 0; k < KES_CACHE_KEYLEN; k++)
+    {
+        __atomic_store_n( &e->key[k], key[k], __ATOMIC_RELAXED );
+    } // end for
+    __atomic_store_n( &e->result, kes_cache_bits( data->result ),
+                      __ATOMIC_RELAXED );
+    __atomic_store_n( &e->err, ((uint64_t)udx << 32) | udf,
+                      __ATOMIC_RELAXED );
+    __atomic_store_n( &e->iterations, (uint64_t)(uint32_t)data->iterations,
+                      __ATOMIC_RELAXED );
+
+    /* unlock */
+    __atomic_store_n( &e->seq, s + 2, __ATOMIC_RELEASE );
+
+    kes_cache_count( &cache->shard[h & (KES_CACHE_SHARDS - 1)].inserts );
+} // end kes_cache_insert
+
+/******************************************************************************/
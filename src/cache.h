@@ -0,0 +1,199 @@
+/***************************************************************************//**
+ * @file    cache.h
+ * @brief   optional cache of solutions for repeated (ecc, ma) queries
+ * @author  Bazso Akos
+ * @version 2026.10
+ *
+ * @copyright
+ * Copyright (C) 2019 Bazso Akos
+ *
+ * This file is part of libkes.
+ *
+ * libkes is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * libkes is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with libkes.  If not, see <https://www.gnu.org/licenses/>.
+ *
+ ******************************************************************************/
+#pragma once
+#ifndef KES_CACHE__H
+#define KES_CACHE__H
+
+/* include standard headers */
+#include <stddef.h>
+#include <stdint.h>
+
+/* include module headers */
+#include "error.h"
+#include "input.h"
+#include "solver.h"
+#include "starter.h"
+
+/******************************************************************************/
+
+/*** declare macro constants ***/
+
+/* build with cache support (1 = default) or without it (0, e.g. by
+ * -DKES_CACHE=0), in which case kes_set_cache() fails for capacity > 0
+ */
+#ifndef KES_CACHE
+#define KES_CACHE 1
+#endif
+
+/* max. number of entries of the cache (72 bytes each) */
+#define KES_CACHE_MAXCAP ((size_t)1 << 26)
+
+/******************************************************************************/
+
+/*** declare data structures ***/
+
+/*!
+ * @brief structure containing the counters of the cache
+ * @details requests without a usable key (e.g. "fixiter" > 4095) are
+ * neither hits nor misses
+ */
+typedef struct
+{
+    uint64_t capacity; ///< number of entries (0 = cache disabled)
+    uint64_t hits;     ///< number of requests served from the cache
+    uint64_t misses;   ///< number of requests not found in the cache
+    uint64_t inserts;  ///< number of solutions stored in the cache
+} kes_cache_stats_t;
+
+
+/*!
+ * @brief table of cached solutions
+ * @details opaque type, see kes_set_cache()
+ */
+typedef struct kes_cache_s kes_cache_t;
+
+/******************************************************************************/
+
+/*** declare global variables ***/
+
+/* current cache (or NULL if disabled)
+ * NOTE internal use only, see kes_set_cache()
+ */
+extern kes_cache_t* kes_cache_table;
+
+/******************************************************************************/
+
+/*** function declarations ***/
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/*!
+ * @brief enable, resize or disable the cache of solutions
+ * @details if enabled, kesolver() and kes_plan_solve() look up every
+ * request by the exact bit patterns of eccentricity, mean anomaly and
+ * tolerances, the methods and the remaining input parameters, and store
+ * every successful solution; a hit returns the stored solution, number of
+ * iterations and residuals (rounded to float) without evaluations, and is
+ * not recorded by the statistics collector or the profiler; the table has
+ * \a capacity entries (rounded up to a power of 2), a full table replaces
+ * older entries; lookups and stores are thread-safe and lock-free;
+ * a disabled cache (default) costs a single load per call;
+ * NOTE not thread-safe, call before solving in other threads
+ * @param[in] capacity number of entries (0 = disable and release the table)
+ * @return error code from enum #kes_err_e;
+ * KES_ERR_NOERR indicates success, KES_ERR_BADVAL indicates a bad capacity
+ * or a library built without cache support (KES_CACHE = 0), KES_ERR_NOMEM
+ * that the table cannot be allocated
+ */
+kes_err_e kes_set_cache(const size_t capacity);
+
+
+/*!
+ * @brief remove all entries of the cache and clear its counters
+ * NOTE solutions stored concurrently may survive the reset
+ */
+void kes_cache_reset(void);
+
+
+/*!
+ * @brief get the counters of the cache
+ * @param[out] stats pointer to structure of type #kes_cache_stats_t
+ * @return error code from enum #kes_err_e;
+ * KES_ERR_NOERR indicates success, KES_ERR_BADVAL indicates error
+ */
+kes_err_e kes_get_cache_stats(kes_cache_stats_t* stats);
+
+
+/*!
+ * @brief look up a solution in the cache
+ * NOTE internal use only, see kesolver() and kes_plan_solve()
+ * @param[in] cache table returned by kes_cache_begin()
+ * @param[in] ecc eccentricity
+ * @param[in] ma mean anomaly (in radians)
+ * @param[in] init starter method
+ * @param[in] iter solver method
+ * @param[in] plan request of kes_plan_solve() (1) or kesolver() (0)
+ * @param[in,out] data checked input parameters, outputs are set on a hit
+ * @return 1 on a hit, 0 otherwise
+ */
+int kes_cache_lookup(
+    kes_cache_t*    cache,
+    const double    ecc,
+    const double    ma,
+    const kes_stm_e init,
+    const kes_sol_e iter,
+    const int       plan,
+    kes_input_t*    data
+);
+
+
+/*!
+ * @brief store a successful solution in the cache
+ * NOTE internal use only, see kesolver() and kes_plan_solve()
+ * @param[in] cache table returned by kes_cache_begin()
+ * @param[in] ecc eccentricity
+ * @param[in] ma mean anomaly (in radians)
+ * @param[in] init starter method
+ * @param[in] iter solver method
+ * @param[in] plan request of kes_plan_solve() (1) or kesolver() (0)
+ * @param[in] data checked input parameters and outputs of the solve
+ */
+void kes_cache_insert(
+    kes_cache_t*       cache,
+    const double       ecc,
+    const double       ma,
+    const kes_stm_e    init,
+    const kes_sol_e    iter,
+    const int          plan,
+    const kes_input_t* data
+);
+
+#ifdef __cplusplus
+}
+#endif
+
+/******************************************************************************/
+
+/*** inline functions ***/
+
+/*!
+ * @brief get the cache if it is enabled
+ * @return table of the cache, NULL if disabled
+ */
+static inline kes_cache_t* kes_cache_begin(void)
+{
+#if KES_CACHE
+    return( __atomic_load_n( &kes_cache_table, __ATOMIC_ACQUIRE ) );
+#else
+    return( NULL );
+#endif
+} // end kes_cache_begin
+
+/******************************************************************************/
+
+#endif  /* KES_CACHE__H */
@@ -0,0 +1,169 @@
+/*******************************************************************************
+ * @file    cordic.c
+ * @brief   solver method KES_SOL_CORDIC = CORDIC-like method
+ * @author  Bazso Akos
+ * @version 1.0, 14 Oct 2026
+ *
+ * @copyright
+ * Copyright (C) 2019 Bazso Akos
+ *
+ * This file is part of libkes.
+ *
+ * libkes is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * libkes is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with libkes.  If not, see <https://www.gnu.org/licenses/>.
+ *
+ ******************************************************************************/
+/* include standard headers */
+#include <math.h>
+
+/* include module headers */
+#include "cordic.h"
+#include "const.h"
+#include "debug.h"
+#include "trace.h"
+#include "itercore.h"
+
+/******************************************************************************/
+
+/* number of rotations, the last angle is pi / 2^(KES_CORDIC_NROT+1) ~ 3E-9,
+ * i.e. the final Newton-Raphson step gives full double precision
+ */
+#define KES_CORDIC_NROT 29
+
+/* versine 1 - cos(a) and sine of the rotation angles a = pi / 2^(n+2);
+ * NOTE the versine keeps the accuracy of cos(a) ~ 1 for small angles
+ */
+static const double cordic_rot[KES_CORDIC_NROT][2] = {
+    {2.92893218813452483e-01, 7.07106781186547573e-01},
+    {7.61204674887132476e-02, 3.82683432365089782e-01},
+    {1.92147195967695521e-02, 1.95090322016128276e-01},
+    {4.81527332780311377e-03, 9.80171403295606036e-02},
+    {1.20454379482760735e-03, 4.90676743274180149e-02},
+    {3.01181303795779903e-04, 2.45412285229122881e-02},
+    {7.52981608554590759e-05, 1.22715382857199254e-02},
+    {1.88247173988573415e-05, 6.13588464915447527e-03},
+    {4.70619042382848846e-06, 3.06795676296597614e-03},
+    {1.17654829809007089e-06, 1.53398018628476572e-03},
+    {2.94137117780839794e-07, 7.66990318742704485e-04},
+    {7.35342821488552730e-08, 3.83495187571395563e-04},
+    {1.83835707061916535e-08, 1.91747597310703319e-04},
+    {4.59589268710902788e-09, 9.58737990959773447e-05},
+    {1.14897317243732663e-09, 4.79368996030668813e-05},
+    {2.87243293150586049e-10, 2.39684498084182193e-05},
+    {7.18108232902248988e-11, 1.19842249050697070e-05},
+    {1.79527058227173763e-11, 5.99211245264242753e-06},
+    {4.48817645568941564e-12, 2.99605622633466084e-06},
+    {1.12204411392298338e-12, 1.49802811316901114e-06},
+    {2.80511028480785226e-13, 7.49014056584715741e-07},
+    {7.01277571201987551e-14, 3.74507028292384129e-07},
+    {1.75319392800498434e-14, 1.87253514146195347e-07},
+    {4.38298482001247031e-15, 9.36267570730980836e-08},
+    {1.09574620500311817e-15, 4.68133785365490947e-08},
+    {2.73936551250779592e-16, 2.34066892682745540e-08},
+    {6.84841378126948979e-17, 1.17033446341372770e-08},
+    {1.71210344531737245e-17, 5.85167231706863850e-09},
+    {4.28025861329343112e-18, 2.92583615853431925e-09}
+};
+
+/******************************************************************************/
+
+/*******************************************************************************
+ *  FUNCTION    : cordic
+ *  DESCRIPTION : CORDIC-like method = rotations by halving angles
+ *  INPUT       : - eccentricity "ecc"
+ *                - mean anomaly "ma" in radians
+ *                - "starter" value for first iteration
+ *                - "res" for results
+ *  OUTPUT      : number of iterations
+ ******************************************************************************/
+int cordic(
+    const double ecc,
+    const double ma,
+    const double starter,
+    kes_input_t* res
+    )
+{
+    register int count = 0;      /* iteration counter */
+    double       deltax, deltaf; /* error residuals */
+
+    /* correction factor for absolute error deltaf (precomputed if available) */
+    const double corr = ((res->terms != NULL) ?
+                         res->terms->corr : ecc / (1.0 - ecc));
+
+    /* reset error residuals */
+    res->nbrSinEval = res->nbrCosEval = res->nbrFktEval = 0;
+
+    /* trace iteration process? */
+    const int trace = kes_trace_begin();
+
+    /* NOTE given starter is overridden by the middle of 0 <= E <= pi */
+    (void)starter;
+
+    double x     = 0.5 * M_PI;  /* iteration variable */
+    double sx    = 1.0;         /* sin(x) */
+    double cx    = 0.0;         /* cos(x) */
+    double alpha = 0.25 * M_PI; /* rotation angle */
+
+    /* main iteration loop: rotate towards the solution, the direction
+     * follows from the sign of M - (x - e * sin(x))
+     */
+    for (count = 0; count < KES_CORDIC_NROT; count++)
+    {
+        const double sig = copysign( 1.0, ma - (x - ecc * sx) );
+        const double vs  = cordic_rot[count][0];
+        const double sn  = sig * cordic_rot[count][1];
+        const double ds  = cx * sn - sx * vs;
+        const double dc  = -sx * sn - cx * vs;
+
+        x     += sig * alpha;
+        sx    += ds;
+        cx    += dc;
+        alpha *= 0.5;
+
+        kes_trace_step( trace, KES_SOL_CORDIC, count + 1, ecc, ma,
+                        x, 2.0 * alpha, 0.0 );
+    } // end for
+
+    /* Newton-Raphson step with carried sin(x), cos(x) */
+    const double fx = x - ecc * sx - ma;
+    const double fp = 1.0 - ecc * cx;
+    const double dx = -fx / fp;
+    x += dx;
+    ++count;
+    ++(res->nbrFktEval);
+
+    /* error of the Newton-Raphson step is about e * dx^2 / (2 * f'(x)) */
+    deltax = 0.5 * ecc * dx * dx / fp;
+    deltaf = fabs(fx) * corr;
+
+    /* polish with one more step where this is not enough */
+    if ( deltax > res->tolx )
+    {
+        const double xn = kes_itercore2( ecc, ma, x );
+        ++(res->nbrSinEval); ++(res->nbrCosEval); ++(res->nbrFktEval);
+        deltax = fabs(xn - x);
+        x      = xn;
+        ++count;
+    } // end if
+
+    kes_trace_step( trace, KES_SOL_CORDIC, count, ecc, ma, x, deltax, deltaf );
+
+    /* results */
+    res->result = x;
+    res->errDF  = deltaf;
+    res->errDX  = deltax;
+
+    return( count );
+} // end cordic
+
+/******************************************************************************/
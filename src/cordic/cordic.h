@@ -0,0 +1,69 @@
+/***************************************************************************//**
+ * @file    cordic.h
+ * @brief   CORDIC-like method (rotations by halving angles, no sin/cos)
+ * @details after description in:
+ * Zechmeister (2018), Astron. Astrophys. 619, A128
+ * @author  Bazso Akos
+ *
+ * @copyright
+ * Copyright (C) 2019 Bazso Akos
+ *
+ * This file is part of libkes.
+ *
+ * libkes is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * libkes is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with libkes.  If not, see <https://www.gnu.org/licenses/>.
+ *
+ ******************************************************************************/
+#pragma once
+#ifndef KES_SOL_CORDIC__H
+#define KES_SOL_CORDIC__H
+
+/* include module headers */
+#include "input.h"
+
+/******************************************************************************/
+
+/*** function declarations ***/
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/*!
+ * @brief iteration function for CORDIC-like method
+ * @details E is found by a fixed sequence of rotations by the angles
+ * pi/4, pi/8, ... starting from E = pi/2, sin(E) and cos(E) are carried
+ * along with precomputed sin and cos of the angles, i.e. only multiplies
+ * and adds per step; a final Newton-Raphson step uses the carried values,
+ * only where this is not accurate enough (high ecc and small ma) one more
+ * Newton-Raphson step with sin/cos is taken
+ * @param[in] ecc eccentricity
+ * @param[in] ma reduced mean anomaly (0 <= ma <= pi)
+ * @param[in] starter starting value for first iteration (ignored)
+ * @param[out] res iteration results and statistics
+ * @return number of iterations
+ */
+int cordic(
+    const double ecc,
+    const double ma,
+    const double starter,
+    kes_input_t* res
+);
+
+#ifdef __cplusplus
+}
+#endif
+
+/******************************************************************************/
+
+#endif  /* KES_SOL_CORDIC__H */
@@ -30,11 +30,19 @@
 /* include module headers */
 #include "danbur4.h"
 #include "debug.h"
+#include "trace.h"
 #include "itercore.h"
 #include "kepeq.h"
 
 /******************************************************************************/
 
+/* switch from KES_TRIG_FAST to full accuracy below this |x(n+1)-x(n)|,
+ * the next step of order 4 reaches the error of the fast sin/cos (1E-12)
+ */
+static const double trig_switch = 0.2;
+
+/******************************************************************************/
+
 /*******************************************************************************
  *  FUNCTION    : danbur4
  *  DESCRIPTION : iteration function for Danby-Burkardt method of order 4
@@ -54,38 +62,87 @@ int danbur4(
     register int count = 0;      /* iteration counter */
     double       deltax, deltaf; /* error residuals */
     double       xnew, xold, fx; /* iteration variables */
+    int          fast, rough;    /* use fast sin/cos ? last step was fast ? */
+    int          done;           /* predicted error below tolerance ? */
+    double       sc[2];          /* e*sin, e*cos of the last full step */
 
-    /* correction factor for absolute error deltaf */
-    const double corr = ecc / (1.0 - ecc);
+    /* correction factor for absolute error deltaf (precomputed if available) */
+    const double corr = ((res->terms != NULL) ?
+                         res->terms->corr : ecc / (1.0 - ecc));
 
     /* reset error residuals */
     deltax = deltaf = 0.0;
-#if KES_SHOW_ITER_STATS
     res->nbrSinEval = res->nbrCosEval = res->nbrFktEval = 0;
-#endif
 
-#if KES_ITER_DEBUG
-    KES_DEBUG_STM("danbur4", ecc, ma, starter);
-#endif
+    /* trace iteration process? */
+    const int trace = kes_trace_begin();
+    kes_trace_step( trace, KES_SOL_DANBUR4, 0, ecc, ma, starter, 0.0, 0.0 );
 
     /* use starter for initializing iteration */
     xnew = starter;
 
+    /* fast sin/cos for early iterations */
+    fast = (res->trig == KES_TRIG_FAST);
+
+    /* residual of the previous iterate from the iteration step ? */
+    const int lean = (res->conv == KES_CONV_LEAN);
+
+    /* fixed number of iterations without evaluation of residuals */
+    if ( res->fixiter > 0 )
+    {
+        do
+        {
+            xold = xnew;
+
+            /* NOTE last iteration always with full accuracy */
+            xnew = ((fast && (count < res->fixiter - 1)) ?
+                    kes_itercore4_fast( ecc, ma, xold ) :
+                    kes_itercore4_sc( ecc, ma, xold, NULL, sc ));
+            ++(res->nbrSinEval); ++(res->nbrCosEval); ++(res->nbrFktEval);
+            ++count;
+        } while ( count < res->fixiter ); // end do
+
+        /* results */
+        res->result = xnew;
+        res->errDF  = 0.0;
+        res->errDX  = fabs(xnew - xold);
+        kes_trig_keep( res, xold, sc[0], sc[1] );
+
+        return( count );
+    } // end if
+
     /* main iteration loop */
     do
     {
         xold = xnew;
 
         /* call DANBUR4 iteration method */
-        xnew = kes_itercore4( ecc, ma, xold );
-#if KES_SHOW_ITER_STATS
+        if ( fast )
+        {
+            xnew = kes_itercore4_fast( ecc, ma, xold );
+        } // end if
+        else if ( lean )
+        {
+            xnew = kes_itercore4_sc( ecc, ma, xold, &fx, sc );
+        } // end if
+        else
+        {
+            xnew = kes_itercore4_sc( ecc, ma, xold, NULL, sc );
+        } // end else
         ++(res->nbrSinEval); ++(res->nbrCosEval); ++(res->nbrFktEval);
-#endif
 
-        fx = kes_keq_ell( ecc, ma, xnew );
-#if KES_SHOW_ITER_STATS
-        ++(res->nbrSinEval); ++(res->nbrFktEval);
-#endif
+        /* residual of xnew, in lean mode residual of xold from the step
+         * (none for a step with fast sin/cos)
+         */
+        if ( !lean )
+        {
+            fx = kes_keq_ell( ecc, ma, xnew );
+            ++(res->nbrSinEval); ++(res->nbrFktEval);
+        } // end if
+        else if ( fast )
+        {
+            fx = HUGE_VAL;
+        } // end if
 
         ++count;
 
@@ -93,19 +150,30 @@ int danbur4(
         deltax = fabs(xnew - xold);
         deltaf = fabs(fx) * corr;
 
-#if KES_ITER_DEBUG
-    KES_DEBUG_SOL("danbur4", count, deltax, deltaf);
-#endif
+        /* switch to full accuracy close to the solution;
+         * a step with fast sin/cos cannot confirm convergence in x
+         */
+        rough  = fast;
+        fast   = fast && (deltax > trig_switch);
+
+        /* order 4 predicts the error of xnew, see kes_set_stop() */
+        done   = (!rough) && kes_stop_order( res->stop, 4, ecc, xnew,
+                                             deltax, res->tolx );
+
+        kes_trace_step( trace, KES_SOL_DANBUR4, count, ecc, ma,
+                        xnew, deltax, deltaf );
     } while (
-        (deltax > res->tolx) &&
+        ((deltax > res->tolx) || rough) &&
         (deltaf > res->tolf) &&
+        (!done) &&
         (count  < res->maxiter)
     ); // end do
 
-    /* results */
+    /* results, sin/cos of the last step unless it was fast */
     res->result = xnew;
     res->errDF  = deltaf;
     res->errDX  = deltax;
+    kes_trig_keep( res, (rough ? NAN : xold), sc[0], sc[1] );
 
     return( count );
 } // end danbur4
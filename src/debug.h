@@ -32,23 +32,9 @@
 
 /******************************************************************************/
 
-/*!
- * @brief enable monitoring of function evaluations?
- * @details 0 = no (default), 1 = yes;
- * if enabled, #kes_input_t provides counters for the number of
- * (1) trigonometric function (sin, cos) evaluations,
- * (2) Kepler Equation function evaluations
- */
-#define KES_SHOW_ITER_STATS 0
-
-/******************************************************************************/
-
-/*!
- * @brief enable verbose debug output during iteration process?
- * @details 0 = no (default), 1 = yes;
- * if enabled, solver functions trace the progress of iterations to stdout
+/* NOTE iteration processes are traced at runtime, see kes_set_trace(),
+ * statistics of function evaluations are collected by kes_set_stats()
  */
-#define KES_ITER_DEBUG 1
 
 /******************************************************************************/
 
@@ -62,14 +48,4 @@
 
 /******************************************************************************/
 
-/*!
- * @brief debug a solver method
- * @details show remaining error values during iteration process
- */
-#define KES_DEBUG_SOL(NAME,ARG1,ARG2,ARG3)                                     \
-        printf("%s: Errors ... iter = %3d, Deltax = %e, Deltaf = %e\n",        \
-               NAME, (ARG1), (ARG2), (ARG3) )
-
-/******************************************************************************/
-
 #endif  /* KES_DEBUG__H */
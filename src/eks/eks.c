@@ -0,0 +1,355 @@
+/*******************************************************************************
+ * @file    eks.c
+ * @brief   solver method KES_SOL_EKS = enhanced Kepler solver
+ * @author  Bazso Akos
+ * @version 1.0, 14 Oct 2026
+ *
+ * @copyright
+ * Copyright (C) 2019 Bazso Akos
+ *
+ * This file is part of libkes.
+ *
+ * libkes is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * libkes is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with libkes.  If not, see <https://www.gnu.org/licenses/>.
+ *
+ ******************************************************************************/
+/* include standard headers */
+#include <math.h>
+
+/* include module headers */
+#include "eks.h"
+#include "const.h"
+#include "debug.h"
+#include "trace.h"
+#include "vecmath.h"
+
+/******************************************************************************/
+
+/* sin and cos of the nodes E_j = j * pi / KES_EKS_NSEG */
+static const double eks_node[KES_EKS_NSEG + 1][2] = {
+    {0.00000000000000000e+00,  1.00000000000000000e+00},
+    {2.58819045102520739e-01,  9.65925826289068312e-01},
+    {5.00000000000000000e-01,  8.66025403784438597e-01},
+    {7.07106781186547573e-01,  7.07106781186547573e-01},
+    {8.66025403784438597e-01,  5.00000000000000000e-01},
+    {9.65925826289068312e-01,  2.58819045102520739e-01},
+    {1.00000000000000000e+00,  0.00000000000000000e+00},
+    {9.65925826289068312e-01, -2.58819045102520739e-01},
+    {8.66025403784438597e-01, -5.00000000000000000e-01},
+    {7.07106781186547573e-01, -7.07106781186547573e-01},
+    {5.00000000000000000e-01, -8.66025403784438597e-01},
+    {2.58819045102520739e-01, -9.65925826289068312e-01},
+    {0.00000000000000000e+00, -1.00000000000000000e+00}
+};
+
+/******************************************************************************/
+
+/*******************************************************************************
+ *  FUNCTION    : eks_coef
+ *  DESCRIPTION : coefficients of the Taylor series of E(M) at a node by
+ *                reversion of the series M(E) = M_j + a1 * d + ... + a5 * d^5
+ *                with d = E - E_j
+ *  INPUT       : - eccentricity "ecc"
+ *                - index "j" of node
+ *                - array "coef" to return coefficients of orders 1 to 5
+ *  OUTPUT      : none
+ ******************************************************************************/
+static inline void eks_coef(
+    const double ecc,
+    const int    j,
+    double       coef[5]
+    )
+{
+    const double es = ecc * eks_node[j][0];
+    const double ec = ecc * eks_node[j][1];
+
+    /* derivatives of M(E) divided by factorials */
+    const double a1 = 1.0 - ec;
+    const double a2 = es / 2.0;
+    const double a3 = ec / 6.0;
+    const double a4 = -es / 24.0;
+    const double a5 = -ec / 120.0;
+
+    /* reversion of the series */
+    const double b1 = 1.0 / a1;
+    const double b2 = b1 * b1;
+    const double b3 = b2 * b1 * b2;
+    const double b4 = b3 * b2;
+    coef[0] = b1;
+    coef[1] = -a2 * b2 * b1;
+    coef[2] = (2.0 * a2 * a2 - a1 * a3) * b3;
+    coef[3] = (5.0 * a1 * a2 * a3 - a1 * a1 * a4 - 5.0 * a2 * a2 * a2) * b4;
+    coef[4] = (6.0 * a1 * a1 * a2 * a4 + 3.0 * a1 * a1 * a3 * a3 -
+               21.0 * a1 * a2 * a2 * a3 - a1 * a1 * a1 * a5 +
+               14.0 * a2 * a2 * a2 * a2) * b4 * b2;
+} // end eks_coef
+
+/******************************************************************************/
+
+/*******************************************************************************
+ *  FUNCTION    : eks_segment
+ *  DESCRIPTION : find segment j with M_j <= M < M_j+1
+ *  INPUT       : - mean anomalies "mnode" of the nodes
+ *                - reduced mean anomaly "ma" (0 <= ma <= pi)
+ *                - segment "guess" to test first (or -1)
+ *  OUTPUT      : index of segment (0 <= j < KES_EKS_NSEG)
+ ******************************************************************************/
+static inline int eks_segment(
+    const double* mnode,
+    const double  ma,
+    const int     guess
+    )
+{
+    /* check guess first, e.g. for sorted mean anomalies */
+    if ( (guess >= 0) && (mnode[guess] <= ma) && (ma < mnode[guess + 1]) )
+    {
+        return( guess );
+    } // end if
+
+    /* binary search of the nodes, without branches for random input */
+    int lo = 0;
+    for (int step = 8; step > 0; step /= 2)
+    {
+        const int mid = lo + step;
+        lo = (((mid < KES_EKS_NSEG) && (mnode[mid] <= ma)) ? mid : lo);
+    } // end for
+
+    return( lo );
+} // end eks_segment
+
+/******************************************************************************/
+
+/*******************************************************************************
+ *  FUNCTION    : eks_starter
+ *  DESCRIPTION : Taylor series of E(M) at the node closest to the mean
+ *                anomaly, cubic approximation near the singular corner
+ *  INPUT       : - eccentricity "ecc"
+ *                - reduced mean anomaly "ma" (0 <= ma <= pi)
+ *                - segment "j" of the mean anomaly
+ *                - mean anomalies "mnode" of the nodes
+ *                - coefficients "coef" of all nodes (or NULL)
+ *  OUTPUT      : starting value
+ ******************************************************************************/
+static inline double eks_starter(
+    const double  ecc,
+    const double  ma,
+    const int     j,
+    const double* mnode,
+    const double  (*coef)[5]
+    )
+{
+    /* singular corner: root of (1 - e) * E + e * E^3 / 6 = M, see S10 */
+    if ( (j == 0) && (ecc > 0.5) )
+    {
+        const double q = 2.0 * (1.0 - ecc) / ecc;
+        const double r = 3.0 * ma / ecc;
+        const double s = cbrt(sqrt(q*q*q + r*r) + r);
+        return( s - q / s );
+    } // end if
+
+    /* closest node */
+    const int    k = (((ma - mnode[j]) <= (mnode[j + 1] - ma)) ? j : j + 1);
+    const double u = ma - mnode[k];
+    double        tmp[5];
+    const double* c = ((coef != NULL) ? coef[k] : tmp);
+    if ( coef == NULL )
+    {
+        eks_coef( ecc, k, tmp );
+    } // end if
+
+    return( k * (M_PI / KES_EKS_NSEG) +
+            u * (c[0] + u * (c[1] + u * (c[2] + u * (c[3] + u * c[4])))) );
+} // end eks_starter
+
+/******************************************************************************/
+
+/*******************************************************************************
+ *  FUNCTION    : eks_iterate
+ *  DESCRIPTION : Halley steps without cancellation near the singular corner
+ *  INPUT       : - eccentricity "ecc"
+ *                - reduced mean anomaly "ma" (0 <= ma <= pi)
+ *                - "starter" value for first iteration
+ *                - "res" for results
+ *  OUTPUT      : number of iterations
+ ******************************************************************************/
+static inline int eks_iterate(
+    const double ecc,
+    const double ma,
+    const double starter,
+    kes_input_t* res
+    )
+{
+    register int count = 0;      /* iteration counter */
+    double       deltax, deltaf; /* error residuals */
+    double       sm, cm;         /* x - sin(x), 1 - cos(x) */
+    double       x = starter;    /* iteration variable */
+
+    /* correction factor for absolute error deltaf (precomputed if available) */
+    const double corr = ((res->terms != NULL) ?
+                         res->terms->corr : ecc / (1.0 - ecc));
+    const double e1   = 1.0 - ecc;
+
+    /* trace iteration process? */
+    const int trace = kes_trace_begin();
+    kes_trace_step( trace, KES_SOL_EKS, count, ecc, ma, x, 0.0, 0.0 );
+
+    /* main iteration loop */
+    do
+    {
+        /* NOTE x - e*sin(x) = (1-e)*x + e*(x-sin(x)) and
+         *      1 - e*cos(x) = (1-e) + e*(1-cos(x)) avoid cancellation
+         */
+        kes_vec_sincosm( &sm, &cm, x );
+        const double f0 = ma - e1 * x - ecc * sm;
+        const double f1 = e1 + ecc * cm;
+        const double f2 = ecc * (x - sm);
+        const double dn = f0 / f1;
+        const double dx = f0 / (f1 + 0.5 * dn * f2);
+        x += dx;
+        ++(res->nbrSinEval); ++(res->nbrCosEval); ++(res->nbrFktEval);
+
+        ++count;
+
+        /* update error residuals, deltax estimates the error after the
+         * step from the cubic convergence of Halley's method
+         */
+        deltax = fabs(dx * dx * dx) *
+                 (0.25 * f2 * f2 / (f1 * f1) + ecc / (6.0 * f1));
+        deltaf = fabs(f0) * corr;
+
+        kes_trace_step( trace, KES_SOL_EKS, count, ecc, ma, x, deltax, deltaf );
+    } while (
+        (deltax > res->tolx) &&
+        (deltaf > res->tolf) &&
+        (count  < res->maxiter)
+    ); // end do
+
+    /* results */
+    res->result = x;
+    res->errDF  = deltaf;
+    res->errDX  = deltax;
+
+    return( count );
+} // end eks_iterate
+
+/******************************************************************************/
+
+/*******************************************************************************
+ *  FUNCTION    : kes_eks_init
+ *  DESCRIPTION : build table of the enhanced Kepler solver
+ *  INPUT       : - eccentricity "ecc"
+ *                - pointer "terms" to constants of this eccentricity
+ *  OUTPUT      : none
+ ******************************************************************************/
+void kes_eks_init(
+    const double ecc,
+    kes_terms_t* terms
+    )
+{
+    for (int j = 0; j <= KES_EKS_NSEG; j++)
+    {
+        terms->ek_ma[j] = j * (M_PI / KES_EKS_NSEG) - ecc * eks_node[j][0];
+        eks_coef( ecc, j, terms->ek_coef[j] );
+    } // end for
+    terms->ek_init = 1;
+} // end kes_eks_init
+
+/******************************************************************************/
+
+/*******************************************************************************
+ *  FUNCTION    : eks
+ *  DESCRIPTION : enhanced Kepler solver = segmented Taylor series of E(M)
+ *                plus Halley steps
+ *  INPUT       : - eccentricity "ecc"
+ *                - mean anomaly "ma" in radians
+ *                - "starter" value for first iteration
+ *                - "res" for results
+ *  OUTPUT      : number of iterations
+ ******************************************************************************/
+int eks(
+    const double ecc,
+    const double ma,
+    const double starter,
+    kes_input_t* res
+    )
+{
+    double mnode[KES_EKS_NSEG + 1]; /* mean anomalies of nodes */
+
+    /* reset error residuals */
+    res->nbrSinEval = res->nbrCosEval = res->nbrFktEval = 0;
+
+    /* NOTE given starter is overridden by the Taylor series */
+    (void)starter;
+
+    /* table of the eccentricity, or mean anomalies of the nodes only */
+    const kes_terms_t* terms = (((res->terms != NULL) &&
+                                 res->terms->ek_init) ? res->terms : NULL);
+    if ( terms == NULL )
+    {
+        for (int j = 0; j <= KES_EKS_NSEG; j++)
+        {
+            mnode[j] = j * (M_PI / KES_EKS_NSEG) - ecc * eks_node[j][0];
+        } // end for
+    } // end if
+    const double* mn = ((terms != NULL) ? terms->ek_ma : mnode);
+
+    const int    j  = eks_segment( mn, ma, -1 );
+    const double x0 = eks_starter( ecc, ma, j, mn,
+                                   ((terms != NULL) ? terms->ek_coef : NULL) );
+
+    return( eks_iterate( ecc, ma, x0, res ) );
+} // end eks
+
+/******************************************************************************/
+
+/*******************************************************************************
+ *  FUNCTION    : kes_eks_batch
+ *  DESCRIPTION : solve elliptic Kepler Equation for an array with a table
+ *  INPUT       : - pointer "terms" to constants from kes_eks_init()
+ *                - eccentricity "ecc"
+ *                - number of elements "n"
+ *                - reduced mean anomalies "redma" (0 <= redma <= pi)
+ *                - eccentric anomalies "ea" (in radians)
+ *                - "res" for parameters and results
+ *  OUTPUT      : none
+ ******************************************************************************/
+void kes_eks_batch(
+    const kes_terms_t* terms,
+    const double       ecc,
+    const size_t       n,
+    const double*      redma,
+    double*            ea,
+    kes_input_t*       res
+    )
+{
+    int j     = -1; /* segment of previous element */
+    int itmax = 0;  /* max. number of iterations */
+
+    res->nbrSinEval = res->nbrCosEval = res->nbrFktEval = 0;
+
+    for (size_t i = 0; i < n; i++)
+    {
+        j = eks_segment( terms->ek_ma, redma[i], j );
+
+        const double x0 = eks_starter( ecc, redma[i], j, terms->ek_ma,
+                                       terms->ek_coef );
+        const int    it = eks_iterate( ecc, redma[i], x0, res );
+
+        ea[i] = res->result;
+        itmax = ((it > itmax) ? it : itmax);
+    } // end for
+
+    res->iterations = itmax;
+} // end kes_eks_batch
+
+/******************************************************************************/
@@ -0,0 +1,110 @@
+/***************************************************************************//**
+ * @file    eks.h
+ * @brief   enhanced Kepler solver (segmented Taylor series of E(M))
+ * @details after description in:
+ * Raposo-Pulido & Pelaez (2017), Mon. Not. R. Astron. Soc. 467, p.1702-1713
+ * @author  Bazso Akos
+ *
+ * @copyright
+ * Copyright (C) 2019 Bazso Akos
+ *
+ * This file is part of libkes.
+ *
+ * libkes is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * libkes is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with libkes.  If not, see <https://www.gnu.org/licenses/>.
+ *
+ ******************************************************************************/
+#pragma once
+#ifndef KES_SOL_EKS__H
+#define KES_SOL_EKS__H
+
+/* include standard headers */
+#include <stddef.h>
+
+/* include module headers */
+#include "input.h"
+
+/******************************************************************************/
+
+/*** function declarations ***/
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/*!
+ * @brief build the table of the enhanced Kepler solver for one eccentricity
+ * @details nodes E_j = j * pi / KES_EKS_NSEG (j = 0, ..., KES_EKS_NSEG) with
+ * mean anomalies M_j and the coefficients of the inverse Taylor series
+ * E(M) = E_j + sum_k c_k * (M - M_j)^k up to order 5, from tabulated sin
+ * and cos of the nodes, i.e. without any transcendental function call
+ * @param[in] ecc eccentricity (0 <= ecc < 1)
+ * @param[out] terms pointer to constants of this eccentricity
+ */
+void kes_eks_init(
+    const double ecc,
+    kes_terms_t* terms
+);
+
+
+/*!
+ * @brief iteration function for the enhanced Kepler solver
+ * @details the starter is the Taylor series at the node closest to
+ * \a ma, in the first segment for ecc > 0.5 the root of the cubic
+ * approximation near the singular corner is used instead; Halley steps
+ * follow until the estimated error is below the tolerance; uses the
+ * table of the eccentricity in \a res if available, see kes_eks_init(),
+ * otherwise the coefficients of the one node needed are computed
+ * @param[in] ecc eccentricity
+ * @param[in] ma reduced mean anomaly (0 <= ma <= pi)
+ * @param[in] starter starting value for first iteration (ignored)
+ * @param[out] res iteration results and statistics
+ * @return number of iterations
+ */
+int eks(
+    const double ecc,
+    const double ma,
+    const double starter,
+    kes_input_t* res
+);
+
+
+/*!
+ * @brief solve the elliptic Kepler Equation for an array with a table
+ * @details same results as eks() for each element; for sorted mean
+ * anomalies the search of the segment starts at the one of the previous
+ * element, otherwise by bisection of the nodes
+ * @param[in] terms pointer to constants from kes_eks_init()
+ * @param[in] ecc eccentricity of the table
+ * @param[in] n number of elements
+ * @param[in] redma reduced mean anomalies (0 <= redma <= pi)
+ * @param[out] ea eccentric anomalies (in radians)
+ * @param[in,out] res iteration parameters, returns results of the last
+ * element and the max. number of iterations
+ */
+void kes_eks_batch(
+    const kes_terms_t* terms,
+    const double       ecc,
+    const size_t       n,
+    const double*      redma,
+    double*            ea,
+    kes_input_t*       res
+);
+
+#ifdef __cplusplus
+}
+#endif
+
+/******************************************************************************/
+
+#endif  /* KES_SOL_EKS__H */
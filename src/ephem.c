@@ -0,0 +1,226 @@
+/***************************************************************************//**
+ * @file    ephem.c
+ * @brief   ephemeris engine for many orbits on a common time grid
+ * @details the K x T matrix of solutions is cut into tiles of orbits by
+ *          epochs; the work items of the thread pool are orbit tiles over
+ *          a span of epochs, in orbit-major order
+ * @author  Bazso Akos
+ * @version 2026.10
+ *
+ * @copyright
+ * Copyright (C) 2019 Bazso Akos
+ *
+ * This file is part of libkes.
+ *
+ * libkes is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * libkes is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with libkes.  If not, see <https://www.gnu.org/licenses/>.
+ *
+ ******************************************************************************/
+
+/* include module headers */
+#include "ephem.h"
+#include "pool.h"
+
+/******************************************************************************/
+
+/* arguments of kes_ephem_run(), shared by the tasks of the thread pool */
+typedef struct
+{
+    size_t             norb;    ///< number of orbits
+    const double*      ecc;     ///< eccentricities
+    const double*      ma0;     ///< mean anomalies at t = 0
+    const double*      nmot;    ///< mean motions
+    size_t             ntime;   ///< number of epochs
+    const double*      t;       ///< epochs
+    double*            ea;      ///< matrix of solutions
+    size_t             ldea;    ///< leading dimension of ea and status
+    kes_stm_e          init;    ///< starter method
+    kes_sol_e          iter;    ///< solver method
+    const kes_input_t* data;    ///< input parameters (or NULL)
+    kes_err_e*         status;  ///< matrix of error codes (or NULL)
+    size_t             nspan;   ///< number of spans of KES_EPHEM_SPAN epochs
+} kes_ephem_t;
+
+/******************************************************************************/
+
+/*******************************************************************************
+ *  FUNCTION    : kes_ephem_tile
+ *  DESCRIPTION : solve one row of a tile; if it fails and error codes are
+ *                requested, the elements are solved one by one again
+ *  INPUT       : - pointer "plan" of the orbit
+ *                - mean anomalies "ma" of the tile
+ *                - solutions "ea" and error codes "status" (or NULL)
+ *                - number of epochs "m"
+ *  OUTPUT      : error code of the first failing element, or KES_ERR_NOERR
+ ******************************************************************************/
+static kes_err_e kes_ephem_tile(
+    const kes_plan_t* plan,
+    const double*     ma,
+    double*           ea,
+    kes_err_e*        status,
+    const size_t      m
+    )
+{
+    const kes_err_e err = kes_plan_solve_sweep( plan, ma, ea, m );
+
+    if ( status != NULL )
+    {
+        if ( err == KES_ERR_NOERR )
+        {
+            for (size_t j = 0; j < m; j++)
+            {
+                status[j] = KES_ERR_NOERR;
+            } // end for
+        }
+        else
+        {
+            /* rare case: same solutions as kes_plan_solve_batch() */
+            for (size_t j = 0; j < m; j++)
+            {
+                ea[j] = kes_plan_solve( plan, ma[j], &status[j] );
+            } // end for
+        } // end if
+    } // end if
+
+    return( err );
+} // end kes_ephem_tile
+
+/******************************************************************************/
+
+/*******************************************************************************
+ *  FUNCTION    : kes_ephem_task
+ *  DESCRIPTION : solve work items of kes_ephem_run(), i.e. orbit tiles over
+ *                a span of epochs, tile by tile
+ *  INPUT       : pointer "arg" to structure of type kes_ephem_t, first work
+ *                item "i0" and number of work items "cnt"
+ *  OUTPUT      : error code of the first failing tile, or KES_ERR_NOERR
+ ******************************************************************************/
+static kes_err_e kes_ephem_task(
+    void*        arg,
+    const size_t i0,
+    const size_t cnt
+    )
+{
+    const kes_ephem_t* e = (const kes_ephem_t*)arg;
+
+    kes_plan_t plan[KES_EPHEM_ORBITS];   /* plans of the orbit tile */
+    double     ma[KES_EPHEM_EPOCHS];     /* mean anomalies of one row */
+    kes_err_e  res = KES_ERR_NOERR;
+
+    for (size_t w = i0; w < i0 + cnt; w++)
+    {
+        /* orbits and epochs of the work item */
+        const size_t k0   = (w / e->nspan) * KES_EPHEM_ORBITS;
+        const size_t kn   = ((e->norb - k0 > KES_EPHEM_ORBITS) ?
+                             KES_EPHEM_ORBITS : e->norb - k0);
+        const size_t j0   = (w % e->nspan) * KES_EPHEM_SPAN;
+        const size_t jend = ((e->ntime - j0 > KES_EPHEM_SPAN) ?
+                             j0 + KES_EPHEM_SPAN : e->ntime);
+
+        /* constants of the orbits, NOTE errors are kept in the plans */
+        for (size_t k = 0; k < kn; k++)
+        {
+            kes_plan_init( &plan[k], e->ecc[k0 + k], e->init, e->iter,
+                           e->data );
+        } // end for
+
+        /* time tiles, the epochs of a tile are reused by all its orbits */
+        for (size_t j1 = j0; j1 < jend; j1 += KES_EPHEM_EPOCHS)
+        {
+            const size_t m = ((jend - j1 > KES_EPHEM_EPOCHS) ?
+                              KES_EPHEM_EPOCHS : jend - j1);
+
+            for (size_t k = 0; k < kn; k++)
+            {
+                const double a   = e->ma0[k0 + k];
+                const double b   = e->nmot[k0 + k];
+                const size_t off = (k0 + k) * e->ldea + j1;
+                for (size_t j = 0; j < m; j++)
+                {
+                    ma[j] = a + b * e->t[j1 + j];
+                } // end for
+
+                const kes_err_e err = kes_ephem_tile(
+                    &plan[k], ma, e->ea + off,
+                    ((e->status != NULL) ? e->status + off : NULL), m
+                );
+                if ( (err != KES_ERR_NOERR) && (res == KES_ERR_NOERR) )
+                {
+                    res = err;
+                } // end if
+            } // end for
+        } // end for
+    } // end for
+
+    return( res );
+} // end kes_ephem_task
+
+/******************************************************************************/
+
+/*******************************************************************************
+ *  FUNCTION    : kes_ephem_run
+ *  DESCRIPTION : solve Kepler Equation for many orbits on a common time grid
+ *  INPUT       : - number of orbits "norb"
+ *                - arrays of eccentricities "ecc", mean anomalies at t = 0
+ *                  "ma0" and mean motions "nmot" of the orbits
+ *                - number of epochs "ntime" and array of epochs "t"
+ *                - matrix of solutions "ea" with leading dimension "ldea"
+ *                - starter method "init" from kes_stm_e
+ *                - solver method "iter" from kes_sol_e
+ *                - pointer to input parameters "data" (or NULL)
+ *                - optional matrix of per-element error codes "status"
+ *  OUTPUT      : KES_ERR_NOERR if all elements were solved successfully,
+ *                otherwise error code of the first failing tile
+ ******************************************************************************/
+kes_err_e kes_ephem_run(
+    const size_t       norb,
+    const double*      ecc,
+    const double*      ma0,
+    const double*      nmot,
+    const size_t       ntime,
+    const double*      t,
+    double*            ea,
+    const size_t       ldea,
+    const kes_stm_e    init,
+    const kes_sol_e    iter,
+    const kes_input_t* data,
+    kes_err_e*         status
+    )
+{
+    /* nothing to do for empty grids */
+    if ( (norb == 0) || (ntime == 0) )
+    {
+        return( KES_ERR_NOERR );
+    } // end if
+
+    /* exception: missing arrays or overlapping rows */
+    if ( (ecc == NULL) || (ma0 == NULL) || (nmot == NULL) || (t == NULL) ||
+         (ea == NULL) || (ldea < ntime) )
+    {
+        return( KES_ERR_BADVAL );
+    } // end if
+
+    const kes_ephem_t e = {
+        .norb = norb, .ecc = ecc, .ma0 = ma0, .nmot = nmot,
+        .ntime = ntime, .t = t, .ea = ea, .ldea = ldea,
+        .init = init, .iter = iter, .data = data, .status = status,
+        .nspan = (ntime + KES_EPHEM_SPAN - 1) / KES_EPHEM_SPAN
+    };
+
+    /* work items in orbit-major order */
+    const size_t ntile = (norb + KES_EPHEM_ORBITS - 1) / KES_EPHEM_ORBITS;
+
+    return( kes_pool_run( ntile * e.nspan, kes_ephem_task, (void*)&e ) );
+} // end kes_ephem_run
+
+/******************************************************************************/
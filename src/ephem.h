@@ -0,0 +1,112 @@
+/***************************************************************************//**
+ * @file    ephem.h
+ * @brief   ephemeris engine for many orbits on a common time grid
+ * @author  Bazso Akos
+ * @version 2026.10
+ *
+ * @copyright
+ * Copyright (C) 2019 Bazso Akos
+ *
+ * This file is part of libkes.
+ *
+ * libkes is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * libkes is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with libkes.  If not, see <https://www.gnu.org/licenses/>.
+ *
+ ******************************************************************************/
+#pragma once
+#ifndef KES_EPHEM__H
+#define KES_EPHEM__H
+
+/* include standard headers */
+#include <stddef.h>
+
+/* include module headers */
+#include "error.h"
+#include "input.h"
+#include "solver.h"
+#include "starter.h"
+
+/******************************************************************************/
+
+/*** declare macro constants ***/
+
+/* orbits and epochs of one tile of kes_ephem_run(), i.e. the epochs
+ * of a tile stay in the L1 cache and its solutions in the L2 cache
+ */
+#define KES_EPHEM_ORBITS 16
+#define KES_EPHEM_EPOCHS 256
+
+/* epochs of one work item of the thread pool, a multiple of KES_EPHEM_EPOCHS,
+ * i.e. the plans of an orbit tile are reused for 16 time tiles
+ */
+#define KES_EPHEM_SPAN   4096
+
+/******************************************************************************/
+
+/*** function declarations ***/
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/*!
+ * @brief solve Kepler Equation for many orbits on a common time grid
+ * @details computes the matrix of eccentric anomalies E(k,j) of orbit k at
+ * epoch t(j) from the mean anomalies M = ma0(k) + nmot(k) * t(j); the work
+ * is split into tiles of KES_EPHEM_ORBITS orbits by KES_EPHEM_EPOCHS epochs:
+ * every orbit gets a solver plan per work item of KES_EPHEM_SPAN epochs,
+ * i.e. the eccentricity-dependent constants are computed once, and each row
+ * of a tile is solved by kes_plan_solve_sweep(), which starts from the
+ * previous solutions along sorted time grids; the work items are solved in
+ * parallel by the thread pool, see kes_set_threads(); results agree with
+ * kesolver() to the tolerances of \a data
+ * @param[in] norb number of orbits K
+ * @param[in] ecc array of K eccentricities
+ * @param[in] ma0 array of K mean anomalies at t = 0 (in radians)
+ * @param[in] nmot array of K mean motions (in radians per unit of time)
+ * @param[in] ntime number of epochs T
+ * @param[in] t array of T epochs, preferably sorted
+ * @param[out] ea matrix of solutions in row-major order, E(k,j) at
+ * ea[k * ldea + j] (in radians)
+ * @param[in] ldea leading dimension of \a ea (ldea >= ntime)
+ * @param[in] init method for starting value from enum #kes_stm_e
+ * @param[in] iter method for iterative solver from enum #kes_sol_e
+ * @param[in] data pointer to input parameters (or NULL)
+ * @param[out] status optional matrix of per-element error codes with the
+ * layout of \a ea (or NULL)
+ * @return error code from enum #kes_err_e;
+ * KES_ERR_NOERR if all elements were solved, else code of the first failing
+ * tile, KES_ERR_BADVAL for missing arrays or ldea < ntime
+ */
+kes_err_e kes_ephem_run(
+    const size_t       norb,
+    const double*      ecc,
+    const double*      ma0,
+    const double*      nmot,
+    const size_t       ntime,
+    const double*      t,
+    double*            ea,
+    const size_t       ldea,
+    const kes_stm_e    init,
+    const kes_sol_e    iter,
+    const kes_input_t* data,
+    kes_err_e*         status
+);
+
+#ifdef __cplusplus
+}
+#endif
+
+/******************************************************************************/
+
+#endif  /* KES_EPHEM__H */
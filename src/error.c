@@ -54,7 +54,9 @@ static const kes_error_list_t list_of_errors[KES_ERR_TOTAL] = {
     {KES_ERR_BADVAL, "bad value for parameter (INF or NaN) in kes_check_val()"},
     {KES_ERR_BADSTM, "bad starter method in kes_starter()"},
     {KES_ERR_BADSOL, "bad solver method in kesolver()"},
-    {KES_ERR_BADTOL, "bad value for error tolerance"}
+    {KES_ERR_BADTOL, "bad value for error tolerance"},
+    {KES_ERR_BADFILE, "bad or outdated table file in kes_table_load()"},
+    {KES_ERR_NOMEM,  "out of memory in allocator or workspace"}
 };
 
 /******************************************************************************/
@@ -47,6 +47,8 @@ typedef enum
     KES_ERR_BADSTM,    ///< bad starter method in kes_starter()
     KES_ERR_BADSOL,    ///< bad solver method in kesolver()
     KES_ERR_BADTOL,    ///< bad value for error tolerance
+    KES_ERR_BADFILE,   ///< bad or outdated table file in kes_table_load()
+    KES_ERR_NOMEM,     ///< out of memory in allocator or workspace
 
     KES_ERR_TOTAL      ///< total number of error entries
 } kes_err_e;
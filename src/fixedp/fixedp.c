@@ -30,6 +30,7 @@
 /* include module headers */
 #include "fixedp.h"
 #include "debug.h"
+#include "trace.h"
 #include "kepeq.h"
 
 /******************************************************************************/
@@ -54,18 +55,17 @@ int fixedp(
     double       deltax, deltaf; /* error residuals */
     double       x, xsave, fx;   /* new and old approximation, f(x) */
 
-    /* correction factor for absolute error deltaf */
-    const double corr = ecc / (1.0 - ecc);
+    /* correction factor for absolute error deltaf (precomputed if available) */
+    const double corr = ((res->terms != NULL) ?
+                         res->terms->corr : ecc / (1.0 - ecc));
 
     /* reset error residuals */
     deltax = deltaf = 0.0;
-#if KES_SHOW_ITER_STATS
     res->nbrSinEval = res->nbrCosEval = res->nbrFktEval = 0;
-#endif
 
-#if KES_ITER_DEBUG
-    KES_DEBUG_STM("fixedp", ecc, ma, starter);
-#endif
+    /* trace iteration process? */
+    const int trace = kes_trace_begin();
+    kes_trace_step( trace, KES_SOL_FIXEDP, 0, ecc, ma, starter, 0.0, 0.0 );
 
     /* use starter for initializing iteration */
     x = starter;
@@ -80,9 +80,7 @@ int fixedp(
 
         /* function value at new point */
         fx = kes_keq_ell( ecc, ma, x );
-#if KES_SHOW_ITER_STATS
         ++(res->nbrSinEval); ++(res->nbrFktEval);
-#endif
 
         ++count;
 
@@ -92,9 +90,8 @@ int fixedp(
         deltax = fabs(x - xsave);
         deltaf = fabs(fx) * corr;
 
-#if KES_ITER_DEBUG
-    KES_DEBUG_SOL("fixedp", count, deltax, deltaf);
-#endif
+        kes_trace_step( trace, KES_SOL_FIXEDP, count, ecc, ma,
+                        x, deltax, deltaf );
     } while (
         (deltaf > res->tolf) &&
         (count  < res->maxiter)
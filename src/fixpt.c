@@ -0,0 +1,245 @@
+/***************************************************************************//**
+ * @file    fixpt.c
+ * @brief   fixed-point solver for processors without floating-point unit
+ * @author  Bazso Akos
+ * @version 2026.10
+ *
+ * @copyright
+ * Copyright (C) 2019 Bazso Akos
+ *
+ * This file is part of libkes.
+ *
+ * libkes is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * libkes is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with libkes.  If not, see <https://www.gnu.org/licenses/>.
+ *
+ ******************************************************************************/
+
+/* include standard headers */
+#include <stddef.h>
+#include <stdint.h>
+
+/* include module headers */
+#include "fixpt.h"
+
+/******************************************************************************/
+
+/* sin(j*pi/128) for j = 0, ..., 64 in format Q2.30, rounded to nearest */
+static const kes_q30_t sintab[65] =
+{
+             0,   26350943,   52686014,   78989349,  105245103,  131437462,
+     157550647,  183568930,  209476638,  235258165,  260897982,  286380643,
+     311690799,  336813204,  361732726,  386434353,  410903207,  435124548,
+     459083786,  482766489,  506158392,  529245404,  552013618,  574449320,
+     596538995,  618269338,  639627258,  660599890,  681174602,  701339000,
+     721080937,  740388522,  759250125,  777654384,  795590213,  813046808,
+     830013654,  846480531,  862437520,  877875009,  892783698,  907154608,
+     920979082,  934248793,  946955747,  959092290,  970651112,  981625251,
+     992008094, 1001793390, 1010975242, 1019548121, 1027506862, 1034846671,
+    1041563127, 1047652185, 1053110176, 1057933813, 1062120190, 1065666786,
+    1068571464, 1070832474, 1072448455, 1073418433, 1073741824
+};
+
+/* pi in format Q3.29, i.e. radians per binary angle unit in Q31 */
+static const int64_t pi_q29 = 1686629713;
+
+/* 2/pi in format Q1.31, i.e. binary angle units per radian in Q30 */
+static const int64_t twobypi_q31 = 1367130551;
+
+/* 2*pi in format Q4.28 */
+static const int64_t twopi_q28 = 1686629713;
+
+/* fixed number of Halley steps: upper limits of eccentricity in Q2.30 and
+ * steps up to them, worst case on a dense grid in (ecc,ma) of reaching the
+ * residual of 4E-9 radians left by the resolution of kes_sincos_fix()
+ */
+static const kes_q30_t fix_ecc[] =
+{
+    1020054733, 1068373115, 1073204953, 1073634450, 1073731087, 1073740750
+};
+static const int       fix_iter[] = { 3, 4, 5, 6, 7, 8, 10 };
+
+/******************************************************************************/
+
+/*******************************************************************************
+ *  FUNCTION    : kes_sincos_fix
+ *  DESCRIPTION : sine and cosine of a binary angle in fixed point
+ *  INPUT       : - angle x (binary angle)
+ *                - pointers to sin(x), cos(x) in format Q2.30
+ *  OUTPUT      : none
+ *  REFERENCE   : x = k*pi/128 + d with |d| <= pi/256, sin/cos of k*pi/128
+ *                from the table in a quarter turn and of d from the Taylor
+ *                series d - d^3/6 and 1 - d^2/2 + d^4/24 in format Q1.31
+ ******************************************************************************/
+void kes_sincos_fix(
+    const kes_bam_t x,
+    kes_q30_t*      s,
+    kes_q30_t*      c
+    )
+{
+    /* nearest node k*pi/128 and offset d in binary angle units */
+    const uint32_t k = ((x + (UINT32_C(1) << 23)) >> 24) & 255u;
+    const int32_t  d = (int32_t)(x - (k << 24));
+    const uint32_t j = k & 63u;
+
+    /* sin/cos of node from table, rotated by the quadrant */
+    int64_t sk = sintab[j];
+    int64_t ck = sintab[64u - j];
+    int64_t tmp;
+    switch ( k >> 6 )
+    {
+        case 1u:
+            tmp = sk; sk = ck; ck = -tmp;
+            break;
+        case 2u:
+            sk = -sk; ck = -ck;
+            break;
+        case 3u:
+            tmp = sk; sk = -ck; ck = tmp;
+            break;
+        default:
+            break;
+    } // end switch
+
+    /* sin/cos of offset in format Q1.31, |d| < 0.0123 */
+    const int64_t one = INT64_C(1) << 31;
+    const int64_t r   = ( (int64_t)d * pi_q29 ) >> 29;
+    const int64_t r2  = ( r * r ) >> 31;
+    const int64_t r3  = ( r2 * r ) >> 31;
+    const int64_t sd  = r - r3 / 6;
+    const int64_t cd  = one - r2 / 2 + ( ( r2 * r2 ) >> 31 ) / 24;
+
+    /* angle addition theorem, rounded to format Q2.30 */
+    const int64_t half = INT64_C(1) << 30;
+    *s = (kes_q30_t)( ( sk * cd + ck * sd + half ) >> 31 );
+    *c = (kes_q30_t)( ( ck * cd - sk * sd + half ) >> 31 );
+
+    return;
+} // end kes_sincos_fix
+
+/******************************************************************************/
+
+/*******************************************************************************
+ *  FUNCTION    : kesolver_fix
+ *  DESCRIPTION : fixed-point solver for the elliptic Kepler Equation
+ *  INPUT       : - eccentricity in format Q2.30
+ *                - mean anomaly (binary angle)
+ *                - pointer to error code
+ *  OUTPUT      : eccentric anomaly (binary angle)
+ *  REFERENCE   : Halley's method on f(E) = E - e*sin(E) - M in binary angle
+ *                units, i.e. E_{n+1} = E_n - f*f' / (f'^2 - f*f''/2) with
+ *                f' = 1 - e*cos(E) and f'' = e*sin(E), from the minimum of the
+ *                upper bounds M/(1-e), M+e, (M+e*pi)/(1+e) for 0 <= M <= pi
+ ******************************************************************************/
+kes_bam_t kesolver_fix(
+    const kes_q30_t ecc,
+    const kes_bam_t ma,
+    kes_err_e*      status
+    )
+{
+    /* only elliptic orbits */
+    if ( ecc < 0 || ecc >= KES_Q30_ONE )
+    {
+        *status = KES_ERR_BADECC;
+        return ma;
+    } // end if
+    *status = KES_ERR_NOERR;
+
+    /* reduce to 0 <= M <= pi by the symmetry E(2*pi-M) = 2*pi-E(M) */
+    const uint32_t halfturn = UINT32_C(1) << 31;
+    const int      side     = ( ma > halfturn );
+    const uint32_t m        = side ? (uint32_t)( 0u - ma ) : ma;
+
+    /* starter as minimum of upper bounds S4, S6 and S7,
+     * e in binary angle units is e * 2/pi, e*pi is 2*e
+     */
+    const int64_t one = KES_Q30_ONE;
+    const int64_t eb  = ( (int64_t)ecc * twobypi_q31 ) >> 31;
+    int64_t       ea  = (int64_t)m + eb;
+    int64_t       bnd = ( ( (int64_t)m + 2 * (int64_t)ecc ) << 30 ) /
+                        ( one + ecc );
+    if ( bnd < ea ) ea = bnd;
+    bnd = ( (int64_t)m << 30 ) / ( one - ecc );
+    if ( bnd < ea ) ea = bnd;
+
+    /* fixed number of iterations */
+    int niter = 0;
+    while ( niter < 6 && ecc > fix_ecc[niter] )
+    {
+        niter++;
+    } // end while
+    niter = fix_iter[niter];
+
+    for ( int i = 0; i < niter; i++ )
+    {
+        kes_q30_t sx, cx;
+        kes_sincos_fix( (kes_bam_t)ea, &sx, &cx );
+
+        /* e*sin(E), 1 - e*cos(E) in format Q2.30 and residual f in binary
+         * angle units
+         */
+        const int64_t es = ( (int64_t)ecc * sx ) >> 30;
+        const int64_t f1 = one - ( ( (int64_t)ecc * cx ) >> 30 );
+        const int64_t f  = ( ea - (int64_t)m ) - ( ( es * twobypi_q31 ) >> 31 );
+
+        /* Halley denominator f1 - f*f2/(2*f1) in format Q2.30, f*f2 in
+         * radians from the binary angle by 2*pi/2^32, bounded below by f1/2
+         */
+        const int64_t ff2 = ( ( ( f * es ) >> 32 ) * twopi_q28 ) >> 28;
+        int64_t       den = f1 - ff2 * ( INT64_C(1) << 29 ) / f1;
+        if ( den < f1 / 2 ) den = f1 / 2;
+        if ( den < 1 ) den = 1;
+
+        /* step, E stays within [M:pi] */
+        ea -= f * one / den;
+        if ( ea < (int64_t)m ) ea = m;
+        if ( ea > (int64_t)halfturn ) ea = halfturn;
+    } // end for
+
+    return side ? (kes_bam_t)( 0u - (uint32_t)ea ) : (kes_bam_t)ea;
+} // end kesolver_fix
+
+/******************************************************************************/
+
+/*******************************************************************************
+ *  FUNCTION    : kesolver_fix_batch
+ *  DESCRIPTION : fixed-point solver for an array of elements
+ *  INPUT       : - number of elements
+ *                - array of eccentricities in format Q2.30 and stride
+ *                - array of mean anomalies (binary angles)
+ *                - array of eccentric anomalies (binary angles)
+ *  OUTPUT      : error code of first failure
+ ******************************************************************************/
+kes_err_e kesolver_fix_batch(
+    const size_t     n,
+    const kes_q30_t* ecc,
+    const size_t     incecc,
+    const kes_bam_t* ma,
+    kes_bam_t*       ea
+    )
+{
+    kes_err_e first = KES_ERR_NOERR;
+
+    for ( size_t i = 0; i < n; i++ )
+    {
+        kes_err_e err;
+        ea[i] = kesolver_fix( ecc[i * incecc], ma[i], &err );
+        if ( err != KES_ERR_NOERR && first == KES_ERR_NOERR )
+        {
+            first = err;
+        } // end if
+    } // end for
+
+    return first;
+} // end kesolver_fix_batch
+
+/******************************************************************************/
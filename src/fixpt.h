@@ -0,0 +1,143 @@
+/***************************************************************************//**
+ * @file    fixpt.h
+ * @brief   fixed-point solver for processors without floating-point unit
+ * @author  Bazso Akos
+ * @version 2026.10
+ *
+ * @copyright
+ * Copyright (C) 2019 Bazso Akos
+ *
+ * This file is part of libkes.
+ *
+ * libkes is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * libkes is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with libkes.  If not, see <https://www.gnu.org/licenses/>.
+ *
+ ******************************************************************************/
+#pragma once
+#ifndef KES_FIXPT__H
+#define KES_FIXPT__H
+
+/* include standard headers */
+#include <stddef.h>
+#include <stdint.h>
+
+/* include module headers */
+#include "error.h"
+
+/******************************************************************************/
+
+/*** declare data structures ***/
+
+/*!
+ * @brief fixed-point number in format Q2.30, i.e. value * 2^30 in 32 bits
+ * (range -2 <= x < 2, resolution 9.3E-10)
+ */
+typedef int32_t kes_q30_t;
+
+/*!
+ * @brief binary angle, i.e. 2^32 units per full turn (resolution 1.5E-9
+ * radians); reduction of angles to one turn is the wraparound of the
+ * unsigned type
+ */
+typedef uint32_t kes_bam_t;
+
+/******************************************************************************/
+
+/*** declare macro constants ***/
+
+/* value 1 in format Q2.30 */
+#define KES_Q30_ONE     ((kes_q30_t)1 << 30)
+
+/* conversions from and to double for hosts and constants (rounded to the
+ * nearest, halfway cases away from zero), NOTE not for code on targets
+ * without floating-point unit
+ */
+#define KES_Q30_FROM(x)   ((kes_q30_t)(((x) >= 0.0) ? \
+                                       (x) * 1073741824.0 + 0.5 : \
+                                       (x) * 1073741824.0 - 0.5))
+#define KES_BAM_FROM(x)   ((kes_bam_t)(int64_t)((x) * 683565275.57643159))
+#define KES_BAM_TO(a)     ((double)(a) * 1.4629180792671596E-09)
+
+/******************************************************************************/
+
+/*** function declarations ***/
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/*!
+ * @brief sine and cosine of a binary angle in fixed point
+ * @details table of sin(x) at multiples of pi/128 in a quarter turn, and the
+ * angle addition theorem with the Taylor series of the offset of at most
+ * pi/256, i.e. integer multiplications only; error below 3E-9
+ * @param[in] x angle (binary angle, 2^32 per turn)
+ * @param[out] s pointer to return sin(x) in format Q2.30
+ * @param[out] c pointer to return cos(x) in format Q2.30
+ */
+void kes_sincos_fix(
+    const kes_bam_t x,
+    kes_q30_t*      s,
+    kes_q30_t*      c
+);
+
+/*!
+ * @brief fixed-point solver for the elliptic Kepler Equation
+ * @details the same approach as kesolver() with 32-bit integers only: the
+ * mean anomaly is reduced by the wraparound of the binary angle and by the
+ * symmetry about pi, the starter is the minimum of the upper bounds
+ * M/(1-e), M+e and (M+e*pi)/(1+e) (starters S4, S6, S7) and a fixed number
+ * of Halley steps (3 for e <= 0.95 up to 10 for e > 0.999999) is taken with
+ * kes_sincos_fix(), i.e. the run time and the result are the same on all
+ * targets; products of 32-bit numbers are formed in 64 bits and a step takes
+ * two 64-bit divisions;
+ * the error in E is about 4E-9 radians divided by 1 - e*cos(E)
+ * @param[in] ecc eccentricity in format Q2.30 (0 <= ecc < 1)
+ * @param[in] ma mean anomaly (binary angle)
+ * @param[out] status pointer to return error code from enum #kes_err_e,
+ * KES_ERR_BADECC for eccentricities outside of the elliptic range
+ * @return solution to Kepler Equation (binary angle), ma for errors
+ */
+kes_bam_t kesolver_fix(
+    const kes_q30_t ecc,
+    const kes_bam_t ma,
+    kes_err_e*      status
+);
+
+/*!
+ * @brief fixed-point solver for an array of elements
+ * @details same results as kesolver_fix() for each element
+ * @param[in] n number of elements
+ * @param[in] ecc array of eccentricities in format Q2.30
+ * @param[in] incecc stride of array \a ecc;
+ * use 0 for a single eccentricity common to all elements, 1 for an array
+ * @param[in] ma array of mean anomalies (binary angles)
+ * @param[out] ea array of solutions to Kepler Equation (binary angles)
+ * @return error code from enum #kes_err_e;
+ * KES_ERR_NOERR if all elements were solved, else code of first failure
+ */
+kes_err_e kesolver_fix_batch(
+    const size_t     n,
+    const kes_q30_t* ecc,
+    const size_t     incecc,
+    const kes_bam_t* ma,
+    kes_bam_t*       ea
+);
+
+#ifdef __cplusplus
+}
+#endif
+
+/******************************************************************************/
+
+#endif  /* KES_FIXPT__H */
@@ -0,0 +1,203 @@
+/*******************************************************************************
+ * @file    fukush.c
+ * @brief   solver method KES_SOL_FUKUSH = Fukushima's method
+ * @author  Bazso Akos
+ * @version 1.0, 14 Oct 2026
+ *
+ * @copyright
+ * Copyright (C) 2019 Bazso Akos
+ *
+ * This file is part of libkes.
+ *
+ * libkes is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * libkes is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with libkes.  If not, see <https://www.gnu.org/licenses/>.
+ *
+ ******************************************************************************/
+/* include standard headers */
+#include <math.h>
+#include <pthread.h>
+
+/* include module headers */
+#include "fukush.h"
+#include "const.h"
+#include "debug.h"
+#include "trace.h"
+
+/******************************************************************************/
+
+/* number of segments of 0 <= E <= pi, i.e. local offsets |d| <= 0.025 */
+#define KES_FUKUSH_NSEG 128
+
+/* sin and cos of the nodes E_j = j * pi / KES_FUKUSH_NSEG; built once,
+ * then read-only
+ */
+static double fk_tab[KES_FUKUSH_NSEG + 1][2];
+
+/* ensures the table is built exactly once, also for concurrent callers */
+static pthread_once_t fk_tab_once = PTHREAD_ONCE_INIT;
+
+/******************************************************************************/
+
+/*******************************************************************************
+ *  FUNCTION    : fk_tab_build
+ *  DESCRIPTION : calculate sin and cos at all nodes
+ *  INPUT       : none
+ *  OUTPUT      : none
+ ******************************************************************************/
+static void fk_tab_build(void)
+{
+    const double h = M_PI / KES_FUKUSH_NSEG;
+
+    for (int j = 0; j <= KES_FUKUSH_NSEG; j++)
+    {
+        fk_tab[j][0] = sin(j * h);
+        fk_tab[j][1] = cos(j * h);
+    } // end for
+} // end fk_tab_build
+
+/******************************************************************************/
+
+/*******************************************************************************
+ *  FUNCTION    : fk_sincos_m1
+ *  DESCRIPTION : Taylor series of sin(d) - d and cos(d) - 1, truncation
+ *                error below 1E-17 for |d| <= pi / KES_FUKUSH_NSEG
+ *  INPUT       : - local offset "d"
+ *                - pointers "sm" and "cm" to return sin(d) - d, cos(d) - 1
+ *  OUTPUT      : none
+ ******************************************************************************/
+static inline void fk_sincos_m1(
+    const double d,
+    double*      sm,
+    double*      cm
+    )
+{
+    const double d2 = d * d;
+
+    *sm = -d * d2 * (1.0/6.0 - d2 * (1.0/120.0 - d2 * (1.0/5040.0)));
+    *cm = -d2 * (0.5 - d2 * (1.0/24.0 - d2 * (1.0/720.0 - d2 / 40320.0)));
+} // end fk_sincos_m1
+
+/******************************************************************************/
+
+/*******************************************************************************
+ *  FUNCTION    : fukush
+ *  DESCRIPTION : Fukushima's method = segmentation of E and discretized
+ *                Newton starter, Halley steps in the local offset
+ *  INPUT       : - eccentricity "ecc"
+ *                - mean anomaly "ma" in radians
+ *                - "starter" value for first iteration
+ *                - "res" for results
+ *  OUTPUT      : number of iterations
+ ******************************************************************************/
+int fukush(
+    const double ecc,
+    const double ma,
+    const double starter,
+    kes_input_t* res
+    )
+{
+    register int count = 0;      /* iteration counter */
+    double       deltax, deltaf; /* error residuals */
+    double       sm, cm;         /* sin(d) - d, cos(d) - 1 */
+
+    /* correction factor for absolute error deltaf (precomputed if available) */
+    const double corr = ((res->terms != NULL) ?
+                         res->terms->corr : ecc / (1.0 - ecc));
+
+    /* reset error residuals */
+    deltax = deltaf = 0.0;
+    res->nbrSinEval = res->nbrCosEval = res->nbrFktEval = 0;
+
+    /* trace iteration process? */
+    const int trace = kes_trace_begin();
+
+    /* NOTE given starter is overridden by the discretized Newton step */
+    (void)starter;
+
+    /* build table on first use */
+    pthread_once( &fk_tab_once, fk_tab_build );
+
+    /* find segment j with E_j - e * sin(E_j) <= M < E_j+1 - e * sin(E_j+1) */
+    const double h  = M_PI / KES_FUKUSH_NSEG;
+    int          lo = 0, hi = KES_FUKUSH_NSEG;
+    while ( hi - lo > 1 )
+    {
+        const int mid = (lo + hi) / 2;
+        ((mid * h - ecc * fk_tab[mid][0] <= ma) ? (lo = mid) : (hi = mid));
+    } // end while
+
+    /* E = E_j + d with 0 <= d <= h, the Kepler Equation in d reads
+     * d * (1 - e * cos(E_j)) - e * (sin(E_j) * (cos(d) - 1) +
+     *   cos(E_j) * (sin(d) - d)) - (M - E_j + e * sin(E_j)) = 0
+     * without cancellation, also in the first segment for e -> 1
+     */
+    const double sj  = fk_tab[lo][0];
+    const double cj  = fk_tab[lo][1];
+    const double dm  = ma - (lo * h - ecc * sj);
+    const double fp0 = 1.0 - ecc * cj;
+
+    /* starter: discretized Newton step from the node E_j, in the first
+     * segment for high ecc the root of (1 - e) * d + e * d^3 / 6 = M
+     */
+    double d = dm / fp0;
+    if ( (lo == 0) && (ecc > 0.5) )
+    {
+        const double q = 2.0 * (1.0 - ecc) / ecc;
+        const double r = 3.0 * ma / ecc;
+        const double s = cbrt(sqrt(q*q*q + r*r) + r);
+        d = s - q / s;
+    } // end if
+    d = fmin( fmax(d, 0.0), h );
+    kes_trace_step( trace, KES_SOL_FUKUSH, count, ecc, ma, lo * h + d,
+                    0.0, 0.0 );
+
+    /* main iteration loop: Halley steps in d */
+    do
+    {
+        fk_sincos_m1( d, &sm, &cm );
+
+        const double fx = d * fp0 - ecc * (sj * cm + cj * sm) - dm;
+        const double f1 = fp0 - ecc * (cj * cm - sj * (d + sm));
+        const double f2 = ecc * (sj * (1.0 + cm) + cj * (d + sm));
+        const double dx = -fx / (f1 - 0.5 * fx * f2 / f1);
+
+        /* stay within the segment */
+        d = fmin( fmax(d + dx, 0.0), h );
+        ++(res->nbrFktEval);
+
+        ++count;
+
+        /* update error residuals, deltax estimates the error after the
+         * step from the cubic convergence of Halley's method
+         */
+        deltax = fabs(dx * dx * dx) *
+                 (0.25 * f2 * f2 / (f1 * f1) + ecc / (6.0 * fabs(f1)));
+        deltaf = fabs(fx) * corr;
+
+        kes_trace_step( trace, KES_SOL_FUKUSH, count, ecc, ma,
+                        lo * h + d, deltax, deltaf );
+    } while (
+        (deltax > res->tolx) &&
+        (deltaf > res->tolf) &&
+        (count  < res->maxiter)
+    ); // end do
+
+    /* results */
+    res->result = lo * h + d;
+    res->errDF  = deltaf;
+    res->errDX  = deltax;
+
+    return( count );
+} // end fukush
+
+/******************************************************************************/
@@ -0,0 +1,69 @@
+/***************************************************************************//**
+ * @file    fukush.h
+ * @brief   Fukushima's method (segments in E, discretized Newton starter)
+ * @details after description in:
+ * Fukushima (1997), Celest. Mech. Dyn. Astron. 66, p.309-319
+ * @author  Bazso Akos
+ *
+ * @copyright
+ * Copyright (C) 2019 Bazso Akos
+ *
+ * This file is part of libkes.
+ *
+ * libkes is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * libkes is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with libkes.  If not, see <https://www.gnu.org/licenses/>.
+ *
+ ******************************************************************************/
+#pragma once
+#ifndef KES_SOL_FUKUSH__H
+#define KES_SOL_FUKUSH__H
+
+/* include module headers */
+#include "input.h"
+
+/******************************************************************************/
+
+/*** function declarations ***/
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/*!
+ * @brief iteration function for Fukushima's method
+ * @details the range 0 <= E <= pi is split into segments of equal width
+ * with sin and cos of the nodes tabulated once; the segment holding the
+ * solution is found by bisection of the nodes, the starter is one
+ * discretized Newton step from the node, then Halley steps with sin and cos
+ * from the addition theorem and Taylor series of the local offset follow,
+ * i.e. no sin/cos is evaluated per call
+ * @param[in] ecc eccentricity
+ * @param[in] ma reduced mean anomaly (0 <= ma <= pi)
+ * @param[in] starter starting value for first iteration (ignored)
+ * @param[out] res iteration results and statistics
+ * @return number of iterations
+ */
+int fukush(
+    const double ecc,
+    const double ma,
+    const double starter,
+    kes_input_t* res
+);
+
+#ifdef __cplusplus
+}
+#endif
+
+/******************************************************************************/
+
+#endif  /* KES_SOL_FUKUSH__H */
@@ -0,0 +1,1070 @@
+/***************************************************************************//**
+ * @file    gpu.c
+ * @brief   optional OpenCL offload of batch solver functions
+ * @author  Bazso Akos
+ * @version 2026.10
+ *
+ * @copyright
+ * Copyright (C) 2019 Bazso Akos
+ *
+ * This file is part of libkes.
+ *
+ * libkes is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * libkes is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with libkes.  If not, see <https://www.gnu.org/licenses/>.
+ *
+ ******************************************************************************/
+/* POSIX dlopen() and threads */
+#define _POSIX_C_SOURCE 200809L
+
+/* include standard headers */
+#include <dlfcn.h>
+#include <pthread.h>
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+/* include module headers */
+#include "gpu.h"
+#include "alloc.h"
+#include "const.h"
+#include "hyperb.h"
+#include "parab.h"
+#include "pool.h"
+#include "vecmath.h"
+
+/******************************************************************************/
+
+/* use verbose debug output? 0 = no (default), 1 = yes */
+#define KES_GPU_DEBUG 0
+
+/* number of elements solved per call of kesolver_batch() by
+ * kes_gpu_download(), size of the work arrays on the stack
+ */
+#define KES_GPU_BLOCK 256
+
+/* work-group size of the kernel (0 = chosen by the OpenCL runtime) */
+#define KES_GPU_LOCAL 0
+
+/******************************************************************************/
+
+/*** minimal subset of the OpenCL 1.2 API, resolved at runtime ***/
+
+typedef int32_t   cl_int;
+typedef uint32_t  cl_uint;
+typedef uint64_t  cl_ulong;
+typedef cl_ulong  cl_bitfield;
+typedef intptr_t  cl_context_properties;
+
+typedef struct _cl_platform_id*   cl_platform_id;
+typedef struct _cl_device_id*     cl_device_id;
+typedef struct _cl_context*       cl_context;
+typedef struct _cl_command_queue* cl_command_queue;
+typedef struct _cl_mem*           cl_mem;
+typedef struct _cl_program*       cl_program;
+typedef struct _cl_kernel*        cl_kernel;
+typedef struct _cl_event*         cl_event;
+
+#define CL_SUCCESS                 0
+#define CL_TRUE                    1
+#define CL_DEVICE_TYPE_GPU         (1 << 2)
+#define CL_DEVICE_TYPE_ACCELERATOR (1 << 3)
+#define CL_DEVICE_DOUBLE_FP_CONFIG 0x1032
+#define CL_MEM_READ_WRITE          (1 << 0)
+
+/* max. number of platforms and devices per platform searched */
+#define KES_GPU_MAXDEV 8
+
+/* entry points of the OpenCL library and state of the selected device */
+typedef struct
+{
+    void*            lib;     ///< handle of the OpenCL library
+    int              ready;   ///< device, queue and kernel are valid
+
+    cl_device_id     device;  ///< selected device
+    cl_context       context; ///< context of the device
+    cl_command_queue queue;   ///< in-order command queue
+    cl_program       program; ///< program built from kes_gpu_source
+    cl_kernel        kernel;  ///< kernel "kes_gpu_ell"
+
+    cl_int (*GetPlatformIDs)( cl_uint, cl_platform_id*, cl_uint* );
+    cl_int (*GetDeviceIDs)( cl_platform_id, cl_bitfield, cl_uint,
+                            cl_device_id*, cl_uint* );
+    cl_int (*GetDeviceInfo)( cl_device_id, cl_uint, size_t, void*, size_t* );
+    cl_context (*CreateContext)( const cl_context_properties*, cl_uint,
+                                 const cl_device_id*,
+                                 void (*)( const char*, const void*, size_t,
+                                           void* ),
+                                 void*, cl_int* );
+    cl_command_queue (*CreateCommandQueue)( cl_context, cl_device_id,
+                                            cl_bitfield, cl_int* );
+    cl_program (*CreateProgramWithSource)( cl_context, cl_uint, const char**,
+                                           const size_t*, cl_int* );
+    cl_int (*BuildProgram)( cl_program, cl_uint, const cl_device_id*,
+                            const char*, void (*)( cl_program, void* ),
+                            void* );
+    cl_kernel (*CreateKernel)( cl_program, const char*, cl_int* );
+    cl_mem (*CreateBuffer)( cl_context, cl_bitfield, size_t, void*, cl_int* );
+    cl_int (*EnqueueWriteBuffer)( cl_command_queue, cl_mem, cl_uint, size_t,
+                                  size_t, const void*, cl_uint,
+                                  const cl_event*, cl_event* );
+    cl_int (*EnqueueReadBuffer)( cl_command_queue, cl_mem, cl_uint, size_t,
+                                 size_t, void*, cl_uint, const cl_event*,
+                                 cl_event* );
+    cl_int (*SetKernelArg)( cl_kernel, cl_uint, size_t, const void* );
+    cl_int (*EnqueueNDRangeKernel)( cl_command_queue, cl_kernel, cl_uint,
+                                    const size_t*, const size_t*,
+                                    const size_t*, cl_uint, const cl_event*,
+                                    cl_event* );
+    cl_int (*Finish)( cl_command_queue );
+    cl_int (*ReleaseMemObject)( cl_mem );
+    cl_int (*ReleaseKernel)( cl_kernel );
+    cl_int (*ReleaseProgram)( cl_program );
+    cl_int (*ReleaseCommandQueue)( cl_command_queue );
+    cl_int (*ReleaseContext)( cl_context );
+} kes_cl_t;
+
+/******************************************************************************/
+
+/*** structure of a batch ***/
+
+struct kes_gpu_s
+{
+    size_t      n;       ///< number of elements
+    size_t      incecc;  ///< stride of eccentricities (0 or 1)
+    int         device;  ///< device buffers are valid
+    int         solved;  ///< 0 = no results, 1 = on device, 2 = on host
+
+    /* host copy of inputs and host results */
+    double*     ecc;     ///< eccentricities
+    double*     ma;      ///< mean anomalies
+    double*     ea;      ///< solutions
+    int*        count;   ///< iterations, -1 = not handled by the device
+    kes_err_e*  status;  ///< per-element error codes
+    kes_err_e   err;     ///< error code of first failing element
+    size_t      bytes;   ///< size of the block of the host arrays
+    kes_alloc_t alloc;   ///< allocator of the batch and its host arrays
+
+    /* settings of the last call of kes_gpu_solve() */
+    kes_stm_e   init;    ///< starter method
+    kes_sol_e   iter;    ///< solver method
+    kes_input_t work;    ///< checked input parameters
+
+    /* device buffers */
+    cl_mem      becc;    ///< eccentricities
+    cl_mem      bma;     ///< mean anomalies
+    cl_mem      bea;     ///< solutions
+    cl_mem      bcount;  ///< iterations
+};
+
+/******************************************************************************/
+
+/*** global state of the OpenCL backend ***/
+
+static kes_cl_t        cl;
+static pthread_once_t  cl_once = PTHREAD_ONCE_INIT;
+
+/* serializes setting of kernel arguments and launches */
+static pthread_mutex_t cl_lock = PTHREAD_MUTEX_INITIALIZER;
+
+/******************************************************************************/
+
+/*** REFERENCE : same formulas as kes_vsolve_ell() in vecore.c and the
+ *** starters in starter.c, constants are passed as build options
+ ***/
+
+static const char* kes_gpu_source =
+"#pragma OPENCL EXTENSION cl_khr_fp64 : enable\n"
+"\n"
+"/* iteration methods of order 2 to 5, same as kes_vec_core() */\n"
+"double kes_core(const int order, const double e, const double m,\n"
+"                const double x0)\n"
+"{\n"
+"    double cx;\n"
+"    const double sx  = sincos(x0, &cx);\n"
+"    const double esx = e * sx;\n"
+"    const double ecx = e * cx;\n"
+"    const double f0  = m - x0 + esx;\n"
+"    const double f1  = 1.0 - ecx + 1.0e-19;\n"
+"    double       dx  = f0 / f1;\n"
+"    if (order >= 3) {\n"
+"        const double f2 = esx / 2.0;\n"
+"        dx = f0 / (f1 + dx * f2);\n"
+"        if (order >= 4) {\n"
+"            const double f3 = ecx / 6.0;\n"
+"            dx = f0 / (f1 + dx * (f2 + dx * f3));\n"
+"            if (order >= 5) {\n"
+"                const double f4 = -esx / 24.0;\n"
+"                dx = f0 / (f1 + dx * (f2 + dx * (f3 + dx * f4)));\n"
+"            }\n"
+"        }\n"
+"    }\n"
+"    return x0 + dx;\n"
+"}\n"
+"\n"
+"/* starters of Markley's and Mikkola's method, see vecore.c */\n"
+"double kes_markley(const double e, const double m)\n"
+"{\n"
+"    const double ad0 = 1.0 / (KES_PISQ - 6.0);\n"
+"    const double ak  = 1.6 * M_PI * ad0;\n"
+"    const double ad  = ad0 * 3.0 * KES_PISQ;\n"
+"    const double a = ad + ak * (M_PI - m) / (1.0 + e);\n"
+"    const double d = 3.0 * (1.0 - e) + a * e;\n"
+"    const double q = 2.0 * a * d * (1.0 - e) - m * m;\n"
+"    const double r = 3.0 * a * d * (d - 1.0 + e) * m + m * m * m;\n"
+"    double       w = cbrt(fabs(r) + sqrt(q * q * q + r * r));\n"
+"    w *= w;\n"
+"    return (w > 0.0) ? (2.0 * r * w / (w * w + q * w + q * q) + m) / d\n"
+"                     : 0.0;\n"
+"}\n"
+"\n"
+"double kes_mikkola(const double e, const double m)\n"
+"{\n"
+"    const double a0 = 1.0 / (0.5 + 4.0 * e);\n"
+"    const double b  = 0.5 * m * a0;\n"
+"    const double a  = a0 * (1.0 - e);\n"
+"    const double c  = cbrt(sqrt(a * a * a + b * b) + b);\n"
+"    double       s  = (c > 0.0) ? c - a / c : 0.0;\n"
+"    double       s2 = s * s;\n"
+"    s += -0.078 * s * s2 * s2 / (1.0 + e);\n"
+"    s2 = s * s;\n"
+"    return m + e * s * (3.0 - 4.0 * s2);\n"
+"}\n"
+"\n"
+"/* starter methods, same as in starter.c */\n"
+"double kes_start(const int init, const double e, const double m)\n"
+"{\n"
+"    double c, s;\n"
+"    switch (init) {\n"
+"    case KES_STM_ES00: return M_PI;\n"
+"    case KES_STM_ES01: return m;\n"
+"    case KES_STM_ES02: return m + e * sin(m);\n"
+"    case KES_STM_ES03: s = e * sincos(m, &c);\n"
+"                       return m + s * (1.0 + e * c);\n"
+"    case KES_STM_ES06: return (m + e * M_PI) / (1.0 + e);\n"
+"    case KES_STM_ES07: return fmin(fmin(m / (1.0 - e), m + e),\n"
+"                                   (m + e * M_PI) / (1.0 + e));\n"
+"    case KES_STM_ES12: {\n"
+"        const double a = (M_PI - 1.0) * (M_PI - 1.0) / (M_PI + 2.0 / 3.0);\n"
+"        const double b = 2.0 * (M_PI - 1.0 / 6.0) * (M_PI - 1.0 / 6.0) /\n"
+"                         (M_PI + 2.0 / 3.0);\n"
+"        const double w = M_PI - m;\n"
+"        return e * (M_PI - a * w / (b - w)) + (1.0 - e) * m;\n"
+"    }\n"
+"    case KES_STM_ES14: return m + e * (cbrt(KES_PISQ * m) -\n"
+"                                        M_PI * sin(m) / 15.0 - m);\n"
+"    default:           return m + e;\n"
+"    }\n"
+"}\n"
+"\n"
+"/* elliptic elements, count = -1 marks elements left to the host */\n"
+"__kernel void kes_gpu_ell(\n"
+"    const ulong n, const ulong incecc,\n"
+"    __global const double* ecc, __global const double* ma,\n"
+"    __global double* ea, __global int* count,\n"
+"    const int iter, const int order, const int npar, const int init,\n"
+"    const int fixiter, const int maxiter,\n"
+"    const double tolx, const double tolf)\n"
+"{\n"
+"    const size_t i = get_global_id(0);\n"
+"    if (i >= n) return;\n"
+"\n"
+"    const double e  = ecc[i * incecc];\n"
+"    const double m0 = ma[i];\n"
+"\n"
+"    /* valid elliptic eccentricity, same thresholds as kes_check_ecc() */\n"
+"    if (!isfinite(m0) || !(e > KES_ECC_MIN) || !(e < 1.0 - KES_ECC_MIN)) {\n"
+"        ea[i] = 0.0; count[i] = -1; return;\n"
+"    }\n"
+"\n"
+"    /* reduce mean anomaly, same as kes_reduce() up to KES_REDUCE_MAX */\n"
+"    const double k = rint(m0 * KES_1_2PI);\n"
+"    double x = (((m0 - k * KES_2PI_1) - k * KES_2PI_2) - k * KES_2PI_3) -\n"
+"               k * KES_2PI_4;\n"
+"    x = (fabs(m0) < KES_REDUCE_MAX) ? x : atan2(sin(m0), cos(m0));\n"
+"    x = (x >  M_PI) ? (x - KES_2PI_1) - KES_2PI_2 : x;\n"
+"    x = (x < -M_PI) ? (x + KES_2PI_1) + KES_2PI_2 : x;\n"
+"    const int    side = (x < 0.0) ? -1 : 1;\n"
+"    const double m    = fabs(x);\n"
+"\n"
+"    /* near-parabolic region, same as kes_npar_region() */\n"
+"    if (npar && ((e > KES_NEARPAR_ECC) ||\n"
+"                 ((e > KES_CORNER_ECC) &&\n"
+"                  (m < KES_CORNER_MA +\n"
+"                       KES_CORNER_SLOPE * (e - KES_CORNER_ECC))))) {\n"
+"        ea[i] = 0.0; count[i] = -1; return;\n"
+"    }\n"
+"\n"
+"    double E;\n"
+"    int    it = 0;\n"
+"    const double e2 = e * e;\n"
+"    if ((m == 0.0) || (m == M_PI)) {\n"
+"        /* apsides, same as kes_solver_ell_direct() */\n"
+"        E = m;\n"
+"    } else if (e2 * e2 * e <= tolx) {\n"
+"        double cx;\n"
+"        const double sx = sincos(m, &cx);\n"
+"        const double a2 = sx * cx;\n"
+"        const double a3 = sx * (1.0 - 1.5 * sx * sx);\n"
+"        const double a4 = sx * cx * (8.0 * cx * cx - 5.0) / 3.0;\n"
+"        E = m + e * (sx + e * (a2 + e * (a3 + e * a4)));\n"
+"    } else if (iter == KES_SOL_MARKLEY) {\n"
+"        E  = kes_core(5, e, m, kes_markley(e, m));\n"
+"        it = 1;\n"
+"    } else if (iter == KES_SOL_MIKKOLA) {\n"
+"        E  = kes_core(5, e, m, kes_mikkola(e, m));\n"
+"        it = 1;\n"
+"    } else if (fixiter > 0) {\n"
+"        E = kes_start(init, e, m);\n"
+"        for (it = 0; it < fixiter; it++) E = kes_core(order, e, m, E);\n"
+"    } else {\n"
+"        /* same stopping criteria as kes_vsolve_ell() */\n"
+"        const double corr = e / (1.0 - e);\n"
+"        double deltax, deltaf;\n"
+"        E = kes_start(init, e, m);\n"
+"        do {\n"
+"            const double xn = kes_core(order, e, m, E);\n"
+"            deltax = fabs(xn - E);\n"
+"            deltaf = fabs(xn - e * sin(xn) - m) * corr;\n"
+"            E      = xn;\n"
+"            ++it;\n"
+"        } while ((deltax > tolx) && (deltaf > tolf) && (it < maxiter));\n"
+"    }\n"
+"\n"
+"    ea[i]    = (side < 0) ? KES_2PI - E : E;\n"
+"    count[i] = it;\n"
+"}\n";
+
+/******************************************************************************/
+
+/*******************************************************************************
+ *  FUNCTION    : kes_cl_sym
+ *  DESCRIPTION : resolve one entry point of the OpenCL library
+ *  INPUT       : - pointer "fp" to function pointer
+ *                - "name" of entry point
+ *  OUTPUT      : 1 if resolved, 0 otherwise
+ ******************************************************************************/
+static int kes_cl_sym(
+    void**      fp,
+    const char* name
+    )
+{
+    *fp = dlsym( cl.lib, name );
+
+    return( *fp != NULL );
+} // end kes_cl_sym
+
+/******************************************************************************/
+
+/*******************************************************************************
+ *  FUNCTION    : kes_cl_load
+ *  DESCRIPTION : load the OpenCL library and resolve all entry points
+ *  INPUT       : none
+ *  OUTPUT      : 1 on success, 0 otherwise
+ ******************************************************************************/
+static int kes_cl_load(void)
+{
+    cl.lib = dlopen( "libOpenCL.so.1", RTLD_NOW | RTLD_LOCAL );
+    if ( cl.lib == NULL )
+    {
+        cl.lib = dlopen( "libOpenCL.so", RTLD_NOW | RTLD_LOCAL );
+    } // end if
+    if ( cl.lib == NULL )
+    {
+        return( 0 );
+    } // end if
+
+    /* NOTE object to function pointer conversion as recommended by POSIX */
+    const int ok =
+        kes_cl_sym( (void**)&cl.GetPlatformIDs, "clGetPlatformIDs" ) &&
+        kes_cl_sym( (void**)&cl.GetDeviceIDs, "clGetDeviceIDs" ) &&
+        kes_cl_sym( (void**)&cl.GetDeviceInfo, "clGetDeviceInfo" ) &&
+        kes_cl_sym( (void**)&cl.CreateContext, "clCreateContext" ) &&
+        kes_cl_sym( (void**)&cl.CreateCommandQueue,
+                    "clCreateCommandQueue" ) &&
+        kes_cl_sym( (void**)&cl.CreateProgramWithSource,
+                    "clCreateProgramWithSource" ) &&
+        kes_cl_sym( (void**)&cl.BuildProgram, "clBuildProgram" ) &&
+        kes_cl_sym( (void**)&cl.CreateKernel, "clCreateKernel" ) &&
+        kes_cl_sym( (void**)&cl.CreateBuffer, "clCreateBuffer" ) &&
+        kes_cl_sym( (void**)&cl.EnqueueWriteBuffer,
+                    "clEnqueueWriteBuffer" ) &&
+        kes_cl_sym( (void**)&cl.EnqueueReadBuffer, "clEnqueueReadBuffer" ) &&
+        kes_cl_sym( (void**)&cl.SetKernelArg, "clSetKernelArg" ) &&
+        kes_cl_sym( (void**)&cl.EnqueueNDRangeKernel,
+                    "clEnqueueNDRangeKernel" ) &&
+        kes_cl_sym( (void**)&cl.Finish, "clFinish" ) &&
+        kes_cl_sym( (void**)&cl.ReleaseMemObject, "clReleaseMemObject" ) &&
+        kes_cl_sym( (void**)&cl.ReleaseKernel, "clReleaseKernel" ) &&
+        kes_cl_sym( (void**)&cl.ReleaseProgram, "clReleaseProgram" ) &&
+        kes_cl_sym( (void**)&cl.ReleaseCommandQueue,
+                    "clReleaseCommandQueue" ) &&
+        kes_cl_sym( (void**)&cl.ReleaseContext, "clReleaseContext" );
+
+    if ( !ok )
+    {
+        dlclose( cl.lib );
+        cl.lib = NULL;
+    } // end if
+
+    return( ok );
+} // end kes_cl_load
+
+/******************************************************************************/
+
+/*******************************************************************************
+ *  FUNCTION    : kes_cl_device
+ *  DESCRIPTION : select the first GPU or accelerator with double precision
+ *  INPUT       : none
+ *  OUTPUT      : 1 if a device was found, 0 otherwise
+ ******************************************************************************/
+static int kes_cl_device(void)
+{
+    cl_platform_id plat[KES_GPU_MAXDEV];
+    cl_device_id   dev[KES_GPU_MAXDEV];
+    cl_uint        nplat = 0;
+
+    if ( (cl.GetPlatformIDs( KES_GPU_MAXDEV, plat, &nplat ) != CL_SUCCESS) )
+    {
+        return( 0 );
+    } // end if
+    nplat = ((nplat < KES_GPU_MAXDEV) ? nplat : KES_GPU_MAXDEV);
+
+    for (cl_uint p = 0; p < nplat; p++)
+    {
+        cl_uint ndev = 0;
+
+        if ( cl.GetDeviceIDs( plat[p], CL_DEVICE_TYPE_GPU |
+                              CL_DEVICE_TYPE_ACCELERATOR, KES_GPU_MAXDEV, dev,
+                              &ndev ) != CL_SUCCESS )
+        {
+            continue;
+        } // end if
+        ndev = ((ndev < KES_GPU_MAXDEV) ? ndev : KES_GPU_MAXDEV);
+
+        for (cl_uint d = 0; d < ndev; d++)
+        {
+            cl_bitfield fp64 = 0;
+
+            if ( (cl.GetDeviceInfo( dev[d], CL_DEVICE_DOUBLE_FP_CONFIG,
+                                    sizeof(fp64), &fp64, NULL ) ==
+                  CL_SUCCESS) && (fp64 != 0) )
+            {
+                cl.device = dev[d];
+                return( 1 );
+            } // end if
+        } // end for(d)
+    } // end for(p)
+
+    return( 0 );
+} // end kes_cl_device
+
+/******************************************************************************/
+
+/*******************************************************************************
+ *  FUNCTION    : kes_cl_init
+ *  DESCRIPTION : one-time setup of library, device, queue and kernel,
+ *                called by pthread_once()
+ *  INPUT       : none
+ *  OUTPUT      : none
+ ******************************************************************************/
+static void kes_cl_init(void)
+{
+    cl_int err;
+    char   opts[1024];
+
+    if ( !kes_cl_load() )
+    {
+        return;
+    } // end if
+
+    if ( !kes_cl_device() )
+    {
+        return;
+    } // end if
+
+    cl.context = cl.CreateContext( NULL, 1, &cl.device, NULL, NULL, &err );
+    if ( err != CL_SUCCESS )
+    {
+        return;
+    } // end if
+
+    cl.queue = cl.CreateCommandQueue( cl.context, cl.device, 0, &err );
+    if ( err != CL_SUCCESS )
+    {
+        cl.ReleaseContext( cl.context );
+        return;
+    } // end if
+
+    /* constants of the host code, %.17g reproduces all digits */
+    snprintf( opts, sizeof(opts),
+              "-DKES_2PI=%.17g -DKES_PISQ=%.17g -DKES_ECC_MIN=%.17g "
+              "-DKES_1_2PI=%.17g -DKES_2PI_1=%.17g -DKES_2PI_2=%.17g "
+              "-DKES_2PI_3=%.17g -DKES_2PI_4=%.17g -DKES_REDUCE_MAX=%.17g "
+              "-DKES_NEARPAR_ECC=%.17g -DKES_CORNER_ECC=%.17g "
+              "-DKES_CORNER_MA=%.17g -DKES_CORNER_SLOPE=%.17g "
+              "-DKES_SOL_MARKLEY=%d "
+              "-DKES_SOL_MIKKOLA=%d -DKES_STM_ES00=%d -DKES_STM_ES01=%d "
+              "-DKES_STM_ES02=%d -DKES_STM_ES03=%d -DKES_STM_ES06=%d "
+              "-DKES_STM_ES07=%d -DKES_STM_ES12=%d -DKES_STM_ES14=%d",
+              M_2PI, M_PISQ, 1e-10, KES_VEC_1_2PI, KES_VEC_2PI_1,
+              KES_VEC_2PI_2, KES_VEC_2PI_3, KES_VEC_2PI_4, KES_VEC_REDUCE_MAX,
+              KES_NEARPAR_ECC, KES_CORNER_ECC, KES_CORNER_MA,
+              KES_CORNER_SLOPE, KES_SOL_MARKLEY, KES_SOL_MIKKOLA, KES_STM_ES00,
+              KES_STM_ES01, KES_STM_ES02, KES_STM_ES03, KES_STM_ES06,
+              KES_STM_ES07, KES_STM_ES12, KES_STM_ES14 );
+
+    cl.program = cl.CreateProgramWithSource( cl.context, 1, &kes_gpu_source,
+                                             NULL, &err );
+    if ( (err == CL_SUCCESS) &&
+         (cl.BuildProgram( cl.program, 1, &cl.device, opts, NULL, NULL ) ==
+          CL_SUCCESS) )
+    {
+        cl.kernel = cl.CreateKernel( cl.program, "kes_gpu_ell", &err );
+        cl.ready  = (err == CL_SUCCESS);
+    } // end if
+
+#if KES_GPU_DEBUG
+    fprintf( stderr, "kes_cl_init: device ready = %d\n", cl.ready );
+#endif
+
+    if ( !cl.ready )
+    {
+        if ( cl.program != NULL )
+        {
+            cl.ReleaseProgram( cl.program );
+        } // end if
+        cl.ReleaseCommandQueue( cl.queue );
+        cl.ReleaseContext( cl.context );
+    } // end if
+
+    return;
+} // end kes_cl_init
+
+/******************************************************************************/
+
+/*******************************************************************************
+ *  FUNCTION    : kes_gpu_supported
+ *  DESCRIPTION : check if the kernel implements a pair of methods
+ *  INPUT       : - starter method "init" from enum kes_stm_e
+ *                - solver method "iter" from enum kes_sol_e
+ *  OUTPUT      : 1 if supported, 0 otherwise
+ ******************************************************************************/
+static int kes_gpu_supported(
+    const kes_stm_e init,
+    const kes_sol_e iter
+    )
+{
+    switch ( iter )
+    {
+        /* methods with a built-in starter */
+        case KES_SOL_MARKLEY:
+        case KES_SOL_MIKKOLA:
+            return( 1 );
+
+        case KES_SOL_NEWRAP:
+        case KES_SOL_HALLEY:
+        case KES_SOL_DANBUR4:
+        case KES_SOL_DANBUR5:
+            break;
+
+        default:
+            return( 0 );
+    } // end switch
+
+    switch ( init )
+    {
+        case KES_STM_ES00:
+        case KES_STM_ES01:
+        case KES_STM_ES02:
+        case KES_STM_ES03:
+        case KES_STM_ES04:
+        case KES_STM_ES06:
+        case KES_STM_ES07:
+        case KES_STM_ES12:
+        case KES_STM_ES14:
+            return( 1 );
+
+        default:
+            return( 0 );
+    } // end switch
+} // end kes_gpu_supported
+
+/******************************************************************************/
+
+/*******************************************************************************
+ *  FUNCTION    : kes_gpu_launch
+ *  DESCRIPTION : queue the kernel for all elements of a batch
+ *  INPUT       : pointer "gpu" to batch
+ *  OUTPUT      : 1 if queued, 0 otherwise
+ ******************************************************************************/
+static int kes_gpu_launch(kes_gpu_t* gpu)
+{
+    const cl_ulong n       = gpu->n;
+    const cl_ulong incecc  = gpu->incecc;
+    const cl_int   iter    = gpu->iter;
+    const cl_int   order   = kes_hyp_order( gpu->iter );
+    const cl_int   npar    = (kes_npar_order( gpu->iter ) > 0);
+    const cl_int   init    = gpu->init;
+    const cl_int   fixiter = ((gpu->work.fixiter > 0) ? gpu->work.fixiter : 0);
+    const cl_int   maxiter = gpu->work.maxiter;
+    const double   tolx    = gpu->work.tolx;
+    const double   tolf    = gpu->work.tolf;
+    const size_t   global  = gpu->n;
+    const size_t   local   = KES_GPU_LOCAL;
+    cl_int         err     = CL_SUCCESS;
+
+    pthread_mutex_lock( &cl_lock );
+
+    err |= cl.SetKernelArg( cl.kernel,  0, sizeof(n), &n );
+    err |= cl.SetKernelArg( cl.kernel,  1, sizeof(incecc), &incecc );
+    err |= cl.SetKernelArg( cl.kernel,  2, sizeof(cl_mem), &gpu->becc );
+    err |= cl.SetKernelArg( cl.kernel,  3, sizeof(cl_mem), &gpu->bma );
+    err |= cl.SetKernelArg( cl.kernel,  4, sizeof(cl_mem), &gpu->bea );
+    err |= cl.SetKernelArg( cl.kernel,  5, sizeof(cl_mem), &gpu->bcount );
+    err |= cl.SetKernelArg( cl.kernel,  6, sizeof(iter), &iter );
+    err |= cl.SetKernelArg( cl.kernel,  7, sizeof(order), &order );
+    err |= cl.SetKernelArg( cl.kernel,  8, sizeof(npar), &npar );
+    err |= cl.SetKernelArg( cl.kernel,  9, sizeof(init), &init );
+    err |= cl.SetKernelArg( cl.kernel, 10, sizeof(fixiter), &fixiter );
+    err |= cl.SetKernelArg( cl.kernel, 11, sizeof(maxiter), &maxiter );
+    err |= cl.SetKernelArg( cl.kernel, 12, sizeof(tolx), &tolx );
+    err |= cl.SetKernelArg( cl.kernel, 13, sizeof(tolf), &tolf );
+
+    if ( err == CL_SUCCESS )
+    {
+        err = cl.EnqueueNDRangeKernel( cl.queue, cl.kernel, 1, NULL, &global,
+                                       ((local > 0) ? &local : NULL), 0, NULL,
+                                       NULL );
+    } // end if
+
+    pthread_mutex_unlock( &cl_lock );
+
+    return( err == CL_SUCCESS );
+} // end kes_gpu_launch
+
+/******************************************************************************/
+
+/*******************************************************************************
+ *  FUNCTION    : kes_gpu_host
+ *  DESCRIPTION : solve all elements of a batch by the host
+ *  INPUT       : pointer "gpu" to batch
+ *  OUTPUT      : none
+ ******************************************************************************/
+static void kes_gpu_host(kes_gpu_t* gpu)
+{
+    gpu->err    = kesolver_batch_mt( gpu->n, gpu->ecc, gpu->incecc, gpu->ma,
+                                     gpu->ea, gpu->init, gpu->iter,
+                                     &gpu->work, gpu->status, gpu->count );
+    gpu->solved = 2;
+
+    return;
+} // end kes_gpu_host
+
+/******************************************************************************/
+
+/*******************************************************************************
+ *  FUNCTION    : kes_gpu_fixup
+ *  DESCRIPTION : solve elements not handled by the device on the host,
+ *                set per-element error codes and first error of a batch
+ *  INPUT       : pointer "gpu" to batch with device results on the host
+ *  OUTPUT      : none
+ ******************************************************************************/
+static void kes_gpu_fixup(kes_gpu_t* gpu)
+{
+    size_t    idx[KES_GPU_BLOCK];  /* element index */
+    double    becc[KES_GPU_BLOCK]; /* eccentricity */
+    double    bma[KES_GPU_BLOCK];  /* mean anomaly */
+    double    bea[KES_GPU_BLOCK];  /* solution */
+    int       bcnt[KES_GPU_BLOCK]; /* number of iterations */
+    kes_err_e bst[KES_GPU_BLOCK];  /* error code */
+
+    size_t i = 0;
+    while ( i < gpu->n )
+    {
+        /* gather a block of elements left to the host */
+        size_t k = 0;
+        for ( ; (i < gpu->n) && (k < KES_GPU_BLOCK); i++)
+        {
+            gpu->status[i] = KES_ERR_NOERR;
+            if ( gpu->count[i] < 0 )
+            {
+                idx[k]  = i;
+                becc[k] = gpu->ecc[i * gpu->incecc];
+                bma[k]  = gpu->ma[i];
+                ++k;
+            } // end if
+        } // end for
+
+        if ( k > 0 )
+        {
+            kesolver_batch( k, becc, 1, bma, bea, gpu->init, gpu->iter,
+                            &gpu->work, bst, bcnt );
+
+            /* scatter results */
+            for (size_t j = 0; j < k; j++)
+            {
+                gpu->ea[idx[j]]     = bea[j];
+                gpu->count[idx[j]]  = bcnt[j];
+                gpu->status[idx[j]] = bst[j];
+            } // end for
+        } // end if
+    } // end while
+
+    /* first error in order of elements */
+    gpu->err = KES_ERR_NOERR;
+    for (i = 0; (i < gpu->n) && (gpu->err == KES_ERR_NOERR); i++)
+    {
+        gpu->err = gpu->status[i];
+    } // end for
+    gpu->solved = 2;
+
+    return;
+} // end kes_gpu_fixup
+
+/******************************************************************************/
+
+/*******************************************************************************
+ *  FUNCTION    : kes_gpu_available
+ *  DESCRIPTION : check for an OpenCL device with double precision
+ *  INPUT       : none
+ *  OUTPUT      : 1 if available, 0 otherwise
+ ******************************************************************************/
+int kes_gpu_available(void)
+{
+    pthread_once( &cl_once, kes_cl_init );
+
+    return( cl.ready );
+} // end kes_gpu_available
+
+/******************************************************************************/
+
+/*******************************************************************************
+ *  FUNCTION    : kes_gpu_new
+ *  DESCRIPTION : create a batch of n elements
+ *  INPUT       : - number of elements "n"
+ *                - pointer for error "status" code (may be NULL)
+ *  OUTPUT      : pointer to new batch, NULL on failure
+ ******************************************************************************/
+kes_gpu_t* kes_gpu_new(
+    const size_t n,
+    kes_err_e*   status
+    )
+{
+    kes_alloc_t  alloc;
+    kes_gpu_t*   gpu = kes_mem_calloc( &alloc, 1, sizeof(kes_gpu_t) );
+    const size_t m   = ((n > 0) ? n : 1);
+
+    if ( status != NULL )
+    {
+        *status = KES_ERR_NOERR;
+    } // end if
+    if ( gpu == NULL )
+    {
+        return( NULL );
+    } // end if
+
+    gpu->n      = n;
+    gpu->incecc = 1;
+    gpu->alloc  = alloc;
+
+    /* host arrays in one block, by decreasing alignment */
+    gpu->bytes  = m * (3 * sizeof(double) + sizeof(int) + sizeof(kes_err_e));
+    gpu->ecc    = kes_mem_calloc( &alloc, 1, gpu->bytes );
+    if ( gpu->ecc == NULL )
+    {
+        kes_gpu_free( gpu );
+        return( NULL );
+    } // end if
+    gpu->ma     = gpu->ecc + m;
+    gpu->ea     = gpu->ma  + m;
+    gpu->count  = (int*)(gpu->ea + m);
+    gpu->status = (kes_err_e*)(gpu->count + m);
+
+    /* device buffers, NOTE the batch is solved by the host without them */
+    if ( (n > 0) && kes_gpu_available() )
+    {
+        cl_int e0, e1, e2, e3;
+
+        gpu->becc   = cl.CreateBuffer( cl.context, CL_MEM_READ_WRITE,
+                                       n * sizeof(double), NULL, &e0 );
+        gpu->bma    = cl.CreateBuffer( cl.context, CL_MEM_READ_WRITE,
+                                       n * sizeof(double), NULL, &e1 );
+        gpu->bea    = cl.CreateBuffer( cl.context, CL_MEM_READ_WRITE,
+                                       n * sizeof(double), NULL, &e2 );
+        gpu->bcount = cl.CreateBuffer( cl.context, CL_MEM_READ_WRITE,
+                                       n * sizeof(cl_int), NULL, &e3 );
+        gpu->device = ((e0 == CL_SUCCESS) && (e1 == CL_SUCCESS) &&
+                       (e2 == CL_SUCCESS) && (e3 == CL_SUCCESS));
+        if ( !gpu->device )
+        {
+            const cl_int e[4] = { e0, e1, e2, e3 };
+            cl_mem       b[4] = { gpu->becc, gpu->bma, gpu->bea, gpu->bcount };
+
+            for (int k = 0; k < 4; k++)
+            {
+                if ( e[k] == CL_SUCCESS )
+                {
+                    cl.ReleaseMemObject( b[k] );
+                } // end if
+            } // end for
+        } // end if
+    } // end if
+
+    return( gpu );
+} // end kes_gpu_new
+
+/******************************************************************************/
+
+/*******************************************************************************
+ *  FUNCTION    : kes_gpu_free
+ *  DESCRIPTION : free a batch created by kes_gpu_new()
+ *  INPUT       : pointer "gpu" to batch (may be NULL)
+ *  OUTPUT      : none
+ ******************************************************************************/
+void kes_gpu_free(kes_gpu_t* gpu)
+{
+    if ( gpu == NULL )
+    {
+        return;
+    } // end if
+
+    if ( gpu->device )
+    {
+        cl.Finish( cl.queue );
+        cl.ReleaseMemObject( gpu->becc );
+        cl.ReleaseMemObject( gpu->bma );
+        cl.ReleaseMemObject( gpu->bea );
+        cl.ReleaseMemObject( gpu->bcount );
+    } // end if
+
+    const kes_alloc_t alloc = gpu->alloc;
+    kes_mem_free( &gpu->alloc, gpu->ecc, gpu->bytes );
+    kes_mem_free( &alloc, gpu, sizeof(kes_gpu_t) );
+
+    return;
+} // end kes_gpu_free
+
+/******************************************************************************/
+
+/*******************************************************************************
+ *  FUNCTION    : kes_gpu_upload
+ *  DESCRIPTION : copy inputs to host copy and device buffers of a batch
+ *  INPUT       : - pointer "gpu" to batch
+ *                - array of eccentricities "ecc" (may be NULL)
+ *                - stride "incecc" of array ecc (0 or 1)
+ *                - array of mean anomalies "ma" (may be NULL)
+ *  OUTPUT      : error code from enum kes_err_e
+ ******************************************************************************/
+kes_err_e kes_gpu_upload(
+    kes_gpu_t*    gpu,
+    const double* ecc,
+    const size_t  incecc,
+    const double* ma
+    )
+{
+    if ( (gpu == NULL) || ((ecc != NULL) && (incecc > 1)) )
+    {
+        return( KES_ERR_BADVAL );
+    } // end if
+    if ( gpu->n == 0 )
+    {
+        return( KES_ERR_NOERR );
+    } // end if
+
+    /* NOTE a device copy is outdated by a failed transfer, use the host */
+    if ( ecc != NULL )
+    {
+        gpu->incecc = incecc;
+        memcpy( gpu->ecc, ecc, (incecc ? gpu->n : 1) * sizeof(double) );
+        if ( gpu->device &&
+             (cl.EnqueueWriteBuffer( cl.queue, gpu->becc, CL_TRUE, 0,
+                                     (incecc ? gpu->n : 1) * sizeof(double),
+                                     gpu->ecc, 0, NULL, NULL ) != CL_SUCCESS) )
+        {
+            gpu->device = 0;
+        } // end if
+    } // end if
+
+    if ( ma != NULL )
+    {
+        memcpy( gpu->ma, ma, gpu->n * sizeof(double) );
+        if ( gpu->device &&
+             (cl.EnqueueWriteBuffer( cl.queue, gpu->bma, CL_TRUE, 0,
+                                     gpu->n * sizeof(double), gpu->ma, 0,
+                                     NULL, NULL ) != CL_SUCCESS) )
+        {
+            gpu->device = 0;
+        } // end if
+    } // end if
+
+    gpu->solved = 0;
+
+    return( KES_ERR_NOERR );
+} // end kes_gpu_upload
+
+/******************************************************************************/
+
+/*******************************************************************************
+ *  FUNCTION    : kes_gpu_solve
+ *  DESCRIPTION : solve the resident elements of a batch
+ *  INPUT       : - pointer "gpu" to batch
+ *                - starter method "init" from enum kes_stm_e
+ *                - solver method "iter" from enum kes_sol_e
+ *                - pointer "data" to input parameters (may be NULL)
+ *  OUTPUT      : error code from enum kes_err_e
+ ******************************************************************************/
+kes_err_e kes_gpu_solve(
+    kes_gpu_t*         gpu,
+    const kes_stm_e    init,
+    const kes_sol_e    iter,
+    const kes_input_t* data
+    )
+{
+    kes_err_e err;
+
+    if ( gpu == NULL )
+    {
+        return( KES_ERR_BADVAL );
+    } // end if
+
+    /* private copy of input parameters, check and set defaults once */
+    gpu->work = ((data != NULL) ? *data : kes_new_input());
+    kes_check_input( &gpu->work );
+    gpu->init = init;
+    gpu->iter = iter;
+
+    /* check methods once, NOTE kesolver() works on a copy */
+    kes_input_t probe = gpu->work;
+    kesolver( 0.5, 1.0, init, iter, &probe, &err );
+    if ( err != KES_ERR_NOERR )
+    {
+        gpu->solved = 0;
+        return( err );
+    } // end if
+
+    if ( gpu->device && kes_gpu_supported( init, iter ) &&
+         kes_gpu_launch( gpu ) )
+    {
+        gpu->solved = 1;
+    } // end if
+    else
+    {
+        kes_gpu_host( gpu );
+    } // end else
+
+    return( KES_ERR_NOERR );
+} // end kes_gpu_solve
+
+/******************************************************************************/
+
+/*******************************************************************************
+ *  FUNCTION    : kes_gpu_download
+ *  DESCRIPTION : copy solutions of a batch to the host
+ *  INPUT       : - pointer "gpu" to batch
+ *                - array of solutions "ea"
+ *                - optional arrays "status" and "iterations" (may be NULL)
+ *  OUTPUT      : error code of the first failing element
+ ******************************************************************************/
+kes_err_e kes_gpu_download(
+    kes_gpu_t* gpu,
+    double*    ea,
+    kes_err_e* status,
+    int*       iterations
+    )
+{
+    if ( (gpu == NULL) || (gpu->solved == 0) || (ea == NULL) )
+    {
+        return( KES_ERR_BADVAL );
+    } // end if
+
+    /* results on the device: read back and complete on the host */
+    if ( gpu->solved == 1 )
+    {
+        const cl_int e0 = cl.EnqueueReadBuffer( cl.queue, gpu->bea, CL_TRUE, 0,
+                                                gpu->n * sizeof(double),
+                                                gpu->ea, 0, NULL, NULL );
+        const cl_int e1 = cl.EnqueueReadBuffer( cl.queue, gpu->bcount, CL_TRUE,
+                                                0, gpu->n * sizeof(cl_int),
+                                                gpu->count, 0, NULL, NULL );
+        if ( (e0 == CL_SUCCESS) && (e1 == CL_SUCCESS) )
+        {
+            kes_gpu_fixup( gpu );
+        } // end if
+        else
+        {
+            kes_gpu_host( gpu );
+        } // end else
+    } // end if
+
+    memcpy( ea, gpu->ea, gpu->n * sizeof(double) );
+    if ( status != NULL )
+    {
+        memcpy( status, gpu->status, gpu->n * sizeof(kes_err_e) );
+    } // end if
+    if ( iterations != NULL )
+    {
+        memcpy( iterations, gpu->count, gpu->n * sizeof(int) );
+    } // end if
+
+    return( gpu->err );
+} // end kes_gpu_download
+
+/******************************************************************************/
+
+/*******************************************************************************
+ *  FUNCTION    : kesolver_batch_gpu
+ *  DESCRIPTION : batch solver function with OpenCL offload
+ *  INPUT       : same as kesolver_batch_mt()
+ *  OUTPUT      : error code of the first failing element
+ ******************************************************************************/
+kes_err_e kesolver_batch_gpu(
+    const size_t       n,
+    const double*      ecc,
+    const size_t       incecc,
+    const double*      ma,
+    double*            ea,
+    const kes_stm_e    init,
+    const kes_sol_e    iter,
+    const kes_input_t* data,
+    kes_err_e*         status,
+    int*               iterations
+    )
+{
+    kes_gpu_t* gpu = (((n > 0) && (incecc <= 1) && kes_gpu_available() &&
+                       kes_gpu_supported( init, iter )) ?
+                      kes_gpu_new( n, NULL ) : NULL);
+
+    /* no device, no memory or methods not supported: host only */
+    if ( (gpu == NULL) || !gpu->device )
+    {
+        kes_gpu_free( gpu );
+        return( kesolver_batch_mt( n, ecc, incecc, ma, ea, init, iter, data,
+                                   status, iterations ) );
+    } // end if
+
+    kes_err_e err = kes_gpu_upload( gpu, ecc, incecc, ma );
+    if ( err == KES_ERR_NOERR )
+    {
+        err = kes_gpu_solve( gpu, init, iter, data );
+    } // end if
+    if ( err == KES_ERR_NOERR )
+    {
+        err = kes_gpu_download( gpu, ea, status, iterations );
+    } // end if
+    kes_gpu_free( gpu );
+
+    return( err );
+} // end kesolver_batch_gpu
+
+/******************************************************************************/
@@ -0,0 +1,178 @@
+/***************************************************************************//**
+ * @file    gpu.h
+ * @brief   optional OpenCL offload of batch solver functions
+ * @author  Bazso Akos
+ * @version 2026.10
+ *
+ * @copyright
+ * Copyright (C) 2019 Bazso Akos
+ *
+ * This file is part of libkes.
+ *
+ * libkes is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * libkes is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with libkes.  If not, see <https://www.gnu.org/licenses/>.
+ *
+ ******************************************************************************/
+#pragma once
+#ifndef KES_GPU__H
+#define KES_GPU__H
+
+/* include standard headers */
+#include <stddef.h>
+
+/* include module headers */
+#include "error.h"
+#include "input.h"
+#include "solver.h"
+#include "starter.h"
+
+/******************************************************************************/
+
+/*** declare data structures ***/
+
+/*!
+ * @brief opaque batch of elements resident on an OpenCL device
+ * @details holds eccentricities, mean anomalies and solutions of n elements
+ * in structure-of-arrays layout on the device and a host copy of the
+ * inputs; without a device all functions use the host copy only
+ */
+typedef struct kes_gpu_s kes_gpu_t;
+
+/******************************************************************************/
+
+/*** declare functions ***/
+
+/*!
+ * @brief check for an OpenCL device with double precision
+ * @details the OpenCL library is loaded at runtime on the first call, i.e.
+ * libkes neither needs OpenCL headers at compile time nor the library at
+ * link time; GPUs and accelerators are used, CPU devices are not
+ * @return 1 if a device is available, 0 otherwise
+ */
+int kes_gpu_available(void);
+
+
+/*!
+ * @brief create a batch of n elements
+ * @details device buffers are allocated if a device is available, else
+ * (or if the allocation fails) the batch is solved by the host
+ * @param[in] n number of elements
+ * @param[out] status error code from enum #kes_err_e (or NULL)
+ * @return pointer to new batch, NULL on failure
+ */
+kes_gpu_t* kes_gpu_new(
+    const size_t n,
+    kes_err_e*   status
+);
+
+
+/*!
+ * @brief free a batch created by kes_gpu_new()
+ * @param[in] gpu pointer to batch (or NULL)
+ */
+void kes_gpu_free(kes_gpu_t* gpu);
+
+
+/*!
+ * @brief copy inputs to a batch
+ * @details either array may be NULL to keep the resident values, e.g. new
+ * mean anomalies for the same orbits
+ * @param[in,out] gpu pointer to batch
+ * @param[in] ecc array of eccentricities (or NULL)
+ * @param[in] incecc stride of array \a ecc (0 or 1)
+ * @param[in] ma array of mean anomalies (in radians, or NULL)
+ * @return error code from enum #kes_err_e
+ */
+kes_err_e kes_gpu_upload(
+    kes_gpu_t*    gpu,
+    const double* ecc,
+    const size_t  incecc,
+    const double* ma
+);
+
+
+/*!
+ * @brief solve the resident elements of a batch
+ * @details the device solves elliptic elements by the methods of
+ * Newton-Raphson, Halley, Danby-Burkardt, Markley and Mikkola with the
+ * starters S0 to S4, S6, S7, S12 and S14, other methods and the whole
+ * batch without a device are solved by kesolver_batch_mt(); the call
+ * returns once the work is queued, results are fetched by
+ * kes_gpu_download(); KES_FIX_AUTO iterates until convergence on the
+ * device
+ * @param[in,out] gpu pointer to batch
+ * @param[in] init starter method from enum #kes_stm_e
+ * @param[in] iter solver method from enum #kes_sol_e
+ * @param[in] data pointer to input parameters (or NULL)
+ * @return error code from enum #kes_err_e, KES_ERR_BADSTM or KES_ERR_BADSOL
+ * for invalid methods
+ */
+kes_err_e kes_gpu_solve(
+    kes_gpu_t*         gpu,
+    const kes_stm_e    init,
+    const kes_sol_e    iter,
+    const kes_input_t* data
+);
+
+
+/*!
+ * @brief copy solutions of a batch to the host
+ * @details elements the device does not handle (circular, parabolic,
+ * hyperbolic, near-parabolic and invalid inputs) are solved here by
+ * kesolver_batch(), i.e. with the same results as on the host
+ * @param[in,out] gpu pointer to batch
+ * @param[out] ea array of solutions (in radians)
+ * @param[out] status optional array of per-element error codes (or NULL)
+ * @param[out] iterations optional array of iteration counts (or NULL)
+ * @return error code of the first failing element, KES_ERR_NOERR otherwise
+ */
+kes_err_e kes_gpu_download(
+    kes_gpu_t* gpu,
+    double*    ea,
+    kes_err_e* status,
+    int*       iterations
+);
+
+
+/*!
+ * @brief batch solver function with OpenCL offload
+ * @details same interface as kesolver_batch_mt(), i.e. upload, solve and
+ * download of a temporary batch, or kesolver_batch_mt() without a device
+ * @param[in] n number of elements
+ * @param[in] ecc array of eccentricities
+ * @param[in] incecc stride of array ecc (0 or 1)
+ * @param[in] ma array of mean anomalies (in radians)
+ * @param[out] ea array of solutions (in radians)
+ * @param[in] init method for starting value from enum #kes_stm_e
+ * @param[in] iter method for iterative solver from enum #kes_sol_e
+ * @param[in] data pointer to input parameters (or NULL)
+ * @param[out] status optional array of per-element error codes (or NULL)
+ * @param[out] iterations optional array of iteration counts (or NULL)
+ * @return error code of the first failing element, KES_ERR_NOERR otherwise
+ */
+kes_err_e kesolver_batch_gpu(
+    const size_t       n,
+    const double*      ecc,
+    const size_t       incecc,
+    const double*      ma,
+    double*            ea,
+    const kes_stm_e    init,
+    const kes_sol_e    iter,
+    const kes_input_t* data,
+    kes_err_e*         status,
+    int*               iterations
+);
+
+/******************************************************************************/
+
+#endif  /* KES_GPU__H */
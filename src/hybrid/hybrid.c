@@ -0,0 +1,191 @@
+/*******************************************************************************
+ * @file    hybrid.c
+ * @brief   solver method KES_SOL_HYBRID = safeguarded hybrid method
+ * @author  Bazso Akos
+ * @version 1.0, 14 Oct 2026
+ *
+ * @copyright
+ * Copyright (C) 2019 Bazso Akos
+ *
+ * This file is part of libkes.
+ *
+ * libkes is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * libkes is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with libkes.  If not, see <https://www.gnu.org/licenses/>.
+ *
+ ******************************************************************************/
+/* include standard headers */
+#include <float.h>
+#include <math.h>
+
+/* include module headers */
+#include "hybrid.h"
+#include "const.h"
+#include "debug.h"
+#include "trace.h"
+#include "itercore.h"
+#include "kepeq.h"
+
+/******************************************************************************/
+
+/*******************************************************************************
+ *  FUNCTION    : hybrid
+ *  DESCRIPTION : Danby-Burkardt steps of order 5 within a bracket, with
+ *                secant and bisection steps as safeguard
+ *  INPUT       : - eccentricity "ecc"
+ *                - mean anomaly "ma" in radians
+ *                - "starter" value for first iteration
+ *                - "res" for results
+ *  OUTPUT      : number of iterations
+ ******************************************************************************/
+int hybrid(
+    const double ecc,
+    const double ma,
+    const double starter,
+    kes_input_t* res
+    )
+{
+    register int count = 0;      /* iteration counter */
+    double       deltax, deltaf; /* error residuals */
+    double       xnew, xold, fx; /* iteration variables, fx = f(xold) */
+    double       lo, hi;         /* bracket of the root */
+    double       flo, fhi;       /* f(lo), f(hi), NAN if not evaluated */
+    double       fold;           /* |f| of the previous iterate */
+    int          safe;           /* last step was a safeguard step ? */
+    int          done;           /* predicted error below tolerance ? */
+    double       sc[2];          /* e*sin, e*cos of xold */
+
+    /* correction factor for absolute error deltaf (precomputed if available) */
+    const double corr = ((res->terms != NULL) ?
+                         res->terms->corr : ecc / (1.0 - ecc));
+
+    /* reset error residuals */
+    deltax = deltaf = 0.0;
+    res->nbrSinEval = res->nbrCosEval = res->nbrFktEval = 0;
+
+    /* trace iteration process? */
+    const int trace = kes_trace_begin();
+    kes_trace_step( trace, KES_SOL_HYBRID, 0, ecc, ma, starter, 0.0, 0.0 );
+
+    /* bracket from starters S4, S6, S7, i.e. without sin/cos, the residuals
+     * of the bounds are known once they are replaced by iterates;
+     * NOTE the upper bound is attained at M = pi/2 - e, widen by roundoff
+     */
+    lo  = ma;
+    hi  = fmin( fmin( ma / (1.0 - ecc), ma + ecc ),
+                (ma + ecc * M_PI) / (1.0 + ecc) );
+    hi += 4.0 * DBL_EPSILON * hi;
+    flo = fhi = NAN;
+
+    /* use starter for initializing iteration, limited to the bracket */
+    xnew = (isnan(starter) ? 0.5 * (lo + hi) :
+            ((starter < lo) ? lo : ((starter > hi) ? hi : starter)));
+    fold = HUGE_VAL;
+    safe = 0;
+
+    /* NOTE fixed iterations are bounded by the safeguard as well */
+    const int fixed = (res->fixiter > 0);
+
+    /* main iteration loop */
+    do
+    {
+        xold = xnew;
+
+        /* call DANBUR5 iteration method, also returns -f(xold) */
+        xnew = kes_itercore5_sc( ecc, ma, xold, &fx, sc );
+        ++(res->nbrSinEval); ++(res->nbrCosEval); ++(res->nbrFktEval);
+        fx   = -fx;
+
+        ++count;
+
+        /* shrink bracket by the evaluated iterate, f(E) is increasing */
+        if ( fx < 0.0 )
+        {
+            lo = xold;  flo = fx;
+        } // end if
+        else
+        {
+            hi = xold;  fhi = fx;
+        } // end else
+
+        /* safeguard: step leaves the bracket, or the residual did not
+         * decrease by half, e.g. oscillations or slow progress from a far
+         * starter for ecc close to 1 (unless the step is below tolerance)
+         */
+        const int bad = (!((xnew >= lo) && (xnew <= hi)) ||
+                         ((fabs(fx) > 0.5 * fold) &&
+                          (fabs(xnew - xold) > res->tolx)));
+        if ( bad )
+        {
+            const double xm = 0.5 * (lo + hi);
+
+            /* secant step between the bounds if both are evaluated, else
+             * evaluate the bound which the step exceeded (tight at
+             * E = pi/2); bisection after another safeguard step
+             */
+            if ( !safe && !isnan(flo) && !isnan(fhi) )
+            {
+                const double xs = lo - flo * (hi - lo) / (fhi - flo);
+                xnew = (((xs > lo) && (xs < hi)) ? xs : xm);
+            } // end if
+            else if ( !safe && (xnew > hi) && isnan(fhi) )
+            {
+                xnew = hi;
+            } // end if
+            else if ( !safe && (xnew < lo) && isnan(flo) )
+            {
+                xnew = lo;
+            } // end if
+            else
+            {
+                xnew = xm;
+            } // end else
+            fold = HUGE_VAL;
+        } // end if
+        else
+        {
+            fold = fabs(fx);
+        } // end else
+        safe = bad;
+
+        /* update error residuals, after a safeguard step only the width
+         * of the bracket bounds the error
+         */
+        deltax = (safe ? hi - lo : fabs(xnew - xold));
+        deltaf = fabs(fx) * corr;
+
+        /* order 5 predicts the error of xnew, see kes_set_stop() */
+        done   = (!safe) && kes_stop_order( res->stop, 5, ecc, xnew,
+                                            deltax, res->tolx );
+
+        kes_trace_step( trace, KES_SOL_HYBRID, count, ecc, ma,
+                        xnew, deltax, deltaf );
+    } while (
+        fixed ? (count < res->fixiter) :
+        ((deltax > res->tolx) &&
+         (deltaf > res->tolf) &&
+         (!done) &&
+         (count  < res->maxiter))
+    ); // end do
+
+    /* results, the evaluated iterate after a safeguard step;
+     * sin/cos of the last step
+     */
+    res->result = (safe ? xold : xnew);
+    res->errDF  = deltaf;
+    res->errDX  = deltax;
+    kes_trig_keep( res, xold, sc[0], sc[1] );
+
+    return( count );
+} // end hybrid
+
+/******************************************************************************/
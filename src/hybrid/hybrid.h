@@ -0,0 +1,73 @@
+/***************************************************************************//**
+ * @file    hybrid.h
+ * @brief   safeguarded hybrid method (Danby-Burkardt steps within a bracket)
+ * @details the fast step after description in:
+ * Danby & Burkardt (1983), Celest. Mech. 31, p.95-107;
+ * safeguarding as in Press et al. (2007), Numerical Recipes, 3rd ed., 9.4
+ * @author  Bazso Akos
+ *
+ * @copyright
+ * Copyright (C) 2019 Bazso Akos
+ *
+ * This file is part of libkes.
+ *
+ * libkes is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * libkes is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with libkes.  If not, see <https://www.gnu.org/licenses/>.
+ *
+ ******************************************************************************/
+#pragma once
+#ifndef KES_SOL_HYBRID__H
+#define KES_SOL_HYBRID__H
+
+/* include module headers */
+#include "input.h"
+
+/******************************************************************************/
+
+/*** function declarations ***/
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/*!
+ * @brief iteration function for the safeguarded hybrid method
+ * @details each iteration takes the Danby-Burkardt step of order 5 from the
+ * current iterate, whose residual shrinks a bracket of the root that starts
+ * from the bounds M <= E <= min{M/(1-e), M+e, (M+e*pi)/(1+e)}; if the step
+ * leaves the bracket or the residual did not decrease by half, a
+ * secant step between the bounds, or the exceeded bound if its residual is
+ * not known yet, is taken instead, and bisection after another such step, i.e. the number of iterations stays bounded for any
+ * starter; the residual of each iterate comes with its step, see
+ * KES_CONV_LEAN
+ * @param[in] ecc eccentricity
+ * @param[in] ma reduced mean anomaly (0 <= ma <= pi)
+ * @param[in] starter starting value for first iteration (limited to the
+ * bracket)
+ * @param[out] res iteration results and statistics
+ * @return number of iterations
+ */
+int hybrid(
+    const double ecc,
+    const double ma,
+    const double starter,
+    kes_input_t* res
+);
+
+#ifdef __cplusplus
+}
+#endif
+
+/******************************************************************************/
+
+#endif  /* KES_SOL_HYBRID__H */
@@ -0,0 +1,758 @@
+/***************************************************************************//**
+ * @file    hyperb.c
+ * @brief   starter and iteration methods for hyperbolic Kepler Equation
+ * @details the iterations solve f(H) = e*sinh(H) - H - M = 0 for M >= 0,
+ *          negative mean anomalies follow from the symmetry H(-M) = -H(M);
+ *          sinh and cosh use the same polynomial kernel in the scalar and
+ *          in the vectorized solver, such that both give identical results
+ * @author  Bazso Akos
+ * @version 2026.10
+ *
+ * @copyright
+ * Copyright (C) 2019 Bazso Akos
+ *
+ * This file is part of libkes.
+ *
+ * libkes is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * libkes is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with libkes.  If not, see <https://www.gnu.org/licenses/>.
+ *
+ ******************************************************************************/
+
+/* include standard headers */
+#include <math.h>
+#include <stdio.h>
+
+/* include module headers */
+#include "hyperb.h"
+#include "trace.h"
+#include "vecmath.h"
+#include "vecore.h"
+
+/******************************************************************************/
+
+/* use verbose debug output? 0 = no (default), 1 = yes */
+#define KES_HYPERB_DEBUG 0
+
+/******************************************************************************/
+
+/* tiny increment to denominator, same as in module itercore.c */
+static const double addzero = 1.0e-19;
+
+/* range of the error bounds of the starters KES_HSTM_CUBIC (H < 0.5) and
+ * KES_HSTM_ASINH, KES_HSTM_LOG (M/e > 10), see kes_starter_hyp()
+ */
+static const double hstm_cubic_max = 0.5;
+static const double hstm_large_ma  = 10.0;
+
+/* fixed number of iterations selected by KES_FIX_AUTO for each hyperbolic
+ * starter method; worst case reaching KES_STD_TOL (relative to H) on a dense
+ * grid in 1+1E-9 <= ecc <= 1+1E4, 0 <= ma <= 1E300 plus one iteration as
+ * margin, 0 = iterate until convergence if the worst case exceeds 10;
+ * rows: starters from enum kes_hstm_e,
+ * columns: order 2 (Newton-Raphson), 3 (Halley), 4 and 5 (Danby-Burkardt)
+ */
+static const int list_of_hypfix[KES_HSTM_TOTAL][4] = {
+    {5, 3, 3, 3}, /* KES_HSTM_BOUND */
+    {0, 0, 0, 0}, /* KES_HSTM_CUBIC */
+    {0, 0, 0, 0}, /* KES_HSTM_ASINH */
+    {0, 0, 0, 0}  /* KES_HSTM_LOG   */
+};
+
+/******************************************************************************/
+
+/*******************************************************************************
+ *  FUNCTION    : kes_hstm_cubic
+ *  DESCRIPTION : root of the cubic approximation of Kepler Equation
+ *  INPUT       : - eccentricity "ecc" (ecc > 1)
+ *                - mean anomaly "ma" (ma >= 0)
+ *  OUTPUT      : upper bound of the solution
+ ******************************************************************************/
+static inline double kes_hstm_cubic(
+    const double ecc,
+    const double ma
+    )
+{
+    /* cubic equation H^3 + 3*p*H - 2*q = 0 from the series
+     * e*sinh(H) - H = (e-1)*H + e*H^3/6 + O(H^5)
+     */
+    const double p = 2.0 * (ecc - 1.0) / ecc;
+    const double q = 3.0 * ma / ecc;
+
+    /* NOTE avoid overflow of q^2 for huge mean anomalies,
+     * dropping the linear term gives a larger root
+     */
+    double       s = kes_vec_cbrt( kes_vec_blend( q - 1E150,
+                         q + kes_vec_sqrt( q * q + p * p * p ), 2.0 * q ) );
+
+    /* root H = s - p/s without cancellation, NOTE all neglected terms of
+     * the series are positive, i.e. the root is an upper bound
+     */
+    s *= s;
+    return( 2.0 * q / (s + p + p * p / s) );
+} // end kes_hstm_cubic
+
+/******************************************************************************/
+
+/*******************************************************************************
+ *  FUNCTION    : kes_hstm_core
+ *  DESCRIPTION : starter methods for hyperbolic Kepler Equation, methods
+ *                other than KES_HSTM_BOUND fall back to it outside of the
+ *                range of their error bounds
+ *  INPUT       : - starter method "type" from enum kes_hstm_e
+ *                - eccentricity "ecc" (ecc > 1)
+ *                - mean anomaly "ma" (ma >= 0)
+ *  OUTPUT      : starting value
+ ******************************************************************************/
+static inline double kes_hstm_core(
+    const kes_hstm_e type,
+    const double     ecc,
+    const double     ma
+    )
+{
+    /* one fixed-point step from the cubic upper bound is another
+     * upper bound, which is much closer for large mean anomalies
+     */
+    const double h = kes_hstm_cubic( ecc, ma );
+    const double a = kes_vec_asinh( (ma + h) / ecc );
+    const double b = kes_vec_blend( a - h, a, h );
+
+    switch ( type )
+    {
+        /* cubic approximation alone, NOTE only for small H, it grows like
+         * M^(1/3) instead of ln(M)
+         */
+        case KES_HSTM_CUBIC:
+            return( kes_vec_blend( h - hstm_cubic_max, h, b ) );
+
+        /* NOTE H = asinh((M + H) / e) increases with H, i.e. fixed-point
+         * steps from H = 0 stay below the solution; only for large M/e,
+         * after an overshoot from a poor lower bound the iterations of
+         * higher order run away for e close to 1
+         */
+        case KES_HSTM_ASINH:
+            return( kes_vec_blend( hstm_large_ma * ecc - ma,
+                        kes_vec_asinh( (ma + kes_vec_asinh( ma / ecc )) /
+                                       ecc ), b ) );
+
+        /* asymptotic form H = ln(2*M/e + 1.8), NOTE only for large M/e */
+        case KES_HSTM_LOG:
+            return( kes_vec_blend( hstm_large_ma * ecc - ma,
+                        kes_vec_log1p( 2.0 * ma / ecc + 0.8 ), b ) );
+
+        /* smaller of both upper bounds */
+        default:
+            return( b );
+    } // end switch
+} // end kes_hstm_core
+
+/******************************************************************************/
+
+/*******************************************************************************
+ *  FUNCTION    : kes_stm_hyp
+ *  DESCRIPTION : starter for hyperbolic Kepler Equation
+ *  INPUT       : - eccentricity "ecc" (ecc > 1)
+ *                - mean anomaly "ma" (ma >= 0)
+ *  OUTPUT      : starting value, upper bound of the solution
+ ******************************************************************************/
+double kes_stm_hyp(
+    const double ecc,
+    const double ma
+    )
+{
+    return( kes_hstm_core( KES_HSTM_BOUND, ecc, ma ) );
+} // end kes_stm_hyp
+
+/******************************************************************************/
+
+/*******************************************************************************
+ *  FUNCTION    : kes_vstm_hyp
+ *  DESCRIPTION : vectorized starter methods for hyperbolic Kepler Equation
+ *  INPUT       : - starter method "type" from enum kes_hstm_e
+ *                - eccentricities "ecc" (ecc > 1)
+ *                - mean anomalies "ma" (ma >= 0)
+ *                - starting values "x"
+ *  OUTPUT      : none
+ ******************************************************************************/
+KES_VEC_DISPATCH
+void kes_vstm_hyp(
+    const kes_hstm_e       type,
+    const double* restrict ecc,
+    const double* restrict ma,
+    double* restrict       x
+    )
+{
+    /* NOTE constant method in each loop allows vectorization */
+    switch ( type )
+    {
+        case KES_HSTM_CUBIC:
+            for (int l = 0; l < KES_VEC_LEN; l++)
+            {
+                x[l] = kes_hstm_core( KES_HSTM_CUBIC, ecc[l], ma[l] );
+            } // end for
+            break;
+
+        case KES_HSTM_ASINH:
+            for (int l = 0; l < KES_VEC_LEN; l++)
+            {
+                x[l] = kes_hstm_core( KES_HSTM_ASINH, ecc[l], ma[l] );
+            } // end for
+            break;
+
+        case KES_HSTM_LOG:
+            for (int l = 0; l < KES_VEC_LEN; l++)
+            {
+                x[l] = kes_hstm_core( KES_HSTM_LOG, ecc[l], ma[l] );
+            } // end for
+            break;
+
+        default:
+            for (int l = 0; l < KES_VEC_LEN; l++)
+            {
+                x[l] = kes_hstm_core( KES_HSTM_BOUND, ecc[l], ma[l] );
+            } // end for
+            break;
+    } // end switch
+} // end kes_vstm_hyp
+
+/******************************************************************************/
+
+/*******************************************************************************
+ *  FUNCTION    : kes_starter_hyp
+ *  DESCRIPTION : starting value of chosen hyperbolic starter method
+ *  INPUT       : - eccentricity "ecc" (ecc > 1)
+ *                - mean anomaly "ma"
+ *                - starter method "type" from enum kes_hstm_e
+ *                - pointer "status" to return error code
+ *  OUTPUT      : starting value H0
+ ******************************************************************************/
+double kes_starter_hyp(
+    const double     ecc,
+    const double     ma,
+    const kes_hstm_e type,
+    kes_err_e*       status
+    )
+{
+    /* exception: check starter method type */
+    if ( (type < KES_HSTM_BOUND) || (type >= KES_HSTM_TOTAL) )
+    {
+        *status = KES_ERR_BADSTM;
+        return( 0.0 );
+    } // end if
+
+    /* exception: check eccentricity */
+    if ( !(ecc > 1.0) || isinf(ecc) )
+    {
+        *status = KES_ERR_BADECC;
+        return( 0.0 );
+    } // end if
+
+    /* apply symmetry H(-M) = -H(M) */
+    *status = KES_ERR_NOERR;
+    return( copysign( kes_hstm_core( type, ecc, fabs(ma) ), ma ) );
+} // end kes_starter_hyp
+
+/******************************************************************************/
+
+/*******************************************************************************
+ *  FUNCTION    : kes_starter_hyp_batch
+ *  DESCRIPTION : evaluate chosen hyperbolic starter method for arrays of
+ *                elements in blocks of KES_VEC_LEN elements
+ *  INPUT       : - number of elements "n"
+ *                - array of eccentricities "ecc" with stride "incecc"
+ *                  (0 = common eccentricity)
+ *                - array of mean anomalies "ma" in radians
+ *                - array "x" to return the starting values
+ *                - starter method "type" from list kes_hstm_e
+ *  OUTPUT      : error code (see error.h)
+ ******************************************************************************/
+kes_err_e kes_starter_hyp_batch(
+    const size_t     n,
+    const double*    ecc,
+    const size_t     incecc,
+    const double*    ma,
+    double*          x,
+    const kes_hstm_e type
+    )
+{
+    double    lecc[KES_VEC_LEN]; /* eccentricities of lanes */
+    double    lma[KES_VEC_LEN];  /* |mean anomalies| of lanes */
+    double    lx[KES_VEC_LEN];   /* starting values of lanes */
+    kes_err_e err = KES_ERR_NOERR;
+
+    /* exception: check starter method type */
+    if ( (type < KES_HSTM_BOUND) || (type >= KES_HSTM_TOTAL) )
+    {
+        for (size_t i = 0; i < n; i++)
+        {
+            x[i] = 0.0;
+        } // end for
+
+        return( KES_ERR_BADSTM );
+    } // end if
+
+    for (size_t i0 = 0; i0 < n; i0 += KES_VEC_LEN)
+    {
+        const int lanes = ((n - i0 > KES_VEC_LEN) ?
+                           KES_VEC_LEN : (int)(n - i0));
+
+        /* collect lanes, replace invalid eccentricities and unused lanes
+         * with harmless dummy values
+         */
+        for (int l = 0; l < KES_VEC_LEN; l++)
+        {
+            const double e = ((l < lanes) ? ecc[(i0 + l) * incecc] : 2.0);
+            lecc[l] = (((e > 1.0) && !isinf(e)) ? e : 2.0);
+            lma[l]  = ((l < lanes) ? fabs(ma[i0 + l]) : 1.0);
+        } // end for
+
+        kes_vstm_hyp( type, lecc, lma, lx );
+
+        /* apply symmetry H(-M) = -H(M), zero for invalid eccentricities */
+        for (int l = 0; l < lanes; l++)
+        {
+            const double e = ecc[(i0 + l) * incecc];
+            if ( (e > 1.0) && !isinf(e) )
+            {
+                x[i0 + l] = copysign( lx[l], ma[i0 + l] );
+            } // end if
+            else
+            {
+                x[i0 + l] = 0.0;
+                err       = ((err == KES_ERR_NOERR) ? KES_ERR_BADECC : err);
+            } // end else
+        } // end for
+    } // end for
+
+    return( err );
+} // end kes_starter_hyp_batch
+
+/******************************************************************************/
+
+/*******************************************************************************
+ *  FUNCTION    : kes_hyp_order
+ *  DESCRIPTION : order of iteration method used for the hyperbolic case
+ *  INPUT       : solver method "iter" from enum kes_sol_e
+ *  OUTPUT      : order of iteration method (2 <= order <= 5)
+ ******************************************************************************/
+int kes_hyp_order(
+    const kes_sol_e iter
+    )
+{
+    switch ( iter )
+    {
+        case KES_SOL_NEWRAP:  return( 2 );
+        case KES_SOL_HALLEY:  return( 3 );
+        case KES_SOL_DANBUR4: return( 4 );
+
+        /* methods of order 5 */
+        case KES_SOL_DANBUR5:
+        case KES_SOL_HYBRID:
+        case KES_SOL_MARKLEY:
+        case KES_SOL_MIKKOLA:
+            return( 5 );
+
+        /* NOTE no hyperbolic variant, fall back to Halley's method */
+        default:
+            return( 3 );
+    } // end switch
+} // end kes_hyp_order
+
+/******************************************************************************/
+
+/*******************************************************************************
+ *  FUNCTION    : kes_hyp_solver
+ *  DESCRIPTION : solver method matching an order of iteration, inverse of
+ *                kes_hyp_order() for tracing
+ *  INPUT       : "order" of iteration method (2 <= order <= 5)
+ *  OUTPUT      : solver method from enum kes_sol_e
+ ******************************************************************************/
+kes_sol_e kes_hyp_solver(
+    const int order
+    )
+{
+    static const kes_sol_e list_of_hypsol[4] = {
+        KES_SOL_NEWRAP, KES_SOL_HALLEY, KES_SOL_DANBUR4, KES_SOL_DANBUR5
+    };
+
+    return( list_of_hypsol[order - 2] );
+} // end kes_hyp_solver
+
+/******************************************************************************/
+
+/*******************************************************************************
+ *  FUNCTION    : kes_hyp_fixiter
+ *  DESCRIPTION : resolve fixed number of iterations for hyperbolic case
+ *  INPUT       : - "order" of iteration method (2 <= order <= 5)
+ *                - hyperbolic starter method "hinit" from enum kes_hstm_e
+ *                - user defined value "fixiter"
+ *  OUTPUT      : number of iterations (0 = iterate until convergence)
+ ******************************************************************************/
+int kes_hyp_fixiter(
+    const int        order,
+    const kes_hstm_e hinit,
+    const int        fixiter
+    )
+{
+    return( (fixiter != KES_FIX_AUTO) ? fixiter :
+                                        list_of_hypfix[hinit][order - 2] );
+} // end kes_hyp_fixiter
+
+/******************************************************************************/
+
+/*** REFERENCE : Danby & Burkardt (1983), Celestial Mechanics 31, p.95-107 ***/
+
+/*******************************************************************************
+ *  FUNCTION    : kes_hyp_core
+ *  DESCRIPTION : iteration methods of order 2 to 5 for hyperbolic case
+ *  INPUT       : - order of iteration method (2 <= order <= 5)
+ *                - eccentricity "ecc"
+ *                - mean anomaly "ma"
+ *                - old value of iteration variable "x0"
+ *  OUTPUT      : update to iteration variable x0+dx
+ ******************************************************************************/
+static inline double kes_hyp_core(
+    const int    order,
+    const double ecc,
+    const double ma,
+    const double x0
+    )
+{
+    double shm, chm; /* sinh(x) - x, cosh(x) - 1 */
+    double dx;       /* increment deltax */
+
+    /* calculate sinh, cosh */
+    kes_vec_sinhcoshm( &shm, &chm, x0 );
+    const double e1  = ecc - 1.0;
+    const double esx = ecc * (shm + x0);
+    const double ecx = ecc * (chm + 1.0);
+
+    /* evaluate Kepler Equation: 0th and 1st derivative,
+     * NOTE e*sinh(x) - x = (e-1)*sinh(x) + (sinh(x)-x) and
+     *      e*cosh(x) - 1 = (e-1)*cosh(x) + (cosh(x)-1) avoid cancellation
+     *      for small x in the near-parabolic case
+     */
+    const double f0 = ma - e1 * (shm + x0) - shm;
+    const double f1 = e1 * (chm + 1.0) + chm + addzero;
+
+    /* delta1: eq. (16) */
+    dx = f0 / f1;
+
+    if ( order >= 3 )
+    {
+        /* delta2: eq. (17) */
+        const double f2 = esx / 2.0;
+        dx = f0 / (f1 + dx * f2);
+
+        if ( order >= 4 )
+        {
+            /* delta3: eq. (18) */
+            const double f3 = ecx / 6.0;
+            dx = f0 / (f1 + dx * (f2 + dx * f3));
+
+            if ( order >= 5 )
+            {
+                /* delta4: eq. (19) */
+                const double f4 = esx / 24.0;
+                dx = f0 / (f1 + dx * (f2 + dx * (f3 + dx * f4)));
+            } // end if
+        } // end if
+    } // end if
+
+    return( x0 + dx );
+} // end kes_hyp_core
+
+/******************************************************************************/
+
+/*******************************************************************************
+ *  FUNCTION    : kes_hyp_keq
+ *  DESCRIPTION : evaluate hyperbolic Kepler Equation without cancellation
+ *  INPUT       : - eccentricity "ecc"
+ *                - mean anomaly "ma"
+ *                - hyperbolic eccentric anomaly "x"
+ *  OUTPUT      : result of ecc*sinh(x) - x - ma
+ ******************************************************************************/
+static inline double kes_hyp_keq(
+    const double ecc,
+    const double ma,
+    const double x
+    )
+{
+    double shm, chm;
+    kes_vec_sinhcoshm( &shm, &chm, x );
+    return( (ecc - 1.0) * (shm + x) + shm - ma );
+} // end kes_hyp_keq
+
+/******************************************************************************/
+
+/*******************************************************************************
+ *  FUNCTION    : kes_hypiter
+ *  DESCRIPTION : iterative solver for hyperbolic Kepler Equation
+ *  INPUT       : - "order" of iteration method (2 <= order <= 5)
+ *                - eccentricity "ecc"
+ *                - mean anomaly "ma" (ma >= 0)
+ *                - "starter" value for first iteration
+ *                - pointer "data" for results
+ *  OUTPUT      : number of iterations
+ ******************************************************************************/
+int kes_hypiter(
+    const int    order,
+    const double ecc,
+    const double ma,
+    const double starter,
+    kes_input_t* data
+    )
+{
+    register int count = 0;      /* iteration counter */
+    double       deltax, deltaf; /* error residuals */
+    double       xnew, xold, fx; /* iteration variables */
+
+    /* correction factor for absolute error deltaf */
+    const double corr = ecc / (ecc - 1.0);
+
+    /* reset error residuals */
+    deltax = deltaf = 0.0;
+    data->nbrSinEval = data->nbrCosEval = data->nbrFktEval = 0;
+
+    /* use starter for initializing iteration */
+    xnew = starter;
+
+    /* trace iteration process? */
+    const kes_sol_e solver = kes_hyp_solver( order );
+    const int       trace  = kes_trace_begin();
+    kes_trace_step( trace, solver, 0, ecc, ma, starter, 0.0, 0.0 );
+
+    /* fixed number of iterations without evaluation of residuals */
+    if ( data->fixiter > 0 )
+    {
+        do
+        {
+            xold = xnew;
+            xnew = kes_hyp_core( order, ecc, ma, xold );
+            ++(data->nbrFktEval);
+            ++count;
+        } while ( count < data->fixiter ); // end do
+
+        /* results */
+        data->result = xnew;
+        data->errDF  = 0.0;
+        data->errDX  = fabs(xnew - xold);
+
+        return( count );
+    } // end if
+
+    /* main iteration loop */
+    do
+    {
+        xold = xnew;
+        xnew = kes_hyp_core( order, ecc, ma, xold );
+        ++(data->nbrFktEval);
+        fx   = kes_hyp_keq( ecc, ma, xnew );
+        ++(data->nbrFktEval);
+
+        ++count;
+
+        /* update error residuals */
+        deltax = fabs(xnew - xold);
+        deltaf = fabs(fx) * corr;
+
+        kes_trace_step( trace, solver, count, ecc, ma, xnew, deltax, deltaf );
+#if KES_HYPERB_DEBUG
+    fprintf(stdout, "%s: count = %d, deltax = %g, deltaf = %g\n",
+            __func__, count, deltax, deltaf);
+#endif
+    } while (
+        (deltax > data->tolx * fmax(1.0, xnew)) &&
+        (deltaf > data->tolf) &&
+        (count  < data->maxiter)
+    ); // end do
+
+    /* results */
+    data->result = xnew;
+    data->errDF  = deltaf;
+    data->errDX  = deltax;
+
+    return( count );
+} // end kes_hypiter
+
+/******************************************************************************/
+
+/*******************************************************************************
+ *  FUNCTION    : kes_vhypcore
+ *  DESCRIPTION : vectorized iteration methods for hyperbolic case
+ *  INPUT       : - order of iteration method (2 <= order <= 5)
+ *                - eccentricities "ecc"
+ *                - mean anomalies "ma"
+ *                - old values of iteration variable "x0"
+ *                - new values of iteration variable "x1"
+ *  OUTPUT      : none
+ ******************************************************************************/
+KES_VEC_DISPATCH
+static void kes_vhypcore(
+    const int              order,
+    const double* restrict ecc,
+    const double* restrict ma,
+    const double* restrict x0,
+    double* restrict       x1
+    )
+{
+    /* NOTE constant order in each loop allows vectorization */
+    switch ( order )
+    {
+        case 2:
+            for (int l = 0; l < KES_VEC_LEN; l++)
+            {
+                x1[l] = kes_hyp_core( 2, ecc[l], ma[l], x0[l] );
+            } // end for
+            break;
+
+        case 3:
+            for (int l = 0; l < KES_VEC_LEN; l++)
+            {
+                x1[l] = kes_hyp_core( 3, ecc[l], ma[l], x0[l] );
+            } // end for
+            break;
+
+        case 4:
+            for (int l = 0; l < KES_VEC_LEN; l++)
+            {
+                x1[l] = kes_hyp_core( 4, ecc[l], ma[l], x0[l] );
+            } // end for
+            break;
+
+        default:
+            for (int l = 0; l < KES_VEC_LEN; l++)
+            {
+                x1[l] = kes_hyp_core( 5, ecc[l], ma[l], x0[l] );
+            } // end for
+            break;
+    } // end switch
+} // end kes_vhypcore
+
+/******************************************************************************/
+
+/*******************************************************************************
+ *  FUNCTION    : kes_vkeq_hyp
+ *  DESCRIPTION : vectorized evaluation of hyperbolic Kepler Equation
+ *  INPUT       : - eccentricities "ecc"
+ *                - mean anomalies "ma"
+ *                - hyperbolic eccentric anomalies "x"
+ *                - results "fx" of ecc*sinh(x) - x - ma
+ *  OUTPUT      : none
+ ******************************************************************************/
+KES_VEC_DISPATCH
+static void kes_vkeq_hyp(
+    const double* restrict ecc,
+    const double* restrict ma,
+    const double* restrict x,
+    double* restrict       fx
+    )
+{
+    for (int l = 0; l < KES_VEC_LEN; l++)
+    {
+        fx[l] = kes_hyp_keq( ecc[l], ma[l], x[l] );
+    } // end for
+} // end kes_vkeq_hyp
+
+/******************************************************************************/
+
+/*******************************************************************************
+ *  FUNCTION    : kes_vsolve_hyp
+ *  DESCRIPTION : vectorized solver for hyperbolic Kepler Equation,
+ *                lanes are iterated until all of them have converged
+ *  INPUT       : - "order" of iteration method (2 <= order <= 5)
+ *                - eccentricities "ecc"
+ *                - mean anomalies "ma" (ma >= 0)
+ *                - "starter" values
+ *                - solutions "x"
+ *                - number of iterations "count"
+ *                - pointer "data" to input parameters
+ *  OUTPUT      : none
+ ******************************************************************************/
+void kes_vsolve_hyp(
+    const int              order,
+    const double* restrict ecc,
+    const double* restrict ma,
+    const double* restrict starter,
+    double* restrict       x,
+    int* restrict          count,
+    const kes_input_t*     data
+    )
+{
+    double xnew[KES_VEC_LEN]; /* updated iteration variables */
+    double fx[KES_VEC_LEN];   /* residuals of Kepler Equation */
+    double corr[KES_VEC_LEN]; /* correction factors for deltaf */
+    int    todo[KES_VEC_LEN]; /* lane is still iterating? */
+
+    /* fixed number of iterations without evaluation of residuals */
+    if ( data->fixiter > 0 )
+    {
+        kes_vhypcore( order, ecc, ma, starter, x );
+        for (int n = 1; n < data->fixiter; n++)
+        {
+            kes_vhypcore( order, ecc, ma, x, xnew );
+            for (int l = 0; l < KES_VEC_LEN; l++)
+            {
+                x[l] = xnew[l];
+            } // end for
+        } // end for
+
+        for (int l = 0; l < KES_VEC_LEN; l++)
+        {
+            count[l] = data->fixiter;
+        } // end for
+
+        return;
+    } // end if
+
+    /* initialize lanes */
+    for (int l = 0; l < KES_VEC_LEN; l++)
+    {
+        x[l]     = starter[l];
+        count[l] = 0;
+        todo[l]  = 1;
+        corr[l]  = ecc[l] / (ecc[l] - 1.0);
+    } // end for
+
+    /* main iteration loop, same stopping criteria as kes_hypiter() */
+    const double tolx    = data->tolx;
+    const double tolf    = data->tolf;
+    const int    maxiter = data->maxiter;
+    int          active;
+
+    do
+    {
+        kes_vhypcore( order, ecc, ma, x, xnew );
+        kes_vkeq_hyp( ecc, ma, xnew, fx );
+
+        active = 0;
+        for (int l = 0; l < KES_VEC_LEN; l++)
+        {
+            /* update error residuals */
+            const double deltax = fabs(xnew[l] - x[l]);
+            const double deltaf = fabs(fx[l]) * corr[l];
+
+            /* converged lanes keep their results */
+            x[l]     = (todo[l] ? xnew[l] : x[l]);
+            count[l] += todo[l];
+            todo[l]  = todo[l] &&
+                       (deltax   > tolx * fmax(1.0, xnew[l])) &&
+                       (deltaf   > tolf) &&
+                       (count[l] < maxiter);
+            active  |= todo[l];
+        } // end for
+    } while ( active ); // end do
+
+    return;
+} // end kes_vsolve_hyp
+
+/******************************************************************************/
@@ -0,0 +1,206 @@
+/***************************************************************************//**
+ * @file    hyperb.h
+ * @brief   starter and iteration methods for hyperbolic Kepler Equation
+ * @author  Bazso Akos
+ * @version 2026.10
+ *
+ * @copyright
+ * Copyright (C) 2019 Bazso Akos
+ *
+ * This file is part of libkes.
+ *
+ * libkes is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * libkes is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with libkes.  If not, see <https://www.gnu.org/licenses/>.
+ *
+ ******************************************************************************/
+#pragma once
+#ifndef KES_HYPERB__H
+#define KES_HYPERB__H
+
+/* include standard headers */
+#include <stddef.h>
+
+/* include module headers */
+#include "error.h"
+#include "input.h"
+#include "solver.h"
+#include "utils.h"
+
+/******************************************************************************/
+
+/*** declare functions ***/
+
+/*!
+ * @brief starter for hyperbolic Kepler Equation e*sinh(H) - H = M
+ * @details smaller of two upper bounds of the solution, i.e. the cubic
+ * approximation (e-1)*H + e*H^3/6 = M and one step of the fixed-point
+ * iteration H = asinh((M + H) / e) from there, i.e. method KES_HSTM_BOUND
+ * of kes_starter_hyp()
+ * @param[in] ecc eccentricity (ecc > 1)
+ * @param[in] ma mean anomaly (ma >= 0)
+ * @return starting value H0 >= H
+ */
+double kes_stm_hyp(
+    const double ecc,
+    const double ma
+);
+
+/*!
+ * @brief vectorized starters for hyperbolic Kepler Equation
+ * @details all arrays hold KES_VEC_LEN elements, same results as
+ * kes_starter_hyp(); unused lanes must be filled with valid dummy values
+ * @param[in] type  starter method from enum #kes_hstm_e
+ * @param[in] ecc   eccentricities (ecc > 1)
+ * @param[in] ma    mean anomalies (ma >= 0)
+ * @param[out] x    starting values
+ */
+void kes_vstm_hyp(
+    const kes_hstm_e       type,
+    const double* restrict ecc,
+    const double* restrict ma,
+    double* restrict       x
+);
+
+/*!
+ * @brief starting value for the hyperbolic Kepler Equation e*sinh(H) - H = M
+ * @details KES_HSTM_BOUND is the smaller of the cubic upper bound and one
+ * fixed-point step H = asinh((M + H) / e) from there, an upper bound within
+ * 2% of H for all e and M (default); KES_HSTM_CUBIC is the root of
+ * (e-1)*H + e*H^3/6 = M, an upper bound within 0.4% for H < 0.5, but it
+ * grows like M^(1/3) instead of ln(M) for large M; KES_HSTM_ASINH takes two
+ * fixed-point steps from H = 0, a lower bound with a relative error of at
+ * most 1/e^2 and below 0.1% for M/e > 10; KES_HSTM_LOG is ln(2*M/e + 1.8)
+ * from Danby (1987), within 2.5% for M/e > 10, but not for small M;
+ * NOTE outside of these ranges (H >= 0.5 for KES_HSTM_CUBIC, M/e <= 10 for
+ * KES_HSTM_ASINH and KES_HSTM_LOG) the methods fall back to KES_HSTM_BOUND,
+ * such that all of them converge in a few iterations for all e and M
+ * @param[in] ecc eccentricity (ecc > 1)
+ * @param[in] ma mean anomaly (in radians), H0(-M) = -H0(M)
+ * @param[in] type choose a starter method from enum #kes_hstm_e
+ * @param[out] status pointer to return error code from enum #kes_err_e,
+ * KES_ERR_BADSTM for an invalid method, KES_ERR_BADECC for ecc <= 1
+ * @return starting value H0
+ */
+double kes_starter_hyp(
+    const double     ecc,
+    const double     ma,
+    const kes_hstm_e type,
+    kes_err_e*       status
+);
+
+/*!
+ * @brief hyperbolic starting values for arrays of elements
+ * @details evaluates the same formulas as kes_starter_hyp() for all
+ * elements with vectorized math functions (identical results), i.e. with a
+ * sinh/cosh kernel of the same cost, the batch solvers use them, too
+ * @param[in] n number of elements
+ * @param[in] ecc array of eccentricities
+ * @param[in] incecc stride of ecc: 1 for one eccentricity per element, 0 for
+ * a common eccentricity ecc[0]
+ * @param[in] ma array of n mean anomalies (in radians)
+ * @param[out] x array of n starting values, must not overlap ecc or ma
+ * @param[in] type choose a starter method from enum #kes_hstm_e
+ * @return error code from enum #kes_err_e, KES_ERR_BADSTM for an invalid
+ * method (all x are set to 0), KES_ERR_BADECC if any ecc <= 1 (their x are
+ * set to 0)
+ */
+kes_err_e kes_starter_hyp_batch(
+    const size_t     n,
+    const double*    ecc,
+    const size_t     incecc,
+    const double*    ma,
+    double*          x,
+    const kes_hstm_e type
+);
+
+/*!
+ * @brief order of the iteration method used for the hyperbolic case
+ * @details Newton-Raphson (2), Halley (3) and Danby-Burkardt (4, 5) methods
+ * are used as is, Markley's and Mikkola's method are replaced by iterations
+ * of order 5, all other methods by Halley's method
+ * @param[in] iter solver method from enum kes_sol_e
+ * @return order of iteration method (2 <= order <= 5)
+ */
+int kes_hyp_order(
+    const kes_sol_e iter
+);
+
+/*!
+ * @brief solver method matching an order of iteration
+ * @details inverse of kes_hyp_order() for tracing, i.e. Newton-Raphson (2),
+ * Halley (3) and Danby-Burkardt (4, 5) methods
+ * @param[in] order order of iteration method (2 <= order <= 5)
+ * @return solver method from enum kes_sol_e
+ */
+kes_sol_e kes_hyp_solver(
+    const int order
+);
+
+/*!
+ * @brief resolve fixed number of iterations for the hyperbolic case
+ * @param[in] order order of iteration method (2 <= order <= 5)
+ * @param[in] hinit starter method from enum #kes_hstm_e
+ * @param[in] fixiter user defined value (0, > 0, or KES_FIX_AUTO)
+ * @return number of iterations (0 = iterate until convergence)
+ */
+int kes_hyp_fixiter(
+    const int        order,
+    const kes_hstm_e hinit,
+    const int        fixiter
+);
+
+/*!
+ * @brief iterative solver for hyperbolic Kepler Equation
+ * @details same stopping criteria as the elliptic solvers, with tolerance
+ * "tolx" relative to max(1, |H|); solution stored in data->result
+ * @param[in] order order of iteration method (2 <= order <= 5)
+ * @param[in] ecc eccentricity (ecc > 1)
+ * @param[in] ma mean anomaly (ma >= 0)
+ * @param[in] starter starting value for first iteration
+ * @param[in,out] data pointer to input parameters and results
+ * @return number of iterations
+ */
+int kes_hypiter(
+    const int    order,
+    const double ecc,
+    const double ma,
+    const double starter,
+    kes_input_t* data
+);
+
+/*!
+ * @brief vectorized solver for hyperbolic Kepler Equation
+ * @details all arrays hold KES_VEC_LEN elements, same results as
+ * kes_hypiter(); unused lanes must be filled with valid dummy values
+ * @param[in] order     order of iteration method (2 <= order <= 5)
+ * @param[in] ecc       eccentricities (ecc > 1)
+ * @param[in] ma        mean anomalies (ma >= 0)
+ * @param[in] starter   starter values
+ * @param[out] x        solutions
+ * @param[out] count    number of iterations per lane
+ * @param[in] data      pointer to input parameters for stopping criteria
+ *                      (tolf, tolx, maxiter) or fixed iterations (fixiter)
+ */
+void kes_vsolve_hyp(
+    const int              order,
+    const double* restrict ecc,
+    const double* restrict ma,
+    const double* restrict starter,
+    double* restrict       x,
+    int* restrict          count,
+    const kes_input_t*     data
+);
+
+/******************************************************************************/
+
+#endif  /* KES_HYPERB__H */
@@ -79,6 +79,45 @@ inline int kes_check_input(kes_input_t* data)
         ++ret;
     } // end if
 
+    if ( data->fixiter < KES_FIX_AUTO )
+    {
+        data->fixiter = 0;
+        ++ret;
+    } // end if
+
+    if ( (data->trig < KES_TRIG_FULL) || (data->trig >= KES_TRIG_TOTAL) )
+    {
+        data->trig    = KES_TRIG_FULL;
+        ++ret;
+    } // end if
+
+    if ( (data->conv < KES_CONV_FULL) || (data->conv >= KES_CONV_TOTAL) )
+    {
+        data->conv    = KES_CONV_FULL;
+        ++ret;
+    } // end if
+
+    if ( (data->stop < KES_STOP_DELTA) || (data->stop >= KES_STOP_TOTAL) )
+    {
+        data->stop    = KES_STOP_DELTA;
+        ++ret;
+    } // end if
+
+    if ( (data->deriv < KES_DERIV_NONE) || (data->deriv >= KES_DERIV_TOTAL) )
+    {
+        data->deriv   = KES_DERIV_NONE;
+        ++ret;
+    } // end if
+
+    if ( (data->hinit < KES_HSTM_BOUND) || (data->hinit >= KES_HSTM_TOTAL) )
+    {
+        data->hinit   = KES_HSTM_BOUND;
+        ++ret;
+    } // end if
+
+    /* precomputed constants are set by the caller after the check */
+    data->terms = NULL;
+
     return ret;
 } // end kes_check_input
 
@@ -144,6 +183,126 @@ inline int kes_get_maxiter(const kes_input_t* const in)
 
 /******************************************************************************/
 
+/*******************************************************************************
+ * FUNCTION    : kes_get_fixiter
+ * DESCRIPTION : return current value of parameter "fixiter" in data structure
+ * INPUT       : structure of type kes_input_t
+ * OUTPUT      : value of fixiter
+ ******************************************************************************/
+inline int kes_get_fixiter(const kes_input_t* const in)
+{
+    if ( in != NULL )
+    {
+        return( in->fixiter );
+    } // end if
+    else
+    {
+        return 0;
+    } // end else
+} // end kes_get_fixiter
+
+/******************************************************************************/
+
+/*******************************************************************************
+ * FUNCTION    : kes_get_trig
+ * DESCRIPTION : return current value of parameter "trig" in data structure
+ * INPUT       : structure of type kes_input_t
+ * OUTPUT      : value of trig
+ ******************************************************************************/
+inline kes_trig_e kes_get_trig(const kes_input_t* const in)
+{
+    if ( in != NULL )
+    {
+        return( in->trig );
+    } // end if
+    else
+    {
+        return KES_TRIG_FULL;
+    } // end else
+} // end kes_get_trig
+
+/******************************************************************************/
+
+/*******************************************************************************
+ * FUNCTION    : kes_get_conv
+ * DESCRIPTION : return current value of parameter "conv" in data structure
+ * INPUT       : structure of type kes_input_t
+ * OUTPUT      : value of conv
+ ******************************************************************************/
+inline kes_conv_e kes_get_conv(const kes_input_t* const in)
+{
+    if ( in != NULL )
+    {
+        return( in->conv );
+    } // end if
+    else
+    {
+        return KES_CONV_FULL;
+    } // end else
+} // end kes_get_conv
+
+/******************************************************************************/
+
+/*******************************************************************************
+ * FUNCTION    : kes_get_stop
+ * DESCRIPTION : return current value of parameter "stop" in data structure
+ * INPUT       : structure of type kes_input_t
+ * OUTPUT      : value of stop
+ ******************************************************************************/
+inline kes_stop_e kes_get_stop(const kes_input_t* const in)
+{
+    if ( in != NULL )
+    {
+        return( in->stop );
+    } // end if
+    else
+    {
+        return KES_STOP_DELTA;
+    } // end else
+} // end kes_get_stop
+
+/******************************************************************************/
+
+/*******************************************************************************
+ * FUNCTION    : kes_get_deriv
+ * DESCRIPTION : return current value of parameter "deriv" in data structure
+ * INPUT       : structure of type kes_input_t
+ * OUTPUT      : value of deriv
+ ******************************************************************************/
+inline kes_deriv_e kes_get_deriv(const kes_input_t* const in)
+{
+    if ( in != NULL )
+    {
+        return( in->deriv );
+    } // end if
+    else
+    {
+        return KES_DERIV_NONE;
+    } // end else
+} // end kes_get_deriv
+
+/******************************************************************************/
+
+/*******************************************************************************
+ * FUNCTION    : kes_get_hstarter
+ * DESCRIPTION : return current value of parameter "hinit" in data structure
+ * INPUT       : structure of type kes_input_t
+ * OUTPUT      : value of hinit
+ ******************************************************************************/
+inline kes_hstm_e kes_get_hstarter(const kes_input_t* const in)
+{
+    if ( in != NULL )
+    {
+        return( in->hinit );
+    } // end if
+    else
+    {
+        return KES_HSTM_BOUND;
+    } // end else
+} // end kes_get_hstarter
+
+/******************************************************************************/
+
 /*******************************************************************************
  * FUNCTION    : kes_set_tolf
  * DESCRIPTION : set new value for parameter "tolf" in data structure
@@ -235,6 +394,180 @@ inline kes_err_e kes_set_maxiter(
 
 /******************************************************************************/
 
+/*******************************************************************************
+ * FUNCTION    : kes_set_fixiter
+ * DESCRIPTION : set new value for parameter "fixiter" in data structure
+ * INPUT       : - structure of type kes_input_t
+ *               - value "fixiter" (0 = off, KES_FIX_AUTO = library choice)
+ * OUTPUT      : error code from kes_err_e
+ ******************************************************************************/
+inline kes_err_e kes_set_fixiter(
+    kes_input_t* in,
+    const int    fixiter
+    )
+{
+    /* default value: error */
+    kes_err_e err = KES_ERR_BADVAL;
+
+    /* check input value to be a suitable number */
+    if (
+        (fixiter >= KES_FIX_AUTO) &&
+        (fixiter < 10 * std_maxiter)
+    ) {
+        in->fixiter = fixiter;
+        err         = KES_ERR_NOERR;
+    } // end if
+
+    return( err );
+} // end kes_set_fixiter
+
+/******************************************************************************/
+
+/*******************************************************************************
+ * FUNCTION    : kes_set_trig
+ * DESCRIPTION : set new value for parameter "trig" in data structure
+ * INPUT       : - structure of type kes_input_t
+ *               - accuracy tier "trig" from enum kes_trig_e
+ * OUTPUT      : error code from kes_err_e
+ ******************************************************************************/
+inline kes_err_e kes_set_trig(
+    kes_input_t*     in,
+    const kes_trig_e trig
+    )
+{
+    /* default value: error */
+    kes_err_e err = KES_ERR_BADVAL;
+
+    /* check input value to be a valid accuracy tier */
+    if (
+        (trig >= KES_TRIG_FULL) &&
+        (trig < KES_TRIG_TOTAL)
+    ) {
+        in->trig = trig;
+        err      = KES_ERR_NOERR;
+    } // end if
+
+    return( err );
+} // end kes_set_trig
+
+/******************************************************************************/
+
+/*******************************************************************************
+ * FUNCTION    : kes_set_conv
+ * DESCRIPTION : set new value for parameter "conv" in data structure
+ * INPUT       : - structure of type kes_input_t
+ *               - convergence test "conv" from enum kes_conv_e
+ * OUTPUT      : error code from kes_err_e
+ ******************************************************************************/
+inline kes_err_e kes_set_conv(
+    kes_input_t*     in,
+    const kes_conv_e conv
+    )
+{
+    /* default value: error */
+    kes_err_e err = KES_ERR_BADVAL;
+
+    /* check input value to be a valid convergence test */
+    if (
+        (conv >= KES_CONV_FULL) &&
+        (conv < KES_CONV_TOTAL)
+    ) {
+        in->conv = conv;
+        err      = KES_ERR_NOERR;
+    } // end if
+
+    return( err );
+} // end kes_set_conv
+
+/******************************************************************************/
+
+/*******************************************************************************
+ * FUNCTION    : kes_set_stop
+ * DESCRIPTION : set new value for parameter "stop" in data structure
+ * INPUT       : - structure of type kes_input_t
+ *               - stopping rule "stop" from enum kes_stop_e
+ * OUTPUT      : error code from kes_err_e
+ ******************************************************************************/
+inline kes_err_e kes_set_stop(
+    kes_input_t*     in,
+    const kes_stop_e stop
+    )
+{
+    /* default value: error */
+    kes_err_e err = KES_ERR_BADVAL;
+
+    /* check input value to be a valid stopping rule */
+    if (
+        (stop >= KES_STOP_DELTA) &&
+        (stop < KES_STOP_TOTAL)
+    ) {
+        in->stop = stop;
+        err      = KES_ERR_NOERR;
+    } // end if
+
+    return( err );
+} // end kes_set_stop
+
+/******************************************************************************/
+
+/*******************************************************************************
+ * FUNCTION    : kes_set_deriv
+ * DESCRIPTION : set new value for parameter "deriv" in data structure
+ * INPUT       : - structure of type kes_input_t
+ *               - order of derivatives "deriv" from enum kes_deriv_e
+ * OUTPUT      : error code from kes_err_e
+ ******************************************************************************/
+inline kes_err_e kes_set_deriv(
+    kes_input_t*      in,
+    const kes_deriv_e deriv
+    )
+{
+    /* default value: error */
+    kes_err_e err = KES_ERR_BADVAL;
+
+    /* check input value to be a valid order of derivatives */
+    if (
+        (deriv >= KES_DERIV_NONE) &&
+        (deriv < KES_DERIV_TOTAL)
+    ) {
+        in->deriv = deriv;
+        err       = KES_ERR_NOERR;
+    } // end if
+
+    return( err );
+} // end kes_set_deriv
+
+/******************************************************************************/
+
+/*******************************************************************************
+ * FUNCTION    : kes_set_hstarter
+ * DESCRIPTION : set new value for parameter "hinit" in data structure
+ * INPUT       : - structure of type kes_input_t
+ *               - hyperbolic starter method "hinit" from enum kes_hstm_e
+ * OUTPUT      : error code from kes_err_e
+ ******************************************************************************/
+inline kes_err_e kes_set_hstarter(
+    kes_input_t*     in,
+    const kes_hstm_e hinit
+    )
+{
+    /* default value: error */
+    kes_err_e err = KES_ERR_BADSTM;
+
+    /* check input value to be a valid hyperbolic starter method */
+    if (
+        (hinit >= KES_HSTM_BOUND) &&
+        (hinit < KES_HSTM_TOTAL)
+    ) {
+        in->hinit = hinit;
+        err       = KES_ERR_NOERR;
+    } // end if
+
+    return( err );
+} // end kes_set_hstarter
+
+/******************************************************************************/
+
 /*******************************************************************************
  * FUNCTION    : kes_new_input_dummy
  * DESCRIPTION : dummy function to return input structure "in"
@@ -247,3 +580,45 @@ kes_input_t kes_new_input_dummy(kes_input_t in)
 } // end kes_new_input_dummy
 
 /******************************************************************************/
+
+/*******************************************************************************
+ * FUNCTION    : kes_new_config_dummy
+ * DESCRIPTION : dummy function to return configuration structure "cfg"
+ * INPUT       : structure of type kes_config_t
+ * OUTPUT      : structure of type kes_config_t
+ ******************************************************************************/
+kes_config_t kes_new_config_dummy(kes_config_t cfg)
+{
+    return cfg;
+} // end kes_new_config_dummy
+
+/******************************************************************************/
+
+/*******************************************************************************
+ * FUNCTION    : kes_input_from_config
+ * DESCRIPTION : input data structure with the settings of a configuration
+ * INPUT       : pointer to structure of type kes_config_t (or NULL)
+ * OUTPUT      : structure of type kes_input_t with checked settings
+ ******************************************************************************/
+kes_input_t kes_input_from_config(const kes_config_t* cfg)
+{
+    kes_input_t data = kes_new_input();
+
+    if ( cfg != NULL )
+    {
+        data.tolf    = cfg->tolf;
+        data.tolx    = cfg->tolx;
+        data.maxiter = cfg->maxiter;
+        data.fixiter = cfg->fixiter;
+        data.trig    = cfg->trig;
+        data.conv    = cfg->conv;
+        data.stop    = cfg->stop;
+        data.hinit   = cfg->hinit;
+    } // end if
+
+    kes_check_input( &data );
+
+    return( data );
+} // end kes_input_from_config
+
+/******************************************************************************/
@@ -29,6 +29,7 @@
 
 /* include module headers */
 #include "error.h"
+#include "utils.h"
 
 /******************************************************************************/
 
@@ -40,10 +41,55 @@
 /* default maximum number of iterations */
 #define KES_STD_MAXITER 100
 
+/* fixed number of iterations chosen by the library, see kes_set_fixiter() */
+#define KES_FIX_AUTO    (-1)
+
+/* number of segments in 0 <= E <= pi of solver method KES_SOL_EKS */
+#define KES_EKS_NSEG    12
+
 /******************************************************************************/
 
 /*** declare data structures ***/
 
+/*!
+ * @brief structure containing eccentricity-dependent constants
+ * @details precomputed once per eccentricity by kes_plan_init() and the
+ * batch solvers, the solver methods read them via \a terms in #kes_input_t
+ * NOTE only for internal use
+ */
+typedef struct
+{
+    double corr;       ///< correction factor e/(1-e) for residual |f(x)|
+    double e1;         ///< eccentricity complement 1-e
+    double mk_ad;      ///< Markley: constant 3*pi^2/(pi^2-6) of alpha(e,M)
+    double mk_ak;      ///< Markley: factor 1.6*pi/(pi^2-6)/(1+e) of alpha(e,M)
+    double mk_d0;      ///< Markley: term 3*(1-e) of d(e,M)
+    double mi_frac;    ///< Mikkola/Nijenhuis: denominator 1/(0.5+4e)
+    double mi_corr;    ///< Mikkola: factor 0.078/(1+e) of O(s^5) correction
+    int    ek_init;    ///< EKS: table below is valid (1) or not (0)
+    double ek_ma[KES_EKS_NSEG + 1];      ///< EKS: mean anomalies of nodes
+    double ek_coef[KES_EKS_NSEG + 1][5]; ///< EKS: Taylor coefficients of
+                                         ///< E(M) at nodes, orders 1 to 5
+} kes_terms_t;
+
+
+/*!
+ * @brief structure containing partial derivatives of the solution
+ * @details derivatives of the eccentric anomaly E(M,e) of the elliptic and
+ * hyperbolic Kepler Equation, with D = 1 - e*cos(E) resp.
+ * D = e*cosh(H) - 1; for parabolic orbits the derivatives of the true
+ * anomaly with respect to M, those with respect to e are not defined (NAN)
+ */
+typedef struct
+{
+    double dEdM;  ///< dE/dM = 1/D
+    double dEde;  ///< dE/de = sin(E)/D
+    double dEdMM; ///< d2E/dM2 (only for KES_DERIV_SECOND)
+    double dEdMe; ///< d2E/dMde (only for KES_DERIV_SECOND)
+    double dEdee; ///< d2E/de2 (only for KES_DERIV_SECOND)
+} kes_deriv_t;
+
+
 /*!
  * @brief structure containing iteration data
  * @details use this structure as interface to function kesolver()
@@ -54,6 +100,12 @@ typedef struct
     double tolf;       ///< iteration tolerance for f(x(n))
     double tolx;       ///< iteration tolerance for x(n)
     int    maxiter;    ///< maximum number of iterations
+    int    fixiter;    ///< fixed number of iterations (0 = off, default)
+    kes_trig_e trig;   ///< accuracy of sin/cos (KES_TRIG_FULL = default)
+    kes_conv_e conv;   ///< convergence test (KES_CONV_FULL = default)
+    kes_stop_e stop;   ///< stopping rule (KES_STOP_DELTA = default)
+    kes_deriv_e deriv; ///< partial derivatives (KES_DERIV_NONE = default)
+    kes_hstm_e hinit;  ///< hyperbolic starter (KES_HSTM_BOUND = default)
 
     /* output from iteration function */
     double result;     ///< returns solution of Kepler Equation
@@ -62,17 +114,54 @@ typedef struct
     double errDF;      ///< residual error for |f(x(n+1))|
     double errDX;      ///< residual error for |x(n+1)-x(n)|
     int    iterations; ///< number of iterations performed until convergence
+    kes_deriv_t partial; ///< partial derivatives, see kes_set_deriv()
 
-    /* additional counters for trigonometric function evaluations
-     * NOTE only for internal use
+    /* counters for function evaluations of the last call of kesolver(),
+     * aggregated over many calls by the statistics collector (kes_set_stats)
      */
     int    nbrSinEval; ///< number of evaluations of sin()
     int    nbrCosEval; ///< number of evaluations of cos()
     int    nbrFktEval; ///< number of evaluations of kes_keq_xxx()
 
+    /* pointer to precomputed constants (or NULL)
+     * NOTE only for internal use, reset by kes_check_input()
+     */
+    const kes_terms_t* terms; ///< eccentricity-dependent constants
+
     /* TODO FIXME add function pointer to kes_keq_xxx ? */
 } kes_input_t;
 
+
+/*!
+ * @brief structure containing solver settings only
+ * @details read-only in all functions taking a pointer to it, i.e. one
+ * instance can be shared between threads; create with kes_new_config()
+ */
+typedef struct
+{
+    double     tolf;    ///< iteration tolerance for f(x(n))
+    double     tolx;    ///< iteration tolerance for x(n)
+    int        maxiter; ///< maximum number of iterations
+    int        fixiter; ///< fixed number of iterations (0 = off, default)
+    kes_trig_e trig;    ///< accuracy of sin/cos (KES_TRIG_FULL = default)
+    kes_conv_e conv;    ///< convergence test (KES_CONV_FULL = default)
+    kes_stop_e stop;    ///< stopping rule (KES_STOP_DELTA = default)
+    kes_hstm_e hinit;   ///< hyperbolic starter (KES_HSTM_BOUND = default)
+} kes_config_t;
+
+
+/*!
+ * @brief compact result record of a single solve (16 bytes)
+ * @details optional output of kesolver_cfg(), residuals are rounded to float
+ */
+typedef struct
+{
+    float     errDF;      ///< residual error for |f(x(n+1))|
+    float     errDX;      ///< residual error for |x(n+1)-x(n)|
+    int       iterations; ///< number of iterations
+    kes_err_e status;     ///< error code from enum #kes_err_e
+} kes_result_t;
+
 /******************************************************************************/
 
 /*** function declarations ***/
@@ -105,6 +194,54 @@ double kes_get_tolx(const kes_input_t* const in);
 int kes_get_maxiter(const kes_input_t* const in);
 
 
+/*!
+ * @brief get current value of parameter "fixiter"
+ * @param[in] in pointer to structure of type #kes_input_t
+ * @return value of fixiter
+ */
+int kes_get_fixiter(const kes_input_t* const in);
+
+
+/*!
+ * @brief get current value of parameter "trig"
+ * @param[in] in pointer to structure of type #kes_input_t
+ * @return value of trig
+ */
+kes_trig_e kes_get_trig(const kes_input_t* const in);
+
+
+/*!
+ * @brief get current value of parameter "conv"
+ * @param[in] in pointer to structure of type #kes_input_t
+ * @return value of conv
+ */
+kes_conv_e kes_get_conv(const kes_input_t* const in);
+
+
+/*!
+ * @brief get current value of parameter "stop"
+ * @param[in] in pointer to structure of type #kes_input_t
+ * @return value of stop
+ */
+kes_stop_e kes_get_stop(const kes_input_t* const in);
+
+
+/*!
+ * @brief get current value of parameter "deriv"
+ * @param[in] in pointer to structure of type #kes_input_t
+ * @return value of deriv
+ */
+kes_deriv_e kes_get_deriv(const kes_input_t* const in);
+
+
+/*!
+ * @brief get current value of parameter "hinit"
+ * @param[in] in pointer to structure of type #kes_input_t
+ * @return value of hinit
+ */
+kes_hstm_e kes_get_hstarter(const kes_input_t* const in);
+
+
 /*!
  * @brief set new value for parameter "tolf"
  * @details default value for tolf is 1E-15
@@ -144,6 +281,127 @@ kes_err_e kes_set_maxiter(
 );
 
 
+/*!
+ * @brief set new value for parameter "fixiter"
+ * @details default value for fixiter is 0, i.e. iterations stop as soon as
+ * the tolerances "tolf" or "tolx" are reached; for fixiter > 0 the
+ * Newton-Raphson, Halley and Danby-Burkardt solvers perform exactly fixiter
+ * iterations without evaluating the residual of the Kepler Equation, and
+ * the single correction step of Markley's and Mikkola's method skips it;
+ * KES_FIX_AUTO selects a tabulated number of iterations for the pair of
+ * starter and solver methods which reaches KES_STD_TOL for all elliptic
+ * orbits (pairs without such a bound use "maxiter"), and for all hyperbolic
+ * orbits with 1 < ecc <= 1E4;
+ * other solvers ignore fixiter
+ * @param[in] in pointer to structure of type #kes_input_t
+ * @param[in] fixiter new fixed number of iterations, 0 or KES_FIX_AUTO
+ * @return error code from enum #kes_err_e
+ */
+kes_err_e kes_set_fixiter(
+    kes_input_t* in,
+    const int    fixiter
+);
+
+
+/*!
+ * @brief set new value for parameter "trig"
+ * @details default value for trig is KES_TRIG_FULL; with KES_TRIG_FAST the
+ * Newton-Raphson, Halley and Danby-Burkardt solvers use a faster sin/cos
+ * kernel (absolute error about 1E-12) as long as the next iteration is not
+ * expected to reach this error, the final iterations and the residuals of
+ * the stopping criteria always use full accuracy;
+ * fixed iterations (see kes_set_fixiter()) use the fast kernel for all but
+ * the last iteration; other solvers ignore trig
+ * @param[in] in pointer to structure of type #kes_input_t
+ * @param[in] trig accuracy tier from enum #kes_trig_e
+ * @return error code from enum #kes_err_e
+ */
+kes_err_e kes_set_trig(
+    kes_input_t*     in,
+    const kes_trig_e trig
+);
+
+
+/*!
+ * @brief set new value for parameter "conv"
+ * @details default value for conv is KES_CONV_FULL, i.e. the
+ * Newton-Raphson, Halley and Danby-Burkardt solvers evaluate the residual
+ * of each new iterate, which costs one more sin per iteration;
+ * with KES_CONV_LEAN they take the residual of the previous iterate from
+ * the next iteration step instead, i.e. one sin/cos pair per iteration:
+ * the iterations stop on |x(n+1) - x(n)| <= tolx as before, or one step
+ * after the residual reached tolf, so the solution is at least as accurate
+ * at the cost of about one more (but cheaper) iteration, and "errDF"
+ * refers to the previous iterate; steps with fast sin/cos (see
+ * kes_set_trig()) give no residual; other solvers ignore conv
+ * @param[in] in pointer to structure of type #kes_input_t
+ * @param[in] conv convergence test from enum #kes_conv_e
+ * @return error code from enum #kes_err_e
+ */
+kes_err_e kes_set_conv(
+    kes_input_t*     in,
+    const kes_conv_e conv
+);
+
+
+/*!
+ * @brief set new value for parameter "stop"
+ * @details default value for stop is KES_STOP_DELTA, i.e. the iterations
+ * stop when |x(n+1) - x(n)| <= tolx was observed, which mostly takes one
+ * more iteration than needed; with KES_STOP_ORDER* the Newton-Raphson,
+ * Halley and Danby-Burkardt solvers also stop as soon as the error of
+ * x(n+1) predicted from their order of convergence p, i.e.
+ * |dx| * (|dx| / (1 - e))^(p-1) with dx = x(n+1) - x(n), is below tolx,
+ * or below tolx * |x(n+1)|, or below tolx / DBL_EPSILON units in the last
+ * place of x(n+1) (about 4.5 ulp for tolx = 1E-15); the factor 1/(1 - e)
+ * bounds the error constants of these methods, steps with fast sin/cos (see
+ * kes_set_trig()) never stop by prediction; other solvers ignore stop
+ * @param[in] in pointer to structure of type #kes_input_t
+ * @param[in] stop stopping rule from enum #kes_stop_e
+ * @return error code from enum #kes_err_e
+ */
+kes_err_e kes_set_stop(
+    kes_input_t*     in,
+    const kes_stop_e stop
+);
+
+
+/*!
+ * @brief set new value for parameter "deriv"
+ * @details default value for deriv is KES_DERIV_NONE; with KES_DERIV_FIRST
+ * kesolver() also returns dE/dM and dE/de of the solution in "partial",
+ * with KES_DERIV_SECOND also the second derivatives; the Newton-Raphson,
+ * Halley and Danby-Burkardt solvers (and Markley's and Mikkola's method)
+ * keep e*sin(x) and e*cos(x) of their last step, the derivatives at the
+ * solution follow from them by a short rotation without any sin/cos,
+ * other solvers evaluate sin/cos once at the solution;
+ * kesolver_batch_deriv() returns the derivatives of batches
+ * @param[in] in pointer to structure of type #kes_input_t
+ * @param[in] deriv order of derivatives from enum #kes_deriv_e
+ * @return error code from enum #kes_err_e
+ */
+kes_err_e kes_set_deriv(
+    kes_input_t*      in,
+    const kes_deriv_e deriv
+);
+
+
+/*!
+ * @brief set new value for parameter "hinit"
+ * @details default value for hinit is KES_HSTM_BOUND; selects the starter
+ * of the hyperbolic solvers in kesolver(), the batch solvers and solver
+ * plans, see kes_starter_hyp() for the methods and their error bounds;
+ * KES_FIX_AUTO selects a fixed number of iterations for each of them
+ * @param[in] in pointer to structure of type #kes_input_t
+ * @param[in] hinit hyperbolic starter method from enum #kes_hstm_e
+ * @return error code from enum #kes_err_e
+ */
+kes_err_e kes_set_hstarter(
+    kes_input_t*     in,
+    const kes_hstm_e hinit
+);
+
+
 /*!
  * @brief check input parameters and set default values if needed
  * @param[in,out] data pointer to structure of type #kes_input_t
@@ -173,6 +431,37 @@ kes_input_t kes_new_input_dummy(kes_input_t in);
                                .maxiter = KES_STD_MAXITER,                     \
                                __VA_ARGS__ } )
 
+
+/*!
+ * @brief dummy function that returns configuration structure
+ */
+kes_config_t kes_new_config_dummy(kes_config_t cfg);
+
+
+/*!
+ * @brief initialize and return a new configuration
+ * @details same arguments and default values as kes_new_input();
+ * function prototype: kes_config_t kes_new_config(args);
+ * @return structure of type #kes_config_t
+ */
+#define kes_new_config(...) kes_new_config_dummy(                              \
+                              (kes_config_t){                                  \
+                                .tolf    = KES_STD_TOL,                        \
+                                .tolx    = KES_STD_TOL,                        \
+                                .maxiter = KES_STD_MAXITER,                    \
+                                __VA_ARGS__ } )
+
+
+/*!
+ * @brief input data structure with the settings of a configuration
+ * @details outputs are zero, settings are checked by kes_check_input();
+ * use for functions taking #kes_input_t, e.g. kes_plan_init()
+ * @param[in] cfg pointer to structure of type #kes_config_t
+ * (or NULL for default settings)
+ * @return structure of type #kes_input_t
+ */
+kes_input_t kes_input_from_config(const kes_config_t* cfg);
+
 #ifdef __cplusplus
 }
 #endif
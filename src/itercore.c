@@ -26,7 +26,9 @@
  *
  ******************************************************************************/
 /* include standard headers */
+#include <float.h>
 #include <math.h>
+#include <stddef.h>
 
 /* include module headers */
 #include "itercore.h"
@@ -47,6 +49,14 @@
  */
 static const double addzero = 1.0e-19;
 
+/* prototype of sin/cos kernels kes_sincos() and kes_sincos_fast() */
+typedef void kes_sincos_t(
+    double*      sx,
+    double*      cx,
+    const double x,
+    const double ecc
+);
+
 /******************************************************************************/
 
 /*** REFERENCE : Danby & Burkardt (1983), Celestial Mechanics 31, p.95-107 ***/
@@ -54,24 +64,40 @@ static const double addzero = 1.0e-19;
 /*******************************************************************************
  *  FUNCTION    : itercore2
  *  DESCRIPTION : iteration method: Newton-Raphson, quadratic convergence
+ *  NOTE          generic version for sin/cos kernel "sincos"
  *  INPUT       : - eccentricity "ecc"
  *                - mean anomaly "ma" (in radians)
  *                - old value of iteration variable "x0"
+ *                - sin/cos kernel "sincos"
+ *                - pointer "f0x" to return M - x0 + e*sin(x0) (or NULL)
+ *                - pointer "sc" to return e*sin(x0), e*cos(x0) (or NULL)
  *  OUTPUT      : update to iteration variable x0+dx
  ******************************************************************************/
-inline double kes_itercore2(
-    const double ecc,
-    const double ma,
-    const double x0
+static inline double itercore2(
+    const double        ecc,
+    const double        ma,
+    const double        x0,
+    kes_sincos_t* const sincos,
+    double*             f0x,
+    double*             sc
     )
 {
     double ecx, esx; /* ecc*cos(x), ecc*sin(x) */
 
     /* calculate sin, cos */
-    kes_sincos( &esx, &ecx, x0, ecc );
+    sincos( &esx, &ecx, x0, ecc );
+    if ( sc != NULL )
+    {
+        sc[0] = esx;
+        sc[1] = ecx;
+    } // end if
 
     /* evaluate Kepler Equation: 0th derivative */
     const double f0 = ma - x0 + esx;
+    if ( f0x != NULL )
+    {
+        *f0x = f0;
+    } // end if
 
     /* evaluate Kepler Equation: 1st derivative */
     const double f1 = 1.0 - ecx + addzero;
@@ -80,32 +106,131 @@ inline double kes_itercore2(
     const double dx = f0 / f1;
 
     return( x0 + dx );
+} // end itercore2
+
+/******************************************************************************/
+
+/*******************************************************************************
+ *  FUNCTION    : kes_itercore2
+ *  DESCRIPTION : iteration method: Newton-Raphson, quadratic convergence
+ *  INPUT       : - eccentricity "ecc"
+ *                - mean anomaly "ma" (in radians)
+ *                - old value of iteration variable "x0"
+ *  OUTPUT      : update to iteration variable x0+dx
+ ******************************************************************************/
+inline double kes_itercore2(
+    const double ecc,
+    const double ma,
+    const double x0
+    )
+{
+    return( itercore2( ecc, ma, x0, &kes_sincos, NULL, NULL ) );
 } // end kes_itercore2
 
 /******************************************************************************/
 
 /*******************************************************************************
- *  FUNCTION    : itercore3
- *  DESCRIPTION : iteration method: Halley, cubic convergence
+ *  FUNCTION    : kes_itercore2_fast
+ *  DESCRIPTION : same as kes_itercore2, with fast sin/cos (error about 1E-12)
  *  INPUT       : - eccentricity "ecc"
  *                - mean anomaly "ma" (in radians)
  *                - old value of iteration variable "x0"
  *  OUTPUT      : update to iteration variable x0+dx
  ******************************************************************************/
-inline double kes_itercore3(
+inline double kes_itercore2_fast(
     const double ecc,
     const double ma,
     const double x0
     )
+{
+    return( itercore2( ecc, ma, x0, &kes_sincos_fast, NULL, NULL ) );
+} // end kes_itercore2_fast
+
+/******************************************************************************/
+
+/*******************************************************************************
+ *  FUNCTION    : kes_itercore2_res
+ *  DESCRIPTION : same as kes_itercore2, also returns the residual of x0
+ *  INPUT       : - eccentricity "ecc"
+ *                - mean anomaly "ma" (in radians)
+ *                - old value of iteration variable "x0"
+ *                - pointer "f0" to return M - x0 + e*sin(x0)
+ *  OUTPUT      : update to iteration variable x0+dx
+ ******************************************************************************/
+inline double kes_itercore2_res(
+    const double ecc,
+    const double ma,
+    const double x0,
+    double*      f0
+    )
+{
+    return( itercore2( ecc, ma, x0, &kes_sincos, f0, NULL ) );
+} // end kes_itercore2_res
+
+/******************************************************************************/
+
+/*******************************************************************************
+ *  FUNCTION    : kes_itercore2_sc
+ *  DESCRIPTION : same as kes_itercore2, also returns the residual of x0
+ *                and e*sin(x0), e*cos(x0) for the partial derivatives
+ *  INPUT       : - eccentricity "ecc"
+ *                - mean anomaly "ma" (in radians)
+ *                - old value of iteration variable "x0"
+ *                - pointer "f0" to return M - x0 + e*sin(x0) (or NULL)
+ *                - array "sc" to return e*sin(x0), e*cos(x0)
+ *  OUTPUT      : update to iteration variable x0+dx
+ ******************************************************************************/
+inline double kes_itercore2_sc(
+    const double ecc,
+    const double ma,
+    const double x0,
+    double*      f0,
+    double*      sc
+    )
+{
+    return( itercore2( ecc, ma, x0, &kes_sincos, f0, sc ) );
+} // end kes_itercore2_sc
+
+/******************************************************************************/
+
+/*******************************************************************************
+ *  FUNCTION    : itercore3
+ *  DESCRIPTION : iteration method: Halley, cubic convergence
+ *  NOTE          generic version for sin/cos kernel "sincos"
+ *  INPUT       : - eccentricity "ecc"
+ *                - mean anomaly "ma" (in radians)
+ *                - old value of iteration variable "x0"
+ *                - sin/cos kernel "sincos"
+ *                - pointer "f0x" to return M - x0 + e*sin(x0) (or NULL)
+ *                - pointer "sc" to return e*sin(x0), e*cos(x0) (or NULL)
+ *  OUTPUT      : update to iteration variable x0+dx
+ ******************************************************************************/
+static inline double itercore3(
+    const double        ecc,
+    const double        ma,
+    const double        x0,
+    kes_sincos_t* const sincos,
+    double*             f0x,
+    double*             sc
+    )
 {
     double ecx, esx; /* ecc*cos(x), ecc*sin(x) */
     double dx;       /* increment deltax */
 
     /* calculate sin, cos */
-    kes_sincos( &esx, &ecx, x0, ecc );
+    sincos( &esx, &ecx, x0, ecc );
+    if ( sc != NULL )
+    {
+        sc[0] = esx;
+        sc[1] = ecx;
+    } // end if
 
     /* evaluate Kepler Equation: 0th derivative */
     const double f0 = ma - x0 + esx;
+    if ( f0x != NULL )
+    {
+        *f0x = f0;
+    } // end if
 
     /* evaluate Kepler Equation: 1st derivative */
     const double f1 = 1.0 - ecx + addzero;
@@ -124,32 +249,131 @@ inline double kes_itercore3(
     //dx = f0 / fma(dx, f2, f1);
 
     return( x0 + dx );
+} // end itercore3
+
+/******************************************************************************/
+
+/*******************************************************************************
+ *  FUNCTION    : kes_itercore3
+ *  DESCRIPTION : iteration method: Halley, cubic convergence
+ *  INPUT       : - eccentricity "ecc"
+ *                - mean anomaly "ma" (in radians)
+ *                - old value of iteration variable "x0"
+ *  OUTPUT      : update to iteration variable x0+dx
+ ******************************************************************************/
+inline double kes_itercore3(
+    const double ecc,
+    const double ma,
+    const double x0
+    )
+{
+    return( itercore3( ecc, ma, x0, &kes_sincos, NULL, NULL ) );
 } // end kes_itercore3
 
 /******************************************************************************/
 
 /*******************************************************************************
- *  FUNCTION    : itercore4
- *  DESCRIPTION : iteration method: Danby-Burkardt, quartic convergence
+ *  FUNCTION    : kes_itercore3_fast
+ *  DESCRIPTION : same as kes_itercore3, with fast sin/cos (error about 1E-12)
  *  INPUT       : - eccentricity "ecc"
  *                - mean anomaly "ma" (in radians)
  *                - old value of iteration variable "x0"
  *  OUTPUT      : update to iteration variable x0+dx
  ******************************************************************************/
-inline double kes_itercore4(
+inline double kes_itercore3_fast(
     const double ecc,
     const double ma,
     const double x0
     )
+{
+    return( itercore3( ecc, ma, x0, &kes_sincos_fast, NULL, NULL ) );
+} // end kes_itercore3_fast
+
+/******************************************************************************/
+
+/*******************************************************************************
+ *  FUNCTION    : kes_itercore3_res
+ *  DESCRIPTION : same as kes_itercore3, also returns the residual of x0
+ *  INPUT       : - eccentricity "ecc"
+ *                - mean anomaly "ma" (in radians)
+ *                - old value of iteration variable "x0"
+ *                - pointer "f0" to return M - x0 + e*sin(x0)
+ *  OUTPUT      : update to iteration variable x0+dx
+ ******************************************************************************/
+inline double kes_itercore3_res(
+    const double ecc,
+    const double ma,
+    const double x0,
+    double*      f0
+    )
+{
+    return( itercore3( ecc, ma, x0, &kes_sincos, f0, NULL ) );
+} // end kes_itercore3_res
+
+/******************************************************************************/
+
+/*******************************************************************************
+ *  FUNCTION    : kes_itercore3_sc
+ *  DESCRIPTION : same as kes_itercore3, also returns the residual of x0
+ *                and e*sin(x0), e*cos(x0) for the partial derivatives
+ *  INPUT       : - eccentricity "ecc"
+ *                - mean anomaly "ma" (in radians)
+ *                - old value of iteration variable "x0"
+ *                - pointer "f0" to return M - x0 + e*sin(x0) (or NULL)
+ *                - array "sc" to return e*sin(x0), e*cos(x0)
+ *  OUTPUT      : update to iteration variable x0+dx
+ ******************************************************************************/
+inline double kes_itercore3_sc(
+    const double ecc,
+    const double ma,
+    const double x0,
+    double*      f0,
+    double*      sc
+    )
+{
+    return( itercore3( ecc, ma, x0, &kes_sincos, f0, sc ) );
+} // end kes_itercore3_sc
+
+/******************************************************************************/
+
+/*******************************************************************************
+ *  FUNCTION    : itercore4
+ *  DESCRIPTION : iteration method: Danby-Burkardt, quartic convergence
+ *  NOTE          generic version for sin/cos kernel "sincos"
+ *  INPUT       : - eccentricity "ecc"
+ *                - mean anomaly "ma" (in radians)
+ *                - old value of iteration variable "x0"
+ *                - sin/cos kernel "sincos"
+ *                - pointer "f0x" to return M - x0 + e*sin(x0) (or NULL)
+ *                - pointer "sc" to return e*sin(x0), e*cos(x0) (or NULL)
+ *  OUTPUT      : update to iteration variable x0+dx
+ ******************************************************************************/
+static inline double itercore4(
+    const double        ecc,
+    const double        ma,
+    const double        x0,
+    kes_sincos_t* const sincos,
+    double*             f0x,
+    double*             sc
+    )
 {
     double ecx, esx; /* ecc*cos(x), ecc*sin(x) */
     double dx;       /* increment deltax */
 
     /* calculate sin, cos */
-    kes_sincos( &esx, &ecx, x0, ecc );
+    sincos( &esx, &ecx, x0, ecc );
+    if ( sc != NULL )
+    {
+        sc[0] = esx;
+        sc[1] = ecx;
+    } // end if
 
     /* evaluate Kepler Equation: 0th derivative */
     const double f0 = ma - x0 + esx;
+    if ( f0x != NULL )
+    {
+        *f0x = f0;
+    } // end if
 
     /* evaluate Kepler Equation: 1st derivative */
     const double f1 = 1.0 - ecx + addzero;
@@ -172,32 +396,131 @@ inline double kes_itercore4(
     // TODO dx = f0 / fma(dx, fma(dx, f3, f2), f1);
 
     return( x0 + dx );
+} // end itercore4
+
+/******************************************************************************/
+
+/*******************************************************************************
+ *  FUNCTION    : kes_itercore4
+ *  DESCRIPTION : iteration method: Danby-Burkardt, quartic convergence
+ *  INPUT       : - eccentricity "ecc"
+ *                - mean anomaly "ma" (in radians)
+ *                - old value of iteration variable "x0"
+ *  OUTPUT      : update to iteration variable x0+dx
+ ******************************************************************************/
+inline double kes_itercore4(
+    const double ecc,
+    const double ma,
+    const double x0
+    )
+{
+    return( itercore4( ecc, ma, x0, &kes_sincos, NULL, NULL ) );
 } // end kes_itercore4
 
 /******************************************************************************/
 
 /*******************************************************************************
- *  FUNCTION    : itercore5
- *  DESCRIPTION : iteration method: Danby-Burkardt, quintic convergence
+ *  FUNCTION    : kes_itercore4_fast
+ *  DESCRIPTION : same as kes_itercore4, with fast sin/cos (error about 1E-12)
  *  INPUT       : - eccentricity "ecc"
  *                - mean anomaly "ma" (in radians)
  *                - old value of iteration variable "x0"
  *  OUTPUT      : update to iteration variable x0+dx
  ******************************************************************************/
-inline double kes_itercore5(
+inline double kes_itercore4_fast(
     const double ecc,
     const double ma,
     const double x0
     )
+{
+    return( itercore4( ecc, ma, x0, &kes_sincos_fast, NULL, NULL ) );
+} // end kes_itercore4_fast
+
+/******************************************************************************/
+
+/*******************************************************************************
+ *  FUNCTION    : kes_itercore4_res
+ *  DESCRIPTION : same as kes_itercore4, also returns the residual of x0
+ *  INPUT       : - eccentricity "ecc"
+ *                - mean anomaly "ma" (in radians)
+ *                - old value of iteration variable "x0"
+ *                - pointer "f0" to return M - x0 + e*sin(x0)
+ *  OUTPUT      : update to iteration variable x0+dx
+ ******************************************************************************/
+inline double kes_itercore4_res(
+    const double ecc,
+    const double ma,
+    const double x0,
+    double*      f0
+    )
+{
+    return( itercore4( ecc, ma, x0, &kes_sincos, f0, NULL ) );
+} // end kes_itercore4_res
+
+/******************************************************************************/
+
+/*******************************************************************************
+ *  FUNCTION    : kes_itercore4_sc
+ *  DESCRIPTION : same as kes_itercore4, also returns the residual of x0
+ *                and e*sin(x0), e*cos(x0) for the partial derivatives
+ *  INPUT       : - eccentricity "ecc"
+ *                - mean anomaly "ma" (in radians)
+ *                - old value of iteration variable "x0"
+ *                - pointer "f0" to return M - x0 + e*sin(x0) (or NULL)
+ *                - array "sc" to return e*sin(x0), e*cos(x0)
+ *  OUTPUT      : update to iteration variable x0+dx
+ ******************************************************************************/
+inline double kes_itercore4_sc(
+    const double ecc,
+    const double ma,
+    const double x0,
+    double*      f0,
+    double*      sc
+    )
+{
+    return( itercore4( ecc, ma, x0, &kes_sincos, f0, sc ) );
+} // end kes_itercore4_sc
+
+/******************************************************************************/
+
+/*******************************************************************************
+ *  FUNCTION    : itercore5
+ *  DESCRIPTION : iteration method: Danby-Burkardt, quintic convergence
+ *  NOTE          generic version for sin/cos kernel "sincos"
+ *  INPUT       : - eccentricity "ecc"
+ *                - mean anomaly "ma" (in radians)
+ *                - old value of iteration variable "x0"
+ *                - sin/cos kernel "sincos"
+ *                - pointer "f0x" to return M - x0 + e*sin(x0) (or NULL)
+ *                - pointer "sc" to return e*sin(x0), e*cos(x0) (or NULL)
+ *  OUTPUT      : update to iteration variable x0+dx
+ ******************************************************************************/
+static inline double itercore5(
+    const double        ecc,
+    const double        ma,
+    const double        x0,
+    kes_sincos_t* const sincos,
+    double*             f0x,
+    double*             sc
+    )
 {
     double ecx, esx; /* ecc*cos(x), ecc*sin(x) */
     double dx;       /* increment deltax */
 
     /* calculate sin, cos */
-    kes_sincos( &esx, &ecx, x0, ecc );
+    sincos( &esx, &ecx, x0, ecc );
+    if ( sc != NULL )
+    {
+        sc[0] = esx;
+        sc[1] = ecx;
+    } // end if
 
     /* evaluate Kepler Equation: 0th derivative */
     const double f0 = ma - x0 + esx;
+    if ( f0x != NULL )
+    {
+        *f0x = f0;
+    } // end if
 
     /* evaluate Kepler Equation: 1st derivative */
     const double f1 = 1.0 - ecx + addzero;
@@ -227,6 +550,147 @@ inline double kes_itercore5(
     dx = f0 / fma(dx, fma(dx, fma(dx, f4, f3), f2), f1);
 
     return( x0 + dx );
+} // end itercore5
+
+/******************************************************************************/
+
+/*******************************************************************************
+ *  FUNCTION    : kes_itercore5
+ *  DESCRIPTION : iteration method: Danby-Burkardt, quintic convergence
+ *  INPUT       : - eccentricity "ecc"
+ *                - mean anomaly "ma" (in radians)
+ *                - old value of iteration variable "x0"
+ *  OUTPUT      : update to iteration variable x0+dx
+ ******************************************************************************/
+inline double kes_itercore5(
+    const double ecc,
+    const double ma,
+    const double x0
+    )
+{
+    return( itercore5( ecc, ma, x0, &kes_sincos, NULL, NULL ) );
 } // end kes_itercore5
 
 /******************************************************************************/
+
+/*******************************************************************************
+ *  FUNCTION    : kes_itercore5_fast
+ *  DESCRIPTION : same as kes_itercore5, with fast sin/cos (error about 1E-12)
+ *  INPUT       : - eccentricity "ecc"
+ *                - mean anomaly "ma" (in radians)
+ *                - old value of iteration variable "x0"
+ *  OUTPUT      : update to iteration variable x0+dx
+ ******************************************************************************/
+inline double kes_itercore5_fast(
+    const double ecc,
+    const double ma,
+    const double x0
+    )
+{
+    return( itercore5( ecc, ma, x0, &kes_sincos_fast, NULL, NULL ) );
+} // end kes_itercore5_fast
+
+/******************************************************************************/
+
+/*******************************************************************************
+ *  FUNCTION    : kes_itercore5_res
+ *  DESCRIPTION : same as kes_itercore5, also returns the residual of x0
+ *  INPUT       : - eccentricity "ecc"
+ *                - mean anomaly "ma" (in radians)
+ *                - old value of iteration variable "x0"
+ *                - pointer "f0" to return M - x0 + e*sin(x0)
+ *  OUTPUT      : update to iteration variable x0+dx
+ ******************************************************************************/
+inline double kes_itercore5_res(
+    const double ecc,
+    const double ma,
+    const double x0,
+    double*      f0
+    )
+{
+    return( itercore5( ecc, ma, x0, &kes_sincos, f0, NULL ) );
+} // end kes_itercore5_res
+
+/******************************************************************************/
+
+/*******************************************************************************
+ *  FUNCTION    : kes_itercore5_sc
+ *  DESCRIPTION : same as kes_itercore5, also returns the residual of x0
+ *                and e*sin(x0), e*cos(x0) for the partial derivatives
+ *  INPUT       : - eccentricity "ecc"
+ *                - mean anomaly "ma" (in radians)
+ *                - old value of iteration variable "x0"
+ *                - pointer "f0" to return M - x0 + e*sin(x0) (or NULL)
+ *                - array "sc" to return e*sin(x0), e*cos(x0)
+ *  OUTPUT      : update to iteration variable x0+dx
+ ******************************************************************************/
+inline double kes_itercore5_sc(
+    const double ecc,
+    const double ma,
+    const double x0,
+    double*      f0,
+    double*      sc
+    )
+{
+    return( itercore5( ecc, ma, x0, &kes_sincos, f0, sc ) );
+} // end kes_itercore5_sc
+
+/******************************************************************************/
+
+/*******************************************************************************
+ *  FUNCTION    : kes_stop_order
+ *  DESCRIPTION : predictive stopping rule for iteration methods of order p,
+ *                the error of x1 is about C*|dx|^p with the error constant C
+ *                bounded by (1/(1-e))^(p-1) for the methods above
+ *  INPUT       : - stopping rule "stop" from enum kes_stop_e
+ *                - order of convergence "order"
+ *                - eccentricity "ecc" (elliptic)
+ *                - new value of iteration variable "x1"
+ *                - last increment "dx" = |x1 - x0|
+ *                - tolerance "tolx" (absolute, relative, or in units of
+ *                  DBL_EPSILON for ulp of x1)
+ *  OUTPUT      : 1 if the predicted error of x1 is below tolerance, else 0
+ ******************************************************************************/
+inline int kes_stop_order(
+    const kes_stop_e stop,
+    const int        order,
+    const double     ecc,
+    const double     x1,
+    const double     dx,
+    const double     tolx
+    )
+{
+    /* tolerance for the predicted error */
+    double tol;
+    switch ( stop )
+    {
+        case KES_STOP_ORDER:
+            tol = tolx;
+            break;
+
+        case KES_STOP_ORDER_REL:
+            tol = tolx * fabs(x1);
+            break;
+
+        case KES_STOP_ORDER_ULP:
+            /* tolx / DBL_EPSILON units in the last place of x1 */
+            tol = (tolx / DBL_EPSILON) *
+                  (nextafter(fabs(x1), HUGE_VAL) - fabs(x1));
+            break;
+
+        default:
+            return( 0 );
+    } // end switch
+
+    /* predicted error |dx| * (|dx| / (1 - e))^(p-1) */
+    const double ratio = dx / (1.0 - ecc);
+    double       pred  = dx;
+    for (int k = 1; k < order; k++)
+    {
+        pred *= ratio;
+    } // end for
+
+    return( pred <= tol );
+} // end kes_stop_order
+
+/******************************************************************************/
@@ -29,6 +29,11 @@
 
 /******************************************************************************/
 
+/* include module headers */
+#include "utils.h"
+
+/******************************************************************************/
+
 /*** function declarations ***/
 
 #ifdef __cplusplus
@@ -50,6 +55,61 @@ double kes_itercore2(
 );
 
 
+/*!
+ * @brief Newton-Raphson iteration method with fast sin/cos
+ * @details same as kes_itercore2(), using kes_sincos_fast() with absolute
+ * error of about 1E-12, i.e. suitable for early iterations only
+ * @param[in] ecc eccentricity
+ * @param[in] ma mean anomaly (in radians)
+ * @param[in] x0 iteration variable
+ * @return refined iteration variable x0 + dx
+ */
+double kes_itercore2_fast(
+    const double ecc,
+    const double ma,
+    const double x0
+);
+
+
+/*!
+ * @brief Newton-Raphson iteration method returning the residual of x0
+ * @details same as kes_itercore2(), the residual M - x0 + e*sin(x0) is a
+ * by-product of the step, see kes_set_conv()
+ * @param[in] ecc eccentricity
+ * @param[in] ma mean anomaly (in radians)
+ * @param[in] x0 iteration variable
+ * @param[out] f0 residual of Kepler's Equation at x0
+ * @return refined iteration variable x0 + dx
+ */
+double kes_itercore2_res(
+    const double ecc,
+    const double ma,
+    const double x0,
+    double*      f0
+);
+
+
+/*!
+ * @brief Newton-Raphson iteration method returning sin/cos of x0
+ * @details same as kes_itercore2_res(), also returns e*sin(x0) and
+ * e*cos(x0), from which the partial derivatives at the solution follow,
+ * see kes_set_deriv()
+ * @param[in] ecc eccentricity
+ * @param[in] ma mean anomaly (in radians)
+ * @param[in] x0 iteration variable
+ * @param[out] f0 residual of Kepler's Equation at x0 (or NULL)
+ * @param[out] sc array of e*sin(x0) and e*cos(x0)
+ * @return refined iteration variable x0 + dx
+ */
+double kes_itercore2_sc(
+    const double ecc,
+    const double ma,
+    const double x0,
+    double*      f0,
+    double*      sc
+);
+
+
 /*!
  * @brief Halley iteration method
  * @details cubic convergence
@@ -65,6 +125,61 @@ double kes_itercore3(
 );
 
 
+/*!
+ * @brief Halley iteration method with fast sin/cos
+ * @details same as kes_itercore3(), using kes_sincos_fast() with absolute
+ * error of about 1E-12, i.e. suitable for early iterations only
+ * @param[in] ecc eccentricity
+ * @param[in] ma mean anomaly (in radians)
+ * @param[in] x0 iteration variable
+ * @return refined iteration variable x0 + dx
+ */
+double kes_itercore3_fast(
+    const double ecc,
+    const double ma,
+    const double x0
+);
+
+
+/*!
+ * @brief Halley iteration method returning the residual of x0
+ * @details same as kes_itercore3(), the residual M - x0 + e*sin(x0) is a
+ * by-product of the step, see kes_set_conv()
+ * @param[in] ecc eccentricity
+ * @param[in] ma mean anomaly (in radians)
+ * @param[in] x0 iteration variable
+ * @param[out] f0 residual of Kepler's Equation at x0
+ * @return refined iteration variable x0 + dx
+ */
+double kes_itercore3_res(
+    const double ecc,
+    const double ma,
+    const double x0,
+    double*      f0
+);
+
+
+/*!
+ * @brief Halley iteration method returning sin/cos of x0
+ * @details same as kes_itercore3_res(), also returns e*sin(x0) and
+ * e*cos(x0), from which the partial derivatives at the solution follow,
+ * see kes_set_deriv()
+ * @param[in] ecc eccentricity
+ * @param[in] ma mean anomaly (in radians)
+ * @param[in] x0 iteration variable
+ * @param[out] f0 residual of Kepler's Equation at x0 (or NULL)
+ * @param[out] sc array of e*sin(x0) and e*cos(x0)
+ * @return refined iteration variable x0 + dx
+ */
+double kes_itercore3_sc(
+    const double ecc,
+    const double ma,
+    const double x0,
+    double*      f0,
+    double*      sc
+);
+
+
 /*!
  * @brief Danby-Burkardt 4th order iteration method
  * @details quartic convergence
@@ -80,6 +195,61 @@ double kes_itercore4(
 );
 
 
+/*!
+ * @brief Danby-Burkardt 4th order iteration method with fast sin/cos
+ * @details same as kes_itercore4(), using kes_sincos_fast() with absolute
+ * error of about 1E-12, i.e. suitable for early iterations only
+ * @param[in] ecc eccentricity
+ * @param[in] ma mean anomaly (in radians)
+ * @param[in] x0 iteration variable
+ * @return refined iteration variable x0 + dx
+ */
+double kes_itercore4_fast(
+    const double ecc,
+    const double ma,
+    const double x0
+);
+
+
+/*!
+ * @brief Danby-Burkardt 4th order iteration method returning the residual of x0
+ * @details same as kes_itercore4(), the residual M - x0 + e*sin(x0) is a
+ * by-product of the step, see kes_set_conv()
+ * @param[in] ecc eccentricity
+ * @param[in] ma mean anomaly (in radians)
+ * @param[in] x0 iteration variable
+ * @param[out] f0 residual of Kepler's Equation at x0
+ * @return refined iteration variable x0 + dx
+ */
+double kes_itercore4_res(
+    const double ecc,
+    const double ma,
+    const double x0,
+    double*      f0
+);
+
+
+/*!
+ * @brief Danby-Burkardt 4th order iteration method returning sin/cos of x0
+ * @details same as kes_itercore4_res(), also returns e*sin(x0) and
+ * e*cos(x0), from which the partial derivatives at the solution follow,
+ * see kes_set_deriv()
+ * @param[in] ecc eccentricity
+ * @param[in] ma mean anomaly (in radians)
+ * @param[in] x0 iteration variable
+ * @param[out] f0 residual of Kepler's Equation at x0 (or NULL)
+ * @param[out] sc array of e*sin(x0) and e*cos(x0)
+ * @return refined iteration variable x0 + dx
+ */
+double kes_itercore4_sc(
+    const double ecc,
+    const double ma,
+    const double x0,
+    double*      f0,
+    double*      sc
+);
+
+
 /*!
  * @brief Danby-Burkardt 5th order iteration method
  * @details quintic convergence
@@ -94,6 +264,83 @@ double kes_itercore5(
     const double x0
 );
 
+
+/*!
+ * @brief Danby-Burkardt 5th order iteration method with fast sin/cos
+ * @details same as kes_itercore5(), using kes_sincos_fast() with absolute
+ * error of about 1E-12, i.e. suitable for early iterations only
+ * @param[in] ecc eccentricity
+ * @param[in] ma mean anomaly (in radians)
+ * @param[in] x0 iteration variable
+ * @return refined iteration variable x0 + dx
+ */
+double kes_itercore5_fast(
+    const double ecc,
+    const double ma,
+    const double x0
+);
+
+
+/*!
+ * @brief Danby-Burkardt 5th order iteration method returning the residual of x0
+ * @details same as kes_itercore5(), the residual M - x0 + e*sin(x0) is a
+ * by-product of the step, see kes_set_conv()
+ * @param[in] ecc eccentricity
+ * @param[in] ma mean anomaly (in radians)
+ * @param[in] x0 iteration variable
+ * @param[out] f0 residual of Kepler's Equation at x0
+ * @return refined iteration variable x0 + dx
+ */
+double kes_itercore5_res(
+    const double ecc,
+    const double ma,
+    const double x0,
+    double*      f0
+);
+
+
+/*!
+ * @brief Danby-Burkardt 5th order iteration method returning sin/cos of x0
+ * @details same as kes_itercore5_res(), also returns e*sin(x0) and
+ * e*cos(x0), from which the partial derivatives at the solution follow,
+ * see kes_set_deriv()
+ * @param[in] ecc eccentricity
+ * @param[in] ma mean anomaly (in radians)
+ * @param[in] x0 iteration variable
+ * @param[out] f0 residual of Kepler's Equation at x0 (or NULL)
+ * @param[out] sc array of e*sin(x0) and e*cos(x0)
+ * @return refined iteration variable x0 + dx
+ */
+double kes_itercore5_sc(
+    const double ecc,
+    const double ma,
+    const double x0,
+    double*      f0,
+    double*      sc
+);
+
+
+/*!
+ * @brief predictive stopping rule of the iteration methods
+ * @details for a method of order p the error of x1 is predicted as
+ * |dx| * (|dx| / (1 - e))^(p-1), see kes_set_stop()
+ * @param[in] stop stopping rule from enum #kes_stop_e
+ * @param[in] order order of convergence p of the method
+ * @param[in] ecc eccentricity (elliptic)
+ * @param[in] x1 new value of iteration variable
+ * @param[in] dx last increment |x1 - x0|
+ * @param[in] tolx tolerance (absolute, relative or DBL_EPSILON ulp of x1)
+ * @return 1 if the predicted error of x1 is below tolerance, else 0
+ */
+int kes_stop_order(
+    const kes_stop_e stop,
+    const int        order,
+    const double     ecc,
+    const double     x1,
+    const double     dx,
+    const double     tolx
+);
+
 #ifdef __cplusplus
 }
 #endif
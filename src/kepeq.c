@@ -95,3 +95,171 @@ inline double kes_keq_par(
 } // end kes_keq_par
 
 /******************************************************************************/
+
+/*******************************************************************************
+ *  FUNCTION    : kes_deriv_ell_sc
+ *  DESCRIPTION : partial derivatives of E(M,e) of the elliptic Kepler
+ *                Equation, by implicit differentiation of E - e*sin(E) = M
+ *  INPUT       : - eccentricity ecc (0 <= ecc < 1)
+ *                - sin(E) "sx" and cos(E) "cx" of the solution
+ *                - order "deriv" of derivatives
+ *                - pointer "d" to return the derivatives
+ *  OUTPUT      : none
+ ******************************************************************************/
+void kes_deriv_ell_sc(
+    const double      ecc,
+    const double      sx,
+    const double      cx,
+    const kes_deriv_e deriv,
+    kes_deriv_t*      d
+    )
+{
+    /* denominator D = 1 - e*cos(E) = dM/dE */
+    const double r = 1.0 / (1.0 - ecc * cx);
+
+    d->dEdM = r;
+    d->dEde = sx * r;
+
+    if ( deriv >= KES_DERIV_SECOND )
+    {
+        const double r3 = r * r * r;
+        d->dEdMM = -ecc * sx * r3;
+        d->dEdMe = (cx - ecc) * r3;
+        d->dEdee = sx * (2.0 * cx * (1.0 - ecc * cx) - ecc * sx * sx) * r3;
+    } // end if
+} // end kes_deriv_ell_sc
+
+/******************************************************************************/
+
+/* sin/cos of the last iteration step, per thread */
+static __thread kes_trig_t kes_trig_slot = { NAN, 0.0, 0.0 };
+
+/*******************************************************************************
+ *  FUNCTION    : kes_trig_last
+ *  DESCRIPTION : sin/cos of the last iteration step of the calling thread
+ *  INPUT       : none
+ *  OUTPUT      : pointer to the thread's kes_trig_t
+ ******************************************************************************/
+kes_trig_t* kes_trig_last(void)
+{
+    return( &kes_trig_slot );
+} // end kes_trig_last
+
+/******************************************************************************/
+
+/*******************************************************************************
+ *  FUNCTION    : kes_deriv_ell
+ *  DESCRIPTION : partial derivatives of E(M,e) of the elliptic Kepler
+ *                Equation, reusing sin/cos of the last iteration step
+ *  INPUT       : - eccentricity ecc (0 <= ecc < 1)
+ *                - solution x (in radians)
+ *                - pointer "trig" to sin/cos of the last step
+ *                - order of derivatives "deriv"
+ *                - pointer "d" to return the derivatives
+ *  OUTPUT      : none
+ ******************************************************************************/
+void kes_deriv_ell(
+    const double      ecc,
+    const double      x,
+    const kes_trig_t* trig,
+    const kes_deriv_e deriv,
+    kes_deriv_t*      d
+    )
+{
+    double sx, cx;
+
+    /* step from the last iterate to the solution */
+    const double h = x - trig->x;
+
+    if ( (ecc > 0.0) && (fabs( h ) <= KES_DERIV_MAXSTEP) )
+    {
+        /* rotate sin/cos of the last iterate by h, truncated series of
+         * sin(h) and cos(h) - 1 (NOTE fails for x = NAN)
+         */
+        const double h2 = h * h;
+        const double sh = h * (1.0 - h2 / 6.0 * (1.0 - h2 / 20.0));
+        const double ch = -0.5 * h2 * (1.0 - h2 / 12.0 * (1.0 - h2 / 30.0));
+        const double es = trig->es + (trig->es * ch + trig->ec * sh);
+        const double ec = trig->ec + (trig->ec * ch - trig->es * sh);
+
+        sx = es / ecc;
+        cx = ec / ecc;
+    } // end if
+    else
+    {
+        kes_sincos( &sx, &cx, x, -1.0 );
+    } // end else
+
+    kes_deriv_ell_sc( ecc, sx, cx, deriv, d );
+} // end kes_deriv_ell
+
+/******************************************************************************/
+
+/*******************************************************************************
+ *  FUNCTION    : kes_deriv_hyp
+ *  DESCRIPTION : partial derivatives of H(M,e) of the hyperbolic Kepler
+ *                Equation, by implicit differentiation of e*sinh(H) - H = M
+ *  INPUT       : - eccentricity ecc (ecc > 1)
+ *                - solution x (in radians)
+ *                - order "deriv" of derivatives
+ *                - pointer "d" to return the derivatives
+ *  OUTPUT      : none
+ ******************************************************************************/
+void kes_deriv_hyp(
+    const double      ecc,
+    const double      x,
+    const kes_deriv_e deriv,
+    kes_deriv_t*      d
+    )
+{
+    double sx, cx;
+    kes_sinhcosh( &sx, &cx, x, -1.0 );
+
+    /* denominator D = e*cosh(H) - 1 = dM/dH */
+    const double r  = 1.0 / (ecc * cx - 1.0);
+
+    d->dEdM = r;
+    d->dEde = -sx * r;
+
+    if ( deriv >= KES_DERIV_SECOND )
+    {
+        const double r3 = r * r * r;
+        d->dEdMM = -ecc * sx * r3;
+        d->dEdMe = (cx - ecc) * r3;
+        d->dEdee = sx * (2.0 * cx * (ecc * cx - 1.0) - ecc * sx * sx) * r3;
+    } // end if
+} // end kes_deriv_hyp
+
+/******************************************************************************/
+
+/*******************************************************************************
+ *  FUNCTION    : kes_deriv_par
+ *  DESCRIPTION : partial derivatives of the true anomaly of Barker's
+ *                Equation s + s^3 / 3 = M with s = tan(x/2)
+ *  INPUT       : - solution x (true anomaly, in radians)
+ *                - order "deriv" of derivatives
+ *                - pointer "d" to return the derivatives
+ *  OUTPUT      : none
+ ******************************************************************************/
+void kes_deriv_par(
+    const double      x,
+    const kes_deriv_e deriv,
+    kes_deriv_t*      d
+    )
+{
+    /* ds/dM = 1/(1 + s^2), dx/ds = 2/(1 + s^2) */
+    const double s = tan( 0.5 * x );
+    const double r = 1.0 / (1.0 + s * s);
+
+    d->dEdM = 2.0 * r * r;
+    d->dEde = NAN;
+
+    if ( deriv >= KES_DERIV_SECOND )
+    {
+        d->dEdMM = -8.0 * s * r * r * r * r;
+        d->dEdMe = NAN;
+        d->dEdee = NAN;
+    } // end if
+} // end kes_deriv_par
+
+/******************************************************************************/
@@ -27,6 +27,37 @@
 #ifndef KES_KEPEQ__H
 #define KES_KEPEQ__H
 
+/* include module headers */
+#include "input.h"
+#include "utils.h"
+
+/******************************************************************************/
+
+/*** declare macro constants ***/
+
+/* max. distance of the solution from the iterate of the last step whose
+ * sin/cos are reused for the partial derivatives (in radians), the series
+ * of the rotation are accurate to about 1E-20 below
+ */
+#define KES_DERIV_MAXSTEP 1E-3
+
+/******************************************************************************/
+
+/*** declare data structures ***/
+
+/*!
+ * @brief iterate of the last step with full accuracy and e*sin, e*cos at it
+ * @details kept per thread by the iteration functions while partial
+ * derivatives are requested, see kes_trig_keep(), and reused by
+ * kes_deriv_ell(); x = NAN if not available
+ */
+typedef struct
+{
+    double x;   ///< iterate of the last step
+    double es;  ///< e*sin(x)
+    double ec;  ///< e*cos(x)
+} kes_trig_t;
+
 /******************************************************************************/
 
 /*** function declarations ***/
@@ -76,6 +107,109 @@ double kes_keq_par(
     const double x
 );
 
+
+/*!
+ * @brief sin/cos of the last iteration step of the calling thread
+ * @details internal state of the solver functions, not part of
+ * #kes_input_t, i.e. a shared input structure is not written to
+ * @return pointer to structure of type #kes_trig_t of the calling thread
+ */
+kes_trig_t* kes_trig_last(void);
+
+
+/*!
+ * @brief keep sin/cos of the last iteration step for the derivatives
+ * @details called by the iteration functions at their end, does nothing
+ * unless partial derivatives are requested in \a data
+ * @param[in] data pointer to input parameters with order "deriv"
+ * @param[in] x iterate of the last step with full accuracy (or NAN)
+ * @param[in] es e*sin(x)
+ * @param[in] ec e*cos(x)
+ */
+static inline void kes_trig_keep(
+    const kes_input_t* data,
+    const double       x,
+    const double       es,
+    const double       ec
+    )
+{
+    if ( data->deriv != KES_DERIV_NONE )
+    {
+        kes_trig_t* trig = kes_trig_last();
+        trig->x  = x;
+        trig->es = es;
+        trig->ec = ec;
+    } // end if
+} // end kes_trig_keep
+
+
+/*!
+ * @brief partial derivatives of the elliptic Kepler Equation's solution
+ * @details reuses e*sin and e*cos of the last iteration step in \a trig
+ * if that step is within KES_DERIV_MAXSTEP of \a x, otherwise sin/cos are
+ * evaluated at \a x
+ * @param[in] ecc eccentricity (0 <= ecc < 1)
+ * @param[in] x solution, elliptic eccentric anomaly (in radians)
+ * @param[in] trig pointer to sin/cos of the last step, see kes_trig_last()
+ * @param[in] deriv order of derivatives from enum #kes_deriv_e
+ * @param[out] d pointer to structure of type #kes_deriv_t
+ */
+void kes_deriv_ell(
+    const double      ecc,
+    const double      x,
+    const kes_trig_t* trig,
+    const kes_deriv_e deriv,
+    kes_deriv_t*      d
+);
+
+
+/*!
+ * @brief partial derivatives of the elliptic Kepler Equation's solution
+ * from sin/cos of the solution
+ * @param[in] ecc eccentricity (0 <= ecc < 1)
+ * @param[in] sx sin(E) of the solution
+ * @param[in] cx cos(E) of the solution
+ * @param[in] deriv order of derivatives from enum #kes_deriv_e
+ * @param[out] d pointer to structure of type #kes_deriv_t
+ */
+void kes_deriv_ell_sc(
+    const double      ecc,
+    const double      sx,
+    const double      cx,
+    const kes_deriv_e deriv,
+    kes_deriv_t*      d
+);
+
+
+/*!
+ * @brief partial derivatives of the hyperbolic Kepler Equation's solution
+ * @param[in] ecc eccentricity (ecc > 1)
+ * @param[in] x solution, hyperbolic eccentric anomaly (in radians)
+ * @param[in] deriv order of derivatives from enum #kes_deriv_e
+ * @param[out] d pointer to structure of type #kes_deriv_t
+ */
+void kes_deriv_hyp(
+    const double      ecc,
+    const double      x,
+    const kes_deriv_e deriv,
+    kes_deriv_t*      d
+);
+
+
+/*!
+ * @brief partial derivatives of the parabolic Kepler Equation's solution
+ * @details derivatives of the true anomaly with respect to M, those with
+ * respect to e are set to NAN
+ * @param[in] x solution, true anomaly (in radians)
+ * @param[in] deriv order of derivatives from enum #kes_deriv_e
+ * @param[out] d pointer to structure of type #kes_deriv_t
+ */
+void kes_deriv_par(
+    const double      x,
+    const kes_deriv_e deriv,
+    kes_deriv_t*      d
+);
+
 #ifdef __cplusplus
 }
 #endif
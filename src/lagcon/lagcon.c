@@ -30,6 +30,7 @@
 /* include module headers */
 #include "lagcon.h"
 #include "debug.h"
+#include "trace.h"
 #include "itercore.h"
 #include "kepeq.h"
 #include "utils.h"
@@ -57,18 +58,17 @@ int lagcon(
     double       x, dx, f0, f1;  /* */
 	double       ecosx, esinx;   /* */
 
-    /* correction factor for absolute error deltaf */
-    const double corr = ecc / (1.0 - ecc);
+    /* correction factor for absolute error deltaf (precomputed if available) */
+    const double corr = ((res->terms != NULL) ?
+                         res->terms->corr : ecc / (1.0 - ecc));
 
     /* reset error residuals */
     deltax = deltaf = 0.0;
-#if KES_SHOW_ITER_STATS
     res->nbrSinEval = res->nbrCosEval = res->nbrFktEval = 0;
-#endif
 
-#if KES_ITER_DEBUG
-    KES_DEBUG_STM("lagcon", ecc, ma, starter);
-#endif
+    /* trace iteration process? */
+    const int trace = kes_trace_begin();
+    kes_trace_step( trace, KES_SOL_LAGCON, 0, ecc, ma, starter, 0.0, 0.0 );
 
     /* use starter to initialize iteration */
     x = starter;
@@ -82,9 +82,7 @@ int lagcon(
         /* evaluate Kepler Equation and its first derivative */
         f0 = x - esinx - ma;
         f1 = 1.0 - ecosx;
-#if KES_SHOW_ITER_STATS
         ++(res->nbrSinEval); ++(res->nbrCosEval); ++(res->nbrFktEval);
-#endif
 
         /* increment, eq. (16) */
         dx = 5.0 * f0 / (f1 + sqrt( fabs(16.0 * f1 * f1 - 20.0 * f0 * esinx) ));
@@ -98,9 +96,8 @@ int lagcon(
         deltax = fabs(dx);
         deltaf = fabs(f0) * corr;
 
-#if KES_ITER_DEBUG
-    KES_DEBUG_SOL("lagcon", count, deltax, deltaf);
-#endif
+        kes_trace_step( trace, KES_SOL_LAGCON, count, ecc, ma,
+                        x, deltax, deltaf );
     } while (
         (deltax > res->tolx) &&
         (deltaf > res->tolf) &&
@@ -27,6 +27,10 @@
 #ifndef LIBKES__H
 #define LIBKES__H
 
+/* include standard headers */
+#include <stddef.h>
+#include <stdint.h>
+
 /******************************************************************************/
 
 /*** declare macro constants ***/
@@ -37,6 +41,104 @@
 /* default maximum number of iterations */
 #define KES_STD_MAXITER 100
 
+/* fixed number of iterations chosen by the library, see kes_set_fixiter() */
+#define KES_FIX_AUTO    (-1)
+
+/* number of segments in 0 <= E <= pi of solver method KES_SOL_EKS */
+#define KES_EKS_NSEG    12
+
+/* default number of elements per work item of the thread pool */
+#define KES_STD_CHUNK   256
+
+/* max. extrapolation step of kes_plan_solve_warm() (in radians) */
+#define KES_WARM_MAXSTEP 0.5
+
+/* steps between recomputations of sin(E), cos(E) and of the reduced mean
+ * anomaly by kes_propagator_run(), bounds the drift of the recurrences to a
+ * few ulp
+ */
+#define KES_PROP_RENORM 32
+
+/* max. number of Halley corrections per step of kes_propagator_run() */
+#define KES_PROP_MAXCORR 4
+
+/* long runs of kes_propagator_run() advance this number of sequences of at
+ * least KES_PROP_MINLANE steps together
+ */
+#define KES_PROP_LANES   4
+#define KES_PROP_MINLANE 64
+
+/* orbits and epochs of one tile of kes_ephem_run(), i.e. the epochs
+ * of a tile stay in the L1 cache and its solutions in the L2 cache
+ */
+#define KES_EPHEM_ORBITS 16
+#define KES_EPHEM_EPOCHS 256
+
+/* epochs of one work item of the thread pool, a multiple of KES_EPHEM_EPOCHS,
+ * i.e. the plans of an orbit tile are reused for 16 time tiles
+ */
+#define KES_EPHEM_SPAN   4096
+
+/* elliptic orbits with ecc > KES_NEARPAR_ECC use the near-parabolic solver */
+#define KES_NEARPAR_ECC  0.99
+
+/* ... and so does the corner ecc > KES_CORNER_ECC, reduced M < KES_CORNER_MA
+ * + KES_CORNER_SLOPE * (ecc - KES_CORNER_ECC), which widens to M < 0.535 as
+ * ecc approaches KES_NEARPAR_ECC
+ */
+#define KES_CORNER_ECC   0.8
+#define KES_CORNER_MA    0.25
+#define KES_CORNER_SLOPE 1.5
+
+/* flag of kesolver_batch_report() codes: element was stopped by "maxiter" */
+#define KES_FLAG_MAXITER 0x80
+
+/* default and min. tolerance of kes_plan_table_init() */
+#define KES_TABLE_TOL    1E-15
+
+/* alignment of arena blocks, see kes_arena_alloc() */
+#define KES_ARENA_ALIGN  64
+
+/* number of bins of the iteration histogram, last bin counts all solves
+ * with (KES_STATS_ITER_BINS - 1) or more iterations
+ */
+#define KES_STATS_ITER_BINS 16
+
+/* number of bins of the residual histogram, see kes_stats_t */
+#define KES_STATS_RES_BINS  20
+
+/* max. number of entries of the cache (72 bytes each) */
+#define KES_CACHE_MAXCAP ((size_t)1 << 26)
+
+/* number of eccentricity bands of the dispatch table, see kes_auto_ecc */
+#define KES_AUTO_ECC_BINS 8
+
+/* number of bands of reduced mean anomaly, see kes_auto_ma */
+#define KES_AUTO_MA_BINS  4
+
+/* default tolerance of single-precision solvers, relative to max(1, |E|);
+ * smaller tolerances in kes_input_t are raised to this value
+ */
+#define KES_STD_TOLF    2E-7
+
+/* number of lanes of the vectorized single-precision solver, covers one
+ * AVX-512 or two AVX2 registers of type float
+ */
+#define KES_VECF_LEN    16
+
+/* value 1 in format Q2.30 */
+#define KES_Q30_ONE     ((kes_q30_t)1 << 30)
+
+/* conversions from and to double for hosts and constants (rounded to the
+ * nearest, halfway cases away from zero), NOTE not for code on targets
+ * without floating-point unit
+ */
+#define KES_Q30_FROM(x)   ((kes_q30_t)(((x) >= 0.0) ? \
+                                       (x) * 1073741824.0 + 0.5 : \
+                                       (x) * 1073741824.0 - 0.5))
+#define KES_BAM_FROM(x)   ((kes_bam_t)(int64_t)((x) * 683565275.57643159))
+#define KES_BAM_TO(a)     ((double)(a) * 1.4629180792671596E-09)
+
 /******************************************************************************/
 
 /*** declare data structures ***/
@@ -57,6 +159,8 @@ typedef enum
     KES_ERR_BADSTM,    ///< bad starter method in kes_starter()
     KES_ERR_BADSOL,    ///< bad solver method in kesolver()
     KES_ERR_BADTOL,    ///< bad value for error tolerance
+    KES_ERR_BADFILE,   ///< bad or outdated table file in kes_table_load()
+    KES_ERR_NOMEM,     ///< out of memory in allocator or workspace
 
     KES_ERR_TOTAL      ///< total number of error entries
 } kes_err_e;
@@ -67,125 +171,2207 @@ typedef enum
  * @details discriminate between different eccentricity domains
  * based on value of the \a eccentricity (must be positive or zero)
  */
-typedef enum
-{
-    KES_ECC_NEG = 0, ///< invalid case    : e < 0
-    KES_ECC_CIRC,    ///< circular case   : e = 0
-    KES_ECC_ELL,     ///< elliptic case   : 0 < e < 1
-    KES_ECC_PAR,     ///< parabolic case  : e = 1
-    KES_ECC_HYP      ///< hyperbolic case : e > 1
-} kes_ecc_e;
+typedef enum
+{
+    KES_ECC_NEG = 0, ///< invalid case    : e < 0
+    KES_ECC_CIRC,    ///< circular case   : e = 0
+    KES_ECC_ELL,     ///< elliptic case   : 0 < e < 1
+    KES_ECC_PAR,     ///< parabolic case  : e = 1
+    KES_ECC_HYP      ///< hyperbolic case : e > 1
+} kes_ecc_e;
+
+
+/*!
+ * @brief accuracy tiers for trigonometric functions
+ * @details selects the sin/cos kernel used by the iteration methods,
+ * see kes_set_trig()
+ */
+typedef enum
+{
+    KES_TRIG_FULL = 0, ///< full accuracy, about 1 ulp (default)
+    KES_TRIG_FAST,     ///< reduced accuracy, about 1E-12, for early iterations
+
+    KES_TRIG_TOTAL     ///< total number of accuracy tiers
+} kes_trig_e;
+
+
+/*!
+ * @brief convergence tests of the iteration methods
+ * @details selects when the residual of the Kepler Equation is evaluated,
+ * see kes_set_conv()
+ */
+typedef enum
+{
+    KES_CONV_FULL = 0, ///< residual of each new iterate (default)
+    KES_CONV_LEAN,     ///< residual of the previous iterate from the step
+
+    KES_CONV_TOTAL     ///< total number of convergence tests
+} kes_conv_e;
+
+/******************************************************************************/
+
+/*!
+ * @brief stopping rules of the iteration methods
+ * @details selects if the known order of convergence predicts the error of
+ * the next iterate, and the tolerance it is compared to, see kes_set_stop()
+ */
+typedef enum
+{
+    KES_STOP_DELTA = 0, ///< observe |x(n+1)-x(n)| <= tolx (default)
+    KES_STOP_ORDER,     ///< predicted error of x(n+1) <= tolx
+    KES_STOP_ORDER_REL, ///< predicted error of x(n+1) <= tolx * |x(n+1)|
+    KES_STOP_ORDER_ULP, ///< same with tolx/DBL_EPSILON ulp of x(n+1)
+
+    KES_STOP_TOTAL      ///< total number of stopping rules
+} kes_stop_e;
+
+
+/*!
+ * @brief orders of partial derivatives of the solution
+ * @details selects which partial derivatives of the eccentric anomaly are
+ * returned with the solution, see kes_set_deriv()
+ */
+typedef enum
+{
+    KES_DERIV_NONE = 0, ///< no derivatives (default)
+    KES_DERIV_FIRST,    ///< dE/dM and dE/de
+    KES_DERIV_SECOND,   ///< also d2E/dM2, d2E/dMde and d2E/de2
+
+    KES_DERIV_TOTAL     ///< total number of derivative orders
+} kes_deriv_e;
+
+
+/*!
+ * @brief starter methods for the hyperbolic Kepler Equation
+ * @details selects the starting value of the hyperbolic solvers, see
+ * kes_set_hstarter() and kes_starter_hyp()
+ */
+typedef enum
+{
+    KES_HSTM_BOUND = 0, ///< smaller of cubic and asinh upper bound (default)
+    KES_HSTM_CUBIC,     ///< cubic approximation, upper bound for small H
+    KES_HSTM_ASINH,     ///< two fixed-point steps of asinh, lower bound
+    KES_HSTM_LOG,       ///< logarithm for large M from Danby (1987)
+
+    KES_HSTM_TOTAL      ///< total number of hyperbolic starter methods
+} kes_hstm_e;
+
+
+/*!
+ * @brief enumeration of starter methods
+ * @details reference list of starter methods:
+ * Odell & Gooding (1986), Celestial Mechanics, Volume 38, Issue 4, p.307-334
+ * [ADS link](http://adsabs.harvard.edu/abs/1986CeMec..38..307O)
+ */
+typedef enum
+{
+    KES_STM_NONE = 0, ///< unidentified (void) starting value method
+
+    /* different starter methods for elliptic case */
+    KES_STM_ES00,     ///< starting value "pi"
+    KES_STM_ES01,     ///< starter S1 from Odell & Gooding (1986)
+    KES_STM_ES02,     ///< starter S2 from Odell & Gooding (1986)
+    KES_STM_ES03,     ///< starter S3 from Odell & Gooding (1986)
+    KES_STM_ES04,     ///< starter S4 from Odell & Gooding (1986)
+    KES_STM_ES05,     ///< starter S5 from Odell & Gooding (1986)
+    KES_STM_ES06,     ///< starter S6 from Odell & Gooding (1986)
+    KES_STM_ES07,     ///< starter S7 from Odell & Gooding (1986)
+    KES_STM_ES08,     ///< starter S8 from Odell & Gooding (1986)
+    KES_STM_ES09,     ///< starter S9 from Odell & Gooding (1986)
+    KES_STM_ES10,     ///< starter S10 from Odell & Gooding (1986)
+    KES_STM_ES11,     ///< starter S11 from Odell & Gooding (1986)
+    KES_STM_ES12,     ///< starter S12 from Odell & Gooding (1986)
+    KES_STM_ES13,     ///< starter from Encke (1850)
+    KES_STM_ES14,     ///< starter from Charles & Tatum (1998)
+    KES_STM_ES15,     ///< starter from tabulated solutions (lookup table)
+
+    KES_STM_TOTAL     ///< total number of available starting value methods
+} kes_stm_e;
+
+
+/*!
+ * @brief enumeration of solver types
+ * @details list of all available iteration methods
+ */
+typedef enum
+{
+    KES_SOL_NONE = 0, ///< unidentified (void) solver method
+
+    /* different solver methods */
+    KES_SOL_BISECT,   ///< Bisection method
+    KES_SOL_DANBUR4,  ///< Danby-Burkardt method (order 4)
+    KES_SOL_DANBUR5,  ///< Danby-Burkardt method (order 5)
+    KES_SOL_FIXEDP,   ///< Fixed-point method
+    KES_SOL_HALLEY,   ///< Halley method
+    KES_SOL_LAGCON,   ///< Laguerre-Conway method
+    KES_SOL_MARKLEY,  ///< Markley method
+    KES_SOL_MIKKOLA,  ///< Mikkola method
+    KES_SOL_NEWRAP,   ///< Newton-Raphson method
+    KES_SOL_NIJENH,   ///< Nijenhuis method
+    KES_SOL_SECANT,   ///< Secant method
+    KES_SOL_WEGSEC,   ///< Wegstein's secant modification
+    KES_SOL_BRENT,    ///< Brent's method (bracketing with interpolation)
+    KES_SOL_CORDIC,   ///< CORDIC-like method (rotations, no sin/cos)
+    KES_SOL_FUKUSH,   ///< Fukushima's method (segments, tabulated sin/cos)
+    KES_SOL_EKS,      ///< enhanced Kepler solver (segmented Taylor series)
+    KES_SOL_HYBRID,   ///< safeguarded hybrid (Danby-Burkardt in a bracket)
+
+    KES_SOL_TOTAL,    ///< total number of available solver methods
+
+    /* NOTE not a solver method, resolved per call, see kes_auto_select() */
+    KES_SOL_AUTO      ///< automatic selection of starter and solver method
+} kes_sol_e;
+
+
+/*!
+ * @brief structure containing eccentricity-dependent constants
+ * @details precomputed once per eccentricity by kes_plan_init() and the
+ * batch solvers, the solver methods read them via \a terms in #kes_input_t
+ * NOTE only for internal use
+ */
+typedef struct
+{
+    double corr;       ///< correction factor e/(1-e) for residual |f(x)|
+    double e1;         ///< eccentricity complement 1-e
+    double mk_ad;      ///< Markley: constant 3*pi^2/(pi^2-6) of alpha(e,M)
+    double mk_ak;      ///< Markley: factor 1.6*pi/(pi^2-6)/(1+e) of alpha(e,M)
+    double mk_d0;      ///< Markley: term 3*(1-e) of d(e,M)
+    double mi_frac;    ///< Mikkola/Nijenhuis: denominator 1/(0.5+4e)
+    double mi_corr;    ///< Mikkola: factor 0.078/(1+e) of O(s^5) correction
+    int    ek_init;    ///< EKS: table below is valid (1) or not (0)
+    double ek_ma[KES_EKS_NSEG + 1];      ///< EKS: mean anomalies of nodes
+    double ek_coef[KES_EKS_NSEG + 1][5]; ///< EKS: Taylor coefficients of
+                                         ///< E(M) at nodes, orders 1 to 5
+} kes_terms_t;
+
+
+/*!
+ * @brief structure containing partial derivatives of the solution
+ * @details derivatives of the eccentric anomaly E(M,e) of the elliptic and
+ * hyperbolic Kepler Equation, with D = 1 - e*cos(E) resp.
+ * D = e*cosh(H) - 1; for parabolic orbits the derivatives of the true
+ * anomaly with respect to M, those with respect to e are not defined (NAN)
+ */
+typedef struct
+{
+    double dEdM;  ///< dE/dM = 1/D
+    double dEde;  ///< dE/de = sin(E)/D
+    double dEdMM; ///< d2E/dM2 (only for KES_DERIV_SECOND)
+    double dEdMe; ///< d2E/dMde (only for KES_DERIV_SECOND)
+    double dEdee; ///< d2E/de2 (only for KES_DERIV_SECOND)
+} kes_deriv_t;
+
+
+/*!
+ * @brief structure containing iteration data
+ * @details use this structure as interface to function kesolver()
+ */
+typedef struct
+{
+    /* user can get/set these parameters */
+    double tolf;       ///< iteration tolerance for f(x(n))
+    double tolx;       ///< iteration tolerance for x(n)
+    int    maxiter;    ///< maximum number of iterations
+    int    fixiter;    ///< fixed number of iterations (0 = off, default)
+    kes_trig_e trig;   ///< accuracy of sin/cos (KES_TRIG_FULL = default)
+    kes_conv_e conv;   ///< convergence test (KES_CONV_FULL = default)
+    kes_stop_e stop;   ///< stopping rule (KES_STOP_DELTA = default)
+    kes_deriv_e deriv; ///< partial derivatives (KES_DERIV_NONE = default)
+    kes_hstm_e hinit;  ///< hyperbolic starter (KES_HSTM_BOUND = default)
+
+    /* output from iteration function */
+    double result;     ///< returns solution of Kepler Equation
+    double starter;    ///< starting value for first iteration
+    double errDF;      ///< residual error for |f(x(n+1))|
+    double errDX;      ///< residual error for |x(n+1)-x(n)|
+    int    iterations; ///< number of iterations performed until convergence
+    kes_deriv_t partial; ///< partial derivatives, see kes_set_deriv()
+
+    /* counters for function evaluations of the last call of kesolver(),
+     * aggregated over many calls by the statistics collector (kes_set_stats)
+     */
+    int    nbrSinEval; ///< number of evaluations of sin()
+    int    nbrCosEval; ///< number of evaluations of cos()
+    int    nbrFktEval; ///< number of evaluations of kes_keq_xxx()
+
+    /* pointer to precomputed constants (or NULL)
+     * NOTE only for internal use, reset by kes_check_input()
+     */
+    const kes_terms_t* terms; ///< eccentricity-dependent constants
+} kes_input_t;
+
+
+/*!
+ * @brief structure containing solver settings only
+ * @details read-only in all functions taking a pointer to it, i.e. one
+ * instance can be shared between threads; create with kes_new_config()
+ */
+typedef struct
+{
+    double     tolf;    ///< iteration tolerance for f(x(n))
+    double     tolx;    ///< iteration tolerance for x(n)
+    int        maxiter; ///< maximum number of iterations
+    int        fixiter; ///< fixed number of iterations (0 = off, default)
+    kes_trig_e trig;    ///< accuracy of sin/cos (KES_TRIG_FULL = default)
+    kes_conv_e conv;    ///< convergence test (KES_CONV_FULL = default)
+    kes_stop_e stop;    ///< stopping rule (KES_STOP_DELTA = default)
+    kes_hstm_e hinit;   ///< hyperbolic starter (KES_HSTM_BOUND = default)
+} kes_config_t;
+
+
+/*!
+ * @brief compact result record of a single solve (16 bytes)
+ * @details optional output of kesolver_cfg(), residuals are rounded to float
+ */
+typedef struct
+{
+    float     errDF;      ///< residual error for |f(x(n+1))|
+    float     errDX;      ///< residual error for |x(n+1)-x(n)|
+    int       iterations; ///< number of iterations
+    kes_err_e status;     ///< error code from enum #kes_err_e
+} kes_result_t;
+
+
+/*!
+ * @brief prototype declaration for starter functions
+ * @details functions return the starting value for the reduced mean anomaly
+ */
+typedef double kes_stm_t(
+    const double ecc,
+    const double ma
+);
+
+
+/*!
+ * @brief prototype declaration for iteration functions
+ * @details functions return number of iterations performed until convergence,
+ * the resulting solution is returned in \a data->result
+ */
+typedef int kes_iter_t(
+    const double ecc,
+    const double ma,
+    const double starter,
+    kes_input_t* data
+);
+
+
+/*!
+ * @brief piecewise Chebyshev table of the elliptic Kepler Equation
+ * @details opaque type, see kes_plan_table_init()
+ */
+typedef struct kes_table_s kes_table_t;
+
+
+/*!
+ * @brief memory allocator used by the library
+ * @details all memory of tables, the thread pool, the result cache, the
+ * statistics and profiles and of the GPU batches is obtained from the
+ * current allocator, see kes_set_allocator(); \a alloc returns memory
+ * aligned for any type or NULL, \a resize may be NULL (the library then
+ * allocates, copies and releases), \a release may be NULL if memory is
+ * reclaimed as a whole (e.g. by kes_arena_reset()); every callback gets the
+ * \a ctx pointer and the size of the block as requested before
+ */
+typedef struct
+{
+    void* (*alloc)(void* ctx, size_t size);                ///< allocate
+    void* (*resize)(void* ctx, void* ptr, size_t oldsize,
+                    size_t size);                          ///< reallocate
+    void  (*release)(void* ctx, void* ptr, size_t size);   ///< release
+    void*  ctx;                                            ///< user data
+} kes_alloc_t;
+
+
+/*!
+ * @brief bump allocator on a caller-provided buffer
+ * @details blocks are carved from the buffer one after the other, aligned
+ * to KES_ARENA_ALIGN bytes, and only released together by
+ * kes_arena_reset(); the last block grows in place; allocation is
+ * lock-free and may be called from several threads
+ */
+typedef struct
+{
+    unsigned char* base;   ///< first aligned byte of the buffer
+    size_t         size;   ///< usable bytes from base
+    size_t         used;   ///< bytes already handed out
+} kes_arena_t;
+
+
+/*!
+ * @brief arguments of one batch for kesolver_batch(), see kes_submit()
+ */
+typedef struct
+{
+    size_t             n;          ///< number of elements
+    const double*      ecc;        ///< array of eccentricities
+    size_t             incecc;     ///< stride of array ecc (0 or 1)
+    const double*      ma;         ///< array of mean anomalies (in radians)
+    double*            ea;         ///< array of solutions (in radians)
+    kes_stm_e          init;       ///< method for starting value
+    kes_sol_e          iter;       ///< method for iterative solver
+    const kes_input_t* data;       ///< input parameters (or NULL)
+    kes_err_e*         status;     ///< per-element error codes (or NULL)
+    int*               iterations; ///< per-element iterations (or NULL)
+} kes_batch_t;
+
+
+/*!
+ * @brief handle of a batch submitted to the thread pool
+ * @details opaque type, see kes_submit()
+ */
+typedef struct kes_job_s kes_job_t;
+
+
+/*!
+ * @brief function called when all elements of a submitted batch are solved
+ * @details runs in one of the threads of the pool; it may submit new
+ * batches, but must not wait for its own batch or reconfigure the pool
+ */
+typedef void (*kes_callback_t)(
+    const kes_batch_t* batch,
+    const kes_err_e    err,
+    void*              arg
+);
+
+
+/*!
+ * @brief batch of elements resident on an OpenCL device
+ * @details opaque type, see kes_gpu_new()
+ */
+typedef struct kes_gpu_s kes_gpu_t;
+
+
+/*!
+ * @brief structure containing a solver plan for a fixed eccentricity
+ * @details created by kes_plan_init(), holds the resolved starter and
+ * solver functions, the checked input parameters and the precomputed
+ * eccentricity-dependent constants; a plan is not modified by the solver
+ * functions and can be shared between threads
+ * NOTE treat all members as read-only
+ */
+typedef struct
+{
+    double          ecc;     ///< eccentricity
+    kes_ecc_e       type;    ///< eccentricity domain
+    kes_stm_e       init;    ///< starter method
+    kes_sol_e       iter;    ///< solver method
+    kes_err_e       status;  ///< error code from kes_plan_init()
+    kes_stm_t*      stm;     ///< resolved starter function
+    kes_iter_t*     func;    ///< resolved iteration function
+    int             fixiter; ///< resolved fixed number of iterations
+    kes_input_t     data;    ///< checked input parameters
+    kes_terms_t     terms;   ///< eccentricity-dependent constants
+    kes_table_t*    table;   ///< optional table, see kes_plan_table_init()
+} kes_plan_t;
+
+
+/*!
+ * @brief structure containing the state of a warm-start solver
+ * @details holds the previous solution of a time sequence of mean anomalies,
+ * see kes_plan_solve_warm(); use one state per trajectory and reset it with
+ * kes_warm_init() before the first call
+ */
+typedef struct
+{
+    double ma;         ///< previous mean anomaly (in radians)
+    double ea;         ///< previous solution (in radians)
+    double fac;        ///< derivative dE/dM = 1/(1-e*cos(E)) at solution
+    int    side;       ///< side of previous reduced mean anomaly (+1 or -1)
+    int    valid;      ///< previous solution is available (1) or not (0)
+    int    iterations; ///< number of iterations of last solution
+} kes_warm_t;
+
+
+/*!
+ * @brief summary of the outcome of a batch, see kesolver_batch_report()
+ */
+typedef struct
+{
+    size_t    failed;  ///< number of elements with an error
+    size_t    first;   ///< index of the first failing element (n if none)
+    kes_err_e err;     ///< error code of the first failing element
+    size_t    maxiter; ///< number of elements stopped by "maxiter"
+} kes_report_t;
+
+
+/*!
+ * @brief record of one step of an iteration process
+ * @details iteration 0 holds the starter value, deltax and deltaf are zero
+ * for steps without evaluation of the residuals
+ */
+typedef struct
+{
+    kes_sol_e solver;    ///< solver method performing the iteration
+    int       iteration; ///< iteration counter
+    double    ecc;       ///< eccentricity
+    double    ma;        ///< (reduced) mean anomaly
+    double    x;         ///< current value of iteration variable
+    double    deltax;    ///< error residual |x(n+1) - x(n)|
+    double    deltaf;    ///< error residual of Kepler Equation
+} kes_trace_t;
+
+
+/*!
+ * @brief prototype declaration for trace callback functions
+ * @details called once per record, \a user is the pointer given to
+ * kes_set_trace(); callbacks may run concurrently in several threads
+ */
+typedef void kes_trace_fn(
+    const kes_trace_t* rec,
+    void*              user
+);
+
+
+/*!
+ * @brief enumeration of eccentricity bands for statistics
+ */
+typedef enum
+{
+    KES_BAND_LOW = 0, ///< 0 <= ecc < 0.5 (including circular orbits)
+    KES_BAND_MID,     ///< 0.5 <= ecc < 0.9
+    KES_BAND_HIGH,    ///< 0.9 <= ecc <= KES_NEARPAR_ECC
+    KES_BAND_NEARPAR, ///< KES_NEARPAR_ECC < ecc < 1 (elliptic)
+    KES_BAND_PAR,     ///< parabolic orbits
+    KES_BAND_HYP,     ///< hyperbolic orbits
+
+    KES_BAND_TOTAL    ///< total number of eccentricity bands
+} kes_band_e;
+
+
+/*!
+ * @brief structure containing aggregated statistics of solver calls
+ * @details bin k > 0 of the residual histogram counts solves with
+ * 10^(-k) < deltaf <= 10^(1-k), bin 1 all larger residuals and the last
+ * bin all smaller residuals;
+ * bin 0 counts residuals which were not evaluated (fixed iterations,
+ * closed-form solutions) or are exactly zero
+ */
+typedef struct
+{
+    uint64_t calls;      ///< number of successful solver calls
+    uint64_t iterations; ///< total number of iterations
+    uint64_t maxiter;    ///< number of solves stopped by "maxiter"
+    uint64_t nbrSinEval; ///< total number of evaluations of sin()
+    uint64_t nbrCosEval; ///< total number of evaluations of cos()
+    uint64_t nbrFktEval; ///< total number of evaluations of kes_keq_xxx()
+    uint64_t histIter[KES_STATS_ITER_BINS]; ///< histogram of iterations
+    uint64_t histRes[KES_STATS_RES_BINS];   ///< histogram of residuals
+} kes_stats_t;
+
+
+/*!
+ * @brief structure containing aggregated clock ticks of kesolver() calls
+ * @details ticks are read from the time stamp counter (x86, rdtsc), the
+ * virtual counter (ARM64, cntvct_el0) or a monotonic clock in nanoseconds;
+ * the cost of reading the counter is subtracted from every stage;
+ * "cycWrapper" is the remainder of the call outside of starter and
+ * iterations, i.e. argument checks, method resolution, range reduction and
+ * closed-form or direct solutions without a starter
+ */
+typedef struct
+{
+    uint64_t calls;      ///< number of profiled successful calls
+    uint64_t cycles;     ///< total ticks of the calls
+    uint64_t cycStarter; ///< ticks spent in the starter function
+    uint64_t cycIter;    ///< ticks spent in the iteration function
+    uint64_t cycWrapper; ///< remaining ticks of kesolver() and its wrappers
+} kes_profile_t;
+
+
+/*!
+ * @brief structure containing the counters of the cache
+ * @details requests without a usable key (e.g. "fixiter" > 4095) are
+ * neither hits nor misses
+ */
+typedef struct
+{
+    uint64_t capacity; ///< number of entries (0 = cache disabled)
+    uint64_t hits;     ///< number of requests served from the cache
+    uint64_t misses;   ///< number of requests not found in the cache
+    uint64_t inserts;  ///< number of solutions stored in the cache
+} kes_cache_stats_t;
+
+
+/*!
+ * @brief pair of starter and solver method selected for a region
+ */
+typedef struct
+{
+    kes_stm_e init; ///< starter method
+    kes_sol_e iter; ///< solver method
+} kes_auto_pair_t;
+
+
+/*!
+ * @brief dispatch table of KES_SOL_AUTO
+ * @details entry ell[i][j] is used for elliptic orbits with
+ * kes_auto_ecc[i] <= ecc < kes_auto_ecc[i + 1] and reduced mean anomaly
+ * kes_auto_ma[j] <= |ma| < kes_auto_ma[j + 1], reduced to -pi <= ma < pi
+ */
+typedef struct
+{
+    kes_auto_pair_t ell[KES_AUTO_ECC_BINS][KES_AUTO_MA_BINS]; ///< elliptic
+    kes_sol_e       hyp; ///< solver method for hyperbolic orbits
+} kes_auto_table_t;
+
+
+/*!
+ * @brief prototype declaration for single-precision starter functions
+ * @details functions return the starting value for the reduced mean anomaly
+ */
+typedef float kes_stmf_t(
+    const float ecc,
+    const float ma
+);
+
+
+/*!
+ * @brief structure containing a single-precision solver plan
+ * @details created by kes_planf_init() for a fixed eccentricity
+ */
+typedef struct
+{
+    float       ecc;     ///< eccentricity of the plan
+    kes_stm_e   init;    ///< starter method
+    kes_sol_e   iter;    ///< solver method
+    kes_ecc_e   type;    ///< eccentricity domain
+    kes_err_e   status;  ///< error code from creation of the plan
+    kes_stmf_t* stm;     ///< resolved starter function
+    int         order;   ///< order of iteration method (2 <= order <= 5)
+    kes_input_t data;    ///< checked input parameters
+} kes_planf_t;
+
+
+/*!
+ * @brief orbital elements in structure-of-arrays layout
+ * @details arrays are read with stride \a incel, i.e. 0 for a single orbit
+ * common to all elements (e.g. a time series of mean anomalies), 1 for
+ * arrays of orbits (e.g. a constellation of satellites)
+ */
+typedef struct
+{
+    const double* a;    ///< semi-major axis (a > 0 elliptic, a < 0 hyperbolic)
+    const double* ecc;  ///< eccentricity
+    const double* inc;  ///< inclination (in radians)
+    const double* node; ///< longitude of the ascending node (in radians)
+    const double* argp; ///< argument of pericenter (in radians)
+    size_t        incel; ///< stride of the arrays above (0 or 1)
+} kes_elements_t;
+
+
+/*!
+ * @brief Cartesian state vectors in structure-of-arrays layout
+ * @details all arrays hold at least n elements
+ */
+typedef struct
+{
+    double* x;  ///< x-components of position
+    double* y;  ///< y-components of position
+    double* z;  ///< z-components of position
+    double* vx; ///< x-components of velocity
+    double* vy; ///< y-components of velocity
+    double* vz; ///< z-components of velocity
+} kes_state_t;
+
+
+/*!
+ * @brief structure containing the extended result of a solver function
+ * @details the quantities needed by most callers after a solve, i.e. for
+ * positions r = a * (cos(E) - e, sqrt(1-e^2) * sin(E)); hyperbolic orbits
+ * use sinh(H), cosh(H), parabolic orbits the true anomaly nu
+ */
+typedef struct
+{
+    double x;   ///< solution E, H or nu, same as the result of kesolver()
+    double sx;  ///< sin(E), sinh(H) or sin(nu)
+    double cx;  ///< cos(E), cosh(H) or cos(nu)
+    double rad; ///< radius r/|a| = |1 - e*cos(E)|, |1 - e*cosh(H)|,
+                ///< or r/q = 2 / (1 + cos(nu)) for parabolic orbits
+    double nu;  ///< true anomaly (in radians) if requested, 0 otherwise
+} kes_solution_t;
+
+
+/*!
+ * @brief structure containing the state of a uniform-step propagator
+ * @details created by kes_propagator_init() for one elliptic orbit with
+ * mean anomalies M(k) = M0 + k * dM, the steps are emitted in order by
+ * kes_propagator_run(); sin(E) and cos(E) are carried forward by rotations
+ * sin(E+d) = sin(E) cos(d) + cos(E) sin(d), cos(E+d) = cos(E) cos(d) -
+ * sin(E) sin(d) and corrected by Halley steps,
+ * NOTE treat all members as read-only
+ */
+typedef struct
+{
+    double      ecc;        ///< eccentricity
+    double      ma0;        ///< mean anomaly of step 0 (in radians)
+    double      dma;        ///< increment of the mean anomaly per step
+    double      dmr;        ///< increment reduced to [-pi:pi]
+    double      mbase;      ///< reduced mean anomaly at last recomputation
+    double      ma;         ///< reduced mean anomaly of the current step
+    double      ea;         ///< eccentric anomaly of the current step,
+                            ///< in the same range [-pi:pi] as ma
+    double      sx;         ///< sin(ea)
+    double      cx;         ///< cos(ea)
+    double      fac;        ///< derivative dE/dM = 1/(1-e*cos(ea))
+    size_t      step;       ///< index of the next step to emit
+    int         count;      ///< steps since last recomputation of sx, cx
+    int         wraps;      ///< multiples of 2*pi subtracted since then
+    int         iterations; ///< Halley steps of last kes_propagator_run()
+    int         fallbacks;  ///< steps solved by kesolver() instead
+    kes_stm_e   init;       ///< starter method of step 0 and fallbacks
+    kes_sol_e   iter;       ///< solver method of step 0 and fallbacks
+    kes_err_e   status;     ///< error code from kes_propagator_init()
+    kes_input_t data;       ///< checked input parameters
+} kes_propagator_t;
+
+
+/*!
+ * @brief fixed-point number in format Q2.30, i.e. value * 2^30 in 32 bits
+ * (range -2 <= x < 2, resolution 9.3E-10)
+ */
+typedef int32_t kes_q30_t;
+
+/*!
+ * @brief binary angle, i.e. 2^32 units per full turn (resolution 1.5E-9
+ * radians); reduction of angles to one turn is the wraparound of the
+ * unsigned type
+ */
+typedef uint32_t kes_bam_t;
+
+/******************************************************************************/
+
+/*** declare global variables ***/
+
+/*!
+ * @brief boundaries of the eccentricity bands of the dispatch table
+ */
+extern const double kes_auto_ecc[KES_AUTO_ECC_BINS + 1];
+
+/*!
+ * @brief boundaries of the bands of reduced mean anomaly (in radians)
+ */
+extern const double kes_auto_ma[KES_AUTO_MA_BINS + 1];
+
+/******************************************************************************/
+
+/*** function declarations ***/
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/*!
+ * @brief main solver function for Kepler Equation
+ * @details user can specify additional parameters via structure \a data;
+ * for ecc > 1 the hyperbolic Kepler Equation ecc*sinh(H) - H = ma is solved
+ * with a built-in starter (\a init is ignored) and iterations of the same
+ * order as \a iter, methods without hyperbolic variant use Halley's method;
+ * for |ecc - 1| <= 1E-10 the parabolic Kepler Equation is solved in
+ * closed form and the true anomaly is returned; for
+ * KES_NEARPAR_ECC < ecc < 1 Newton-Raphson, Halley, Danby-Burkardt, fixed-point,
+ * Laguerre-Conway, secant and Wegstein's secant method are replaced by a
+ * cancellation-free iteration of the same order with a built-in starter,
+ * likewise in the corner ecc > KES_CORNER_ECC, |M| < KES_CORNER_MA +
+ * KES_CORNER_SLOPE * (ecc - KES_CORNER_ECC) (modulo 2*pi) where these
+ * methods converge slowly or not at all;
+ * with \a iter = KES_SOL_AUTO both methods are selected for each call from
+ * the region of (ecc, ma), see kes_auto_select(), and \a init is ignored
+ * @param[in] ecc eccentricity
+ * @param[in] ma mean anomaly (in radians)
+ * @param[in] init choose a starter method from enum #kes_stm_e
+ * @param[in] iter choose a solver method from enum #kes_sol_e
+ * @param[in,out] data pointer to data structure of type #kes_input_t
+ * @param[out] status pointer to return error code from enum #kes_err_e
+ * @return solution to Kepler Equation
+ */
+double kesolver(
+    const double    ecc,
+    const double    ma,
+    const kes_stm_e init,
+    const kes_sol_e iter,
+    kes_input_t*    data,
+    kes_err_e*      status
+);
+
+
+/*!
+ * @brief batch solver function for Kepler Equation
+ * @details solves Kepler's Equation for an array of mean anomalies;
+ * input parameters are checked and methods are resolved only once per call,
+ * the structure \a data is not modified and can be shared between calls;
+ * elliptic and hyperbolic elements of mixed arrays are collected into
+ * separate blocks and solved by vectorized iterations, parabolic and
+ * near-parabolic elements are solved one by one as in kesolver(),
+ * all elements are solved one by one for KES_SOL_AUTO
+ * @param[in] n number of elements
+ * @param[in] ecc array of eccentricities
+ * @param[in] incecc stride of array \a ecc;
+ * use 0 for a single eccentricity common to all elements, 1 for an array
+ * @param[in] ma array of mean anomalies (in radians)
+ * @param[out] ea array of solutions to Kepler Equation
+ * @param[in] init choose a starter method from enum #kes_stm_e
+ * @param[in] iter choose a solver method from enum #kes_sol_e
+ * @param[in] data pointer to data structure of type #kes_input_t
+ * (or NULL for default settings)
+ * @param[out] status optional array of per-element error codes (or NULL)
+ * @param[out] iterations optional array of per-element iterations (or NULL)
+ * @return error code from enum #kes_err_e;
+ * KES_ERR_NOERR if all elements were solved, else code of first failure
+ */
+kes_err_e kesolver_batch(
+    const size_t       n,
+    const double*      ecc,
+    const size_t       incecc,
+    const double*      ma,
+    double*            ea,
+    const kes_stm_e    init,
+    const kes_sol_e    iter,
+    const kes_input_t* data,
+    kes_err_e*         status,
+    int*               iterations
+);
+
+
+/*!
+ * @brief batch solver function for Kepler Equation on strided arrays
+ * @details same results as kesolver_batch(), but eccentricities, mean
+ * anomalies and solutions are addressed by base pointers and strides in
+ * bytes (as in BLAS), e.g. members of an array of orbit element structures
+ * with a stride of the size of the structure; the elements are gathered
+ * into the lanes of the vectorized solvers and the solutions are scattered
+ * back, i.e. the caller needs no copies; unit strides (sizeof(double)) take
+ * the same path as kesolver_batch(); all addresses must be aligned for
+ * double
+ * @param[in] n number of elements
+ * @param[in] ecc pointer to the first eccentricity
+ * @param[in] strecc stride of \a ecc in bytes, 0 for a single eccentricity
+ * common to all elements
+ * @param[in] ma pointer to the first mean anomaly (in radians)
+ * @param[in] strma stride of \a ma in bytes
+ * @param[out] ea pointer to the first solution
+ * @param[in] strea stride of \a ea in bytes (not 0 for n > 1)
+ * @param[in] init choose a starter method from enum #kes_stm_e
+ * @param[in] iter choose a solver method from enum #kes_sol_e
+ * @param[in] data pointer to data structure of type #kes_input_t
+ * (or NULL for default settings)
+ * @param[out] status optional array of per-element error codes (or NULL)
+ * @param[out] iterations optional array of per-element iterations (or NULL)
+ * @return error code from enum #kes_err_e;
+ * KES_ERR_NOERR if all elements were solved, else code of first failure,
+ * KES_ERR_BADVAL for a zero stride of the solutions
+ */
+kes_err_e kesolver_batch_strided(
+    const size_t       n,
+    const double*      ecc,
+    const size_t       strecc,
+    const double*      ma,
+    const size_t       strma,
+    double*            ea,
+    const size_t       strea,
+    const kes_stm_e    init,
+    const kes_sol_e    iter,
+    const kes_input_t* data,
+    kes_err_e*         status,
+    int*               iterations
+);
+
+
+/*!
+ * @brief solver function for Kepler Equation with a shared configuration
+ * @details same solution as kesolver(), but the configuration \a cfg is
+ * only read, i.e. one instance can be shared by many threads, and the
+ * outputs go to an optional compact record instead of #kes_input_t
+ * @param[in] ecc eccentricity
+ * @param[in] ma mean anomaly (in radians)
+ * @param[in] init choose a starter method from enum #kes_stm_e
+ * @param[in] iter choose a solver method from enum #kes_sol_e
+ * @param[in] cfg pointer to structure of type #kes_config_t
+ * (or NULL for default settings)
+ * @param[out] res pointer to result record of type #kes_result_t (or NULL)
+ * @return solution to Kepler Equation
+ */
+double kesolver_cfg(
+    const double        ecc,
+    const double        ma,
+    const kes_stm_e     init,
+    const kes_sol_e     iter,
+    const kes_config_t* cfg,
+    kes_result_t*       res
+);
+
+
+/*!
+ * @brief batch solver function for Kepler Equation with a shared
+ * configuration
+ * @details same as kesolver_batch() with the settings of \a cfg
+ * @param[in] n number of elements
+ * @param[in] ecc array of eccentricities
+ * @param[in] incecc stride of array \a ecc;
+ * use 0 for a single eccentricity common to all elements, 1 for an array
+ * @param[in] ma array of mean anomalies (in radians)
+ * @param[out] ea array of solutions to Kepler Equation
+ * @param[in] init choose a starter method from enum #kes_stm_e
+ * @param[in] iter choose a solver method from enum #kes_sol_e
+ * @param[in] cfg pointer to structure of type #kes_config_t
+ * (or NULL for default settings)
+ * @param[out] status optional array of per-element error codes (or NULL)
+ * @param[out] iterations optional array of per-element iterations (or NULL)
+ * @return error code from enum #kes_err_e;
+ * KES_ERR_NOERR if all elements were solved, else code of first failure
+ */
+kes_err_e kesolver_batch_cfg(
+    const size_t        n,
+    const double*       ecc,
+    const size_t        incecc,
+    const double*       ma,
+    double*             ea,
+    const kes_stm_e     init,
+    const kes_sol_e     iter,
+    const kes_config_t* cfg,
+    kes_err_e*          status,
+    int*                iterations
+);
+
+
+/*!
+ * @brief batch solver function for Kepler Equation with a summary of errors
+ * @details same solutions as kesolver_batch(), but instead of an error code
+ * per element the outcome is summarized in \a report, which costs no stores
+ * for successful elements; the optional array \a codes holds one byte per
+ * element, the error code from enum #kes_err_e (KES_ERR_NOERR = 0) or'ed
+ * with KES_FLAG_MAXITER if the element was stopped by "maxiter"
+ * @param[in] n number of elements
+ * @param[in] ecc array of eccentricities
+ * @param[in] incecc stride of array \a ecc;
+ * use 0 for a single eccentricity common to all elements, 1 for an array
+ * @param[in] ma array of mean anomalies (in radians)
+ * @param[out] ea array of solutions to Kepler Equation
+ * @param[in] init choose a starter method from enum #kes_stm_e
+ * @param[in] iter choose a solver method from enum #kes_sol_e
+ * @param[in] data pointer to data structure of type #kes_input_t
+ * (or NULL for default settings)
+ * @param[out] report pointer to summary of type #kes_report_t (or NULL)
+ * @param[out] codes optional array of per-element codes (or NULL)
+ * @return error code from enum #kes_err_e;
+ * KES_ERR_NOERR if all elements were solved, else code of first failure
+ */
+kes_err_e kesolver_batch_report(
+    const size_t       n,
+    const double*      ecc,
+    const size_t       incecc,
+    const double*      ma,
+    double*            ea,
+    const kes_stm_e    init,
+    const kes_sol_e    iter,
+    const kes_input_t* data,
+    kes_report_t*      report,
+    uint8_t*           codes
+);
+
+
+/*!
+ * @brief batch solver function for Kepler Equation returning the partial
+ * derivatives of the solutions
+ * @details same solutions as kesolver_batch(), plus dE/dM and dE/de (and
+ * the second derivatives for KES_DERIV_SECOND) of every element in
+ * \a deriv, see #kes_deriv_t; the order is taken from "deriv" of \a data,
+ * KES_DERIV_FIRST if \a data is NULL or the order is KES_DERIV_NONE;
+ * sin/cos are taken from the last step of each element and corrected to
+ * the solution; failing elements, including those reaching the maximum
+ * number of iterations, get zero derivatives
+ * @param[in] n number of elements
+ * @param[in] ecc array of eccentricities
+ * @param[in] incecc stride of array \a ecc;
+ * use 0 for a single eccentricity common to all elements, 1 for an array
+ * @param[in] ma array of mean anomalies (in radians)
+ * @param[out] ea array of solutions to Kepler Equation
+ * @param[in] init choose a starter method from enum #kes_stm_e
+ * @param[in] iter choose a solver method from enum #kes_sol_e
+ * @param[in] data pointer to data structure of type #kes_input_t
+ * (or NULL for default settings)
+ * @param[out] deriv array of derivatives of type #kes_deriv_t
+ * @param[out] status optional array of per-element error codes (or NULL)
+ * @param[out] iterations optional array of per-element iterations (or NULL)
+ * @return error code from enum #kes_err_e;
+ * KES_ERR_NOERR if all elements were solved, else code of first failure,
+ * KES_ERR_BADVAL if \a deriv is NULL
+ */
+kes_err_e kesolver_batch_deriv(
+    const size_t       n,
+    const double*      ecc,
+    const size_t       incecc,
+    const double*      ma,
+    double*            ea,
+    const kes_stm_e    init,
+    const kes_sol_e    iter,
+    const kes_input_t* data,
+    kes_deriv_t*       deriv,
+    kes_err_e*         status,
+    int*               iterations
+);
+
+
+/*!
+ * @brief universal-variable batch solver for Kepler Equation
+ * @details solves elliptic, parabolic and hyperbolic elements by the same
+ * iteration, i.e. without partitioning a mixed batch by eccentricity domain:
+ * with perihelion distance and gravitational parameter scaled to 1, the
+ * universal anomaly s solves s + e * s^3 * c3(a*s^2) = t by the
+ * Laguerre-Conway method, where a = 1-e and c3 is a Stumpff function, and
+ * t = M / |1-e|^(3/2) (or sqrt(2)*M for parabolic orbits); the solutions
+ * are the same anomalies as from kesolver(), i.e. E in [0:2*pi] for
+ * elliptic, the true anomaly for parabolic (|1-e| <= 1E-10) and H for
+ * hyperbolic orbits; the near-parabolic band needs no special treatment;
+ * convergence is tested on the anomaly with "tolx" relative to
+ * max(1, |x|) and on the residual converted to the anomaly with "tolf",
+ * KES_FIX_AUTO selects a fixed number of iterations for all elements;
+ * NOTE valid for |M| / |1-e|^(3/2) < 1E300 and, for elliptic orbits,
+ * |M| < 1E15
+ * @param[in] n number of elements
+ * @param[in] ecc array of eccentricities
+ * @param[in] incecc stride of array \a ecc;
+ * use 0 for a single eccentricity common to all elements, 1 for an array
+ * @param[in] ma array of mean anomalies (in radians)
+ * @param[out] ea array of solutions to Kepler Equation
+ * @param[in] data pointer to data structure of type #kes_input_t
+ * (or NULL for default settings)
+ * @param[out] status optional array of per-element error codes (or NULL)
+ * @param[out] iterations optional array of per-element iterations (or NULL)
+ * @return error code from enum #kes_err_e;
+ * KES_ERR_NOERR if all elements were solved, else code of first failure
+ */
+kes_err_e kesolver_batch_univ(
+    const size_t       n,
+    const double*      ecc,
+    const size_t       incecc,
+    const double*      ma,
+    double*            ea,
+    const kes_input_t* data,
+    kes_err_e*         status,
+    int*               iterations
+);
+
+
+/*!
+ * @brief sine and cosine of a binary angle in fixed point
+ * @details table of sin(x) at multiples of pi/128 in a quarter turn, and the
+ * angle addition theorem with the Taylor series of the offset of at most
+ * pi/256, i.e. integer multiplications only; error below 3E-9
+ * @param[in] x angle (binary angle, 2^32 per turn)
+ * @param[out] s pointer to return sin(x) in format Q2.30
+ * @param[out] c pointer to return cos(x) in format Q2.30
+ */
+void kes_sincos_fix(
+    const kes_bam_t x,
+    kes_q30_t*      s,
+    kes_q30_t*      c
+);
+
+
+/*!
+ * @brief fixed-point solver for the elliptic Kepler Equation
+ * @details the same approach as kesolver() with 32-bit integers only: the
+ * mean anomaly is reduced by the wraparound of the binary angle and by the
+ * symmetry about pi, the starter is the minimum of the upper bounds
+ * M/(1-e), M+e and (M+e*pi)/(1+e) (starters S4, S6, S7) and a fixed number
+ * of Halley steps (3 for e <= 0.95 up to 10 for e > 0.999999) is taken with
+ * kes_sincos_fix(), i.e. the run time and the result are the same on all
+ * targets; products of 32-bit numbers are formed in 64 bits and a step takes
+ * two 64-bit divisions;
+ * the error in E is about 4E-9 radians divided by 1 - e*cos(E)
+ * @param[in] ecc eccentricity in format Q2.30 (0 <= ecc < 1)
+ * @param[in] ma mean anomaly (binary angle)
+ * @param[out] status pointer to return error code from enum #kes_err_e,
+ * KES_ERR_BADECC for eccentricities outside of the elliptic range
+ * @return solution to Kepler Equation (binary angle), ma for errors
+ */
+kes_bam_t kesolver_fix(
+    const kes_q30_t ecc,
+    const kes_bam_t ma,
+    kes_err_e*      status
+);
+
+
+/*!
+ * @brief fixed-point solver for an array of elements
+ * @details same results as kesolver_fix() for each element
+ * @param[in] n number of elements
+ * @param[in] ecc array of eccentricities in format Q2.30
+ * @param[in] incecc stride of array \a ecc;
+ * use 0 for a single eccentricity common to all elements, 1 for an array
+ * @param[in] ma array of mean anomalies (binary angles)
+ * @param[out] ea array of solutions to Kepler Equation (binary angles)
+ * @return error code from enum #kes_err_e;
+ * KES_ERR_NOERR if all elements were solved, else code of first failure
+ */
+kes_err_e kesolver_fix_batch(
+    const size_t     n,
+    const kes_q30_t* ecc,
+    const size_t     incecc,
+    const kes_bam_t* ma,
+    kes_bam_t*       ea
+);
+
+
+/*!
+ * @brief create a solver plan for a fixed eccentricity
+ * @details checks input parameters, classifies the eccentricity, resolves
+ * starter and solver methods and precomputes eccentricity-dependent
+ * constants once, use kes_plan_solve() or kes_plan_solve_batch() afterwards;
+ * with KES_SOL_AUTO the methods are selected in each solve as in kesolver();
+ * NOTE release a table of the plan with kes_plan_table_free() before
+ * initializing the plan again
+ * @param[out] plan pointer to structure of type #kes_plan_t
+ * @param[in] ecc eccentricity
+ * @param[in] init choose a starter method from enum #kes_stm_e
+ * @param[in] iter choose a solver method from enum #kes_sol_e
+ * @param[in] data pointer to data structure of type #kes_input_t
+ * (or NULL for default settings)
+ * @return error code from enum #kes_err_e, also stored in the plan
+ */
+kes_err_e kes_plan_init(
+    kes_plan_t*        plan,
+    const double       ecc,
+    const kes_stm_e    init,
+    const kes_sol_e    iter,
+    const kes_input_t* data
+);
+
+
+/*!
+ * @brief solve Kepler Equation with a solver plan
+ * @details same result as kesolver() with the parameters of the plan
+ * @param[in] plan pointer to structure of type #kes_plan_t
+ * @param[in] ma mean anomaly (in radians)
+ * @param[out] status pointer to return error code from enum #kes_err_e
+ * @return solution to Kepler Equation
+ */
+double kes_plan_solve(
+    const kes_plan_t* plan,
+    const double      ma,
+    kes_err_e*        status
+);
+
+
+/*!
+ * @brief solve Kepler Equation with a solver plan for an array
+ * @details same results as kesolver_batch() with the parameters of the plan
+ * @param[in] plan pointer to structure of type #kes_plan_t
+ * @param[in] ma array of mean anomalies (in radians)
+ * @param[out] ea array of solutions to Kepler Equation
+ * @param[in] n number of elements
+ * @return error code from enum #kes_err_e;
+ * KES_ERR_NOERR if all elements were solved, else code of first failure
+ */
+kes_err_e kes_plan_solve_batch(
+    const kes_plan_t* plan,
+    const double*     ma,
+    double*           ea,
+    const size_t      n
+);
+
+
+/*!
+ * @brief attach a piecewise Chebyshev table to an elliptic solver plan
+ * @details fits E(M) on 0 <= M <= pi once, afterwards kes_plan_solve(),
+ * kes_plan_solve_batch() and kes_plan_solve_warm() evaluate the table
+ * without iterations and transcendental function calls, using the same
+ * reduction of the mean anomaly as kesolver(); the error of the table is
+ * about \a tol relative to E plus rounding errors of a few ulp; segments are
+ * denser near M = 0 for high eccentricities, the table takes a few kB, see
+ * kes_plan_table_bytes(); the table is allocated by the allocator of
+ * kes_set_allocator(); if memory cannot be allocated, the plan keeps
+ * iterating and kes_plan_table_bytes() returns 0
+ * @param[in,out] plan pointer to structure of type #kes_plan_t
+ * @param[in] tol tolerance of the fit (KES_TABLE_TOL <= tol < 1,
+ * or 0 for default KES_TABLE_TOL = 1E-15)
+ * @return error code from enum #kes_err_e;
+ * KES_ERR_BADECC if the plan is not elliptic, KES_ERR_BADTOL for bad values
+ * of the tolerance, KES_ERR_NOMEM if memory cannot be allocated
+ */
+kes_err_e kes_plan_table_init(
+    kes_plan_t*  plan,
+    const double tol
+);
+
+
+/*!
+ * @brief workspace size of the table of an elliptic solver plan
+ * @details fits the table without storing it, i.e. takes as long as
+ * kes_plan_table_init(); the size depends on the eccentricity and \a tol
+ * only
+ * @param[in] plan pointer to structure of type #kes_plan_t
+ * @param[in] tol tolerance of the fit (as for kes_plan_table_init())
+ * @param[out] status pointer to return error code from enum #kes_err_e
+ * (may be NULL)
+ * @return number of bytes for kes_plan_table_init_ws(), 0 on error
+ */
+size_t kes_plan_table_size(
+    const kes_plan_t* plan,
+    const double      tol,
+    kes_err_e*        status
+);
+
+
+/*!
+ * @brief attach a table in a caller-provided buffer to an elliptic plan
+ * @details same table as kes_plan_table_init(), but no memory is
+ * allocated; the buffer must be aligned for double (64 bytes keeps the
+ * segments in as few cache lines as possible) and must stay valid while
+ * the plan uses the table; kes_plan_table_free() detaches the table
+ * without releasing the buffer; several tables may share one buffer
+ * one after the other, see kes_arena_alloc()
+ * @param[in,out] plan pointer to structure of type #kes_plan_t
+ * @param[in] tol tolerance of the fit (as for kes_plan_table_init())
+ * @param[out] buf buffer for the table
+ * @param[in] size number of bytes of \a buf, at least
+ * kes_plan_table_size()
+ * @return error code from enum #kes_err_e; as for kes_plan_table_init(),
+ * KES_ERR_NOMEM if the buffer is too small or misaligned
+ */
+kes_err_e kes_plan_table_init_ws(
+    kes_plan_t*  plan,
+    const double tol,
+    void*        buf,
+    const size_t size
+);
+
+
+/*!
+ * @brief memory footprint of the table of a solver plan
+ * @param[in] plan pointer to structure of type #kes_plan_t
+ * @return number of bytes allocated for the table (0 if there is none)
+ */
+size_t kes_plan_table_bytes(const kes_plan_t* plan);
+
+
+/*!
+ * @brief release the table of a solver plan
+ * @details the plan iterates again afterwards
+ * @param[in,out] plan pointer to structure of type #kes_plan_t
+ */
+void kes_plan_table_free(kes_plan_t* plan);
+
+
+/*!
+ * @brief reset state of a warm-start solver
+ * @details the next call of kes_plan_solve_warm() uses the starter method of
+ * the plan instead of the previous solution
+ * @param[out] warm pointer to structure of type #kes_warm_t
+ */
+void kes_warm_init(kes_warm_t* warm);
+
+
+/*!
+ * @brief solve Kepler Equation with a solver plan and warm start
+ * @details for a time sequence of mean anomalies, e.g. M = n*t, the starting
+ * value is extrapolated from the previous solution by
+ * E = E(prev) + (M - M(prev)) / (1 - e*cos(E(prev))), which is valid across
+ * the wrap at multiples of 2*pi; the starter method of the plan is used for
+ * the first call or if the extrapolation step exceeds KES_WARM_MAXSTEP;
+ * for warm starts, KES_FIX_AUTO iterates until the tolerances are reached;
+ * NOTE Markley's and Mikkola's method compute their own starting values
+ * @param[in] plan pointer to structure of type #kes_plan_t
+ * @param[in] ma mean anomaly (in radians)
+ * @param[in,out] warm pointer to state of type #kes_warm_t
+ * @param[out] status pointer to return error code from enum #kes_err_e
+ * @return solution to Kepler Equation
+ */
+double kes_plan_solve_warm(
+    const kes_plan_t* plan,
+    const double      ma,
+    kes_warm_t*       warm,
+    kes_err_e*        status
+);
+
+/*!
+ * @brief solve Kepler Equation with a solver plan for a sorted array
+ * @details for dense grids of mean anomalies in ascending or descending
+ * order, e.g. for plots or sampling, the starting value of each element is
+ * extrapolated by E = E(prev) + (M - M(prev)) / (1 - e*cos(E(prev))) from
+ * the last solution of the previous block of 8 elements, which are
+ * then iterated by the vectorized solver; the starter method of the plan is
+ * used per element if the step exceeds KES_WARM_MAXSTEP or the sequence
+ * crossed M = 0 or M = pi of the reduced range; KES_FIX_AUTO iterates until
+ * the tolerances are reached; the order is checked once, unsorted arrays,
+ * plans with a table and solvers without a vectorized implementation are
+ * solved by kes_plan_solve_batch()
+ * @param[in] plan pointer to structure of type #kes_plan_t
+ * @param[in] ma array of mean anomalies (in radians)
+ * @param[out] ea array of solutions to Kepler Equation
+ * @param[in] n number of elements
+ * @return error code from enum #kes_err_e;
+ * KES_ERR_NOERR if all elements were solved, else code of first failure
+ */
+kes_err_e kes_plan_solve_sweep(
+    const kes_plan_t* plan,
+    const double*     ma,
+    double*           ea,
+    const size_t      n
+);
+
+
+/*!
+ * @brief solve Kepler Equation with a solver plan for a sorted array with a
+ * summary of errors
+ * @details same solutions as kes_plan_solve_sweep(), the outcome is
+ * summarized in \a report as by kesolver_batch_report(), including the
+ * number of elements stopped by "maxiter"
+ * @param[in] plan pointer to structure of type #kes_plan_t
+ * @param[in] ma array of mean anomalies (in radians)
+ * @param[out] ea array of solutions to Kepler Equation
+ * @param[in] n number of elements
+ * @param[out] report pointer to summary of type #kes_report_t (or NULL)
+ * @return error code from enum #kes_err_e;
+ * KES_ERR_NOERR if all elements were solved, else code of first failure
+ */
+kes_err_e kes_plan_solve_sweep_report(
+    const kes_plan_t* plan,
+    const double*     ma,
+    double*           ea,
+    const size_t      n,
+    kes_report_t*     report
+);
+
+
+/*!
+ * @brief set number of threads used by kesolver_batch_mt()
+ * @details the calling thread counts as one of the threads, i.e. the pool
+ * keeps nthreads-1 worker threads alive between calls; the pool is
+ * (re-)started on the next call of kesolver_batch_mt();
+ * nthreads = 0 selects the number of online processors (default)
+ * @param[in] nthreads new number of threads
+ * @return error code from enum #kes_err_e;
+ * KES_ERR_NOERR indicates success, KES_ERR_BADVAL indicates error
+ */
+kes_err_e kes_set_threads(const int nthreads);
+
+
+/*!
+ * @brief get number of threads used by kesolver_batch_mt()
+ * @return number of threads including the calling thread
+ */
+int kes_get_threads(void);
+
+
+/*!
+ * @brief set number of elements per work item of kesolver_batch_mt()
+ * @details threads fetch work items dynamically, smaller chunks balance
+ * the load better for mixed eccentricities at the cost of more
+ * synchronization; chunk = 0 selects the default value KES_STD_CHUNK
+ * @param[in] chunk new number of elements per work item
+ * @return error code from enum #kes_err_e
+ */
+kes_err_e kes_set_chunk(const size_t chunk);
+
+
+/*!
+ * @brief get number of elements per work item of kesolver_batch_mt()
+ * @return number of elements per work item
+ */
+size_t kes_get_chunk(void);
+
+
+/*!
+ * @brief enable or disable NUMA-aware scheduling of the thread pool
+ * @details with NUMA enabled (default) on machines with several memory
+ * nodes, the worker threads of the pool are pinned to the processors of one
+ * node each, in turn, and kesolver_batch_mt() and kes_submit() split
+ * batches into segments of 65536 elements by the home node of their
+ * pages; a worker solves the segments of its own node first and takes work
+ * from other nodes only when these are exhausted; on machines with a single
+ * node, or if the topology is unknown, the setting has no effect;
+ * a running pool is stopped and restarted on next use
+ * @param[in] enable 1 to enable, 0 to disable
+ * @return error code from enum #kes_err_e;
+ * KES_ERR_NOERR indicates success, KES_ERR_BADVAL indicates error
+ */
+kes_err_e kes_set_numa(const int enable);
+
+
+/*!
+ * @brief get number of memory nodes used by the thread pool
+ * @return number of nodes with processors, 1 if NUMA-aware scheduling is
+ * disabled or not available
+ */
+int kes_get_numa_nodes(void);
+
+
+/*!
+ * @brief allocate memory for large batches spread over all memory nodes
+ * @details the memory is page-aligned and zero-initialized, and its pages
+ * are first-touched by threads on the nodes in contiguous slices of equal
+ * size, i.e. with arrays of ecc, ma and ea from this function each node
+ * holds the same range of all arrays and solves it without remote
+ * accesses; on machines with a single node this is a plain allocation
+ * @param[in] size number of bytes
+ * @return pointer to the memory, NULL if out of memory;
+ * release with kes_numa_free()
+ */
+void* kes_numa_alloc(const size_t size);
+
+
+/*!
+ * @brief release memory from kes_numa_alloc()
+ * @param[in] ptr pointer from kes_numa_alloc() (or NULL)
+ */
+void kes_numa_free(void* ptr);
+
+
+/*!
+ * @brief set the memory allocator of the library
+ * @details all later allocations use \a alloc, NULL restores malloc() and
+ * free(); every table, cache, GPU batch, job and thread table keeps the
+ * allocator it was obtained from and is released by it, i.e. the allocator
+ * may be switched at any time, but an arena must outlive all blocks taken
+ * from it; NOTE not thread-safe, call before solving in other threads
+ * @param[in] alloc pointer to allocator (or NULL for the default)
+ * @return error code from enum #kes_err_e;
+ * KES_ERR_NOERR indicates success, KES_ERR_BADVAL a missing alloc callback
+ */
+kes_err_e kes_set_allocator(const kes_alloc_t* alloc);
+
+
+/*!
+ * @brief get the current memory allocator of the library
+ * @param[out] alloc pointer to return the allocator
+ */
+void kes_get_allocator(kes_alloc_t* alloc);
+
+
+/*!
+ * @brief initialize an arena on a caller-provided buffer
+ * @details the arena uses the buffer from its first byte aligned to
+ * KES_ARENA_ALIGN; the buffer must stay valid while blocks are in use
+ * @param[out] arena pointer to arena
+ * @param[in] buf buffer (may be NULL if size = 0)
+ * @param[in] size number of bytes of the buffer
+ * @return error code from enum #kes_err_e;
+ * KES_ERR_NOERR indicates success, KES_ERR_BADVAL indicates error
+ */
+kes_err_e kes_arena_init(
+    kes_arena_t* arena,
+    void*        buf,
+    const size_t size
+);
+
+
+/*!
+ * @brief allocate a block from an arena
+ * @param[in,out] arena pointer to arena from kes_arena_init()
+ * @param[in] size number of bytes
+ * @return pointer aligned to KES_ARENA_ALIGN, NULL if the arena is full
+ */
+void* kes_arena_alloc(
+    kes_arena_t* arena,
+    const size_t size
+);
+
+
+/*!
+ * @brief release all blocks of an arena at once
+ * @param[in,out] arena pointer to arena from kes_arena_init()
+ */
+void kes_arena_reset(kes_arena_t* arena);
+
+
+/*!
+ * @brief number of bytes handed out by an arena
+ * @details includes the padding for alignment, i.e. the buffer size an
+ * arena needs for the same sequence of allocations
+ * @param[in] arena pointer to arena from kes_arena_init()
+ * @return number of bytes used since kes_arena_init() or kes_arena_reset()
+ */
+size_t kes_arena_used(const kes_arena_t* arena);
+
+
+/*!
+ * @brief allocator that takes its memory from an arena
+ * @details for kes_set_allocator(); blocks are released by
+ * kes_arena_reset() only, the arena must outlive all of them
+ * @param[in] arena pointer to arena from kes_arena_init()
+ * @return allocator structure
+ */
+kes_alloc_t kes_arena_allocator(kes_arena_t* arena);
+
+
+/*!
+ * @brief stop all worker threads of the thread pool
+ * @details the pool is restarted on the next call of kesolver_batch_mt()
+ */
+void kes_pool_free(void);
+
+
+/*!
+ * @brief multithreaded batch solver function for Kepler Equation
+ * @details same interface and results as kesolver_batch(); the elements
+ * are split into chunks that are solved in parallel by the thread pool;
+ * concurrent calls from several threads share the pool
+ * @param[in] n number of elements
+ * @param[in] ecc array of eccentricities
+ * @param[in] incecc stride of array ecc (0 or 1)
+ * @param[in] ma array of mean anomalies (in radians)
+ * @param[out] ea array of solutions (in radians)
+ * @param[in] init method for starting value from enum #kes_stm_e
+ * @param[in] iter method for iterative solver from enum #kes_sol_e
+ * @param[in] data pointer to input parameters (or NULL)
+ * @param[out] status optional array of per-element error codes (or NULL)
+ * @param[out] iterations optional array of iteration counts (or NULL)
+ * @return error code of the first failing element, KES_ERR_NOERR otherwise
+ */
+kes_err_e kesolver_batch_mt(
+    const size_t       n,
+    const double*      ecc,
+    const size_t       incecc,
+    const double*      ma,
+    double*            ea,
+    const kes_stm_e    init,
+    const kes_sol_e    iter,
+    const kes_input_t* data,
+    kes_err_e*         status,
+    int*               iterations
+);
+
+/*!
+ * @brief submit a batch to the thread pool without waiting for it
+ * @details the elements are solved by the worker threads in the order of
+ * submission, e.g. while the caller reads the next batch; the arrays of
+ * \a batch must stay valid until the job is complete, the structure itself
+ * and the input parameters are copied; the pool is started with at least
+ * one worker thread, also if kes_set_threads() selects a single thread;
+ * every handle must be released by exactly one call of kes_wait()
+ * @param[in] batch arguments of kesolver_batch()
+ * @param[in] callback function called on completion (or NULL)
+ * @param[in] arg argument passed to \a callback
+ * @return handle of the job, NULL if out of memory
+ */
+kes_job_t* kes_submit(
+    const kes_batch_t* batch,
+    kes_callback_t     callback,
+    void*              arg
+);
+
+
+/*!
+ * @brief workspace size of a batch for kes_submit_ws()
+ * @details depends on the number of elements of \a batch only; large
+ * batches need room for their segments on NUMA machines, see
+ * kes_set_numa()
+ * @param[in] batch arguments of kesolver_batch()
+ * @return number of bytes
+ */
+size_t kes_submit_size(const kes_batch_t* batch);
+
+
+/*!
+ * @brief submit a batch to the thread pool with a caller-provided workspace
+ * @details same as kes_submit(), but the job and its segments live in
+ * \a buf instead of allocated memory, i.e. submitting needs no heap; the
+ * buffer must be aligned for double and stay valid until kes_wait()
+ * returns, it may be reused for the next batch afterwards
+ * @param[in] batch arguments of kesolver_batch()
+ * @param[in] callback function called on completion (or NULL)
+ * @param[in] arg argument passed to \a callback
+ * @param[out] buf workspace for the job
+ * @param[in] size number of bytes of \a buf, at least kes_submit_size()
+ * @return handle of the job, NULL if \a buf is too small or misaligned
+ */
+kes_job_t* kes_submit_ws(
+    const kes_batch_t* batch,
+    kes_callback_t     callback,
+    void*              arg,
+    void*              buf,
+    const size_t       size
+);
+
+
+/*!
+ * @brief test whether a submitted batch is complete, without blocking
+ * @param[in] job handle from kes_submit()
+ * @return 1 if all elements are solved and the callback returned, 0 otherwise
+ */
+int kes_poll(kes_job_t* job);
+
+
+/*!
+ * @brief wait for a submitted batch and release its handle
+ * @param[in] job handle from kes_submit(), invalid afterwards
+ * @return error code of the first failing element, KES_ERR_NOERR otherwise
+ */
+kes_err_e kes_wait(kes_job_t* job);
+
+
+
+/*!
+ * @brief check for an OpenCL device with double precision
+ * @details the OpenCL library is loaded at runtime on the first call, i.e.
+ * libkes neither needs OpenCL headers at compile time nor the library at
+ * link time; GPUs and accelerators are used, CPU devices are not
+ * @return 1 if a device is available, 0 otherwise
+ */
+int kes_gpu_available(void);
+
+
+/*!
+ * @brief create a batch of n elements
+ * @details device buffers are allocated if a device is available, else
+ * (or if the allocation fails) the batch is solved by the host
+ * @param[in] n number of elements
+ * @param[out] status error code from enum #kes_err_e (or NULL)
+ * @return pointer to new batch, NULL on failure
+ */
+kes_gpu_t* kes_gpu_new(
+    const size_t n,
+    kes_err_e*   status
+);
+
+
+/*!
+ * @brief free a batch created by kes_gpu_new()
+ * @param[in] gpu pointer to batch (or NULL)
+ */
+void kes_gpu_free(kes_gpu_t* gpu);
+
+
+/*!
+ * @brief copy inputs to a batch
+ * @details either array may be NULL to keep the resident values, e.g. new
+ * mean anomalies for the same orbits
+ * @param[in,out] gpu pointer to batch
+ * @param[in] ecc array of eccentricities (or NULL)
+ * @param[in] incecc stride of array \a ecc (0 or 1)
+ * @param[in] ma array of mean anomalies (in radians, or NULL)
+ * @return error code from enum #kes_err_e
+ */
+kes_err_e kes_gpu_upload(
+    kes_gpu_t*    gpu,
+    const double* ecc,
+    const size_t  incecc,
+    const double* ma
+);
+
+
+/*!
+ * @brief solve the resident elements of a batch
+ * @details the device solves elliptic elements by the methods of
+ * Newton-Raphson, Halley, Danby-Burkardt, Markley and Mikkola with the
+ * starters S0 to S4, S6, S7, S12 and S14, other methods and the whole
+ * batch without a device are solved by kesolver_batch_mt(); the call
+ * returns once the work is queued, results are fetched by
+ * kes_gpu_download(); KES_FIX_AUTO iterates until convergence on the
+ * device
+ * @param[in,out] gpu pointer to batch
+ * @param[in] init starter method from enum #kes_stm_e
+ * @param[in] iter solver method from enum #kes_sol_e
+ * @param[in] data pointer to input parameters (or NULL)
+ * @return error code from enum #kes_err_e, KES_ERR_BADSTM or KES_ERR_BADSOL
+ * for invalid methods
+ */
+kes_err_e kes_gpu_solve(
+    kes_gpu_t*         gpu,
+    const kes_stm_e    init,
+    const kes_sol_e    iter,
+    const kes_input_t* data
+);
+
+
+/*!
+ * @brief copy solutions of a batch to the host
+ * @details elements the device does not handle (circular, parabolic,
+ * hyperbolic, near-parabolic and invalid inputs) are solved here by
+ * kesolver_batch(), i.e. with the same results as on the host
+ * @param[in,out] gpu pointer to batch
+ * @param[out] ea array of solutions (in radians)
+ * @param[out] status optional array of per-element error codes (or NULL)
+ * @param[out] iterations optional array of iteration counts (or NULL)
+ * @return error code of the first failing element, KES_ERR_NOERR otherwise
+ */
+kes_err_e kes_gpu_download(
+    kes_gpu_t* gpu,
+    double*    ea,
+    kes_err_e* status,
+    int*       iterations
+);
+
+
+/*!
+ * @brief batch solver function with OpenCL offload
+ * @details same interface as kesolver_batch_mt(), i.e. upload, solve and
+ * download of a temporary batch, or kesolver_batch_mt() without a device
+ * @param[in] n number of elements
+ * @param[in] ecc array of eccentricities
+ * @param[in] incecc stride of array ecc (0 or 1)
+ * @param[in] ma array of mean anomalies (in radians)
+ * @param[out] ea array of solutions (in radians)
+ * @param[in] init method for starting value from enum #kes_stm_e
+ * @param[in] iter method for iterative solver from enum #kes_sol_e
+ * @param[in] data pointer to input parameters (or NULL)
+ * @param[out] status optional array of per-element error codes (or NULL)
+ * @param[out] iterations optional array of iteration counts (or NULL)
+ * @return error code of the first failing element, KES_ERR_NOERR otherwise
+ */
+kes_err_e kesolver_batch_gpu(
+    const size_t       n,
+    const double*      ecc,
+    const size_t       incecc,
+    const double*      ma,
+    double*            ea,
+    const kes_stm_e    init,
+    const kes_sol_e    iter,
+    const kes_input_t* data,
+    kes_err_e*         status,
+    int*               iterations
+);
+
+
+/*!
+ * @brief register a callback for tracing iteration processes
+ * @details each call of a solver method is traced with probability
+ * \a fraction, decided once per call by a per-thread random generator;
+ * records of a traced call are passed to \a fn at every iteration;
+ * fn = NULL or fraction = 0 disables tracing (default), which costs a
+ * single load per solver call; vectorized batch solves are not traced and
+ * iterations with a fixed count (see kes_set_fixiter()) report the starter
+ * only;
+ * NOTE do not change the callback while other threads are solving
+ * @param[in] fn callback function (or NULL)
+ * @param[in] user pointer passed to the callback
+ * @param[in] fraction fraction of traced solver calls (0 <= fraction <= 1)
+ * @return error code from enum #kes_err_e;
+ * KES_ERR_NOERR indicates success, KES_ERR_BADVAL indicates error
+ */
+kes_err_e kes_set_trace(
+    kes_trace_fn* fn,
+    void*         user,
+    const double  fraction
+);
+
+
+/*!
+ * @brief trace callback printing records to a stream
+ * @param[in] rec pointer to trace record
+ * @param[in] user stream of type FILE* (or NULL for stdout)
+ */
+void kes_trace_print(
+    const kes_trace_t* rec,
+    void*              user
+);
+
+
+/*!
+ * @brief enable or disable the statistics collector
+ * @details if enabled, every successful solve of kesolver(),
+ * kesolver_batch() and the plan functions is recorded by the calling
+ * thread in a private table (allocated on first use, about 400 kB);
+ * recording costs about one evaluation of the Kepler Equation per
+ * element of vectorized batch solves, a disabled collector (default)
+ * costs a single load per call; collected data is kept when disabled
+ * @param[in] enable 1 = enable, 0 = disable
+ * @return error code from enum #kes_err_e;
+ * KES_ERR_NOERR indicates success, KES_ERR_BADVAL indicates error
+ */
+kes_err_e kes_set_stats(const int enable);
+
+
+/*!
+ * @brief clear all collected statistics
+ * NOTE counts of solves running concurrently may survive the reset
+ */
+void kes_stats_reset(void);
+
+
+/*!
+ * @brief get statistics merged over all threads
+ * @details includes the data of threads which have terminated
+ * @param[in] init starter method from enum #kes_stm_e
+ * @param[in] iter solver method from enum #kes_sol_e
+ * @param[in] band eccentricity band from enum #kes_band_e
+ * @param[out] stats pointer to structure of type #kes_stats_t
+ * @return error code from enum #kes_err_e;
+ * KES_ERR_NOERR indicates success, KES_ERR_BADSTM, KES_ERR_BADSOL or
+ * KES_ERR_BADVAL (band) indicates error
+ */
+kes_err_e kes_get_stats(
+    const kes_stm_e  init,
+    const kes_sol_e  iter,
+    const kes_band_e band,
+    kes_stats_t*     stats
+);
+
+
+/*!
+ * @brief eccentricity band of an orbit
+ * @param[in] ecc eccentricity (ecc >= 0)
+ * @return eccentricity band from enum #kes_band_e
+ */
+kes_band_e kes_stats_band(const double ecc);
+
+
+/*!
+ * @brief enable or disable the profiler
+ * @details if enabled, every successful call of kesolver() is split into
+ * the stages starter, iterations and wrapper by reading a clock counter
+ * five times, the ticks are aggregated per pair of starter and solver
+ * method in a private table of the calling thread (about 12 kB); batch
+ * and plan solvers are not profiled; a disabled profiler (default) costs
+ * a single load per call; collected data is kept when disabled
+ * @param[in] enable 1 = enable, 0 = disable
+ * @return error code from enum #kes_err_e;
+ * KES_ERR_NOERR indicates success, KES_ERR_BADVAL indicates error or a
+ * library built without profiling support (KES_PROFILE = 0)
+ */
+kes_err_e kes_set_profile(const int enable);
+
+
+/*!
+ * @brief clear all collected profiles
+ * NOTE ticks of calls running concurrently may survive the reset
+ */
+void kes_profile_reset(void);
+
+
+/*!
+ * @brief get profile merged over all threads
+ * @details includes the data of threads which have terminated
+ * @param[in] init starter method from enum #kes_stm_e
+ * @param[in] iter solver method from enum #kes_sol_e
+ * @param[out] prof pointer to structure of type #kes_profile_t
+ * @return error code from enum #kes_err_e;
+ * KES_ERR_NOERR indicates success, KES_ERR_BADSTM or KES_ERR_BADSOL
+ * indicates error
+ */
+kes_err_e kes_profile_get(
+    const kes_stm_e init,
+    const kes_sol_e iter,
+    kes_profile_t*  prof
+);
+
+
+/*!
+ * @brief enable, resize or disable the cache of solutions
+ * @details if enabled, kesolver() and kes_plan_solve() look up every
+ * request by the exact bit patterns of eccentricity, mean anomaly and
+ * tolerances, the methods and the remaining input parameters, and store
+ * every successful solution; a hit returns the stored solution, number of
+ * iterations and residuals (rounded to float) without evaluations, and is
+ * not recorded by the statistics collector or the profiler; the table has
+ * \a capacity entries (rounded up to a power of 2), a full table replaces
+ * older entries; lookups and stores are thread-safe and lock-free;
+ * a disabled cache (default) costs a single load per call;
+ * NOTE not thread-safe, call before solving in other threads
+ * @param[in] capacity number of entries (0 = disable and release the table)
+ * @return error code from enum #kes_err_e;
+ * KES_ERR_NOERR indicates success, KES_ERR_BADVAL indicates a bad capacity
+ * or a library built without cache support (KES_CACHE = 0), KES_ERR_NOMEM
+ * that the table cannot be allocated
+ */
+kes_err_e kes_set_cache(const size_t capacity);
+
+
+/*!
+ * @brief remove all entries of the cache and clear its counters
+ * NOTE solutions stored concurrently may survive the reset
+ */
+void kes_cache_reset(void);
+
+
+/*!
+ * @brief get the counters of the cache
+ * @param[out] stats pointer to structure of type #kes_cache_stats_t
+ * @return error code from enum #kes_err_e;
+ * KES_ERR_NOERR indicates success, KES_ERR_BADVAL indicates error
+ */
+kes_err_e kes_get_cache_stats(kes_cache_stats_t* stats);
+
+
+/*!
+ * @brief select starter and solver method for KES_SOL_AUTO
+ * @details looks up the region of (ecc, ma) in the dispatch table;
+ * circular, parabolic and invalid eccentricities get the entry of the
+ * lowest region, which solves them as any other pair of methods
+ * @param[in] ecc eccentricity
+ * @param[in] ma mean anomaly (in radians)
+ * @param[out] init pointer to return starter method
+ * @param[out] iter pointer to return solver method
+ */
+void kes_auto_select(
+    const double ecc,
+    const double ma,
+    kes_stm_e*   init,
+    kes_sol_e*   iter
+);
+
+
+/*!
+ * @brief replace the dispatch table of KES_SOL_AUTO
+ * @details the table is copied, e.g. the output of the tuning program
+ * examples/14_autotune for the hardware at hand; NOTE not thread-safe,
+ * call before solving with KES_SOL_AUTO in other threads
+ * @param[in] table pointer to structure of type #kes_auto_table_t
+ * (or NULL to restore the built-in defaults)
+ * @return error code from enum #kes_err_e;
+ * KES_ERR_NOERR indicates success, KES_ERR_BADSTM or KES_ERR_BADSOL
+ * indicates an invalid entry (the active table is not changed)
+ */
+kes_err_e kes_set_auto_table(const kes_auto_table_t* table);
+
+
+/*!
+ * @brief get a copy of the active dispatch table of KES_SOL_AUTO
+ * @param[out] table pointer to structure of type #kes_auto_table_t
+ */
+void kes_get_auto_table(kes_auto_table_t* table);
+
+
+/*!
+ * @brief single-precision solver function for Kepler Equation
+ * @details elliptic orbits with ecc <= KES_NEARPAR_ECC are solved in single
+ * precision with the starter \a init and iterations of the same order as
+ * \a iter, i.e. Newton-Raphson (2), Halley (3), Danby-Burkardt (4, 5),
+ * Markley's and Mikkola's method (5) and Halley's method for all others;
+ * tolerances below KES_STD_TOLF are raised to that value and KES_FIX_AUTO
+ * iterates until convergence; all other orbits are solved by kesolver()
+ * and the result is rounded
+ * @param[in] ecc eccentricity
+ * @param[in] ma mean anomaly (in radians)
+ * @param[in] init choose a starter method from enum #kes_stm_e
+ * @param[in] iter choose a solver method from enum #kes_sol_e
+ * (KES_SOL_AUTO is not supported)
+ * @param[in,out] data pointer to data structure of type #kes_input_t,
+ * returns the number of iterations and the result
+ * @param[out] status pointer to return error code from enum #kes_err_e
+ * @return solution to Kepler Equation
+ */
+float kesolverf(
+    const float     ecc,
+    const float     ma,
+    const kes_stm_e init,
+    const kes_sol_e iter,
+    kes_input_t*    data,
+    kes_err_e*      status
+);
+
+
+/*!
+ * @brief single-precision batch solver function for Kepler Equation
+ * @details same results as kesolverf() for each element; elliptic elements
+ * are collected into blocks of KES_VECF_LEN lanes and solved by vectorized
+ * iterations, all other elements are solved one by one
+ * @param[in] n number of elements
+ * @param[in] ecc array of eccentricities
+ * @param[in] incecc stride of array \a ecc;
+ * use 0 for a single eccentricity common to all elements, 1 for an array
+ * @param[in] ma array of mean anomalies (in radians)
+ * @param[out] ea array of solutions to Kepler Equation
+ * @param[in] init choose a starter method from enum #kes_stm_e
+ * @param[in] iter choose a solver method from enum #kes_sol_e
+ * @param[in] data pointer to data structure of type #kes_input_t
+ * (or NULL for default settings)
+ * @param[out] status optional array of per-element error codes (or NULL)
+ * @param[out] iterations optional array of per-element iterations (or NULL)
+ * @return error code from enum #kes_err_e;
+ * KES_ERR_NOERR if all elements were solved, else code of first failure
+ */
+kes_err_e kesolverf_batch(
+    const size_t       n,
+    const float*       ecc,
+    const size_t       incecc,
+    const float*       ma,
+    float*             ea,
+    const kes_stm_e    init,
+    const kes_sol_e    iter,
+    const kes_input_t* data,
+    kes_err_e*         status,
+    int*               iterations
+);
+
+
+/*!
+ * @brief mixed-precision batch solver function for Kepler Equation
+ * @details elliptic elements with ecc <= KES_NEARPAR_ECC are started and
+ * iterated in single precision in blocks of KES_VECF_LEN lanes as in
+ * kesolverf_batch(), then refined by one double-precision step of
+ * kes_itercore5() for solvers of order 4 and 5, or kes_itercore3()
+ * otherwise; the step is accepted if its order predicts an error below
+ * tolx of \a data (see KES_STOP_ORDER), else the element is solved again
+ * by kesolver(), as are all other elements; the results are accurate to
+ * the double-precision tolerances, at about the throughput of the
+ * single-precision solver; iterations count the single-precision
+ * iterations plus the final step
+ * @param[in] n number of elements
+ * @param[in] ecc array of eccentricities
+ * @param[in] incecc stride of array \a ecc;
+ * use 0 for a single eccentricity common to all elements, 1 for an array
+ * @param[in] ma array of mean anomalies (in radians)
+ * @param[out] ea array of solutions to Kepler Equation
+ * @param[in] init choose a starter method from enum #kes_stm_e
+ * @param[in] iter choose a solver method from enum #kes_sol_e
+ * @param[in] data pointer to data structure of type #kes_input_t
+ * (or NULL for default settings)
+ * @param[out] status optional array of per-element error codes (or NULL)
+ * @param[out] iterations optional array of per-element iterations (or NULL)
+ * @return error code from enum #kes_err_e;
+ * KES_ERR_NOERR if all elements were solved, else code of first failure
+ */
+kes_err_e kesolver_batch_mixed(
+    const size_t       n,
+    const double*      ecc,
+    const size_t       incecc,
+    const double*      ma,
+    double*            ea,
+    const kes_stm_e    init,
+    const kes_sol_e    iter,
+    const kes_input_t* data,
+    kes_err_e*         status,
+    int*               iterations
+);
 
 
 /*!
- * @brief enumeration of starter methods
- * @details reference list of starter methods:
- * Odell & Gooding (1986), Celestial Mechanics, Volume 38, Issue 4, p.307-334
- * [ADS link](http://adsabs.harvard.edu/abs/1986CeMec..38..307O)
+ * @brief create a single-precision solver plan for a fixed eccentricity
+ * @param[out] plan pointer to structure of type #kes_planf_t
+ * @param[in] ecc eccentricity
+ * @param[in] init choose a starter method from enum #kes_stm_e
+ * @param[in] iter choose a solver method from enum #kes_sol_e
+ * @param[in] data pointer to data structure of type #kes_input_t
+ * (or NULL for default settings)
+ * @return error code from enum #kes_err_e, also stored in the plan
  */
-typedef enum
-{
-    KES_STM_NONE = 0, ///< unidentified (void) starting value method
+kes_err_e kes_planf_init(
+    kes_planf_t*       plan,
+    const float        ecc,
+    const kes_stm_e    init,
+    const kes_sol_e    iter,
+    const kes_input_t* data
+);
 
-    /* different starter methods for elliptic case */
-    KES_STM_ES00,     ///< starting value "pi"
-    KES_STM_ES01,     ///< starter S1 from Odell & Gooding (1986)
-    KES_STM_ES02,     ///< starter S2 from Odell & Gooding (1986)
-    KES_STM_ES03,     ///< starter S3 from Odell & Gooding (1986)
-    KES_STM_ES04,     ///< starter S4 from Odell & Gooding (1986)
-    KES_STM_ES05,     ///< starter S5 from Odell & Gooding (1986)
-    KES_STM_ES06,     ///< starter S6 from Odell & Gooding (1986)
-    KES_STM_ES07,     ///< starter S7 from Odell & Gooding (1986)
-    KES_STM_ES08,     ///< starter S8 from Odell & Gooding (1986)
-    KES_STM_ES09,     ///< starter S9 from Odell & Gooding (1986)
-    KES_STM_ES10,     ///< starter S10 from Odell & Gooding (1986)
-    KES_STM_ES11,     ///< starter S11 from Odell & Gooding (1986)
-    KES_STM_ES12,     ///< starter S12 from Odell & Gooding (1986)
-    KES_STM_ES13,     ///< starter from Encke (1850)
-    KES_STM_ES14,     ///< starter from Charles & Tatum (1998)
 
-    KES_STM_TOTAL     ///< total number of available starting value methods
-} kes_stm_e;
+/*!
+ * @brief solve Kepler Equation with a single-precision solver plan
+ * @details same result as kesolverf() with the parameters of the plan
+ * @param[in] plan pointer to structure of type #kes_planf_t
+ * @param[in] ma mean anomaly (in radians)
+ * @param[out] status pointer to return error code from enum #kes_err_e
+ * @return solution to Kepler Equation
+ */
+float kes_planf_solve(
+    const kes_planf_t* plan,
+    const float        ma,
+    kes_err_e*         status
+);
 
 
 /*!
- * @brief enumeration of solver types
- * @details list of all available iteration methods
+ * @brief solve Kepler Equation with a single-precision plan for an array
+ * @details same results as kesolverf_batch() with the parameters of the plan
+ * @param[in] plan pointer to structure of type #kes_planf_t
+ * @param[in] ma array of mean anomalies (in radians)
+ * @param[out] ea array of solutions to Kepler Equation
+ * @param[in] n number of elements
+ * @return error code from enum #kes_err_e;
+ * KES_ERR_NOERR if all elements were solved, else code of first failure
  */
-typedef enum
-{
-    KES_SOL_NONE = 0, ///< unidentified (void) solver method
+kes_err_e kes_planf_solve_batch(
+    const kes_planf_t* plan,
+    const float*       ma,
+    float*             ea,
+    const size_t       n
+);
 
-    /* different solver methods */
-    KES_SOL_BISECT,   ///< Bisection method
-    KES_SOL_DANBUR4,  ///< Danby-Burkardt method (order 4)
-    KES_SOL_DANBUR5,  ///< Danby-Burkardt method (order 5)
-    KES_SOL_FIXEDP,   ///< Fixed-point method
-    KES_SOL_HALLEY,   ///< Halley method
-    KES_SOL_LAGCON,   ///< Laguerre-Conway method
-    KES_SOL_MARKLEY,  ///< Markley method
-    KES_SOL_MIKKOLA,  ///< Mikkola method
-    KES_SOL_NEWRAP,   ///< Newton-Raphson method
-    KES_SOL_NIJENH,   ///< Nijenhuis method
-    KES_SOL_SECANT,   ///< Secant method
-    KES_SOL_WEGSEC,   ///< Wegstein's secant modification
 
-    KES_SOL_TOTAL     ///< total number of available solver methods
-} kes_sol_e;
+/*!
+ * @brief convert orbital elements and mean anomalies to state vectors
+ * @details solves Kepler's Equation with kesolver_batch() for blocks of
+ * elements, then computes position and velocity in the same pass from
+ * sin(E) and cos(E) (sinh(H), cosh(H) for hyperbolic, true anomaly for
+ * parabolic orbits) without the true anomaly; the rotation matrix of a
+ * common orbit (incel = 0) is computed only once per call;
+ * units of length and time follow from \a mu, parabolic orbits need the
+ * semi-latus rectum p = a * (1 - ecc^2) > 0 to be finite
+ * @param[in] n number of elements
+ * @param[in] mu gravitational parameter G * (m1 + m2) (mu > 0)
+ * @param[in] elem pointer to orbital elements of type #kes_elements_t
+ * @param[in] ma array of mean anomalies (in radians)
+ * @param[out] state pointer to arrays of state vectors of type #kes_state_t
+ * @param[in] init choose a starter method from enum #kes_stm_e
+ * @param[in] iter choose a solver method from enum #kes_sol_e
+ * @param[in] data pointer to data structure of type #kes_input_t
+ * (or NULL for default settings)
+ * @param[out] status optional array of per-element error codes (or NULL);
+ * elements with invalid input return KES_ERR_BADVAL and zero state vectors
+ * @return error code from enum #kes_err_e;
+ * KES_ERR_NOERR if all elements were converted, else code of first failure
+ */
+kes_err_e kes_elements_to_state(
+    const size_t          n,
+    const double          mu,
+    const kes_elements_t* elem,
+    const double*         ma,
+    kes_state_t*          state,
+    const kes_stm_e       init,
+    const kes_sol_e       iter,
+    const kes_input_t*    data,
+    kes_err_e*            status
+);
 
 
 /*!
- * @brief structure containing iteration data
- * @details use this structure as interface to function kesolver()
+ * @brief create a propagator for uniform steps of the mean anomaly
+ * @details solves step 0 by kesolver() with \a init and \a iter, which also
+ * solve steps whose predicted increment of E exceeds KES_WARM_MAXSTEP, or
+ * whose Halley corrections do not converge within KES_PROP_MAXCORR steps;
+ * elliptic and circular orbits only
+ * @param[out] prop pointer to structure of type #kes_propagator_t
+ * @param[in] ecc eccentricity (0 <= ecc < 1)
+ * @param[in] ma0 mean anomaly of step 0 (in radians)
+ * @param[in] dma increment of the mean anomaly per step (in radians)
+ * @param[in] init choose a starter method from enum #kes_stm_e
+ * @param[in] iter choose a solver method from enum #kes_sol_e
+ * @param[in] data pointer to data structure of type #kes_input_t
+ * (or NULL for default settings)
+ * @return error code from enum #kes_err_e, also stored in the propagator;
+ * KES_ERR_BADECC for parabolic and hyperbolic orbits
  */
-typedef struct
-{
-    /* user can get/set these parameters */
-    double tolf;       ///< iteration tolerance for f(x(n))
-    double tolx;       ///< iteration tolerance for x(n)
-    int    maxiter;    ///< maximum number of iterations
+kes_err_e kes_propagator_init(
+    kes_propagator_t*  prop,
+    const double       ecc,
+    const double       ma0,
+    const double       dma,
+    const kes_stm_e    init,
+    const kes_sol_e    iter,
+    const kes_input_t* data
+);
 
-    /* output from iteration function */
-    double result;     ///< returns solution of Kepler Equation
-    double starter;    ///< starting value for first iteration
-    double errDF;      ///< residual error for |f(x(n+1))|
-    double errDX;      ///< residual error for |x(n+1)-x(n)|
-    int    iterations; ///< number of iterations performed until convergence
 
-    /* additional counters for trigonometric function evaluations
-     * NOTE only for internal use
-     */
-    int    nbrSinEval; ///< number of evaluations of sin()
-    int    nbrCosEval; ///< number of evaluations of cos()
-    int    nbrFktEval; ///< number of evaluations of kes_keq_xxx()
-} kes_input_t;
+/*!
+ * @brief emit the next steps of a propagator
+ * @details the first call starts with step 0, every call continues where
+ * the previous one stopped; each step takes the sin/cos of a predicted
+ * increment of E (no libm call) and usually one Halley correction with
+ * small-angle rotations; the reduced mean anomaly advances by additions of
+ * the reduced increment, it is recomputed from M0 together with sin(E) and
+ * cos(E) every KES_PROP_RENORM steps; E is in [0:2*pi) as returned by
+ * kesolver()
+ * @param[in,out] prop pointer to structure of type #kes_propagator_t
+ * @param[in] n number of steps
+ * @param[out] ea array of eccentric anomalies (in radians)
+ * @param[out] sinea optional array of sin(E) (or NULL)
+ * @param[out] cosea optional array of cos(E) (or NULL)
+ * @param[out] nu optional array of true anomalies in (-pi:pi] (or NULL)
+ * @return error code from enum #kes_err_e;
+ * error code of kes_propagator_init() if that failed, outputs are 0 then
+ */
+kes_err_e kes_propagator_run(
+    kes_propagator_t* prop,
+    const size_t      n,
+    double*           ea,
+    double*           sinea,
+    double*           cosea,
+    double*           nu
+);
 
-/******************************************************************************/
 
-/*** function declarations ***/
+/*!
+ * @brief solve Kepler Equation for many orbits on a common time grid
+ * @details computes the matrix of eccentric anomalies E(k,j) of orbit k at
+ * epoch t(j) from the mean anomalies M = ma0(k) + nmot(k) * t(j); the work
+ * is split into tiles of KES_EPHEM_ORBITS orbits by KES_EPHEM_EPOCHS epochs:
+ * every orbit gets a solver plan per work item of KES_EPHEM_SPAN epochs,
+ * i.e. the eccentricity-dependent constants are computed once, and each row
+ * of a tile is solved by kes_plan_solve_sweep(), which starts from the
+ * previous solutions along sorted time grids; the work items are solved in
+ * parallel by the thread pool, see kes_set_threads(); results agree with
+ * kesolver() to the tolerances of \a data
+ * @param[in] norb number of orbits K
+ * @param[in] ecc array of K eccentricities
+ * @param[in] ma0 array of K mean anomalies at t = 0 (in radians)
+ * @param[in] nmot array of K mean motions (in radians per unit of time)
+ * @param[in] ntime number of epochs T
+ * @param[in] t array of T epochs, preferably sorted
+ * @param[out] ea matrix of solutions in row-major order, E(k,j) at
+ * ea[k * ldea + j] (in radians)
+ * @param[in] ldea leading dimension of \a ea (ldea >= ntime)
+ * @param[in] init method for starting value from enum #kes_stm_e
+ * @param[in] iter method for iterative solver from enum #kes_sol_e
+ * @param[in] data pointer to input parameters (or NULL)
+ * @param[out] status optional matrix of per-element error codes with the
+ * layout of \a ea (or NULL)
+ * @return error code from enum #kes_err_e;
+ * KES_ERR_NOERR if all elements were solved, else code of the first failing
+ * tile, KES_ERR_BADVAL for missing arrays or ldea < ntime
+ */
+kes_err_e kes_ephem_run(
+    const size_t       norb,
+    const double*      ecc,
+    const double*      ma0,
+    const double*      nmot,
+    const size_t       ntime,
+    const double*      t,
+    double*            ea,
+    const size_t       ldea,
+    const kes_stm_e    init,
+    const kes_sol_e    iter,
+    const kes_input_t* data,
+    kes_err_e*         status
+);
 
-#ifdef __cplusplus
-extern "C" {
-#endif
 
 /*!
- * @brief main solver function for Kepler Equation
- * @details user can specify additional parameters via structure \a data
+ * @brief solver function for Kepler Equation with extended result
+ * @details same solution as kesolver(), plus sine, cosine, radius and
+ * optionally the true anomaly of the solution with one evaluation of
+ * sin/cos (sinh/cosh) and one of atan2() for the true anomaly, instead of
+ * tan(), atan() and sqrt() in kes_trueanom()
  * @param[in] ecc eccentricity
  * @param[in] ma mean anomaly (in radians)
  * @param[in] init choose a starter method from enum #kes_stm_e
  * @param[in] iter choose a solver method from enum #kes_sol_e
  * @param[in,out] data pointer to data structure of type #kes_input_t
- * @param[out] status pointer to return error code from enum #kes_err_e
- * @return solution to Kepler Equation
+ * @param[in] trueanom compute the true anomaly (1) or not (0)
+ * @param[out] sol pointer to extended result of type #kes_solution_t
+ * @return error code from enum #kes_err_e, same as status of kesolver()
  */
-double kesolver(
+kes_err_e kesolver_ext(
     const double    ecc,
     const double    ma,
     const kes_stm_e init,
     const kes_sol_e iter,
     kes_input_t*    data,
-    kes_err_e*      status
+    const int       trueanom,
+    kes_solution_t* sol
+);
+
+
+/*!
+ * @brief batch solver function for Kepler Equation with extended results
+ * @details same solutions as kesolver_batch(), plus the quantities of
+ * kesolver_ext(); elliptic elements are processed by vectorized loops
+ * @param[in] n number of elements
+ * @param[in] ecc array of eccentricities
+ * @param[in] incecc stride of array \a ecc;
+ * use 0 for a single eccentricity common to all elements, 1 for an array
+ * @param[in] ma array of mean anomalies (in radians)
+ * @param[out] sol array of extended results of type #kes_solution_t
+ * @param[in] init choose a starter method from enum #kes_stm_e
+ * @param[in] iter choose a solver method from enum #kes_sol_e
+ * @param[in] data pointer to data structure of type #kes_input_t
+ * (or NULL for default settings)
+ * @param[in] trueanom compute the true anomaly (1) or not (0)
+ * @param[out] status optional array of per-element error codes (or NULL)
+ * @return error code from enum #kes_err_e;
+ * KES_ERR_NOERR if all elements were solved, else code of first failure
+ */
+kes_err_e kesolver_batch_ext(
+    const size_t       n,
+    const double*      ecc,
+    const size_t       incecc,
+    const double*      ma,
+    kes_solution_t*    sol,
+    const kes_stm_e    init,
+    const kes_sol_e    iter,
+    const kes_input_t* data,
+    const int          trueanom,
+    kes_err_e*         status
 );
 
 
@@ -242,7 +2428,8 @@ double kes_keq_par(
 /*!
  * @brief calculate the true anomaly for the elliptic or hyperbolic case
  * @param[in] ecc eccentricity
- * @param[in] x elliptic or hyperbolic eccentric anomaly (in radians)
+ * @param[in] x elliptic or hyperbolic eccentric anomaly (in radians); in the
+ *              parabolic case the true anomaly, which is returned unchanged
  * @return true anomaly (in radians)
  */
 double kes_trueanom(
@@ -251,6 +2438,45 @@ double kes_trueanom(
 );
 
 
+/*!
+ * @brief reduce arrays of mean anomalies to range [-pi:pi]
+ * @details same results as kes_reduce() for each element, vectorized
+ * @param[in] n number of elements
+ * @param[in] ma array of n mean anomalies (in radians)
+ * @param[out] redma array of n reduced mean anomalies, may be \a ma
+ * @return error code from enum #kes_err_e, KES_ERR_BADVAL if any mean
+ * anomaly is NAN or INF (returned unchanged)
+ */
+kes_err_e kes_reduce_batch(
+    const size_t  n,
+    const double* ma,
+    double*       redma
+);
+
+
+/*!
+ * @brief reduce arrays of mean anomalies M = n*t to range [-pi:pi]
+ * @details same results as kes_reduce_nt() for each element, vectorized;
+ * the products n*t are exact by Dekker's method, i.e. without fused
+ * multiply-add; use with the batch solvers for long propagations
+ * @param[in] n number of elements
+ * @param[in] mm array of mean motions (in radians per unit of time)
+ * @param[in] incmm stride of mm: 1 for one mean motion per element, 0 for
+ * a common mean motion mm[0]
+ * @param[in] t array of n times since perihelion passage
+ * @param[out] redma array of n reduced mean anomalies, may be \a t
+ * @return error code from enum #kes_err_e, KES_ERR_BADVAL if any product
+ * n*t is NAN or INF (returned unchanged)
+ */
+kes_err_e kes_reduce_nt_batch(
+    const size_t  n,
+    const double* mm,
+    const size_t  incmm,
+    const double* t,
+    double*       redma
+);
+
+
 /*!
  * @brief starting value for iteration methods
  * @param[in] ecc eccentricity
@@ -267,6 +2493,114 @@ double kes_starter(
 );
 
 
+/*!
+ * @brief starting values for arrays of eccentricities and mean anomalies
+ * @details evaluates the same formulas as kes_starter() for all elements,
+ * KES_STM_ES00 to KES_STM_ES14 with vectorized math functions (their
+ * results agree with kes_starter() to a few ulp), KES_STM_ES15 element by
+ * element; starters are meant for reduced mean anomalies 0 <= ma <= pi and
+ * serve as cheap approximations of the solution, too
+ * @param[in] n number of elements
+ * @param[in] ecc array of eccentricities
+ * @param[in] incecc stride of ecc: 1 for one eccentricity per element, 0 for
+ * a common eccentricity ecc[0]
+ * @param[in] ma array of n mean anomalies (in radians)
+ * @param[out] x array of n starting values, must not overlap ecc or ma
+ * @param[in] type choose a starter method from enum #kes_stm_e
+ * @return error code from enum #kes_err_e, KES_ERR_BADSTM for an invalid
+ * method (all x are set to 0)
+ */
+kes_err_e kes_starter_batch(
+    const size_t    n,
+    const double*   ecc,
+    const size_t    incecc,
+    const double*   ma,
+    double*         x,
+    const kes_stm_e type
+);
+
+
+/*!
+ * @brief starting value for the hyperbolic Kepler Equation e*sinh(H) - H = M
+ * @details KES_HSTM_BOUND is the smaller of the cubic upper bound and one
+ * fixed-point step H = asinh((M + H) / e) from there, an upper bound within
+ * 2% of H for all e and M (default); KES_HSTM_CUBIC is the root of
+ * (e-1)*H + e*H^3/6 = M, an upper bound within 0.4% for H < 0.5, but it
+ * grows like M^(1/3) instead of ln(M) for large M; KES_HSTM_ASINH takes two
+ * fixed-point steps from H = 0, a lower bound with a relative error of at
+ * most 1/e^2 and below 0.1% for M/e > 10; KES_HSTM_LOG is ln(2*M/e + 1.8)
+ * from Danby (1987), within 2.5% for M/e > 10, but not for small M;
+ * NOTE outside of these ranges (H >= 0.5 for KES_HSTM_CUBIC, M/e <= 10 for
+ * KES_HSTM_ASINH and KES_HSTM_LOG) the methods fall back to KES_HSTM_BOUND,
+ * such that all of them converge in a few iterations for all e and M
+ * @param[in] ecc eccentricity (ecc > 1)
+ * @param[in] ma mean anomaly (in radians), H0(-M) = -H0(M)
+ * @param[in] type choose a starter method from enum #kes_hstm_e
+ * @param[out] status pointer to return error code from enum #kes_err_e,
+ * KES_ERR_BADSTM for an invalid method, KES_ERR_BADECC for ecc <= 1
+ * @return starting value H0
+ */
+double kes_starter_hyp(
+    const double     ecc,
+    const double     ma,
+    const kes_hstm_e type,
+    kes_err_e*       status
+);
+
+
+/*!
+ * @brief hyperbolic starting values for arrays of elements
+ * @details evaluates the same formulas as kes_starter_hyp() for all
+ * elements with vectorized math functions (identical results), i.e. with a
+ * sinh/cosh kernel of the same cost, the batch solvers use them, too
+ * @param[in] n number of elements
+ * @param[in] ecc array of eccentricities
+ * @param[in] incecc stride of ecc: 1 for one eccentricity per element, 0 for
+ * a common eccentricity ecc[0]
+ * @param[in] ma array of n mean anomalies (in radians)
+ * @param[out] x array of n starting values, must not overlap ecc or ma
+ * @param[in] type choose a starter method from enum #kes_hstm_e
+ * @return error code from enum #kes_err_e, KES_ERR_BADSTM for an invalid
+ * method (all x are set to 0), KES_ERR_BADECC if any ecc <= 1 (their x are
+ * set to 0)
+ */
+kes_err_e kes_starter_hyp_batch(
+    const size_t     n,
+    const double*    ecc,
+    const size_t     incecc,
+    const double*    ma,
+    double*          x,
+    const kes_hstm_e type
+);
+
+
+/*!
+ * @brief build the lookup table of starter method KES_STM_ES15
+ * @details the table is built automatically on first use of KES_STM_ES15;
+ * call this function in advance to avoid the delay in the first call,
+ * the table is shared read-only between threads
+ */
+void kes_starter_table_init(void);
+
+
+/*!
+ * @brief single-precision starting value for iteration methods
+ * @details same methods as kes_starter(), KES_STM_ES15 evaluates the
+ * lookup table in double precision
+ * @param[in] ecc eccentricity
+ * @param[in] ma mean anomaly (in radians)
+ * @param[in] type choose a starter method from enum #kes_stm_e
+ * @param[out] status pointer to return error code from enum #kes_err_e
+ * @return starting value x0
+ */
+float kes_starterf(
+    const float     ecc,
+    const float     ma,
+    const kes_stm_e type,
+    kes_err_e*      status
+);
+
+
 /*!
  * @brief print information about a solver method
  * @param[in] type a method from enum #kes_sol_e
@@ -299,6 +2633,54 @@ double kes_get_tolx(const kes_input_t* const in);
 int kes_get_maxiter(const kes_input_t* const in);
 
 
+/*!
+ * @brief get current value of parameter "fixiter"
+ * @param[in] in pointer to structure of type #kes_input_t
+ * @return value of fixiter
+ */
+int kes_get_fixiter(const kes_input_t* const in);
+
+
+/*!
+ * @brief get current value of parameter "trig"
+ * @param[in] in pointer to structure of type #kes_input_t
+ * @return value of trig
+ */
+kes_trig_e kes_get_trig(const kes_input_t* const in);
+
+
+/*!
+ * @brief get current value of parameter "conv"
+ * @param[in] in pointer to structure of type #kes_input_t
+ * @return value of conv
+ */
+kes_conv_e kes_get_conv(const kes_input_t* const in);
+
+
+/*!
+ * @brief get current value of parameter "stop"
+ * @param[in] in pointer to structure of type #kes_input_t
+ * @return value of stop
+ */
+kes_stop_e kes_get_stop(const kes_input_t* const in);
+
+
+/*!
+ * @brief get current value of parameter "deriv"
+ * @param[in] in pointer to structure of type #kes_input_t
+ * @return value of deriv
+ */
+kes_deriv_e kes_get_deriv(const kes_input_t* const in);
+
+
+/*!
+ * @brief get current value of parameter "hinit"
+ * @param[in] in pointer to structure of type #kes_input_t
+ * @return value of hinit
+ */
+kes_hstm_e kes_get_hstarter(const kes_input_t* const in);
+
+
 /*!
  * @brief set new value for parameter "tolf"
  * @details default value for tolf is 1E-15
@@ -341,6 +2723,128 @@ kes_err_e kes_set_maxiter(
 );
 
 
+/*!
+ * @brief set new value for parameter "fixiter"
+ * @details default value for fixiter is 0, i.e. iterations stop as soon as
+ * the tolerances "tolf" or "tolx" are reached; for fixiter > 0 the
+ * Newton-Raphson, Halley and Danby-Burkardt solvers perform exactly fixiter
+ * iterations without evaluating the residual of the Kepler Equation, and
+ * the single correction step of Markley's and Mikkola's method skips it;
+ * KES_FIX_AUTO selects a tabulated number of iterations for the pair of
+ * starter and solver methods which reaches KES_STD_TOL for all elliptic
+ * orbits (pairs without such a bound use "maxiter"), and for all hyperbolic
+ * orbits with 1 < ecc <= 1E4;
+ * other solvers ignore fixiter
+ * @param[in] in pointer to structure of type #kes_input_t
+ * @param[in] fixiter new fixed number of iterations, 0 or KES_FIX_AUTO
+ * @return error code from enum #kes_err_e;
+ * KES_ERR_NOERR indicates success, KES_ERR_BADVAL indicates error
+ */
+kes_err_e kes_set_fixiter(
+    kes_input_t* in,
+    const int    fixiter
+);
+
+
+/*!
+ * @brief set new value for parameter "trig"
+ * @details default value for trig is KES_TRIG_FULL; with KES_TRIG_FAST the
+ * Newton-Raphson, Halley and Danby-Burkardt solvers use a faster sin/cos
+ * kernel (absolute error about 1E-12) as long as the next iteration is not
+ * expected to reach this error, the final iterations and the residuals of
+ * the stopping criteria always use full accuracy;
+ * fixed iterations (see kes_set_fixiter()) use the fast kernel for all but
+ * the last iteration; other solvers ignore trig
+ * @param[in] in pointer to structure of type #kes_input_t
+ * @param[in] trig accuracy tier from enum #kes_trig_e
+ * @return error code from enum #kes_err_e
+ */
+kes_err_e kes_set_trig(
+    kes_input_t*     in,
+    const kes_trig_e trig
+);
+
+
+/*!
+ * @brief set new value for parameter "conv"
+ * @details default value for conv is KES_CONV_FULL, i.e. the
+ * Newton-Raphson, Halley and Danby-Burkardt solvers evaluate the residual
+ * of each new iterate, which costs one more sin per iteration;
+ * with KES_CONV_LEAN they take the residual of the previous iterate from
+ * the next iteration step instead, i.e. one sin/cos pair per iteration:
+ * the iterations stop on |x(n+1) - x(n)| <= tolx as before, or one step
+ * after the residual reached tolf, so the solution is at least as accurate
+ * at the cost of about one more (but cheaper) iteration, and "errDF"
+ * refers to the previous iterate; steps with fast sin/cos (see
+ * kes_set_trig()) give no residual; other solvers ignore conv
+ * @param[in] in pointer to structure of type #kes_input_t
+ * @param[in] conv convergence test from enum #kes_conv_e
+ * @return error code from enum #kes_err_e
+ */
+kes_err_e kes_set_conv(
+    kes_input_t*     in,
+    const kes_conv_e conv
+);
+
+
+/*!
+ * @brief set new value for parameter "stop"
+ * @details default value for stop is KES_STOP_DELTA, i.e. the iterations
+ * stop when |x(n+1) - x(n)| <= tolx was observed, which mostly takes one
+ * more iteration than needed; with KES_STOP_ORDER* the Newton-Raphson,
+ * Halley and Danby-Burkardt solvers also stop as soon as the error of
+ * x(n+1) predicted from their order of convergence p, i.e.
+ * |dx| * (|dx| / (1 - e))^(p-1) with dx = x(n+1) - x(n), is below tolx,
+ * or below tolx * |x(n+1)|, or below tolx / DBL_EPSILON units in the last
+ * place of x(n+1) (about 4.5 ulp for tolx = 1E-15); the factor 1/(1 - e)
+ * bounds the error constants of these methods, steps with fast sin/cos (see
+ * kes_set_trig()) never stop by prediction; other solvers ignore stop
+ * @param[in] in pointer to structure of type #kes_input_t
+ * @param[in] stop stopping rule from enum #kes_stop_e
+ * @return error code from enum #kes_err_e
+ */
+kes_err_e kes_set_stop(
+    kes_input_t*     in,
+    const kes_stop_e stop
+);
+
+
+/*!
+ * @brief set new value for parameter "deriv"
+ * @details default value for deriv is KES_DERIV_NONE; with KES_DERIV_FIRST
+ * kesolver() also returns dE/dM and dE/de of the solution in "partial",
+ * with KES_DERIV_SECOND also the second derivatives; the Newton-Raphson,
+ * Halley and Danby-Burkardt solvers (and Markley's and Mikkola's method)
+ * keep e*sin(x) and e*cos(x) of their last step, the derivatives at the
+ * solution follow from them by a short rotation without any sin/cos,
+ * other solvers evaluate sin/cos once at the solution;
+ * kesolver_batch_deriv() returns the derivatives of batches
+ * @param[in] in pointer to structure of type #kes_input_t
+ * @param[in] deriv order of derivatives from enum #kes_deriv_e
+ * @return error code from enum #kes_err_e
+ */
+kes_err_e kes_set_deriv(
+    kes_input_t*      in,
+    const kes_deriv_e deriv
+);
+
+
+/*!
+ * @brief set new value for parameter "hinit"
+ * @details default value for hinit is KES_HSTM_BOUND; selects the starter
+ * of the hyperbolic solvers in kesolver(), the batch solvers and solver
+ * plans, see kes_starter_hyp() for the methods and their error bounds;
+ * KES_FIX_AUTO selects a fixed number of iterations for each of them
+ * @param[in] in pointer to structure of type #kes_input_t
+ * @param[in] hinit hyperbolic starter method from enum #kes_hstm_e
+ * @return error code from enum #kes_err_e
+ */
+kes_err_e kes_set_hstarter(
+    kes_input_t*     in,
+    const kes_hstm_e hinit
+);
+
+
 /*!
  * @brief dummy function that returns input data structure
  */
@@ -362,6 +2866,49 @@ kes_input_t kes_new_input_dummy(kes_input_t in);
                                __VA_ARGS__ } )
 
 
+/*!
+ * @brief dummy function that returns configuration structure
+ */
+kes_config_t kes_new_config_dummy(kes_config_t cfg);
+
+
+/*!
+ * @brief initialize and return a new configuration
+ * @details same arguments and default values as kes_new_input();
+ * function prototype: kes_config_t kes_new_config(args);
+ * @return structure of type #kes_config_t
+ */
+#define kes_new_config(...) kes_new_config_dummy(                              \
+                              (kes_config_t){                                  \
+                                .tolf    = KES_STD_TOL,                        \
+                                .tolx    = KES_STD_TOL,                        \
+                                .maxiter = KES_STD_MAXITER,                    \
+                                __VA_ARGS__ } )
+
+
+/*!
+ * @brief input data structure with the settings of a configuration
+ * @details outputs are zero, settings are checked by kes_check_input();
+ * use for functions taking #kes_input_t, e.g. kes_plan_init()
+ * @param[in] cfg pointer to structure of type #kes_config_t
+ * (or NULL for default settings)
+ * @return structure of type #kes_input_t
+ */
+kes_input_t kes_input_from_config(const kes_config_t* cfg);
+
+
+/*!
+ * @brief name of the instruction set selected for the vectorized kernels
+ * @details on x86-64 the batch kernels are compiled for AVX-512F, AVX2 and
+ * SSE2 and the version for the CPU is selected when the library is loaded,
+ * i.e. one build runs at full vector width on all machines; all versions
+ * give identical results
+ * @return "avx512f", "avx2" or "sse2" on x86-64, otherwise "neon" on
+ * AArch64 or "generic"
+ */
+const char* kes_get_isa(void);
+
+
 /*!
  * @brief print the Library's version number to stdout
  * @return none
@@ -382,6 +2929,35 @@ int kes_get_major_version(void);
  */
 int kes_get_minor_version(void);
 
+
+/*!
+ * @brief write the lookup table of starter KES_STM_ES15 to a table file
+ * @details the table is built if necessary; the file starts with a header
+ * holding format and library version, grid parameters, byte order and a
+ * checksum of the data; it is written to "<path>.tmp" first and renamed,
+ * i.e. processes mapping an older file keep a consistent table
+ * @param[in] path name of the table file
+ * @return error code from enum #kes_err_e,
+ * KES_ERR_NOERR indicates success, KES_ERR_BADFILE indicates error
+ */
+kes_err_e kes_table_save(const char* path);
+
+
+/*!
+ * @brief map a table file read-only as lookup table of KES_STM_ES15
+ * @details the file is validated against format and library version, grid
+ * parameters, byte order and checksum; the pages are shared with all
+ * processes mapping the same file and stay mapped until program exit;
+ * call this before the first use of KES_STM_ES15, afterwards the table in
+ * use is kept; alternatively name the file in the environment variable
+ * KES_TABLE_FILE, it is then mapped on first use
+ * @param[in] path name of the table file
+ * @return error code from enum #kes_err_e,
+ * KES_ERR_NOERR indicates success, KES_ERR_BADFILE indicates a missing,
+ * damaged or outdated file (e.g. of another library version)
+ */
+kes_err_e kes_table_load(const char* path);
+
 #ifdef __cplusplus
 }
 #endif
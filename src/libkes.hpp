@@ -0,0 +1,449 @@
+/***************************************************************************//**
+ * @file    libkes.hpp
+ * @brief   C++ templates with compile-time starter and solver policies
+ * @author  Bazso Akos
+ * @version 2026.10
+ *
+ * @copyright
+ * Copyright (C) 2019 Bazso Akos
+ *
+ * This file is part of libkes.
+ *
+ * libkes is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * libkes is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with libkes.  If not, see <https://www.gnu.org/licenses/>.
+ *
+ ******************************************************************************/
+#pragma once
+#ifndef LIBKES__HPP
+#define LIBKES__HPP
+
+/* include module headers */
+#include "libkes_inline.h"
+
+/* include standard headers */
+#include <cmath>
+#include <cstddef>
+#if (__cplusplus >= 202002L) && defined(__has_include)
+  #if __has_include(<span>)
+    #include <span>
+    #define KES_HPP_SPAN 1
+  #endif
+#endif
+
+/******************************************************************************/
+
+/*
+ * Usage:
+ *
+ *     double E = kes::solve<kes::starter::S08, kes::solver::Halley,
+ *                           kes::Tol<14>>(ecc, ma);
+ *
+ * Starter, solver and stopping criterion are template parameters, i.e. the
+ * iteration is specialized at compile time: there is no dispatch on enum
+ * values, no kes_input_t and no error codes, and the coefficients of the
+ * iteration step are constant-folded. With kes::Fixed<N> the loop has no
+ * exit condition and is unrolled, so loops of the caller over arrays can be
+ * auto-vectorized (starters S01 ... S12). As in kesolver(), the
+ * near-parabolic corner (see libkes_inline.h) starts from the cubic starter
+ * of the near-parabolic solver instead of Starter::start(), and each
+ * iterate is kept within the bounds of the solution; with kes::Tol<N> all
+ * pairs reach the tolerance for 0 <= ecc <= 1-1E-12, with kes::Fixed<N>
+ * the accuracy depends on N as for fixiter of kesolver().
+ *
+ * NOTE as for libkes_inline.h there are no checks of the input: valid for
+ *      0 <= ecc <= 1-1E-12 and finite mean anomalies only, use kesolver()
+ *      of libkes.h for all other cases
+ */
+
+namespace kes
+{
+
+/******************************************************************************/
+
+/*** starter policies: static function start(ecc, ma) for 0 <= ma <= pi ***/
+
+namespace starter
+{
+
+/*! @brief starter KES_STM_ES01: E0 = M */
+struct S01
+{
+    static double start(const double /* ecc */, const double ma)
+    {
+        return( ma );
+    } // end start
+};
+
+/*! @brief starter KES_STM_ES03: E0 = M + e * sin(M) * (1 + e * cos(M)) */
+struct S03
+{
+    static double start(const double ecc, const double ma)
+    {
+        double sx, cx;
+        kes_vec_sincos( &sx, &cx, ma );
+
+        return( ma + ecc * sx * (1.0 + ecc * cx) );
+    } // end start
+};
+
+/*! @brief starter KES_STM_ES04: E0 = M + e */
+struct S04
+{
+    static double start(const double ecc, const double ma)
+    {
+        return( kes_inline_es04( ecc, ma ) );
+    } // end start
+};
+
+/*! @brief starter KES_STM_ES06: E0 = (M + e * pi) / (1 + e) */
+struct S06
+{
+    static double start(const double ecc, const double ma)
+    {
+        return( kes_inline_es06( ecc, ma ) );
+    } // end start
+};
+
+/*! @brief starter KES_STM_ES07: E0 = min{M/(1-e), S4, S6} */
+struct S07
+{
+    static double start(const double ecc, const double ma)
+    {
+        return( kes_inline_es07( ecc, ma ) );
+    } // end start
+};
+
+/*! @brief starter KES_STM_ES08: E0 = S03 + e^4 * (pi - S03) / (20 * pi) */
+struct S08
+{
+    static double start(const double ecc, const double ma)
+    {
+        return( kes_inline_es08( ecc, ma ) );
+    } // end start
+};
+
+/*! @brief starter KES_STM_ES12: E0 = e * E(0,e=1) + (1 - e) * M */
+struct S12
+{
+    static double start(const double ecc, const double ma)
+    {
+        return( kes_inline_es12( ecc, ma ) );
+    } // end start
+};
+
+/*!
+ * @brief starter KES_STM_ES13 from Encke (1850), order O(e^6)
+ * @details uses std::atan2(), i.e. loops over arrays are not vectorized
+ */
+struct S13
+{
+    static double start(const double ecc, const double ma)
+    {
+        double sx, cx;
+
+        kes_vec_sincos( &sx, &cx, ma );
+        double x = std::atan2( ecc * sx, 1.0 - ecc * cx );
+        x = ma + std::sin( x ) - x;
+        kes_vec_sincos( &sx, &cx, x );
+
+        return( std::atan2( sx, cx - ecc ) );
+    } // end start
+};
+
+} // end namespace starter
+
+/******************************************************************************/
+
+/*** solver policies: order of the iteration step of kes_inline_step() ***/
+
+namespace solver
+{
+
+/*! @brief Newton-Raphson method (order 2) */
+struct NewtonRaphson { static constexpr int order = 2; };
+
+/*! @brief Halley's method (order 3) */
+struct Halley        { static constexpr int order = 3; };
+
+/*! @brief Danby-Burkardt method of order 4 */
+struct Danby4        { static constexpr int order = 4; };
+
+/*! @brief Danby-Burkardt method of order 5 */
+struct Danby5        { static constexpr int order = 5; };
+
+} // end namespace solver
+
+/******************************************************************************/
+
+/*** stopping criteria ***/
+
+namespace detail
+{
+
+/*! @brief exact power of ten 10^n for 0 <= n <= 22 */
+constexpr double pow10(const int n)
+{
+    return( (n <= 0) ? 1.0 : 10.0 * pow10(n - 1) );
+} // end pow10
+
+} // end namespace detail
+
+/*!
+ * @brief iterate until the increment |dx| <= 10^(-N), as for tolx in
+ *        kes_input_t, but at most MaxIter times
+ * @details the tolerance is given by its exponent, since floating-point
+ *          template parameters need C++20
+ */
+template<int N = 15, int MaxIter = 100>
+struct Tol
+{
+    static_assert( (N >= 1) && (N <= 15),
+                   "kes::Tol<N>: tolerance 10^(-N) requires 1 <= N <= 15" );
+    static_assert( MaxIter > 0, "kes::Tol<N, MaxIter>: MaxIter > 0" );
+
+    static constexpr int maxiter = MaxIter;
+
+    static bool converged(const double dx)
+    {
+        return( std::fabs( dx ) <= 1.0 / detail::pow10( N ) );
+    } // end converged
+};
+
+/*!
+ * @brief exactly N iterations, same as fixiter in kes_input_t
+ * @details no exit condition, the loop is unrolled completely
+ */
+template<int N>
+struct Fixed
+{
+    static_assert( N >= 0, "kes::Fixed<N>: N >= 0" );
+};
+
+namespace detail
+{
+
+/*!
+ * @brief keep iteration variable within bounds M <= E <= min(M+e, pi) of the
+ *        solution for reduced mean anomalies, as in module single.c
+ * @details poor starters (e.g. S01 or S13 for e close to 1) otherwise let
+ *          the iteration escape to other branches; branch-free
+ */
+inline double bound(const double ecc, const double ma, const double x)
+{
+    const double xmax = kes_vec_blend( (ma + ecc) - M_PI, ma + ecc, M_PI );
+    const double xmin = kes_vec_blend( x - ma, ma, x );
+
+    return( kes_vec_blend( xmax - xmin, xmax, xmin ) );
+} // end bound
+
+/*!
+ * @brief iteration loop for stopping criteria with member maxiter and
+ *        static function converged(dx), e.g. kes::Tol<N>
+ */
+template<class Stop>
+struct loop
+{
+    static double run(
+        const int order, const double ecc, const double ma, double x)
+    {
+        for (int n = 0; n < Stop::maxiter; n++)
+        {
+            const double xnew =
+                bound( ecc, ma, kes_inline_step( order, ecc, ma, x ) );
+            const bool   stop = Stop::converged( xnew - x );
+
+            x = xnew;
+            if ( stop )
+            {
+                break;
+            } // end if
+        } // end for
+
+        return( x );
+    } // end run
+};
+
+/*! @brief iteration loop for kes::Fixed<N>, unrolled completely */
+template<int N>
+struct loop< Fixed<N> >
+{
+    static double run(
+        const int order, const double ecc, const double ma, double x)
+    {
+#pragma GCC unroll 32
+        for (int n = 0; n < N; n++)
+        {
+            x = bound( ecc, ma, kes_inline_step( order, ecc, ma, x ) );
+        } // end for
+
+        return( x );
+    } // end run
+};
+
+} // end namespace detail
+
+/******************************************************************************/
+
+/*** solver functions ***/
+
+/*!
+ * @brief solve elliptic Kepler Equation E - ecc * sin(E) = ma
+ * @tparam Starter  starter policy from namespace kes::starter
+ * @tparam Solver   solver policy from namespace kes::solver
+ * @tparam Stop     stopping criterion kes::Tol<N> or kes::Fixed<N>
+ * @param[in] ecc   eccentricity (0 <= ecc < 1)
+ * @param[in] ma    mean anomaly (in radians)
+ * @return eccentric anomaly (0 <= E < 2*pi)
+ */
+template<class Starter = starter::S08,
+         class Solver  = solver::Danby5,
+         class Stop    = Tol<>>
+inline double solve(const double ecc, const double ma)
+{
+    /* reduce mean anomaly to range -pi <= redma <= pi */
+    const double redma = kes_inline_reduce( ma );
+    const double absma = std::fabs( redma );
+
+    /* call starter function (branch-free choice in the corner) and iterate */
+    double x = kes_vec_blend( kes_inline_corner( ecc, absma ),
+                              kes_inline_npar( ecc, absma ),
+                              Starter::start( ecc, absma ) );
+    x = detail::bound( ecc, absma, x );
+    x = detail::loop<Stop>::run( Solver::order, ecc, absma, x );
+
+    /* modify solution if necessary: 2*pi - x for negative redma */
+    return( kes_vec_blend( redma, M_2PI - x, x ) );
+} // end solve
+
+/*!
+ * @brief solve elliptic Kepler Equation for a range of mean anomalies
+ * @param[in] ecc    common eccentricity (0 <= ecc < 1)
+ * @param[in] first  begin of input range of mean anomalies
+ * @param[in] last   end of input range of mean anomalies
+ * @param[out] out   begin of output range of eccentric anomalies
+ * @return end of output range
+ */
+template<class Starter = starter::S08,
+         class Solver  = solver::Danby5,
+         class Stop    = Tol<>,
+         class InputIt, class OutputIt>
+inline OutputIt solve(
+    const double ecc,
+    InputIt      first,
+    InputIt      last,
+    OutputIt     out
+    )
+{
+    for (; first != last; ++first, ++out)
+    {
+        *out = solve<Starter, Solver, Stop>( ecc, *first );
+    } // end for
+
+    return( out );
+} // end solve
+
+#ifdef KES_HPP_SPAN
+/*!
+ * @brief solve elliptic Kepler Equation for a span of mean anomalies
+ * @details processes min(ma.size(), ea.size()) elements
+ * @param[in] ecc   common eccentricity (0 <= ecc < 1)
+ * @param[in] ma    mean anomalies (in radians)
+ * @param[out] ea   eccentric anomalies (0 <= E < 2*pi)
+ */
+template<class Starter = starter::S08,
+         class Solver  = solver::Danby5,
+         class Stop    = Tol<>>
+inline void solve(
+    const double            ecc,
+    std::span<const double> ma,
+    std::span<double>       ea
+    )
+{
+    const std::size_t n = ((ma.size() < ea.size()) ? ma.size() : ea.size());
+
+    for (std::size_t i = 0; i < n; i++)
+    {
+        ea[i] = solve<Starter, Solver, Stop>( ecc, ma[i] );
+    } // end for
+} // end solve
+
+/*!
+ * @brief solve elliptic Kepler Equation for spans of eccentricities and mean
+ *        anomalies
+ * @details processes the minimum of the three sizes of elements
+ * @param[in] ecc   eccentricities (0 <= ecc < 1)
+ * @param[in] ma    mean anomalies (in radians)
+ * @param[out] ea   eccentric anomalies (0 <= E < 2*pi)
+ */
+template<class Starter = starter::S08,
+         class Solver  = solver::Danby5,
+         class Stop    = Tol<>>
+inline void solve(
+    std::span<const double> ecc,
+    std::span<const double> ma,
+    std::span<double>       ea
+    )
+{
+    std::size_t n = ((ma.size() < ea.size()) ? ma.size() : ea.size());
+    n = ((ecc.size() < n) ? ecc.size() : n);
+
+    for (std::size_t i = 0; i < n; i++)
+    {
+        ea[i] = solve<Starter, Solver, Stop>( ecc[i], ma[i] );
+    } // end for
+} // end solve
+#endif  /* KES_HPP_SPAN */
+
+/******************************************************************************/
+
+/*** function objects, e.g. for std::transform with execution policies ***/
+
+/*!
+ * @brief unary function object E = f(ma) for a common eccentricity
+ * @details stateless apart from ecc and without side effects, i.e. safe for
+ *          std::execution::par_unseq
+ */
+template<class Starter = starter::S08,
+         class Solver  = solver::Danby5,
+         class Stop    = Tol<>>
+struct kepler
+{
+    double ecc; ///< eccentricity (0 <= ecc < 1)
+
+    double operator()(const double ma) const
+    {
+        return( solve<Starter, Solver, Stop>( ecc, ma ) );
+    } // end operator()
+};
+
+/*!
+ * @brief binary function object E = f(ecc, ma)
+ * @details without state and side effects, i.e. safe for
+ *          std::execution::par_unseq
+ */
+template<class Starter = starter::S08,
+         class Solver  = solver::Danby5,
+         class Stop    = Tol<>>
+struct solve_fn
+{
+    double operator()(const double ecc, const double ma) const
+    {
+        return( solve<Starter, Solver, Stop>( ecc, ma ) );
+    } // end operator()
+};
+
+/******************************************************************************/
+
+} // end namespace kes
+
+#endif  /* LIBKES__HPP */
@@ -0,0 +1,477 @@
+/***************************************************************************//**
+ * @file    libkes_inline.h
+ * @brief   header-only solvers with fixed starter and solver methods
+ * @author  Bazso Akos
+ * @version 2026.10
+ *
+ * @copyright
+ * Copyright (C) 2019 Bazso Akos
+ *
+ * This file is part of libkes.
+ *
+ * libkes is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * libkes is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with libkes.  If not, see <https://www.gnu.org/licenses/>.
+ *
+ ******************************************************************************/
+#pragma once
+#ifndef LIBKES_INLINE__H
+#define LIBKES_INLINE__H
+
+/* include module headers */
+#include "const.h"
+#include "vecmath.h"
+
+/******************************************************************************/
+
+/* near-parabolic corner of kesolver(), same values as in libkes.h */
+#ifndef KES_NEARPAR_ECC
+  #define KES_NEARPAR_ECC  0.99
+#endif
+#ifndef KES_CORNER_ECC
+  #define KES_CORNER_ECC   0.8
+  #define KES_CORNER_MA    0.25
+  #define KES_CORNER_SLOPE 1.5
+#endif
+
+/******************************************************************************/
+
+/*
+ * The functions kes_solve_<starter>_<solver>(ecc, ma) solve the elliptic
+ * Kepler Equation with a fixed pair of methods and a fixed number of
+ * iterations, the same as selected by KES_FIX_AUTO for kesolver(). As in
+ * kesolver(), ecc > KES_NEARPAR_ECC and the corner ecc > KES_CORNER_ECC,
+ * reduced M < KES_CORNER_MA + KES_CORNER_SLOPE * (ecc - KES_CORNER_ECC)
+ * start from the cubic starter of the near-parabolic solver instead, and the
+ * iteration step avoids cancellation there. All functions are static inline
+ * and call no library functions, so loops over arrays of the caller inline
+ * completely and can be auto-vectorized.
+ *
+ * NOTE there are no checks of the input: valid for 0 <= ecc < 1 and finite
+ *      mean anomalies only, use kesolver() for all other cases; starters
+ *      needing cbrt() (ES10, ES14) or a lookup table (ES15) are not provided
+ */
+
+/******************************************************************************/
+
+/*** internal functions ***/
+
+/*******************************************************************************
+ *  FUNCTION    : kes_inline_reduce
+ *  DESCRIPTION : reduce mean anomaly to interval [-pi:pi], branch-free
+ *  INPUT       : mean anomaly "ma" (in radians)
+ *  OUTPUT      : ma - k * 2*pi with nearest integer k (in radians)
+ ******************************************************************************/
+static inline double kes_inline_reduce(const double ma)
+{
+    /* same as kes_reduce() of the library for |ma| < KES_VEC_REDUCE_MAX */
+    return( kes_vec_reduce( ma ) );
+} // end kes_inline_reduce
+
+/******************************************************************************/
+
+/*******************************************************************************
+ *  FUNCTION    : kes_inline_corner
+ *  DESCRIPTION : condition of the near-parabolic corner, see kesolver()
+ *  INPUT       : - eccentricity "ecc"
+ *                - reduced mean anomaly "ma" (0 <= ma <= pi)
+ *  OUTPUT      : negative value within the corner, positive or zero
+ *                otherwise, i.e. a condition for kes_vec_blend()
+ ******************************************************************************/
+static inline double kes_inline_corner(
+    const double ecc,
+    const double ma
+    )
+{
+    /* ecc > KES_CORNER_ECC and ma below the bound of the corner */
+    const double cecc = KES_CORNER_ECC - ecc;
+    const double cma  = ma - (KES_CORNER_MA +
+                              KES_CORNER_SLOPE * (ecc - KES_CORNER_ECC));
+    const double both = kes_vec_blend( cecc, cma, cecc );
+
+    /* ... or ecc > KES_NEARPAR_ECC */
+    const double cpar = KES_NEARPAR_ECC - ecc;
+
+    return( kes_vec_blend( cpar, cpar, both ) );
+} // end kes_inline_corner
+
+/******************************************************************************/
+
+/*******************************************************************************
+ *  FUNCTION    : kes_inline_npar
+ *  DESCRIPTION : starter of the near-parabolic corner, same formula as
+ *                kes_stm_npar() of module parab.c
+ *  INPUT       : - eccentricity "ecc" (KES_CORNER_ECC < ecc < 1)
+ *                - reduced mean anomaly "ma" (0 <= ma <= pi)
+ *  OUTPUT      : starting value
+ ******************************************************************************/
+static inline double kes_inline_npar(
+    const double ecc,
+    const double ma
+    )
+{
+    /* NOTE keep harmless values in lanes outside of the corner */
+    const double e = kes_vec_blend( ecc - KES_CORNER_ECC, KES_CORNER_ECC, ecc );
+
+    /* cubic equation E^3 + 3*p*E - 2*q = 0 from the series
+     * E - e*sin(E) = (1-e)*E + e*E^3/6 + O(E^5)
+     */
+    const double p = 2.0 * (1.0 - e) / e;
+    const double q = 3.0 * ma / e;
+    double       s = kes_vec_cbrt( q + kes_vec_sqrt( q * q + p * p * p ) );
+
+    /* root E = s - p/s without cancellation */
+    s *= s;
+    const double x = 2.0 * q / (s + p + p * p / s);
+
+    /* keep starter within bounds M <= E <= pi */
+    const double y = kes_vec_blend( x - ma, ma, x );
+
+    return( kes_vec_blend( M_PI - y, M_PI, y ) );
+} // end kes_inline_npar
+
+/******************************************************************************/
+
+/*******************************************************************************
+ *  FUNCTION    : kes_inline_step
+ *  DESCRIPTION : iteration step of order 2 to 5, i.e. Newton-Raphson (2),
+ *                Halley (3) and Danby-Burkardt (4, 5), same formulas as
+ *                kes_itercore2 ... kes_itercore5 in the cancellation-free
+ *                form of kes_npar_core() of module parab.c
+ *  INPUT       : - "order" of iteration method (2 <= order <= 5)
+ *                - eccentricity "ecc"
+ *                - mean anomaly "ma" (in radians)
+ *                - old value of iteration variable "x0"
+ *  OUTPUT      : update to iteration variable x0+dx
+ *  REFERENCE   : Danby & Burkardt (1983), Celestial Mechanics 31, p.95-107
+ ******************************************************************************/
+static inline double kes_inline_step(
+    const int    order,
+    const double ecc,
+    const double ma,
+    const double x0
+    )
+{
+    double sm, cm; /* x - sin(x), 1 - cos(x) */
+    double dx;     /* increment deltax */
+
+    /* calculate sin, cos */
+    kes_vec_sincosm( &sm, &cm, x0 );
+    const double esx = ecc * (x0 - sm);
+    const double ecx = ecc * (1.0 - cm);
+
+    /* evaluate Kepler Equation: 0th and 1st derivative,
+     * NOTE x - e*sin(x) = (1-e)*x + e*(x-sin(x)) and
+     *      1 - e*cos(x) = (1-e) + e*(1-cos(x)) avoid cancellation,
+     *      tiny increment to denominator as in module itercore.c
+     */
+    const double f0 = ma - (1.0 - ecc) * x0 - ecc * sm;
+    const double f1 = (1.0 - ecc) + ecc * cm + 1.0E-19;
+
+    /* delta1: eq. (16) */
+    dx = f0 / f1;
+
+    if ( order >= 3 )
+    {
+        /* delta2: eq. (17) */
+        const double f2 = esx / 2.0;
+        dx = f0 / (f1 + dx * f2);
+
+        if ( order >= 4 )
+        {
+            /* delta3: eq. (18) */
+            const double f3 = ecx / 6.0;
+            dx = f0 / (f1 + dx * (f2 + dx * f3));
+
+            if ( order >= 5 )
+            {
+                /* delta4: eq. (19) */
+                const double f4 = -esx / 24.0;
+                dx = f0 / (f1 + dx * (f2 + dx * (f3 + dx * f4)));
+            } // end if
+        } // end if
+    } // end if
+
+    return( x0 + dx );
+} // end kes_inline_step
+
+/******************************************************************************/
+
+/*******************************************************************************
+ *  FUNCTION    : kes_inline_solve
+ *  DESCRIPTION : solve elliptic Kepler Equation with a fixed number of
+ *                iterations, without evaluation of residuals
+ *  INPUT       : - "order" of iteration method (2 <= order <= 5)
+ *                - number of iterations "nfix"
+ *                - eccentricity "ecc" (0 <= ecc < 1)
+ *                - mean anomaly "ma" (in radians)
+ *                - pointer "stm" to starter function for the reduced mean
+ *                  anomaly (0 <= ma <= pi)
+ *  OUTPUT      : solution of elliptic Kepler Equation (0 <= E < 2*pi)
+ *  NOTE constant arguments of the callers below are propagated, i.e. the
+ *       starter is inlined and the loop is unrolled; the near-parabolic
+ *       corner takes the starter kes_inline_npar() instead, which needs at
+ *       most 5 iterations (see kes_npar_fixiter()), i.e. less than nfix
+ ******************************************************************************/
+static inline double kes_inline_solve(
+    const int    order,
+    const int    nfix,
+    const double ecc,
+    const double ma,
+    double (*stm)(const double, const double)
+    )
+{
+    /* reduce mean anomaly to range -pi <= redma <= pi */
+    const double redma = kes_inline_reduce( ma );
+    const double absma = fabs( redma );
+
+    /* call starter function (branch-free choice in the corner) and iterate */
+    double x = kes_vec_blend( kes_inline_corner( ecc, absma ),
+                              kes_inline_npar( ecc, absma ), stm( ecc, absma ) );
+#pragma GCC unroll 32
+    for (int n = 0; n < nfix; n++)
+    {
+        x = kes_inline_step( order, ecc, absma, x );
+    } // end for
+
+    /* modify solution if necessary: 2*pi - x for negative redma */
+    return( kes_vec_blend( redma, M_2PI - x, x ) );
+} // end kes_inline_solve
+
+/******************************************************************************/
+
+/*** starter methods, same formulas as in module starter.c ***/
+
+/*******************************************************************************
+ *  STARTER   : KES_STM_ES04
+ *  FORMULA   : E0 = M + e
+ ******************************************************************************/
+static inline double kes_inline_es04(
+    const double ecc,
+    const double ma
+    )
+{
+    return( ma + ecc );
+} // end kes_inline_es04
+
+/******************************************************************************/
+
+/*******************************************************************************
+ *  STARTER   : KES_STM_ES06
+ *  FORMULA   : E0 = (M + e * pi) / (1 + e)
+ ******************************************************************************/
+static inline double kes_inline_es06(
+    const double ecc,
+    const double ma
+    )
+{
+    return( (ma + ecc * M_PI) / (1.0 + ecc) );
+} // end kes_inline_es06
+
+/******************************************************************************/
+
+/*******************************************************************************
+ *  STARTER   : KES_STM_ES07
+ *  FORMULA   : E0 = min{M/(1-e), S4, S6}
+ ******************************************************************************/
+static inline double kes_inline_es07(
+    const double ecc,
+    const double ma
+    )
+{
+    const double tmp = ma / (1.0 - ecc);
+    const double s4  = kes_inline_es04( ecc, ma );
+    const double s6  = kes_inline_es06( ecc, ma );
+
+    /* choose minimal starter, branch-free */
+    const double min = kes_vec_blend( tmp - s4, tmp, s4 );
+
+    return( kes_vec_blend( min - s6, min, s6 ) );
+} // end kes_inline_es07
+
+/******************************************************************************/
+
+/*******************************************************************************
+ *  STARTER   : KES_STM_ES08
+ *  FORMULA   : E0 = S03 + lambda * e^4 * (pi - S03),
+ *              S03 = M + e * sin(M) * (1 + e * cos(M)),
+ *              lambda = 1 / (20 * pi)
+ ******************************************************************************/
+static inline double kes_inline_es08(
+    const double ecc,
+    const double ma
+    )
+{
+    double sx, cx;
+    kes_vec_sincos( &sx, &cx, ma );
+
+    const double x = ma + ecc * sx * (1.0 + ecc * cx);
+
+    return( x + (0.05 * M_1_PI) * ecc * ecc * ecc * ecc * (M_PI - x) );
+} // end kes_inline_es08
+
+/******************************************************************************/
+
+/*******************************************************************************
+ *  STARTER   : KES_STM_ES12
+ *  FORMULA   : E0 = e * E(0,e=1) + (1 - e) * M
+ ******************************************************************************/
+static inline double kes_inline_es12(
+    const double ecc,
+    const double ma
+    )
+{
+    const double a = (M_PI-1.0)*(M_PI-1.0)/(M_PI+2.0/3.0);
+    const double b = 2.0*(M_PI-1.0/6.0)*(M_PI-1.0/6.0)/(M_PI+2.0/3.0);
+    const double w = M_PI - ma;
+
+    return( ecc * (M_PI - a * w / (b - w)) + (1.0 - ecc) * ma );
+} // end kes_inline_es12
+
+/******************************************************************************/
+
+/*** solvers with fixed pairs of methods ***/
+
+/*******************************************************************************
+ *  FUNCTIONS   : kes_solve_<starter>_<solver>
+ *  DESCRIPTION : solve elliptic Kepler Equation with starter ES04, ES06,
+ *                ES07, ES08 or ES12 and Newton-Raphson (newrap), Halley
+ *                (halley) or Danby-Burkardt (danbur4, danbur5) method;
+ *                the number of iterations is the worst case reaching
+ *                KES_STD_TOL for 0 <= ecc <= 1-1E-12, see KES_FIX_AUTO,
+ *                the near-parabolic corner is routed as in kesolver()
+ *  INPUT       : - eccentricity "ecc" (0 <= ecc < 1)
+ *                - mean anomaly "ma" (in radians)
+ *  OUTPUT      : solution of elliptic Kepler Equation (0 <= E < 2*pi)
+ ******************************************************************************/
+static inline double kes_solve_es04_newrap(const double ecc, const double ma)
+{
+    return( kes_inline_solve( 2, 21, ecc, ma, &kes_inline_es04 ) );
+} // end kes_solve_es04_newrap
+
+
+static inline double kes_solve_es04_halley(const double ecc, const double ma)
+{
+    return( kes_inline_solve( 3, 13, ecc, ma, &kes_inline_es04 ) );
+} // end kes_solve_es04_halley
+
+
+static inline double kes_solve_es04_danbur4(const double ecc, const double ma)
+{
+    return( kes_inline_solve( 4, 11, ecc, ma, &kes_inline_es04 ) );
+} // end kes_solve_es04_danbur4
+
+
+static inline double kes_solve_es04_danbur5(const double ecc, const double ma)
+{
+    return( kes_inline_solve( 5, 10, ecc, ma, &kes_inline_es04 ) );
+} // end kes_solve_es04_danbur5
+
+
+static inline double kes_solve_es06_newrap(const double ecc, const double ma)
+{
+    return( kes_inline_solve( 2, 22, ecc, ma, &kes_inline_es06 ) );
+} // end kes_solve_es06_newrap
+
+
+static inline double kes_solve_es06_halley(const double ecc, const double ma)
+{
+    return( kes_inline_solve( 3, 14, ecc, ma, &kes_inline_es06 ) );
+} // end kes_solve_es06_halley
+
+
+static inline double kes_solve_es06_danbur4(const double ecc, const double ma)
+{
+    return( kes_inline_solve( 4, 11, ecc, ma, &kes_inline_es06 ) );
+} // end kes_solve_es06_danbur4
+
+
+static inline double kes_solve_es06_danbur5(const double ecc, const double ma)
+{
+    return( kes_inline_solve( 5, 10, ecc, ma, &kes_inline_es06 ) );
+} // end kes_solve_es06_danbur5
+
+
+static inline double kes_solve_es07_newrap(const double ecc, const double ma)
+{
+    return( kes_inline_solve( 2, 21, ecc, ma, &kes_inline_es07 ) );
+} // end kes_solve_es07_newrap
+
+
+static inline double kes_solve_es07_halley(const double ecc, const double ma)
+{
+    return( kes_inline_solve( 3, 13, ecc, ma, &kes_inline_es07 ) );
+} // end kes_solve_es07_halley
+
+
+static inline double kes_solve_es07_danbur4(const double ecc, const double ma)
+{
+    return( kes_inline_solve( 4, 11, ecc, ma, &kes_inline_es07 ) );
+} // end kes_solve_es07_danbur4
+
+
+static inline double kes_solve_es07_danbur5(const double ecc, const double ma)
+{
+    return( kes_inline_solve( 5, 10, ecc, ma, &kes_inline_es07 ) );
+} // end kes_solve_es07_danbur5
+
+
+static inline double kes_solve_es08_newrap(const double ecc, const double ma)
+{
+    return( kes_inline_solve( 2, 14, ecc, ma, &kes_inline_es08 ) );
+} // end kes_solve_es08_newrap
+
+
+static inline double kes_solve_es08_halley(const double ecc, const double ma)
+{
+    return( kes_inline_solve( 3,  9, ecc, ma, &kes_inline_es08 ) );
+} // end kes_solve_es08_halley
+
+
+static inline double kes_solve_es08_danbur4(const double ecc, const double ma)
+{
+    return( kes_inline_solve( 4,  7, ecc, ma, &kes_inline_es08 ) );
+} // end kes_solve_es08_danbur4
+
+
+static inline double kes_solve_es08_danbur5(const double ecc, const double ma)
+{
+    return( kes_inline_solve( 5,  7, ecc, ma, &kes_inline_es08 ) );
+} // end kes_solve_es08_danbur5
+
+
+static inline double kes_solve_es12_newrap(const double ecc, const double ma)
+{
+    return( kes_inline_solve( 2, 20, ecc, ma, &kes_inline_es12 ) );
+} // end kes_solve_es12_newrap
+
+
+static inline double kes_solve_es12_halley(const double ecc, const double ma)
+{
+    return( kes_inline_solve( 3, 12, ecc, ma, &kes_inline_es12 ) );
+} // end kes_solve_es12_halley
+
+
+static inline double kes_solve_es12_danbur4(const double ecc, const double ma)
+{
+    return( kes_inline_solve( 4, 10, ecc, ma, &kes_inline_es12 ) );
+} // end kes_solve_es12_danbur4
+
+
+static inline double kes_solve_es12_danbur5(const double ecc, const double ma)
+{
+    return( kes_inline_solve( 5,  9, ecc, ma, &kes_inline_es12 ) );
+} // end kes_solve_es12_danbur5
+
+/******************************************************************************/
+
+#endif  /* LIBKES_INLINE__H */
@@ -31,6 +31,7 @@
 #include "markley.h"
 #include "const.h"
 #include "debug.h"
+#include "trace.h"
 #include "itercore.h"
 #include "kepeq.h"
 
@@ -54,30 +55,43 @@ int markley(
 {
     register int count = 1;      /* iteration counter */
     double       deltax, deltaf; /* error residuals */
+    double       sc[2];          /* e*sin, e*cos of the correction step */
 
-    /* correction factor for absolute error deltaf */
-    const double corr = ecc / (1.0 - ecc);
+    /* correction factor for absolute error deltaf (precomputed if available) */
+    const double corr = ((res->terms != NULL) ?
+                         res->terms->corr : ecc / (1.0 - ecc));
 
     /* reset error residuals */
     deltax = deltaf = 0.0;
-#if KES_SHOW_ITER_STATS
     res->nbrSinEval = res->nbrCosEval = res->nbrFktEval = 0;
-#endif
 
-#if KES_ITER_DEBUG
-    KES_DEBUG_STM("markley", ecc, ma, starter);
-#endif
+    /* trace iteration process? */
+    const int trace = kes_trace_begin();
 
-    /* calculate parameters */
-    double       ad = 1.0 / (M_PISQ - 6.0);
-    const double ak = 1.6 * M_PI * ad;
-    ad *= 3.0 * M_PISQ;
+    /* NOTE given starter is ignored, see STEP #1 */
+    (void)starter;
+
+    /* calculate parameters (precomputed if available) */
+    double ad, ak, d0;
+    if ( res->terms != NULL )
+    {
+        ad = res->terms->mk_ad;
+        ak = res->terms->mk_ak;
+        d0 = res->terms->mk_d0;
+    } // end if
+    else
+    {
+        ad  = 1.0 / (M_PISQ - 6.0);
+        ak  = 1.6 * M_PI * ad / (1.0 + ecc);
+        ad *= 3.0 * M_PISQ;
+        d0  = 3.0 * (1.0 - ecc);
+    } // end else
 
     /* alpha(e,M) : eq. (20) */
-    const double a  = ad + ak * (M_PI - ma) / (1.0 + ecc);
+    const double a  = ad + ak * (M_PI - ma);
 
     /* d : eq. (5) */
-    const double d  = 3.0 * (1.0 - ecc) + a * ecc;
+    const double d  = d0 + a * ecc;
 
     /* q : eq. (9) */
     const double q  = 2.0 * a * d * (1.0 - ecc) - ma * ma;
@@ -98,31 +112,28 @@ int markley(
         /* starter value x0 */
         x = (2.0 * r * w / (w * w + q * w + q * q) + ma) / d;
     } // end if
-#if KES_ITER_DEBUG
-    KES_DEBUG_SOL("markley", 1, w, x);
-#endif
+    kes_trace_step( trace, KES_SOL_MARKLEY, 0, ecc, ma, x, 0.0, 0.0 );
 
     /* save starter */
     res->starter = x;
 
     /*** STEP #2: fifth order correction ***/
 
-    /* call fifth order method */
-    x = kes_itercore5( ecc, ma, x );
-#if KES_SHOW_ITER_STATS
-    ++(res->nbrSinEval); ++(res->nbrCosEval); ++(res->nbrCosEval);
-#endif
+    /* call fifth order method, keep sin/cos at the iterate of the step */
+    const double xlast = x;
+    x = kes_itercore5_sc( ecc, ma, x, NULL, sc );
+    kes_trig_keep( res, xlast, sc[0], sc[1] );
+    ++(res->nbrSinEval); ++(res->nbrCosEval); ++(res->nbrFktEval);
 
     /* update error residuals */
     deltax = fabs( x - res->starter );
-    deltaf = fabs( kes_keq_ell( ecc, ma, x ) ) * corr;
-#if KES_SHOW_ITER_STATS
-    ++(res->nbrSinEval); ++(res->nbrFktEval);
-#endif
-
-#if KES_ITER_DEBUG
-    KES_DEBUG_SOL("markley", 2, deltax, deltaf);
-#endif
+    if ( res->fixiter == 0 )
+    {
+        deltaf = fabs( kes_keq_ell( ecc, ma, x ) ) * corr;
+        ++(res->nbrSinEval); ++(res->nbrFktEval);
+    } // end if
+
+    kes_trace_step( trace, KES_SOL_MARKLEY, 1, ecc, ma, x, deltax, deltaf );
 
     /* results */
     res->result = x;
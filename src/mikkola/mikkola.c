@@ -31,6 +31,7 @@
 #include "mikkola.h"
 #include "const.h"
 #include "debug.h"
+#include "trace.h"
 #include "itercore.h"
 #include "kepeq.h"
 
@@ -54,24 +55,27 @@ int mikkola(
 {
     register int count = 1;      /* iteration counter */
     double       deltax, deltaf; /* error residuals */
+    double       sc[2];          /* e*sin, e*cos of the correction step */
 
-    /* correction factor for absolute error deltaf */
-    const double corr = ecc / (1.0 - ecc);
+    /* correction factor for absolute error deltaf (precomputed if available) */
+    const double corr = ((res->terms != NULL) ?
+                         res->terms->corr : ecc / (1.0 - ecc));
 
     /* reset error residuals */
     deltax = deltaf = 0.0;
-#if KES_SHOW_ITER_STATS
     res->nbrSinEval = res->nbrCosEval = res->nbrFktEval = 0;
-#endif
 
-#if KES_ITER_DEBUG
-    KES_DEBUG_STM("mikkola", ecc, ma, starter);
-#endif
+    /* trace iteration process? */
+    const int trace = kes_trace_begin();
+
+    /* NOTE given starter is ignored, see STEP #1 */
+    (void)starter;
 
     /*** STEP #1: find starter from cubic approximation ***/
 
     /* solve cubic equation s^3 + 3*a*s - 2*b = 0 */
-    double       a = 1.0 / (0.5 + 4.0 * ecc);       /* common denominator */
+    double       a = ((res->terms != NULL) ?         /* common denominator */
+                      res->terms->mi_frac : 1.0 / (0.5 + 4.0 * ecc));
     const double b = 0.5 * ma * a;                  /* coeff. b */
     a *= (1.0 - ecc);                               /* coeff. a */
     const double c = cbrt( sqrt(a*a*a + b*b) + b ); /* cube root */
@@ -87,37 +91,35 @@ int mikkola(
     s2 = s*s;
 
     /* correction term O(s^5) */
-    deltax = -0.078 * s * s2 * s2 / (1.0 + ecc);
+    deltax = -s * s2 * s2 * ((res->terms != NULL) ?
+                             res->terms->mi_corr : 0.078 / (1.0 + ecc));
     s += deltax;
     s2 = s*s;
 
     /* starting approx. */
     double x = ma + ecc * s * (3.0 - 4.0 * s2);
-#if KES_ITER_DEBUG
-    KES_DEBUG_SOL("mikkola", 1, c, x);
-#endif
+    kes_trace_step( trace, KES_SOL_MIKKOLA, 0, ecc, ma, x, 0.0, 0.0 );
 
     /* save starter */
     res->starter = x;
 
     /*** STEP #2: fifth order correction ***/
 
-    /* call fifth order method */
-    x = kes_itercore5( ecc, ma, x );
-#if KES_SHOW_ITER_STATS
+    /* call fifth order method, keep sin/cos at the iterate of the step */
+    const double xlast = x;
+    x = kes_itercore5_sc( ecc, ma, x, NULL, sc );
+    kes_trig_keep( res, xlast, sc[0], sc[1] );
     ++(res->nbrSinEval); ++(res->nbrCosEval); ++(res->nbrFktEval);
-#endif
 
     /* update error residuals */
     deltax = fabs( x - res->starter );
-    deltaf = fabs( kes_keq_ell( ecc, ma, x ) ) * corr;
-#if KES_SHOW_ITER_STATS
-    ++(res->nbrSinEval); ++(res->nbrFktEval);
-#endif
-
-#if KES_ITER_DEBUG
-    KES_DEBUG_SOL("mikkola", 2, deltax, deltaf);
-#endif
+    if ( res->fixiter == 0 )
+    {
+        deltaf = fabs( kes_keq_ell( ecc, ma, x ) ) * corr;
+        ++(res->nbrSinEval); ++(res->nbrFktEval);
+    } // end if
+
+    kes_trace_step( trace, KES_SOL_MIKKOLA, 1, ecc, ma, x, deltax, deltaf );
 
     /* results */
     res->result = x;
@@ -31,6 +31,7 @@
 #include "nijenh.h"
 #include "const.h"
 #include "debug.h"
+#include "trace.h"
 #include "itercore.h"
 #include "kepeq.h"
 #include "utils.h"
@@ -102,21 +103,18 @@ int nijenh(
     double       deltax, deltaf; /* error residuals */
     const double e1 = 1.0 - ecc; /* eccentricity complement */
 
-    /* correction factor for absolute error deltaf */
-    const double corr = ecc / e1;
+    /* correction factor for absolute error deltaf (precomputed if available) */
+    const double corr = ((res->terms != NULL) ? res->terms->corr : ecc / e1);
 
     double x, ecosx, esinx;      /* for iteration */
     double f[NIJENHUIS_MAX_ITER+1], h[NIJENHUIS_MAX_ITER+1];
 
     /* reset error residuals */
     deltax = deltaf = 0.0;
-#if KES_SHOW_ITER_STATS
     res->nbrSinEval = res->nbrCosEval = res->nbrFktEval = 0;
-#endif
 
-#if KES_ITER_DEBUG
-    KES_DEBUG_STM("nijenh", ecc, ma, starter);
-#endif
+    /* trace iteration process? */
+    const int trace = kes_trace_begin();
 
     /* apply Mikkola starter in region (D) -- using ad hoc boundary values */
     if ( (ma < 0.4) && (ecc > 0.6) )
@@ -124,7 +122,8 @@ int nijenh(
         /*** STEP #1: rough starter ***/
 
         /* solve cubic equation s^3 + 3*p*s - 2*q = 0 */
-        double frac = 1.0 / (0.5 + 4.0 * ecc);     /* common denominator */
+        double frac = ((res->terms != NULL) ?      /* common denominator */
+                       res->terms->mi_frac : 1.0 / (0.5 + 4.0 * ecc));
         double    p = e1 * frac;                   /* coeff. p */
         double    q = 0.5 * ma * frac;             /* coeff. q */
         double    z = cbrt(sqrt(p*p*p + q*q) + q); /* cube root */
@@ -173,17 +172,13 @@ int nijenh(
 
     /* save refined starter */
     res->starter = x;
-#if KES_ITER_DEBUG
-    KES_DEBUG_SOL("nijenh", 1, starter, x);
-#endif
+    kes_trace_step( trace, KES_SOL_NIJENH, 0, ecc, ma, x, 0.0, 0.0 );
 
     /*** STEP #3: final correction ***/
 
     /* calculate sin, cos */
     kes_sincos(&esinx, &ecosx, x, ecc);
-#if KES_SHOW_ITER_STATS
     ++(res->nbrSinEval); ++(res->nbrCosEval);
-#endif
 
     /* calculate function and derivatives */
     f[0] = ma - x + esinx; // f(x)
@@ -212,13 +207,9 @@ int nijenh(
     /* update error residuals */
     deltax = fabs( x - res->starter );
     deltaf = fabs( kes_keq_ell(ecc, ma, x) ) * corr;
-#if KES_SHOW_ITER_STATS
     ++(res->nbrSinEval); ++(res->nbrFktEval);
-#endif
 
-#if KES_ITER_DEBUG
-    KES_DEBUG_SOL("nijenh", 2, deltax, deltaf);
-#endif
+    kes_trace_step( trace, KES_SOL_NIJENH, 1, ecc, ma, x, deltax, deltaf );
 
     /* results */
     res->result = x;
@@ -0,0 +1,419 @@
+/***************************************************************************//**
+ * @file    numa.c
+ * @brief   memory domains of the thread pool on NUMA machines
+ * @author  Bazso Akos
+ * @version 2026.10
+ *
+ * @copyright
+ * Copyright (C) 2019 Bazso Akos
+ *
+ * This file is part of libkes.
+ *
+ * libkes is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * libkes is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with libkes.  If not, see <https://www.gnu.org/licenses/>.
+ *
+ ******************************************************************************/
+/* affinity of threads, sched_getcpu(), syscall() and mmap() */
+#define _GNU_SOURCE
+
+/* include standard headers */
+#include <pthread.h>
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <unistd.h>
+
+#if defined(__linux__)
+#include <sched.h>
+#include <sys/mman.h>
+#include <sys/syscall.h>
+#endif
+
+/* include module headers */
+#include "numa.h"
+#include "alloc.h"
+
+/******************************************************************************/
+
+/* topology from sysfs and queries of page homes by move_pages(2) */
+#if defined(__linux__) && defined(CPU_SETSIZE) && defined(SYS_move_pages)
+#define KES_NUMA_LINUX 1
+#else
+#define KES_NUMA_LINUX 0
+#endif
+
+/* largest node number of the operating system mapped to an index */
+#define KES_NUMA_IDS    1024
+
+/******************************************************************************/
+
+#if KES_NUMA_LINUX
+
+/* topology of the machine, read once */
+static struct
+{
+    int       nnodes;                  ///< number of nodes with processors
+    cpu_set_t cpus[KES_NUMA_MAX];      ///< processors of each node
+    int16_t   index[KES_NUMA_IDS];     ///< index of node number, or -1
+    int16_t   cpunode[CPU_SETSIZE];    ///< index of node of processor, or -1
+} topo;
+
+static pthread_once_t topo_once = PTHREAD_ONCE_INIT;
+
+#endif
+
+/* user setting, NUMA-aware scheduling enabled */
+static int numa_enabled = 1;
+
+/******************************************************************************/
+
+#if KES_NUMA_LINUX
+
+/*******************************************************************************
+ * FUNCTION    : kes_numa_list
+ * DESCRIPTION : read a list of numbers in sysfs format, e.g. "0-3,8,10-11"
+ * INPUT       : name of file "path", array of flags "set" and its size
+ * OUTPUT      : number of flags set, 0 if the file cannot be read
+ ******************************************************************************/
+static int kes_numa_list(const char* path, unsigned char* set, const int size)
+{
+    char  buf[4096];
+    FILE* fp = fopen( path, "r" );
+    if ( fp == NULL )
+    {
+        return( 0 );
+    } // end if
+    const size_t len = fread( buf, 1, sizeof(buf) - 1, fp );
+    fclose( fp );
+    buf[len] = '\0';
+
+    int   count = 0;
+    char* p     = buf;
+    while ( (*p >= '0') && (*p <= '9') )
+    {
+        long lo = strtol( p, &p, 10 );
+        long hi = lo;
+        if ( *p == '-' )
+        {
+            hi = strtol( p + 1, &p, 10 );
+        } // end if
+        for (long k = lo; (k <= hi) && (k < size); k++)
+        {
+            set[k] = 1;
+            ++count;
+        } // end for
+        if ( *p == ',' )
+        {
+            ++p;
+        } // end if
+    } // end while
+
+    return( count );
+} // end kes_numa_list
+
+/******************************************************************************/
+
+/*******************************************************************************
+ * FUNCTION    : kes_numa_init
+ * DESCRIPTION : read the nodes with processors from sysfs, nodes beyond
+ *               KES_NUMA_MAX are folded onto the first ones
+ * INPUT       : none
+ * OUTPUT      : none
+ ******************************************************************************/
+static void kes_numa_init(void)
+{
+    static unsigned char nodes[KES_NUMA_IDS];
+    static unsigned char cpus[CPU_SETSIZE];
+    char                 path[64];
+
+    memset( topo.index, -1, sizeof(topo.index) );
+    memset( topo.cpunode, -1, sizeof(topo.cpunode) );
+    topo.nnodes = 0;
+
+    if ( kes_numa_list( "/sys/devices/system/node/online", nodes,
+                        KES_NUMA_IDS ) < 2 )
+    {
+        return;
+    } // end if
+
+    for (int id = 0; id < KES_NUMA_IDS; id++)
+    {
+        snprintf( path, sizeof(path),
+                  "/sys/devices/system/node/node%d/cpulist", id );
+        memset( cpus, 0, sizeof(cpus) );
+        if ( !nodes[id] || !kes_numa_list( path, cpus, CPU_SETSIZE ) )
+        {
+            continue; // NOTE memory-only nodes stay unmapped
+        } // end if
+
+        /* first nodes get own indices, further ones are folded */
+        const int k = topo.nnodes % KES_NUMA_MAX;
+        if ( topo.nnodes < KES_NUMA_MAX )
+        {
+            CPU_ZERO( &topo.cpus[k] );
+        } // end if
+        topo.index[id] = (int16_t)k;
+        for (int c = 0; c < CPU_SETSIZE; c++)
+        {
+            if ( cpus[c] )
+            {
+                CPU_SET( c, &topo.cpus[k] );
+                topo.cpunode[c] = (int16_t)k;
+            } // end if
+        } // end for
+        ++topo.nnodes;
+    } // end for
+
+    if ( topo.nnodes > KES_NUMA_MAX )
+    {
+        topo.nnodes = KES_NUMA_MAX;
+    } // end if
+} // end kes_numa_init
+
+#endif
+
+/******************************************************************************/
+
+/*******************************************************************************
+ * FUNCTION    : kes_numa_enable
+ * DESCRIPTION : enable or disable the use of the memory nodes
+ * INPUT       : flag "enable"
+ * OUTPUT      : none
+ ******************************************************************************/
+void kes_numa_enable(const int enable)
+{
+    numa_enabled = enable;
+} // end kes_numa_enable
+
+/******************************************************************************/
+
+/*******************************************************************************
+ * FUNCTION    : kes_get_numa_nodes
+ * DESCRIPTION : return number of memory nodes used by the thread pool
+ * INPUT       : none
+ * OUTPUT      : number of nodes, 1 if disabled or not available
+ ******************************************************************************/
+int kes_get_numa_nodes(void)
+{
+#if KES_NUMA_LINUX
+    pthread_once( &topo_once, kes_numa_init );
+    return( (numa_enabled && (topo.nnodes > 1)) ? topo.nnodes : 1 );
+#else
+    return( 1 );
+#endif
+} // end kes_get_numa_nodes
+
+/******************************************************************************/
+
+/*******************************************************************************
+ * FUNCTION    : kes_numa_pin
+ * DESCRIPTION : pin the calling thread to the processors of a node, failures
+ *               (e.g. processors excluded by the cgroup) are ignored
+ * INPUT       : index of node
+ * OUTPUT      : none
+ ******************************************************************************/
+void kes_numa_pin(const int node)
+{
+#if KES_NUMA_LINUX
+    const int nnodes = kes_get_numa_nodes();
+    if ( (nnodes > 1) && (node >= 0) && (node < nnodes) )
+    {
+        pthread_setaffinity_np( pthread_self(), sizeof(cpu_set_t),
+                                &topo.cpus[node] );
+    } // end if
+#else
+    (void)node;
+#endif
+} // end kes_numa_pin
+
+/******************************************************************************/
+
+/*******************************************************************************
+ * FUNCTION    : kes_numa_self
+ * DESCRIPTION : node of the processor running the calling thread
+ * INPUT       : none
+ * OUTPUT      : index of node, 0 if unknown
+ ******************************************************************************/
+int kes_numa_self(void)
+{
+#if KES_NUMA_LINUX
+    const int cpu = ((kes_get_numa_nodes() > 1) ? sched_getcpu() : -1);
+    return( ((cpu >= 0) && (cpu < CPU_SETSIZE) && (topo.cpunode[cpu] >= 0)) ?
+            topo.cpunode[cpu] : 0 );
+#else
+    return( 0 );
+#endif
+} // end kes_numa_self
+
+/******************************************************************************/
+
+/*******************************************************************************
+ * FUNCTION    : kes_numa_home
+ * DESCRIPTION : home nodes of the pages of some addresses by move_pages(2)
+ *               without moving them
+ * INPUT       : number of addresses "count", array of addresses "addr"
+ * OUTPUT      : array of node indices "node", -1 for pages not yet touched
+ *               and failed queries
+ ******************************************************************************/
+void kes_numa_home(const size_t count, const void** addr, int* node)
+{
+#if KES_NUMA_LINUX
+    if ( (kes_get_numa_nodes() > 1) &&
+         (syscall( SYS_move_pages, 0, (unsigned long)count, addr, NULL,
+                   node, 0 ) == 0) )
+    {
+        for (size_t k = 0; k < count; k++)
+        {
+            node[k] = (((node[k] >= 0) && (node[k] < KES_NUMA_IDS)) ?
+                       topo.index[node[k]] : -1);
+        } // end for
+        return;
+    } // end if
+#else
+    (void)addr;
+#endif
+
+    for (size_t k = 0; k < count; k++)
+    {
+        node[k] = -1;
+    } // end for
+} // end kes_numa_home
+
+/******************************************************************************/
+
+/* slice of memory first-touched by one thread of kes_numa_alloc() */
+typedef struct
+{
+    unsigned char* ptr;  ///< start of slice
+    size_t         size; ///< number of bytes
+    int            node; ///< index of node
+} kes_numa_slice_t;
+
+/*******************************************************************************
+ * FUNCTION    : kes_numa_touch
+ * DESCRIPTION : thread function of kes_numa_alloc(), zeroes one slice on the
+ *               processors of its node
+ * INPUT       : pointer to structure of type kes_numa_slice_t
+ * OUTPUT      : NULL
+ ******************************************************************************/
+static void* kes_numa_touch(void* arg)
+{
+    const kes_numa_slice_t* s = arg;
+
+    kes_numa_pin( s->node );
+    memset( s->ptr, 0, s->size );
+
+    return( NULL );
+} // end kes_numa_touch
+
+/******************************************************************************/
+
+/*******************************************************************************
+ * FUNCTION    : kes_numa_alloc
+ * DESCRIPTION : allocate memory spread over all memory nodes by first touch
+ * INPUT       : number of bytes "size"
+ * OUTPUT      : pointer to zero-initialized memory, NULL if out of memory
+ * NOTE fresh pages come from mmap() on Linux, from the allocator of the
+ *      library otherwise
+ ******************************************************************************/
+void* kes_numa_alloc(const size_t size)
+{
+    const long   ps   = sysconf( _SC_PAGESIZE );
+    const size_t page = ((ps > 0) ? (size_t)ps : 4096);
+    const size_t len  = page + (size + page - 1) / page * page;
+
+    /* fresh pages with the length in front of the returned memory */
+#if KES_NUMA_LINUX
+    unsigned char* base = mmap( NULL, len, PROT_READ | PROT_WRITE,
+                                MAP_PRIVATE | MAP_ANONYMOUS, -1, 0 );
+    if ( base == MAP_FAILED )
+    {
+        return( NULL );
+    } // end if
+#else
+    kes_alloc_t    alloc;
+    unsigned char* base = kes_mem_calloc( &alloc, 1, len );
+    if ( base == NULL )
+    {
+        return( NULL );
+    } // end if
+    memcpy( base + sizeof(len), &alloc, sizeof(alloc) );
+#endif
+    memcpy( base, &len, sizeof(len) );
+
+    /* first touch of equal slices by one thread per node */
+    const int nnodes = kes_get_numa_nodes();
+    if ( nnodes > 1 )
+    {
+        kes_numa_slice_t slice[KES_NUMA_MAX];
+        pthread_t        thread[KES_NUMA_MAX];
+        int              started[KES_NUMA_MAX];
+        const size_t     npages = (len - page) / page;
+
+        for (int k = 0; k < nnodes; k++)
+        {
+            const size_t p0 = npages * (size_t)k / (size_t)nnodes;
+            const size_t p1 = npages * (size_t)(k + 1) / (size_t)nnodes;
+            slice[k].ptr  = base + page + p0 * page;
+            slice[k].size = (p1 - p0) * page;
+            slice[k].node = k;
+            started[k]    = !pthread_create( &thread[k], NULL,
+                                             kes_numa_touch, &slice[k] );
+            if ( !started[k] )
+            {
+                memset( slice[k].ptr, 0, slice[k].size ); // NOTE by caller
+            } // end if
+        } // end for
+        for (int k = 0; k < nnodes; k++)
+        {
+            if ( started[k] )
+            {
+                pthread_join( thread[k], NULL );
+            } // end if
+        } // end for
+    } // end if
+
+    return( base + page );
+} // end kes_numa_alloc
+
+/******************************************************************************/
+
+/*******************************************************************************
+ * FUNCTION    : kes_numa_free
+ * DESCRIPTION : release memory from kes_numa_alloc()
+ * INPUT       : pointer "ptr" from kes_numa_alloc() or NULL
+ * OUTPUT      : none
+ ******************************************************************************/
+void kes_numa_free(void* ptr)
+{
+    if ( ptr == NULL )
+    {
+        return;
+    } // end if
+
+    const long     ps   = sysconf( _SC_PAGESIZE );
+    unsigned char* base = (unsigned char*)ptr - ((ps > 0) ? ps : 4096);
+    size_t         len;
+    memcpy( &len, base, sizeof(len) );
+
+#if KES_NUMA_LINUX
+    munmap( base, len );
+#else
+    kes_alloc_t alloc;
+    memcpy( &alloc, base + sizeof(len), sizeof(alloc) );
+    kes_mem_free( &alloc, base, len );
+#endif
+} // end kes_numa_free
+
+/******************************************************************************/
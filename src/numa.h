@@ -0,0 +1,120 @@
+/***************************************************************************//**
+ * @file    numa.h
+ * @brief   memory domains of the thread pool on NUMA machines
+ * @author  Bazso Akos
+ * @version 2026.10
+ *
+ * @copyright
+ * Copyright (C) 2019 Bazso Akos
+ *
+ * This file is part of libkes.
+ *
+ * libkes is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * libkes is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with libkes.  If not, see <https://www.gnu.org/licenses/>.
+ *
+ ******************************************************************************/
+#pragma once
+#ifndef KES_NUMA__H
+#define KES_NUMA__H
+
+/* include standard headers */
+#include <stddef.h>
+
+/* include module headers */
+#include "error.h"
+
+/******************************************************************************/
+
+/*** declare macro constants ***/
+
+/* maximum number of memory nodes told apart, further nodes are folded */
+#define KES_NUMA_MAX    16
+
+/* number of elements per segment of a batch with the same home node */
+#define KES_NUMA_SEG    65536
+
+/******************************************************************************/
+
+/*** function declarations ***/
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/*!
+ * @brief get number of memory nodes used by the thread pool
+ * @return number of nodes with processors, 1 if NUMA-aware scheduling is
+ * disabled or not available
+ */
+int kes_get_numa_nodes(void);
+
+
+/*!
+ * @brief allocate memory for large batches spread over all memory nodes
+ * @details the memory is page-aligned and zero-initialized, and its pages
+ * are first-touched by threads on the nodes in contiguous slices of equal
+ * size, i.e. with arrays of ecc, ma and ea from this function each node
+ * holds the same range of all arrays and solves it without remote
+ * accesses; on machines with a single node this is a plain allocation
+ * @param[in] size number of bytes
+ * @return pointer to the memory, NULL if out of memory;
+ * release with kes_numa_free()
+ */
+void* kes_numa_alloc(const size_t size);
+
+
+/*!
+ * @brief release memory from kes_numa_alloc()
+ * @param[in] ptr pointer from kes_numa_alloc() (or NULL)
+ */
+void kes_numa_free(void* ptr);
+
+
+/*!
+ * @brief enable or disable the use of the memory nodes (internal use,
+ * see kes_set_numa())
+ * @param[in] enable 1 to enable, 0 to disable
+ */
+void kes_numa_enable(const int enable);
+
+
+/*!
+ * @brief pin the calling thread to the processors of a node (internal use)
+ * @param[in] node index of node, 0 <= node < kes_get_numa_nodes()
+ */
+void kes_numa_pin(const int node);
+
+
+/*!
+ * @brief node of the processor running the calling thread (internal use)
+ * @return index of node, 0 if unknown
+ */
+int kes_numa_self(void);
+
+
+/*!
+ * @brief home nodes of the pages of some addresses (internal use)
+ * @details pages not yet touched and failed queries give -1
+ * @param[in] count number of addresses
+ * @param[in] addr array of addresses
+ * @param[out] node array of node indices
+ */
+void kes_numa_home(const size_t count, const void** addr, int* node);
+
+#ifdef __cplusplus
+}
+#endif
+
+/******************************************************************************/
+
+#endif  /* KES_NUMA__H */
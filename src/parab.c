@@ -0,0 +1,327 @@
+/***************************************************************************//**
+ * @file    parab.c
+ * @brief   solvers for parabolic and near-parabolic Kepler Equation
+ * @details Barker's Equation of the parabolic case is solved in closed form;
+ *          for elliptic orbits close to the parabolic limit the iterations
+ *          use the same formulas as in module itercore.c, with the Kepler
+ *          Equation evaluated without cancellation for small E
+ * @author  Bazso Akos
+ * @version 2026.10
+ *
+ * @copyright
+ * Copyright (C) 2019 Bazso Akos
+ *
+ * This file is part of libkes.
+ *
+ * libkes is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * libkes is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with libkes.  If not, see <https://www.gnu.org/licenses/>.
+ *
+ ******************************************************************************/
+
+/* include standard headers */
+#include <math.h>
+#include <stdio.h>
+
+/* include module headers */
+#include "parab.h"
+#include "const.h"
+#include "hyperb.h"
+#include "trace.h"
+#include "vecmath.h"
+
+/******************************************************************************/
+
+/* use verbose debug output? 0 = no (default), 1 = yes */
+#define KES_PARAB_DEBUG 0
+
+/******************************************************************************/
+
+/* tiny increment to denominator, same as in module itercore.c */
+static const double addzero = 1.0e-19;
+
+/* fixed number of iterations selected by KES_FIX_AUTO for kes_stm_npar();
+ * worst case reaching KES_STD_TOL on a dense grid in
+ * KES_NEARPAR_ECC < ecc <= 1-1E-10, 0 <= ma <= pi plus one iteration as margin
+ * columns: order 2 (Newton-Raphson), 3 (Halley), 4 and 5 (Danby-Burkardt)
+ */
+static const int list_of_nparfix[4] = {5, 4, 3, 3};
+
+/******************************************************************************/
+
+/*******************************************************************************
+ *  FUNCTION    : kes_solve_par
+ *  DESCRIPTION : closed-form solution of Barker's Equation
+ *  INPUT       : mean anomaly "ma" (in radians)
+ *  OUTPUT      : true anomaly (in radians)
+ *  REFERENCE   : Cardano's formula for the cubic s^3 + 3*s - 3*M = 0
+ ******************************************************************************/
+double kes_solve_par(
+    const double ma
+    )
+{
+    /* cubic equation s^3 + 3*s - 2*q = 0 with q = 3*M/2,
+     * NOTE solve for |M| and apply symmetry s(-M) = -s(M)
+     */
+    const double q = 1.5 * fabs( ma );
+
+    /* NOTE avoid overflow of q^2 for huge mean anomalies */
+    double       w = ((q < 1E150) ? cbrt( q + sqrt(q * q + 1.0) ) :
+                                    cbrt( 2.0 * q ));
+
+    /* root s = w - 1/w without cancellation */
+    w *= w;
+    const double s = 2.0 * q / (w + 1.0 + 1.0 / w);
+
+    return( copysign( 2.0 * atan( s ), ma ) );
+} // end kes_solve_par
+
+/******************************************************************************/
+
+/*******************************************************************************
+ *  FUNCTION    : kes_npar_order
+ *  DESCRIPTION : order of iteration method used for near-parabolic case
+ *  INPUT       : solver method "iter" from enum kes_sol_e
+ *  OUTPUT      : order of iteration method (2 <= order <= 5), or 0
+ ******************************************************************************/
+int kes_npar_order(
+    const kes_sol_e iter
+    )
+{
+    switch ( iter )
+    {
+        /* methods without excessive iteration counts keep their solver */
+        case KES_SOL_BISECT:
+        case KES_SOL_BRENT:
+        case KES_SOL_FUKUSH:
+        case KES_SOL_EKS:
+        case KES_SOL_MARKLEY:
+        case KES_SOL_MIKKOLA:
+        case KES_SOL_NIJENH:
+            return( 0 );
+
+        default:
+            /* exception: invalid solver method */
+            if ( (iter <= KES_SOL_NONE) || (iter >= KES_SOL_TOTAL) )
+            {
+                return( 0 );
+            } // end if
+            return( kes_hyp_order( iter ) );
+    } // end switch
+} // end kes_npar_order
+
+/******************************************************************************/
+
+/*******************************************************************************
+ *  FUNCTION    : kes_stm_npar
+ *  DESCRIPTION : starter for near-parabolic elliptic Kepler Equation
+ *  INPUT       : - eccentricity "ecc"
+ *                - reduced mean anomaly "ma" (0 <= ma <= pi)
+ *  OUTPUT      : starting value
+ ******************************************************************************/
+double kes_stm_npar(
+    const double ecc,
+    const double ma
+    )
+{
+    /* cubic equation E^3 + 3*p*E - 2*q = 0 from the series
+     * E - e*sin(E) = (1-e)*E + e*E^3/6 + O(E^5)
+     */
+    const double p = 2.0 * (1.0 - ecc) / ecc;
+    const double q = 3.0 * ma / ecc;
+    double       s = cbrt( q + sqrt(q * q + p * p * p) );
+
+    /* root E = s - p/s without cancellation */
+    s *= s;
+    const double x = 2.0 * q / (s + p + p * p / s);
+
+    /* keep starter within bounds M <= E <= pi */
+    return( (x < ma) ? ma : ((x > M_PI) ? M_PI : x) );
+} // end kes_stm_npar
+
+/******************************************************************************/
+
+/*******************************************************************************
+ *  FUNCTION    : kes_npar_fixiter
+ *  DESCRIPTION : resolve fixed number of iterations for near-parabolic case
+ *  INPUT       : - "order" of iteration method (2 <= order <= 5)
+ *                - user defined value "fixiter"
+ *  OUTPUT      : number of iterations (0 = iterate until convergence)
+ ******************************************************************************/
+int kes_npar_fixiter(
+    const int order,
+    const int fixiter
+    )
+{
+    return( (fixiter != KES_FIX_AUTO) ? fixiter : list_of_nparfix[order - 2] );
+} // end kes_npar_fixiter
+
+/******************************************************************************/
+
+/*** REFERENCE : Danby & Burkardt (1983), Celestial Mechanics 31, p.95-107 ***/
+
+/*******************************************************************************
+ *  FUNCTION    : kes_npar_core
+ *  DESCRIPTION : iteration methods of order 2 to 5 for near-parabolic case
+ *  INPUT       : - order of iteration method (2 <= order <= 5)
+ *                - eccentricity "ecc"
+ *                - reduced mean anomaly "ma"
+ *                - old value of iteration variable "x0"
+ *  OUTPUT      : update to iteration variable x0+dx
+ ******************************************************************************/
+static inline double kes_npar_core(
+    const int    order,
+    const double ecc,
+    const double ma,
+    const double x0
+    )
+{
+    double sm, cm; /* x - sin(x), 1 - cos(x) */
+    double dx;     /* increment deltax */
+
+    /* calculate sin, cos */
+    kes_vec_sincosm( &sm, &cm, x0 );
+    const double e1  = 1.0 - ecc;
+    const double esx = ecc * (x0 - sm);
+    const double ecx = ecc * (1.0 - cm);
+
+    /* evaluate Kepler Equation: 0th and 1st derivative,
+     * NOTE x - e*sin(x) = (1-e)*x + e*(x-sin(x)) and
+     *      1 - e*cos(x) = (1-e) + e*(1-cos(x)) avoid cancellation
+     */
+    const double f0 = ma - e1 * x0 - ecc * sm;
+    const double f1 = e1 + ecc * cm + addzero;
+
+    /* delta1: eq. (16) */
+    dx = f0 / f1;
+
+    if ( order >= 3 )
+    {
+        /* delta2: eq. (17) */
+        const double f2 = esx / 2.0;
+        dx = f0 / (f1 + dx * f2);
+
+        if ( order >= 4 )
+        {
+            /* delta3: eq. (18) */
+            const double f3 = ecx / 6.0;
+            dx = f0 / (f1 + dx * (f2 + dx * f3));
+
+            if ( order >= 5 )
+            {
+                /* delta4: eq. (19) */
+                const double f4 = -esx / 24.0;
+                dx = f0 / (f1 + dx * (f2 + dx * (f3 + dx * f4)));
+            } // end if
+        } // end if
+    } // end if
+
+    return( x0 + dx );
+} // end kes_npar_core
+
+/******************************************************************************/
+
+/*******************************************************************************
+ *  FUNCTION    : kes_npariter
+ *  DESCRIPTION : iterative solver for near-parabolic elliptic Kepler Equation
+ *  INPUT       : - "order" of iteration method (2 <= order <= 5)
+ *                - eccentricity "ecc"
+ *                - reduced mean anomaly "ma" (0 <= ma <= pi)
+ *                - "starter" value for first iteration
+ *                - pointer "data" for results
+ *  OUTPUT      : number of iterations
+ ******************************************************************************/
+int kes_npariter(
+    const int    order,
+    const double ecc,
+    const double ma,
+    const double starter,
+    kes_input_t* data
+    )
+{
+    register int count = 0;      /* iteration counter */
+    double       deltax, deltaf; /* error residuals */
+    double       xnew, xold, fx; /* iteration variables */
+    double       sm, cm;         /* x - sin(x), 1 - cos(x) */
+
+    /* correction factor for absolute error deltaf */
+    const double corr = ecc / (1.0 - ecc);
+
+    /* reset error residuals */
+    deltax = deltaf = 0.0;
+    data->nbrSinEval = data->nbrCosEval = data->nbrFktEval = 0;
+
+    /* use starter for initializing iteration */
+    xnew = starter;
+
+    /* trace iteration process? */
+    const kes_sol_e solver = kes_hyp_solver( order );
+    const int       trace  = kes_trace_begin();
+    kes_trace_step( trace, solver, 0, ecc, ma, starter, 0.0, 0.0 );
+
+    /* fixed number of iterations without evaluation of residuals */
+    if ( data->fixiter > 0 )
+    {
+        do
+        {
+            xold = xnew;
+            xnew = kes_npar_core( order, ecc, ma, xold );
+            ++(data->nbrSinEval); ++(data->nbrCosEval); ++(data->nbrFktEval);
+            ++count;
+        } while ( count < data->fixiter ); // end do
+
+        /* results */
+        data->result = xnew;
+        data->errDF  = 0.0;
+        data->errDX  = fabs(xnew - xold);
+
+        return( count );
+    } // end if
+
+    /* main iteration loop */
+    do
+    {
+        xold = xnew;
+        xnew = kes_npar_core( order, ecc, ma, xold );
+        ++(data->nbrSinEval); ++(data->nbrCosEval); ++(data->nbrFktEval);
+
+        /* evaluate Kepler Equation without cancellation */
+        kes_vec_sincosm( &sm, &cm, xnew );
+        fx   = (1.0 - ecc) * xnew + ecc * sm - ma;
+        ++(data->nbrSinEval); ++(data->nbrFktEval);
+
+        ++count;
+
+        /* update error residuals */
+        deltax = fabs(xnew - xold);
+        deltaf = fabs(fx) * corr;
+
+        kes_trace_step( trace, solver, count, ecc, ma, xnew, deltax, deltaf );
+#if KES_PARAB_DEBUG
+    fprintf(stdout, "%s: count = %d, deltax = %g, deltaf = %g\n",
+            __func__, count, deltax, deltaf);
+#endif
+    } while (
+        (deltax > data->tolx) &&
+        (deltaf > data->tolf) &&
+        (count  < data->maxiter)
+    ); // end do
+
+    /* results */
+    data->result = xnew;
+    data->errDF  = deltaf;
+    data->errDX  = deltax;
+
+    return( count );
+} // end kes_npariter
+
+/******************************************************************************/
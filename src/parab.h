@@ -0,0 +1,106 @@
+/***************************************************************************//**
+ * @file    parab.h
+ * @brief   solvers for parabolic and near-parabolic Kepler Equation
+ * @author  Bazso Akos
+ * @version 2026.10
+ *
+ * @copyright
+ * Copyright (C) 2019 Bazso Akos
+ *
+ * This file is part of libkes.
+ *
+ * libkes is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * libkes is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with libkes.  If not, see <https://www.gnu.org/licenses/>.
+ *
+ ******************************************************************************/
+#pragma once
+#ifndef KES_PARAB__H
+#define KES_PARAB__H
+
+/* include module headers */
+#include "input.h"
+#include "solver.h"
+
+/******************************************************************************/
+
+/*** declare functions ***/
+
+/*!
+ * @brief closed-form solution of Barker's Equation s + s^3/3 = M
+ * @details s = tan(v/2), solution of the cubic by Cardano's formula
+ * @param[in] ma mean anomaly (in radians)
+ * @return true anomaly v (in radians, -pi < v < pi)
+ */
+double kes_solve_par(
+    const double ma
+);
+
+/*!
+ * @brief order of the iteration method used for the near-parabolic case
+ * @details same order as in the hyperbolic case (see kes_hyp_order()),
+ * 0 for methods which keep their own elliptic solver (bisection,
+ * Markley's, Mikkola's and Nijenhuis' method) and invalid methods
+ * @param[in] iter solver method from enum kes_sol_e
+ * @return order of iteration method (2 <= order <= 5), or 0
+ */
+int kes_npar_order(
+    const kes_sol_e iter
+);
+
+/*!
+ * @brief starter for near-parabolic elliptic Kepler Equation
+ * @details solution of the cubic approximation (1-e)*E + e*E^3/6 = M,
+ * limited to the range M <= E <= pi
+ * @param[in] ecc eccentricity (KES_NEARPAR_ECC < ecc < 1)
+ * @param[in] ma reduced mean anomaly (0 <= ma <= pi)
+ * @return starting value E0
+ */
+double kes_stm_npar(
+    const double ecc,
+    const double ma
+);
+
+/*!
+ * @brief resolve fixed number of iterations for the near-parabolic case
+ * @param[in] order order of iteration method (2 <= order <= 5)
+ * @param[in] fixiter user defined value (0, > 0, or KES_FIX_AUTO)
+ * @return number of iterations (0 = iterate until convergence)
+ */
+int kes_npar_fixiter(
+    const int order,
+    const int fixiter
+);
+
+/*!
+ * @brief iterative solver for near-parabolic elliptic Kepler Equation
+ * @details same stopping criteria as the elliptic solvers, the Kepler
+ * Equation is evaluated as (1-e)*E + e*(E - sin(E)) - M without
+ * cancellation for small E; solution stored in data->result
+ * @param[in] order order of iteration method (2 <= order <= 5)
+ * @param[in] ecc eccentricity (KES_NEARPAR_ECC < ecc < 1)
+ * @param[in] ma reduced mean anomaly (0 <= ma <= pi)
+ * @param[in] starter starting value for first iteration
+ * @param[in,out] data pointer to input parameters and results
+ * @return number of iterations
+ */
+int kes_npariter(
+    const int    order,
+    const double ecc,
+    const double ma,
+    const double starter,
+    kes_input_t* data
+);
+
+/******************************************************************************/
+
+#endif  /* KES_PARAB__H */
@@ -0,0 +1,1001 @@
+/***************************************************************************//**
+ * @file    pool.c
+ * @brief   thread pool and multithreaded batch solver function
+ * @details worker threads are created on first use and kept alive between
+ *          calls; work items of "chunk" elements are fetched dynamically
+ *          from a shared counter, so that threads finishing early (e.g. for
+ *          near-circular orbits) continue with the remaining elements;
+ *          jobs of kesolver_batch_mt() and kes_submit() wait in a common
+ *          queue and are solved in the order of submission
+ * @author  Bazso Akos
+ * @version 2026.10
+ *
+ * @copyright
+ * Copyright (C) 2019 Bazso Akos
+ *
+ * This file is part of libkes.
+ *
+ * libkes is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * libkes is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with libkes.  If not, see <https://www.gnu.org/licenses/>.
+ *
+ ******************************************************************************/
+/* POSIX threads and sysconf() */
+#define _POSIX_C_SOURCE 200809L
+
+/* include standard headers */
+#include <pthread.h>
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <unistd.h>
+
+/* include module headers */
+#include "pool.h"
+#include "alloc.h"
+#include "numa.h"
+
+/******************************************************************************/
+
+/* use verbose debug output? 0 = no (default), 1 = yes */
+#define KES_POOL_DEBUG 0
+
+/* max. number of segments of kesolver_batch_mt() kept on the stack, i.e.
+ * batches up to 64 * KES_NUMA_SEG elements need no heap
+ */
+#define KES_POOL_STACKSEG 64
+
+/* bytes of workspace per segment: next, address, node and home of it */
+#define KES_POOL_SEGBYTES (sizeof(size_t) + sizeof(void*) + sizeof(int) + 1)
+
+/******************************************************************************/
+
+/* structure describing one call of kesolver_batch_mt() or kes_submit() */
+struct kes_job_s
+{
+    /* arguments of kesolver_batch(), "data" points to "input" if given */
+    kes_batch_t        batch;
+    kes_input_t        input;
+
+    /* completion, called by the thread that finishes the last work item */
+    kes_callback_t     callback;
+    void*              arg;
+
+    /* task of kes_pool_run() instead of kesolver_batch() (or NULL) */
+    kes_task_t         task;
+    void*              targ;
+
+    /* scheduling and results, protected by pool lock */
+    size_t             next;     ///< first element of next work item
+    size_t             chunk;    ///< number of elements per work item
+    size_t             solved;   ///< number of elements already solved
+    size_t             errpos;   ///< first element of first failing work item
+    kes_err_e          err;      ///< error code of first failing work item
+    int                complete; ///< all elements solved, callback returned
+    struct kes_job_s*  link;     ///< next job in queue of pool
+
+    /* segments by home node on NUMA machines (seghome = NULL otherwise),
+     * protected by pool lock
+     */
+    unsigned char*     seghome;  ///< index of home node of each segment
+    size_t*            segnext;  ///< first unclaimed element of each segment
+    size_t             nseg;     ///< number of segments
+    size_t             seglen;   ///< number of elements per segment
+    size_t             left;     ///< number of unclaimed elements
+    int                nnodes;   ///< number of nodes
+    size_t             cursor[KES_NUMA_MAX]; ///< first segment with work
+                                             ///< of each node
+
+    /* memory of the job and its segments */
+    int                ownseg;   ///< segments allocated, not in workspace
+    int                ownjob;   ///< job allocated by kes_submit()
+    kes_alloc_t        segalloc; ///< allocator of the segments
+    kes_alloc_t        joballoc; ///< allocator of the job
+};
+
+/* structure of the thread pool */
+typedef struct
+{
+    pthread_mutex_t lock;       ///< protects all following members
+    pthread_cond_t  wake;       ///< signals new job or shutdown to workers
+    pthread_cond_t  done;       ///< signals completed jobs to waiting callers
+    pthread_t*      threads;    ///< worker threads
+    int             nslots;     ///< number of allocated thread handles
+    kes_alloc_t     talloc;     ///< allocator of the thread handles
+    int             nworkers;   ///< number of running worker threads
+    int             quit;       ///< request workers to terminate
+    kes_job_t*      head;       ///< first job with unsolved work items
+    kes_job_t*      tail;       ///< last job with unsolved work items
+} kes_pool_t;
+
+/* global thread pool, started on first use */
+static kes_pool_t pool = {
+    .lock       = PTHREAD_MUTEX_INITIALIZER,
+    .wake       = PTHREAD_COND_INITIALIZER,
+    .done       = PTHREAD_COND_INITIALIZER,
+    .threads    = NULL,
+    .nslots     = 0,
+    .nworkers   = 0,
+    .quit       = 0,
+    .head       = NULL,
+    .tail       = NULL
+};
+
+/* serializes submission of jobs and pool (re-)configuration */
+static pthread_mutex_t pool_call = PTHREAD_MUTEX_INITIALIZER;
+
+/* user settings: number of threads (0 = online processors), chunk size */
+static int    pool_threads = 0;
+static size_t pool_chunk   = KES_STD_CHUNK;
+
+/******************************************************************************/
+
+/*******************************************************************************
+ * FUNCTION    : kes_pool_unlink
+ * DESCRIPTION : remove a job without remaining work items from the queue,
+ *               it need not be the first one (caller holds pool lock)
+ * INPUT       : pointer "job" to structure of type kes_job_t
+ * OUTPUT      : none
+ ******************************************************************************/
+static void kes_pool_unlink(kes_job_t* job)
+{
+    kes_job_t* prev = NULL;
+    for (kes_job_t* q = pool.head; q != NULL; q = q->link)
+    {
+        if ( q == job )
+        {
+            if ( prev == NULL )
+            {
+                pool.head = q->link;
+            }
+            else
+            {
+                prev->link = q->link;
+            } // end if
+            if ( pool.tail == q )
+            {
+                pool.tail = prev;
+            } // end if
+            break;
+        } // end if
+        prev = q;
+    } // end for
+    job->link = NULL;
+} // end kes_pool_unlink
+
+/******************************************************************************/
+
+/*******************************************************************************
+ * FUNCTION    : kes_pool_claim
+ * DESCRIPTION : take the next work item of a job, a job without remaining
+ *               work items is removed from the queue (caller holds pool lock);
+ *               with segments by home node the work items of the node of the
+ *               caller come first, then those of the following nodes
+ * INPUT       : pointer "job" to structure of type kes_job_t, index of node
+ *               "node" of the calling thread
+ * OUTPUT      : first element "i0" and number of elements of work item
+ ******************************************************************************/
+static size_t kes_pool_claim(kes_job_t* job, size_t* i0, const int node)
+{
+    const size_t n = job->batch.n;
+
+    if ( job->seghome == NULL )
+    {
+        const size_t cnt = ((n - job->next > job->chunk) ? job->chunk :
+                            n - job->next);
+
+        *i0        = job->next;
+        job->next += cnt;
+
+        if ( (job->next == n) && (cnt > 0) )
+        {
+            kes_pool_unlink( job );
+        } // end if
+
+        return( cnt );
+    } // end if
+
+    for (int d = 0; (d < job->nnodes) && (job->left > 0); d++)
+    {
+        const int k = (node + d) % job->nnodes;
+
+        /* first segment of node k with unclaimed elements */
+        size_t seg = job->cursor[k];
+        while ( (seg < job->nseg) &&
+                ((job->seghome[seg] != k) ||
+                 (job->segnext[seg] == ((seg + 1 < job->nseg) ?
+                                        (seg + 1) * job->seglen : n))) )
+        {
+            ++seg;
+        } // end while
+        job->cursor[k] = seg;
+
+        if ( seg < job->nseg )
+        {
+            const size_t end = ((seg + 1 < job->nseg) ?
+                                (seg + 1) * job->seglen : n);
+            const size_t cnt = ((end - job->segnext[seg] > job->chunk) ?
+                                job->chunk : end - job->segnext[seg]);
+
+            *i0                = job->segnext[seg];
+            job->segnext[seg] += cnt;
+            job->left         -= cnt;
+
+            if ( job->left == 0 )
+            {
+                kes_pool_unlink( job );
+            } // end if
+
+            return( cnt );
+        } // end if
+    } // end for
+
+    *i0 = n;
+    return( 0 );
+} // end kes_pool_claim
+
+/******************************************************************************/
+
+/*******************************************************************************
+ * FUNCTION    : kes_pool_solve
+ * DESCRIPTION : solve one work item of a job and account for it; the thread
+ *               solving the last elements runs the callback and marks the
+ *               job complete (caller holds pool lock, released meanwhile)
+ * INPUT       : pointer "job" to structure of type kes_job_t, work item
+ * OUTPUT      : none
+ ******************************************************************************/
+static void kes_pool_solve(kes_job_t* job, const size_t i0, const size_t cnt)
+{
+    const kes_batch_t* b = &job->batch;
+
+    pthread_mutex_unlock( &pool.lock );
+
+    const kes_err_e err = ((job->task != NULL) ?
+                           job->task( job->targ, i0, cnt ) :
+                           kesolver_batch(
+        cnt, b->ecc + i0 * b->incecc, b->incecc, b->ma + i0, b->ea + i0,
+        b->init, b->iter, b->data,
+        ((b->status     != NULL) ? b->status     + i0 : NULL),
+        ((b->iterations != NULL) ? b->iterations + i0 : NULL)
+    ));
+
+    pthread_mutex_lock( &pool.lock );
+
+    /* remember error of first failing work item */
+    if ( (err != KES_ERR_NOERR) && (i0 < job->errpos) )
+    {
+        job->errpos = i0;
+        job->err    = err;
+    } // end if
+
+    job->solved += cnt;
+    if ( job->solved == b->n )
+    {
+        if ( job->callback != NULL )
+        {
+            pthread_mutex_unlock( &pool.lock );
+            job->callback( b, job->err, job->arg );
+            pthread_mutex_lock( &pool.lock );
+        } // end if
+        job->complete = 1;
+        pthread_cond_broadcast( &pool.done );
+    } // end if
+} // end kes_pool_solve
+
+/******************************************************************************/
+
+/*******************************************************************************
+ * FUNCTION    : kes_pool_worker
+ * DESCRIPTION : main function of worker threads, solves work items of the
+ *               first job in the queue; on shutdown the queue is drained
+ * INPUT       : index of node of the worker, cast to a pointer
+ * OUTPUT      : NULL
+ ******************************************************************************/
+static void* kes_pool_worker(void* arg)
+{
+    const int node = (int)(intptr_t)arg;
+
+    kes_numa_pin( node );
+
+    pthread_mutex_lock( &pool.lock );
+
+    for (;;)
+    {
+        /* wait for new job or shutdown */
+        while ( !pool.quit && (pool.head == NULL) )
+        {
+            pthread_cond_wait( &pool.wake, &pool.lock );
+        } // end while
+
+        if ( pool.head == NULL )
+        {
+            break;
+        } // end if
+
+        kes_job_t*   job = pool.head;
+        size_t       i0  = 0;
+        const size_t cnt = kes_pool_claim( job, &i0, node );
+        kes_pool_solve( job, i0, cnt );
+    } // end for
+
+    pthread_mutex_unlock( &pool.lock );
+
+    return( NULL );
+} // end kes_pool_worker
+
+/******************************************************************************/
+
+/*******************************************************************************
+ * FUNCTION    : kes_pool_stop
+ * DESCRIPTION : terminate and join all worker threads after the queued jobs
+ *               are solved (caller holds pool_call)
+ * INPUT       : none
+ * OUTPUT      : none
+ ******************************************************************************/
+static void kes_pool_stop(void)
+{
+    pthread_mutex_lock( &pool.lock );
+    pool.quit = 1;
+    pthread_cond_broadcast( &pool.wake );
+    pthread_mutex_unlock( &pool.lock );
+
+    for (int t = 0; t < pool.nworkers; t++)
+    {
+        pthread_join( pool.threads[t], NULL );
+    } // end for
+
+    kes_mem_free( &pool.talloc, pool.threads,
+                  (size_t)pool.nslots * sizeof(pthread_t) );
+    pool.threads  = NULL;
+    pool.nslots   = 0;
+    pool.nworkers = 0;
+    pool.quit     = 0;
+} // end kes_pool_stop
+
+/******************************************************************************/
+
+/*******************************************************************************
+ * FUNCTION    : kes_pool_start
+ * DESCRIPTION : start worker threads if not yet running (caller holds
+ *               pool_call); on failure the pool runs with fewer workers
+ * INPUT       : minimum number of worker threads "minworkers" (1 for
+ *               asynchronous jobs, even if only one thread is configured)
+ * OUTPUT      : number of running worker threads
+ ******************************************************************************/
+static int kes_pool_start(const int minworkers)
+{
+    const int nthreads = kes_get_threads();
+    const int nworkers = ((nthreads - 1 > minworkers) ? nthreads - 1 :
+                          minworkers);
+
+    if ( (pool.threads != NULL) || (nworkers < 1) )
+    {
+        return( pool.nworkers );
+    } // end if
+
+    pool.threads = kes_mem_alloc( &pool.talloc,
+                                  (size_t)nworkers * sizeof(pthread_t) );
+    if ( pool.threads == NULL )
+    {
+        return( 0 );
+    } // end if
+    pool.nslots = nworkers;
+
+    /* workers are assigned to the memory nodes in turn */
+    const int nnodes = kes_get_numa_nodes();
+    for (int t = 0; t < nworkers; t++)
+    {
+        if ( pthread_create( &pool.threads[t], NULL, kes_pool_worker,
+                             (void*)(intptr_t)(t % nnodes) ) )
+        {
+#if KES_POOL_DEBUG
+    fprintf( stderr, "%s: could only start %d worker threads\n", __func__, t );
+#endif
+            break;
+        } // end if
+        ++pool.nworkers;
+    } // end for
+
+    return( pool.nworkers );
+} // end kes_pool_start
+
+/******************************************************************************/
+
+/*******************************************************************************
+ * FUNCTION    : kes_pool_segments
+ * DESCRIPTION : split a large job into segments by the home node of the
+ *               pages of its mean anomalies, segments in pages not yet
+ *               touched are assigned to the nodes in equal contiguous ranges;
+ *               small jobs, tasks, single nodes and failures keep
+ *               seghome = NULL
+ * INPUT       : pointer "job" to structure of type kes_job_t, workspace "ws"
+ *               of kes_pool_wssize() bytes (or NULL to allocate)
+ * OUTPUT      : none
+ ******************************************************************************/
+static void kes_pool_segments(kes_job_t* job, unsigned char* ws)
+{
+    const size_t n      = job->batch.n;
+    const int    nnodes = kes_get_numa_nodes();
+    if ( (nnodes < 2) || (n < 2 * KES_NUMA_SEG) || (job->task != NULL) )
+    {
+        return;
+    } // end if
+
+    /* segments of whole work items */
+    const size_t seglen = (KES_NUMA_SEG + job->chunk - 1) / job->chunk *
+                          job->chunk;
+    const size_t nseg   = (n + seglen - 1) / seglen;
+
+    /* NOTE arrays by decreasing alignment, all in one block */
+    if ( ws == NULL )
+    {
+        ws = kes_mem_alloc( &job->segalloc, nseg * KES_POOL_SEGBYTES );
+        if ( ws == NULL )
+        {
+            return;
+        } // end if
+        job->ownseg = 1;
+    } // end if
+    size_t*        next = (size_t*)ws;
+    const void**   addr = (const void**)(next + nseg);
+    int*           node = (int*)(addr + nseg);
+    unsigned char* home = (unsigned char*)(node + nseg);
+
+    for (size_t seg = 0; seg < nseg; seg++)
+    {
+        addr[seg] = job->batch.ma + seg * seglen;
+    } // end for
+    kes_numa_home( nseg, addr, node );
+
+    for (size_t seg = 0; seg < nseg; seg++)
+    {
+        home[seg] = (unsigned char)(((node[seg] >= 0) && (node[seg] < nnodes)) ?
+                                    node[seg] :
+                                    (int)(seg * (size_t)nnodes / nseg));
+        next[seg] = seg * seglen;
+    } // end for
+
+    job->seghome = home;
+    job->segnext = next;
+    job->nseg    = nseg;
+    job->seglen  = seglen;
+    job->left    = n;
+    job->nnodes  = nnodes;
+    for (int k = 0; k < KES_NUMA_MAX; k++)
+    {
+        job->cursor[k] = 0;
+    } // end for
+} // end kes_pool_segments
+
+/******************************************************************************/
+
+/*******************************************************************************
+ * FUNCTION    : kes_pool_wssize
+ * DESCRIPTION : workspace size of the segments of a job, independent of the
+ *               chunk size and the number of nodes
+ * INPUT       : number of elements "n"
+ * OUTPUT      : number of bytes (0 for jobs without segments)
+ ******************************************************************************/
+static size_t kes_pool_wssize(const size_t n)
+{
+    /* NOTE segments have at least KES_NUMA_SEG elements */
+    return( (n < 2 * KES_NUMA_SEG) ? 0 :
+            (n + KES_NUMA_SEG - 1) / KES_NUMA_SEG * KES_POOL_SEGBYTES );
+} // end kes_pool_wssize
+
+/******************************************************************************/
+
+/*******************************************************************************
+ * FUNCTION    : kes_pool_release
+ * DESCRIPTION : release the segments of a completed job and the job itself
+ *               if allocated
+ * INPUT       : pointer "job" to structure of type kes_job_t
+ * OUTPUT      : none
+ ******************************************************************************/
+static void kes_pool_release(kes_job_t* job)
+{
+    if ( job->ownseg )
+    {
+        kes_mem_free( &job->segalloc, job->segnext,
+                      job->nseg * KES_POOL_SEGBYTES );
+    } // end if
+
+    if ( job->ownjob )
+    {
+        const kes_alloc_t alloc = job->joballoc;
+        kes_mem_free( &alloc, job, sizeof(kes_job_t) );
+    } // end if
+} // end kes_pool_release
+
+/******************************************************************************/
+
+/*******************************************************************************
+ * FUNCTION    : kes_pool_enqueue
+ * DESCRIPTION : initialize a job and append it to the queue of the pool,
+ *               starting the pool if necessary; the task of the job must be
+ *               set before, work items of tasks hold a single element
+ * INPUT       : job, batch, callback and its argument, minimum number of
+ *               worker threads, workspace "ws" for the segments (or NULL)
+ * OUTPUT      : number of running worker threads; without workers the job
+ *               is initialized but not queued
+ ******************************************************************************/
+static int kes_pool_enqueue(
+    kes_job_t*         job,
+    const kes_batch_t* batch,
+    kes_callback_t     callback,
+    void*              arg,
+    const int          minworkers,
+    unsigned char*     ws
+    )
+{
+    job->batch    = *batch;
+    job->callback = callback;
+    job->arg      = arg;
+    job->next     = 0;
+    job->solved   = 0;
+    job->errpos   = batch->n;
+    job->err      = KES_ERR_NOERR;
+    job->complete = 0;
+    job->link     = NULL;
+    job->seghome  = NULL;
+    job->segnext  = NULL;
+    job->ownseg   = 0;
+
+    /* keep a copy of the input parameters, the caller's may go away */
+    if ( batch->data != NULL )
+    {
+        job->input      = *batch->data;
+        job->batch.data = &job->input;
+    } // end if
+
+    pthread_mutex_lock( &pool_call );
+    job->chunk = ((job->task != NULL) ? 1 : pool_chunk);
+    const int nworkers = kes_pool_start( minworkers );
+    if ( nworkers > 0 )
+    {
+        kes_pool_segments( job, ws );
+
+        pthread_mutex_lock( &pool.lock );
+        if ( pool.tail == NULL )
+        {
+            pool.head = job;
+        }
+        else
+        {
+            pool.tail->link = job;
+        } // end if
+        pool.tail = job;
+        pthread_cond_broadcast( &pool.wake );
+        pthread_mutex_unlock( &pool.lock );
+    } // end if
+    pthread_mutex_unlock( &pool_call );
+
+    return( nworkers );
+} // end kes_pool_enqueue
+
+/******************************************************************************/
+
+/*******************************************************************************
+ * FUNCTION    : kes_set_threads
+ * DESCRIPTION : set number of threads, running pool is stopped
+ * INPUT       : number of threads "nthreads" (0 = online processors)
+ * OUTPUT      : error code from kes_err_e
+ ******************************************************************************/
+kes_err_e kes_set_threads(const int nthreads)
+{
+    /* check input value to be a suitable number */
+    if ( nthreads < 0 )
+    {
+        return( KES_ERR_BADVAL );
+    } // end if
+
+    pthread_mutex_lock( &pool_call );
+    if ( pool.threads != NULL )
+    {
+        kes_pool_stop();
+    } // end if
+    pool_threads = nthreads;
+    pthread_mutex_unlock( &pool_call );
+
+    return( KES_ERR_NOERR );
+} // end kes_set_threads
+
+/******************************************************************************/
+
+/*******************************************************************************
+ * FUNCTION    : kes_get_threads
+ * DESCRIPTION : return number of threads used by kesolver_batch_mt()
+ * INPUT       : none
+ * OUTPUT      : number of threads including the calling thread
+ ******************************************************************************/
+int kes_get_threads(void)
+{
+    if ( pool_threads > 0 )
+    {
+        return( pool_threads );
+    } // end if
+
+    const long ncpu = sysconf( _SC_NPROCESSORS_ONLN );
+
+    return( (ncpu > 0) ? (int)ncpu : 1 );
+} // end kes_get_threads
+
+/******************************************************************************/
+
+/*******************************************************************************
+ * FUNCTION    : kes_set_chunk
+ * DESCRIPTION : set number of elements per work item
+ * INPUT       : number of elements "chunk" (0 = default)
+ * OUTPUT      : error code from kes_err_e
+ ******************************************************************************/
+kes_err_e kes_set_chunk(const size_t chunk)
+{
+    pthread_mutex_lock( &pool_call );
+    pool_chunk = ((chunk > 0) ? chunk : KES_STD_CHUNK);
+    pthread_mutex_unlock( &pool_call );
+
+    return( KES_ERR_NOERR );
+} // end kes_set_chunk
+
+/******************************************************************************/
+
+/*******************************************************************************
+ * FUNCTION    : kes_get_chunk
+ * DESCRIPTION : return number of elements per work item
+ * INPUT       : none
+ * OUTPUT      : number of elements per work item
+ ******************************************************************************/
+size_t kes_get_chunk(void)
+{
+    return( pool_chunk );
+} // end kes_get_chunk
+
+/******************************************************************************/
+
+/*******************************************************************************
+ * FUNCTION    : kes_set_numa
+ * DESCRIPTION : enable or disable NUMA-aware scheduling, running pool is
+ *               stopped
+ * INPUT       : flag "enable" (0 or 1)
+ * OUTPUT      : error code from kes_err_e
+ ******************************************************************************/
+kes_err_e kes_set_numa(const int enable)
+{
+    if ( (enable != 0) && (enable != 1) )
+    {
+        return( KES_ERR_BADVAL );
+    } // end if
+
+    pthread_mutex_lock( &pool_call );
+    if ( pool.threads != NULL )
+    {
+        kes_pool_stop();
+    } // end if
+    kes_numa_enable( enable );
+    pthread_mutex_unlock( &pool_call );
+
+    return( KES_ERR_NOERR );
+} // end kes_set_numa
+
+/******************************************************************************/
+
+/*******************************************************************************
+ * FUNCTION    : kes_pool_free
+ * DESCRIPTION : stop all worker threads of the thread pool
+ * INPUT       : none
+ * OUTPUT      : none
+ ******************************************************************************/
+void kes_pool_free(void)
+{
+    pthread_mutex_lock( &pool_call );
+    if ( pool.threads != NULL )
+    {
+        kes_pool_stop();
+    } // end if
+    pthread_mutex_unlock( &pool_call );
+} // end kes_pool_free
+
+/******************************************************************************/
+
+/*******************************************************************************
+ *  FUNCTION    : kesolver_batch_mt
+ *  DESCRIPTION : multithreaded batch solver function for Kepler Equation
+ *  INPUT       : same as kesolver_batch()
+ *  OUTPUT      : KES_ERR_NOERR if all elements were solved successfully,
+ *                otherwise error code of the first failing element
+ ******************************************************************************/
+kes_err_e kesolver_batch_mt(
+    const size_t       n,
+    const double*      ecc,
+    const size_t       incecc,
+    const double*      ma,
+    double*            ea,
+    const kes_stm_e    init,
+    const kes_sol_e    iter,
+    const kes_input_t* data,
+    kes_err_e*         status,
+    int*               iterations
+    )
+{
+    /* small arrays or single thread: solve in calling thread */
+    if ( (n <= kes_get_chunk()) || (kes_get_threads() < 2) )
+    {
+        return( kesolver_batch( n, ecc, incecc, ma, ea, init, iter, data,
+                                status, iterations ) );
+    } // end if
+
+    const kes_batch_t batch = {
+        .n = n, .ecc = ecc, .incecc = incecc, .ma = ma, .ea = ea,
+        .init = init, .iter = iter, .data = data,
+        .status = status, .iterations = iterations
+    };
+
+    /* segments of batches up to KES_POOL_STACKSEG * KES_NUMA_SEG elements
+     * on the stack
+     */
+    size_t         stack[(KES_POOL_STACKSEG * KES_POOL_SEGBYTES +
+                          sizeof(size_t) - 1) / sizeof(size_t)];
+    unsigned char* ws = ((kes_pool_wssize( n ) <= sizeof(stack)) ?
+                         (unsigned char*)stack : NULL);
+
+    kes_job_t job;
+    job.ownjob = 0;
+    job.task   = NULL;
+    if ( kes_pool_enqueue( &job, &batch, NULL, NULL, 0, ws ) == 0 )
+    {
+        return( kesolver_batch( n, ecc, incecc, ma, ea, init, iter, data,
+                                status, iterations ) );
+    } // end if
+
+    /* calling thread takes part in the work of its own job */
+    const int node = kes_numa_self();
+    pthread_mutex_lock( &pool.lock );
+    size_t i0  = 0;
+    size_t cnt = kes_pool_claim( &job, &i0, node );
+    while ( cnt > 0 )
+    {
+        kes_pool_solve( &job, i0, cnt );
+        cnt = kes_pool_claim( &job, &i0, node );
+    } // end while
+
+    /* wait for work items still solved by workers */
+    while ( !job.complete )
+    {
+        pthread_cond_wait( &pool.done, &pool.lock );
+    } // end while
+    pthread_mutex_unlock( &pool.lock );
+
+    kes_pool_release( &job );
+
+    return( job.err );
+} // end kesolver_batch_mt
+
+/******************************************************************************/
+
+/*******************************************************************************
+ *  FUNCTION    : kes_pool_run
+ *  DESCRIPTION : run the work items of a task in parallel by the thread pool
+ *  INPUT       : number of work items "n", task function and its argument
+ *  OUTPUT      : error code of the first failing work item, KES_ERR_NOERR
+ *                otherwise
+ ******************************************************************************/
+kes_err_e kes_pool_run(
+    const size_t n,
+    kes_task_t   task,
+    void*        arg
+    )
+{
+    /* single work item or single thread: run in calling thread */
+    if ( (n < 2) || (kes_get_threads() < 2) )
+    {
+        return( (n > 0) ? task( arg, 0, n ) : KES_ERR_NOERR );
+    } // end if
+
+    /* NOTE the batch only counts the work items */
+    const kes_batch_t batch = {
+        .n = n, .ecc = NULL, .incecc = 0, .ma = NULL, .ea = NULL,
+        .init = KES_STM_NONE, .iter = KES_SOL_NEWRAP, .data = NULL,
+        .status = NULL, .iterations = NULL
+    };
+
+    kes_job_t job;
+    job.ownjob = 0;
+    job.task   = task;
+    job.targ   = arg;
+    if ( kes_pool_enqueue( &job, &batch, NULL, NULL, 0, NULL ) == 0 )
+    {
+        return( task( arg, 0, n ) );
+    } // end if
+
+    /* calling thread takes part in the work of its own job */
+    const int node = kes_numa_self();
+    pthread_mutex_lock( &pool.lock );
+    size_t i0  = 0;
+    size_t cnt = kes_pool_claim( &job, &i0, node );
+    while ( cnt > 0 )
+    {
+        kes_pool_solve( &job, i0, cnt );
+        cnt = kes_pool_claim( &job, &i0, node );
+    } // end while
+
+    /* wait for work items still run by workers */
+    while ( !job.complete )
+    {
+        pthread_cond_wait( &pool.done, &pool.lock );
+    } // end while
+    pthread_mutex_unlock( &pool.lock );
+
+    kes_pool_release( &job );
+
+    return( job.err );
+} // end kes_pool_run
+
+/******************************************************************************/
+
+/*******************************************************************************
+ *  FUNCTION    : kes_pool_submit
+ *  DESCRIPTION : queue a batch for the thread pool and return immediately
+ *  INPUT       : job, batch, callback (or NULL) and its argument, workspace
+ *                "ws" for the segments (or NULL)
+ *  OUTPUT      : handle of the job
+ ******************************************************************************/
+static kes_job_t* kes_pool_submit(
+    kes_job_t*         job,
+    const kes_batch_t* batch,
+    kes_callback_t     callback,
+    void*              arg,
+    unsigned char*     ws
+    )
+{
+    job->task = NULL;
+
+    /* empty batch or no worker thread: solve in calling thread */
+    if ( (batch->n == 0) ||
+         (kes_pool_enqueue( job, batch, callback, arg, 1, ws ) == 0) )
+    {
+        job->batch    = *batch;
+        job->callback = NULL;
+        job->seghome  = NULL;
+        job->segnext  = NULL;
+        job->ownseg   = 0;
+        job->err      = kesolver_batch(
+            batch->n, batch->ecc, batch->incecc, batch->ma, batch->ea,
+            batch->init, batch->iter, batch->data, batch->status,
+            batch->iterations
+        );
+        if ( callback != NULL )
+        {
+            callback( batch, job->err, arg );
+        } // end if
+        job->complete = 1;
+    } // end if
+
+    return( job );
+} // end kes_pool_submit
+
+/******************************************************************************/
+
+/*******************************************************************************
+ *  FUNCTION    : kes_submit
+ *  DESCRIPTION : queue a batch for the thread pool and return immediately
+ *  INPUT       : batch, callback (or NULL) and its argument
+ *  OUTPUT      : handle of the job for kes_poll() and kes_wait(), NULL if
+ *                out of memory
+ ******************************************************************************/
+kes_job_t* kes_submit(
+    const kes_batch_t* batch,
+    kes_callback_t     callback,
+    void*              arg
+    )
+{
+    kes_alloc_t alloc;
+    kes_job_t*  job = kes_mem_alloc( &alloc, sizeof(kes_job_t) );
+    if ( job == NULL )
+    {
+        return( NULL );
+    } // end if
+    job->ownjob   = 1;
+    job->joballoc = alloc;
+
+    return( kes_pool_submit( job, batch, callback, arg, NULL ) );
+} // end kes_submit
+
+/******************************************************************************/
+
+/*******************************************************************************
+ *  FUNCTION    : kes_submit_size
+ *  DESCRIPTION : workspace size of a batch for kes_submit_ws()
+ *  INPUT       : batch
+ *  OUTPUT      : number of bytes
+ ******************************************************************************/
+size_t kes_submit_size(const kes_batch_t* batch)
+{
+    return( KES_WS_ROUND( sizeof(kes_job_t) ) + kes_pool_wssize( batch->n ) );
+} // end kes_submit_size
+
+/******************************************************************************/
+
+/*******************************************************************************
+ *  FUNCTION    : kes_submit_ws
+ *  DESCRIPTION : queue a batch for the thread pool with a caller-provided
+ *                workspace and return immediately
+ *  INPUT       : batch, callback (or NULL) and its argument, buffer "buf"
+ *                and its number of bytes "size"
+ *  OUTPUT      : handle of the job for kes_poll() and kes_wait(), NULL if
+ *                the buffer is too small or misaligned
+ ******************************************************************************/
+kes_job_t* kes_submit_ws(
+    const kes_batch_t* batch,
+    kes_callback_t     callback,
+    void*              arg,
+    void*              buf,
+    const size_t       size
+    )
+{
+    /* exception: buffer misaligned or too small */
+    if ( (buf == NULL) || ((uintptr_t)buf % sizeof(double) != 0) ||
+         (size < kes_submit_size( batch )) )
+    {
+        return( NULL );
+    } // end if
+
+    kes_job_t* job = (kes_job_t*)buf;
+    job->ownjob = 0;
+
+    return( kes_pool_submit( job, batch, callback, arg,
+                             (unsigned char*)buf +
+                             KES_WS_ROUND( sizeof(kes_job_t) ) ) );
+} // end kes_submit_ws
+
+/******************************************************************************/
+
+/*******************************************************************************
+ *  FUNCTION    : kes_poll
+ *  DESCRIPTION : test whether a submitted job is complete, does not block
+ *  INPUT       : handle of job from kes_submit()
+ *  OUTPUT      : 1 if all elements are solved and the callback returned,
+ *                0 otherwise
+ ******************************************************************************/
+int kes_poll(kes_job_t* job)
+{
+    pthread_mutex_lock( &pool.lock );
+    const int complete = job->complete;
+    pthread_mutex_unlock( &pool.lock );
+
+    return( complete );
+} // end kes_poll
+
+/******************************************************************************/
+
+/*******************************************************************************
+ *  FUNCTION    : kes_wait
+ *  DESCRIPTION : wait for completion of a submitted job and release it
+ *  INPUT       : handle of job from kes_submit(), invalid afterwards
+ *  OUTPUT      : error code of the first failing element, KES_ERR_NOERR
+ *                otherwise
+ ******************************************************************************/
+kes_err_e kes_wait(kes_job_t* job)
+{
+    pthread_mutex_lock( &pool.lock );
+    while ( !job->complete )
+    {
+        pthread_cond_wait( &pool.done, &pool.lock );
+    } // end while
+    pthread_mutex_unlock( &pool.lock );
+
+    const kes_err_e err = job->err;
+    kes_pool_release( job );
+
+    return( err );
+} // end kes_wait
+
+/******************************************************************************/
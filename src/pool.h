@@ -0,0 +1,289 @@
+/***************************************************************************//**
+ * @file    pool.h
+ * @brief   thread pool and multithreaded batch solver function
+ * @author  Bazso Akos
+ * @version 2026.10
+ *
+ * @copyright
+ * Copyright (C) 2019 Bazso Akos
+ *
+ * This file is part of libkes.
+ *
+ * libkes is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * libkes is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with libkes.  If not, see <https://www.gnu.org/licenses/>.
+ *
+ ******************************************************************************/
+#pragma once
+#ifndef KES_POOL__H
+#define KES_POOL__H
+
+/* include standard headers */
+#include <stddef.h>
+
+/* include module headers */
+#include "error.h"
+#include "input.h"
+#include "solver.h"
+#include "starter.h"
+
+/******************************************************************************/
+
+/*** declare macro constants ***/
+
+/* default number of elements per work item of the thread pool */
+#define KES_STD_CHUNK   256
+
+/******************************************************************************/
+
+/*** declare data structures ***/
+
+/*!
+ * @brief arguments of one batch for kesolver_batch(), see kes_submit()
+ */
+typedef struct
+{
+    size_t             n;          ///< number of elements
+    const double*      ecc;        ///< array of eccentricities
+    size_t             incecc;     ///< stride of array ecc (0 or 1)
+    const double*      ma;         ///< array of mean anomalies (in radians)
+    double*            ea;         ///< array of solutions (in radians)
+    kes_stm_e          init;       ///< method for starting value
+    kes_sol_e          iter;       ///< method for iterative solver
+    const kes_input_t* data;       ///< input parameters (or NULL)
+    kes_err_e*         status;     ///< per-element error codes (or NULL)
+    int*               iterations; ///< per-element iterations (or NULL)
+} kes_batch_t;
+
+
+/*!
+ * @brief handle of a batch submitted to the thread pool
+ * @details opaque type, see kes_submit()
+ */
+typedef struct kes_job_s kes_job_t;
+
+
+/*!
+ * @brief function called when all elements of a submitted batch are solved
+ * @details runs in one of the threads of the pool; it may submit new
+ * batches, but must not wait for its own batch or reconfigure the pool
+ */
+typedef void (*kes_callback_t)(
+    const kes_batch_t* batch,
+    const kes_err_e    err,
+    void*              arg
+);
+
+
+/*!
+ * @brief function running the work items i0 ... i0+cnt-1 of a task
+ * @details used internally by kes_pool_run(), e.g. for tiles of the
+ * ephemeris engine
+ */
+typedef kes_err_e (*kes_task_t)(
+    void*        arg,
+    const size_t i0,
+    const size_t cnt
+);
+
+/******************************************************************************/
+
+/*** function declarations ***/
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/*!
+ * @brief set number of threads used by kesolver_batch_mt()
+ * @details the calling thread counts as one of the threads, i.e. the pool
+ * keeps nthreads-1 worker threads alive between calls; the pool is
+ * (re-)started on the next call of kesolver_batch_mt();
+ * nthreads = 0 selects the number of online processors (default)
+ * @param[in] nthreads new number of threads
+ * @return error code from enum #kes_err_e;
+ * KES_ERR_NOERR indicates success, KES_ERR_BADVAL indicates error
+ */
+kes_err_e kes_set_threads(const int nthreads);
+
+
+/*!
+ * @brief get number of threads used by kesolver_batch_mt()
+ * @return number of threads including the calling thread
+ */
+int kes_get_threads(void);
+
+
+/*!
+ * @brief set number of elements per work item of kesolver_batch_mt()
+ * @details threads fetch work items dynamically, smaller chunks balance
+ * the load better for mixed eccentricities at the cost of more
+ * synchronization; chunk = 0 selects the default value KES_STD_CHUNK
+ * @param[in] chunk new number of elements per work item
+ * @return error code from enum #kes_err_e
+ */
+kes_err_e kes_set_chunk(const size_t chunk);
+
+
+/*!
+ * @brief get number of elements per work item of kesolver_batch_mt()
+ * @return number of elements per work item
+ */
+size_t kes_get_chunk(void);
+
+
+/*!
+ * @brief enable or disable NUMA-aware scheduling of the thread pool
+ * @details with NUMA enabled (default) on machines with several memory
+ * nodes, the worker threads of the pool are pinned to the processors of one
+ * node each, in turn, and kesolver_batch_mt() and kes_submit() split
+ * batches into segments of 65536 elements by the home node of their
+ * pages; a worker solves the segments of its own node first and takes work
+ * from other nodes only when these are exhausted; on machines with a single
+ * node, or if the topology is unknown, the setting has no effect;
+ * a running pool is stopped and restarted on next use
+ * @param[in] enable 1 to enable, 0 to disable
+ * @return error code from enum #kes_err_e;
+ * KES_ERR_NOERR indicates success, KES_ERR_BADVAL indicates error
+ */
+kes_err_e kes_set_numa(const int enable);
+
+
+/*!
+ * @brief stop all worker threads of the thread pool
+ * @details the pool is restarted on the next call of kesolver_batch_mt()
+ */
+void kes_pool_free(void);
+
+
+/*!
+ * @brief multithreaded batch solver function for Kepler Equation
+ * @details same interface and results as kesolver_batch(); the elements
+ * are split into chunks that are solved in parallel by the thread pool;
+ * concurrent calls from several threads share the pool
+ * @param[in] n number of elements
+ * @param[in] ecc array of eccentricities
+ * @param[in] incecc stride of array ecc (0 or 1)
+ * @param[in] ma array of mean anomalies (in radians)
+ * @param[out] ea array of solutions (in radians)
+ * @param[in] init method for starting value from enum #kes_stm_e
+ * @param[in] iter method for iterative solver from enum #kes_sol_e
+ * @param[in] data pointer to input parameters (or NULL)
+ * @param[out] status optional array of per-element error codes (or NULL)
+ * @param[out] iterations optional array of iteration counts (or NULL)
+ * @return error code of the first failing element, KES_ERR_NOERR otherwise
+ */
+kes_err_e kesolver_batch_mt(
+    const size_t       n,
+    const double*      ecc,
+    const size_t       incecc,
+    const double*      ma,
+    double*            ea,
+    const kes_stm_e    init,
+    const kes_sol_e    iter,
+    const kes_input_t* data,
+    kes_err_e*         status,
+    int*               iterations
+);
+
+/*!
+ * @brief submit a batch to the thread pool without waiting for it
+ * @details the elements are solved by the worker threads in the order of
+ * submission, e.g. while the caller reads the next batch; the arrays of
+ * \a batch must stay valid until the job is complete, the structure itself
+ * and the input parameters are copied; the pool is started with at least
+ * one worker thread, also if kes_set_threads() selects a single thread;
+ * every handle must be released by exactly one call of kes_wait()
+ * @param[in] batch arguments of kesolver_batch()
+ * @param[in] callback function called on completion (or NULL)
+ * @param[in] arg argument passed to \a callback
+ * @return handle of the job, NULL if out of memory
+ */
+kes_job_t* kes_submit(
+    const kes_batch_t* batch,
+    kes_callback_t     callback,
+    void*              arg
+);
+
+
+/*!
+ * @brief workspace size of a batch for kes_submit_ws()
+ * @details depends on the number of elements of \a batch only; large
+ * batches need room for their segments on NUMA machines, see
+ * kes_set_numa()
+ * @param[in] batch arguments of kesolver_batch()
+ * @return number of bytes
+ */
+size_t kes_submit_size(const kes_batch_t* batch);
+
+
+/*!
+ * @brief submit a batch to the thread pool with a caller-provided workspace
+ * @details same as kes_submit(), but the job and its segments live in
+ * \a buf instead of allocated memory, i.e. submitting needs no heap; the
+ * buffer must be aligned for double and stay valid until kes_wait()
+ * returns, it may be reused for the next batch afterwards
+ * @param[in] batch arguments of kesolver_batch()
+ * @param[in] callback function called on completion (or NULL)
+ * @param[in] arg argument passed to \a callback
+ * @param[out] buf workspace for the job
+ * @param[in] size number of bytes of \a buf, at least kes_submit_size()
+ * @return handle of the job, NULL if \a buf is too small or misaligned
+ */
+kes_job_t* kes_submit_ws(
+    const kes_batch_t* batch,
+    kes_callback_t     callback,
+    void*              arg,
+    void*              buf,
+    const size_t       size
+);
+
+
+/*!
+ * @brief test whether a submitted batch is complete, without blocking
+ * @param[in] job handle from kes_submit()
+ * @return 1 if all elements are solved and the callback returned, 0 otherwise
+ */
+int kes_poll(kes_job_t* job);
+
+
+/*!
+ * @brief wait for a submitted batch and release its handle
+ * @param[in] job handle from kes_submit(), invalid afterwards
+ * @return error code of the first failing element, KES_ERR_NOERR otherwise
+ */
+kes_err_e kes_wait(kes_job_t* job);
+
+
+/*!
+ * @brief run the work items of a task in parallel by the thread pool
+ * @details internal function of the library; the work items are claimed
+ * one by one by the worker threads and the calling thread, which waits for
+ * all of them; without worker threads, the calling thread runs them all
+ * @param[in] n number of work items
+ * @param[in] task function running the work items
+ * @param[in] arg argument passed to \a task
+ * @return error code of the first failing work item, KES_ERR_NOERR otherwise
+ */
+kes_err_e kes_pool_run(
+    const size_t n,
+    kes_task_t   task,
+    void*        arg
+);
+
+#ifdef __cplusplus
+}
+#endif
+
+/******************************************************************************/
+
+#endif  /* KES_POOL__H */
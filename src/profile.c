@@ -0,0 +1,430 @@
+/***************************************************************************//**
+ * @file    profile.c
+ * @brief   profiling of the stages of kesolver() in clock ticks
+ * @details every thread records into a private table, tables of all threads
+ *          are merged on request as in the statistics collector (stats.c)
+ * @author  Bazso Akos
+ * @version 2026.10
+ *
+ * @copyright
+ * Copyright (C) 2019 Bazso Akos
+ *
+ * This file is part of libkes.
+ *
+ * libkes is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * libkes is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with libkes.  If not, see <https://www.gnu.org/licenses/>.
+ *
+ ******************************************************************************/
+/* POSIX threads and clock_gettime() */
+#define _POSIX_C_SOURCE 200809L
+
+/* include standard headers */
+#include <pthread.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <time.h>
+
+/* include module headers */
+#include "profile.h"
+#include "alloc.h"
+
+/******************************************************************************/
+
+/* use verbose debug output? 0 = no (default), 1 = yes */
+#define KES_PROFILE_DEBUG 0
+
+/* number of repetitions for calibrating the cost of reading the clock */
+#define KES_PROFILE_CALIB 64
+
+/******************************************************************************/
+
+/* table of profiles owned by one thread */
+typedef struct kes_profile_tab_s
+{
+    kes_profile_t cell[KES_STM_TOTAL][KES_SOL_TOTAL];
+    struct kes_profile_tab_s* next; ///< next table in list of all tables
+    kes_alloc_t alloc; ///< allocator of the table
+} kes_profile_tab_t;
+
+/* profiler enabled (1) or not (0) */
+int kes_profile_level = 0;
+
+/* ticks of reading the clock once, subtracted from every stage */
+static uint64_t profile_tick = 0;
+
+/* list of tables of running threads, protected by profile_lock */
+static kes_profile_tab_t* profile_list = NULL;
+
+/* merged table of terminated threads, protected by profile_lock */
+static kes_profile_tab_t  profile_retired;
+
+static pthread_mutex_t    profile_lock = PTHREAD_MUTEX_INITIALIZER;
+static pthread_once_t     profile_once = PTHREAD_ONCE_INIT;
+static pthread_key_t      profile_key;
+
+/* table of the calling thread (or NULL) */
+static __thread kes_profile_tab_t* profile_tab = NULL;
+
+/******************************************************************************/
+
+/*******************************************************************************
+ * FUNCTION    : kes_profile_add
+ * DESCRIPTION : add a value to a counter of the owning thread
+ * INPUT       : - pointer "cnt" to counter
+ *               - value "v" to add
+ * OUTPUT      : none
+ ******************************************************************************/
+static inline void kes_profile_add(
+    uint64_t*      cnt,
+    const uint64_t v
+    )
+{
+    /* NOTE single writer, atomic store only keeps concurrent readers safe */
+    __atomic_store_n( cnt, __atomic_load_n( cnt, __ATOMIC_RELAXED ) + v,
+                      __ATOMIC_RELAXED );
+} // end kes_profile_add
+
+/******************************************************************************/
+
+/*******************************************************************************
+ * FUNCTION    : kes_profile_merge
+ * DESCRIPTION : add all counters of one cell to another cell
+ * INPUT       : - pointer "dst" to target cell
+ *               - pointer "src" to source cell
+ * OUTPUT      : none
+ ******************************************************************************/
+static void kes_profile_merge(
+    kes_profile_t*       dst,
+    const kes_profile_t* src
+    )
+{
+    /* NOTE all members are counters of type uint64_t */
+    uint64_t*       d = (uint64_t*)dst;
+    const uint64_t* s = (const uint64_t*)src;
+
+    for (size_t k = 0; k < sizeof(kes_profile_t) / sizeof(uint64_t); k++)
+    {
+        d[k] += __atomic_load_n( &s[k], __ATOMIC_RELAXED );
+    } // end for
+} // end kes_profile_merge
+
+/******************************************************************************/
+
+/*******************************************************************************
+ * FUNCTION    : kes_profile_retire
+ * DESCRIPTION : destructor of thread-specific table, keeps ticks of
+ *               terminating threads in the merged table
+ * INPUT       : pointer "arg" to table of type kes_profile_tab_t
+ * OUTPUT      : none
+ ******************************************************************************/
+static void kes_profile_retire(void* arg)
+{
+    kes_profile_tab_t* tab = (kes_profile_tab_t*)arg;
+
+    pthread_mutex_lock( &profile_lock );
+
+    /* unlink table */
+    kes_profile_tab_t** p = &profile_list;
+    while ( (*p != NULL) && (*p != tab) )
+    {
+        p = &(*p)->next;
+    } // end while
+    if ( *p != NULL )
+    {
+        *p = tab->next;
+    } // end if
+
+    /* merge ticks */
+    for (int i = 0; i < KES_STM_TOTAL; i++)
+    {
+        for (int j = 0; j < KES_SOL_TOTAL; j++)
+        {
+            kes_profile_merge( &profile_retired.cell[i][j],
+                               &tab->cell[i][j] );
+        } // end for(j)
+    } // end for(i)
+
+    pthread_mutex_unlock( &profile_lock );
+
+    const kes_alloc_t alloc = tab->alloc;
+    kes_mem_free( &alloc, tab, sizeof(kes_profile_tab_t) );
+} // end kes_profile_retire
+
+/******************************************************************************/
+
+/*******************************************************************************
+ * FUNCTION    : kes_profile_key
+ * DESCRIPTION : create key for thread-specific tables (called once)
+ * INPUT       : none
+ * OUTPUT      : none
+ ******************************************************************************/
+static void kes_profile_key(void)
+{
+    pthread_key_create( &profile_key, kes_profile_retire );
+} // end kes_profile_key
+
+/******************************************************************************/
+
+/*******************************************************************************
+ * FUNCTION    : kes_profile_table
+ * DESCRIPTION : get table of the calling thread, allocate on first use
+ * INPUT       : none
+ * OUTPUT      : pointer to table (or NULL if out of memory)
+ ******************************************************************************/
+static kes_profile_tab_t* kes_profile_table(void)
+{
+    if ( profile_tab == NULL )
+    {
+        pthread_once( &profile_once, kes_profile_key );
+
+        kes_alloc_t alloc;
+        kes_profile_tab_t* tab = kes_mem_calloc( &alloc, 1,
+                                                 sizeof(kes_profile_tab_t) );
+        if ( tab == NULL )
+        {
+            return( NULL );
+        } // end if
+        tab->alloc = alloc;
+
+        pthread_mutex_lock( &profile_lock );
+        tab->next    = profile_list;
+        profile_list = tab;
+        pthread_mutex_unlock( &profile_lock );
+
+        /* NOTE table is merged and released when the thread terminates */
+        pthread_setspecific( profile_key, tab );
+        profile_tab = tab;
+    } // end if
+
+    return( profile_tab );
+} // end kes_profile_table
+
+/******************************************************************************/
+
+/*******************************************************************************
+ * FUNCTION    : kes_profile_calibrate
+ * DESCRIPTION : measure the ticks of reading the clock once, as minimum of
+ *               the difference of two consecutive readings
+ * INPUT       : none
+ * OUTPUT      : ticks of one reading
+ ******************************************************************************/
+static uint64_t kes_profile_calibrate(void)
+{
+    uint64_t best = UINT64_MAX;
+
+    for (int k = 0; k < KES_PROFILE_CALIB; k++)
+    {
+        const uint64_t t0 = kes_profile_clock();
+        const uint64_t t1 = kes_profile_clock();
+        if ( t1 - t0 < best )
+        {
+            best = t1 - t0;
+        } // end if
+    } // end for
+
+    return( best );
+} // end kes_profile_calibrate
+
+/******************************************************************************/
+
+/*******************************************************************************
+ * FUNCTION    : kes_profile_span
+ * DESCRIPTION : ticks between two readings without the cost of a reading
+ * INPUT       : readings "t0" <= "t1" of the clock
+ * OUTPUT      : ticks (at least 0)
+ ******************************************************************************/
+static inline uint64_t kes_profile_span(
+    const uint64_t t0,
+    const uint64_t t1
+    )
+{
+    const uint64_t tick = __atomic_load_n( &profile_tick, __ATOMIC_RELAXED );
+
+    return( (t1 - t0 > tick) ? t1 - t0 - tick : 0 );
+} // end kes_profile_span
+
+/******************************************************************************/
+
+/*******************************************************************************
+ * FUNCTION    : kes_profile_nsec
+ * DESCRIPTION : read the monotonic clock in nanoseconds
+ * INPUT       : none
+ * OUTPUT      : nanoseconds since an arbitrary epoch
+ ******************************************************************************/
+uint64_t kes_profile_nsec(void)
+{
+    struct timespec ts;
+    clock_gettime( CLOCK_MONOTONIC, &ts );
+
+    return( (uint64_t)ts.tv_sec * 1000000000ULL + (uint64_t)ts.tv_nsec );
+} // end kes_profile_nsec
+
+/******************************************************************************/
+
+/*******************************************************************************
+ * FUNCTION    : kes_set_profile
+ * DESCRIPTION : enable or disable the profiler, calibrates the clock
+ * INPUT       : "enable" (1 = enable, 0 = disable)
+ * OUTPUT      : error code
+ ******************************************************************************/
+kes_err_e kes_set_profile(const int enable)
+{
+    if ( (enable != 0) && (enable != 1) )
+    {
+        return( KES_ERR_BADVAL );
+    } // end if
+
+#if KES_PROFILE
+    if ( enable )
+    {
+        __atomic_store_n( &profile_tick, kes_profile_calibrate(),
+                          __ATOMIC_RELAXED );
+    } // end if
+    __atomic_store_n( &kes_profile_level, enable, __ATOMIC_RELAXED );
+#else
+    if ( enable )
+    {
+        return( KES_ERR_BADVAL );
+    } // end if
+#endif
+
+#if KES_PROFILE_DEBUG
+    printf("%s: enable = %d, tick = %llu\n", __func__, enable,
+           (unsigned long long)profile_tick);
+#endif
+
+    return( KES_ERR_NOERR );
+} // end kes_set_profile
+
+/******************************************************************************/
+
+/*******************************************************************************
+ * FUNCTION    : kes_profile_reset
+ * DESCRIPTION : clear all collected profiles
+ * INPUT       : none
+ * OUTPUT      : none
+ ******************************************************************************/
+void kes_profile_reset(void)
+{
+    pthread_mutex_lock( &profile_lock );
+
+    for (kes_profile_tab_t* tab = profile_list; tab != NULL; tab = tab->next)
+    {
+        uint64_t* d = (uint64_t*)tab->cell;
+
+        for (size_t k = 0; k < sizeof(tab->cell) / sizeof(uint64_t); k++)
+        {
+            __atomic_store_n( &d[k], 0, __ATOMIC_RELAXED );
+        } // end for
+    } // end for
+
+    for (int i = 0; i < KES_STM_TOTAL; i++)
+    {
+        for (int j = 0; j < KES_SOL_TOTAL; j++)
+        {
+            profile_retired.cell[i][j] = (kes_profile_t){ .calls = 0 };
+        } // end for(j)
+    } // end for(i)
+
+    pthread_mutex_unlock( &profile_lock );
+} // end kes_profile_reset
+
+/******************************************************************************/
+
+/*******************************************************************************
+ * FUNCTION    : kes_profile_get
+ * DESCRIPTION : get profile merged over all threads
+ * INPUT       : - starter method "init" from enum kes_stm_e
+ *               - solver method "iter" from enum kes_sol_e
+ *               - pointer "prof" to structure of type kes_profile_t
+ * OUTPUT      : error code
+ ******************************************************************************/
+kes_err_e kes_profile_get(
+    const kes_stm_e init,
+    const kes_sol_e iter,
+    kes_profile_t*  prof
+    )
+{
+    if ( ((int)init < 0) || (init >= KES_STM_TOTAL) )
+    {
+        return( KES_ERR_BADSTM );
+    } // end if
+    if ( ((int)iter < 0) || (iter >= KES_SOL_TOTAL) )
+    {
+        return( KES_ERR_BADSOL );
+    } // end if
+
+    *prof = (kes_profile_t){ .calls = 0 };
+
+    pthread_mutex_lock( &profile_lock );
+
+    kes_profile_merge( prof, &profile_retired.cell[init][iter] );
+    for (kes_profile_tab_t* tab = profile_list; tab != NULL; tab = tab->next)
+    {
+        kes_profile_merge( prof, &tab->cell[init][iter] );
+    } // end for
+
+    pthread_mutex_unlock( &profile_lock );
+
+    return( KES_ERR_NOERR );
+} // end kes_profile_get
+
+/******************************************************************************/
+
+/*******************************************************************************
+ * FUNCTION    : kes_profile_record
+ * DESCRIPTION : record one call in the table of the calling thread
+ * INPUT       : - starter method "init" and solver method "iter"
+ *               - clocks "tic" at begin and "toc" at end of the call
+ *               - clocks "mark" taken by the solver core (0 = not taken)
+ * OUTPUT      : none
+ ******************************************************************************/
+void kes_profile_record(
+    const kes_stm_e init,
+    const kes_sol_e iter,
+    const uint64_t  tic,
+    const uint64_t  mark[KES_PROFILE_MARKS],
+    const uint64_t  toc
+    )
+{
+    /* NOTE invalid methods are rejected by the solvers before */
+    if ( ((int)init < 0) || (init >= KES_STM_TOTAL) ||
+         ((int)iter < 0) || (iter >= KES_SOL_TOTAL) )
+    {
+        return;
+    } // end if
+
+    kes_profile_tab_t* tab = kes_profile_table();
+    if ( tab == NULL )
+    {
+        return;
+    } // end if
+
+    kes_profile_t* c = &tab->cell[init][iter];
+
+    /* stages measured by the solver core, if it took its time stamps */
+    const uint64_t total   = kes_profile_span( tic, toc );
+    const uint64_t starter = ((mark[1] != 0) ?
+                              kes_profile_span( mark[0], mark[1] ) : 0);
+    const uint64_t iterate = ((mark[2] != 0) ?
+                              kes_profile_span( mark[1], mark[2] ) : 0);
+    const uint64_t inner   = starter + iterate;
+
+    kes_profile_add( &c->calls,      1 );
+    kes_profile_add( &c->cycles,     total );
+    kes_profile_add( &c->cycStarter, starter );
+    kes_profile_add( &c->cycIter,    iterate );
+    kes_profile_add( &c->cycWrapper, ((total > inner) ? total - inner : 0) );
+} // end kes_profile_record
+
+/******************************************************************************/
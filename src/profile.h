@@ -0,0 +1,220 @@
+/***************************************************************************//**
+ * @file    profile.h
+ * @brief   profiling of the stages of kesolver() in clock ticks
+ * @author  Bazso Akos
+ * @version 2026.10
+ *
+ * @copyright
+ * Copyright (C) 2019 Bazso Akos
+ *
+ * This file is part of libkes.
+ *
+ * libkes is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * libkes is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with libkes.  If not, see <https://www.gnu.org/licenses/>.
+ *
+ ******************************************************************************/
+#pragma once
+#ifndef KES_PROFILE__H
+#define KES_PROFILE__H
+
+/* include standard headers */
+#include <stdint.h>
+
+#if defined(__x86_64__) || defined(__i386__)
+#include <x86intrin.h>
+#endif
+
+/* include module headers */
+#include "error.h"
+#include "solver.h"
+#include "starter.h"
+
+/******************************************************************************/
+
+/*** declare macro constants ***/
+
+/* build with profiling support (1 = default) or without it (0, e.g. by
+ * -DKES_PROFILE=0), in which case kes_set_profile(1) fails
+ */
+#ifndef KES_PROFILE
+#define KES_PROFILE 1
+#endif
+
+/* number of time stamps taken inside the solver cores, see kes_profile_mark()
+ * 0 = before starter, 1 = after starter, 2 = after iterations
+ */
+#define KES_PROFILE_MARKS 3
+
+/******************************************************************************/
+
+/*** declare data structures ***/
+
+/*!
+ * @brief structure containing aggregated clock ticks of kesolver() calls
+ * @details ticks are read from the time stamp counter (x86, rdtsc), the
+ * virtual counter (ARM64, cntvct_el0) or a monotonic clock in nanoseconds;
+ * the cost of reading the counter is subtracted from every stage;
+ * "cycWrapper" is the remainder of the call outside of starter and
+ * iterations, i.e. argument checks, method resolution, range reduction and
+ * closed-form or direct solutions without a starter
+ */
+typedef struct
+{
+    uint64_t calls;      ///< number of profiled successful calls
+    uint64_t cycles;     ///< total ticks of the calls
+    uint64_t cycStarter; ///< ticks spent in the starter function
+    uint64_t cycIter;    ///< ticks spent in the iteration function
+    uint64_t cycWrapper; ///< remaining ticks of kesolver() and its wrappers
+} kes_profile_t;
+
+/******************************************************************************/
+
+/*** declare global variables ***/
+
+/* profiler enabled (1) or not (0)
+ * NOTE internal use only, see kes_set_profile()
+ */
+extern int kes_profile_level;
+
+/******************************************************************************/
+
+/*** function declarations ***/
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/*!
+ * @brief enable or disable the profiler
+ * @details if enabled, every successful call of kesolver() is split into
+ * the stages starter, iterations and wrapper by reading a clock counter
+ * five times, the ticks are aggregated per pair of starter and solver
+ * method in a private table of the calling thread (about 12 kB); batch
+ * and plan solvers are not profiled; a disabled profiler (default) costs
+ * a single load per call; collected data is kept when disabled
+ * @param[in] enable 1 = enable, 0 = disable
+ * @return error code from enum #kes_err_e;
+ * KES_ERR_NOERR indicates success, KES_ERR_BADVAL indicates error or a
+ * library built without profiling support (KES_PROFILE = 0)
+ */
+kes_err_e kes_set_profile(const int enable);
+
+
+/*!
+ * @brief clear all collected profiles
+ * NOTE ticks of calls running concurrently may survive the reset
+ */
+void kes_profile_reset(void);
+
+
+/*!
+ * @brief get profile merged over all threads
+ * @details includes the data of threads which have terminated
+ * @param[in] init starter method from enum #kes_stm_e
+ * @param[in] iter solver method from enum #kes_sol_e
+ * @param[out] prof pointer to structure of type #kes_profile_t
+ * @return error code from enum #kes_err_e;
+ * KES_ERR_NOERR indicates success, KES_ERR_BADSTM or KES_ERR_BADSOL
+ * indicates error
+ */
+kes_err_e kes_profile_get(
+    const kes_stm_e init,
+    const kes_sol_e iter,
+    kes_profile_t*  prof
+);
+
+
+/*!
+ * @brief read the monotonic clock in nanoseconds
+ * NOTE internal use only, fallback of kes_profile_clock()
+ * @return nanoseconds since an arbitrary epoch
+ */
+uint64_t kes_profile_nsec(void);
+
+
+/*!
+ * @brief record one call in the table of the calling thread
+ * NOTE internal use only, see kesolver()
+ * @param[in] init starter method
+ * @param[in] iter solver method
+ * @param[in] tic clock at begin of the call
+ * @param[in] mark clocks taken by the solver core (0 = not taken)
+ * @param[in] toc clock at end of the call
+ */
+void kes_profile_record(
+    const kes_stm_e init,
+    const kes_sol_e iter,
+    const uint64_t  tic,
+    const uint64_t  mark[KES_PROFILE_MARKS],
+    const uint64_t  toc
+);
+
+#ifdef __cplusplus
+}
+#endif
+
+/******************************************************************************/
+
+/*** inline functions ***/
+
+/*!
+ * @brief check if the profiler is enabled
+ * @return 1 if enabled, 0 otherwise
+ */
+static inline int kes_profile_begin(void)
+{
+#if KES_PROFILE
+    return( __atomic_load_n( &kes_profile_level, __ATOMIC_RELAXED ) );
+#else
+    return( 0 );
+#endif
+} // end kes_profile_begin
+
+
+/*!
+ * @brief read the clock counter of the profiler
+ * @return ticks since an arbitrary epoch
+ */
+static inline uint64_t kes_profile_clock(void)
+{
+#if defined(__x86_64__) || defined(__i386__)
+    return( (uint64_t)__rdtsc() );
+#elif defined(__aarch64__)
+    uint64_t t;
+    __asm__ __volatile__ ( "isb; mrs %0, cntvct_el0" : "=r" (t) );
+    return( t );
+#else
+    return( kes_profile_nsec() );
+#endif
+} // end kes_profile_clock
+
+
+/*!
+ * @brief take time stamp "k" of a solver core if profiled
+ * @param[in] mark array of time stamps (or NULL if not profiled)
+ * @param[in] k index of time stamp (0 <= k < KES_PROFILE_MARKS)
+ */
+static inline void kes_profile_mark(
+    uint64_t* mark,
+    const int k
+    )
+{
+    if ( mark != NULL )
+    {
+        mark[k] = kes_profile_clock();
+    } // end if
+} // end kes_profile_mark
+
+/******************************************************************************/
+
+#endif  /* KES_PROFILE__H */
@@ -0,0 +1,457 @@
+/***************************************************************************//**
+ * @file    propag.c
+ * @brief   propagator of an elliptic orbit with uniform time steps
+ * @author  Bazso Akos
+ * @version 2026.10
+ *
+ * @copyright
+ * Copyright (C) 2019 Bazso Akos
+ *
+ * This file is part of libkes.
+ *
+ * libkes is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * libkes is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with libkes.  If not, see <https://www.gnu.org/licenses/>.
+ *
+ ******************************************************************************/
+
+/* include standard headers */
+#include <math.h>
+
+/* include module headers */
+#include "propag.h"
+#include "const.h"
+#include "itercore.h"
+#include "vecmath.h"
+
+/******************************************************************************/
+
+/* tiny increment to denominator, same role as in module itercore.c */
+static const double addzero = 1.0e-19;
+
+/* rotations by Halley corrections below this angle use Taylor series,
+ * truncation errors of the series are below 1E-21
+ */
+static const double small_angle = 1E-3;
+
+/******************************************************************************/
+
+/*******************************************************************************
+ *  FUNCTION    : kes_prop_rotate
+ *  DESCRIPTION : rotate sin(x), cos(x) by angle d, i.e. return sin(x+d),
+ *                cos(x+d) from the angle-addition theorems
+ *  INPUT       : - pointers "sx", "cx" to sin(x), cos(x)
+ *                - angle "d" (in radians)
+ *  OUTPUT      : none
+ ******************************************************************************/
+static inline void kes_prop_rotate(
+    double*      sx,
+    double*      cx,
+    const double d
+    )
+{
+    double sd, cd;
+
+    if ( fabs(d) < small_angle )
+    {
+        /* sin(d) = d - d^3/6 + d^5/120, cos(d) = 1 - d^2/2 + d^4/24 */
+        const double d2 = d * d;
+        sd = d - d * d2 * (1.0 - d2 / 20.0) / 6.0;
+        cd = 1.0 - d2 * (0.5 - d2 / 24.0);
+    } // end if
+    else
+    {
+        kes_vec_sincos( &sd, &cd, d );
+    } // end else
+
+    const double s = *sx;
+    const double c = *cx;
+    *sx = s * cd + c * sd;
+    *cx = c * cd - s * sd;
+
+    return;
+} // end kes_prop_rotate
+
+/******************************************************************************/
+
+/*******************************************************************************
+ *  FUNCTION    : kes_prop_solve
+ *  DESCRIPTION : solve the reduced mean anomaly "ma" of the propagator by
+ *                kesolver() and recompute sin, cos of the solution
+ *  INPUT       : - pointer "prop" to structure of type kes_propagator_t
+ *                - reduced mean anomaly "ma" (in radians)
+ *  OUTPUT      : error code from enum kes_err_e
+ ******************************************************************************/
+static kes_err_e kes_prop_solve(
+    kes_propagator_t* prop,
+    const double      ma
+    )
+{
+    kes_err_e    err;
+    const double x = kesolver( prop->ecc, ma, prop->init, prop->iter,
+                               &prop->data, &err );
+
+    /* same range as the reduced mean anomaly */
+    prop->mbase = prop->ma = ma;
+    prop->ea    = ((x > M_PI) ? x - M_2PI : x);
+    prop->count = prop->wraps = 0;
+    kes_sincos( &prop->sx, &prop->cx, prop->ea, -1.0 );
+    prop->fac   = 1.0 / (1.0 - prop->ecc * prop->cx + addzero);
+
+    return( err );
+} // end kes_prop_solve
+
+/******************************************************************************/
+
+/*******************************************************************************
+ *  FUNCTION    : kes_prop_step
+ *  DESCRIPTION : advance the propagator by one step: the predicted increment
+ *                of E is rotated into sin(E), cos(E), then refined by Halley
+ *                corrections with rotations by small angles
+ *  INPUT       : - pointer "prop" to structure of type kes_propagator_t
+ *                - pointer "ret" to error code of the first failure
+ *  OUTPUT      : none
+ ******************************************************************************/
+static void kes_prop_step(
+    kes_propagator_t* prop,
+    kes_err_e*        ret
+    )
+{
+    const double ecc = prop->ecc;
+
+    /* reduced mean anomaly: from M0 directly every KES_PROP_RENORM steps,
+     * else by additions of the reduced increment, i.e. the error does not
+     * accumulate; NOTE wrap at pi by multiples of 2*pi as kes_reduce()
+     */
+    const int renorm = (prop->count + 1 >= KES_PROP_RENORM);
+    double    ma;
+    if ( renorm )
+    {
+        ma = kes_reduce( prop->ma0 +
+                         kes_reduce_nt( prop->dma, (double)prop->step ) );
+    } // end if
+    else
+    {
+        ma = (prop->mbase + (prop->count + 1) * prop->dmr) -
+             prop->wraps * M_2PI;
+        prop->wraps += ((ma > M_PI) ? 1 : ((ma < -M_PI) ? -1 : 0));
+        ma = ((ma > M_PI) ? ma - M_2PI : ((ma < -M_PI) ? ma + M_2PI : ma));
+    } // end else
+
+    /* previous E on the branch of the new reduced mean anomaly,
+     * i.e. shifted by 2*pi when M crossed pi
+     */
+    const double x0 = prop->ea + ((ma - prop->ma) - prop->dmr);
+
+    /* predicted increment: 2nd-order Taylor series of E(M),
+     * NOTE dE/dM = 1/(1-e*cos(E)) from the previous step, i.e. no division
+     *      in the chain of dependent operations from step to step
+     */
+    double       fac = prop->fac;
+    const double d0  = prop->dmr * fac *
+                       (1.0 - 0.5 * prop->dmr * ecc * prop->sx * fac * fac);
+
+    int    done  = 0;
+    int    count = 0;
+    double x     = x0 + d0;
+    double sx    = prop->sx;
+    double cx    = prop->cx;
+
+    /* large increments are left to the solver, as in kes_plan_solve_warm() */
+    if ( fabs(d0) <= KES_WARM_MAXSTEP )
+    {
+        const double tolx = prop->data.tolx;
+        kes_prop_rotate( &sx, &cx, d0 );
+
+        /* Halley corrections, see kes_itercore3(), with one division:
+         * dx = f0 / (f1 + (f0 / f1) * f2) = f0 * f1 / (f1^2 + f0 * f2)
+         */
+        do
+        {
+            const double f0 = ma - x + ecc * sx;
+            const double f1 = 1.0 - ecc * cx + addzero;
+            const double f2 = 0.5 * ecc * sx;
+            const double dx = f0 * f1 / (f1 * f1 + f0 * f2);
+
+            /* derivative for the next prediction (independent division) */
+            fac = 1.0 / f1;
+
+            kes_prop_rotate( &sx, &cx, dx );
+            x += dx;
+            ++count;
+
+            done = (fabs(dx) <= tolx) ||
+                   kes_stop_order( KES_STOP_ORDER, 3, ecc, x, fabs(dx), tolx );
+        } while ( !done && (count < KES_PROP_MAXCORR) ); // end do
+    } // end if
+    prop->iterations += count;
+
+    if ( done )
+    {
+        prop->ma = ma;
+        prop->ea = x;
+        prop->sx  = sx;
+        prop->cx  = cx;
+        prop->fac = fac;
+        ++(prop->count);
+
+        /* bound drift of the rotations */
+        if ( renorm )
+        {
+            kes_sincos( &prop->sx, &prop->cx, x, -1.0 );
+            prop->mbase = ma;
+            prop->count = prop->wraps = 0;
+        } // end if
+    } // end if
+    else
+    {
+        /* NOTE rare for small steps, e.g. close to pericenter for e ~ 1,
+         * restarts the recurrences from the solution
+         */
+        const kes_err_e err = kes_prop_solve( prop,
+            kes_reduce( prop->ma0 +
+                        kes_reduce_nt( prop->dma, (double)prop->step ) ) );
+        ++(prop->fallbacks);
+        *ret = ((*ret == KES_ERR_NOERR) ? err : *ret);
+    } // end else
+
+    return;
+} // end kes_prop_step
+
+/******************************************************************************/
+
+/*******************************************************************************
+ *  FUNCTION    : kes_propagator_init
+ *  DESCRIPTION : create a propagator for uniform steps of the mean anomaly
+ *  INPUT       : - pointer "prop" to structure of type kes_propagator_t
+ *                - eccentricity "ecc"
+ *                - mean anomaly "ma0" of step 0 (in radians)
+ *                - increment "dma" per step (in radians)
+ *                - starter method "init" from enum kes_stm_e
+ *                - solver method "iter" from enum kes_sol_e
+ *                - pointer "data" to input parameters (may be NULL)
+ *  OUTPUT      : error code from enum kes_err_e
+ ******************************************************************************/
+kes_err_e kes_propagator_init(
+    kes_propagator_t*  prop,
+    const double       ecc,
+    const double       ma0,
+    const double       dma,
+    const kes_stm_e    init,
+    const kes_sol_e    iter,
+    const kes_input_t* data
+    )
+{
+    kes_err_e err;
+
+    /* private copy of input parameters */
+    prop->data = ((data != NULL) ? *data : kes_new_input());
+    kes_check_input( &prop->data );
+
+    prop->ecc        = ecc;
+    prop->ma0        = ma0;
+    prop->dma        = dma;
+    prop->dmr        = remainder( dma, M_2PI );
+    prop->mbase      = prop->ma = prop->ea = prop->sx = prop->cx = 0.0;
+    prop->fac        = 1.0;
+    prop->step       = 0;
+    prop->count      = prop->wraps = 0;
+    prop->iterations = 0;
+    prop->fallbacks  = 0;
+    prop->init       = init;
+    prop->iter       = iter;
+
+    /* exception: only elliptic and circular orbits */
+    const kes_ecc_e type = kes_check_ecc( ecc, &err );
+    if ( err != KES_ERR_NOERR )
+    {
+        prop->status = err;
+    } // end if
+    else if ( (type != KES_ECC_CIRC) && (type != KES_ECC_ELL) )
+    {
+        prop->status = KES_ERR_BADECC;
+    } // end if
+    else if (
+        (kes_check_val( ma0 ) != KES_ERR_NOERR) ||
+        (kes_check_val( dma ) != KES_ERR_NOERR)
+    ) {
+        prop->status = KES_ERR_BADVAL;
+    } // end if
+    else
+    {
+        /* step 0 by the solver, also checks the methods */
+        prop->status = kes_prop_solve( prop, kes_reduce( ma0 ) );
+    } // end else
+
+    return( prop->status );
+} // end kes_propagator_init
+
+/******************************************************************************/
+
+/*******************************************************************************
+ *  FUNCTION    : kes_prop_emit
+ *  DESCRIPTION : write the current step of the propagator to the outputs
+ *  INPUT       : - pointer "prop" to structure of type kes_propagator_t
+ *                - factor "rad" = sqrt(1 - e^2) for the true anomaly
+ *                - index "i" of the outputs
+ *                - array "ea" and optional arrays "sinea", "cosea", "nu"
+ *  OUTPUT      : none
+ ******************************************************************************/
+static inline void kes_prop_emit(
+    const kes_propagator_t* prop,
+    const double            rad,
+    const size_t            i,
+    double*                 ea,
+    double*                 sinea,
+    double*                 cosea,
+    double*                 nu
+    )
+{
+    /* outputs in the range of kesolver(), NOTE a tiny negative iterate
+     * rounds to 2*pi after the shift, i.e. to the start of the range
+     */
+    const double x = ((prop->ea < 0.0) ? prop->ea + M_2PI : prop->ea);
+    ea[i] = ((x >= M_2PI) ? 0.0 : x);
+    if ( sinea != NULL )
+    {
+        sinea[i] = prop->sx;
+    } // end if
+    if ( cosea != NULL )
+    {
+        cosea[i] = prop->cx;
+    } // end if
+    if ( nu != NULL )
+    {
+        nu[i] = kes_vec_atan2( rad * prop->sx, prop->cx - prop->ecc );
+    } // end if
+
+    return;
+} // end kes_prop_emit
+
+/******************************************************************************/
+
+/*******************************************************************************
+ *  FUNCTION    : kes_propagator_run
+ *  DESCRIPTION : emit the next "n" steps of a propagator
+ *  INPUT       : - pointer "prop" to structure of type kes_propagator_t
+ *                - number of steps "n"
+ *                - array "ea" of eccentric anomalies (in radians)
+ *                - optional arrays "sinea", "cosea" and "nu" (may be NULL)
+ *  OUTPUT      : error code from enum kes_err_e
+ ******************************************************************************/
+kes_err_e kes_propagator_run(
+    kes_propagator_t* prop,
+    const size_t      n,
+    double*           ea,
+    double*           sinea,
+    double*           cosea,
+    double*           nu
+    )
+{
+    kes_err_e    ret = prop->status;
+    const double rad = sqrt(1.0 - prop->ecc * prop->ecc);
+    size_t       i0  = 0;
+
+    prop->iterations = 0;
+
+    /* exception: propagator was not created */
+    if ( prop->status != KES_ERR_NOERR )
+    {
+        for (size_t i = 0; i < n; i++)
+        {
+            ea[i] = 0.0;
+            if ( sinea != NULL )
+            {
+                sinea[i] = 0.0;
+            } // end if
+            if ( cosea != NULL )
+            {
+                cosea[i] = 0.0;
+            } // end if
+            if ( nu != NULL )
+            {
+                nu[i] = 0.0;
+            } // end if
+        } // end for
+
+        return( ret );
+    } // end if
+
+    /* NOTE each step depends on the previous one, i.e. a single sequence is
+     *      bound by the latency of its operations; long runs are split into
+     *      KES_PROP_LANES sequences of q steps that are advanced together,
+     *      each but the first one starts from a solution of kesolver()
+     */
+    const size_t q = ((n >= KES_PROP_LANES * KES_PROP_MINLANE) ?
+                      n / KES_PROP_LANES : 0);
+    if ( q > 0 )
+    {
+        kes_propagator_t lane[KES_PROP_LANES];
+        for (int l = 0; l < KES_PROP_LANES; l++)
+        {
+            lane[l]            = *prop;
+            lane[l].fallbacks  = 0;
+            if ( l > 0 )
+            {
+                lane[l].step = prop->step + l * q;
+                const kes_err_e err = kes_prop_solve( &lane[l], kes_reduce(
+                    prop->ma0 + kes_reduce_nt( prop->dma,
+                                               (double)lane[l].step ) ) );
+                ret = ((ret == KES_ERR_NOERR) ? err : ret);
+            } // end if
+        } // end for
+
+        for (size_t j = 0; j < q; j++)
+        {
+            for (int l = 0; l < KES_PROP_LANES; l++)
+            {
+                /* step 0 of the propagator resp. of a lane is solved */
+                if ( (lane[l].step > 0) && ((j > 0) || (l == 0)) )
+                {
+                    kes_prop_step( &lane[l], &ret );
+                } // end if
+                kes_prop_emit( &lane[l], rad, l * q + j, ea, sinea, cosea,
+                               nu );
+                ++(lane[l].step);
+            } // end for
+        } // end for
+
+        /* continue from the end of the last sequence */
+        int iterations = 0;
+        int fallbacks  = prop->fallbacks;
+        for (int l = 0; l < KES_PROP_LANES; l++)
+        {
+            iterations += lane[l].iterations;
+            fallbacks  += lane[l].fallbacks;
+        } // end for
+        *prop            = lane[KES_PROP_LANES - 1];
+        prop->iterations = iterations;
+        prop->fallbacks  = fallbacks;
+        i0               = KES_PROP_LANES * q;
+    } // end if
+
+    /* remaining steps, or all of a short run, in a single sequence */
+    for (size_t i = i0; i < n; i++)
+    {
+        /* step 0 was solved by kes_propagator_init() */
+        if ( prop->step > 0 )
+        {
+            kes_prop_step( prop, &ret );
+        } // end if
+        kes_prop_emit( prop, rad, i, ea, sinea, cosea, nu );
+        ++(prop->step);
+    } // end for
+
+    return( ret );
+} // end kes_propagator_run
+
+/******************************************************************************/
@@ -0,0 +1,165 @@
+/***************************************************************************//**
+ * @file    propag.h
+ * @brief   propagator of an elliptic orbit with uniform time steps
+ * @author  Bazso Akos
+ * @version 2026.10
+ *
+ * @copyright
+ * Copyright (C) 2019 Bazso Akos
+ *
+ * This file is part of libkes.
+ *
+ * libkes is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * libkes is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with libkes.  If not, see <https://www.gnu.org/licenses/>.
+ *
+ ******************************************************************************/
+#pragma once
+#ifndef KES_PROPAG__H
+#define KES_PROPAG__H
+
+/* include standard headers */
+#include <stddef.h>
+
+/* include module headers */
+#include "error.h"
+#include "input.h"
+#include "solver.h"
+#include "starter.h"
+#include "utils.h"
+
+/******************************************************************************/
+
+/*** declare macro constants ***/
+
+/* steps between recomputations of sin(E), cos(E) and of the reduced mean
+ * anomaly by kes_propagator_run(), bounds the drift of the recurrences to a
+ * few ulp
+ */
+#define KES_PROP_RENORM 32
+
+/* max. number of Halley corrections per step of kes_propagator_run() */
+#define KES_PROP_MAXCORR 4
+
+/* long runs of kes_propagator_run() advance this number of sequences of at
+ * least KES_PROP_MINLANE steps together
+ */
+#define KES_PROP_LANES   4
+#define KES_PROP_MINLANE 64
+
+/******************************************************************************/
+
+/*** declare data structures ***/
+
+/*!
+ * @brief structure containing the state of a uniform-step propagator
+ * @details created by kes_propagator_init() for one elliptic orbit with
+ * mean anomalies M(k) = M0 + k * dM, the steps are emitted in order by
+ * kes_propagator_run(); sin(E) and cos(E) are carried forward by rotations
+ * sin(E+d) = sin(E) cos(d) + cos(E) sin(d), cos(E+d) = cos(E) cos(d) -
+ * sin(E) sin(d) and corrected by Halley steps,
+ * NOTE treat all members as read-only
+ */
+typedef struct
+{
+    double      ecc;        ///< eccentricity
+    double      ma0;        ///< mean anomaly of step 0 (in radians)
+    double      dma;        ///< increment of the mean anomaly per step
+    double      dmr;        ///< increment reduced to [-pi:pi]
+    double      mbase;      ///< reduced mean anomaly at last recomputation
+    double      ma;         ///< reduced mean anomaly of the current step
+    double      ea;         ///< eccentric anomaly of the current step,
+                            ///< in the same range [-pi:pi] as ma
+    double      sx;         ///< sin(ea)
+    double      cx;         ///< cos(ea)
+    double      fac;        ///< derivative dE/dM = 1/(1-e*cos(ea))
+    size_t      step;       ///< index of the next step to emit
+    int         count;      ///< steps since last recomputation of sx, cx
+    int         wraps;      ///< multiples of 2*pi subtracted since then
+    int         iterations; ///< Halley steps of last kes_propagator_run()
+    int         fallbacks;  ///< steps solved by kesolver() instead
+    kes_stm_e   init;       ///< starter method of step 0 and fallbacks
+    kes_sol_e   iter;       ///< solver method of step 0 and fallbacks
+    kes_err_e   status;     ///< error code from kes_propagator_init()
+    kes_input_t data;       ///< checked input parameters
+} kes_propagator_t;
+
+/******************************************************************************/
+
+/*** function declarations ***/
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/*!
+ * @brief create a propagator for uniform steps of the mean anomaly
+ * @details solves step 0 by kesolver() with \a init and \a iter, which also
+ * solve steps whose predicted increment of E exceeds KES_WARM_MAXSTEP, or
+ * whose Halley corrections do not converge within KES_PROP_MAXCORR steps;
+ * elliptic and circular orbits only
+ * @param[out] prop pointer to structure of type #kes_propagator_t
+ * @param[in] ecc eccentricity (0 <= ecc < 1)
+ * @param[in] ma0 mean anomaly of step 0 (in radians)
+ * @param[in] dma increment of the mean anomaly per step (in radians)
+ * @param[in] init choose a starter method from enum #kes_stm_e
+ * @param[in] iter choose a solver method from enum #kes_sol_e
+ * @param[in] data pointer to data structure of type #kes_input_t
+ * (or NULL for default settings)
+ * @return error code from enum #kes_err_e, also stored in the propagator;
+ * KES_ERR_BADECC for parabolic and hyperbolic orbits
+ */
+kes_err_e kes_propagator_init(
+    kes_propagator_t*  prop,
+    const double       ecc,
+    const double       ma0,
+    const double       dma,
+    const kes_stm_e    init,
+    const kes_sol_e    iter,
+    const kes_input_t* data
+);
+
+
+/*!
+ * @brief emit the next steps of a propagator
+ * @details the first call starts with step 0, every call continues where
+ * the previous one stopped; each step takes the sin/cos of a predicted
+ * increment of E (no libm call) and usually one Halley correction with
+ * small-angle rotations; the reduced mean anomaly advances by additions of
+ * the reduced increment, it is recomputed from M0 together with sin(E) and
+ * cos(E) every KES_PROP_RENORM steps; E is in [0:2*pi) as returned by
+ * kesolver()
+ * @param[in,out] prop pointer to structure of type #kes_propagator_t
+ * @param[in] n number of steps
+ * @param[out] ea array of eccentric anomalies (in radians)
+ * @param[out] sinea optional array of sin(E) (or NULL)
+ * @param[out] cosea optional array of cos(E) (or NULL)
+ * @param[out] nu optional array of true anomalies in (-pi:pi] (or NULL)
+ * @return error code from enum #kes_err_e;
+ * error code of kes_propagator_init() if that failed, outputs are 0 then
+ */
+kes_err_e kes_propagator_run(
+    kes_propagator_t* prop,
+    const size_t      n,
+    double*           ea,
+    double*           sinea,
+    double*           cosea,
+    double*           nu
+);
+
+#ifdef __cplusplus
+}
+#endif
+
+/******************************************************************************/
+
+#endif  /* KES_PROPAG__H */
@@ -30,6 +30,7 @@
 /* include module headers */
 #include "secant.h"
 #include "debug.h"
+#include "trace.h"
 #include "kepeq.h"
 
 /******************************************************************************/
@@ -55,18 +56,19 @@ int secant(
     double       xl, xr, x;      /* interval: xl <= x <= xr */
     double       fl, fr, fx;     /* fl = f(xl), fr = f(xr), fx = f(x) */
 
-    /* correction factor for absolute error deltaf */
-    const double corr = ecc / (1.0 - ecc);
+    /* correction factor for absolute error deltaf (precomputed if available) */
+    const double corr = ((res->terms != NULL) ?
+                         res->terms->corr : ecc / (1.0 - ecc));
 
     /* reset error residuals */
     deltax = deltaf = 0.0;
-#if KES_SHOW_ITER_STATS
     res->nbrSinEval = res->nbrCosEval = res->nbrFktEval = 0;
-#endif
 
-#if KES_ITER_DEBUG
-    KES_DEBUG_STM("secant", ecc, ma, starter);
-#endif
+    /* trace iteration process? */
+    const int trace = kes_trace_begin();
+
+    /* NOTE given starter is overridden by the bracketing interval */
+    (void)starter;
 
     /* define lower and upper limits for solution interval;
      * override given starter
@@ -74,9 +76,8 @@ int secant(
     xl = ma;
     xr = ma + ecc;
     deltax = fabs(xr - xl);
-#if KES_ITER_DEBUG
-    KES_DEBUG_SOL("secant", count, deltax, 0.0);
-#endif
+    kes_trace_step( trace, KES_SOL_SECANT, count, ecc, ma, 0.5 * (xl + xr),
+                    deltax, 0.0 );
 
     /* check if interval width is small enough */
     if ( deltax < res->tolx )
@@ -87,9 +88,7 @@ int secant(
 
     /* check if f(xl) is a solution */
     fl = kes_keq_ell( ecc, ma, xl );
-#if KES_SHOW_ITER_STATS
     ++(res->nbrSinEval); ++(res->nbrFktEval);
-#endif
     if ( fabs(fl) < res->tolf )
     {
         res->result = xl;
@@ -98,9 +97,7 @@ int secant(
 
     /* check if f(xr) is a solution */
     fr = kes_keq_ell( ecc, ma, xr );
-#if KES_SHOW_ITER_STATS
     ++(res->nbrSinEval); ++(res->nbrFktEval);
-#endif
     if ( fabs(fr) < res->tolf )
     {
         res->result = xr;
@@ -115,9 +112,7 @@ int secant(
 
         /* function value at new point */
         fx = kes_keq_ell( ecc, ma, x );
-#if KES_SHOW_ITER_STATS
         ++(res->nbrSinEval); ++(res->nbrFktEval);
-#endif
 
         /* modify interval borders */
         xl = xr; fl = fr;
@@ -129,9 +124,8 @@ int secant(
         deltax = fabs(xr - xl);
         deltaf = fabs(fx) * corr;
 
-#if KES_ITER_DEBUG
-    KES_DEBUG_SOL("secant", count, deltax, deltaf);
-#endif
+        kes_trace_step( trace, KES_SOL_SECANT, count, ecc, ma,
+                        x, deltax, deltaf );
     } while (
         (deltax > res->tolx) &&
         (deltaf > res->tolf) &&
@@ -0,0 +1,1395 @@
+/***************************************************************************//**
+ * @file    single.c
+ * @brief   single-precision starter, iteration and solver functions
+ * @author  Bazso Akos
+ * @version 2026.10
+ *
+ * @copyright
+ * Copyright (C) 2019 Bazso Akos
+ *
+ * This file is part of libkes.
+ *
+ * libkes is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * libkes is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with libkes.  If not, see <https://www.gnu.org/licenses/>.
+ *
+ ******************************************************************************/
+/* include standard headers */
+#include <math.h>
+
+/* include module headers */
+#include "single.h"
+#include "const.h"
+#include "hyperb.h"
+#include "itercore.h"
+#include "vecmath.h"
+#include "vecore.h"
+
+/******************************************************************************/
+
+/* use verbose debug output? 0 = no (default), 1 = yes */
+#define KES_SINGLE_DEBUG 0
+
+/******************************************************************************/
+
+/* tiny increment to denominator, same role as in module itercore.c */
+static const float addzerof = 1.0E-19f;
+
+/* constant pi of type float */
+static const float pif = (float)M_PI;
+
+/* increments below this bound, relative to max(1, |E|), are dominated by
+ * rounding errors for ecc close to 1; iterations stop once they no longer
+ * decrease
+ */
+static const float stagf = 1E-3f;
+
+/* prototype of vectorized iteration steps */
+typedef void kes_vcoref_t(
+    const float* restrict ecc,
+    const float* restrict ma,
+    const float* restrict x0,
+    float* restrict       x1
+);
+
+/******************************************************************************/
+
+/*******************************************************************************
+ * FUNCTION    : kes_reducef
+ * DESCRIPTION : reduce mean anomaly of type float to interval [-pi:pi)
+ * INPUT       : angle x (in radians)
+ * OUTPUT      : angle x modulo 2*pi (in radians)
+ * NOTE reduction in double precision, the only rounding is the final one
+ ******************************************************************************/
+float kes_reducef(const float x)
+{
+    return( (float)kes_reduce( (double)x ) );
+} // end kes_reducef
+
+/******************************************************************************/
+
+/*** REFERENCE : Odell & Gooding (1986), Celestial Mechanics 38, p.307-334 ***/
+
+/*******************************************************************************
+ * FUNCTIONS   : stmf_s0 ... stmf_s15
+ * DESCRIPTION : single-precision versions of starters stm_s0 ... stm_s15,
+ *               same formulas as in module starter.c
+ * INPUT       : - eccentricity "ecc"
+ *               - reduced mean anomaly "ma" (0 <= ma <= pi)
+ * OUTPUT      : starting value
+ ******************************************************************************/
+static float stmf_s0(const float ecc, const float ma)
+{
+    (void)ecc;
+    (void)ma;
+
+    return( pif );
+} // end stmf_s0
+
+
+static float stmf_s1(const float ecc, const float ma)
+{
+    (void)ecc;
+
+    return( ma );
+} // end stmf_s1
+
+
+static float stmf_s2(const float ecc, const float ma)
+{
+    float sx, cx;
+    kes_vec_sincosf( &sx, &cx, ma );
+
+    return( ma + ecc * sx );
+} // end stmf_s2
+
+
+static float stmf_s3(const float ecc, const float ma)
+{
+    float sx, cx;
+    kes_vec_sincosf( &sx, &cx, ma );
+
+    return( ma + ecc * sx * (1.0f + ecc * cx) );
+} // end stmf_s3
+
+
+static float stmf_s4(const float ecc, const float ma)
+{
+    return( ma + ecc );
+} // end stmf_s4
+
+
+static float stmf_s5(const float ecc, const float ma)
+{
+    float sx, cx, sy, cy;
+    kes_vec_sincosf( &sx, &cx, ma );
+    kes_vec_sincosf( &sy, &cy, ma + ecc );
+
+    return( ma + ecc * sx / (1.0f - sy + sx) );
+} // end stmf_s5
+
+
+static float stmf_s6(const float ecc, const float ma)
+{
+    return( (ma + ecc * pif) / (1.0f + ecc) );
+} // end stmf_s6
+
+
+static float stmf_s7(const float ecc, const float ma)
+{
+    /* choose minimal starter of M / (1 - e), s4 and s6 */
+    const float tmp = ma / (1.0f - ecc);
+
+    return( fminf( fminf( tmp, stmf_s4( ecc, ma ) ), stmf_s6( ecc, ma ) ) );
+} // end stmf_s7
+
+
+static float stmf_s8(const float ecc, const float ma)
+{
+    static const float lambda = (float)(0.05 * M_1_PI); // = 1/(20*pi)
+    const float x = stmf_s3( ecc, ma );
+
+    return( x + lambda * ecc * ecc * ecc * ecc * (pif - x) );
+} // end stmf_s8
+
+
+static float stmf_s9(const float ecc, const float ma)
+{
+    /* avoid singularity at (e,M) = (1,0) */
+    if ( (ecc < 1.0f) && (ma > 0.0f) )
+    {
+        float sx, cx;
+        kes_vec_sincosf( &sx, &cx, ma );
+
+        return( ma + ecc * sx /
+                sqrtf( 1.0f - 2.0f * ecc * cx + ecc * ecc ) );
+    } // end if
+    else return( ma );
+} // end stmf_s9
+
+
+static float stmf_s10(const float ecc, const float ma)
+{
+    /* avoid division by e=0 */
+    if ( ecc > 0.0f )
+    {
+        const float q = 2.0f * (1.0f - ecc) / ecc;
+        const float r = 3.0f * ma / ecc;
+        const float s = cbrtf( sqrtf( q*q*q + r*r ) + r );
+
+        return( s - q / s );
+    } // end if
+    else return( ma );
+} // end stmf_s10
+
+
+static float stmf_s11(const float ecc, const float ma)
+{
+    static const float a = -0.922267802364199155721E-1f;
+    static const float b =  0.830041022127779240149E+0f; /* b = -9*a; */
+    static const float c = -0.184453560472839831144E+0f; /* c =  2*a; */
+
+    /* avoid singularity at e=1 */
+    if ( ecc < 1.0f )
+    {
+        float sinx, cosx;
+        kes_vec_sincosf( &sinx, &cosx, ma );
+
+        const float e1    = 1.0f - ecc;
+        const float cos2x = (2.0f * cosx * cosx - 1.0f);
+        const float ecosx = ecc * cosx;
+        const float esinx = ecc * sinx;
+
+        return(
+            ma + esinx * (
+                1.0f +
+                ecosx * 2.0f / 3.0f +
+                ecc * ecc * (1.0f - 48.0f * cosx + 19.0f * cos2x) / 36.0f +
+                ecc * ecc * ecc * (a + b * cosx + c * cos2x)
+            ) / cbrtf( 1.0f - (1.0f + ecc * e1 * (1.0f + e1) * (1.0f + e1)) *
+                       ecosx )
+        );
+    } // end if
+    else return( ma );
+} // end stmf_s11
+
+
+static float stmf_s12(const float ecc, const float ma)
+{
+    static const float a = (float)((M_PI-1.0)*(M_PI-1.0)/(M_PI+2.0/3.0));
+    static const float b = (float)(2.0*(M_PI-1.0/6.0)*(M_PI-1.0/6.0)/
+                                   (M_PI+2.0/3.0));
+    const float        w = pif - ma;
+
+    return( ecc * (pif - a * w / (b - w)) + (1.0f - ecc) * ma );
+} // end stmf_s12
+
+
+static float stmf_s13(const float ecc, const float ma)
+{
+    float x, sx, cx;
+
+    kes_vec_sincosf( &sx, &cx, ma );               /* sin(M), cos(M) */
+    x = atan2f( ecc * sx, 1.0f - ecc * cx );       /* x = arctan(...) */
+    kes_vec_sincosf( &sx, &cx, x );
+    x = ma + sx - x;                               /* y = M + sin(x) - x */
+    kes_vec_sincosf( &sx, &cx, x );               /* sin(y), cos(y) */
+
+    return( atan2f( sx, cx - ecc ) );
+} // end stmf_s13
+
+
+static float stmf_s14(const float ecc, const float ma)
+{
+    static const float pisq = (float)M_PISQ;
+    float sx, cx;
+    kes_vec_sincosf( &sx, &cx, ma );
+
+    return( ma + ecc * (cbrtf( pisq * ma ) - pif * sx / 15.0f - ma) );
+} // end stmf_s14
+
+
+static float stmf_s15(const float ecc, const float ma)
+{
+    /* NOTE lookup table of type double, see starter.c */
+    return( (float)kes_starter_func( KES_STM_ES15 )( ecc, ma ) );
+} // end stmf_s15
+
+/* list of single-precision starter functions, indexed by enum kes_stm_e */
+static kes_stmf_t* const list_of_startersf[KES_STM_TOTAL] = {
+    NULL,
+    &stmf_s0,  &stmf_s1,  &stmf_s2,  &stmf_s3,  &stmf_s4,  &stmf_s5,
+    &stmf_s6,  &stmf_s7,  &stmf_s8,  &stmf_s9,  &stmf_s10, &stmf_s11,
+    &stmf_s12, &stmf_s13, &stmf_s14, &stmf_s15
+};
+
+/******************************************************************************/
+
+/*******************************************************************************
+ * FUNCTION    : kes_starterf_func
+ * DESCRIPTION : look up the single-precision function of a starter method
+ * INPUT       : starter method "type" from list kes_stm_e
+ * OUTPUT      : pointer to starter function, NULL for invalid method
+ ******************************************************************************/
+kes_stmf_t* kes_starterf_func(const kes_stm_e type)
+{
+    if (
+        (type <= KES_STM_NONE) ||
+        (type >= KES_STM_TOTAL)
+    ) {
+        return( NULL );
+    } // end if
+
+    return( list_of_startersf[type] );
+} // end kes_starterf_func
+
+/******************************************************************************/
+
+/*******************************************************************************
+ * FUNCTION    : kes_starterf
+ * DESCRIPTION : evaluate chosen starter method in single precision
+ * INPUT       : - eccentricity "ecc"
+ *               - mean anomaly "ma" in radians
+ *               - starter method "type" from list kes_stm_e
+ *               - pointer "status" to return error code (see error.h)
+ * OUTPUT      : starting value
+ ******************************************************************************/
+float kes_starterf(
+    const float     ecc,
+    const float     ma,
+    const kes_stm_e type,
+    kes_err_e*      status
+    )
+{
+    kes_stmf_t* const stm = kes_starterf_func( type );
+
+    /* exception: invalid starter method, same as kes_starter() */
+    if ( stm == NULL )
+    {
+        *status = KES_ERR_BADSTM;
+#if KES_SINGLE_DEBUG
+    kes_show_error( *status );
+#endif
+        return( 0.0f );
+    } // end if
+
+    *status = KES_ERR_NOERR;
+
+    return( stm( ecc, ma ) );
+} // end kes_starterf
+
+/******************************************************************************/
+
+/*** REFERENCE : Danby & Burkardt (1983), Celestial Mechanics 31, p.95-107 ***/
+
+/*******************************************************************************
+ *  FUNCTION    : itercoref
+ *  DESCRIPTION : single-precision iteration methods of order 2 to 5,
+ *                same formulas as kes_itercore2 ... kes_itercore5
+ *  INPUT       : - order of iteration method (2 <= order <= 5)
+ *                - eccentricity "ecc"
+ *                - mean anomaly "ma" (in radians)
+ *                - old value of iteration variable "x0"
+ *  OUTPUT      : update to iteration variable x0+dx
+ ******************************************************************************/
+static inline float itercoref(
+    const int   order,
+    const float ecc,
+    const float ma,
+    const float x0
+    )
+{
+    float sx, cx; /* sin(x), cos(x) */
+    float dx;     /* increment deltax */
+
+    /* calculate sin, cos */
+    kes_vec_sincosf( &sx, &cx, x0 );
+    const float esx = ecc * sx;
+    const float ecx = ecc * cx;
+
+    /* evaluate Kepler Equation: 0th and 1st derivative */
+    const float f0 = ma - x0 + esx;
+    const float f1 = 1.0f - ecx + addzerof;
+
+    /* delta1: eq. (16) */
+    dx = f0 / f1;
+
+    if ( order >= 3 )
+    {
+        /* delta2: eq. (17) */
+        const float f2 = esx / 2.0f;
+        dx = f0 / (f1 + dx * f2);
+
+        if ( order >= 4 )
+        {
+            /* delta3: eq. (18) */
+            const float f3 = ecx / 6.0f;
+            dx = f0 / (f1 + dx * (f2 + dx * f3));
+
+            if ( order >= 5 )
+            {
+                /* delta4: eq. (19) */
+                const float f4 = -esx / 24.0f;
+                dx = f0 / (f1 + dx * (f2 + dx * (f3 + dx * f4)));
+            } // end if
+        } // end if
+    } // end if
+
+    return( x0 + dx );
+} // end itercoref
+
+/******************************************************************************/
+
+/*******************************************************************************
+ *  FUNCTIONS   : kes_itercore2f ... kes_itercore5f
+ *  DESCRIPTION : single-precision iteration methods: Newton-Raphson (2),
+ *                Halley (3), Danby-Burkardt (4, 5)
+ *  INPUT       : - eccentricity "ecc"
+ *                - mean anomaly "ma" (in radians)
+ *                - old value of iteration variable "x0"
+ *  OUTPUT      : update to iteration variable x0+dx
+ ******************************************************************************/
+float kes_itercore2f(const float ecc, const float ma, const float x0)
+{
+    return( itercoref( 2, ecc, ma, x0 ) );
+} // end kes_itercore2f
+
+
+float kes_itercore3f(const float ecc, const float ma, const float x0)
+{
+    return( itercoref( 3, ecc, ma, x0 ) );
+} // end kes_itercore3f
+
+
+float kes_itercore4f(const float ecc, const float ma, const float x0)
+{
+    return( itercoref( 4, ecc, ma, x0 ) );
+} // end kes_itercore4f
+
+
+float kes_itercore5f(const float ecc, const float ma, const float x0)
+{
+    return( itercoref( 5, ecc, ma, x0 ) );
+} // end kes_itercore5f
+
+/******************************************************************************/
+
+/*******************************************************************************
+ *  FUNCTION    : keqf
+ *  DESCRIPTION : evaluate elliptic Kepler Equation in single precision
+ *  INPUT       : - eccentricity "ecc"
+ *                - mean anomaly "ma" (in radians)
+ *                - eccentric anomaly "x" (in radians)
+ *  OUTPUT      : result of expression x - ecc*sin(x) - ma
+ ******************************************************************************/
+static inline float keqf(
+    const float ecc,
+    const float ma,
+    const float x
+    )
+{
+    float sx, cx;
+    kes_vec_sincosf( &sx, &cx, x );
+
+    return( x - ecc * sx - ma );
+} // end keqf
+
+/******************************************************************************/
+
+/*******************************************************************************
+ *  FUNCTION    : boundf
+ *  DESCRIPTION : keep iteration variable within bounds M <= E <= min(M+e, pi)
+ *                of the solution for reduced mean anomalies; poor starters
+ *                otherwise let iterations leave the range of kes_vec_sincosf
+ *  INPUT       : - eccentricity "ecc"
+ *                - reduced mean anomaly "ma" (0 <= ma <= pi)
+ *                - value of iteration variable "x"
+ *  OUTPUT      : iteration variable limited to bounds of the solution
+ ******************************************************************************/
+static inline float boundf(
+    const float ecc,
+    const float ma,
+    const float x
+    )
+{
+    /* NOTE branch-free for vectorization of the loops over lanes */
+    const float xmax = kes_vec_blendf( (ma + ecc) - pif, ma + ecc, pif );
+    const float xmin = kes_vec_blendf( x - ma, ma, x );
+
+    return( kes_vec_blendf( xmax - xmin, xmax, xmin ) );
+} // end boundf
+
+/******************************************************************************/
+
+/*******************************************************************************
+ *  FUNCTIONS   : kes_vitercore2f ... kes_vitercore5f
+ *  DESCRIPTION : vectorized single-precision iteration methods
+ *  INPUT       : - eccentricities "ecc"
+ *                - mean anomalies "ma" (in radians)
+ *                - old values of iteration variable "x0"
+ *                - new values of iteration variable "x1"
+ *  OUTPUT      : none
+ ******************************************************************************/
+KES_VEC_DISPATCH
+static void kes_vitercore2f(
+    const float* restrict ecc,
+    const float* restrict ma,
+    const float* restrict x0,
+    float* restrict       x1
+    )
+{
+    for (int l = 0; l < KES_VECF_LEN; l++)
+    {
+        x1[l] = itercoref( 2, ecc[l], ma[l], x0[l] );
+    } // end for
+} // end kes_vitercore2f
+
+
+KES_VEC_DISPATCH
+static void kes_vitercore3f(
+    const float* restrict ecc,
+    const float* restrict ma,
+    const float* restrict x0,
+    float* restrict       x1
+    )
+{
+    for (int l = 0; l < KES_VECF_LEN; l++)
+    {
+        x1[l] = itercoref( 3, ecc[l], ma[l], x0[l] );
+    } // end for
+} // end kes_vitercore3f
+
+
+KES_VEC_DISPATCH
+static void kes_vitercore4f(
+    const float* restrict ecc,
+    const float* restrict ma,
+    const float* restrict x0,
+    float* restrict       x1
+    )
+{
+    for (int l = 0; l < KES_VECF_LEN; l++)
+    {
+        x1[l] = itercoref( 4, ecc[l], ma[l], x0[l] );
+    } // end for
+} // end kes_vitercore4f
+
+
+KES_VEC_DISPATCH
+static void kes_vitercore5f(
+    const float* restrict ecc,
+    const float* restrict ma,
+    const float* restrict x0,
+    float* restrict       x1
+    )
+{
+    for (int l = 0; l < KES_VECF_LEN; l++)
+    {
+        x1[l] = itercoref( 5, ecc[l], ma[l], x0[l] );
+    } // end for
+} // end kes_vitercore5f
+
+/* vectorized iteration steps, indexed by order of iteration method */
+static kes_vcoref_t* const list_of_vcoref[6] = {
+    NULL, NULL,
+    &kes_vitercore2f, &kes_vitercore3f, &kes_vitercore4f, &kes_vitercore5f
+};
+
+/******************************************************************************/
+
+/*******************************************************************************
+ *  FUNCTION    : kes_vsolvef_ell
+ *  DESCRIPTION : vectorized single-precision solver for elliptic Kepler
+ *                Equation, lanes are iterated until all of them have
+ *                converged, same stopping criteria as kes_iterf()
+ *  INPUT       : - "order" of iteration method (2 <= order <= 5)
+ *                - eccentricities "ecc" (0 < ecc < 1)
+ *                - reduced mean anomalies "ma" (in radians)
+ *                - "starter" values
+ *                - solutions "x"
+ *                - number of iterations "count"
+ *                - pointer "data" to checked input parameters
+ *  OUTPUT      : none
+ ******************************************************************************/
+static void kes_vsolvef_ell(
+    const int             order,
+    const float* restrict ecc,
+    const float* restrict ma,
+    const float* restrict starter,
+    float* restrict       x,
+    int* restrict         count,
+    const kes_input_t*    data
+    )
+{
+    kes_vcoref_t* const core = list_of_vcoref[order];
+
+    float xnew[KES_VECF_LEN]; /* updated iteration variables */
+    float fx[KES_VECF_LEN];   /* residuals of Kepler Equation */
+    float corr[KES_VECF_LEN]; /* error bounds of E per residual */
+    float dxold[KES_VECF_LEN];/* previous increments */
+    int   todo[KES_VECF_LEN]; /* lane is still iterating? */
+
+    /* fixed number of iterations without evaluation of residuals */
+    if ( data->fixiter > 0 )
+    {
+        for (int l = 0; l < KES_VECF_LEN; l++)
+        {
+            x[l] = boundf( ecc[l], ma[l], starter[l] );
+        } // end for
+
+        for (int n = 0; n < data->fixiter; n++)
+        {
+            core( ecc, ma, x, xnew );
+            for (int l = 0; l < KES_VECF_LEN; l++)
+            {
+                x[l] = boundf( ecc[l], ma[l], xnew[l] );
+            } // end for
+        } // end for
+
+        for (int l = 0; l < KES_VECF_LEN; l++)
+        {
+            count[l] = data->fixiter;
+        } // end for
+
+        return;
+    } // end if
+
+    /* initialize lanes */
+    for (int l = 0; l < KES_VECF_LEN; l++)
+    {
+        x[l]     = boundf( ecc[l], ma[l], starter[l] );
+        count[l] = 0;
+        todo[l]  = 1;
+        corr[l]  = 1.0f / (1.0f - ecc[l]);
+        dxold[l] = HUGE_VALF;
+    } // end for
+
+    /* main iteration loop */
+    const float tolx    = (float)data->tolx;
+    const float tolf    = (float)data->tolf;
+    const int   maxiter = data->maxiter;
+    int         active;
+
+    do
+    {
+        /* NOTE separate loops over lanes are vectorized, fx holds the
+         *      unbounded iteration step first
+         */
+        core( ecc, ma, x, fx );
+        for (int l = 0; l < KES_VECF_LEN; l++)
+        {
+            xnew[l] = boundf( ecc[l], ma[l], fx[l] );
+        } // end for
+
+        for (int l = 0; l < KES_VECF_LEN; l++)
+        {
+            fx[l] = keqf( ecc[l], ma[l], xnew[l] );
+        } // end for
+
+        active = 0;
+        for (int l = 0; l < KES_VECF_LEN; l++)
+        {
+            /* update error residuals, relative to max(1, |x|) */
+            const float absx   = fabsf( xnew[l] );
+            const float scale  = kes_vec_blendf( absx - 1.0f, 1.0f, absx );
+            const float deltax = fabsf( xnew[l] - x[l] );
+            const float deltaf = fabsf( fx[l] ) * corr[l];
+
+            /* converged lanes keep their results */
+            x[l]     = (todo[l] ? xnew[l] : x[l]);
+            count[l] += todo[l];
+
+            /* NOTE bitwise operators, short-circuit evaluation would need
+             *      branches
+             */
+            todo[l]  = todo[l] &
+                       (deltax   > tolx * scale) &
+                       (deltaf   > tolf * scale) &
+                       ((deltax  < dxold[l]) |
+                        (deltax  > stagf * scale)) &
+                       (count[l] < maxiter);
+            dxold[l] = deltax;
+            active  |= todo[l];
+        } // end for
+    } while ( active ); // end do
+
+    return;
+} // end kes_vsolvef_ell
+
+/******************************************************************************/
+
+/*******************************************************************************
+ *  FUNCTION    : kes_iterf
+ *  DESCRIPTION : single-precision solver for elliptic Kepler Equation,
+ *                single element; stops if |dx| or the error bound
+ *                |f| / (1 - e) of the solution falls below the tolerances
+ *                relative to max(1, |x|), or if small increments stop
+ *                decreasing
+ *  INPUT       : - "order" of iteration method (2 <= order <= 5)
+ *                - eccentricity "ecc" (0 < ecc < 1)
+ *                - reduced mean anomaly "ma" (in radians)
+ *                - "starter" value
+ *                - pointer "data" to checked input parameters
+ *                - pointer "count" to return number of iterations
+ *  OUTPUT      : solution of elliptic Kepler Equation (in radians)
+ ******************************************************************************/
+static float kes_iterf(
+    const int          order,
+    const float        ecc,
+    const float        ma,
+    const float        starter,
+    const kes_input_t* data,
+    int*               count
+    )
+{
+    float x = boundf( ecc, ma, starter );
+    int   n = 0;
+
+    /* fixed number of iterations without evaluation of residuals */
+    if ( data->fixiter > 0 )
+    {
+        for (n = 0; n < data->fixiter; n++)
+        {
+            x = boundf( ecc, ma, itercoref( order, ecc, ma, x ) );
+        } // end for
+        *count = n;
+
+        return( x );
+    } // end if
+
+    const float tolx  = (float)data->tolx;
+    const float tolf  = (float)data->tolf;
+    const float corr  = 1.0f / (1.0f - ecc);
+    float       dxold = HUGE_VALF;
+    float       deltax, deltaf, scale;
+
+    do
+    {
+        const float xnew = boundf( ecc, ma, itercoref( order, ecc, ma, x ) );
+
+        /* update error residuals, relative to max(1, |x|) */
+        scale  = kes_vec_blendf( fabsf( xnew ) - 1.0f, 1.0f, fabsf( xnew ) );
+        deltax = fabsf( xnew - x );
+        deltaf = fabsf( keqf( ecc, ma, xnew ) ) * corr;
+        x      = xnew;
+        ++n;
+
+        /* NOTE rounding errors of single precision limit the accuracy for
+         * ecc close to 1, stop as soon as small increments stop decreasing
+         */
+        if ( (deltax >= dxold) && (deltax <= stagf * scale) )
+        {
+            break;
+        } // end if
+        dxold = deltax;
+    } while (
+        (deltax > tolx * scale) &&
+        (deltaf > tolf * scale) &&
+        (n < data->maxiter)
+    ); // end do
+
+    *count = n;
+
+    return( x );
+} // end kes_iterf
+
+/******************************************************************************/
+
+/*******************************************************************************
+ *  FUNCTION    : kes_inputf
+ *  DESCRIPTION : private copy of input parameters for single precision
+ *  INPUT       : - pointer "data" to input parameters (may be NULL)
+ *                - pointer "work" to return checked copy
+ *  OUTPUT      : none
+ ******************************************************************************/
+static void kes_inputf(
+    const kes_input_t* data,
+    kes_input_t*       work
+    )
+{
+    *work = ((data != NULL) ? *data : kes_new_input());
+    kes_check_input( work );
+
+    /* tolerances beyond single precision cannot be reached */
+    work->tolf = fmax( work->tolf, KES_STD_TOLF );
+    work->tolx = fmax( work->tolx, KES_STD_TOLF );
+
+    /* NOTE no table of fixed iterations for single precision */
+    work->fixiter = ((work->fixiter > 0) ? work->fixiter : 0);
+} // end kes_inputf
+
+/******************************************************************************/
+
+/*******************************************************************************
+ *  FUNCTION    : kes_single_domain
+ *  DESCRIPTION : check if an orbit is solved in single precision
+ *  INPUT       : - eccentricity domain "type" from enum kes_ecc_e
+ *                - eccentricity "ecc"
+ *  OUTPUT      : 1 for elliptic orbits up to KES_NEARPAR_ECC, 0 otherwise
+ ******************************************************************************/
+static inline int kes_single_domain(
+    const kes_ecc_e type,
+    const float     ecc
+    )
+{
+    return( (type == KES_ECC_ELL) && (ecc <= KES_NEARPAR_ECC) );
+} // end kes_single_domain
+
+/******************************************************************************/
+
+/*******************************************************************************
+ *  FUNCTION    : kes_solvef_one
+ *  DESCRIPTION : solve Kepler Equation for a single element with resolved
+ *                methods
+ *  INPUT       : - eccentricity "ecc", classified as "type"
+ *                - mean anomaly "ma" (in radians)
+ *                - starter method "init" and solver method "iter"
+ *                - resolved starter function "stm" (or NULL)
+ *                - pointer "work" to checked input parameters, returns
+ *                  number of iterations and result
+ *                - pointer "status" to return error code (see error.h)
+ *  OUTPUT      : solution of Kepler Equation (in radians)
+ ******************************************************************************/
+static float kes_solvef_one(
+    const float     ecc,
+    const kes_ecc_e type,
+    const float     ma,
+    const kes_stm_e init,
+    const kes_sol_e iter,
+    kes_stmf_t*     stm,
+    kes_input_t*    work,
+    kes_err_e*      status
+    )
+{
+    float ea = 0.0f;
+
+    work->iterations = 0;
+
+    /* exception: input contains invalid numbers */
+    if ( kes_check_val( ma ) != KES_ERR_NOERR )
+    {
+        *status = KES_ERR_BADVAL;
+    } // end if
+    else if ( type == KES_ECC_CIRC )
+    {
+        *status = KES_ERR_NOERR;
+        ea      = ma;
+    } // end if
+    else if (
+        ((type == KES_ECC_ELL) || (type == KES_ECC_HYP)) &&
+        ((iter <= KES_SOL_NONE) || (iter >= KES_SOL_TOTAL))
+    ) {
+        /* exception: invalid solver method (including KES_SOL_AUTO) */
+        *status = KES_ERR_BADSOL;
+#if KES_SINGLE_DEBUG
+    kes_show_error( *status );
+#endif
+    } // end if
+    else if ( kes_single_domain( type, ecc ) )
+    {
+        /* fallback in case of wrong starter method: E0 = M + e */
+        *status = ((stm != NULL) ? KES_ERR_NOERR : KES_ERR_BADSTM);
+        stm     = ((stm != NULL) ? stm : &stmf_s4);
+
+        /* reduce mean anomaly to range 0 <= redma <= pi */
+        const float redma = kes_reducef( ma );
+        const float absma = fabsf( redma );
+        const float x     = kes_iterf( kes_hyp_order( iter ), ecc, absma,
+                                       stm( ecc, absma ), work,
+                                       &work->iterations );
+
+        /* modify solution if necessary */
+        ea = ((redma < 0.0f) ? (float)(M_2PI - (double)x) : x);
+    } // end if
+    else
+    {
+        /* other orbits in double precision */
+        ea = (float)kesolver( ecc, ma, init, iter, work, status );
+    } // end else
+
+    work->result = ea;
+
+    return( ea );
+} // end kes_solvef_one
+
+/******************************************************************************/
+
+/*******************************************************************************
+ *  FUNCTION    : kesolverf
+ *  DESCRIPTION : single-precision solver function for Kepler Equation
+ *  INPUT       : - eccentricity "ecc"
+ *                - mean anomaly "ma" (in radians)
+ *                - starter method "init" from enum kes_stm_e
+ *                - solver method "iter" from enum kes_sol_e
+ *                - pointer "data" to data structure of type "kes_input_t"
+ *                - pointer "status" to return error code (see error.h)
+ *  OUTPUT      : solution of Kepler Equation (in radians)
+ ******************************************************************************/
+float kesolverf(
+    const float     ecc,
+    const float     ma,
+    const kes_stm_e init,
+    const kes_sol_e iter,
+    kes_input_t*    data,
+    kes_err_e*      status
+    )
+{
+    /* private copy of input parameters with single-precision tolerances */
+    kes_input_t work;
+    kes_inputf( data, &work );
+
+    const kes_ecc_e type = kes_check_ecc( ecc, status );
+    const float     ea   = kes_solvef_one( ecc, type, ma, init, iter,
+                                           kes_starterf_func( init ),
+                                           &work, status );
+
+    /* return outputs */
+    data->iterations = work.iterations;
+    data->result     = work.result;
+
+    return( ea );
+} // end kesolverf
+
+/******************************************************************************/
+
+/*******************************************************************************
+ *  FUNCTION    : kesolverf_batch
+ *  DESCRIPTION : single-precision batch solver function for Kepler Equation
+ *  INPUT       : - number of elements "n"
+ *                - eccentricity array "ecc" with stride "incecc"
+ *                  (incecc = 0 uses the same eccentricity for all elements)
+ *                - mean anomaly array "ma" (in radians)
+ *                - solution array "ea" (in radians)
+ *                - starter method "init" from enum kes_stm_e
+ *                - solver method "iter" from enum kes_sol_e
+ *                - pointer "data" to input parameters (may be NULL)
+ *                - optional arrays "status" and "iterations" (may be NULL)
+ *  OUTPUT      : KES_ERR_NOERR if all elements were solved successfully,
+ *                otherwise error code of the first failing element
+ ******************************************************************************/
+kes_err_e kesolverf_batch(
+    const size_t       n,
+    const float*       ecc,
+    const size_t       incecc,
+    const float*       ma,
+    float*             ea,
+    const kes_stm_e    init,
+    const kes_sol_e    iter,
+    const kes_input_t* data,
+    kes_err_e*         status,
+    int*               iterations
+    )
+{
+    kes_err_e err; /* error code of current element */
+    kes_err_e ret = KES_ERR_NOERR;
+
+    /* lanes of elliptic elements for vectorized solver */
+    size_t idx[KES_VECF_LEN];    /* element index */
+    float  lecc[KES_VECF_LEN];   /* eccentricity */
+    float  lma[KES_VECF_LEN];    /* reduced mean anomaly */
+    float  lstm[KES_VECF_LEN];   /* starter value */
+    float  lea[KES_VECF_LEN];    /* solution */
+    int    lside[KES_VECF_LEN];  /* side of reduced mean anomaly */
+    int    lcount[KES_VECF_LEN]; /* number of iterations */
+
+    /* nothing to do for empty arrays */
+    if ( n == 0 )
+    {
+        return( ret );
+    } // end if
+
+    /* private copy of input parameters, check and set defaults once */
+    kes_input_t work;
+    kes_inputf( data, &work );
+
+    /* resolve starter and solver methods once,
+     * NOTE fallback in case of wrong starter method: E0 = M + e
+     */
+    kes_stmf_t* const stm    = kes_starterf_func( init );
+    kes_stmf_t* const lfunc  = ((stm != NULL) ? stm : &stmf_s4);
+    const kes_err_e   method = ((stm != NULL) ? KES_ERR_NOERR : KES_ERR_BADSTM);
+    const int         valid  = ((iter > KES_SOL_NONE) &&
+                                (iter < KES_SOL_TOTAL));
+    const int         order  = kes_hyp_order( iter );
+
+    /* classify a common eccentricity once */
+    kes_ecc_e type = kes_check_ecc( ecc[0], &err );
+
+    for (size_t i0 = 0; i0 < n; i0 += KES_VECF_LEN)
+    {
+        const size_t iend  = ((n - i0 > KES_VECF_LEN) ? i0 + KES_VECF_LEN : n);
+        int          lanes = 0;
+
+        for (size_t i = i0; i < iend; i++)
+        {
+            const float e = ecc[i * incecc];
+            const float m = ma[i];
+
+            /* classify eccentricity per element if necessary */
+            if ( incecc != 0 )
+            {
+                type = kes_check_ecc( e, &err );
+            } // end if
+
+            if (
+                valid &&
+                kes_single_domain( type, e ) &&
+                (kes_check_val( m ) == KES_ERR_NOERR)
+            ) {
+                /* reduce mean anomaly to range 0 <= redma <= pi */
+                const float redma = kes_reducef( m );
+                lside[lanes] = ((redma < 0.0f) ? -1 : 1);
+
+                /* collect lane, solved after this block is filled */
+                idx[lanes]   = i;
+                lecc[lanes]  = e;
+                lma[lanes]   = fabsf( redma );
+                lstm[lanes]  = lfunc( e, lma[lanes] );
+                ++lanes;
+                ea[i]        = 0.0f;
+                err          = method;
+            } // end if
+            else
+            {
+                /* invalid input, circular and other orbits one by one */
+                ea[i] = kes_solvef_one( e, type, m, init, iter, stm,
+                                        &work, &err );
+                if ( iterations != NULL )
+                {
+                    iterations[i] = work.iterations;
+                } // end if
+            } // end else
+
+            /* optional per-element outputs */
+            if ( status != NULL )
+            {
+                status[i] = err;
+            } // end if
+
+            /* remember first error */
+            if ( (ret == KES_ERR_NOERR) && (err != KES_ERR_NOERR) )
+            {
+                ret = err;
+            } // end if
+        } // end for
+
+        /* solve collected elliptic elements of this block at once */
+        if ( lanes > 0 )
+        {
+            /* fill unused lanes with harmless dummy values */
+            for (int l = lanes; l < KES_VECF_LEN; l++)
+            {
+                lecc[l] = 0.5f;
+                lma[l]  = 1.0f;
+                lstm[l] = 1.5f;
+            } // end for
+
+            kes_vsolvef_ell( order, lecc, lma, lstm, lea, lcount, &work );
+
+            /* scatter results, modify solution if necessary */
+            for (int l = 0; l < lanes; l++)
+            {
+                ea[idx[l]] = ((lside[l] < 0) ?
+                              (float)(M_2PI - (double)lea[l]) : lea[l]);
+                if ( iterations != NULL )
+                {
+                    iterations[idx[l]] = lcount[l];
+                } // end if
+            } // end for
+        } // end if
+    } // end for
+
+    return( ret );
+} // end kesolverf_batch
+
+/******************************************************************************/
+
+/*******************************************************************************
+ *  FUNCTION    : kesolver_batch_mixed
+ *  DESCRIPTION : mixed-precision batch solver function for Kepler Equation,
+ *                starters and iterations of elliptic elements in single
+ *                precision (KES_VECF_LEN lanes), followed by one double
+ *                precision step of order 3 or 5; elements whose final step
+ *                does not predict an error below "tolx" are solved again by
+ *                kesolver(), as are all other elements
+ *  INPUT       : - number of elements "n"
+ *                - eccentricity array "ecc" with stride "incecc"
+ *                  (incecc = 0 uses the same eccentricity for all elements)
+ *                - mean anomaly array "ma" (in radians)
+ *                - solution array "ea" (in radians)
+ *                - starter method "init" from enum kes_stm_e
+ *                - solver method "iter" from enum kes_sol_e
+ *                - pointer "data" to input parameters (may be NULL)
+ *                - optional arrays "status" and "iterations" (may be NULL)
+ *  OUTPUT      : KES_ERR_NOERR if all elements were solved successfully,
+ *                otherwise error code of the first failing element
+ ******************************************************************************/
+kes_err_e kesolver_batch_mixed(
+    const size_t       n,
+    const double*      ecc,
+    const size_t       incecc,
+    const double*      ma,
+    double*            ea,
+    const kes_stm_e    init,
+    const kes_sol_e    iter,
+    const kes_input_t* data,
+    kes_err_e*         status,
+    int*               iterations
+    )
+{
+    kes_err_e err; /* error code of current element */
+    kes_err_e ret = KES_ERR_NOERR;
+
+    /* lanes of elliptic elements for vectorized solver */
+    size_t idx[KES_VECF_LEN];    /* element index */
+    double decc[KES_VECF_LEN];   /* eccentricity */
+    double dma[KES_VECF_LEN];    /* reduced mean anomaly */
+    double dx0[KES_VECF_LEN];    /* single-precision solution */
+    double dx1[KES_VECF_LEN];    /* double-precision solution */
+    float  lecc[KES_VECF_LEN];   /* eccentricity */
+    float  lma[KES_VECF_LEN];    /* reduced mean anomaly */
+    float  lstm[KES_VECF_LEN];   /* starter value */
+    float  lea[KES_VECF_LEN];    /* solution */
+    int    lside[KES_VECF_LEN];  /* side of reduced mean anomaly */
+    int    lmeth[KES_VECF_LEN];  /* error code of starter method */
+    int    lcount[KES_VECF_LEN]; /* number of iterations */
+
+    /* nothing to do for empty arrays */
+    if ( n == 0 )
+    {
+        return( ret );
+    } // end if
+
+    /* private copies of input parameters: double and single precision */
+    kes_input_t work = ((data != NULL) ? *data : kes_new_input());
+    kes_check_input( &work );
+    kes_input_t workf;
+    kes_inputf( data, &workf );
+
+    /* resolve starter and solver methods once,
+     * NOTE fallback in case of wrong starter method: E0 = M + e
+     */
+    kes_stmf_t* const stm    = kes_starterf_func( init );
+    kes_stmf_t* const lfunc  = ((stm != NULL) ? stm : &stmf_s4);
+    const kes_err_e   method = ((stm != NULL) ? KES_ERR_NOERR : KES_ERR_BADSTM);
+    const int         valid  = ((iter > KES_SOL_NONE) &&
+                                (iter < KES_SOL_TOTAL));
+    const int         order  = kes_hyp_order( iter );
+
+    /* final double-precision step: Halley (3) or Danby-Burkardt (5),
+     * NOTE KES_VECF_LEN lanes are two vectors of KES_VEC_LEN lanes
+     */
+    const int         final  = ((order >= 4) ? 5 : 3);
+    void (* const     step)(const double* restrict, const double* restrict,
+                            const double* restrict, double* restrict) =
+                      ((final == 5) ? &kes_vitercore5 : &kes_vitercore3);
+
+    /* classify a common eccentricity once */
+    kes_ecc_e type = kes_check_ecc( ecc[0], &err );
+
+    for (size_t i0 = 0; i0 < n; i0 += KES_VECF_LEN)
+    {
+        const size_t iend  = ((n - i0 > KES_VECF_LEN) ? i0 + KES_VECF_LEN : n);
+        int          lanes = 0;
+
+        for (size_t i = i0; i < iend; i++)
+        {
+            const double e = ecc[i * incecc];
+            const double m = ma[i];
+
+            /* classify eccentricity per element if necessary */
+            if ( incecc != 0 )
+            {
+                type = kes_check_ecc( e, &err );
+            } // end if
+
+            if (
+                valid &&
+                kes_single_domain( type, (float)e ) &&
+                (kes_check_val( m ) == KES_ERR_NOERR)
+            ) {
+                /* reduce mean anomaly to range 0 <= redma <= pi */
+                const double redma = kes_reduce( m );
+                lside[lanes] = ((redma < 0.0) ? -1 : 1);
+
+                /* collect lane, solved after this block is filled */
+                idx[lanes]   = i;
+                decc[lanes]  = e;
+                dma[lanes]   = fabs( redma );
+                lecc[lanes]  = (float)e;
+                lma[lanes]   = (float)dma[lanes];
+                lstm[lanes]  = lfunc( lecc[lanes], lma[lanes] );
+                lmeth[lanes] = method;
+                ++lanes;
+                ea[i]        = 0.0;
+                continue;
+            } // end if
+
+            /* invalid input, circular and other orbits one by one */
+            ea[i] = kesolver( e, m, init, iter, &work, &err );
+            if ( iterations != NULL )
+            {
+                iterations[i] = work.iterations;
+            } // end if
+
+            /* optional per-element outputs */
+            if ( status != NULL )
+            {
+                status[i] = err;
+            } // end if
+
+            /* remember first error */
+            if ( (ret == KES_ERR_NOERR) && (err != KES_ERR_NOERR) )
+            {
+                ret = err;
+            } // end if
+        } // end for
+
+        /* solve collected elliptic elements of this block at once */
+        if ( lanes > 0 )
+        {
+            /* fill unused lanes with harmless dummy values */
+            for (int l = lanes; l < KES_VECF_LEN; l++)
+            {
+                lecc[l] = 0.5f;
+                lma[l]  = 1.0f;
+                lstm[l] = 1.5f;
+                decc[l] = 0.5;
+                dma[l]  = 1.0;
+            } // end for
+
+            kes_vsolvef_ell( order, lecc, lma, lstm, lea, lcount, &workf );
+
+            /* one double-precision step from the single-precision
+             * solutions
+             */
+            for (int l = 0; l < KES_VECF_LEN; l++)
+            {
+                dx0[l] = (double)lea[l];
+            } // end for
+            for (int l = 0; l < KES_VECF_LEN; l += KES_VEC_LEN)
+            {
+                step( decc + l, dma + l, dx0 + l, dx1 + l );
+            } // end for
+
+            for (int l = 0; l < lanes; l++)
+            {
+                const size_t i  = idx[l];
+                const double x1 = dx1[l];
+                const double dx = fabs(x1 - dx0[l]);
+                int          it = lcount[l] + 1;
+                err             = lmeth[l];
+
+                /* accept step if its order predicts the error */
+                if ( kes_stop_order( KES_STOP_ORDER, final, decc[l], x1, dx,
+                                     work.tolx ) )
+                {
+                    ea[i] = ((lside[l] < 0) ? M_2PI - x1 : x1);
+                } // end if
+                else
+                {
+                    /* NOTE rare, e.g. for poor starters close to e = 1 */
+                    ea[i] = kesolver( decc[l], ma[i], init, iter, &work,
+                                      &err );
+                    it   += work.iterations;
+                } // end else
+
+                /* optional per-element outputs */
+                if ( iterations != NULL )
+                {
+                    iterations[i] = it;
+                } // end if
+                if ( status != NULL )
+                {
+                    status[i] = err;
+                } // end if
+
+                /* remember first error */
+                if ( (ret == KES_ERR_NOERR) && (err != KES_ERR_NOERR) )
+                {
+                    ret = err;
+                } // end if
+            } // end for
+        } // end if
+    } // end for
+
+    return( ret );
+} // end kesolver_batch_mixed
+
+/******************************************************************************/
+
+/*******************************************************************************
+ *  FUNCTION    : kes_planf_init
+ *  DESCRIPTION : create a single-precision solver plan for a fixed
+ *                eccentricity
+ *  INPUT       : - pointer "plan" to data structure of type "kes_planf_t"
+ *                - eccentricity "ecc"
+ *                - starter method "init" from enum kes_stm_e
+ *                - solver method "iter" from enum kes_sol_e
+ *                - pointer "data" to input parameters (may be NULL)
+ *  OUTPUT      : error code from enum kes_err_e
+ ******************************************************************************/
+kes_err_e kes_planf_init(
+    kes_planf_t*       plan,
+    const float        ecc,
+    const kes_stm_e    init,
+    const kes_sol_e    iter,
+    const kes_input_t* data
+    )
+{
+    /* private copy of input parameters, check and set defaults once */
+    kes_inputf( data, &plan->data );
+
+    plan->ecc   = ecc;
+    plan->init  = init;
+    plan->iter  = iter;
+    plan->stm   = kes_starterf_func( init );
+    plan->order = kes_hyp_order( iter );
+
+    /* exception: input contains invalid numbers */
+    if ( kes_check_val( ecc ) != KES_ERR_NOERR )
+    {
+        plan->type   = KES_ECC_NEG;
+        plan->status = KES_ERR_BADVAL;
+#if KES_SINGLE_DEBUG
+    kes_show_error( plan->status );
+#endif
+        return( plan->status );
+    } // end if
+
+    /* classify eccentricity once */
+    plan->type = kes_check_ecc( ecc, &plan->status );
+
+    switch ( plan->type )
+    {
+        /* circular and parabolic case: nothing to resolve */
+        case KES_ECC_CIRC:
+        case KES_ECC_PAR:
+            plan->status = KES_ERR_NOERR;
+            break;
+
+        /* elliptic and hyperbolic case: check methods */
+        case KES_ECC_ELL:
+        case KES_ECC_HYP:
+            if ( (iter <= KES_SOL_NONE) || (iter >= KES_SOL_TOTAL) )
+            {
+                plan->status = KES_ERR_BADSOL;
+            } // end if
+            else
+            {
+                plan->status = (((plan->stm == NULL) &&
+                                 kes_single_domain( plan->type, ecc )) ?
+                                KES_ERR_BADSTM : KES_ERR_NOERR);
+            } // end else
+            break;
+
+        case KES_ECC_NEG:
+        default:
+            plan->status = KES_ERR_BADECC;
+            break;
+    } // end switch
+
+#if KES_SINGLE_DEBUG
+    kes_show_error( plan->status );
+#endif
+
+    return( plan->status );
+} // end kes_planf_init
+
+/******************************************************************************/
+
+/*******************************************************************************
+ *  FUNCTION    : kes_planf_solve
+ *  DESCRIPTION : solve Kepler Equation with a single-precision solver plan
+ *  INPUT       : - pointer "plan" to data structure of type "kes_planf_t"
+ *                - mean anomaly "ma" (in radians)
+ *                - pointer "status" to return error code (see error.h)
+ *  OUTPUT      : solution of Kepler Equation (in radians)
+ ******************************************************************************/
+float kes_planf_solve(
+    const kes_planf_t* plan,
+    const float        ma,
+    kes_err_e*         status
+    )
+{
+    /* private work space */
+    kes_input_t work = plan->data;
+
+    return( kes_solvef_one( plan->ecc, plan->type, ma, plan->init,
+                            plan->iter, plan->stm, &work, status ) );
+} // end kes_planf_solve
+
+/******************************************************************************/
+
+/*******************************************************************************
+ *  FUNCTION    : kes_planf_solve_batch
+ *  DESCRIPTION : solve Kepler Equation with a single-precision solver plan
+ *                for an array
+ *  INPUT       : - pointer "plan" to data structure of type "kes_planf_t"
+ *                - mean anomaly array "ma" (in radians)
+ *                - solution array "ea" (in radians)
+ *                - number of elements "n"
+ *  OUTPUT      : KES_ERR_NOERR if all elements were solved successfully,
+ *                otherwise error code of the first failing element
+ ******************************************************************************/
+kes_err_e kes_planf_solve_batch(
+    const kes_planf_t* plan,
+    const float*       ma,
+    float*             ea,
+    const size_t       n
+    )
+{
+    return( kesolverf_batch( n, &plan->ecc, 0, ma, ea, plan->init, plan->iter,
+                             &plan->data, NULL, NULL ) );
+} // end kes_planf_solve_batch
+
+/******************************************************************************/
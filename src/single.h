@@ -0,0 +1,345 @@
+/***************************************************************************//**
+ * @file    single.h
+ * @brief   single-precision starter, iteration and solver functions
+ * @author  Bazso Akos
+ * @version 2026.10
+ *
+ * @copyright
+ * Copyright (C) 2019 Bazso Akos
+ *
+ * This file is part of libkes.
+ *
+ * libkes is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * libkes is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with libkes.  If not, see <https://www.gnu.org/licenses/>.
+ *
+ ******************************************************************************/
+#pragma once
+#ifndef KES_SINGLE__H
+#define KES_SINGLE__H
+
+/* include standard headers */
+#include <stddef.h>
+
+/* include module headers */
+#include "error.h"
+#include "input.h"
+#include "solver.h"
+#include "starter.h"
+#include "utils.h"
+
+/******************************************************************************/
+
+/*** declare macro constants ***/
+
+/* default tolerance of single-precision solvers, relative to max(1, |E|);
+ * smaller tolerances in kes_input_t are raised to this value
+ */
+#define KES_STD_TOLF    2E-7
+
+/* number of lanes of the vectorized single-precision solver, covers one
+ * AVX-512 or two AVX2 registers of type float
+ */
+#define KES_VECF_LEN    16
+
+/******************************************************************************/
+
+/*** declare data structures ***/
+
+/*!
+ * @brief prototype declaration for single-precision starter functions
+ * @details functions return the starting value for the reduced mean anomaly
+ */
+typedef float kes_stmf_t(
+    const float ecc,
+    const float ma
+);
+
+
+/*!
+ * @brief structure containing a single-precision solver plan
+ * @details created by kes_planf_init() for a fixed eccentricity
+ */
+typedef struct
+{
+    float       ecc;     ///< eccentricity of the plan
+    kes_stm_e   init;    ///< starter method
+    kes_sol_e   iter;    ///< solver method
+    kes_ecc_e   type;    ///< eccentricity domain
+    kes_err_e   status;  ///< error code from creation of the plan
+    kes_stmf_t* stm;     ///< resolved starter function
+    int         order;   ///< order of iteration method (2 <= order <= 5)
+    kes_input_t data;    ///< checked input parameters
+} kes_planf_t;
+
+/******************************************************************************/
+
+/*** function declarations ***/
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/*!
+ * @brief reduce mean anomaly of type float to interval [-pi:pi)
+ * @details the reduction is done in double precision, the result is
+ * correctly rounded also for large arguments
+ * @param[in] x angle (in radians)
+ * @return angle x modulo 2*pi (in radians)
+ */
+float kes_reducef(const float x);
+
+
+/*!
+ * @brief single-precision starting value for iteration methods
+ * @details same methods as kes_starter(), KES_STM_ES15 evaluates the
+ * lookup table in double precision
+ * @param[in] ecc eccentricity
+ * @param[in] ma mean anomaly (in radians)
+ * @param[in] type choose a starter method from enum #kes_stm_e
+ * @param[out] status pointer to return error code from enum #kes_err_e
+ * @return starting value x0
+ */
+float kes_starterf(
+    const float     ecc,
+    const float     ma,
+    const kes_stm_e type,
+    kes_err_e*      status
+);
+
+
+/*!
+ * @brief look up the single-precision function of a starter method
+ * @param[in] type a starter method from enum #kes_stm_e
+ * @return pointer to starter function, NULL for an invalid method
+ */
+kes_stmf_t* kes_starterf_func(const kes_stm_e type);
+
+
+/*!
+ * @brief single-precision Newton-Raphson iteration step (order 2)
+ * @param[in] ecc eccentricity
+ * @param[in] ma mean anomaly (in radians)
+ * @param[in] x0 old value of iteration variable
+ * @return updated value of iteration variable
+ */
+float kes_itercore2f(
+    const float ecc,
+    const float ma,
+    const float x0
+);
+
+
+/*!
+ * @brief single-precision Halley iteration step (order 3)
+ * @param[in] ecc eccentricity
+ * @param[in] ma mean anomaly (in radians)
+ * @param[in] x0 old value of iteration variable
+ * @return updated value of iteration variable
+ */
+float kes_itercore3f(
+    const float ecc,
+    const float ma,
+    const float x0
+);
+
+
+/*!
+ * @brief single-precision Danby-Burkardt iteration step (order 4)
+ * @param[in] ecc eccentricity
+ * @param[in] ma mean anomaly (in radians)
+ * @param[in] x0 old value of iteration variable
+ * @return updated value of iteration variable
+ */
+float kes_itercore4f(
+    const float ecc,
+    const float ma,
+    const float x0
+);
+
+
+/*!
+ * @brief single-precision Danby-Burkardt iteration step (order 5)
+ * @param[in] ecc eccentricity
+ * @param[in] ma mean anomaly (in radians)
+ * @param[in] x0 old value of iteration variable
+ * @return updated value of iteration variable
+ */
+float kes_itercore5f(
+    const float ecc,
+    const float ma,
+    const float x0
+);
+
+
+/*!
+ * @brief single-precision solver function for Kepler Equation
+ * @details elliptic orbits with ecc <= KES_NEARPAR_ECC are solved in single
+ * precision with the starter \a init and iterations of the same order as
+ * \a iter, i.e. Newton-Raphson (2), Halley (3), Danby-Burkardt (4, 5),
+ * Markley's and Mikkola's method (5) and Halley's method for all others;
+ * tolerances below KES_STD_TOLF are raised to that value and KES_FIX_AUTO
+ * iterates until convergence; all other orbits are solved by kesolver()
+ * and the result is rounded
+ * @param[in] ecc eccentricity
+ * @param[in] ma mean anomaly (in radians)
+ * @param[in] init choose a starter method from enum #kes_stm_e
+ * @param[in] iter choose a solver method from enum #kes_sol_e
+ * (KES_SOL_AUTO is not supported)
+ * @param[in,out] data pointer to data structure of type #kes_input_t,
+ * returns the number of iterations and the result
+ * @param[out] status pointer to return error code from enum #kes_err_e
+ * @return solution to Kepler Equation
+ */
+float kesolverf(
+    const float     ecc,
+    const float     ma,
+    const kes_stm_e init,
+    const kes_sol_e iter,
+    kes_input_t*    data,
+    kes_err_e*      status
+);
+
+
+/*!
+ * @brief single-precision batch solver function for Kepler Equation
+ * @details same results as kesolverf() for each element; elliptic elements
+ * are collected into blocks of KES_VECF_LEN lanes and solved by vectorized
+ * iterations, all other elements are solved one by one
+ * @param[in] n number of elements
+ * @param[in] ecc array of eccentricities
+ * @param[in] incecc stride of array \a ecc;
+ * use 0 for a single eccentricity common to all elements, 1 for an array
+ * @param[in] ma array of mean anomalies (in radians)
+ * @param[out] ea array of solutions to Kepler Equation
+ * @param[in] init choose a starter method from enum #kes_stm_e
+ * @param[in] iter choose a solver method from enum #kes_sol_e
+ * @param[in] data pointer to data structure of type #kes_input_t
+ * (or NULL for default settings)
+ * @param[out] status optional array of per-element error codes (or NULL)
+ * @param[out] iterations optional array of per-element iterations (or NULL)
+ * @return error code from enum #kes_err_e;
+ * KES_ERR_NOERR if all elements were solved, else code of first failure
+ */
+kes_err_e kesolverf_batch(
+    const size_t       n,
+    const float*       ecc,
+    const size_t       incecc,
+    const float*       ma,
+    float*             ea,
+    const kes_stm_e    init,
+    const kes_sol_e    iter,
+    const kes_input_t* data,
+    kes_err_e*         status,
+    int*               iterations
+);
+
+
+/*!
+ * @brief mixed-precision batch solver function for Kepler Equation
+ * @details elliptic elements with ecc <= KES_NEARPAR_ECC are started and
+ * iterated in single precision in blocks of KES_VECF_LEN lanes as in
+ * kesolverf_batch(), then refined by one double-precision step of
+ * kes_itercore5() for solvers of order 4 and 5, or kes_itercore3()
+ * otherwise; the step is accepted if its order predicts an error below
+ * tolx of \a data (see KES_STOP_ORDER), else the element is solved again
+ * by kesolver(), as are all other elements; the results are accurate to
+ * the double-precision tolerances, at about the throughput of the
+ * single-precision solver; iterations count the single-precision
+ * iterations plus the final step
+ * @param[in] n number of elements
+ * @param[in] ecc array of eccentricities
+ * @param[in] incecc stride of array \a ecc;
+ * use 0 for a single eccentricity common to all elements, 1 for an array
+ * @param[in] ma array of mean anomalies (in radians)
+ * @param[out] ea array of solutions to Kepler Equation
+ * @param[in] init choose a starter method from enum #kes_stm_e
+ * @param[in] iter choose a solver method from enum #kes_sol_e
+ * @param[in] data pointer to data structure of type #kes_input_t
+ * (or NULL for default settings)
+ * @param[out] status optional array of per-element error codes (or NULL)
+ * @param[out] iterations optional array of per-element iterations (or NULL)
+ * @return error code from enum #kes_err_e;
+ * KES_ERR_NOERR if all elements were solved, else code of first failure
+ */
+kes_err_e kesolver_batch_mixed(
+    const size_t       n,
+    const double*      ecc,
+    const size_t       incecc,
+    const double*      ma,
+    double*            ea,
+    const kes_stm_e    init,
+    const kes_sol_e    iter,
+    const kes_input_t* data,
+    kes_err_e*         status,
+    int*               iterations
+);
+
+
+/*!
+ * @brief create a single-precision solver plan for a fixed eccentricity
+ * @param[out] plan pointer to structure of type #kes_planf_t
+ * @param[in] ecc eccentricity
+ * @param[in] init choose a starter method from enum #kes_stm_e
+ * @param[in] iter choose a solver method from enum #kes_sol_e
+ * @param[in] data pointer to data structure of type #kes_input_t
+ * (or NULL for default settings)
+ * @return error code from enum #kes_err_e, also stored in the plan
+ */
+kes_err_e kes_planf_init(
+    kes_planf_t*       plan,
+    const float        ecc,
+    const kes_stm_e    init,
+    const kes_sol_e    iter,
+    const kes_input_t* data
+);
+
+
+/*!
+ * @brief solve Kepler Equation with a single-precision solver plan
+ * @details same result as kesolverf() with the parameters of the plan
+ * @param[in] plan pointer to structure of type #kes_planf_t
+ * @param[in] ma mean anomaly (in radians)
+ * @param[out] status pointer to return error code from enum #kes_err_e
+ * @return solution to Kepler Equation
+ */
+float kes_planf_solve(
+    const kes_planf_t* plan,
+    const float        ma,
+    kes_err_e*         status
+);
+
+
+/*!
+ * @brief solve Kepler Equation with a single-precision plan for an array
+ * @details same results as kesolverf_batch() with the parameters of the plan
+ * @param[in] plan pointer to structure of type #kes_planf_t
+ * @param[in] ma array of mean anomalies (in radians)
+ * @param[out] ea array of solutions to Kepler Equation
+ * @param[in] n number of elements
+ * @return error code from enum #kes_err_e;
+ * KES_ERR_NOERR if all elements were solved, else code of first failure
+ */
+kes_err_e kes_planf_solve_batch(
+    const kes_planf_t* plan,
+    const float*       ma,
+    float*             ea,
+    const size_t       n
+);
+
+#ifdef __cplusplus
+}
+#endif
+
+/******************************************************************************/
+
+#endif  /* KES_SINGLE__H */
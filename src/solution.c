@@ -0,0 +1,266 @@
+/***************************************************************************//**
+ * @file    solution.c
+ * @brief   extended results of solver functions
+ * @author  Bazso Akos
+ * @version 2026.10
+ *
+ * @copyright
+ * Copyright (C) 2019 Bazso Akos
+ *
+ * This file is part of libkes.
+ *
+ * libkes is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * libkes is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with libkes.  If not, see <https://www.gnu.org/licenses/>.
+ *
+ ******************************************************************************/
+/* include standard headers */
+#include <math.h>
+
+/* include module headers */
+#include "solution.h"
+#include "const.h"
+#include "vecmath.h"
+
+/******************************************************************************/
+
+/* number of elements solved per call of kesolver_batch(), size of the work
+ * arrays on the stack
+ */
+#define KES_SOLUTION_BLOCK 256
+
+/******************************************************************************/
+
+/*******************************************************************************
+ *  FUNCTION    : sol_element
+ *  DESCRIPTION : extended result for one solution of Kepler's Equation
+ *  INPUT       : - eccentricity "ecc"
+ *                - eccentricity domain "type" from kes_ecc_e
+ *                - solution "x" of kesolver()
+ *                - compute true anomaly "trueanom" (1) or not (0)
+ *                - pointer to extended result "sol"
+ *  OUTPUT      : none
+ *  REFERENCE   : Stumpff (1959), eqs. (II; 12), (III; 47)
+ ******************************************************************************/
+static void sol_element(
+    const double    ecc,
+    const kes_ecc_e type,
+    const double    x,
+    const int       trueanom,
+    kes_solution_t* sol
+    )
+{
+    sol->x  = x;
+    sol->nu = 0.0;
+
+    if ( type == KES_ECC_HYP )
+    {
+        kes_sinhcosh( &sol->sx, &sol->cx, x, -1.0 );
+        sol->rad = ecc * sol->cx - 1.0;
+        if ( trueanom )
+        {
+            sol->nu = atan2(sqrt(ecc * ecc - 1.0) * sol->sx, ecc - sol->cx);
+        } // end if
+    } // end if
+    else if ( type == KES_ECC_PAR )
+    {
+        /* kesolver() returns the true anomaly */
+        kes_sincos( &sol->sx, &sol->cx, x, -1.0 );
+        sol->rad = 2.0 / (1.0 + sol->cx);
+        sol->nu  = (trueanom ? x : 0.0);
+    } // end if
+    else
+    {
+        kes_vec_sincos( &sol->sx, &sol->cx, x );
+        sol->rad = 1.0 - ecc * sol->cx;
+        if ( trueanom )
+        {
+            sol->nu = atan2(sqrt(1.0 - ecc * ecc) * sol->sx, sol->cx - ecc);
+        } // end if
+    } // end else
+
+    return;
+} // end sol_element
+
+/******************************************************************************/
+
+/*******************************************************************************
+ *  FUNCTION    : sol_block_ell
+ *  DESCRIPTION : sine, cosine and radius for a block of elliptic solutions;
+ *                separate function lets the compiler vectorize the loop
+ *  INPUT       : - number of elements "m"
+ *                - eccentricities "ecc"
+ *                - solutions "ea" of kesolver()
+ *                - arrays "sx", "cx", "rad" for the results
+ *  OUTPUT      : none
+ ******************************************************************************/
+static void sol_block_ell(
+    const size_t           m,
+    const double* restrict ecc,
+    const double* restrict ea,
+    double* restrict       sx,
+    double* restrict       cx,
+    double* restrict       rad
+    )
+{
+    for (size_t i = 0; i < m; i++)
+    {
+        kes_vec_sincos( &sx[i], &cx[i], ea[i] );
+        rad[i] = 1.0 - ecc[i] * cx[i];
+    } // end for
+
+    return;
+} // end sol_block_ell
+
+/******************************************************************************/
+
+/*******************************************************************************
+ *  FUNCTION    : kesolver_ext
+ *  DESCRIPTION : solver function for Kepler Equation with extended result
+ *  INPUT       : - eccentricity "ecc"
+ *                - mean anomaly "ma" (in radians)
+ *                - starter method "init" from kes_stm_e
+ *                - solver method "iter" from kes_sol_e
+ *                - pointer to input parameters "data"
+ *                - compute true anomaly "trueanom" (1) or not (0)
+ *                - pointer to extended result "sol"
+ *  OUTPUT      : error code from kes_err_e
+ ******************************************************************************/
+kes_err_e kesolver_ext(
+    const double    ecc,
+    const double    ma,
+    const kes_stm_e init,
+    const kes_sol_e iter,
+    kes_input_t*    data,
+    const int       trueanom,
+    kes_solution_t* sol
+    )
+{
+    kes_err_e status, tmp;
+
+    const double x = kesolver( ecc, ma, init, iter, data, &status );
+
+    sol_element( ecc, kes_check_ecc( ecc, &tmp ), x, trueanom, sol );
+
+    return( status );
+} // end kesolver_ext
+
+/******************************************************************************/
+
+/*******************************************************************************
+ *  FUNCTION    : kesolver_batch_ext
+ *  DESCRIPTION : batch solver function for Kepler Equation with extended
+ *                results
+ *  INPUT       : - number of elements "n"
+ *                - array of eccentricities "ecc" with stride "incecc"
+ *                - array of mean anomalies "ma" (in radians)
+ *                - array of extended results "sol"
+ *                - starter method "init" from kes_stm_e
+ *                - solver method "iter" from kes_sol_e
+ *                - pointer to input parameters "data" (or NULL)
+ *                - compute true anomaly "trueanom" (1) or not (0)
+ *                - optional array of per-element error codes "status"
+ *  OUTPUT      : error code of the first failing element, or KES_ERR_NOERR
+ ******************************************************************************/
+kes_err_e kesolver_batch_ext(
+    const size_t       n,
+    const double*      ecc,
+    const size_t       incecc,
+    const double*      ma,
+    kes_solution_t*    sol,
+    const kes_stm_e    init,
+    const kes_sol_e    iter,
+    const kes_input_t* data,
+    const int          trueanom,
+    kes_err_e*         status
+    )
+{
+    double    le[KES_SOLUTION_BLOCK];  /* eccentricities of a block */
+    double    ea[KES_SOLUTION_BLOCK];  /* solutions of Kepler's Equation */
+    double    sx[KES_SOLUTION_BLOCK];  /* sin(E) */
+    double    cx[KES_SOLUTION_BLOCK];  /* cos(E) */
+    double    rad[KES_SOLUTION_BLOCK]; /* 1 - e*cos(E) */
+    kes_err_e err[KES_SOLUTION_BLOCK]; /* error codes of a block */
+    kes_ecc_e type[KES_SOLUTION_BLOCK]; /* eccentricity domains */
+    kes_err_e ret = KES_ERR_NOERR;
+    kes_err_e tmp;
+
+    /* nothing to do for empty arrays */
+    if ( n == 0 )
+    {
+        return( ret );
+    } // end if
+
+    /* classify a common eccentricity once */
+    const kes_ecc_e type0 = kes_check_ecc( ecc[0], &tmp );
+
+    for (size_t i0 = 0; i0 < n; i0 += KES_SOLUTION_BLOCK)
+    {
+        const size_t m = ((n - i0 > KES_SOLUTION_BLOCK) ? KES_SOLUTION_BLOCK :
+                          n - i0);
+
+        /* solve Kepler's Equation for the whole block */
+        const kes_err_e code = kesolver_batch( m, ecc + i0 * incecc, incecc,
+                                               ma + i0, ea, init, iter, data,
+                                               err, NULL );
+        if ( ret == KES_ERR_NOERR )
+        {
+            ret = code;
+        } // end if
+
+        /* classify elements, check for blocks of elliptic elements */
+        int simple = 1;
+        for (size_t i = 0; i < m; i++)
+        {
+            le[i]   = ecc[(i0 + i) * incecc];
+            type[i] = ((incecc == 0) ? type0 : kes_check_ecc( le[i], &tmp ));
+            simple  = simple && ((type[i] == KES_ECC_ELL) ||
+                                 (type[i] == KES_ECC_CIRC));
+        } // end for
+
+        if ( simple )
+        {
+            /* vectorized sin, cos and radius */
+            sol_block_ell( m, le, ea, sx, cx, rad );
+
+            for (size_t i = 0; i < m; i++)
+            {
+                kes_solution_t* s = &sol[i0 + i];
+
+                s->x   = ea[i];
+                s->sx  = sx[i];
+                s->cx  = cx[i];
+                s->rad = rad[i];
+                s->nu  = (trueanom ? atan2(sqrt(1.0 - le[i] * le[i]) * sx[i],
+                                           cx[i] - le[i]) : 0.0);
+            } // end for
+        } // end if
+        else
+        {
+            for (size_t i = 0; i < m; i++)
+            {
+                sol_element( le[i], type[i], ea[i], trueanom, &sol[i0 + i] );
+            } // end for
+        } // end else
+
+        /* per-element error codes */
+        if ( status != NULL )
+        {
+            for (size_t i = 0; i < m; i++)
+            {
+                status[i0 + i] = err[i];
+            } // end for
+        } // end if
+    } // end for
+
+    return( ret );
+} // end kesolver_batch_ext
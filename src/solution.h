@@ -0,0 +1,132 @@
+/***************************************************************************//**
+ * @file    solution.h
+ * @brief   extended results of solver functions
+ * @author  Bazso Akos
+ * @version 2026.10
+ *
+ * @copyright
+ * Copyright (C) 2019 Bazso Akos
+ *
+ * This file is part of libkes.
+ *
+ * libkes is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * libkes is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with libkes.  If not, see <https://www.gnu.org/licenses/>.
+ *
+ ******************************************************************************/
+#pragma once
+#ifndef KES_SOLUTION__H
+#define KES_SOLUTION__H
+
+/* include standard headers */
+#include <stddef.h>
+
+/* include module headers */
+#include "error.h"
+#include "input.h"
+#include "solver.h"
+#include "starter.h"
+#include "utils.h"
+
+/******************************************************************************/
+
+/*** declare data structures ***/
+
+/*!
+ * @brief structure containing the extended result of a solver function
+ * @details the quantities needed by most callers after a solve, i.e. for
+ * positions r = a * (cos(E) - e, sqrt(1-e^2) * sin(E)); hyperbolic orbits
+ * use sinh(H), cosh(H), parabolic orbits the true anomaly nu
+ */
+typedef struct
+{
+    double x;   ///< solution E, H or nu, same as the result of kesolver()
+    double sx;  ///< sin(E), sinh(H) or sin(nu)
+    double cx;  ///< cos(E), cosh(H) or cos(nu)
+    double rad; ///< radius r/|a| = |1 - e*cos(E)|, |1 - e*cosh(H)|,
+                ///< or r/q = 2 / (1 + cos(nu)) for parabolic orbits
+    double nu;  ///< true anomaly (in radians) if requested, 0 otherwise
+} kes_solution_t;
+
+/******************************************************************************/
+
+/*** function declarations ***/
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/*!
+ * @brief solver function for Kepler Equation with extended result
+ * @details same solution as kesolver(), plus sine, cosine, radius and
+ * optionally the true anomaly of the solution with one evaluation of
+ * sin/cos (sinh/cosh) and one of atan2() for the true anomaly, instead of
+ * tan(), atan() and sqrt() in kes_trueanom()
+ * @param[in] ecc eccentricity
+ * @param[in] ma mean anomaly (in radians)
+ * @param[in] init choose a starter method from enum #kes_stm_e
+ * @param[in] iter choose a solver method from enum #kes_sol_e
+ * @param[in,out] data pointer to data structure of type #kes_input_t
+ * @param[in] trueanom compute the true anomaly (1) or not (0)
+ * @param[out] sol pointer to extended result of type #kes_solution_t
+ * @return error code from enum #kes_err_e, same as status of kesolver()
+ */
+kes_err_e kesolver_ext(
+    const double    ecc,
+    const double    ma,
+    const kes_stm_e init,
+    const kes_sol_e iter,
+    kes_input_t*    data,
+    const int       trueanom,
+    kes_solution_t* sol
+);
+
+
+/*!
+ * @brief batch solver function for Kepler Equation with extended results
+ * @details same solutions as kesolver_batch(), plus the quantities of
+ * kesolver_ext(); elliptic elements are processed by vectorized loops
+ * @param[in] n number of elements
+ * @param[in] ecc array of eccentricities
+ * @param[in] incecc stride of array \a ecc;
+ * use 0 for a single eccentricity common to all elements, 1 for an array
+ * @param[in] ma array of mean anomalies (in radians)
+ * @param[out] sol array of extended results of type #kes_solution_t
+ * @param[in] init choose a starter method from enum #kes_stm_e
+ * @param[in] iter choose a solver method from enum #kes_sol_e
+ * @param[in] data pointer to data structure of type #kes_input_t
+ * (or NULL for default settings)
+ * @param[in] trueanom compute the true anomaly (1) or not (0)
+ * @param[out] status optional array of per-element error codes (or NULL)
+ * @return error code from enum #kes_err_e;
+ * KES_ERR_NOERR if all elements were solved, else code of first failure
+ */
+kes_err_e kesolver_batch_ext(
+    const size_t       n,
+    const double*      ecc,
+    const size_t       incecc,
+    const double*      ma,
+    kes_solution_t*    sol,
+    const kes_stm_e    init,
+    const kes_sol_e    iter,
+    const kes_input_t* data,
+    const int          trueanom,
+    kes_err_e*         status
+);
+
+#ifdef __cplusplus
+}
+#endif
+
+/******************************************************************************/
+
+#endif  /* KES_SOLUTION__H */
@@ -9,7 +9,7 @@
  *          1.4, 18 Nov 2019
  *          NOTE based on kesolver.c (V1.0)
  *
- * NOTE currently only implemented solver for elliptic case
+ * NOTE the parabolic case returns the true anomaly (see kes_keq_par)
  *
  * @copyright
  * Copyright (C) 2019 Bazso Akos
@@ -31,12 +31,25 @@
  *
  ******************************************************************************/
 /* include standard headers */
+#include <math.h>
 #include <stdio.h>
+#include <string.h>
 
 /* include module headers */
 #include "solver.h"
+#include "autosel.h"
+#include "cache.h"
 #include "const.h"
+#include "hyperb.h"
+#include "kepeq.h"
+#include "parab.h"
+#include "profile.h"
+#include "stats.h"
+#include "table.h"
 #include "utils.h"
+#include "vecmath.h"
+#include "vecore.h"
+#include "vstarter.h"
 
 /* include headers for solver modules */
 #include "bisect.h"
@@ -51,12 +64,22 @@
 #include "nijenh.h"
 #include "secant.h"
 #include "wegsec.h"
+#include "brent.h"
+#include "cordic.h"
+#include "fukush.h"
+#include "eks.h"
+#include "hybrid.h"
 
 /******************************************************************************/
 
 /* show additional debugging information ? 0 = no (default), 1 = yes */
 #define KES_SOLVER_DEBUG 0
 
+/* number of elements per block of kes_plan_solve_batch() with a table, size
+ * of the work arrays on the stack
+ */
+#define KES_SOLVER_BLOCK 256
+
 /******************************************************************************/
 
 /* structure for indirect access to iteration functions */
@@ -82,7 +105,38 @@ static const kes_iter_list_t list_of_iterators[KES_SOL_TOTAL] = {
     {KES_SOL_NEWRAP,  &newrap,  "Newton-Raphson method"},
     {KES_SOL_NIJENH,  &nijenh,  "Nijenhuis method"},
     {KES_SOL_SECANT,  &secant,  "Secant method"},
-    {KES_SOL_WEGSEC,  &wegsec,  "Wegstein's secant modification"}
+    {KES_SOL_WEGSEC,  &wegsec,  "Wegstein's secant modification"},
+    {KES_SOL_BRENT,   &brent,   "Brent's method (bracketing)"},
+    {KES_SOL_CORDIC,  &cordic,  "CORDIC-like method (rotations)"},
+    {KES_SOL_FUKUSH,  &fukush,  "Fukushima method (segments)"},
+    {KES_SOL_EKS,     &eks,     "Enhanced Kepler solver (segmented Taylor)"},
+    {KES_SOL_HYBRID,  &hybrid,  "Safeguarded hybrid method (bracketed)"}
+};
+
+/* fixed number of iterations selected by KES_FIX_AUTO for each starter;
+ * worst case reaching KES_STD_TOL on a dense grid in 0 <= ecc <= 1-1E-12,
+ * 0 <= ma <= pi plus one iteration as margin; 0 = no such bound exists
+ * (iterations from this starter may cycle before converging)
+ * columns: Newton-Raphson, Halley, Danby-Burkardt of order 4 and 5
+ */
+static const int list_of_fixiter[KES_STM_TOTAL][4] = {
+    { 0,  0,  0,  0}, /* KES_STM_NONE */
+    {23, 15, 12, 10}, /* KES_STM_ES00 */
+    { 0, 17,  0,  0}, /* KES_STM_ES01 */
+    { 0, 17,  0,  0}, /* KES_STM_ES02 */
+    { 0, 16,  0,  0}, /* KES_STM_ES03 */
+    {21, 13, 11, 10}, /* KES_STM_ES04 */
+    { 0, 16,  0,  0}, /* KES_STM_ES05 */
+    {22, 14, 11, 10}, /* KES_STM_ES06 */
+    {21, 13, 11, 10}, /* KES_STM_ES07 */
+    {14,  9,  7,  7}, /* KES_STM_ES08 */
+    { 0,  0,  0,  0}, /* KES_STM_ES09 */
+    { 5,  4,  3,  3}, /* KES_STM_ES10 */
+    { 0,  0,  0,  0}, /* KES_STM_ES11 */
+    {20, 12, 10,  9}, /* KES_STM_ES12 */
+    { 0,  0,  0,  0}, /* KES_STM_ES13 */
+    { 6,  4,  4,  3}, /* KES_STM_ES14 */
+    { 2,  1,  1,  1}  /* KES_STM_ES15 */
 };
 
 /******************************************************************************/
@@ -111,6 +165,350 @@ inline void kes_show_solver(const kes_sol_e type)
 
 /******************************************************************************/
 
+/*******************************************************************************
+ * FUNCTION    : kes_resolve_fixiter
+ * DESCRIPTION : resolve fixed number of iterations for elliptic case
+ * INPUT       : - starter method "init" from enum kes_stm_e
+ *               - solver method "iter" from enum kes_sol_e
+ *               - pointer "data" to data structure of type "kes_input_t"
+ * OUTPUT      : number of iterations (0 = iterate until convergence)
+ ******************************************************************************/
+static int kes_resolve_fixiter(
+    const kes_stm_e    init,
+    const kes_sol_e    iter,
+    const kes_input_t* data
+    )
+{
+    int col; /* column in list_of_fixiter */
+
+    /* user defined value or tolerance-driven iterations */
+    if ( data->fixiter != KES_FIX_AUTO )
+    {
+        return( data->fixiter );
+    } // end if
+
+    switch ( iter )
+    {
+        case KES_SOL_NEWRAP:  col = 0; break;
+        case KES_SOL_HALLEY:  col = 1; break;
+        case KES_SOL_DANBUR4: col = 2; break;
+        case KES_SOL_DANBUR5: col = 3; break;
+
+        /* methods with a single correction step */
+        case KES_SOL_MARKLEY:
+        case KES_SOL_MIKKOLA:
+            return( 1 );
+
+        /* fixed iterations not supported */
+        default:
+            return( 0 );
+    } // end switch
+
+    /* NOTE invalid starter methods fall back to KES_STM_ES04 */
+    const kes_stm_e stm = (((init > KES_STM_NONE) && (init < KES_STM_TOTAL)) ?
+                           init : KES_STM_ES04);
+    const int       fix = list_of_fixiter[stm][col];
+
+    return( (fix > 0) ? fix : data->maxiter );
+} // end kes_resolve_fixiter
+
+/******************************************************************************/
+
+/*******************************************************************************
+ * FUNCTION    : kes_init_terms
+ * DESCRIPTION : precompute eccentricity-dependent constants of solver methods
+ * INPUT       : - eccentricity "ecc" (0 < ecc < 1)
+ *               - pointer "terms" to data structure of type "kes_terms_t"
+ * OUTPUT      : none
+ * NOTE expressions have to match the fallback code in the solver modules
+ ******************************************************************************/
+static void kes_init_terms(
+    const double ecc,
+    kes_terms_t* terms
+    )
+{
+    /* common terms */
+    terms->e1      = 1.0 - ecc;
+    terms->corr    = ecc / (1.0 - ecc);
+
+    /* Markley's method, see markley.c */
+    terms->mk_ad   = 1.0 / (M_PISQ - 6.0);
+    terms->mk_ak   = 1.6 * M_PI * terms->mk_ad / (1.0 + ecc);
+    terms->mk_ad  *= 3.0 * M_PISQ;
+    terms->mk_d0   = 3.0 * (1.0 - ecc);
+
+    /* Mikkola's and Nijenhuis' methods, see mikkola.c and nijenh.c */
+    terms->mi_frac = 1.0 / (0.5 + 4.0 * ecc);
+    terms->mi_corr = 0.078 / (1.0 + ecc);
+
+    /* enhanced Kepler solver: table only on request, see kes_eks_init() */
+    terms->ek_init = 0;
+} // end kes_init_terms
+
+/******************************************************************************/
+
+/*******************************************************************************
+ * FUNCTION    : kes_solver_ell_iter
+ * DESCRIPTION : iteration part of solver for elliptic case, with given starter
+ * INPUT       : - eccentricity "ecc"
+ *               - reduced mean anomaly "redma" (0 <= redma <= pi)
+ *               - "side" of mean anomaly before reduction (+1 or -1)
+ *               - pointer "func" to iteration function
+ *               - resolved fixed number of iterations "fixiter"
+ *               - pointer "data" to data structure of type "kes_input_t",
+ *                 with starting value in "data->starter"
+ * OUTPUT      : solution of elliptic Kepler Equation (in radians)
+ ******************************************************************************/
+static inline double kes_solver_ell_iter(
+    const double      ecc,
+    const double      redma,
+    const int         side,
+    kes_iter_t* const func,
+    const int         fixiter,
+    kes_input_t*      data
+    )
+{
+    /* TODO FIXME check convergence for starter value */
+
+    /* call solver/iterator method with resolved number of iterations */
+    const int userfix = data->fixiter;
+    data->fixiter     = fixiter;
+    data->iterations  = func( ecc, redma, data->starter, data );
+    data->fixiter     = userfix;
+
+    /* modify solution (and sin/cos of the last step) if necessary */
+    if ( side < 0 )
+    {
+        data->result = M_2PI - data->result;
+        if ( data->deriv != KES_DERIV_NONE )
+        {
+            kes_trig_t* trig = kes_trig_last();
+            trig->x  = M_2PI - trig->x;
+            trig->es = -trig->es;
+        } // end if
+    } // end if
+
+    return( data->result );
+} // end kes_solver_ell_iter
+
+/******************************************************************************/
+
+/*******************************************************************************
+ * FUNCTION    : kes_reduce_side
+ * DESCRIPTION : reduce mean anomaly for the elliptic case, using the symmetry
+ *               E(2*pi - M) = 2*pi - E(M)
+ * INPUT       : - mean anomaly "ma" (in radians)
+ *               - pointer "side" to return side of mean anomaly after
+ *                 reduction to -pi <= M < pi (+1 if M >= 0, -1 if M < 0)
+ * OUTPUT      : reduced mean anomaly (0 <= redma <= pi)
+ ******************************************************************************/
+static inline double kes_reduce_side(
+    const double ma,
+    int*         side
+    )
+{
+    /* reduce mean anomaly to range -pi <= redma < pi */
+    const double redma = kes_reduce( ma );
+
+    /* check for negative value after reduction */
+    *side = ((redma < 0.0) ? -1 : 1);
+
+    return( fabs( redma ) );
+} // end kes_reduce_side
+
+/******************************************************************************/
+
+/*******************************************************************************
+ * FUNCTION    : kes_solver_ell_table
+ * DESCRIPTION : solver for elliptic case with a piecewise Chebyshev table
+ * INPUT       : - pointer "table" to table from kes_table_new()
+ *               - mean anomaly "ma" (in radians)
+ * OUTPUT      : solution of elliptic Kepler Equation (in radians)
+ ******************************************************************************/
+static inline double kes_solver_ell_table(
+    const kes_table_t* table,
+    const double       ma
+    )
+{
+    int          side;
+    const double redma = kes_reduce_side( ma, &side );
+    const double ea    = kes_table_eval( table, redma );
+
+    return( (side < 0) ? M_2PI - ea : ea );
+} // end kes_solver_ell_table
+
+/******************************************************************************/
+
+/*******************************************************************************
+ * FUNCTION    : kes_solver_ell_direct
+ * DESCRIPTION : solution of elliptic case without iterations, if possible
+ * INPUT       : - eccentricity "ecc"
+ *               - reduced mean anomaly "redma" (0 <= redma <= pi)
+ *               - pointer "data" to data structure of type "kes_input_t",
+ *                 solution stored in "data->result"
+ * OUTPUT      : 1 if solved, 0 otherwise
+ * NOTE exact solutions E = M at the apsides M = 0 and M = pi; for small
+ *      eccentricities the series E = M + sum a_k(M) * ecc^k up to k = 4,
+ *      i.e. the truncation error |a_5| * ecc^5 < 0.55 * ecc^5 is below
+ *      "tolx" if ecc^5 <= tolx (e.g. ecc <= 1E-3 for tolx = 1E-15)
+ * REFERENCE   : Lagrange series, e.g. Murray & Dermott (1999), eq. 2.88
+ ******************************************************************************/
+static inline int kes_solver_ell_direct(
+    const double ecc,
+    const double redma,
+    kes_input_t* data
+    )
+{
+    /* apsides: exact solutions */
+    if ( (redma == 0.0) || (redma == M_PI) )
+    {
+        data->iterations = 0;
+        data->result     = redma;
+        return( 1 );
+    } // end if
+
+    /* exception: eccentricity too large for truncated series */
+    const double e2 = ecc * ecc;
+    if ( e2 * e2 * ecc > data->tolx )
+    {
+        return( 0 );
+    } // end if
+
+    double sx, cx;
+    kes_sincos( &sx, &cx, redma, -1.0 );
+    ++(data->nbrSinEval); ++(data->nbrCosEval);
+
+    /* a_1 = sin(M), a_2 = sin(2M)/2, a_3 = (3*sin(3M) - sin(M))/8,
+     * a_4 = (2*sin(4M) - sin(2M))/6
+     */
+    const double a1 = sx;
+    const double a2 = sx * cx;
+    const double a3 = sx * (1.0 - 1.5 * sx * sx);
+    const double a4 = sx * cx * (8.0 * cx * cx - 5.0) / 3.0;
+
+    data->iterations = 0;
+    data->result     = redma + ecc * (a1 + ecc * (a2 + ecc * (a3 +
+                                      ecc * a4)));
+
+    return( 1 );
+} // end kes_solver_ell_direct
+
+/******************************************************************************/
+
+/*******************************************************************************
+ * FUNCTION    : kes_solver_ell_core
+ * DESCRIPTION : core of solver for elliptic case, with resolved methods
+ * INPUT       : - eccentricity "ecc"
+ *               - mean anomaly "ma" (in radians)
+ *               - pointer "stm" to starter function
+ *               - pointer "func" to iteration function
+ *               - resolved fixed number of iterations "fixiter"
+ *               - pointer "data" to data structure of type "kes_input_t"
+ *               - array "mark" for time stamps of the profiler (or NULL)
+ * OUTPUT      : solution of elliptic Kepler Equation (in radians)
+ ******************************************************************************/
+static inline double kes_solver_ell_core(
+    const double      ecc,
+    const double      ma,
+    kes_stm_t* const  stm,
+    kes_iter_t* const func,
+    const int         fixiter,
+    kes_input_t*      data,
+    uint64_t*         mark
+    )
+{
+    /* reduce mean anomaly to range 0 <= redma <= pi */
+    int          side;
+    const double redma = kes_reduce_side( ma, &side );
+
+    /* special values of mean anomaly or small eccentricity */
+    if ( kes_solver_ell_direct( ecc, redma, data ) )
+    {
+        data->starter = data->result;
+
+        /* modify solution if necessary */
+        if ( side < 0 )
+        {
+            data->result = M_2PI - data->result;
+        } // end if
+
+        return( data->result );
+    } // end if
+
+    /* call starter function */
+    kes_profile_mark( mark, 0 );
+    data->starter = stm( ecc, redma );
+    kes_profile_mark( mark, 1 );
+
+    const double ea = kes_solver_ell_iter( ecc, redma, side, func, fixiter,
+                                           data );
+    kes_profile_mark( mark, 2 );
+
+    return( ea );
+} // end kes_solver_ell_core
+
+/******************************************************************************/
+
+/*******************************************************************************
+ * FUNCTION    : kes_resolve_ell
+ * DESCRIPTION : resolve starter and solver methods for elliptic case
+ * INPUT       : - starter method "init" from enum kes_stm_e
+ *               - solver method "iter" from enum kes_sol_e
+ *               - pointer "stm" to return starter function
+ *               - pointer "func" to return iteration function
+ * OUTPUT      : error code from enum kes_err_e
+ ******************************************************************************/
+static kes_err_e kes_resolve_ell(
+    const kes_stm_e init,
+    const kes_sol_e iter,
+    kes_stm_t**     stm,
+    kes_iter_t**    func
+    )
+{
+    /* default error code: no error */
+    kes_err_e err = KES_ERR_NOERR;
+
+    /* resolve starter function
+     * NOTE use special starter for Nijenhuis method
+     * TODO FIXME check that starter method really applies to elliptic case
+     */
+    *stm = kes_starter_func( (iter != KES_SOL_NIJENH) ? init : KES_STM_ES07 );
+
+    /* exception: check starter method type */
+    if ( *stm == NULL )
+    {
+        /* error handling */
+        err = KES_ERR_BADSTM;
+
+        /* fallback in case of wrong starter method: E0 = M + e */
+        *stm = kes_starter_func( KES_STM_ES04 );
+#if KES_SOLVER_DEBUG
+    kes_show_error( err );
+#endif
+    } // end if
+
+    /* exception: check solver method type */
+    if (
+        (iter <= KES_SOL_NONE) ||
+        (iter >= KES_SOL_TOTAL)
+    ) {
+        /* error handling */
+        err   = KES_ERR_BADSOL;
+        *func = NULL;
+#if KES_SOLVER_DEBUG
+    kes_show_error( err );
+#endif
+    } // end if
+    else
+    {
+        *func = list_of_iterators[iter].func;
+    } // end else
+
+    return( err );
+} // end kes_resolve_ell
+
+/******************************************************************************/
+
 /*******************************************************************************
  * FUNCTION    : kes_solver_ell
  * DESCRIPTION : specialized solver function for elliptic case
@@ -120,6 +518,7 @@ inline void kes_show_solver(const kes_sol_e type)
  *               - solver method "iter" from enum kes_sol_e
  *               - pointer "data" to data structure of type "kes_input_t"
  *               - pointer "status" to return error code (see error.h)
+ *               - array "mark" for time stamps of the profiler (or NULL)
  * OUTPUT      : solution of elliptic Kepler Equation (in radians)
  ******************************************************************************/
 static double kes_solver_ell(
@@ -128,55 +527,189 @@ static double kes_solver_ell(
     const kes_stm_e init,
     const kes_sol_e iter,
     kes_input_t*    data,
-    kes_err_e*      status
+    kes_err_e*      status,
+    uint64_t*       mark
     )
 {
-    /* reduce mean anomaly to range -pi <= redma < pi */
-    double redma = kes_reduce( ma );
+    kes_stm_t*  stm;  /* starter function */
+    kes_iter_t* func; /* iteration function */
 
-    /* side = +1 if redma >= 0, -1 if redma < 0 */
-    int    side  = 1;
+    /* resolve starter and solver methods */
+    *status = kes_resolve_ell( init, iter, &stm, &func );
 
-    /* check for negative value after reduction */
-    if ( redma < 0.0 )
+    /* exception: invalid solver method */
+    if ( func == NULL )
     {
-        side  = -1;
-        redma = -redma;
+        return( 0.0 );
     } // end if
 
-    /* TODO FIXME check for special values of mean anomaly,
-     * e.g. {0, pi/2, pi}
-     * and return solution immediately
+    /* kesolver() has been successful,
+     * or returns solution from fallback starter (KES_ERR_BADSTM)
      */
+    return( kes_solver_ell_core( ecc, ma, stm, func,
+                                 kes_resolve_fixiter( init, iter, data ),
+                                 data, mark ) );
+} // end kes_solver_ell
 
-    /* call starter function
-     * NOTE use special starter for Nijenhuis method
-     * TODO FIXME check that starter method really applies to elliptic case
-     */
-    if ( iter != KES_SOL_NIJENH )
+/******************************************************************************/
+
+/*******************************************************************************
+ * FUNCTION    : kes_npar_region
+ * DESCRIPTION : check if the near-parabolic solver is used for the elliptic
+ *               case, i.e. for ecc > KES_NEARPAR_ECC and in the corner
+ *               ecc > KES_CORNER_ECC, reduced |M| < KES_CORNER_MA +
+ *               KES_CORNER_SLOPE * (ecc - KES_CORNER_ECC)
+ * INPUT       : - eccentricity "ecc"
+ *               - mean anomaly "ma" (in radians)
+ *               - "order" of near-parabolic iteration, see kes_npar_order()
+ * OUTPUT      : 1 if the near-parabolic solver is used, 0 otherwise
+ * NOTE the cubic starter and the cancellation-free iteration converge in a
+ *      few steps in the corner, where E - e*sin(E) and 1 - e*cos(E) lose
+ *      most digits and some methods run to "maxiter"; the bound of M grows
+ *      with ecc, as poor starters (e.g. KES_STM_ES13) diverge from
+ *      M = 0.25 up to M = 0.44 for ecc -> KES_NEARPAR_ECC
+ ******************************************************************************/
+static inline int kes_npar_region(
+    const double ecc,
+    const double ma,
+    const int    order
+    )
+{
+    return( (order > 0) &&
+            ((ecc > KES_NEARPAR_ECC) ||
+             ((ecc > KES_CORNER_ECC) &&
+              (fabs( kes_reduce( ma ) ) <
+               KES_CORNER_MA + KES_CORNER_SLOPE * (ecc - KES_CORNER_ECC)))) );
+} // end kes_npar_region
+
+/******************************************************************************/
+
+/*******************************************************************************
+ * FUNCTION    : kes_solver_npar_core
+ * DESCRIPTION : core of solver for near-parabolic elliptic case
+ * INPUT       : - eccentricity "ecc"
+ *               - mean anomaly "ma" (in radians)
+ *               - "order" of iteration method (2 <= order <= 5)
+ *               - resolved fixed number of iterations "fixiter"
+ *               - pointer "data" to data structure of type "kes_input_t"
+ *               - array "mark" for time stamps of the profiler (or NULL)
+ * OUTPUT      : solution of elliptic Kepler Equation (in radians)
+ ******************************************************************************/
+static inline double kes_solver_npar_core(
+    const double ecc,
+    const double ma,
+    const int    order,
+    const int    fixiter,
+    kes_input_t* data,
+    uint64_t*    mark
+    )
+{
+    /* reduce mean anomaly to range 0 <= redma <= pi */
+    double    redma = kes_reduce( ma );
+    const int side  = ((redma < 0.0) ? -1 : 1);
+    redma           = fabs( redma );
+
+    /* apsides: exact solutions E = M */
+    if ( (redma == 0.0) || (redma == M_PI) )
     {
-        data->starter = kes_starter( ecc, redma, init, status );
+        data->iterations = 0;
+        data->starter    = data->result = redma;
     } // end if
     else
     {
-        data->starter = kes_starter( ecc, redma, KES_STM_ES07, status );
+        /* call starter function */
+        kes_profile_mark( mark, 0 );
+        data->starter = kes_stm_npar( ecc, redma );
+        kes_profile_mark( mark, 1 );
+
+        /* call iteration method with resolved number of iterations */
+        const int userfix = data->fixiter;
+        data->fixiter     = fixiter;
+        data->iterations  = kes_npariter( order, ecc, redma, data->starter,
+                                          data );
+        data->fixiter     = userfix;
+        kes_profile_mark( mark, 2 );
     } // end else
 
-    /* exception: check starter function error code */
-    if ( *status != KES_ERR_NOERR )
+    /* modify solution if necessary */
+    if ( side < 0 )
     {
-        /* error handling */
-        *status = KES_ERR_BADSTM;
+        data->result = M_2PI - data->result;
+    } // end if
 
-        /* fallback in case of wrong starter method */
-        data->starter = redma + ecc;
-#if KES_SOLVER_DEBUG
-    kes_show_error( *status );
-#endif
+    return( data->result );
+} // end kes_solver_npar_core
+
+/******************************************************************************/
+
+/*******************************************************************************
+ * FUNCTION    : kes_solver_hyp_core
+ * DESCRIPTION : core of solver for hyperbolic case, with resolved methods
+ * INPUT       : - eccentricity "ecc"
+ *               - mean anomaly "ma" (in radians)
+ *               - "order" of iteration method (2 <= order <= 5)
+ *               - resolved fixed number of iterations "fixiter"
+ *               - pointer "data" to data structure of type "kes_input_t"
+ *               - array "mark" for time stamps of the profiler (or NULL)
+ * OUTPUT      : solution of hyperbolic Kepler Equation (in radians)
+ ******************************************************************************/
+static inline double kes_solver_hyp_core(
+    const double ecc,
+    const double ma,
+    const int    order,
+    const int    fixiter,
+    kes_input_t* data,
+    uint64_t*    mark
+    )
+{
+    /* apply symmetry H(-M) = -H(M) */
+    const double absma = fabs( ma );
+
+    /* call starter function, NOTE method and eccentricity are checked */
+    kes_err_e hstatus;
+    kes_profile_mark( mark, 0 );
+    data->starter = kes_starter_hyp( ecc, absma, data->hinit, &hstatus );
+    kes_profile_mark( mark, 1 );
+
+    /* call iteration method with resolved number of iterations */
+    const int userfix = data->fixiter;
+    data->fixiter     = fixiter;
+    data->iterations  = kes_hypiter( order, ecc, absma, data->starter, data );
+    data->fixiter     = userfix;
+    kes_profile_mark( mark, 2 );
+
+    /* modify solution if necessary */
+    if ( ma < 0.0 )
+    {
+        data->result = -data->result;
     } // end if
 
-    /* TODO FIXME check convergence for starter value */
+    return( data->result );
+} // end kes_solver_hyp_core
+
+/******************************************************************************/
 
+/*******************************************************************************
+ * FUNCTION    : kes_solver_hyp
+ * DESCRIPTION : specialized solver function for hyperbolic case
+ * INPUT       : - eccentricity "ecc"
+ *               - mean anomaly "ma" (in radians)
+ *               - solver method "iter" from enum kes_sol_e
+ *               - pointer "data" to data structure of type "kes_input_t"
+ *               - pointer "status" to return error code (see error.h)
+ *               - array "mark" for time stamps of the profiler (or NULL)
+ * OUTPUT      : solution of hyperbolic Kepler Equation (in radians)
+ * NOTE the starter method is chosen by "hinit" of the data structure
+ ******************************************************************************/
+static double kes_solver_hyp(
+    const double    ecc,
+    const double    ma,
+    const kes_sol_e iter,
+    kes_input_t*    data,
+    kes_err_e*      status,
+    uint64_t*       mark
+    )
+{
     /* exception: check solver method type */
     if (
         (iter <= KES_SOL_NONE) ||
@@ -190,23 +723,50 @@ static double kes_solver_ell(
         return( 0.0 );
     } // end if
 
-    /* call solver/iterator method */
-    data->iterations = list_of_iterators[iter].func(
-        ecc, redma, data->starter, data
-    );
+    const int order = kes_hyp_order( iter );
+    return( kes_solver_hyp_core( ecc, ma, order,
+                                 kes_hyp_fixiter( order, data->hinit,
+                                                  data->fixiter ),
+                                 data, mark ) );
+} // end kes_solver_hyp
 
-    /* modify solution if necessary */
-    if ( side < 0 )
+/******************************************************************************/
+
+/*******************************************************************************
+ *  FUNCTION    : kes_solver_deriv
+ *  DESCRIPTION : partial derivatives of the solution "data->result",
+ *                from sin/cos of the last step if the solver kept them
+ *  INPUT       : - eccentricity domain "type" from enum kes_ecc_e
+ *                - eccentricity "ecc"
+ *                - pointer "data" to solved data structure
+ *  OUTPUT      : none, derivatives are stored in "data->partial"
+ ******************************************************************************/
+static void kes_solver_deriv(
+    const kes_ecc_e type,
+    const double    ecc,
+    kes_input_t*    data
+    )
+{
+    switch ( type )
     {
-        data->result = M_2PI - data->result;
-    } // end if
+        case KES_ECC_CIRC:
+        case KES_ECC_ELL:
+            kes_deriv_ell( ecc, data->result, kes_trig_last(), data->deriv,
+                           &data->partial );
+            break;
 
-    /* kesolver() has been successful */
-    *status += KES_ERR_NOERR;
+        case KES_ECC_HYP:
+            kes_deriv_hyp( ecc, data->result, data->deriv, &data->partial );
+            break;
 
-    /* finally return result */
-    return( data->result );
-} // end kes_solver_ell
+        case KES_ECC_PAR:
+            kes_deriv_par( data->result, data->deriv, &data->partial );
+            break;
+
+        default:
+            break;
+    } // end switch
+} // end kes_solver_deriv
 
 /******************************************************************************/
 
@@ -230,9 +790,23 @@ double kesolver(
     kes_err_e*      status
     )
 {
-    /* reset error status */
-    *status = KES_ERR_NOERR;
-
+    /* automatic selection: solve with methods of the region of (ecc, ma) */
+    if ( iter == KES_SOL_AUTO )
+    {
+        kes_stm_e stm;
+        kes_sol_e sol;
+        kes_auto_select( ecc, ma, &stm, &sol );
+        return( kesolver( ecc, ma, stm, sol, data, status ) );
+    } // end if
+
+    /* profile this call? time stamps of the solver cores go to "mark" */
+    const int      prof = kes_profile_begin();
+    const uint64_t tic  = (prof ? kes_profile_clock() : 0);
+    uint64_t       mark[KES_PROFILE_MARKS] = { 0, 0, 0 };
+
+    /* reset error status */
+    *status = KES_ERR_NOERR;
+
     /* exception: input contains invalid numbers */
     if (
         (kes_check_val( ecc ) != KES_ERR_NOERR) ||
@@ -248,10 +822,33 @@ double kesolver(
 
     /* check input parameters: {tolf, tolx, maxiter} */
     kes_check_input( data );
+    if ( data->deriv != KES_DERIV_NONE )
+    {
+        kes_trig_last()->x = NAN;
+    } // end if
+
+    /* solution of an earlier call from the cache? */
+    kes_cache_t* cache = kes_cache_begin();
+    if (
+        (cache != NULL) &&
+        kes_cache_lookup( cache, ecc, ma, init, iter, 0, data )
+    ) {
+        if ( data->deriv != KES_DERIV_NONE )
+        {
+            kes_err_e st;
+            kes_solver_deriv( kes_check_ecc( ecc, &st ), ecc, data );
+        } // end if
+        return( data->result );
+    } // end if
 
     /* check eccentricity domain */
     const kes_ecc_e type = kes_check_ecc( ecc, status );
 
+    /* reset outputs, not all cases call an iteration function */
+    data->iterations = 0;
+    data->errDF      = data->errDX = 0.0;
+    data->nbrSinEval = data->nbrCosEval = data->nbrFktEval = 0;
+
     /* choose specialized solver based on eccentricity */
     data->result = 0.0;
     switch ( type )
@@ -275,20 +872,50 @@ double kesolver(
             data->result = ma;
             break;
 
-        /* elliptic case: call iterator and return solution */
+        /* elliptic case: call iterator and return solution,
+         * NOTE near-parabolic orbits use the built-in starter of that solver
+         */
         case KES_ECC_ELL:
             *status = KES_ERR_NOERR;
 #if KES_SOLVER_DEBUG
     kes_show_error( *status );
 #endif
-            data->result = kes_solver_ell(
-                ecc, ma, init, iter, data, status
+            if ( kes_npar_region( ecc, ma, kes_npar_order( iter ) ) )
+            {
+                const int order = kes_npar_order( iter );
+                data->result = kes_solver_npar_core(
+                    ecc, ma, order, kes_npar_fixiter( order, data->fixiter ),
+                    data, (prof ? mark : NULL)
+                );
+            } // end if
+            else
+            {
+                data->result = kes_solver_ell(
+                    ecc, ma, init, iter, data, status, (prof ? mark : NULL)
+                );
+            } // end else
+            break;
+
+        /* hyperbolic case: call iterator and return solution */
+        case KES_ECC_HYP:
+            *status = KES_ERR_NOERR;
+#if KES_SOLVER_DEBUG
+    kes_show_error( *status );
+#endif
+            data->result = kes_solver_hyp(
+                ecc, ma, iter, data, status, (prof ? mark : NULL)
             );
             break;
 
-        /* TODO FIXME hyperbolic & parabolic cases not yet implemented */
+        /* parabolic case: closed-form solution for true anomaly */
         case KES_ECC_PAR:
-        case KES_ECC_HYP:
+            *status = KES_ERR_NOERR;
+#if KES_SOLVER_DEBUG
+    kes_show_error( *status );
+#endif
+            data->result = kes_solve_par( ma );
+            break;
+
         default:
             *status = KES_ERR_BADECC;
 #if KES_SOLVER_DEBUG
@@ -298,8 +925,1926 @@ double kesolver(
             break;
     } // end switch
 
+    /* record successful solves */
+    if ( *status == KES_ERR_NOERR )
+    {
+        if ( prof )
+        {
+            kes_profile_record( init, iter, tic, mark, kes_profile_clock() );
+        } // end if
+        kes_stats_input( kes_stats_begin(), init, iter, ecc, data );
+        if ( cache != NULL )
+        {
+            kes_cache_insert( cache, ecc, ma, init, iter, 0, data );
+        } // end if
+        if ( data->deriv != KES_DERIV_NONE )
+        {
+            kes_solver_deriv( type, ecc, data );
+        } // end if
+    } // end if
+
     /* return final result */
     return( data->result );
 } // end kesolver
 
 /******************************************************************************/
+
+/*******************************************************************************
+ *  FUNCTION    : kes_stats_lanes
+ *  DESCRIPTION : record solves of vectorized lanes in the statistics,
+ *                the residuals are evaluated again as the vectorized
+ *                solvers do not return them
+ *  INPUT       : - starter method "init" and solver method "iter"
+ *                - eccentricity domain "type" (KES_ECC_ELL or KES_ECC_HYP)
+ *                - number of used "lanes"
+ *                - eccentricities "ecc", (reduced) mean anomalies "ma"
+ *                - solutions "x" and number of iterations "count"
+ *                - pointer "data" to input parameters of the lanes
+ *  OUTPUT      : none
+ ******************************************************************************/
+static void kes_stats_lanes(
+    const kes_stm_e    init,
+    const kes_sol_e    iter,
+    const kes_ecc_e    type,
+    const int          lanes,
+    const double*      ecc,
+    const double*      ma,
+    const double*      x,
+    const int*         count,
+    const kes_input_t* data
+    )
+{
+    /* residual evaluated in every iteration (unless fixed iterations),
+     * NOTE Markley's and Mikkola's method perform a single correction step
+     */
+    const int ell = (type == KES_ECC_ELL);
+    const int res = ((data->fixiter == 0) &&
+                     !(ell && ((iter == KES_SOL_MARKLEY) ||
+                               (iter == KES_SOL_MIKKOLA))));
+
+    for (int l = 0; l < lanes; l++)
+    {
+        /* each step evaluates sin/cos (elliptic) and the iteration core */
+        const int c  = count[l];
+        double    df = 0.0;
+        if ( data->fixiter == 0 )
+        {
+            df = (ell ? fabs( kes_keq_ell( ecc[l], ma[l], x[l] ) ) *
+                        ecc[l] / (1.0 - ecc[l]) :
+                        fabs( kes_keq_hyp( ecc[l], ma[l], x[l] ) ) *
+                        ecc[l] / (ecc[l] - 1.0));
+        } // end if
+
+        kes_stats_record( init, iter, ecc[l], c, data->maxiter,
+                          (ell ? c * (1 + res) : 0), (ell ? c : 0),
+                          c * (1 + res), df );
+    } // end for
+} // end kes_stats_lanes
+
+/******************************************************************************/
+
+/*******************************************************************************
+ *  FUNCTION    : kes_report_fail
+ *  DESCRIPTION : record a failing element of a batch in the summary
+ *  INPUT       : - pointer "rep" to summary of the batch
+ *                - optional array "codes" of per-element codes (may be NULL)
+ *                - index "i" and error code "err" of the element
+ *  OUTPUT      : none
+ ******************************************************************************/
+static void kes_report_fail(
+    kes_report_t*   rep,
+    uint8_t*        codes,
+    const size_t    i,
+    const kes_err_e err
+    )
+{
+    if ( rep->failed == 0 )
+    {
+        rep->first = i;
+        rep->err   = err;
+    } // end if
+    ++rep->failed;
+
+    if ( codes != NULL )
+    {
+        codes[i] |= (uint8_t)err;
+    } // end if
+} // end kes_report_fail
+
+/******************************************************************************/
+
+/*******************************************************************************
+ *  FUNCTION    : kes_report_maxiter
+ *  DESCRIPTION : record an element of a batch stopped by "maxiter"
+ *  INPUT       : - pointer "rep" to summary of the batch
+ *                - optional array "codes" of per-element codes (may be NULL)
+ *                - index "i" of the element
+ *  OUTPUT      : none
+ ******************************************************************************/
+static void kes_report_maxiter(
+    kes_report_t* rep,
+    uint8_t*      codes,
+    const size_t  i
+    )
+{
+    ++rep->maxiter;
+
+    if ( codes != NULL )
+    {
+        codes[i] |= KES_FLAG_MAXITER;
+    } // end if
+} // end kes_report_maxiter
+
+/******************************************************************************/
+
+/*******************************************************************************
+ *  FUNCTION    : kes_elem
+ *  DESCRIPTION : address of element "i" of a strided array
+ *  INPUT       : base pointer "base", stride "stride" in bytes, index "i"
+ *  OUTPUT      : pointer to element
+ ******************************************************************************/
+static inline double* kes_elem(
+    double*      base,
+    const size_t stride,
+    const size_t i
+    )
+{
+    return( (double*)((char*)base + i * stride) );
+} // end kes_elem
+
+/******************************************************************************/
+
+/*******************************************************************************
+ *  FUNCTION    : kes_celem
+ *  DESCRIPTION : value of element "i" of a strided array
+ *  INPUT       : base pointer "base", stride "stride" in bytes, index "i"
+ *  OUTPUT      : value of element
+ ******************************************************************************/
+static inline double kes_celem(
+    const double* base,
+    const size_t  stride,
+    const size_t  i
+    )
+{
+    return( *(const double*)((const char*)base + i * stride) );
+} // end kes_celem
+
+/******************************************************************************/
+
+/*******************************************************************************
+ *  FUNCTION    : kes_batch_auto
+ *  DESCRIPTION : batch solver for KES_SOL_AUTO, element by element
+ *  INPUT       : - number of elements "n"
+ *                - eccentricity array "ecc" with stride "secc" in bytes
+ *                - mean anomaly array "ma" (in radians), stride "sma"
+ *                - solution array "ea" (in radians), stride "sea"
+ *                - pointer "work" to checked private input parameters
+ *                - optional arrays "status" and "iterations" (may be NULL)
+ *                - pointer "rep" to summary of the batch
+ *                - optional array "codes" of per-element codes (may be NULL)
+ *                - optional array "deriv" of partial derivatives (may be
+ *                  NULL), order in "work->deriv"
+ *  OUTPUT      : none, errors are recorded in the summary
+ ******************************************************************************/
+static void kes_batch_auto(
+    const size_t  n,
+    const double* ecc,
+    const size_t  secc,
+    const double* ma,
+    const size_t  sma,
+    double*       ea,
+    const size_t  sea,
+    kes_input_t*  work,
+    kes_err_e*    status,
+    int*          iterations,
+    kes_report_t* rep,
+    uint8_t*      codes,
+    kes_deriv_t*  deriv
+    )
+{
+    kes_err_e err;
+
+    for (size_t i = 0; i < n; i++)
+    {
+        /* NOTE kesolver() resets the outputs of the work space only for
+         * valid input, an invalid mean anomaly returns before
+         */
+        work->iterations = 0;
+        *kes_elem( ea, sea, i ) = kesolver( kes_celem( ecc, secc, i ),
+                                            kes_celem( ma, sma, i ),
+                                            KES_STM_NONE, KES_SOL_AUTO, work,
+                                            &err );
+
+        /* optional per-element outputs */
+        if ( status != NULL )
+        {
+            status[i] = err;
+        } // end if
+        if ( iterations != NULL )
+        {
+            iterations[i] = work->iterations;
+        } // end if
+
+        /* summary, rare cases */
+        if ( err != KES_ERR_NOERR )
+        {
+            kes_report_fail( rep, codes, i, err );
+        } // end if
+        if ( work->iterations >= work->maxiter )
+        {
+            kes_report_maxiter( rep, codes, i );
+        } // end if
+
+        /* derivatives from kesolver(), zero for failing elements */
+        if ( deriv != NULL )
+        {
+            if ( (err == KES_ERR_NOERR) &&
+                 (work->iterations < work->maxiter) )
+            {
+                deriv[i] = work->partial;
+            } // end if
+            else
+            {
+                memset( &deriv[i], 0, sizeof(deriv[i]) );
+            } // end else
+        } // end if
+    } // end for
+} // end kes_batch_auto
+
+/******************************************************************************/
+
+/*******************************************************************************
+ *  FUNCTION    : kes_batch_body
+ *  DESCRIPTION : common part of the batch solver functions for strided
+ *                arrays, inlined into kes_batch_core() for unit strides and
+ *                into kes_batch_gather() for others
+ *  INPUT       : - number of elements "n"
+ *                - eccentricity array "ecc" with stride "secc" in bytes
+ *                  (secc = 0 uses the same eccentricity for all elements)
+ *                - mean anomaly array "ma" (in radians), stride "sma"
+ *                - solution array "ea" (in radians), stride "sea"
+ *                - starter method "init" from enum kes_stm_e
+ *                - solver method "iter" from enum kes_sol_e
+ *                - pointer "data" to input parameters (may be NULL)
+ *                - optional arrays "status" and "iterations" (may be NULL)
+ *                - pointer "rep" to summary of the batch, initialized
+ *                - optional array "codes" of per-element codes (may be NULL),
+ *                  initialized to zero
+ *                - optional array "deriv" of partial derivatives (may be
+ *                  NULL), from sin/cos of the last step of lanes and
+ *                  scalar solvers, zero for failing elements
+ *  OUTPUT      : none, errors are recorded in the summary
+ *  NOTE elements are gathered from the strided arrays into the lanes of the
+ *       vectorized solvers and the solutions are scattered back, i.e. no
+ *       copies of the arrays are needed
+ ******************************************************************************/
+static inline __attribute__((always_inline)) void kes_batch_body(
+    const size_t       n,
+    const double*      ecc,
+    const size_t       secc,
+    const double*      ma,
+    const size_t       sma,
+    double*            ea,
+    const size_t       sea,
+    const kes_stm_e    init,
+    const kes_sol_e    iter,
+    const kes_input_t* data,
+    kes_err_e*         status,
+    int*               iterations,
+    kes_report_t*      rep,
+    uint8_t*           codes,
+    kes_deriv_t*       deriv
+    )
+{
+    kes_stm_t*  stm;  /* starter function */
+    kes_iter_t* func; /* iteration function */
+    kes_err_e   err;  /* error code of current element */
+
+    /* lanes of elliptic elements for vectorized solvers */
+    size_t idx[KES_VEC_LEN];     /* element index */
+    double lecc[KES_VEC_LEN];    /* eccentricity */
+    double lma[KES_VEC_LEN];     /* reduced mean anomaly */
+    double lstm[KES_VEC_LEN];    /* starter value */
+    double lea[KES_VEC_LEN];     /* solution */
+    int    lside[KES_VEC_LEN];   /* side of reduced mean anomaly */
+    int    lcount[KES_VEC_LEN];  /* number of iterations */
+    kes_vtrig_t ltrig;           /* sin/cos of the last step */
+
+    /* lanes of hyperbolic elements for vectorized solvers */
+    size_t hidx[KES_VEC_LEN];    /* element index */
+    double hecc[KES_VEC_LEN];    /* eccentricity */
+    double hma[KES_VEC_LEN];     /* absolute value of mean anomaly */
+    double hstm[KES_VEC_LEN];    /* starter value */
+    double hea[KES_VEC_LEN];     /* solution */
+    int    hcount[KES_VEC_LEN];  /* number of iterations */
+
+    /* private copy of input parameters, check and set defaults once */
+    kes_input_t work = ((data != NULL) ? *data : kes_new_input());
+    kes_check_input( &work );
+
+    /* order of derivatives, NOTE also makes the scalar solvers keep sin/cos
+     * of their last step
+     */
+    if ( deriv != NULL )
+    {
+        work.deriv = ((work.deriv == KES_DERIV_NONE) ? KES_DERIV_FIRST :
+                                                       work.deriv);
+    } // end if
+    const kes_deriv_e level = work.deriv;
+
+    /* automatic selection: methods differ between elements */
+    if ( iter == KES_SOL_AUTO )
+    {
+        kes_batch_auto( n, ecc, secc, ma, sma, ea, sea, &work, status,
+                        iterations, rep, codes, deriv );
+        return;
+    } // end if
+
+    /* resolve starter and solver methods once */
+    const kes_err_e method = kes_resolve_ell( init, iter, &stm, &func );
+
+    /* resolve order and fixed number of iterations for hyperbolic case */
+    const int       order  = kes_hyp_order( iter );
+    kes_input_t     hwork  = work;
+    hwork.fixiter          = kes_hyp_fixiter( order, work.hinit,
+                                              work.fixiter );
+    const kes_err_e hmethod = ((func != NULL) ? KES_ERR_NOERR : KES_ERR_BADSOL);
+
+    /* resolve order and fixed number of iterations for near-parabolic case */
+    const int       norder = kes_npar_order( iter );
+    const int       nfix   = ((norder > 0) ?
+                              kes_npar_fixiter( norder, work.fixiter ) : 0);
+
+    /* resolve fixed number of iterations once */
+    work.fixiter = kes_resolve_fixiter( init, iter, &work );
+
+    /* use vectorized solver for elliptic elements if available */
+    const int vector = ((func != NULL) && kes_vsolve_supported( iter ));
+
+    /* use vectorized starter for the lanes if available,
+     * NOTE same fallback as kes_resolve_ell() for an invalid starter
+     */
+    const kes_stm_e vinit  = ((kes_starter_func( init ) != NULL) ?
+                              init : KES_STM_ES04);
+    const int       vstart = (vector && (iter != KES_SOL_MARKLEY) &&
+                              (iter != KES_SOL_MIKKOLA) &&
+                              kes_vstarter_supported( vinit ));
+
+    /* record statistics of this call? */
+    const int stats  = kes_stats_begin();
+
+    /* classify a common eccentricity once */
+    kes_ecc_e type = kes_check_ecc( ecc[0], &err );
+
+    /* precompute constants for a common elliptic eccentricity once */
+    kes_terms_t terms;
+    if ( (secc == 0) && (type == KES_ECC_ELL) )
+    {
+        kes_init_terms( ecc[0], &terms );
+        if ( iter == KES_SOL_EKS )
+        {
+            kes_eks_init( ecc[0], &terms );
+        } // end if
+        work.terms = &terms;
+    } // end if
+
+    for (size_t i0 = 0; i0 < n; i0 += KES_VEC_LEN)
+    {
+        const size_t iend  = ((n - i0 > KES_VEC_LEN) ? i0 + KES_VEC_LEN : n);
+        int          lanes = 0;
+        int          hlanes = 0;
+
+        for (size_t i = i0; i < iend; i++)
+        {
+            const double e  = kes_celem( ecc, secc, i );
+            const double m  = kes_celem( ma, sma, i );
+            double*      ei = kes_elem( ea, sea, i );
+            int          inlane = 0; /* collected into a lane? */
+
+            if ( deriv != NULL )
+            {
+                kes_trig_last()->x = NAN;
+            } // end if
+
+            /* classify eccentricity per element if necessary */
+            if ( secc != 0 )
+            {
+                type = kes_check_ecc( e, &err );
+            } // end if
+
+            work.iterations = 0;
+            work.errDF      = 0.0;
+            work.nbrSinEval = work.nbrCosEval = work.nbrFktEval = 0;
+
+            /* exception: input contains invalid numbers */
+            if ( kes_check_val( m ) != KES_ERR_NOERR )
+            {
+                err   = KES_ERR_BADVAL;
+                *ei   = 0.0;
+            } // end if
+            else if ( (type == KES_ECC_ELL) && kes_npar_region( e, m, norder ) )
+            {
+                /* NOTE rare case, solved element by element */
+                *ei   = kes_solver_npar_core( e, m, norder, nfix, &work,
+                                              NULL );
+                err   = KES_ERR_NOERR;
+                kes_stats_input( stats, init, iter, e, &work );
+            } // end if
+            else if ( type == KES_ECC_ELL )
+            {
+                if ( vector )
+                {
+                    /* reduce mean anomaly to range 0 <= redma <= pi */
+                    double redma = kes_reduce( m );
+                    lside[lanes] = ((redma < 0.0) ? -1 : 1);
+                    redma        = fabs( redma );
+
+                    /* special values of mean anomaly or small eccentricity,
+                     * solved without a lane
+                     */
+                    if ( kes_solver_ell_direct( e, redma, &work ) )
+                    {
+                        *ei   = ((lside[lanes] < 0) ?
+                                 M_2PI - work.result : work.result);
+                        kes_stats_input( stats && (method == KES_ERR_NOERR),
+                                         init, iter, e, &work );
+                    } // end if
+                    else
+                    {
+                        /* collect lane, solved after this block is filled */
+                        idx[lanes]  = i;
+                        lecc[lanes] = e;
+                        lma[lanes]  = redma;
+                        lstm[lanes] = ((!vstart &&
+                                        (iter != KES_SOL_MARKLEY) &&
+                                        (iter != KES_SOL_MIKKOLA)) ?
+                                       stm( e, redma ) : 0.0);
+                        ++lanes;
+                        *ei         = 0.0;
+                        inlane      = 1;
+                    } // end else
+                } // end if
+                else if ( func != NULL )
+                {
+                    *ei   = kes_solver_ell_core( e, m, stm, func, work.fixiter,
+                                                 &work, NULL );
+                    kes_stats_input( stats && (method == KES_ERR_NOERR),
+                                     init, iter, e, &work );
+                } // end if
+                else
+                {
+                    *ei   = 0.0;
+                } // end else
+                err = method;
+            } // end if
+            else if ( type == KES_ECC_CIRC )
+            {
+                err   = KES_ERR_NOERR;
+                *ei   = m;
+                kes_stats_input( stats, init, iter, e, &work );
+            } // end if
+            else if ( type == KES_ECC_HYP )
+            {
+                if ( func != NULL )
+                {
+                    /* collect lane, solved after this block is filled */
+                    hidx[hlanes]  = i;
+                    hecc[hlanes]  = e;
+                    hma[hlanes]   = fabs( m );
+                    ++hlanes;
+                    inlane        = 1;
+                } // end if
+                *ei   = 0.0;
+                err   = hmethod;
+            } // end if
+            else if ( type == KES_ECC_PAR )
+            {
+                err   = KES_ERR_NOERR;
+                *ei   = kes_solve_par( m );
+                kes_stats_input( stats, init, iter, e, &work );
+            } // end if
+            else
+            {
+                err   = ((kes_check_val( e ) != KES_ERR_NOERR) ?
+                         KES_ERR_BADVAL : KES_ERR_BADECC);
+                *ei   = 0.0;
+            } // end else
+
+            /* optional per-element outputs */
+            if ( status != NULL )
+            {
+                status[i] = err;
+            } // end if
+            if ( iterations != NULL )
+            {
+                iterations[i] = work.iterations;
+            } // end if
+
+            /* summary, rare cases; lanes are checked after their solve */
+            if ( err != KES_ERR_NOERR )
+            {
+                kes_report_fail( rep, codes, i, err );
+            } // end if
+            if ( work.iterations >= work.maxiter )
+            {
+                kes_report_maxiter( rep, codes, i );
+            } // end if
+
+            /* derivatives of elements solved on their own, from sin/cos of
+             * the last step of the scalar solvers if they kept them
+             */
+            if ( (deriv != NULL) && !inlane )
+            {
+                memset( &deriv[i], 0, sizeof(deriv[i]) );
+                if ( (err == KES_ERR_NOERR) &&
+                     (work.iterations < work.maxiter) )
+                {
+                    if ( (type == KES_ECC_ELL) || (type == KES_ECC_CIRC) )
+                    {
+                        kes_deriv_ell( e, *ei, kes_trig_last(), level,
+                                       &deriv[i] );
+                    } // end if
+                    else if ( type == KES_ECC_PAR )
+                    {
+                        kes_deriv_par( *ei, level, &deriv[i] );
+                    } // end if
+                } // end if
+            } // end if
+        } // end for
+
+        /* solve collected elliptic elements of this block at once */
+        if ( lanes > 0 )
+        {
+            /* fill unused lanes with harmless dummy values */
+            for (int l = lanes; l < KES_VEC_LEN; l++)
+            {
+                lecc[l] = 0.5;
+                lma[l]  = 1.0;
+                lstm[l] = 1.5;
+            } // end for
+
+            if ( vstart )
+            {
+                kes_vstarter( vinit, lecc, lma, lstm );
+            } // end if
+
+            kes_vsolve_ell( iter, lecc, lma, lstm, lea, lcount, &work,
+                            ((deriv != NULL) ? &ltrig : NULL) );
+
+            /* scatter results, modify solution if necessary */
+            for (int l = 0; l < lanes; l++)
+            {
+                *kes_elem( ea, sea, idx[l] ) = ((lside[l] < 0) ?
+                                                M_2PI - lea[l] : lea[l]);
+                if ( iterations != NULL )
+                {
+                    iterations[idx[l]] = lcount[l];
+                } // end if
+                if ( lcount[l] >= work.maxiter )
+                {
+                    kes_report_maxiter( rep, codes, idx[l] );
+                } // end if
+
+                /* derivatives from sin/cos of the last step of the lane,
+                 * zero for failing lanes
+                 */
+                if ( deriv != NULL )
+                {
+                    kes_deriv_t* d = &deriv[idx[l]];
+                    memset( d, 0, sizeof(*d) );
+                    if ( (method == KES_ERR_NOERR) &&
+                         (lcount[l] < work.maxiter) )
+                    {
+                        const kes_trig_t t = {
+                            ((lside[l] < 0) ? M_2PI - ltrig.x[l] :
+                                              ltrig.x[l]),
+                            ((lside[l] < 0) ? -ltrig.es[l] : ltrig.es[l]),
+                            ltrig.ec[l]
+                        };
+                        kes_deriv_ell( lecc[l], *kes_elem( ea, sea, idx[l] ),
+                                       &t, level, d );
+                    } // end if
+                } // end if
+            } // end for
+
+            if ( stats )
+            {
+                kes_stats_lanes( init, iter, KES_ECC_ELL, lanes, lecc, lma,
+                                 lea, lcount, &work );
+            } // end if
+        } // end if
+
+        /* solve collected hyperbolic elements of this block at once */
+        if ( hlanes > 0 )
+        {
+            /* fill unused lanes with harmless dummy values */
+            for (int l = hlanes; l < KES_VEC_LEN; l++)
+            {
+                hecc[l] = 2.0;
+                hma[l]  = 1.0;
+            } // end for
+
+            /* starters of all lanes at once */
+            kes_vstm_hyp( hwork.hinit, hecc, hma, hstm );
+
+            kes_vsolve_hyp( order, hecc, hma, hstm, hea, hcount, &hwork );
+
+            /* scatter results, apply symmetry H(-M) = -H(M) */
+            for (int l = 0; l < hlanes; l++)
+            {
+                *kes_elem( ea, sea, hidx[l] ) =
+                    ((kes_celem( ma, sma, hidx[l] ) < 0.0) ? -hea[l] : hea[l]);
+                if ( iterations != NULL )
+                {
+                    iterations[hidx[l]] = hcount[l];
+                } // end if
+                if ( hcount[l] >= hwork.maxiter )
+                {
+                    kes_report_maxiter( rep, codes, hidx[l] );
+                } // end if
+
+                /* derivatives, zero for failing lanes */
+                if ( deriv != NULL )
+                {
+                    kes_deriv_t* d = &deriv[hidx[l]];
+                    memset( d, 0, sizeof(*d) );
+                    if ( (hmethod == KES_ERR_NOERR) &&
+                         (hcount[l] < hwork.maxiter) )
+                    {
+                        kes_deriv_hyp( hecc[l], *kes_elem( ea, sea, hidx[l] ),
+                                       level, d );
+                    } // end if
+                } // end if
+            } // end for
+
+            if ( stats )
+            {
+                kes_stats_lanes( init, iter, KES_ECC_HYP, hlanes, hecc, hma,
+                                 hea, hcount, &hwork );
+            } // end if
+        } // end if
+    } // end for
+} // end kes_batch_body
+
+/******************************************************************************/
+
+/*******************************************************************************
+ *  FUNCTION    : kes_batch_core
+ *  DESCRIPTION : common part of the batch solver functions, contiguous
+ *                arrays of mean anomalies and solutions
+ *  INPUT       : - number of elements "n"
+ *                - eccentricity array "ecc" with stride "incecc"
+ *                  (incecc = 0 uses the same eccentricity for all elements)
+ *                - mean anomaly array "ma" (in radians)
+ *                - solution array "ea" (in radians)
+ *                - remaining arguments as for kes_batch_body()
+ *  OUTPUT      : none, errors are recorded in the summary
+ ******************************************************************************/
+static void kes_batch_core(
+    const size_t       n,
+    const double*      ecc,
+    const size_t       incecc,
+    const double*      ma,
+    double*            ea,
+    const kes_stm_e    init,
+    const kes_sol_e    iter,
+    const kes_input_t* data,
+    kes_err_e*         status,
+    int*               iterations,
+    kes_report_t*      rep,
+    uint8_t*           codes,
+    kes_deriv_t*       deriv
+    )
+{
+    /* NOTE constant strides of ma and ea, indexed as plain arrays */
+    kes_batch_body( n, ecc, incecc * sizeof(double), ma, sizeof(double),
+                    ea, sizeof(double), init, iter, data, status, iterations,
+                    rep, codes, deriv );
+} // end kes_batch_core
+
+/******************************************************************************/
+
+/*******************************************************************************
+ *  FUNCTION    : kes_batch_gather
+ *  DESCRIPTION : common part of the batch solver functions, arbitrary
+ *                strides of all arrays
+ *  INPUT       : same as kes_batch_body()
+ *  OUTPUT      : none, errors are recorded in the summary
+ ******************************************************************************/
+static void kes_batch_gather(
+    const size_t       n,
+    const double*      ecc,
+    const size_t       secc,
+    const double*      ma,
+    const size_t       sma,
+    double*            ea,
+    const size_t       sea,
+    const kes_stm_e    init,
+    const kes_sol_e    iter,
+    const kes_input_t* data,
+    kes_err_e*         status,
+    int*               iterations,
+    kes_report_t*      rep,
+    uint8_t*           codes,
+    kes_deriv_t*       deriv
+    )
+{
+    kes_batch_body( n, ecc, secc, ma, sma, ea, sea, init, iter, data,
+                    status, iterations, rep, codes, deriv );
+} // end kes_batch_gather
+
+/******************************************************************************/
+
+/*******************************************************************************
+ *  FUNCTION    : kes_report_init
+ *  DESCRIPTION : empty summary of a batch of "n" elements
+ *  INPUT       : number of elements "n"
+ *  OUTPUT      : summary without errors
+ ******************************************************************************/
+static kes_report_t kes_report_init(const size_t n)
+{
+    const kes_report_t rep = {
+        .failed = 0, .first = n, .err = KES_ERR_NOERR, .maxiter = 0
+    };
+    return( rep );
+} // end kes_report_init
+
+/******************************************************************************/
+
+/*******************************************************************************
+ *  FUNCTION    : kesolver_batch
+ *  DESCRIPTION : batch solver function for Kepler Equation
+ *  INPUT       : - number of elements "n"
+ *                - eccentricity array "ecc" with stride "incecc"
+ *                  (incecc = 0 uses the same eccentricity for all elements)
+ *                - mean anomaly array "ma" (in radians)
+ *                - solution array "ea" (in radians)
+ *                - starter method "init" from enum kes_stm_e
+ *                - solver method "iter" from enum kes_sol_e
+ *                - pointer "data" to input parameters (may be NULL)
+ *                - optional arrays "status" and "iterations" (may be NULL)
+ *  OUTPUT      : KES_ERR_NOERR if all elements were solved successfully,
+ *                otherwise error code of the first failing element
+ ******************************************************************************/
+kes_err_e kesolver_batch(
+    const size_t       n,
+    const double*      ecc,
+    const size_t       incecc,
+    const double*      ma,
+    double*            ea,
+    const kes_stm_e    init,
+    const kes_sol_e    iter,
+    const kes_input_t* data,
+    kes_err_e*         status,
+    int*               iterations
+    )
+{
+    kes_report_t rep = kes_report_init( n );
+
+    /* nothing to do for empty arrays */
+    if ( n == 0 )
+    {
+        return( rep.err );
+    } // end if
+
+    kes_batch_core( n, ecc, incecc, ma, ea, init, iter, data,
+                    status, iterations, &rep, NULL, NULL );
+
+    return( rep.err );
+} // end kesolver_batch
+
+/******************************************************************************/
+
+/*******************************************************************************
+ *  FUNCTION    : kesolver_batch_strided
+ *  DESCRIPTION : batch solver function for Kepler Equation on strided arrays
+ *  INPUT       : - number of elements "n"
+ *                - eccentricities "ecc" with stride "strecc" in bytes
+ *                  (strecc = 0 uses the same eccentricity for all elements)
+ *                - mean anomalies "ma" (in radians) with stride "strma"
+ *                - solutions "ea" (in radians) with stride "strea"
+ *                - starter method "init" from enum kes_stm_e
+ *                - solver method "iter" from enum kes_sol_e
+ *                - pointer "data" to input parameters (may be NULL)
+ *                - optional arrays "status" and "iterations" (may be NULL)
+ *  OUTPUT      : KES_ERR_NOERR if all elements were solved successfully,
+ *                otherwise error code of the first failing element
+ ******************************************************************************/
+kes_err_e kesolver_batch_strided(
+    const size_t       n,
+    const double*      ecc,
+    const size_t       strecc,
+    const double*      ma,
+    const size_t       strma,
+    double*            ea,
+    const size_t       strea,
+    const kes_stm_e    init,
+    const kes_sol_e    iter,
+    const kes_input_t* data,
+    kes_err_e*         status,
+    int*               iterations
+    )
+{
+    kes_report_t rep = kes_report_init( n );
+
+    /* nothing to do for empty arrays */
+    if ( n == 0 )
+    {
+        return( rep.err );
+    } // end if
+
+    /* exception: all solutions to the same address */
+    if ( (strea == 0) && (n > 1) )
+    {
+        return( KES_ERR_BADVAL );
+    } // end if
+
+    /* contiguous arrays: same code as kesolver_batch() */
+    if ( (strma == sizeof(double)) && (strea == sizeof(double)) &&
+         ((strecc == 0) || (strecc == sizeof(double))) )
+    {
+        kes_batch_core( n, ecc, strecc / sizeof(double), ma, ea, init, iter,
+                        data, status, iterations, &rep, NULL, NULL );
+    } // end if
+    else
+    {
+        kes_batch_gather( n, ecc, strecc, ma, strma, ea, strea, init, iter,
+                          data, status, iterations, &rep, NULL, NULL );
+    } // end else
+
+    return( rep.err );
+} // end kesolver_batch_strided
+
+/******************************************************************************/
+
+/*******************************************************************************
+ *  FUNCTION    : kesolver_batch_report
+ *  DESCRIPTION : batch solver function for Kepler Equation with a summary
+ *                of errors instead of per-element error codes
+ *  INPUT       : same as kesolver_batch(), pointer "report" to summary
+ *                (may be NULL) and optional array "codes" of per-element
+ *                codes (may be NULL) instead of "status" and "iterations"
+ *  OUTPUT      : KES_ERR_NOERR if all elements were solved successfully,
+ *                otherwise error code of the first failing element
+ ******************************************************************************/
+kes_err_e kesolver_batch_report(
+    const size_t       n,
+    const double*      ecc,
+    const size_t       incecc,
+    const double*      ma,
+    double*            ea,
+    const kes_stm_e    init,
+    const kes_sol_e    iter,
+    const kes_input_t* data,
+    kes_report_t*      report,
+    uint8_t*           codes
+    )
+{
+    kes_report_t rep = kes_report_init( n );
+
+    if ( n > 0 )
+    {
+        /* NOTE only failing elements are written in the loop */
+        if ( codes != NULL )
+        {
+            memset( codes, 0, n );
+        } // end if
+
+        kes_batch_core( n, ecc, incecc, ma, ea, init, iter, data,
+                        NULL, NULL, &rep, codes, NULL );
+    } // end if
+
+    if ( report != NULL )
+    {
+        *report = rep;
+    } // end if
+
+    return( rep.err );
+} // end kesolver_batch_report
+
+/******************************************************************************/
+
+/*******************************************************************************
+ *  FUNCTION    : kesolver_batch_deriv
+ *  DESCRIPTION : batch solver function for Kepler Equation returning the
+ *                partial derivatives of the solutions
+ *  INPUT       : same as kesolver_batch() and array "deriv" of derivatives,
+ *                order of derivatives from "data->deriv" (KES_DERIV_FIRST
+ *                if data is NULL or data->deriv is KES_DERIV_NONE)
+ *  OUTPUT      : KES_ERR_NOERR if all elements were solved successfully,
+ *                otherwise error code of the first failing element
+ ******************************************************************************/
+kes_err_e kesolver_batch_deriv(
+    const size_t       n,
+    const double*      ecc,
+    const size_t       incecc,
+    const double*      ma,
+    double*            ea,
+    const kes_stm_e    init,
+    const kes_sol_e    iter,
+    const kes_input_t* data,
+    kes_deriv_t*       deriv,
+    kes_err_e*         status,
+    int*               iterations
+    )
+{
+    kes_report_t rep = kes_report_init( n );
+
+    /* nothing to do for empty arrays */
+    if ( n == 0 )
+    {
+        return( rep.err );
+    } // end if
+
+    /* exception: no array for the derivatives */
+    if ( deriv == NULL )
+    {
+        rep.err = KES_ERR_BADVAL;
+        return( rep.err );
+    } // end if
+
+    /* derivatives from sin/cos of the last step of each element, zero for
+     * failing elements
+     */
+    kes_batch_core( n, ecc, incecc, ma, ea, init, iter, data,
+                    status, iterations, &rep, NULL, deriv );
+
+    return( rep.err );
+} // end kesolver_batch_deriv
+
+/******************************************************************************/
+
+/*******************************************************************************
+ * FUNCTION    : kesolver_cfg
+ * DESCRIPTION : solver function for Kepler Equation with a shared
+ *               configuration and a compact result record
+ * INPUT       : - eccentricity "ecc"
+ *               - mean anomaly "ma" (in radians)
+ *               - starter method "init" from kes_stm_e
+ *               - solver method "iter" from kes_sol_e
+ *               - pointer to configuration "cfg" (read only, or NULL)
+ *               - pointer to result record "res" (or NULL)
+ * OUTPUT      : solution to Kepler Equation
+ ******************************************************************************/
+double kesolver_cfg(
+    const double        ecc,
+    const double        ma,
+    const kes_stm_e     init,
+    const kes_sol_e     iter,
+    const kes_config_t* cfg,
+    kes_result_t*       res
+    )
+{
+    kes_err_e status;
+
+    /* NOTE private work space on the stack, cfg is never written */
+    kes_input_t data = kes_input_from_config( cfg );
+
+    const double x = kesolver( ecc, ma, init, iter, &data, &status );
+
+    if ( res != NULL )
+    {
+        res->errDF      = (float)data.errDF;
+        res->errDX      = (float)data.errDX;
+        res->iterations = data.iterations;
+        res->status     = status;
+    } // end if
+
+    return( x );
+} // end kesolver_cfg
+
+/******************************************************************************/
+
+/*******************************************************************************
+ * FUNCTION    : kesolver_batch_cfg
+ * DESCRIPTION : batch solver function for Kepler Equation with a shared
+ *               configuration
+ * INPUT       : same as kesolver_batch(), configuration "cfg" instead of
+ *               input parameters "data"
+ * OUTPUT      : error code of the first failing element, or KES_ERR_NOERR
+ ******************************************************************************/
+kes_err_e kesolver_batch_cfg(
+    const size_t        n,
+    const double*       ecc,
+    const size_t        incecc,
+    const double*       ma,
+    double*             ea,
+    const kes_stm_e     init,
+    const kes_sol_e     iter,
+    const kes_config_t* cfg,
+    kes_err_e*          status,
+    int*                iterations
+    )
+{
+    const kes_input_t data = kes_input_from_config( cfg );
+
+    return( kesolver_batch( n, ecc, incecc, ma, ea, init, iter, &data,
+                            status, iterations ) );
+} // end kesolver_batch_cfg
+
+/******************************************************************************/
+
+/*******************************************************************************
+ *  FUNCTION    : kes_plan_init
+ *  DESCRIPTION : create a solver plan for a fixed eccentricity
+ *  INPUT       : - pointer "plan" to data structure of type "kes_plan_t"
+ *                - eccentricity "ecc"
+ *                - starter method "init" from enum kes_stm_e
+ *                - solver method "iter" from enum kes_sol_e
+ *                - pointer "data" to input parameters (may be NULL)
+ *  OUTPUT      : error code from enum kes_err_e
+ ******************************************************************************/
+kes_err_e kes_plan_init(
+    kes_plan_t*        plan,
+    const double       ecc,
+    const kes_stm_e    init,
+    const kes_sol_e    iter,
+    const kes_input_t* data
+    )
+{
+    /* private copy of input parameters, check and set defaults once */
+    plan->data = ((data != NULL) ? *data : kes_new_input());
+    kes_check_input( &plan->data );
+
+    plan->ecc  = ecc;
+    plan->init = init;
+    plan->iter = iter;
+    plan->stm     = NULL;
+    plan->func    = NULL;
+    plan->fixiter = 0;
+    plan->terms = (kes_terms_t){ .corr = 0.0 };
+    plan->table   = NULL;
+
+    /* exception: input contains invalid numbers */
+    if ( kes_check_val( ecc ) != KES_ERR_NOERR )
+    {
+        plan->type   = KES_ECC_NEG;
+        plan->status = KES_ERR_BADVAL;
+#if KES_SOLVER_DEBUG
+    kes_show_error( plan->status );
+#endif
+        return( plan->status );
+    } // end if
+
+    /* classify eccentricity once */
+    plan->type = kes_check_ecc( ecc, &plan->status );
+
+    switch ( plan->type )
+    {
+        /* circular case: nothing to resolve */
+        case KES_ECC_CIRC:
+            plan->status = KES_ERR_NOERR;
+            break;
+
+        /* elliptic case: resolve methods and precompute constants,
+         * NOTE automatic selection resolves methods in each solve
+         */
+        case KES_ECC_ELL:
+            if ( iter == KES_SOL_AUTO )
+            {
+                plan->status = KES_ERR_NOERR;
+                break;
+            } // end if
+            plan->status = kes_resolve_ell( init, iter,
+                                            &plan->stm, &plan->func );
+            plan->fixiter = kes_resolve_fixiter( init, iter, &plan->data );
+            kes_init_terms( ecc, &plan->terms );
+            if ( iter == KES_SOL_EKS )
+            {
+                kes_eks_init( ecc, &plan->terms );
+            } // end if
+
+            /* near-parabolic case: built-in starter, own iterations */
+            if ( (ecc > KES_NEARPAR_ECC) && (kes_npar_order( iter ) > 0) )
+            {
+                plan->status  = KES_ERR_NOERR;
+                plan->fixiter = kes_npar_fixiter( kes_npar_order( iter ),
+                                                  plan->data.fixiter );
+            } // end if
+            break;
+
+        /* hyperbolic case: resolve iterations for the starter "hinit" */
+        case KES_ECC_HYP:
+            plan->status  = ((((iter > KES_SOL_NONE) &&
+                               (iter < KES_SOL_TOTAL)) ||
+                              (iter == KES_SOL_AUTO)) ?
+                             KES_ERR_NOERR : KES_ERR_BADSOL);
+            plan->fixiter = kes_hyp_fixiter( kes_hyp_order( iter ),
+                                             plan->data.hinit,
+                                             plan->data.fixiter );
+            break;
+
+        /* parabolic case: closed-form solution, nothing to resolve */
+        case KES_ECC_PAR:
+            plan->status = KES_ERR_NOERR;
+            break;
+
+        case KES_ECC_NEG:
+        default:
+            plan->status = KES_ERR_BADECC;
+            break;
+    } // end switch
+
+#if KES_SOLVER_DEBUG
+    kes_show_error( plan->status );
+#endif
+
+    return( plan->status );
+} // end kes_plan_init
+
+/******************************************************************************/
+
+/*******************************************************************************
+ *  FUNCTION    : kes_plan_solve
+ *  DESCRIPTION : solve Kepler Equation with a solver plan
+ *  INPUT       : - pointer "plan" to data structure of type "kes_plan_t"
+ *                - mean anomaly "ma" (in radians)
+ *                - pointer "status" to return error code (see error.h)
+ *  OUTPUT      : solution of Kepler Equation (in radians)
+ ******************************************************************************/
+double kes_plan_solve(
+    const kes_plan_t* plan,
+    const double      ma,
+    kes_err_e*        status
+    )
+{
+    /* error status from creation of plan */
+    *status = plan->status;
+
+    /* exception: input contains invalid numbers */
+    if ( kes_check_val( ma ) != KES_ERR_NOERR )
+    {
+        *status = KES_ERR_BADVAL;
+        return( 0.0 );
+    } // end if
+
+    /* private work space, reset outputs for non-iterative cases */
+    double      ea   = 0.0;
+    kes_input_t work = plan->data;
+
+    /* automatic selection: methods depend on the mean anomaly */
+    if (
+        (plan->iter == KES_SOL_AUTO) && (plan->table == NULL) &&
+        (*status == KES_ERR_NOERR)
+    ) {
+        return( kesolver( plan->ecc, ma, KES_STM_NONE, KES_SOL_AUTO,
+                          &work, status ) );
+    } // end if
+
+    /* solution of an earlier call from the cache? NOTE not for tables */
+    const int    cached = ((*status == KES_ERR_NOERR) && (plan->table == NULL));
+    kes_cache_t* cache  = (cached ? kes_cache_begin() : NULL);
+    if (
+        (cache != NULL) &&
+        kes_cache_lookup( cache, plan->ecc, ma, plan->init, plan->iter, 1,
+                          &work )
+    ) {
+        return( work.result );
+    } // end if
+
+    work.iterations  = 0;
+    work.errDF       = 0.0;
+    work.nbrSinEval  = work.nbrCosEval = work.nbrFktEval = 0;
+
+    switch ( plan->type )
+    {
+        /* circular case: return solution immediately */
+        case KES_ECC_CIRC:
+            ea = ma;
+            break;
+
+        /* elliptic case: call resolved iterator */
+        case KES_ECC_ELL:
+            if ( plan->table != NULL )
+            {
+                ea = kes_solver_ell_table( plan->table, ma );
+            } // end if
+            else if (
+                kes_npar_region( plan->ecc, ma, kes_npar_order( plan->iter ) )
+            ) {
+                const int order = kes_npar_order( plan->iter );
+                ea = kes_solver_npar_core( plan->ecc, ma, order,
+                                           kes_npar_fixiter( order,
+                                                             work.fixiter ),
+                                           &work, NULL );
+            } // end if
+            else if ( plan->func != NULL )
+            {
+                work.terms = &plan->terms;
+                ea         = kes_solver_ell_core( plan->ecc, ma, plan->stm,
+                                                  plan->func, plan->fixiter,
+                                                  &work, NULL );
+            } // end if
+            break;
+
+        /* parabolic case: closed-form solution for true anomaly */
+        case KES_ECC_PAR:
+            ea = kes_solve_par( ma );
+            break;
+
+        /* hyperbolic case: call iterator */
+        case KES_ECC_HYP:
+            if ( plan->status == KES_ERR_NOERR )
+            {
+                ea = kes_solver_hyp_core( plan->ecc, ma,
+                                          kes_hyp_order( plan->iter ),
+                                          plan->fixiter, &work, NULL );
+            } // end if
+            break;
+
+        /* invalid or not yet implemented eccentricity domain */
+        default:
+            break;
+    } // end switch
+
+    /* record successful solves */
+    if ( *status == KES_ERR_NOERR )
+    {
+        kes_stats_input( kes_stats_begin(), plan->init, plan->iter,
+                         plan->ecc, &work );
+        if ( cache != NULL )
+        {
+            work.result = ea;
+            kes_cache_insert( cache, plan->ecc, ma, plan->init, plan->iter, 1,
+                              &work );
+        } // end if
+    } // end if
+
+    return( ea );
+} // end kes_plan_solve
+
+/******************************************************************************/
+
+/*******************************************************************************
+ *  FUNCTION    : kes_plan_table_batch
+ *  DESCRIPTION : solve elliptic Kepler Equation for an array with a table,
+ *                either the Chebyshev table or the one of KES_SOL_EKS
+ *  INPUT       : - pointer "plan" to data structure of type "kes_plan_t"
+ *                - mean anomaly array "ma" (in radians)
+ *                - solution array "ea" (in radians)
+ *                - number of elements "n"
+ *                - pointer "rep" to summary of the batch
+ *  OUTPUT      : none, invalid mean anomalies are recorded in the summary
+ *                as KES_ERR_BADVAL (with solution 0)
+ ******************************************************************************/
+static void kes_plan_table_batch(
+    const kes_plan_t* plan,
+    const double*     ma,
+    double*           ea,
+    const size_t      n,
+    kes_report_t*     rep
+    )
+{
+    kes_input_t work = plan->data;
+    double      redma[KES_SOLVER_BLOCK];
+    int         side[KES_SOLVER_BLOCK];
+
+    work.terms = &plan->terms;
+
+    for (size_t i0 = 0; i0 < n; i0 += KES_SOLVER_BLOCK)
+    {
+        const size_t m = (((n - i0) < KES_SOLVER_BLOCK) ?
+                          (n - i0) : KES_SOLVER_BLOCK);
+
+        /* reduce mean anomalies, invalid numbers are replaced by 0 */
+        for (size_t i = 0; i < m; i++)
+        {
+            if ( kes_check_val( ma[i0 + i] ) != KES_ERR_NOERR )
+            {
+                kes_report_fail( rep, NULL, i0 + i, KES_ERR_BADVAL );
+                redma[i] = 0.0;
+                side[i]  = 1;
+                continue;
+            } // end if
+
+            redma[i] = kes_reduce_side( ma[i0 + i], &side[i] );
+        } // end for(i)
+
+        if ( plan->table != NULL )
+        {
+            kes_table_eval_batch( plan->table, m, redma, ea + i0 );
+        } // end if
+        else
+        {
+            kes_eks_batch( &plan->terms, plan->ecc, m, redma, ea + i0, &work );
+        } // end else
+
+        /* modify solutions if necessary */
+        for (size_t i = 0; i < m; i++)
+        {
+            ea[i0 + i] = ((side[i] < 0) ? M_2PI - ea[i0 + i] : ea[i0 + i]);
+        } // end for(i)
+    } // end for(i0)
+} // end kes_plan_table_batch
+
+/******************************************************************************/
+
+/*******************************************************************************
+ *  FUNCTION    : kes_plan_batch_core
+ *  DESCRIPTION : common part of kes_plan_solve_batch() and the fallback of
+ *                kes_plan_solve_sweep()
+ *  INPUT       : - pointer "plan" to data structure of type "kes_plan_t"
+ *                - mean anomaly array "ma" (in radians)
+ *                - solution array "ea" (in radians)
+ *                - number of elements "n"
+ *                - pointer "rep" to summary of the batch
+ *  OUTPUT      : none, errors are recorded in the summary
+ ******************************************************************************/
+static void kes_plan_batch_core(
+    const kes_plan_t* plan,
+    const double*     ma,
+    double*           ea,
+    const size_t      n,
+    kes_report_t*     rep
+    )
+{
+    /* table of the plan: no iterations, or few with the table of KES_SOL_EKS
+     * NOTE the latter only exists for valid elliptic plans
+     */
+    if ( (plan->table != NULL) ||
+         (plan->terms.ek_init && (plan->status == KES_ERR_NOERR)) )
+    {
+        kes_plan_table_batch( plan, ma, ea, n, rep );
+        return;
+    } // end if
+
+    /* NOTE the batch solver resolves methods only once per call and uses
+     * precomputed constants for the common eccentricity
+     */
+    if ( n > 0 )
+    {
+        kes_batch_core( n, &plan->ecc, 0, ma, ea, plan->init, plan->iter,
+                        &plan->data, NULL, NULL, rep, NULL, NULL );
+    } // end if
+} // end kes_plan_batch_core
+
+/******************************************************************************/
+
+/*******************************************************************************
+ *  FUNCTION    : kes_plan_solve_batch
+ *  DESCRIPTION : solve Kepler Equation with a solver plan for an array
+ *  INPUT       : - pointer "plan" to data structure of type "kes_plan_t"
+ *                - mean anomaly array "ma" (in radians)
+ *                - solution array "ea" (in radians)
+ *                - number of elements "n"
+ *  OUTPUT      : KES_ERR_NOERR if all elements were solved successfully,
+ *                otherwise error code of the first failing element
+ ******************************************************************************/
+kes_err_e kes_plan_solve_batch(
+    const kes_plan_t* plan,
+    const double*     ma,
+    double*           ea,
+    const size_t      n
+    )
+{
+    kes_report_t rep = kes_report_init( n );
+    kes_plan_batch_core( plan, ma, ea, n, &rep );
+
+    return( rep.err );
+} // end kes_plan_solve_batch
+
+/******************************************************************************/
+
+/*******************************************************************************
+ *  FUNCTION    : kes_plan_table_init
+ *  DESCRIPTION : attach a piecewise Chebyshev table to an elliptic solver plan
+ *  INPUT       : - pointer "plan" to data structure of type "kes_plan_t"
+ *                - tolerance "tol" of the fit (0 for default)
+ *  OUTPUT      : error code from enum kes_err_e
+ ******************************************************************************/
+kes_err_e kes_plan_table_init(
+    kes_plan_t*  plan,
+    const double tol
+    )
+{
+    /* exception: table only for valid elliptic plans */
+    if ( (plan->type != KES_ECC_ELL) || (plan->status != KES_ERR_NOERR) )
+    {
+        return( KES_ERR_BADECC );
+    } // end if
+
+    kes_err_e    status;
+    kes_table_t* table = kes_table_new( plan->ecc, tol, &status );
+
+    /* NOTE keep an existing table if the new one cannot be built */
+    if ( (status == KES_ERR_NOERR) && (table != NULL) )
+    {
+        kes_table_free( plan->table );
+        plan->table = table;
+    } // end if
+
+#if KES_SOLVER_DEBUG
+    kes_show_error( status );
+#endif
+
+    return( status );
+} // end kes_plan_table_init
+
+/******************************************************************************/
+
+/*******************************************************************************
+ *  FUNCTION    : kes_plan_table_size
+ *  DESCRIPTION : workspace size of the table of an elliptic solver plan
+ *  INPUT       : - pointer "plan" to data structure of type "kes_plan_t"
+ *                - tolerance "tol" of the fit (0 for default)
+ *                - pointer "status" to return error code (or NULL)
+ *  OUTPUT      : number of bytes for kes_plan_table_init_ws(), 0 on error
+ ******************************************************************************/
+size_t kes_plan_table_size(
+    const kes_plan_t* plan,
+    const double      tol,
+    kes_err_e*        status
+    )
+{
+    kes_err_e err  = KES_ERR_BADECC;
+    size_t    size = 0;
+
+    /* exception: table only for valid elliptic plans */
+    if ( (plan->type == KES_ECC_ELL) && (plan->status == KES_ERR_NOERR) )
+    {
+        size = kes_table_size( plan->ecc, tol, &err );
+    } // end if
+
+    if ( status != NULL )
+    {
+        *status = err;
+    } // end if
+
+    return( size );
+} // end kes_plan_table_size
+
+/******************************************************************************/
+
+/*******************************************************************************
+ *  FUNCTION    : kes_plan_table_init_ws
+ *  DESCRIPTION : attach a table in a caller-provided buffer to an elliptic
+ *                solver plan
+ *  INPUT       : - pointer "plan" to data structure of type "kes_plan_t"
+ *                - tolerance "tol" of the fit (0 for default)
+ *                - buffer "buf" and its number of bytes "size"
+ *  OUTPUT      : error code from enum kes_err_e
+ ******************************************************************************/
+kes_err_e kes_plan_table_init_ws(
+    kes_plan_t*  plan,
+    const double tol,
+    void*        buf,
+    const size_t size
+    )
+{
+    /* exception: table only for valid elliptic plans */
+    if ( (plan->type != KES_ECC_ELL) || (plan->status != KES_ERR_NOERR) )
+    {
+        return( KES_ERR_BADECC );
+    } // end if
+
+    /* NOTE the buffer may hold the current table of the plan */
+    kes_table_free( plan->table );
+    plan->table = NULL;
+
+    kes_err_e status;
+    plan->table = kes_table_new_ws( plan->ecc, tol, buf, size, &status );
+
+#if KES_SOLVER_DEBUG
+    kes_show_error( status );
+#endif
+
+    return( status );
+} // end kes_plan_table_init_ws
+
+/******************************************************************************/
+
+/*******************************************************************************
+ *  FUNCTION    : kes_plan_table_bytes
+ *  DESCRIPTION : memory footprint of the table of a solver plan
+ *  INPUT       : pointer "plan" to data structure of type "kes_plan_t"
+ *  OUTPUT      : number of allocated bytes (0 if there is no table)
+ ******************************************************************************/
+size_t kes_plan_table_bytes(const kes_plan_t* plan)
+{
+    return( kes_table_bytes( plan->table ) );
+} // end kes_plan_table_bytes
+
+/******************************************************************************/
+
+/*******************************************************************************
+ *  FUNCTION    : kes_plan_table_free
+ *  DESCRIPTION : release the table of a solver plan
+ *  INPUT       : pointer "plan" to data structure of type "kes_plan_t"
+ *  OUTPUT      : none
+ ******************************************************************************/
+void kes_plan_table_free(kes_plan_t* plan)
+{
+    kes_table_free( plan->table );
+    plan->table = NULL;
+} // end kes_plan_table_free
+
+/******************************************************************************/
+
+/*******************************************************************************
+ *  FUNCTION    : kes_warm_init
+ *  DESCRIPTION : reset state of warm-start solver, next solve uses the starter
+ *                method of the plan
+ *  INPUT       : pointer "warm" to data structure of type "kes_warm_t"
+ *  OUTPUT      : none
+ ******************************************************************************/
+void kes_warm_init(kes_warm_t* warm)
+{
+    warm->ma         = 0.0;
+    warm->ea         = 0.0;
+    warm->fac        = 0.0;
+    warm->side       = 0;
+    warm->valid      = 0;
+    warm->iterations = 0;
+} // end kes_warm_init
+
+/******************************************************************************/
+
+/*******************************************************************************
+ *  FUNCTION    : kes_warm_starter
+ *  DESCRIPTION : starting value extrapolated from the previous solution of a
+ *                sequence of mean anomalies
+ *  INPUT       : - eccentricity "ecc"
+ *                - mean anomaly "ma" (in radians)
+ *                - reduced mean anomaly "redma" (0 <= redma <= pi)
+ *                - "side" of the reduced mean anomaly (+1 or -1)
+ *                - pointer "warm" to state of type "kes_warm_t"
+ *                - pointer "starter" to return the starting value
+ *  OUTPUT      : 1 if the extrapolation applies, 0 otherwise
+ ******************************************************************************/
+static inline int kes_warm_starter(
+    const double      ecc,
+    const double      ma,
+    const double      redma,
+    const int         side,
+    const kes_warm_t* warm,
+    double*           starter
+    )
+{
+    /* first order extrapolation from previous solution,
+     * E = E(prev) + (M - M(prev)) / (1 - e*cos(E(prev)))
+     */
+    const double step = (ma - warm->ma) * warm->fac;
+
+    /* NOTE E(M) is concave for 0 <= M <= pi, i.e. the extrapolated value
+     * is an upper bound of the solution and the iterations converge
+     * monotonically; this does not hold if the sequence crossed the
+     * boundaries M = 0 or M = pi of the reduced range since the last call
+     */
+    if (
+        !warm->valid ||
+        (warm->side != side) ||
+        !(fabs(step) <= KES_WARM_MAXSTEP)
+    ) {
+        return( 0 );
+    } // end if
+
+    /* shift extrapolated value by multiples of 2*pi to the branch of
+     * the reduced mean anomaly, then apply the same symmetry
+     */
+    double x = warm->ea + step;
+    x -= M_2PI * round( (x - side * redma) / M_2PI );
+    x *= side;
+
+    /* keep starter within bounds M <= E <= min(M + e, pi) */
+    const double xmax = fmin( redma + ecc, M_PI );
+    *starter = ((x < redma) ? redma : ((x > xmax) ? xmax : x));
+
+    return( 1 );
+} // end kes_warm_starter
+
+/******************************************************************************/
+
+/*******************************************************************************
+ *  FUNCTION    : kes_plan_solve_warm
+ *  DESCRIPTION : solve Kepler Equation with a solver plan, using the previous
+ *                solution of a time sequence as starting value
+ *  INPUT       : - pointer "plan" to data structure of type "kes_plan_t"
+ *                - mean anomaly "ma" (in radians)
+ *                - pointer "warm" to state of type "kes_warm_t"
+ *                - pointer "status" to return error code (see error.h)
+ *  OUTPUT      : solution of Kepler Equation (in radians)
+ ******************************************************************************/
+double kes_plan_solve_warm(
+    const kes_plan_t* plan,
+    const double      ma,
+    kes_warm_t*       warm,
+    kes_err_e*        status
+    )
+{
+    /* error status from creation of plan */
+    *status = plan->status;
+
+    /* cases without iteration are solved as usual, state becomes invalid */
+    if (
+        (plan->type != KES_ECC_ELL) ||
+        (plan->func == NULL) || (plan->table != NULL) ||
+        kes_npar_region( plan->ecc, ma, kes_npar_order( plan->iter ) ) ||
+        (kes_check_val( ma ) != KES_ERR_NOERR)
+    ) {
+        warm->valid      = 0;
+        warm->iterations = 0;
+        return( kes_plan_solve( plan, ma, status ) );
+    } // end if
+
+    /* private work space, NOTE the solvers keep sin/cos of their last step
+     * for the derivative of the next extrapolation
+     */
+    kes_input_t work = plan->data;
+    work.terms       = &plan->terms;
+    work.deriv       = ((work.deriv == KES_DERIV_NONE) ? KES_DERIV_FIRST :
+                                                         work.deriv);
+    kes_trig_last()->x = NAN;
+
+    /* reduce mean anomaly to range -pi <= redma < pi */
+    double    redma = kes_reduce( ma );
+    const int side  = ((redma < 0.0) ? -1 : 1);
+
+    /* apply symmetry transformation to range 0 <= redma <= pi */
+    redma = fabs( redma );
+
+    int fix = plan->fixiter;
+
+    if ( kes_warm_starter( plan->ecc, ma, redma, side, warm, &work.starter ) )
+    {
+        /* tabulated iterations do not apply to this starter */
+        if ( plan->data.fixiter == KES_FIX_AUTO )
+        {
+            fix = 0;
+        } // end if
+    } // end if
+    else
+    {
+        /* fallback: starter method of the plan */
+        work.starter = plan->stm( plan->ecc, redma );
+    } // end else
+
+    const double ea = kes_solver_ell_iter( plan->ecc, redma, side, plan->func,
+                                           fix, &work );
+
+    /* record successful solves */
+    if ( *status == KES_ERR_NOERR )
+    {
+        kes_stats_input( kes_stats_begin(), plan->init, plan->iter,
+                         plan->ecc, &work );
+    } // end if
+
+    /* derivative dE/dM from sin/cos of the last step */
+    kes_deriv_t partial;
+    kes_deriv_ell( plan->ecc, ea, kes_trig_last(), KES_DERIV_FIRST,
+                   &partial );
+
+    /* save state for next call */
+    warm->ma         = ma;
+    warm->ea         = ea;
+    warm->fac        = partial.dEdM;
+    warm->side       = side;
+    warm->valid      = 1;
+    warm->iterations = work.iterations;
+
+    return( ea );
+} // end kes_plan_solve_warm
+
+/******************************************************************************/
+
+/*******************************************************************************
+ *  FUNCTION    : kes_sweep_sorted
+ *  DESCRIPTION : check if an array of mean anomalies is sorted
+ *  INPUT       : - mean anomaly array "ma" (in radians)
+ *                - number of elements "n"
+ *  OUTPUT      : 1 if non-decreasing or non-increasing, 0 otherwise
+ ******************************************************************************/
+static int kes_sweep_sorted(
+    const double* ma,
+    const size_t  n
+    )
+{
+    /* NOTE the comparisons fail for NaN, i.e. such arrays are not sorted */
+    int up = 1, down = 1;
+    for (size_t i = 1; i < n; i++)
+    {
+        up   &= (ma[i] >= ma[i-1]);
+        down &= (ma[i] <= ma[i-1]);
+    } // end for
+
+    return( up || down );
+} // end kes_sweep_sorted
+
+/******************************************************************************/
+
+/*******************************************************************************
+ *  FUNCTION    : kes_plan_sweep_core
+ *  DESCRIPTION : common part of kes_plan_solve_sweep() and
+ *                kes_plan_solve_sweep_report(), each block of lanes starts
+ *                from the previous solution
+ *  INPUT       : - pointer "plan" to data structure of type "kes_plan_t"
+ *                - mean anomaly array "ma" (in radians)
+ *                - solution array "ea" (in radians)
+ *                - number of elements "n"
+ *                - pointer "rep" to summary of the sweep
+ *  OUTPUT      : none, errors and lanes stopped by "maxiter" are recorded in
+ *                the summary
+ ******************************************************************************/
+static void kes_plan_sweep_core(
+    const kes_plan_t* plan,
+    const double*     ma,
+    double*           ea,
+    const size_t      n,
+    kes_report_t*     rep
+    )
+{
+    /* unsorted arrays and cases without vectorized iterations are solved
+     * as usual, NOTE Markley's and Mikkola's method compute their own
+     * starting values
+     */
+    if (
+        (plan->type != KES_ECC_ELL) || (plan->status != KES_ERR_NOERR) ||
+        (plan->func == NULL) || (plan->table != NULL) ||
+        (plan->iter == KES_SOL_MARKLEY) || (plan->iter == KES_SOL_MIKKOLA) ||
+        !kes_vsolve_supported( plan->iter ) ||
+        !kes_sweep_sorted( ma, n )
+    ) {
+        kes_plan_batch_core( plan, ma, ea, n, rep );
+        return;
+    } // end if
+
+    /* data of one block, collected by the lanes of the vectors */
+    size_t idx[KES_VEC_LEN];     /* element index */
+    int    lside[KES_VEC_LEN];   /* side of reduced mean anomaly */
+    double lecc[KES_VEC_LEN];    /* eccentricity */
+    double lma[KES_VEC_LEN];     /* reduced mean anomaly */
+    double lstm[KES_VEC_LEN];    /* starter value */
+    double lea[KES_VEC_LEN];     /* solution */
+    int    lcount[KES_VEC_LEN];  /* number of iterations */
+    kes_vtrig_t ltrig;           /* sin/cos of the last step */
+
+    /* private work space, tabulated iterations do not apply to the
+     * extrapolated starters
+     */
+    kes_input_t work = plan->data;
+    work.terms       = &plan->terms;
+    work.fixiter     = ((plan->data.fixiter == KES_FIX_AUTO) ?
+                        0 : plan->fixiter);
+
+    const int  stats = kes_stats_begin();
+    kes_warm_t warm;
+    kes_warm_init( &warm );
+
+    for (size_t i0 = 0; i0 < n; i0 += KES_VEC_LEN)
+    {
+        const size_t iend  = ((n - i0 > KES_VEC_LEN) ? i0 + KES_VEC_LEN : n);
+        int          lanes = 0;
+
+        /* NOTE all lanes of a block are extrapolated from the last solution
+         * of the previous block, i.e. the state is not changed in the loop
+         */
+        for (size_t i = i0; i < iend; i++)
+        {
+            /* rare cases: invalid numbers and near-parabolic region */
+            if ( (kes_check_val( ma[i] ) != KES_ERR_NOERR) ||
+                 kes_npar_region( plan->ecc, ma[i],
+                                  kes_npar_order( plan->iter ) ) )
+            {
+                kes_err_e err;
+                ea[i] = kes_plan_solve( plan, ma[i], &err );
+                if ( err != KES_ERR_NOERR )
+                {
+                    kes_report_fail( rep, NULL, i, err );
+                } // end if
+                continue;
+            } // end if
+
+            /* reduce mean anomaly to range 0 <= redma <= pi */
+            int          side;
+            const double redma = kes_reduce_side( ma[i], &side );
+
+            /* special values of mean anomaly or small eccentricity */
+            if ( kes_solver_ell_direct( plan->ecc, redma, &work ) )
+            {
+                ea[i] = ((side < 0) ? M_2PI - work.result : work.result);
+                kes_stats_input( stats, plan->init, plan->iter, plan->ecc,
+                                 &work );
+                continue;
+            } // end if
+
+            /* collect lane, starting value extrapolated from the previous
+             * block, fallback per element: starter method of the plan
+             */
+            idx[lanes]   = i;
+            lside[lanes] = side;
+            lecc[lanes]  = plan->ecc;
+            lma[lanes]   = redma;
+            if ( !kes_warm_starter( plan->ecc, ma[i], redma, side, &warm,
+                                    &lstm[lanes] ) )
+            {
+                lstm[lanes] = plan->stm( plan->ecc, redma );
+            } // end if
+            ++lanes;
+        } // end for
+
+        if ( lanes == 0 )
+        {
+            continue;
+        } // end if
+
+        /* fill unused lanes with harmless dummy values */
+        for (int l = lanes; l < KES_VEC_LEN; l++)
+        {
+            lecc[l] = 0.5;
+            lma[l]  = 1.0;
+            lstm[l] = 1.5;
+        } // end for
+
+        kes_vsolve_ell( plan->iter, lecc, lma, lstm, lea, lcount, &work,
+                        &ltrig );
+
+        /* scatter results, modify solution if necessary */
+        for (int l = 0; l < lanes; l++)
+        {
+            ea[idx[l]] = ((lside[l] < 0) ? M_2PI - lea[l] : lea[l]);
+            if ( lcount[l] >= work.maxiter )
+            {
+                kes_report_maxiter( rep, NULL, idx[l] );
+            } // end if
+        } // end for
+
+        if ( stats )
+        {
+            kes_stats_lanes( plan->init, plan->iter, KES_ECC_ELL, lanes, lecc,
+                             lma, lea, lcount, &work );
+        } // end if
+
+        /* last solution of this block is the origin of the next one,
+         * derivative dE/dM from sin/cos of the last step of its lane
+         */
+        const int        last = lanes - 1;
+        const kes_trig_t t    = {
+            ltrig.x[last], ltrig.es[last], ltrig.ec[last]
+        };
+        kes_deriv_t partial;
+        kes_deriv_ell( plan->ecc, lea[last], &t, KES_DERIV_FIRST, &partial );
+
+        warm.ma         = ma[idx[last]];
+        warm.ea         = ea[idx[last]];
+        warm.fac        = partial.dEdM;
+        warm.side       = lside[last];
+        warm.valid      = 1;
+        warm.iterations = lcount[last];
+    } // end for
+} // end kes_plan_sweep_core
+
+/******************************************************************************/
+
+/*******************************************************************************
+ *  FUNCTION    : kes_plan_solve_sweep
+ *  DESCRIPTION : solve Kepler Equation with a solver plan for a sorted array
+ *  INPUT       : - pointer "plan" to data structure of type "kes_plan_t"
+ *                - mean anomaly array "ma" (in radians)
+ *                - solution array "ea" (in radians)
+ *                - number of elements "n"
+ *  OUTPUT      : KES_ERR_NOERR if all elements were solved successfully,
+ *                otherwise error code of the first failing element
+ ******************************************************************************/
+kes_err_e kes_plan_solve_sweep(
+    const kes_plan_t* plan,
+    const double*     ma,
+    double*           ea,
+    const size_t      n
+    )
+{
+    kes_report_t rep = kes_report_init( n );
+    kes_plan_sweep_core( plan, ma, ea, n, &rep );
+
+    return( rep.err );
+} // end kes_plan_solve_sweep
+
+/******************************************************************************/
+
+/*******************************************************************************
+ *  FUNCTION    : kes_plan_solve_sweep_report
+ *  DESCRIPTION : solve Kepler Equation with a solver plan for a sorted array
+ *                with a summary of errors
+ *  INPUT       : - same as kes_plan_solve_sweep()
+ *                - pointer "report" to summary of the sweep (may be NULL)
+ *  OUTPUT      : KES_ERR_NOERR if all elements were solved successfully,
+ *                otherwise error code of the first failing element
+ ******************************************************************************/
+kes_err_e kes_plan_solve_sweep_report(
+    const kes_plan_t* plan,
+    const double*     ma,
+    double*           ea,
+    const size_t      n,
+    kes_report_t*     report
+    )
+{
+    kes_report_t rep = kes_report_init( n );
+    kes_plan_sweep_core( plan, ma, ea, n, &rep );
+
+    if ( report != NULL )
+    {
+        *report = rep;
+    } // end if
+
+    return( rep.err );
+} // end kes_plan_solve_sweep_report
+
+/******************************************************************************/
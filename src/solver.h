@@ -27,10 +27,36 @@
 #ifndef KES_SOLVER__H
 #define KES_SOLVER__H
 
+/* include standard headers */
+#include <stddef.h>
+#include <stdint.h>
+
 /* include module headers */
 #include "error.h"
 #include "input.h"
 #include "starter.h"
+#include "utils.h"
+
+/******************************************************************************/
+
+/*** declare macro constants ***/
+
+/* max. extrapolation step of kes_plan_solve_warm() (in radians) */
+#define KES_WARM_MAXSTEP 0.5
+
+/* elliptic orbits with ecc > KES_NEARPAR_ECC use the near-parabolic solver */
+#define KES_NEARPAR_ECC  0.99
+
+/* ... and so does the corner ecc > KES_CORNER_ECC, reduced M < KES_CORNER_MA
+ * + KES_CORNER_SLOPE * (ecc - KES_CORNER_ECC), which widens to M < 0.535 as
+ * ecc approaches KES_NEARPAR_ECC
+ */
+#define KES_CORNER_ECC   0.8
+#define KES_CORNER_MA    0.25
+#define KES_CORNER_SLOPE 1.5
+
+/* flag of kesolver_batch_report() codes: element was stopped by "maxiter" */
+#define KES_FLAG_MAXITER 0x80
 
 /******************************************************************************/
 
@@ -57,8 +83,16 @@ typedef enum
     KES_SOL_NIJENH,   ///< Nijenhuis method
     KES_SOL_SECANT,   ///< Secant method
     KES_SOL_WEGSEC,   ///< Wegstein's secant modification
+    KES_SOL_BRENT,    ///< Brent's method (bracketing with interpolation)
+    KES_SOL_CORDIC,   ///< CORDIC-like method (rotations, no sin/cos)
+    KES_SOL_FUKUSH,   ///< Fukushima's method (segments, tabulated sin/cos)
+    KES_SOL_EKS,      ///< enhanced Kepler solver (segmented Taylor series)
+    KES_SOL_HYBRID,   ///< safeguarded hybrid (Danby-Burkardt in a bracket)
 
-    KES_SOL_TOTAL     ///< total number of available solver methods
+    KES_SOL_TOTAL,    ///< total number of available solver methods
+
+    /* NOTE not a solver method, resolved per call, see kes_auto_select() */
+    KES_SOL_AUTO      ///< automatic selection of starter and solver method
 } kes_sol_e;
 
 
@@ -74,6 +108,66 @@ typedef int kes_iter_t(
     kes_input_t* data
 );
 
+
+/*!
+ * @brief piecewise Chebyshev table of the elliptic Kepler Equation
+ * @details opaque type, see kes_plan_table_init()
+ */
+typedef struct kes_table_s kes_table_t;
+
+
+/*!
+ * @brief structure containing a solver plan for a fixed eccentricity
+ * @details created by kes_plan_init(), holds the resolved starter and
+ * solver functions, the checked input parameters and the precomputed
+ * eccentricity-dependent constants; a plan is not modified by the solver
+ * functions and can be shared between threads
+ * NOTE treat all members as read-only
+ */
+typedef struct
+{
+    double          ecc;     ///< eccentricity
+    kes_ecc_e       type;    ///< eccentricity domain
+    kes_stm_e       init;    ///< starter method
+    kes_sol_e       iter;    ///< solver method
+    kes_err_e       status;  ///< error code from kes_plan_init()
+    kes_stm_t*      stm;     ///< resolved starter function
+    kes_iter_t*     func;    ///< resolved iteration function
+    int             fixiter; ///< resolved fixed number of iterations
+    kes_input_t     data;    ///< checked input parameters
+    kes_terms_t     terms;   ///< eccentricity-dependent constants
+    kes_table_t*    table;   ///< optional table, see kes_plan_table_init()
+} kes_plan_t;
+
+
+/*!
+ * @brief structure containing the state of a warm-start solver
+ * @details holds the previous solution of a time sequence of mean anomalies,
+ * see kes_plan_solve_warm(); use one state per trajectory and reset it with
+ * kes_warm_init() before the first call
+ */
+typedef struct
+{
+    double ma;         ///< previous mean anomaly (in radians)
+    double ea;         ///< previous solution (in radians)
+    double fac;        ///< derivative dE/dM = 1/(1-e*cos(E)) at solution
+    int    side;       ///< side of previous reduced mean anomaly (+1 or -1)
+    int    valid;      ///< previous solution is available (1) or not (0)
+    int    iterations; ///< number of iterations of last solution
+} kes_warm_t;
+
+
+/*!
+ * @brief summary of the outcome of a batch, see kesolver_batch_report()
+ */
+typedef struct
+{
+    size_t    failed;  ///< number of elements with an error
+    size_t    first;   ///< index of the first failing element (n if none)
+    kes_err_e err;     ///< error code of the first failing element
+    size_t    maxiter; ///< number of elements stopped by "maxiter"
+} kes_report_t;
+
 /******************************************************************************/
 
 /*** function declarations ***/
@@ -92,7 +186,20 @@ void kes_show_solver(const kes_sol_e type);
 
 /*!
  * @brief main solver function for Kepler Equation
- * @details user can specify additional parameters via structure \a data
+ * @details user can specify additional parameters via structure \a data;
+ * for ecc > 1 the hyperbolic Kepler Equation ecc*sinh(H) - H = ma is solved
+ * with a built-in starter (\a init is ignored) and iterations of the same
+ * order as \a iter, methods without hyperbolic variant use Halley's method;
+ * for |ecc - 1| <= 1E-10 the parabolic Kepler Equation is solved in
+ * closed form and the true anomaly is returned; for
+ * KES_NEARPAR_ECC < ecc < 1 Newton-Raphson, Halley, Danby-Burkardt, fixed-point,
+ * Laguerre-Conway, secant and Wegstein's secant method are replaced by a
+ * cancellation-free iteration of the same order with a built-in starter,
+ * likewise in the corner ecc > KES_CORNER_ECC, |M| < KES_CORNER_MA +
+ * KES_CORNER_SLOPE * (ecc - KES_CORNER_ECC) (modulo 2*pi) where these
+ * methods converge slowly or not at all;
+ * with \a iter = KES_SOL_AUTO both methods are selected for each call from
+ * the region of (ecc, ma), see kes_auto_select(), and \a init is ignored
  * @param[in] ecc eccentricity
  * @param[in] ma mean anomaly (in radians)
  * @param[in] init choose a starter method from enum #kes_stm_e
@@ -110,6 +217,444 @@ double kesolver(
     kes_err_e*      status
 );
 
+
+/*!
+ * @brief batch solver function for Kepler Equation
+ * @details solves Kepler's Equation for an array of mean anomalies;
+ * input parameters are checked and methods are resolved only once per call,
+ * the structure \a data is not modified and can be shared between calls;
+ * elliptic and hyperbolic elements of mixed arrays are collected into
+ * separate blocks and solved by vectorized iterations, parabolic and
+ * near-parabolic elements are solved one by one as in kesolver(),
+ * all elements are solved one by one for KES_SOL_AUTO
+ * @param[in] n number of elements
+ * @param[in] ecc array of eccentricities
+ * @param[in] incecc stride of array \a ecc;
+ * use 0 for a single eccentricity common to all elements, 1 for an array
+ * @param[in] ma array of mean anomalies (in radians)
+ * @param[out] ea array of solutions to Kepler Equation
+ * @param[in] init choose a starter method from enum #kes_stm_e
+ * @param[in] iter choose a solver method from enum #kes_sol_e
+ * @param[in] data pointer to data structure of type #kes_input_t
+ * (or NULL for default settings)
+ * @param[out] status optional array of per-element error codes (or NULL)
+ * @param[out] iterations optional array of per-element iterations (or NULL)
+ * @return error code from enum #kes_err_e;
+ * KES_ERR_NOERR if all elements were solved, else code of first failure
+ */
+kes_err_e kesolver_batch(
+    const size_t       n,
+    const double*      ecc,
+    const size_t       incecc,
+    const double*      ma,
+    double*            ea,
+    const kes_stm_e    init,
+    const kes_sol_e    iter,
+    const kes_input_t* data,
+    kes_err_e*         status,
+    int*               iterations
+);
+
+
+/*!
+ * @brief batch solver function for Kepler Equation on strided arrays
+ * @details same results as kesolver_batch(), but eccentricities, mean
+ * anomalies and solutions are addressed by base pointers and strides in
+ * bytes (as in BLAS), e.g. members of an array of orbit element structures
+ * with a stride of the size of the structure; the elements are gathered
+ * into the lanes of the vectorized solvers and the solutions are scattered
+ * back, i.e. the caller needs no copies; unit strides (sizeof(double)) take
+ * the same path as kesolver_batch(); all addresses must be aligned for
+ * double
+ * @param[in] n number of elements
+ * @param[in] ecc pointer to the first eccentricity
+ * @param[in] strecc stride of \a ecc in bytes, 0 for a single eccentricity
+ * common to all elements
+ * @param[in] ma pointer to the first mean anomaly (in radians)
+ * @param[in] strma stride of \a ma in bytes
+ * @param[out] ea pointer to the first solution
+ * @param[in] strea stride of \a ea in bytes (not 0 for n > 1)
+ * @param[in] init choose a starter method from enum #kes_stm_e
+ * @param[in] iter choose a solver method from enum #kes_sol_e
+ * @param[in] data pointer to data structure of type #kes_input_t
+ * (or NULL for default settings)
+ * @param[out] status optional array of per-element error codes (or NULL)
+ * @param[out] iterations optional array of per-element iterations (or NULL)
+ * @return error code from enum #kes_err_e;
+ * KES_ERR_NOERR if all elements were solved, else code of first failure,
+ * KES_ERR_BADVAL for a zero stride of the solutions
+ */
+kes_err_e kesolver_batch_strided(
+    const size_t       n,
+    const double*      ecc,
+    const size_t       strecc,
+    const double*      ma,
+    const size_t       strma,
+    double*            ea,
+    const size_t       strea,
+    const kes_stm_e    init,
+    const kes_sol_e    iter,
+    const kes_input_t* data,
+    kes_err_e*         status,
+    int*               iterations
+);
+
+
+/*!
+ * @brief solver function for Kepler Equation with a shared configuration
+ * @details same solution as kesolver(), but the configuration \a cfg is
+ * only read, i.e. one instance can be shared by many threads, and the
+ * outputs go to an optional compact record instead of #kes_input_t
+ * @param[in] ecc eccentricity
+ * @param[in] ma mean anomaly (in radians)
+ * @param[in] init choose a starter method from enum #kes_stm_e
+ * @param[in] iter choose a solver method from enum #kes_sol_e
+ * @param[in] cfg pointer to structure of type #kes_config_t
+ * (or NULL for default settings)
+ * @param[out] res pointer to result record of type #kes_result_t (or NULL)
+ * @return solution to Kepler Equation
+ */
+double kesolver_cfg(
+    const double        ecc,
+    const double        ma,
+    const kes_stm_e     init,
+    const kes_sol_e     iter,
+    const kes_config_t* cfg,
+    kes_result_t*       res
+);
+
+
+/*!
+ * @brief batch solver function for Kepler Equation with a shared
+ * configuration
+ * @details same as kesolver_batch() with the settings of \a cfg
+ * @param[in] n number of elements
+ * @param[in] ecc array of eccentricities
+ * @param[in] incecc stride of array \a ecc;
+ * use 0 for a single eccentricity common to all elements, 1 for an array
+ * @param[in] ma array of mean anomalies (in radians)
+ * @param[out] ea array of solutions to Kepler Equation
+ * @param[in] init choose a starter method from enum #kes_stm_e
+ * @param[in] iter choose a solver method from enum #kes_sol_e
+ * @param[in] cfg pointer to structure of type #kes_config_t
+ * (or NULL for default settings)
+ * @param[out] status optional array of per-element error codes (or NULL)
+ * @param[out] iterations optional array of per-element iterations (or NULL)
+ * @return error code from enum #kes_err_e;
+ * KES_ERR_NOERR if all elements were solved, else code of first failure
+ */
+kes_err_e kesolver_batch_cfg(
+    const size_t        n,
+    const double*       ecc,
+    const size_t        incecc,
+    const double*       ma,
+    double*             ea,
+    const kes_stm_e     init,
+    const kes_sol_e     iter,
+    const kes_config_t* cfg,
+    kes_err_e*          status,
+    int*                iterations
+);
+
+
+/*!
+ * @brief batch solver function for Kepler Equation with a summary of errors
+ * @details same solutions as kesolver_batch(), but instead of an error code
+ * per element the outcome is summarized in \a report, which costs no stores
+ * for successful elements; the optional array \a codes holds one byte per
+ * element, the error code from enum #kes_err_e (KES_ERR_NOERR = 0) or'ed
+ * with KES_FLAG_MAXITER if the element was stopped by "maxiter"
+ * @param[in] n number of elements
+ * @param[in] ecc array of eccentricities
+ * @param[in] incecc stride of array \a ecc;
+ * use 0 for a single eccentricity common to all elements, 1 for an array
+ * @param[in] ma array of mean anomalies (in radians)
+ * @param[out] ea array of solutions to Kepler Equation
+ * @param[in] init choose a starter method from enum #kes_stm_e
+ * @param[in] iter choose a solver method from enum #kes_sol_e
+ * @param[in] data pointer to data structure of type #kes_input_t
+ * (or NULL for default settings)
+ * @param[out] report pointer to summary of type #kes_report_t (or NULL)
+ * @param[out] codes optional array of per-element codes (or NULL)
+ * @return error code from enum #kes_err_e;
+ * KES_ERR_NOERR if all elements were solved, else code of first failure
+ */
+kes_err_e kesolver_batch_report(
+    const size_t       n,
+    const double*      ecc,
+    const size_t       incecc,
+    const double*      ma,
+    double*            ea,
+    const kes_stm_e    init,
+    const kes_sol_e    iter,
+    const kes_input_t* data,
+    kes_report_t*      report,
+    uint8_t*           codes
+);
+
+
+/*!
+ * @brief batch solver function for Kepler Equation returning the partial
+ * derivatives of the solutions
+ * @details same solutions as kesolver_batch(), plus dE/dM and dE/de (and
+ * the second derivatives for KES_DERIV_SECOND) of every element in
+ * \a deriv, see #kes_deriv_t; the order is taken from "deriv" of \a data,
+ * KES_DERIV_FIRST if \a data is NULL or the order is KES_DERIV_NONE;
+ * sin/cos are taken from the last step of each element and corrected to
+ * the solution; failing elements, including those reaching the maximum
+ * number of iterations, get zero derivatives
+ * @param[in] n number of elements
+ * @param[in] ecc array of eccentricities
+ * @param[in] incecc stride of array \a ecc;
+ * use 0 for a single eccentricity common to all elements, 1 for an array
+ * @param[in] ma array of mean anomalies (in radians)
+ * @param[out] ea array of solutions to Kepler Equation
+ * @param[in] init choose a starter method from enum #kes_stm_e
+ * @param[in] iter choose a solver method from enum #kes_sol_e
+ * @param[in] data pointer to data structure of type #kes_input_t
+ * (or NULL for default settings)
+ * @param[out] deriv array of derivatives of type #kes_deriv_t
+ * @param[out] status optional array of per-element error codes (or NULL)
+ * @param[out] iterations optional array of per-element iterations (or NULL)
+ * @return error code from enum #kes_err_e;
+ * KES_ERR_NOERR if all elements were solved, else code of first failure,
+ * KES_ERR_BADVAL if \a deriv is NULL
+ */
+kes_err_e kesolver_batch_deriv(
+    const size_t       n,
+    const double*      ecc,
+    const size_t       incecc,
+    const double*      ma,
+    double*            ea,
+    const kes_stm_e    init,
+    const kes_sol_e    iter,
+    const kes_input_t* data,
+    kes_deriv_t*       deriv,
+    kes_err_e*         status,
+    int*               iterations
+);
+
+
+/*!
+ * @brief create a solver plan for a fixed eccentricity
+ * @details checks input parameters, classifies the eccentricity, resolves
+ * starter and solver methods and precomputes eccentricity-dependent
+ * constants once, use kes_plan_solve() or kes_plan_solve_batch() afterwards;
+ * with KES_SOL_AUTO the methods are selected in each solve as in kesolver();
+ * NOTE release a table of the plan with kes_plan_table_free() before
+ * initializing the plan again
+ * @param[out] plan pointer to structure of type #kes_plan_t
+ * @param[in] ecc eccentricity
+ * @param[in] init choose a starter method from enum #kes_stm_e
+ * @param[in] iter choose a solver method from enum #kes_sol_e
+ * @param[in] data pointer to data structure of type #kes_input_t
+ * (or NULL for default settings)
+ * @return error code from enum #kes_err_e, also stored in the plan
+ */
+kes_err_e kes_plan_init(
+    kes_plan_t*        plan,
+    const double       ecc,
+    const kes_stm_e    init,
+    const kes_sol_e    iter,
+    const kes_input_t* data
+);
+
+
+/*!
+ * @brief solve Kepler Equation with a solver plan
+ * @details same result as kesolver() with the parameters of the plan
+ * @param[in] plan pointer to structure of type #kes_plan_t
+ * @param[in] ma mean anomaly (in radians)
+ * @param[out] status pointer to return error code from enum #kes_err_e
+ * @return solution to Kepler Equation
+ */
+double kes_plan_solve(
+    const kes_plan_t* plan,
+    const double      ma,
+    kes_err_e*        status
+);
+
+
+/*!
+ * @brief solve Kepler Equation with a solver plan for an array
+ * @details same results as kesolver_batch() with the parameters of the plan
+ * @param[in] plan pointer to structure of type #kes_plan_t
+ * @param[in] ma array of mean anomalies (in radians)
+ * @param[out] ea array of solutions to Kepler Equation
+ * @param[in] n number of elements
+ * @return error code from enum #kes_err_e;
+ * KES_ERR_NOERR if all elements were solved, else code of first failure
+ */
+kes_err_e kes_plan_solve_batch(
+    const kes_plan_t* plan,
+    const double*     ma,
+    double*           ea,
+    const size_t      n
+);
+
+
+/*!
+ * @brief attach a piecewise Chebyshev table to an elliptic solver plan
+ * @details fits E(M) on 0 <= M <= pi once, afterwards kes_plan_solve(),
+ * kes_plan_solve_batch() and kes_plan_solve_warm() evaluate the table
+ * without iterations and transcendental function calls, using the same
+ * reduction of the mean anomaly as kesolver(); the error of the table is
+ * about \a tol relative to E plus rounding errors of a few ulp; segments are
+ * denser near M = 0 for high eccentricities, the table takes a few kB, see
+ * kes_plan_table_bytes(); the table is allocated by the allocator of
+ * kes_set_allocator(); if memory cannot be allocated, the plan keeps
+ * iterating and kes_plan_table_bytes() returns 0
+ * @param[in,out] plan pointer to structure of type #kes_plan_t
+ * @param[in] tol tolerance of the fit (KES_TABLE_TOL <= tol < 1,
+ * or 0 for default KES_TABLE_TOL = 1E-15)
+ * @return error code from enum #kes_err_e;
+ * KES_ERR_BADECC if the plan is not elliptic, KES_ERR_BADTOL for bad values
+ * of the tolerance, KES_ERR_NOMEM if memory cannot be allocated
+ */
+kes_err_e kes_plan_table_init(
+    kes_plan_t*  plan,
+    const double tol
+);
+
+
+/*!
+ * @brief workspace size of the table of an elliptic solver plan
+ * @details fits the table without storing it, i.e. takes as long as
+ * kes_plan_table_init(); the size depends on the eccentricity and \a tol
+ * only
+ * @param[in] plan pointer to structure of type #kes_plan_t
+ * @param[in] tol tolerance of the fit (as for kes_plan_table_init())
+ * @param[out] status pointer to return error code from enum #kes_err_e
+ * (may be NULL)
+ * @return number of bytes for kes_plan_table_init_ws(), 0 on error
+ */
+size_t kes_plan_table_size(
+    const kes_plan_t* plan,
+    const double      tol,
+    kes_err_e*        status
+);
+
+
+/*!
+ * @brief attach a table in a caller-provided buffer to an elliptic plan
+ * @details same table as kes_plan_table_init(), but no memory is
+ * allocated; the buffer must be aligned for double (64 bytes keeps the
+ * segments in as few cache lines as possible) and must stay valid while
+ * the plan uses the table; kes_plan_table_free() detaches the table
+ * without releasing the buffer; several tables may share one buffer
+ * one after the other, see kes_arena_alloc()
+ * @param[in,out] plan pointer to structure of type #kes_plan_t
+ * @param[in] tol tolerance of the fit (as for kes_plan_table_init())
+ * @param[out] buf buffer for the table
+ * @param[in] size number of bytes of \a buf, at least
+ * kes_plan_table_size()
+ * @return error code from enum #kes_err_e; as for kes_plan_table_init(),
+ * KES_ERR_NOMEM if the buffer is too small or misaligned
+ */
+kes_err_e kes_plan_table_init_ws(
+    kes_plan_t*  plan,
+    const double tol,
+    void*        buf,
+    const size_t size
+);
+
+
+/*!
+ * @brief memory footprint of the table of a solver plan
+ * @param[in] plan pointer to structure of type #kes_plan_t
+ * @return number of bytes allocated for the table (0 if there is none)
+ */
+size_t kes_plan_table_bytes(const kes_plan_t* plan);
+
+
+/*!
+ * @brief release the table of a solver plan
+ * @details the plan iterates again afterwards
+ * @param[in,out] plan pointer to structure of type #kes_plan_t
+ */
+void kes_plan_table_free(kes_plan_t* plan);
+
+
+/*!
+ * @brief reset state of a warm-start solver
+ * @details the next call of kes_plan_solve_warm() uses the starter method of
+ * the plan instead of the previous solution
+ * @param[out] warm pointer to structure of type #kes_warm_t
+ */
+void kes_warm_init(kes_warm_t* warm);
+
+
+/*!
+ * @brief solve Kepler Equation with a solver plan and warm start
+ * @details for a time sequence of mean anomalies, e.g. M = n*t, the starting
+ * value is extrapolated from the previous solution by
+ * E = E(prev) + (M - M(prev)) / (1 - e*cos(E(prev))), which is valid across
+ * the wrap at multiples of 2*pi; the starter method of the plan is used for
+ * the first call or if the extrapolation step exceeds KES_WARM_MAXSTEP;
+ * for warm starts, KES_FIX_AUTO iterates until the tolerances are reached;
+ * NOTE Markley's and Mikkola's method compute their own starting values
+ * @param[in] plan pointer to structure of type #kes_plan_t
+ * @param[in] ma mean anomaly (in radians)
+ * @param[in,out] warm pointer to state of type #kes_warm_t
+ * @param[out] status pointer to return error code from enum #kes_err_e
+ * @return solution to Kepler Equation
+ */
+double kes_plan_solve_warm(
+    const kes_plan_t* plan,
+    const double      ma,
+    kes_warm_t*       warm,
+    kes_err_e*        status
+);
+
+/*!
+ * @brief solve Kepler Equation with a solver plan for a sorted array
+ * @details for dense grids of mean anomalies in ascending or descending
+ * order, e.g. for plots or sampling, the starting value of each element is
+ * extrapolated by E = E(prev) + (M - M(prev)) / (1 - e*cos(E(prev))) from
+ * the last solution of the previous block of KES_VEC_LEN elements, which are
+ * then iterated by the vectorized solver; the starter method of the plan is
+ * used per element if the step exceeds KES_WARM_MAXSTEP or the sequence
+ * crossed M = 0 or M = pi of the reduced range; KES_FIX_AUTO iterates until
+ * the tolerances are reached; the order is checked once, unsorted arrays,
+ * plans with a table and solvers without a vectorized implementation are
+ * solved by kes_plan_solve_batch()
+ * @param[in] plan pointer to structure of type #kes_plan_t
+ * @param[in] ma array of mean anomalies (in radians)
+ * @param[out] ea array of solutions to Kepler Equation
+ * @param[in] n number of elements
+ * @return error code from enum #kes_err_e;
+ * KES_ERR_NOERR if all elements were solved, else code of first failure
+ */
+kes_err_e kes_plan_solve_sweep(
+    const kes_plan_t* plan,
+    const double*     ma,
+    double*           ea,
+    const size_t      n
+);
+
+
+/*!
+ * @brief solve Kepler Equation with a solver plan for a sorted array with a
+ * summary of errors
+ * @details same solutions as kes_plan_solve_sweep(), the outcome is
+ * summarized in \a report as by kesolver_batch_report(), including the
+ * number of elements stopped by "maxiter"
+ * @param[in] plan pointer to structure of type #kes_plan_t
+ * @param[in] ma array of mean anomalies (in radians)
+ * @param[out] ea array of solutions to Kepler Equation
+ * @param[in] n number of elements
+ * @param[out] report pointer to summary of type #kes_report_t (or NULL)
+ * @return error code from enum #kes_err_e;
+ * KES_ERR_NOERR if all elements were solved, else code of first failure
+ */
+kes_err_e kes_plan_solve_sweep_report(
+    const kes_plan_t* plan,
+    const double*     ma,
+    double*           ea,
+    const size_t      n,
+    kes_report_t*     report
+);
+
 #ifdef __cplusplus
 }
 #endif
@@ -29,10 +29,19 @@
  * along with libkes.  If not, see <https://www.gnu.org/licenses/>.
  *
  ******************************************************************************/
+/* include standard headers */
+#include <float.h>
+#include <pthread.h>
+#include <stddef.h>
+#include <stdlib.h>
+
 /* include module headers */
 #include "starter.h"
 #include "const.h"
+#include "itercore.h"
 #include "utils.h"
+#include "version.h"
+#include "vstarter.h"
 
 /******************************************************************************/
 
@@ -54,7 +63,7 @@
  *  STARTER   : KES_STM_ES00
  *  ORDER     : O(e^0)
  *  FORMULA   : E0 = pi
- *  REFERENCE : TODO
+ *  REFERENCE : own development, see also stm_s10 for the corner region
  ******************************************************************************/
 static inline double stm_s0(
     const double ecc,
@@ -379,6 +388,268 @@ static inline double stm_s14(
 
 /******************************************************************************/
 
+/*** tabulated starter KES_STM_ES15 ***/
+
+/* number of grid intervals in coordinates x = 1 - sqrt(1-e) and t = M^(1/3)
+ * NOTE table holds (NX+1)*(NT+1)*4 doubles, i.e. about 132 kB
+ */
+#define KES_STM_TAB_NX 64
+#define KES_STM_TAB_NT 64
+
+/* below t = t_c and for e >= 0.5 the grid cannot resolve the singularity
+ * at (e,M) = (1,0), use the series solution of the cubic approximation
+ */
+static const double stm_tab_tc = 0.2;
+static const double stm_tab_ec = 0.5;
+
+/* grid nodes: E, dE/dt, dE/dx, d2E/dxdt; built once, then read-only */
+static double stm_tab_mem[KES_STM_TAB_NX+1][KES_STM_TAB_NT+1][4];
+
+/* table in use, either the one built in memory or a mapped table file */
+static const double (*stm_tab)[KES_STM_TAB_NT+1][4] = stm_tab_mem;
+
+/* table file to attach instead of building, see kes_starter_table_attach */
+static const double* stm_tab_ext = NULL;
+
+/* ensures the table is built exactly once, also for concurrent callers */
+static pthread_once_t stm_tab_once = PTHREAD_ONCE_INIT;
+
+/*******************************************************************************
+ *  FUNCTION    : stm_cubic
+ *  DESCRIPTION : starter near the singular corner (e,M) = (1,0) from
+ *                (1 - e) * E + e * E^3 / 6 = M plus correction for E^5 term
+ *  INPUT       : - eccentricity "ecc" (0 < ecc <= 1)
+ *                - mean anomaly "ma" (in radians)
+ *  OUTPUT      : starting value
+ *  REFERENCE : Ng (1979), Celestial Mechanics 20, p.243-249
+ ******************************************************************************/
+static inline double stm_cubic(
+    const double ecc,
+    const double ma
+    )
+{
+    /* solution of the cubic equation, see stm_s10 */
+    const double q  = 2.0 * (1.0 - ecc) / ecc;
+    const double r  = 3.0 * ma / ecc;
+    const double s  = cbrt(sqrt(q*q*q + r*r) + r);
+    const double x  = s - q / s;
+    const double x2 = x * x;
+
+    /* first order correction for neglected term e * E^5 / 120 */
+    return( x + ecc * x2 * x2 * x / (120.0 * ((1.0 - ecc) + 0.5 * ecc * x2)) );
+} // end stm_cubic
+
+/*******************************************************************************
+ *  FUNCTION    : stm_tab_build
+ *  DESCRIPTION : calculate solution and derivatives at all grid nodes
+ *  INPUT       : none
+ *  OUTPUT      : none
+ ******************************************************************************/
+static void stm_tab_build(void)
+{
+    const double tmax = cbrt(M_PI);
+
+    /* use a table file, either given to kes_table_load() or by environment */
+    const char*   name = getenv("KES_TABLE_FILE");
+    const double* ext  = ((stm_tab_ext == NULL) && (name != NULL) ?
+                          kes_table_map(name, NULL) : stm_tab_ext);
+    if ( ext != NULL )
+    {
+        stm_tab = (const double (*)[KES_STM_TAB_NT+1][4])ext;
+        return;
+    } // end if
+
+    for (int i = 0; i <= KES_STM_TAB_NX; i++)
+    {
+        const double x   = (double)i / KES_STM_TAB_NX;
+        const double ecc = 1.0 - (1.0 - x) * (1.0 - x);
+
+        for (int j = 0; j <= KES_STM_TAB_NT; j++)
+        {
+            const double t  = tmax * j / KES_STM_TAB_NT;
+            const double ma = ((j < KES_STM_TAB_NT) ? t * t * t : M_PI);
+            double*      nd = stm_tab_mem[i][j];
+
+            /* solve Kepler Equation to full precision */
+            double E = ((ecc > 0.0) ? stm_s10(ecc, ma) : ma);
+            for (int n = 0; n < 50; n++)
+            {
+                const double Enew = kes_itercore3(ecc, ma, E);
+                const double dx   = fabs(Enew - E);
+                E = Enew;
+                if ( dx <= 4.0 * DBL_EPSILON * E )
+                {
+                    break;
+                } // end if
+            } // end for
+
+            /* derivatives dE/dt, dE/dx and d2E/dxdt, using
+             * dE/dM = 1 / (1 - e*cos(E)), dE/de = sin(E) / (1 - e*cos(E))
+             */
+            const double f1 = 1.0 - ecc * cos(E);
+            nd[0] = E;
+            if ( ma > 0.0 )
+            {
+                nd[1] = 3.0 * t * t / f1;
+                nd[2] = 2.0 * (1.0 - x) * sin(E) / f1;
+                nd[3] = 2.0 * (1.0 - x) * nd[1] * (cos(E) - ecc) / (f1 * f1);
+            } // end if
+            else
+            {
+                /* limit t -> 0: E = (6*M)^(1/3) for e = 1 */
+                nd[1] = ((i == KES_STM_TAB_NX) ? cbrt(6.0) : 0.0);
+                nd[2] = nd[3] = 0.0;
+            } // end else
+        } // end for
+    } // end for
+} // end stm_tab_build
+
+/*******************************************************************************
+ *  STARTER   : KES_STM_ES15
+ *  ORDER     : tabulated, error about 1E-5 or better in 0 <= e < 1
+ *  FORMULA   : bicubic Hermite interpolation of E(x,t) on a grid in
+ *              x = 1 - sqrt(1-e), t = M^(1/3) using exact derivatives,
+ *              near (e,M) = (1,0) series solution of cubic approximation
+ *  REFERENCE : own development, see also stm_s10 for the corner region
+ ******************************************************************************/
+static inline double stm_s15(
+    const double ecc,
+    const double ma
+    )
+{
+    /* fallback outside of tabulated domain */
+    if ( !((ecc >= 0.0) && (ecc < 1.0) && (ma >= 0.0) && (ma <= M_PI)) )
+    {
+        return( stm_s4(ecc, ma) );
+    } // end if
+
+    const double t = cbrt(ma);
+
+    /* vicinity of singular corner */
+    if ( (t < stm_tab_tc) && (ecc >= stm_tab_ec) )
+    {
+        return( stm_cubic(ecc, ma) );
+    } // end if
+
+    /* build table on first use */
+    pthread_once( &stm_tab_once, stm_tab_build );
+
+    /* locate grid cell and local coordinates 0 <= u,v <= 1 */
+    const double ht = cbrt(M_PI) / KES_STM_TAB_NT;
+    const double hx = 1.0 / KES_STM_TAB_NX;
+    const double px = (1.0 - sqrt(1.0 - ecc)) * KES_STM_TAB_NX;
+    const double pt = t / ht;
+    const int    i  = ((px < KES_STM_TAB_NX) ? (int)px : KES_STM_TAB_NX - 1);
+    const int    j  = ((pt < KES_STM_TAB_NT) ? (int)pt : KES_STM_TAB_NT - 1);
+    const double u  = px - i;
+    const double v  = pt - j;
+
+    /* cubic Hermite basis functions in x (a) and t (b),
+     * derivative terms scaled by grid spacing
+     */
+    const double a[4] = {
+        (1.0 + 2.0 * u) * (1.0 - u) * (1.0 - u), hx * u * (1.0 - u) * (1.0 - u),
+        u * u * (3.0 - 2.0 * u),                 hx * u * u * (u - 1.0)
+    };
+    const double b[4] = {
+        (1.0 + 2.0 * v) * (1.0 - v) * (1.0 - v), ht * v * (1.0 - v) * (1.0 - v),
+        v * v * (3.0 - 2.0 * v),                 ht * v * v * (v - 1.0)
+    };
+
+    /* tensor product over the four corners of the cell */
+    double E = 0.0;
+    for (int di = 0; di < 2; di++)
+    {
+        for (int dj = 0; dj < 2; dj++)
+        {
+            const double* nd = stm_tab[i + di][j + dj];
+            const double  ax = a[2 * di], dax = a[2 * di + 1];
+            const double  bt = b[2 * dj], dbt = b[2 * dj + 1];
+
+            E += ax * bt * nd[0] + ax * dbt * nd[1] +
+                 dax * bt * nd[2] + dax * dbt * nd[3];
+        } // end for
+    } // end for
+
+    return( E );
+} // end stm_s15
+
+/******************************************************************************/
+
+/*******************************************************************************
+ *  FUNCTION    : kes_starter_table_init
+ *  DESCRIPTION : build table for starter KES_STM_ES15 in advance
+ *  INPUT       : none
+ *  OUTPUT      : none
+ ******************************************************************************/
+void kes_starter_table_init(void)
+{
+    pthread_once( &stm_tab_once, stm_tab_build );
+} // end kes_starter_table_init
+
+/******************************************************************************/
+
+/*******************************************************************************
+ *  FUNCTION    : kes_starter_table_shape
+ *  DESCRIPTION : query layout and parameters of table for KES_STM_ES15
+ *  INPUT       : - array "dims" to return grid intervals in x and t and
+ *                  number of values per node
+ *                - array "par" to return t_c and e_c of the corner region
+ *  OUTPUT      : size of table in bytes
+ ******************************************************************************/
+size_t kes_starter_table_shape(
+    int    dims[3],
+    double par[2]
+    )
+{
+    dims[0] = KES_STM_TAB_NX;
+    dims[1] = KES_STM_TAB_NT;
+    dims[2] = 4;
+    par[0]  = stm_tab_tc;
+    par[1]  = stm_tab_ec;
+
+    return( sizeof(stm_tab_mem) );
+} // end kes_starter_table_shape
+
+/******************************************************************************/
+
+/*******************************************************************************
+ *  FUNCTION    : kes_starter_table_data
+ *  DESCRIPTION : get table for KES_STM_ES15, build it if necessary
+ *  INPUT       : none
+ *  OUTPUT      : pointer to table in use
+ ******************************************************************************/
+const double* kes_starter_table_data(void)
+{
+    pthread_once( &stm_tab_once, stm_tab_build );
+
+    return( &stm_tab[0][0][0] );
+} // end kes_starter_table_data
+
+/******************************************************************************/
+
+/*******************************************************************************
+ *  FUNCTION    : kes_starter_table_attach
+ *  DESCRIPTION : use a validated table file for KES_STM_ES15
+ *  INPUT       : pointer "data" to the mapped table
+ *  OUTPUT      : 1 if the table is attached, 0 if a table is already in use
+ ******************************************************************************/
+int kes_starter_table_attach(const double* data)
+{
+    static pthread_mutex_t lock = PTHREAD_MUTEX_INITIALIZER;
+
+    pthread_mutex_lock( &lock );
+    stm_tab_ext = data;
+    pthread_once( &stm_tab_once, stm_tab_build );
+    const int res = ((const double*)stm_tab == data);
+    stm_tab_ext = NULL;
+    pthread_mutex_unlock( &lock );
+
+    return( res );
+} // end kes_starter_table_attach
+
+/******************************************************************************/
+
 /*******************************************************************************
  *  FUNCTION    : kes_starter
  *  DESCRIPTION : evaluate chosen starter method and return starting value for
@@ -584,6 +855,21 @@ double kes_starter(
         /*** END starters O(e^6) ***/
 
 
+        /*** BEGIN tabulated starters ***/
+
+        /* Starter S15 */
+        case KES_STM_ES15:
+        {
+            ret = stm_s15(ecc, ma);
+#if KES_STARTER_DEBUG
+    KES_DEBUG_STM("KES_STM_ES15", ecc, ma, ret);
+#endif
+            break;
+        } // end case
+
+        /*** END tabulated starters ***/
+
+
         /* fallback case */
         default:
         {
@@ -597,3 +883,135 @@ double kes_starter(
 } // end kes_starter
 
 /******************************************************************************/
+
+/* structure for indirect access to starter functions */
+typedef struct
+{
+    kes_stm_e         id;
+    kes_stm_t* const  func;
+} kes_stm_list_t;
+
+/* list of starter methods and pointers to corresponding functions */
+static const kes_stm_list_t list_of_starters[KES_STM_TOTAL] = {
+    {KES_STM_NONE, NULL},
+    {KES_STM_ES00, &stm_s0},
+    {KES_STM_ES01, &stm_s1},
+    {KES_STM_ES02, &stm_s2},
+    {KES_STM_ES03, &stm_s3},
+    {KES_STM_ES04, &stm_s4},
+    {KES_STM_ES05, &stm_s5},
+    {KES_STM_ES06, &stm_s6},
+    {KES_STM_ES07, &stm_s7},
+    {KES_STM_ES08, &stm_s8},
+    {KES_STM_ES09, &stm_s9},
+    {KES_STM_ES10, &stm_s10},
+    {KES_STM_ES11, &stm_s11},
+    {KES_STM_ES12, &stm_s12},
+    {KES_STM_ES13, &stm_s13},
+    {KES_STM_ES14, &stm_s14},
+    {KES_STM_ES15, &stm_s15}
+};
+
+/******************************************************************************/
+
+/*******************************************************************************
+ *  FUNCTION    : kes_starter_func
+ *  DESCRIPTION : look up the function implementing starter method "type"
+ *  INPUT       : starter method "type" from list kes_stm_e
+ *  OUTPUT      : pointer to starter function, NULL for invalid method
+ ******************************************************************************/
+kes_stm_t* kes_starter_func(const kes_stm_e type)
+{
+    if (
+        (type <= KES_STM_NONE) ||
+        (type >= KES_STM_TOTAL)
+    ) {
+        return( NULL );
+    } // end if
+
+    return( list_of_starters[type].func );
+} // end kes_starter_func
+
+/******************************************************************************/
+
+/*******************************************************************************
+ *  FUNCTION    : kes_starter_batch
+ *  DESCRIPTION : evaluate chosen starter method for arrays of elements,
+ *                blocks of KES_VEC_LEN elements are evaluated by the
+ *                vectorized starters if available
+ *  INPUT       : - number of elements "n"
+ *                - array of eccentricities "ecc" with stride "incecc"
+ *                  (0 = common eccentricity)
+ *                - array of mean anomalies "ma" in radians
+ *                - array "x" to return the starting values
+ *                - starter method "type" from list kes_stm_e
+ *  OUTPUT      : error code (see error.h)
+ ******************************************************************************/
+kes_err_e kes_starter_batch(
+    const size_t    n,
+    const double*   ecc,
+    const size_t    incecc,
+    const double*   ma,
+    double*         x,
+    const kes_stm_e type
+    )
+{
+    double lecc[KES_VEC_LEN]; /* eccentricities of lanes */
+    double lma[KES_VEC_LEN];  /* mean anomalies of lanes */
+    double lx[KES_VEC_LEN];   /* starting values of lanes */
+
+    kes_stm_t* stm = kes_starter_func( type );
+
+    /* exception: check starter method type */
+    if ( stm == NULL )
+    {
+        for (size_t i = 0; i < n; i++)
+        {
+            x[i] = 0.0;
+        } // end for
+
+        return( KES_ERR_BADSTM );
+    } // end if
+
+    /* scalar evaluation if there is no vectorized starter */
+    if ( !kes_vstarter_supported( type ) )
+    {
+        for (size_t i = 0; i < n; i++)
+        {
+            x[i] = stm( ecc[i * incecc], ma[i] );
+        } // end for
+
+        return( KES_ERR_NOERR );
+    } // end if
+
+    for (size_t i0 = 0; i0 < n; i0 += KES_VEC_LEN)
+    {
+        const int lanes = ((n - i0 > KES_VEC_LEN) ?
+                           KES_VEC_LEN : (int)(n - i0));
+
+        /* full blocks of contiguous arrays without copies */
+        if ( (incecc == 1) && (lanes == KES_VEC_LEN) )
+        {
+            kes_vstarter( type, &ecc[i0], &ma[i0], &x[i0] );
+            continue;
+        } // end if
+
+        /* collect lanes, fill unused lanes with harmless dummy values */
+        for (int l = 0; l < KES_VEC_LEN; l++)
+        {
+            lecc[l] = ((l < lanes) ? ecc[(i0 + l) * incecc] : 0.5);
+            lma[l]  = ((l < lanes) ? ma[i0 + l] : 1.0);
+        } // end for
+
+        kes_vstarter( type, lecc, lma, lx );
+
+        for (int l = 0; l < lanes; l++)
+        {
+            x[i0 + l] = lx[l];
+        } // end for
+    } // end for
+
+    return( KES_ERR_NOERR );
+} // end kes_starter_batch
+
+/******************************************************************************/
@@ -27,6 +27,9 @@
 #ifndef KES_STARTER__H
 #define KES_STARTER__H
 
+/* include standard headers */
+#include <stddef.h>
+
 /* include module headers */
 #include "error.h"
 
@@ -60,9 +63,9 @@ typedef enum
     KES_STM_ES12,     ///< starter S12 from Odell & Gooding (1986)
     KES_STM_ES13,     ///< starter from Encke (1850)
     KES_STM_ES14,     ///< starter from Charles & Tatum (1998)
+    KES_STM_ES15,     ///< starter from tabulated solutions (lookup table)
 
-    /* TODO FIXME different starter methods for hyperbolic case */
-    //KES_STM_HS00,
+    /* NOTE starter methods for the hyperbolic case, see kes_hstm_e */
 
     /* TODO FIXME different starter methods for parabolic case */
     //KES_STM_PS00,
@@ -70,6 +73,16 @@ typedef enum
     KES_STM_TOTAL     ///< total number of available starting value methods
 } kes_stm_e;
 
+
+/*!
+ * @brief prototype declaration for starter functions
+ * @details functions return the starting value for the reduced mean anomaly
+ */
+typedef double kes_stm_t(
+    const double ecc,
+    const double ma
+);
+
 /******************************************************************************/
 
 /*** function declarations ***/
@@ -93,6 +106,80 @@ double kes_starter(
     kes_err_e*      status
 );
 
+
+/*!
+ * @brief starting values for arrays of eccentricities and mean anomalies
+ * @details evaluates the same formulas as kes_starter() for all elements,
+ * KES_STM_ES00 to KES_STM_ES14 with vectorized math functions (their
+ * results agree with kes_starter() to a few ulp), KES_STM_ES15 element by
+ * element; starters are meant for reduced mean anomalies 0 <= ma <= pi and
+ * serve as cheap approximations of the solution, too
+ * @param[in] n number of elements
+ * @param[in] ecc array of eccentricities
+ * @param[in] incecc stride of ecc: 1 for one eccentricity per element, 0 for
+ * a common eccentricity ecc[0]
+ * @param[in] ma array of n mean anomalies (in radians)
+ * @param[out] x array of n starting values, must not overlap ecc or ma
+ * @param[in] type choose a starter method from enum #kes_stm_e
+ * @return error code from enum #kes_err_e, KES_ERR_BADSTM for an invalid
+ * method (all x are set to 0)
+ */
+kes_err_e kes_starter_batch(
+    const size_t    n,
+    const double*   ecc,
+    const size_t    incecc,
+    const double*   ma,
+    double*         x,
+    const kes_stm_e type
+);
+
+
+/*!
+ * @brief look up the function implementing a starter method
+ * @details allows to resolve the starter method once, e.g. for batch solvers
+ * @param[in] type a starter method from enum #kes_stm_e
+ * @return pointer to starter function, NULL for an invalid method
+ */
+kes_stm_t* kes_starter_func(const kes_stm_e type);
+
+
+/*!
+ * @brief build the lookup table of starter method KES_STM_ES15
+ * @details the table is built automatically on first use of KES_STM_ES15;
+ * call this function in advance to avoid the delay in the first call,
+ * the table is shared read-only between threads
+ */
+void kes_starter_table_init(void);
+
+
+/*!
+ * @brief layout and parameters of the lookup table of KES_STM_ES15
+ * @param[out] dims grid intervals in x and t, number of values per node
+ * @param[out] par parameters t_c and e_c of the corner region
+ * @return size of the table in bytes
+ */
+size_t kes_starter_table_shape(
+    int    dims[3],
+    double par[2]
+);
+
+
+/*!
+ * @brief lookup table of KES_STM_ES15 in use, built if necessary
+ * @return pointer to the table, see kes_starter_table_shape() for the layout
+ */
+const double* kes_starter_table_data(void);
+
+
+/*!
+ * @brief use a validated table file as lookup table of KES_STM_ES15
+ * @details the table cannot be replaced once it is in use, i.e. call this
+ * before the first use of KES_STM_ES15 or kes_starter_table_init()
+ * @param[in] data pointer to the table, must stay valid until program exit
+ * @return 1 if the table is attached, 0 if another table is already in use
+ */
+int kes_starter_table_attach(const double* data);
+
 #ifdef __cplusplus
 }
 #endif
@@ -0,0 +1,443 @@
+/***************************************************************************//**
+ * @file    state.c
+ * @brief   conversion of orbital elements to state vectors
+ * @author  Bazso Akos
+ * @version 2026.10
+ *
+ * @copyright
+ * Copyright (C) 2019 Bazso Akos
+ *
+ * This file is part of libkes.
+ *
+ * libkes is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * libkes is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with libkes.  If not, see <https://www.gnu.org/licenses/>.
+ *
+ ******************************************************************************/
+/* include standard headers */
+#include <math.h>
+#include <stdio.h>
+
+/* include module headers */
+#include "state.h"
+#include "const.h"
+#include "vecmath.h"
+
+/******************************************************************************/
+
+/* use verbose debug output? 0 = no (default), 1 = yes */
+#define KES_STATE_DEBUG 0
+
+/* number of elements solved per call of kesolver_batch(), size of the work
+ * arrays on the stack
+ */
+#define KES_STATE_BLOCK 256
+
+/******************************************************************************/
+
+/* rotation from the perifocal frame to the reference frame, i.e. the unit
+ * vectors P (towards pericenter) and Q (90 degrees ahead in the orbit plane)
+ */
+typedef struct
+{
+    double px, py, pz;
+    double qx, qy, qz;
+} state_rot_t;
+
+/******************************************************************************/
+
+/*******************************************************************************
+ *  FUNCTION    : state_rotation
+ *  DESCRIPTION : compute the rotation matrix of an orbit
+ *  INPUT       : - inclination "inc" (in radians)
+ *                - longitude of the ascending node "node" (in radians)
+ *                - argument of pericenter "argp" (in radians)
+ *  OUTPUT      : unit vectors P and Q
+ *  REFERENCE   : Stumpff (1959), eq. (I; 29)
+ ******************************************************************************/
+static inline state_rot_t state_rotation(
+    const double inc,
+    const double node,
+    const double argp
+    )
+{
+    double si, ci, sn, cn, sw, cw;
+    state_rot_t rot;
+
+    /* NOTE branch-free for vectorization of the loops over elements */
+    kes_vec_sincos( &si, &ci, inc );
+    kes_vec_sincos( &sn, &cn, node );
+    kes_vec_sincos( &sw, &cw, argp );
+
+    rot.px =  cw * cn - sw * sn * ci;
+    rot.py =  cw * sn + sw * cn * ci;
+    rot.pz =  sw * si;
+    rot.qx = -sw * cn - cw * sn * ci;
+    rot.qy = -sw * sn + cw * cn * ci;
+    rot.qz =  cw * si;
+
+    return( rot );
+} // end state_rotation
+
+/******************************************************************************/
+
+/*******************************************************************************
+ *  FUNCTIONS   : state_peri_ell, state_peri_hyp, state_peri_par
+ *  DESCRIPTION : position (xp, yp) and velocity (vxp, vyp) in the perifocal
+ *                frame from the solution of Kepler's Equation, i.e. the
+ *                elliptic (E) or hyperbolic (H) eccentric anomaly, or the
+ *                true anomaly (nu) in the parabolic case
+ *  INPUT       : - semi-major axis "a" (a > 0 elliptic, a < 0 hyperbolic)
+ *                - eccentricity "ecc"
+ *                - square roots "b" = sqrt(|1 - ecc^2|) and "k" =
+ *                  sqrt(mu * |a|), or only k = sqrt(mu / p) with the
+ *                  semi-latus rectum p in the parabolic case
+ *                - solution "x" of kesolver()
+ *                - pointer to array "pv" for xp, yp, vxp, vyp
+ *  OUTPUT      : none
+ *  NOTE square roots are computed by the caller, since sqrt() may set errno
+ *       and prevents vectorization of the loops over elements
+ *  REFERENCE   : Stumpff (1959), eqs. (II; 12), (III; 47)
+ ******************************************************************************/
+static inline void state_peri_ell(
+    const double a,
+    const double ecc,
+    const double b,
+    const double k,
+    const double x,
+    double*      pv
+    )
+{
+    double sx, cx;
+
+    /* NOTE branch-free for vectorization of the loops over elements */
+    kes_vec_sincos( &sx, &cx, x );
+
+    /* k / (r / a) = sqrt(mu * a) / r */
+    const double kr = k / (a * (1.0 - ecc * cx));
+
+    pv[0] =  a * (cx - ecc);
+    pv[1] =  a * b * sx;
+    pv[2] = -kr * sx;
+    pv[3] =  kr * b * cx;
+
+    return;
+} // end state_peri_ell
+
+static void state_peri_hyp(
+    const double a,
+    const double ecc,
+    const double b,
+    const double k,
+    const double x,
+    double*      pv
+    )
+{
+    double sx, cx;
+    kes_sinhcosh( &sx, &cx, x, -1.0 );
+    const double kr = k / (a * (1.0 - ecc * cx));
+
+    pv[0] =  a * (cx - ecc);
+    pv[1] = -a * b * sx;
+    pv[2] = -kr * sx;
+    pv[3] =  kr * b * cx;
+
+    return;
+} // end state_peri_hyp
+
+static void state_peri_par(
+    const double a,
+    const double ecc,
+    const double k,
+    const double x,
+    double*      pv
+    )
+{
+    double sx, cx;
+
+    kes_sincos( &sx, &cx, x, -1.0 );
+
+    /* radius r from semi-latus rectum p */
+    const double r = a * (1.0 - ecc * ecc) / (1.0 + ecc * cx);
+
+    pv[0] =  r * cx;
+    pv[1] =  r * sx;
+    pv[2] = -k * sx;
+    pv[3] =  k * (ecc + cx);
+
+    return;
+} // end state_peri_par
+
+/******************************************************************************/
+
+/*******************************************************************************
+ *  FUNCTIONS   : state_block_common, state_block_array
+ *  DESCRIPTION : state vectors of a block of valid elliptic elements, for a
+ *                common orbit with constant rotation "rot" or for arrays of
+ *                orbits; separate functions let the compiler vectorize loops
+ *  INPUT       : - number of elements "m"
+ *                - orbital elements (scalars or arrays)
+ *                - square roots "b", "k" (see state_peri_ell)
+ *                - solutions "ea" of kesolver()
+ *                - arrays of state vectors "x" ... "vz"
+ *  OUTPUT      : none
+ ******************************************************************************/
+static void state_block_common(
+    const size_t           m,
+    const double           a,
+    const double           ecc,
+    const double           b,
+    const double           k,
+    const state_rot_t      rot,
+    const double* restrict ea,
+    double* restrict       x,
+    double* restrict       y,
+    double* restrict       z,
+    double* restrict       vx,
+    double* restrict       vy,
+    double* restrict       vz
+    )
+{
+    for (size_t i = 0; i < m; i++)
+    {
+        double pv[4];
+        state_peri_ell( a, ecc, b, k, ea[i], pv );
+
+        x[i]  = pv[0] * rot.px + pv[1] * rot.qx;
+        y[i]  = pv[0] * rot.py + pv[1] * rot.qy;
+        z[i]  = pv[0] * rot.pz + pv[1] * rot.qz;
+        vx[i] = pv[2] * rot.px + pv[3] * rot.qx;
+        vy[i] = pv[2] * rot.py + pv[3] * rot.qy;
+        vz[i] = pv[2] * rot.pz + pv[3] * rot.qz;
+    } // end for
+
+    return;
+} // end state_block_common
+
+static void state_block_array(
+    const size_t           m,
+    const double* restrict a,
+    const double* restrict ecc,
+    const double* restrict inc,
+    const double* restrict node,
+    const double* restrict argp,
+    const double* restrict b,
+    const double* restrict k,
+    const double* restrict ea,
+    double* restrict       x,
+    double* restrict       y,
+    double* restrict       z,
+    double* restrict       vx,
+    double* restrict       vy,
+    double* restrict       vz
+    )
+{
+    for (size_t i = 0; i < m; i++)
+    {
+        double pv[4];
+        const state_rot_t rot = state_rotation( inc[i], node[i], argp[i] );
+        state_peri_ell( a[i], ecc[i], b[i], k[i], ea[i], pv );
+
+        x[i]  = pv[0] * rot.px + pv[1] * rot.qx;
+        y[i]  = pv[0] * rot.py + pv[1] * rot.qy;
+        z[i]  = pv[0] * rot.pz + pv[1] * rot.qz;
+        vx[i] = pv[2] * rot.px + pv[3] * rot.qx;
+        vy[i] = pv[2] * rot.py + pv[3] * rot.qy;
+        vz[i] = pv[2] * rot.pz + pv[3] * rot.qz;
+    } // end for
+
+    return;
+} // end state_block_array
+
+/******************************************************************************/
+
+/*******************************************************************************
+ *  FUNCTION    : kes_elements_to_state
+ *  DESCRIPTION : convert orbital elements and mean anomalies to state vectors
+ *  INPUT       : - number of elements "n"
+ *                - gravitational parameter "mu"
+ *                - pointer to orbital elements "elem"
+ *                - array of mean anomalies "ma"
+ *                - pointer to arrays of state vectors "state"
+ *                - starter method "init" from kes_stm_e
+ *                - solver method "iter" from kes_sol_e
+ *                - pointer to input parameters "data" (or NULL)
+ *                - optional array of per-element error codes "status"
+ *  OUTPUT      : error code of the first failing element, or KES_ERR_NOERR
+ ******************************************************************************/
+kes_err_e kes_elements_to_state(
+    const size_t          n,
+    const double          mu,
+    const kes_elements_t* elem,
+    const double*         ma,
+    kes_state_t*          state,
+    const kes_stm_e       init,
+    const kes_sol_e       iter,
+    const kes_input_t*    data,
+    kes_err_e*            status
+    )
+{
+    double    ea[KES_STATE_BLOCK];  /* solutions of Kepler's Equation */
+    kes_err_e err[KES_STATE_BLOCK]; /* error codes of a block */
+    kes_ecc_e type[KES_STATE_BLOCK]; /* eccentricity domains of a block */
+    double    sb[KES_STATE_BLOCK];  /* sqrt(|1 - ecc^2|) */
+    double    sk[KES_STATE_BLOCK];  /* sqrt(mu * |a|) or sqrt(mu / p) */
+    kes_err_e ret = KES_ERR_NOERR;
+
+    /* nothing to do for empty arrays */
+    if ( n == 0 )
+    {
+        return( ret );
+    } // end if
+
+    /* exception: missing arrays */
+    if ( (elem == NULL) || (ma == NULL) || (state == NULL) )
+    {
+        return( KES_ERR_BADVAL );
+    } // end if
+
+    const size_t inc   = elem->incel;
+    const int    badmu = ((kes_check_val( mu ) != KES_ERR_NOERR) ||
+                          (mu <= 0.0));
+
+    /* rotation matrix of a common orbit, computed once */
+    const state_rot_t rot0 = state_rotation( elem->inc[0], elem->node[0],
+                                             elem->argp[0] );
+
+    for (size_t i0 = 0; i0 < n; i0 += KES_STATE_BLOCK)
+    {
+        const size_t m = ((n - i0 > KES_STATE_BLOCK) ? KES_STATE_BLOCK :
+                          n - i0);
+        const size_t j0 = i0 * inc;
+
+        /* separate output arrays of this block */
+        double* restrict x  = state->x  + i0;
+        double* restrict y  = state->y  + i0;
+        double* restrict z  = state->z  + i0;
+        double* restrict vx = state->vx + i0;
+        double* restrict vy = state->vy + i0;
+        double* restrict vz = state->vz + i0;
+
+        /* solve Kepler's Equation for the whole block */
+        kesolver_batch( m, elem->ecc + j0, inc, ma + i0, ea, init, iter,
+                        data, err, NULL );
+
+        /* check input not covered by the solver, square roots */
+        int simple = 1; /* all elements valid and elliptic? */
+        for (size_t i = 0; i < m; i++)
+        {
+            kes_err_e    tmp;
+            const size_t j = j0 + i * inc;
+            const double a = elem->a[j];
+            const double e = elem->ecc[j];
+            const double p = a * (1.0 - e * e);
+
+            if ( (err[i] == KES_ERR_NOERR) &&
+                 (badmu || (p <= 0.0) ||
+                  (kes_check_val( p ) != KES_ERR_NOERR) ||
+                  (kes_check_val( elem->inc[j] ) != KES_ERR_NOERR) ||
+                  (kes_check_val( elem->node[j] ) != KES_ERR_NOERR) ||
+                  (kes_check_val( elem->argp[j] ) != KES_ERR_NOERR)) )
+            {
+                err[i] = KES_ERR_BADVAL;
+            } // end if
+
+            type[i] = kes_check_ecc( e, &tmp );
+            sb[i]   = 0.0;
+            sk[i]   = 0.0;
+            if ( err[i] == KES_ERR_NOERR )
+            {
+                sb[i] = sqrt(fabs(1.0 - e * e));
+                sk[i] = ((type[i] == KES_ECC_PAR) ? sqrt(mu / p) :
+                                                    sqrt(mu * fabs(a)));
+            } // end if
+
+            simple = simple && (err[i] == KES_ERR_NOERR) &&
+                     ((type[i] == KES_ECC_ELL) || (type[i] == KES_ECC_CIRC));
+        } // end for
+
+        if ( simple && (inc == 0) )
+        {
+            /* common elliptic orbit: constant rotation */
+            state_block_common( m, elem->a[0], elem->ecc[0], sb[0], sk[0],
+                                rot0, ea, x, y, z, vx, vy, vz );
+        } // end if
+        else if ( simple )
+        {
+            /* arrays of elliptic orbits */
+            state_block_array( m, elem->a + j0, elem->ecc + j0,
+                               elem->inc + j0, elem->node + j0,
+                               elem->argp + j0, sb, sk, ea,
+                               x, y, z, vx, vy, vz );
+        } // end if
+        else
+        {
+            /* mixed orbits and failures: element by element */
+            for (size_t i = 0; i < m; i++)
+            {
+                const size_t j = j0 + i * inc;
+                const double a = elem->a[j];
+                const double e = elem->ecc[j];
+                double       pv[4] = { 0.0, 0.0, 0.0, 0.0 };
+
+                if ( err[i] == KES_ERR_NOERR )
+                {
+                    switch ( type[i] )
+                    {
+                        case KES_ECC_HYP:
+                            state_peri_hyp( a, e, sb[i], sk[i], ea[i], pv );
+                            break;
+                        case KES_ECC_PAR:
+                            state_peri_par( a, e, sk[i], ea[i], pv );
+                            break;
+                        default:
+                            state_peri_ell( a, e, sb[i], sk[i], ea[i], pv );
+                            break;
+                    } // end switch
+                } // end if
+
+                const state_rot_t rot = ((inc == 0) ? rot0 :
+                    state_rotation( elem->inc[j], elem->node[j],
+                                    elem->argp[j] ));
+
+                x[i]  = pv[0] * rot.px + pv[1] * rot.qx;
+                y[i]  = pv[0] * rot.py + pv[1] * rot.qy;
+                z[i]  = pv[0] * rot.pz + pv[1] * rot.qz;
+                vx[i] = pv[2] * rot.px + pv[3] * rot.qx;
+                vy[i] = pv[2] * rot.py + pv[3] * rot.qy;
+                vz[i] = pv[2] * rot.pz + pv[3] * rot.qz;
+            } // end for
+        } // end else
+
+        /* per-element error codes, first failure */
+        for (size_t i = 0; i < m; i++)
+        {
+            if ( status != NULL )
+            {
+                status[i0 + i] = err[i];
+            } // end if
+
+            if ( (ret == KES_ERR_NOERR) && (err[i] != KES_ERR_NOERR) )
+            {
+                ret = err[i];
+            } // end if
+        } // end for
+    } // end for
+
+#if KES_STATE_DEBUG
+    printf( "DEBUG: kes_elements_to_state() n = %lu, ret = %d\n",
+            (unsigned long)n, ret );
+#endif
+
+    return( ret );
+} // end kes_elements_to_state
+
@@ -0,0 +1,124 @@
+/***************************************************************************//**
+ * @file    state.h
+ * @brief   conversion of orbital elements to state vectors
+ * @author  Bazso Akos
+ * @version 2026.10
+ *
+ * @copyright
+ * Copyright (C) 2019 Bazso Akos
+ *
+ * This file is part of libkes.
+ *
+ * libkes is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * libkes is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with libkes.  If not, see <https://www.gnu.org/licenses/>.
+ *
+ ******************************************************************************/
+#pragma once
+#ifndef KES_STATE__H
+#define KES_STATE__H
+
+/* include standard headers */
+#include <stddef.h>
+
+/* include module headers */
+#include "error.h"
+#include "input.h"
+#include "solver.h"
+#include "starter.h"
+#include "utils.h"
+
+/******************************************************************************/
+
+/*** declare data structures ***/
+
+/*!
+ * @brief orbital elements in structure-of-arrays layout
+ * @details arrays are read with stride \a incel, i.e. 0 for a single orbit
+ * common to all elements (e.g. a time series of mean anomalies), 1 for
+ * arrays of orbits (e.g. a constellation of satellites)
+ */
+typedef struct
+{
+    const double* a;    ///< semi-major axis (a > 0 elliptic, a < 0 hyperbolic)
+    const double* ecc;  ///< eccentricity
+    const double* inc;  ///< inclination (in radians)
+    const double* node; ///< longitude of the ascending node (in radians)
+    const double* argp; ///< argument of pericenter (in radians)
+    size_t        incel; ///< stride of the arrays above (0 or 1)
+} kes_elements_t;
+
+
+/*!
+ * @brief Cartesian state vectors in structure-of-arrays layout
+ * @details all arrays hold at least n elements
+ */
+typedef struct
+{
+    double* x;  ///< x-components of position
+    double* y;  ///< y-components of position
+    double* z;  ///< z-components of position
+    double* vx; ///< x-components of velocity
+    double* vy; ///< y-components of velocity
+    double* vz; ///< z-components of velocity
+} kes_state_t;
+
+/******************************************************************************/
+
+/*** function declarations ***/
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/*!
+ * @brief convert orbital elements and mean anomalies to state vectors
+ * @details solves Kepler's Equation with kesolver_batch() for blocks of
+ * elements, then computes position and velocity in the same pass from
+ * sin(E) and cos(E) (sinh(H), cosh(H) for hyperbolic, true anomaly for
+ * parabolic orbits) without the true anomaly; the rotation matrix of a
+ * common orbit (incel = 0) is computed only once per call;
+ * units of length and time follow from \a mu, parabolic orbits need the
+ * semi-latus rectum p = a * (1 - ecc^2) > 0 to be finite
+ * @param[in] n number of elements
+ * @param[in] mu gravitational parameter G * (m1 + m2) (mu > 0)
+ * @param[in] elem pointer to orbital elements of type #kes_elements_t
+ * @param[in] ma array of mean anomalies (in radians)
+ * @param[out] state pointer to arrays of state vectors of type #kes_state_t
+ * @param[in] init choose a starter method from enum #kes_stm_e
+ * @param[in] iter choose a solver method from enum #kes_sol_e
+ * @param[in] data pointer to data structure of type #kes_input_t
+ * (or NULL for default settings)
+ * @param[out] status optional array of per-element error codes (or NULL);
+ * elements with invalid input return KES_ERR_BADVAL and zero state vectors
+ * @return error code from enum #kes_err_e;
+ * KES_ERR_NOERR if all elements were converted, else code of first failure
+ */
+kes_err_e kes_elements_to_state(
+    const size_t          n,
+    const double          mu,
+    const kes_elements_t* elem,
+    const double*         ma,
+    kes_state_t*          state,
+    const kes_stm_e       init,
+    const kes_sol_e       iter,
+    const kes_input_t*    data,
+    kes_err_e*            status
+);
+
+#ifdef __cplusplus
+}
+#endif
+
+/******************************************************************************/
+
+#endif  /* KES_STATE__H */
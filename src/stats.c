@@ -0,0 +1,410 @@
+/***************************************************************************//**
+ * @file    stats.c
+ * @brief   statistics of iteration processes
+ * @author  Bazso Akos
+ * @version 2026.10
+ *
+ * @copyright
+ * Copyright (C) 2019 Bazso Akos
+ *
+ * This file is part of libkes.
+ *
+ * libkes is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * libkes is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with libkes.  If not, see <https://www.gnu.org/licenses/>.
+ *
+ ******************************************************************************/
+/* POSIX threads */
+#define _POSIX_C_SOURCE 200809L
+
+/* include standard headers */
+#include <math.h>
+#include <pthread.h>
+#include <stdio.h>
+#include <stdlib.h>
+
+/* include module headers */
+#include "stats.h"
+#include "alloc.h"
+
+/******************************************************************************/
+
+/* use verbose debug output? 0 = no (default), 1 = yes */
+#define KES_STATS_DEBUG 0
+
+/******************************************************************************/
+
+/* table of statistics owned by one thread */
+typedef struct kes_stats_tab_s
+{
+    kes_stats_t cell[KES_STM_TOTAL][KES_SOL_TOTAL][KES_BAND_TOTAL];
+    struct kes_stats_tab_s* next; ///< next table in list of all tables
+    kes_alloc_t alloc; ///< allocator of the table
+} kes_stats_tab_t;
+
+/* statistics collector enabled (1) or not (0) */
+int kes_stats_level = 0;
+
+/* list of tables of running threads, protected by stats_lock */
+static kes_stats_tab_t* stats_list = NULL;
+
+/* merged table of terminated threads, protected by stats_lock */
+static kes_stats_tab_t  stats_retired;
+
+static pthread_mutex_t  stats_lock = PTHREAD_MUTEX_INITIALIZER;
+static pthread_once_t   stats_once = PTHREAD_ONCE_INIT;
+static pthread_key_t    stats_key;
+
+/* table of the calling thread (or NULL) */
+static __thread kes_stats_tab_t* stats_tab = NULL;
+
+/******************************************************************************/
+
+/*******************************************************************************
+ * FUNCTION    : kes_stats_add
+ * DESCRIPTION : add a value to a counter of the owning thread
+ * INPUT       : - pointer "cnt" to counter
+ *               - value "v" to add
+ * OUTPUT      : none
+ ******************************************************************************/
+static inline void kes_stats_add(
+    uint64_t*      cnt,
+    const uint64_t v
+    )
+{
+    /* NOTE single writer, atomic store only keeps concurrent readers safe */
+    __atomic_store_n( cnt, __atomic_load_n( cnt, __ATOMIC_RELAXED ) + v,
+                      __ATOMIC_RELAXED );
+} // end kes_stats_add
+
+/******************************************************************************/
+
+/*******************************************************************************
+ * FUNCTION    : kes_stats_merge
+ * DESCRIPTION : add all counters of one cell to another cell
+ * INPUT       : - pointer "dst" to target cell
+ *               - pointer "src" to source cell
+ * OUTPUT      : none
+ ******************************************************************************/
+static void kes_stats_merge(
+    kes_stats_t*       dst,
+    const kes_stats_t* src
+    )
+{
+    /* NOTE all members are counters of type uint64_t */
+    uint64_t*       d = (uint64_t*)dst;
+    const uint64_t* s = (const uint64_t*)src;
+
+    for (size_t k = 0; k < sizeof(kes_stats_t) / sizeof(uint64_t); k++)
+    {
+        d[k] += __atomic_load_n( &s[k], __ATOMIC_RELAXED );
+    } // end for
+} // end kes_stats_merge
+
+/******************************************************************************/
+
+/*******************************************************************************
+ * FUNCTION    : kes_stats_retire
+ * DESCRIPTION : destructor of thread-specific table, keeps counts of
+ *               terminating threads in the merged table
+ * INPUT       : pointer "arg" to table of type kes_stats_tab_t
+ * OUTPUT      : none
+ ******************************************************************************/
+static void kes_stats_retire(void* arg)
+{
+    kes_stats_tab_t* tab = (kes_stats_tab_t*)arg;
+
+    pthread_mutex_lock( &stats_lock );
+
+    /* unlink table */
+    kes_stats_tab_t** p = &stats_list;
+    while ( (*p != NULL) && (*p != tab) )
+    {
+        p = &(*p)->next;
+    } // end while
+    if ( *p != NULL )
+    {
+        *p = tab->next;
+    } // end if
+
+    /* merge counts */
+    for (int i = 0; i < KES_STM_TOTAL; i++)
+    {
+        for (int j = 0; j < KES_SOL_TOTAL; j++)
+        {
+            for (int k = 0; k < KES_BAND_TOTAL; k++)
+            {
+                kes_stats_merge( &stats_retired.cell[i][j][k],
+                                 &tab->cell[i][j][k] );
+            } // end for(k)
+        } // end for(j)
+    } // end for(i)
+
+    pthread_mutex_unlock( &stats_lock );
+
+    const kes_alloc_t alloc = tab->alloc;
+    kes_mem_free( &alloc, tab, sizeof(kes_stats_tab_t) );
+} // end kes_stats_retire
+
+/******************************************************************************/
+
+/*******************************************************************************
+ * FUNCTION    : kes_stats_key
+ * DESCRIPTION : create key for thread-specific tables (called once)
+ * INPUT       : none
+ * OUTPUT      : none
+ ******************************************************************************/
+static void kes_stats_key(void)
+{
+    pthread_key_create( &stats_key, kes_stats_retire );
+} // end kes_stats_key
+
+/******************************************************************************/
+
+/*******************************************************************************
+ * FUNCTION    : kes_stats_table
+ * DESCRIPTION : get table of the calling thread, allocate on first use
+ * INPUT       : none
+ * OUTPUT      : pointer to table (or NULL if out of memory)
+ ******************************************************************************/
+static kes_stats_tab_t* kes_stats_table(void)
+{
+    if ( stats_tab == NULL )
+    {
+        pthread_once( &stats_once, kes_stats_key );
+
+        kes_alloc_t alloc;
+        kes_stats_tab_t* tab = kes_mem_calloc( &alloc, 1,
+                                               sizeof(kes_stats_tab_t) );
+        if ( tab == NULL )
+        {
+            return( NULL );
+        } // end if
+        tab->alloc = alloc;
+
+        pthread_mutex_lock( &stats_lock );
+        tab->next  = stats_list;
+        stats_list = tab;
+        pthread_mutex_unlock( &stats_lock );
+
+        /* NOTE table is merged and released when the thread terminates */
+        pthread_setspecific( stats_key, tab );
+        stats_tab = tab;
+    } // end if
+
+    return( stats_tab );
+} // end kes_stats_table
+
+/******************************************************************************/
+
+/*******************************************************************************
+ * FUNCTION    : kes_set_stats
+ * DESCRIPTION : enable or disable the statistics collector
+ * INPUT       : "enable" (1 = enable, 0 = disable)
+ * OUTPUT      : error code
+ ******************************************************************************/
+kes_err_e kes_set_stats(const int enable)
+{
+    if ( (enable != 0) && (enable != 1) )
+    {
+        return( KES_ERR_BADVAL );
+    } // end if
+
+    __atomic_store_n( &kes_stats_level, enable, __ATOMIC_RELAXED );
+
+#if KES_STATS_DEBUG
+    printf("%s: enable = %d\n", __func__, enable);
+#endif
+
+    return( KES_ERR_NOERR );
+} // end kes_set_stats
+
+/******************************************************************************/
+
+/*******************************************************************************
+ * FUNCTION    : kes_stats_reset
+ * DESCRIPTION : clear all collected statistics
+ * INPUT       : none
+ * OUTPUT      : none
+ ******************************************************************************/
+void kes_stats_reset(void)
+{
+    pthread_mutex_lock( &stats_lock );
+
+    for (kes_stats_tab_t* tab = stats_list; tab != NULL; tab = tab->next)
+    {
+        uint64_t* d = (uint64_t*)tab->cell;
+
+        for (size_t k = 0; k < sizeof(tab->cell) / sizeof(uint64_t); k++)
+        {
+            __atomic_store_n( &d[k], 0, __ATOMIC_RELAXED );
+        } // end for
+    } // end for
+
+    for (int i = 0; i < KES_STM_TOTAL; i++)
+    {
+        for (int j = 0; j < KES_SOL_TOTAL; j++)
+        {
+            for (int k = 0; k < KES_BAND_TOTAL; k++)
+            {
+                stats_retired.cell[i][j][k] = (kes_stats_t){ .calls = 0 };
+            } // end for(k)
+        } // end for(j)
+    } // end for(i)
+
+    pthread_mutex_unlock( &stats_lock );
+} // end kes_stats_reset
+
+/******************************************************************************/
+
+/*******************************************************************************
+ * FUNCTION    : kes_get_stats
+ * DESCRIPTION : get statistics merged over all threads
+ * INPUT       : - starter method "init" from enum kes_stm_e
+ *               - solver method "iter" from enum kes_sol_e
+ *               - eccentricity "band" from enum kes_band_e
+ *               - pointer "stats" to structure of type kes_stats_t
+ * OUTPUT      : error code
+ ******************************************************************************/
+kes_err_e kes_get_stats(
+    const kes_stm_e  init,
+    const kes_sol_e  iter,
+    const kes_band_e band,
+    kes_stats_t*     stats
+    )
+{
+    if ( ((int)init < 0) || (init >= KES_STM_TOTAL) )
+    {
+        return( KES_ERR_BADSTM );
+    } // end if
+    if ( ((int)iter < 0) || (iter >= KES_SOL_TOTAL) )
+    {
+        return( KES_ERR_BADSOL );
+    } // end if
+    if ( ((int)band < 0) || (band >= KES_BAND_TOTAL) )
+    {
+        return( KES_ERR_BADVAL );
+    } // end if
+
+    *stats = (kes_stats_t){ .calls = 0 };
+
+    pthread_mutex_lock( &stats_lock );
+
+    kes_stats_merge( stats, &stats_retired.cell[init][iter][band] );
+    for (kes_stats_tab_t* tab = stats_list; tab != NULL; tab = tab->next)
+    {
+        kes_stats_merge( stats, &tab->cell[init][iter][band] );
+    } // end for
+
+    pthread_mutex_unlock( &stats_lock );
+
+    return( KES_ERR_NOERR );
+} // end kes_get_stats
+
+/******************************************************************************/
+
+/*******************************************************************************
+ * FUNCTION    : kes_stats_band
+ * DESCRIPTION : eccentricity band of an orbit
+ * INPUT       : eccentricity "ecc"
+ * OUTPUT      : eccentricity band from enum kes_band_e
+ ******************************************************************************/
+kes_band_e kes_stats_band(const double ecc)
+{
+    kes_err_e status;
+
+    switch ( kes_check_ecc( ecc, &status ) )
+    {
+        case KES_ECC_PAR: return( KES_BAND_PAR );
+        case KES_ECC_HYP: return( KES_BAND_HYP );
+        default:          break;
+    } // end switch
+
+    if ( ecc < 0.5 )
+    {
+        return( KES_BAND_LOW );
+    } // end if
+    else if ( ecc < 0.9 )
+    {
+        return( KES_BAND_MID );
+    } // end if
+    else if ( ecc <= KES_NEARPAR_ECC )
+    {
+        return( KES_BAND_HIGH );
+    } // end if
+
+    return( KES_BAND_NEARPAR );
+} // end kes_stats_band
+
+/******************************************************************************/
+
+/*******************************************************************************
+ * FUNCTION    : kes_stats_record
+ * DESCRIPTION : record one solve in the table of the calling thread
+ * INPUT       : - starter method "init" and solver method "iter"
+ *               - eccentricity "ecc"
+ *               - number of "iterations" and maximum "maxiter"
+ *               - numbers of evaluations "nsin", "ncos" and "nfkt"
+ *               - residual error "deltaf" (0 = not evaluated)
+ * OUTPUT      : none
+ ******************************************************************************/
+void kes_stats_record(
+    const kes_stm_e init,
+    const kes_sol_e iter,
+    const double    ecc,
+    const int       iterations,
+    const int       maxiter,
+    const int       nsin,
+    const int       ncos,
+    const int       nfkt,
+    const double    deltaf
+    )
+{
+    /* NOTE invalid methods are rejected by the solvers before */
+    if ( ((int)init < 0) || (init >= KES_STM_TOTAL) ||
+         ((int)iter < 0) || (iter >= KES_SOL_TOTAL) )
+    {
+        return;
+    } // end if
+
+    kes_stats_tab_t* tab = kes_stats_table();
+    if ( tab == NULL )
+    {
+        return;
+    } // end if
+
+    kes_stats_t* c = &tab->cell[init][iter][kes_stats_band( ecc )];
+
+    /* histogram bins */
+    const int it = ((iterations > 0) ? iterations : 0);
+    const int bi = ((it < KES_STATS_ITER_BINS - 1) ?
+                    it : KES_STATS_ITER_BINS - 1);
+
+    int br = 0;
+    if ( deltaf > 0.0 )
+    {
+        const double d = floor( -log10( deltaf ) );
+        br = ((d < 0.0) ? 1 : ((d > KES_STATS_RES_BINS - 2) ?
+              KES_STATS_RES_BINS - 1 : 1 + (int)d));
+    } // end if
+
+    kes_stats_add( &c->calls,      1 );
+    kes_stats_add( &c->iterations, (uint64_t)it );
+    kes_stats_add( &c->maxiter,    ((iterations >= maxiter) ? 1 : 0) );
+    kes_stats_add( &c->nbrSinEval, (uint64_t)nsin );
+    kes_stats_add( &c->nbrCosEval, (uint64_t)ncos );
+    kes_stats_add( &c->nbrFktEval, (uint64_t)nfkt );
+    kes_stats_add( &c->histIter[bi], 1 );
+    kes_stats_add( &c->histRes[br],  1 );
+} // end kes_stats_record
+
+/******************************************************************************/
@@ -0,0 +1,226 @@
+/***************************************************************************//**
+ * @file    stats.h
+ * @brief   statistics of iteration processes
+ * @author  Bazso Akos
+ * @version 2026.10
+ *
+ * @copyright
+ * Copyright (C) 2019 Bazso Akos
+ *
+ * This file is part of libkes.
+ *
+ * libkes is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * libkes is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with libkes.  If not, see <https://www.gnu.org/licenses/>.
+ *
+ ******************************************************************************/
+#pragma once
+#ifndef KES_STATS__H
+#define KES_STATS__H
+
+/* include standard headers */
+#include <stdint.h>
+
+/* include module headers */
+#include "error.h"
+#include "input.h"
+#include "solver.h"
+#include "starter.h"
+
+/******************************************************************************/
+
+/*** declare macro constants ***/
+
+/* number of bins of the iteration histogram, last bin counts all solves
+ * with (KES_STATS_ITER_BINS - 1) or more iterations
+ */
+#define KES_STATS_ITER_BINS 16
+
+/* number of bins of the residual histogram, see kes_stats_t */
+#define KES_STATS_RES_BINS  20
+
+/******************************************************************************/
+
+/*** declare data structures ***/
+
+/*!
+ * @brief enumeration of eccentricity bands for statistics
+ */
+typedef enum
+{
+    KES_BAND_LOW = 0, ///< 0 <= ecc < 0.5 (including circular orbits)
+    KES_BAND_MID,     ///< 0.5 <= ecc < 0.9
+    KES_BAND_HIGH,    ///< 0.9 <= ecc <= KES_NEARPAR_ECC
+    KES_BAND_NEARPAR, ///< KES_NEARPAR_ECC < ecc < 1 (elliptic)
+    KES_BAND_PAR,     ///< parabolic orbits
+    KES_BAND_HYP,     ///< hyperbolic orbits
+
+    KES_BAND_TOTAL    ///< total number of eccentricity bands
+} kes_band_e;
+
+
+/*!
+ * @brief structure containing aggregated statistics of solver calls
+ * @details bin k > 0 of the residual histogram counts solves with
+ * 10^(-k) < deltaf <= 10^(1-k), bin 1 all larger residuals and the last
+ * bin all smaller residuals;
+ * bin 0 counts residuals which were not evaluated (fixed iterations,
+ * closed-form solutions) or are exactly zero
+ */
+typedef struct
+{
+    uint64_t calls;      ///< number of successful solver calls
+    uint64_t iterations; ///< total number of iterations
+    uint64_t maxiter;    ///< number of solves stopped by "maxiter"
+    uint64_t nbrSinEval; ///< total number of evaluations of sin()
+    uint64_t nbrCosEval; ///< total number of evaluations of cos()
+    uint64_t nbrFktEval; ///< total number of evaluations of kes_keq_xxx()
+    uint64_t histIter[KES_STATS_ITER_BINS]; ///< histogram of iterations
+    uint64_t histRes[KES_STATS_RES_BINS];   ///< histogram of residuals
+} kes_stats_t;
+
+/******************************************************************************/
+
+/*** declare global variables ***/
+
+/* statistics collector enabled (1) or not (0)
+ * NOTE internal use only, see kes_set_stats()
+ */
+extern int kes_stats_level;
+
+/******************************************************************************/
+
+/*** function declarations ***/
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/*!
+ * @brief enable or disable the statistics collector
+ * @details if enabled, every successful solve of kesolver(),
+ * kesolver_batch() and the plan functions is recorded by the calling
+ * thread in a private table (allocated on first use, about 400 kB);
+ * recording costs about one evaluation of the Kepler Equation per
+ * element of vectorized batch solves, a disabled collector (default)
+ * costs a single load per call; collected data is kept when disabled
+ * @param[in] enable 1 = enable, 0 = disable
+ * @return error code from enum #kes_err_e;
+ * KES_ERR_NOERR indicates success, KES_ERR_BADVAL indicates error
+ */
+kes_err_e kes_set_stats(const int enable);
+
+
+/*!
+ * @brief clear all collected statistics
+ * NOTE counts of solves running concurrently may survive the reset
+ */
+void kes_stats_reset(void);
+
+
+/*!
+ * @brief get statistics merged over all threads
+ * @details includes the data of threads which have terminated
+ * @param[in] init starter method from enum #kes_stm_e
+ * @param[in] iter solver method from enum #kes_sol_e
+ * @param[in] band eccentricity band from enum #kes_band_e
+ * @param[out] stats pointer to structure of type #kes_stats_t
+ * @return error code from enum #kes_err_e;
+ * KES_ERR_NOERR indicates success, KES_ERR_BADSTM, KES_ERR_BADSOL or
+ * KES_ERR_BADVAL (band) indicates error
+ */
+kes_err_e kes_get_stats(
+    const kes_stm_e  init,
+    const kes_sol_e  iter,
+    const kes_band_e band,
+    kes_stats_t*     stats
+);
+
+
+/*!
+ * @brief eccentricity band of an orbit
+ * @param[in] ecc eccentricity (ecc >= 0)
+ * @return eccentricity band from enum #kes_band_e
+ */
+kes_band_e kes_stats_band(const double ecc);
+
+
+/*!
+ * @brief record one solve in the table of the calling thread
+ * NOTE internal use only, see kes_stats_input()
+ * @param[in] init starter method
+ * @param[in] iter solver method
+ * @param[in] ecc eccentricity
+ * @param[in] iterations number of iterations
+ * @param[in] maxiter maximum number of iterations
+ * @param[in] nsin number of evaluations of sin()
+ * @param[in] ncos number of evaluations of cos()
+ * @param[in] nfkt number of evaluations of Kepler Equation
+ * @param[in] deltaf residual error of Kepler Equation (0 = not evaluated)
+ */
+void kes_stats_record(
+    const kes_stm_e init,
+    const kes_sol_e iter,
+    const double    ecc,
+    const int       iterations,
+    const int       maxiter,
+    const int       nsin,
+    const int       ncos,
+    const int       nfkt,
+    const double    deltaf
+);
+
+#ifdef __cplusplus
+}
+#endif
+
+/******************************************************************************/
+
+/*** inline functions ***/
+
+/*!
+ * @brief check if the statistics collector is enabled
+ * @return 1 if enabled, 0 otherwise
+ */
+static inline int kes_stats_begin(void)
+{
+    return( __atomic_load_n( &kes_stats_level, __ATOMIC_RELAXED ) );
+} // end kes_stats_begin
+
+
+/*!
+ * @brief record one solve from the outputs of a solver function
+ * @param[in] on result of kes_stats_begin()
+ * @param[in] init starter method
+ * @param[in] iter solver method
+ * @param[in] ecc eccentricity
+ * @param[in] data pointer to input parameters and results of the solve
+ */
+static inline void kes_stats_input(
+    const int          on,
+    const kes_stm_e    init,
+    const kes_sol_e    iter,
+    const double       ecc,
+    const kes_input_t* data
+    )
+{
+    if ( on )
+    {
+        kes_stats_record( init, iter, ecc, data->iterations, data->maxiter,
+                          data->nbrSinEval, data->nbrCosEval,
+                          data->nbrFktEval, data->errDF );
+    } // end if
+} // end kes_stats_input
+
+/******************************************************************************/
+
+#endif  /* KES_STATS__H */
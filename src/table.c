@@ -0,0 +1,534 @@
+/***************************************************************************//**
+ * @file    table.c
+ * @brief   piecewise Chebyshev table of the elliptic Kepler Equation
+ * @author  Bazso Akos
+ * @version 2026.10
+ *
+ * @copyright
+ * Copyright (C) 2019 Bazso Akos
+ *
+ * This file is part of libkes.
+ *
+ * libkes is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * libkes is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with libkes.  If not, see <https://www.gnu.org/licenses/>.
+ *
+ ******************************************************************************/
+/* include standard headers */
+#include <limits.h>
+#include <math.h>
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+
+/* include module headers */
+#include "table.h"
+#include "const.h"
+#include "vecmath.h"
+
+/******************************************************************************/
+
+/* use verbose debug output? 0 = no (default), 1 = yes */
+#define KES_TABLE_DEBUG 0
+
+/* number of elements evaluated per block of kes_table_eval_batch(), size of
+ * the work arrays on the stack
+ */
+#define KES_TABLE_BLOCK 256
+
+/******************************************************************************/
+
+/*******************************************************************************
+ *  FUNCTION    : kes_table_ref
+ *  DESCRIPTION : accurate solution of the elliptic Kepler Equation for fitting
+ *  INPUT       : - eccentricity "ecc" (0 < ecc < 1)
+ *                - reduced mean anomaly "ma" (0 <= ma <= pi)
+ *  OUTPUT      : ratio E / M (1 / (1 - ecc) for M = 0)
+ *  NOTE solution of kesolver() refined by Halley steps, with
+ *       E - e*sin(E) - M = (1-e)*E + e*(E - sin(E)) - M free of cancellation
+ *       for small E
+ ******************************************************************************/
+static double kes_table_ref(
+    const double ecc,
+    const double ma
+    )
+{
+    if ( ma <= 0.0 )
+    {
+        return( 1.0 / (1.0 - ecc) );
+    } // end if
+
+    kes_input_t data = kes_new_input();
+    kes_err_e   status;
+    double      x    = kesolver( ecc, ma, KES_STM_ES04, KES_SOL_DANBUR5,
+                                 &data, &status );
+
+    for (int i = 0; i < 2; i++)
+    {
+        double sm, cm;
+        kes_vec_sincosm( &sm, &cm, x );
+
+        const double f0 = (1.0 - ecc) * x + ecc * sm - ma;
+        const double f1 = (1.0 - ecc) + ecc * cm;
+        const double f2 = ecc * (x - sm);
+
+        x -= f0 / (f1 - 0.5 * f0 * f2 / f1);
+    } // end for
+
+    return( x / ma );
+} // end kes_table_ref
+
+/******************************************************************************/
+
+/*******************************************************************************
+ *  FUNCTION    : kes_table_fit
+ *  DESCRIPTION : Chebyshev interpolation of E(M) / M on one segment
+ *  INPUT       : - eccentricity "ecc" (0 < ecc < 1)
+ *                - segment "m0" <= M <= "m1"
+ *                - pointer "coef" to return KES_TABLE_NCOEF coefficients
+ *  OUTPUT      : truncation error estimate, relative to E(M)
+ *  REFERENCE   : interpolation at the Chebyshev nodes of the first kind
+ ******************************************************************************/
+static double kes_table_fit(
+    const double ecc,
+    const double m0,
+    const double m1,
+    double*      coef
+    )
+{
+    const int n   = KES_TABLE_NCOEF;
+    double    val[KES_TABLE_NCOEF];
+    double    avg = 0.0;
+
+    for (int j = 0; j < n; j++)
+    {
+        const double t = cos( M_PI * (j + 0.5) / n );
+        val[j] = kes_table_ref( ecc, 0.5 * (m0 + m1) + 0.5 * (m1 - m0) * t );
+        avg   += val[j] / n;
+    } // end for
+
+    /* NOTE subtract mean value, rounding errors of the sums would otherwise
+     * dominate the small coefficients
+     */
+    for (int j = 0; j < n; j++)
+    {
+        val[j] -= avg;
+    } // end for
+
+    for (int k = 0; k < n; k++)
+    {
+        double sum = 0.0;
+        for (int j = 0; j < n; j++)
+        {
+            sum += val[j] * cos( M_PI * k * (j + 0.5) / n );
+        } // end for(j)
+        coef[k] = 2.0 * sum / n;
+    } // end for(k)
+    coef[0] = 0.5 * coef[0] + avg;
+
+    /* NOTE E / M > 0 varies slowly on each segment, c[0] ~ mean value */
+    return( (fabs(coef[n - 1]) + fabs(coef[n - 2])) / fabs(coef[0]) );
+} // end kes_table_fit
+
+/******************************************************************************/
+
+/*******************************************************************************
+ *  FUNCTION    : kes_table_grow
+ *  DESCRIPTION : reallocate table for a given number of segments
+ *  INPUT       : - pointer "table" to table (or NULL)
+ *                - number of segments "nseg"
+ *  OUTPUT      : pointer to reallocated table, or NULL (table is freed)
+ ******************************************************************************/
+static kes_table_t* kes_table_grow(
+    kes_table_t* table,
+    const int    nseg
+    )
+{
+    const size_t size = sizeof(kes_table_t) +
+                        (size_t)nseg * KES_TABLE_NCOEF * sizeof(double);
+    const size_t old  = ((table == NULL) ? 0 : sizeof(kes_table_t) +
+                         (size_t)table->nalloc * KES_TABLE_NCOEF *
+                         sizeof(double));
+    kes_alloc_t  alloc;
+    kes_table_t* res;
+    if ( table == NULL )
+    {
+        res = kes_mem_alloc( &alloc, size );
+    }
+    else
+    {
+        alloc = table->alloc;
+        res   = kes_mem_resize( &alloc, table, old, size );
+    } // end if
+
+    if ( res == NULL )
+    {
+        kes_table_free( table );
+        return( NULL );
+    } // end if
+    res->nalloc = nseg;
+    res->alloc  = alloc;
+
+    return( res );
+} // end kes_table_grow
+
+/******************************************************************************/
+
+/*******************************************************************************
+ *  FUNCTION    : kes_table_build
+ *  DESCRIPTION : fit the segments of a piecewise Chebyshev table
+ *  INPUT       : - eccentricity "ecc" (0 < ecc < 1)
+ *                - tolerance "eps" (KES_TABLE_TOL <= eps < 1)
+ *                - pointer "ptable" to table with initialized header
+ *                - capacity "cap" in segments, < 0 to grow the table
+ *  OUTPUT      : error code from enum kes_err_e, *ptable = NULL if the
+ *                table cannot be grown
+ *  NOTE octave k is refined by doubling its number of segments until all
+ *       fit; octaves are added until a single head segment fits the rest;
+ *       with a fixed capacity, segments beyond it are fitted to scratch
+ *       memory, i.e. table->nseg still counts the segments of the table
+ ******************************************************************************/
+static kes_err_e kes_table_build(
+    const double  ecc,
+    const double  eps,
+    kes_table_t** ptable,
+    const int     cap
+    )
+{
+    kes_table_t* table = *ptable;
+    double       tmp[KES_TABLE_NCOEF];
+
+    for (int k = 0; k < KES_TABLE_MAXOCT; k++)
+    {
+        const double x0 = kes_table_pow2( -(k + 1) );
+
+        /* refine octave 2^-(k+1) <= M/pi < 2^-k */
+        int sh;
+        for (sh = 0; sh <= KES_TABLE_MAXSUB; sh++)
+        {
+            const int nsub = 1 << sh;
+            if ( cap < 0 )
+            {
+                table = *ptable = kes_table_grow( table,
+                                                  table->nseg + nsub + 1 );
+                if ( table == NULL )
+                {
+                    return( KES_ERR_NOMEM );
+                } // end if
+            } // end if
+
+            int sub;
+            for (sub = 0; sub < nsub; sub++)
+            {
+                const int    seg = table->nseg + sub;
+                const double m0  = M_PI * x0 * (1.0 + (double)sub / nsub);
+                const double m1  = M_PI * x0 * (1.0 + (double)(sub + 1) / nsub);
+                double*      c   = (((cap < 0) || (seg < cap)) ?
+                                    table->coef + (size_t)seg * KES_TABLE_NCOEF :
+                                    tmp);
+                if ( kes_table_fit( ecc, m0, m1, c ) > eps )
+                {
+                    break;
+                } // end if
+            } // end for(sub)
+
+            if ( sub == nsub )
+            {
+                break;
+            } // end if
+        } // end for(sh)
+
+        if ( sh > KES_TABLE_MAXSUB )
+        {
+#if KES_TABLE_DEBUG
+    fprintf( stderr, "%s: no fit in octave %d for ecc = %g\n",
+             __func__, k, ecc );
+#endif
+            break;
+        } // end if
+
+        table->shift[k] = sh;
+        table->first[k] = table->nseg;
+        table->nseg    += (1 << sh);
+        table->noct     = k + 1;
+
+        /* try head segment for the rest 0 <= M/pi < 2^-(k+1) */
+        const int seg = table->nseg;
+        double*   c   = (((cap < 0) || (seg < cap)) ?
+                         table->coef + (size_t)seg * KES_TABLE_NCOEF : tmp);
+        if ( kes_table_fit( ecc, 0.0, M_PI * x0, c ) <= eps )
+        {
+            table->first[table->noct] = table->nseg;
+            table->nseg              += 1;
+#if KES_TABLE_DEBUG
+    fprintf( stderr, "%s: ecc = %g, %d octaves, %d segments, %lu bytes\n",
+             __func__, ecc, table->noct, table->nseg,
+             (unsigned long)kes_table_bytes( table ) );
+#endif
+            return( KES_ERR_NOERR );
+        } // end if
+    } // end for(k)
+
+    /* exception: tolerance cannot be reached */
+    return( KES_ERR_BADTOL );
+} // end kes_table_build
+
+/******************************************************************************/
+
+/*******************************************************************************
+ *  FUNCTION    : kes_table_header
+ *  DESCRIPTION : check the parameters and initialize the header of a table
+ *  INPUT       : - eccentricity "ecc" (0 < ecc < 1)
+ *                - tolerance "tol" (0 for default KES_TABLE_TOL)
+ *                - pointer "table" to header (or NULL to check only)
+ *  OUTPUT      : error code from enum kes_err_e
+ ******************************************************************************/
+static kes_err_e kes_table_header(
+    const double ecc,
+    const double tol,
+    kes_table_t* table
+    )
+{
+    /* exceptions: eccentricity or tolerance out of range */
+    if ( !((ecc > 0.0) && (ecc < 1.0)) )
+    {
+        return( KES_ERR_BADECC );
+    } // end if
+
+    const double eps = ((tol == 0.0) ? KES_TABLE_TOL : tol);
+    if ( !((eps >= KES_TABLE_TOL) && (eps < 1.0)) )
+    {
+        return( KES_ERR_BADTOL );
+    } // end if
+
+    if ( table != NULL )
+    {
+        table->ecc  = ecc;
+        table->tol  = eps;
+        table->noct = 0;
+        table->nseg = 0;
+    } // end if
+
+    return( KES_ERR_NOERR );
+} // end kes_table_header
+
+/******************************************************************************/
+
+/*******************************************************************************
+ *  FUNCTION    : kes_table_new
+ *  DESCRIPTION : build a piecewise Chebyshev table of E(M) for fixed ecc
+ *  INPUT       : - eccentricity "ecc" (0 < ecc < 1)
+ *                - tolerance "tol" (0 for default KES_TABLE_TOL)
+ *                - pointer "status" to return error code (see error.h)
+ *  OUTPUT      : pointer to new table, or NULL
+ ******************************************************************************/
+kes_table_t* kes_table_new(
+    const double ecc,
+    const double tol,
+    kes_err_e*   status
+    )
+{
+    *status = kes_table_header( ecc, tol, NULL );
+    if ( *status != KES_ERR_NOERR )
+    {
+        return( NULL );
+    } // end if
+
+    kes_table_t* table = kes_table_grow( NULL, 1 );
+    if ( table == NULL )
+    {
+        *status = KES_ERR_NOMEM;
+        return( NULL );
+    } // end if
+    kes_table_header( ecc, tol, table );
+
+    *status = kes_table_build( ecc, table->tol, &table, -1 );
+    if ( *status != KES_ERR_NOERR )
+    {
+        kes_table_free( table );
+        return( NULL );
+    } // end if
+
+    /* NOTE shrinking cannot fail with the default allocator */
+    table = kes_table_grow( table, table->nseg );
+    if ( table == NULL )
+    {
+        *status = KES_ERR_NOMEM;
+    } // end if
+
+    return( table );
+} // end kes_table_new
+
+/******************************************************************************/
+
+/*******************************************************************************
+ *  FUNCTION    : kes_table_size
+ *  DESCRIPTION : workspace size of a table
+ *  INPUT       : - eccentricity "ecc" (0 < ecc < 1)
+ *                - tolerance "tol" (0 for default KES_TABLE_TOL)
+ *                - pointer "status" to return error code (see error.h)
+ *  OUTPUT      : number of bytes for kes_table_new_ws(), 0 on error
+ ******************************************************************************/
+size_t kes_table_size(
+    const double ecc,
+    const double tol,
+    kes_err_e*   status
+    )
+{
+    /* NOTE header only, all coefficients go to scratch memory */
+    kes_table_t  head  = { .nalloc = -1 };
+    kes_table_t* table = &head;
+
+    *status = kes_table_header( ecc, tol, table );
+    if ( *status == KES_ERR_NOERR )
+    {
+        *status = kes_table_build( ecc, table->tol, &table, 0 );
+    } // end if
+
+    return( (*status == KES_ERR_NOERR) ? kes_table_bytes( table ) : 0 );
+} // end kes_table_size
+
+/******************************************************************************/
+
+/*******************************************************************************
+ *  FUNCTION    : kes_table_new_ws
+ *  DESCRIPTION : build a piecewise Chebyshev table in a caller buffer
+ *  INPUT       : - eccentricity "ecc" (0 < ecc < 1)
+ *                - tolerance "tol" (0 for default KES_TABLE_TOL)
+ *                - buffer "buf" and its number of bytes "size"
+ *                - pointer "status" to return error code (see error.h)
+ *  OUTPUT      : pointer to table at buf, or NULL
+ ******************************************************************************/
+kes_table_t* kes_table_new_ws(
+    const double ecc,
+    const double tol,
+    void*        buf,
+    const size_t size,
+    kes_err_e*   status
+    )
+{
+    kes_table_t* table = (kes_table_t*)buf;
+
+    /* exception: buffer misaligned or smaller than the header */
+    if ( (buf == NULL) || ((uintptr_t)buf % sizeof(double) != 0) ||
+         (size < sizeof(kes_table_t)) )
+    {
+        *status = KES_ERR_NOMEM;
+        return( NULL );
+    } // end if
+
+    *status = kes_table_header( ecc, tol, table );
+    if ( *status != KES_ERR_NOERR )
+    {
+        return( NULL );
+    } // end if
+
+    const size_t nseg = (size - sizeof(kes_table_t)) /
+                        (KES_TABLE_NCOEF * sizeof(double));
+    const int    cap  = ((nseg < (size_t)INT_MAX) ? (int)nseg : INT_MAX);
+
+    *status = kes_table_build( ecc, table->tol, &table, cap );
+    if ( (*status == KES_ERR_NOERR) && (table->nseg > cap) )
+    {
+        *status = KES_ERR_NOMEM;
+    } // end if
+    table->nalloc = -1;
+
+    return( (*status == KES_ERR_NOERR) ? table : NULL );
+} // end kes_table_new_ws
+
+/******************************************************************************/
+
+/*******************************************************************************
+ *  FUNCTION    : kes_table_eval_batch
+ *  DESCRIPTION : evaluate table for an array of reduced mean anomalies
+ *  INPUT       : - pointer "table" to table from kes_table_new()
+ *                - number of elements "n"
+ *                - reduced mean anomalies "redma" (0 <= redma <= pi)
+ *                - array "ea" to return eccentric anomalies (in radians)
+ *  OUTPUT      : none
+ *  NOTE Clenshaw's recurrence runs over all elements of a block per step,
+ *       i.e. the latency of one element is hidden by the others
+ ******************************************************************************/
+void kes_table_eval_batch(
+    const kes_table_t*     table,
+    const size_t           n,
+    const double* restrict redma,
+    double* restrict       ea
+    )
+{
+    const double* c[KES_TABLE_BLOCK];
+    double        t[KES_TABLE_BLOCK];
+    double        b1[KES_TABLE_BLOCK];
+    double        b2[KES_TABLE_BLOCK];
+
+    for (size_t i0 = 0; i0 < n; i0 += KES_TABLE_BLOCK)
+    {
+        const size_t m = (((n - i0) < KES_TABLE_BLOCK) ?
+                          (n - i0) : KES_TABLE_BLOCK);
+
+        for (size_t i = 0; i < m; i++)
+        {
+            const int seg = kes_table_locate( table, redma[i0 + i], &t[i] );
+            c[i]  = table->coef + (size_t)seg * KES_TABLE_NCOEF;
+            b1[i] = b2[i] = 0.0;
+        } // end for(i)
+
+        for (int j = KES_TABLE_NCOEF - 1; j > 0; j--)
+        {
+            for (size_t i = 0; i < m; i++)
+            {
+                const double b = 2.0 * t[i] * b1[i] - b2[i] + c[i][j];
+                b2[i] = b1[i];
+                b1[i] = b;
+            } // end for(i)
+        } // end for(j)
+
+        for (size_t i = 0; i < m; i++)
+        {
+            ea[i0 + i] = redma[i0 + i] * (t[i] * b1[i] - b2[i] + c[i][0]);
+        } // end for(i)
+    } // end for(i0)
+} // end kes_table_eval_batch
+
+/******************************************************************************/
+
+/*******************************************************************************
+ *  FUNCTION    : kes_table_free
+ *  DESCRIPTION : release a table created by kes_table_new()
+ *  INPUT       : pointer "table" to table (may be NULL)
+ *  OUTPUT      : none
+ ******************************************************************************/
+void kes_table_free(kes_table_t* table)
+{
+    if ( (table != NULL) && (table->nalloc >= 0) )
+    {
+        const kes_alloc_t alloc = table->alloc;
+        kes_mem_free( &alloc, table, sizeof(kes_table_t) +
+                      (size_t)table->nalloc * KES_TABLE_NCOEF *
+                      sizeof(double) );
+    } // end if
+} // end kes_table_free
+
+/******************************************************************************/
+
+/*******************************************************************************
+ *  FUNCTION    : kes_table_bytes
+ *  DESCRIPTION : memory footprint of a table
+ *  INPUT       : pointer "table" to table (may be NULL)
+ *  OUTPUT      : number of allocated bytes
+ ******************************************************************************/
+size_t kes_table_bytes(const kes_table_t* table)
+{
+    return( (table == NULL) ? 0 : sizeof(kes_table_t) +
+            (size_t)table->nseg * KES_TABLE_NCOEF * sizeof(double) );
+} // end kes_table_bytes
@@ -0,0 +1,270 @@
+/***************************************************************************//**
+ * @file    table.h
+ * @brief   piecewise Chebyshev table of the elliptic Kepler Equation
+ * @author  Bazso Akos
+ * @version 2026.10
+ *
+ * @copyright
+ * Copyright (C) 2019 Bazso Akos
+ *
+ * This file is part of libkes.
+ *
+ * libkes is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * libkes is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with libkes.  If not, see <https://www.gnu.org/licenses/>.
+ *
+ ******************************************************************************/
+#pragma once
+#ifndef KES_TABLE__H
+#define KES_TABLE__H
+
+/* include standard headers */
+#include <stddef.h>
+#include <stdint.h>
+#include <string.h>
+
+/* include module headers */
+#include "alloc.h"
+#include "const.h"
+#include "error.h"
+#include "solver.h"
+
+/******************************************************************************/
+
+/*** declare macro constants ***/
+
+/* number of Chebyshev coefficients per segment (degree + 1) */
+#define KES_TABLE_NCOEF  12
+
+/* max. number of octaves of M/pi, i.e. down to M ~ pi * 2^-64 */
+#define KES_TABLE_MAXOCT 64
+
+/* max. log2 of the number of segments per octave */
+#define KES_TABLE_MAXSUB 12
+
+/* default and min. tolerance of the fit, relative to the solution */
+#define KES_TABLE_TOL    1E-15
+
+/******************************************************************************/
+
+/*** declare data structures ***/
+
+/*!
+ * @brief piecewise Chebyshev approximation of E(M) for a fixed eccentricity
+ * @details the function g(M) = E(M) / M is approximated on 0 <= M <= pi,
+ * the range of x = M / pi is split into octaves 2^-(k+1) <= x < 2^-k
+ * (k = 0, ..., noct - 1), each into 2^shift[k] segments of equal length,
+ * plus one head segment 0 <= x < 2^-noct; the segment of a given M follows
+ * from the exponent of x without any transcendental function call
+ */
+struct kes_table_s
+{
+    double ecc;                          ///< eccentricity
+    double tol;                          ///< tolerance of the fit
+    int    noct;                         ///< number of octaves
+    int    nseg;                         ///< total number of segments
+    int    nalloc;                       ///< number of allocated segments,
+                                         ///< -1 in a caller buffer, see
+                                         ///< kes_table_new_ws()
+    kes_alloc_t alloc;                   ///< allocator of the table
+    int    shift[KES_TABLE_MAXOCT];      ///< log2 of segments per octave
+    int    first[KES_TABLE_MAXOCT + 1];  ///< first segment of each octave,
+                                         ///< first[noct] = head segment
+    double coef[];                       ///< coefficients, KES_TABLE_NCOEF
+                                         ///< per segment
+};
+
+/******************************************************************************/
+
+/*** function declarations ***/
+
+/*!
+ * @brief build a piecewise Chebyshev table for the elliptic Kepler Equation
+ * @details segments are refined per octave until the truncation error of the
+ * Chebyshev series is below \a tol relative to E(M); segments get shorter
+ * near M = 0 for high eccentricities by the octave layout
+ * @param[in] ecc eccentricity (0 < ecc < 1)
+ * @param[in] tol tolerance (KES_TABLE_TOL <= tol < 1, or 0 for default)
+ * @param[out] status pointer to return error code from enum #kes_err_e
+ * @return pointer to new table, free with kes_table_free(), or NULL on error
+ * or if memory cannot be allocated
+ */
+kes_table_t* kes_table_new(
+    const double ecc,
+    const double tol,
+    kes_err_e*   status
+);
+
+
+/*!
+ * @brief workspace size of a table
+ * @details builds the table without storing its coefficients, i.e. takes as
+ * long as kes_table_new()
+ * @param[in] ecc eccentricity (0 < ecc < 1)
+ * @param[in] tol tolerance (KES_TABLE_TOL <= tol < 1, or 0 for default)
+ * @param[out] status pointer to return error code from enum #kes_err_e
+ * @return number of bytes for kes_table_new_ws(), 0 on error
+ */
+size_t kes_table_size(
+    const double ecc,
+    const double tol,
+    kes_err_e*   status
+);
+
+
+/*!
+ * @brief build a piecewise Chebyshev table in a caller-provided buffer
+ * @details same table as kes_table_new(), no memory is allocated
+ * @param[in] ecc eccentricity (0 < ecc < 1)
+ * @param[in] tol tolerance (KES_TABLE_TOL <= tol < 1, or 0 for default)
+ * @param[out] buf buffer, aligned for double
+ * @param[in] size number of bytes of \a buf, see kes_table_size()
+ * @param[out] status pointer to return error code from enum #kes_err_e,
+ * KES_ERR_NOMEM if the buffer is too small or misaligned
+ * @return pointer to the table at \a buf, or NULL on error
+ */
+kes_table_t* kes_table_new_ws(
+    const double ecc,
+    const double tol,
+    void*        buf,
+    const size_t size,
+    kes_err_e*   status
+);
+
+
+/*!
+ * @brief release a table created by kes_table_new()
+ * @details tables of kes_table_new_ws() are not released, their buffer
+ * belongs to the caller
+ * @param[in] table pointer to table (may be NULL)
+ */
+void kes_table_free(kes_table_t* table);
+
+
+/*!
+ * @brief memory footprint of a table
+ * @param[in] table pointer to table (may be NULL)
+ * @return number of bytes allocated for the table (0 for NULL)
+ */
+size_t kes_table_bytes(const kes_table_t* table);
+
+/*!
+ * @brief evaluate a table for an array of reduced mean anomalies
+ * @details same results as kes_table_eval(), the recurrences of independent
+ * elements are interleaved
+ * @param[in] table pointer to table from kes_table_new()
+ * @param[in] n number of elements
+ * @param[in] redma reduced mean anomalies (0 <= redma <= pi)
+ * @param[out] ea eccentric anomalies (in radians)
+ */
+void kes_table_eval_batch(
+    const kes_table_t*     table,
+    const size_t           n,
+    const double* restrict redma,
+    double* restrict       ea
+);
+
+/******************************************************************************/
+
+/*** define inline functions ***/
+
+/*******************************************************************************
+ *  FUNCTION    : kes_table_pow2
+ *  DESCRIPTION : power of two from the exponent bits
+ *  INPUT       : exponent "n" (-1022 <= n <= 1023)
+ *  OUTPUT      : 2^n
+ ******************************************************************************/
+static inline double kes_table_pow2(const int n)
+{
+    const uint64_t bits = (uint64_t)(n + 1023) << 52;
+    double         res;
+
+    memcpy( &res, &bits, sizeof(res) );
+
+    return( res );
+} // end kes_table_pow2
+
+/******************************************************************************/
+
+/*******************************************************************************
+ *  FUNCTION    : kes_table_locate
+ *  DESCRIPTION : find segment of table for a reduced mean anomaly
+ *  INPUT       : - pointer "table" to table from kes_table_new()
+ *                - reduced mean anomaly "redma" (0 <= redma <= pi)
+ *                - pointer "t" to return local variable (-1 <= t <= 1)
+ *  OUTPUT      : index of segment
+ ******************************************************************************/
+static inline int kes_table_locate(
+    const kes_table_t* table,
+    const double       redma,
+    double*            t
+    )
+{
+    /* octave k from the biased exponent 1022 - k of x = M / pi */
+    const double x = redma * M_1_PI;
+    uint64_t     bits;
+    memcpy( &bits, &x, sizeof(bits) );
+
+    int k = 1022 - (int)(bits >> 52);
+    k     = ((k < 0) ? 0 : k);
+
+    /* head segment 0 <= x < 2^-noct */
+    if ( k >= table->noct )
+    {
+        *t = 2.0 * x * kes_table_pow2( table->noct ) - 1.0;
+        return( table->first[table->noct] );
+    } // end if
+
+    /* segment of octave 2^-(k+1) <= x < 2^-k */
+    const int    nsub = 1 << table->shift[k];
+    const double y    = x * kes_table_pow2( k + 1 + table->shift[k] ) - nsub;
+    int          sub  = (int)y;
+    sub = ((sub < nsub) ? sub : nsub - 1);
+
+    *t = 2.0 * (y - sub) - 1.0;
+
+    return( table->first[k] + sub );
+} // end kes_table_locate
+
+/******************************************************************************/
+
+/*******************************************************************************
+ *  FUNCTION    : kes_table_eval
+ *  DESCRIPTION : evaluate table of elliptic Kepler Equation
+ *  INPUT       : - pointer "table" to table from kes_table_new()
+ *                - reduced mean anomaly "redma" (0 <= redma <= pi)
+ *  OUTPUT      : eccentric anomaly E (in radians)
+ *  REFERENCE   : Clenshaw's recurrence for the Chebyshev series
+ ******************************************************************************/
+static inline double kes_table_eval(
+    const kes_table_t* table,
+    const double       redma
+    )
+{
+    double       t;
+    const int    seg = kes_table_locate( table, redma, &t );
+    const double* c  = table->coef + (size_t)seg * KES_TABLE_NCOEF;
+
+    double b1 = 0.0, b2 = 0.0;
+    for (int j = KES_TABLE_NCOEF - 1; j > 0; j--)
+    {
+        const double b = 2.0 * t * b1 - b2 + c[j];
+        b2 = b1;
+        b1 = b;
+    } // end for
+
+    return( redma * (t * b1 - b2 + c[0]) );
+} // end kes_table_eval
+
+/******************************************************************************/
+
+#endif  /* KES_TABLE__H */
@@ -0,0 +1,192 @@
+/***************************************************************************//**
+ * @file    trace.c
+ * @brief   runtime tracing of iteration processes
+ * @author  Bazso Akos
+ * @version 2026.10
+ *
+ * @copyright
+ * Copyright (C) 2019 Bazso Akos
+ *
+ * This file is part of libkes.
+ *
+ * libkes is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * libkes is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with libkes.  If not, see <https://www.gnu.org/licenses/>.
+ *
+ ******************************************************************************/
+/* include standard headers */
+#include <stdio.h>
+
+/* include module headers */
+#include "trace.h"
+#include "utils.h"
+
+/******************************************************************************/
+
+/* use verbose debug output? 0 = no (default), 1 = yes */
+#define KES_TRACE_DEBUG 0
+
+/******************************************************************************/
+
+/* sampling threshold in units of 2^-53, 0 = tracing disabled */
+uint64_t kes_trace_level = 0;
+
+/* registered callback and its user pointer */
+static kes_trace_fn* trace_fn   = NULL;
+static void*         trace_user = NULL;
+
+/* counter for seeding the per-thread random generators */
+static uint64_t trace_seed = 0;
+
+/* state of per-thread random generator, 0 = not yet seeded */
+static __thread uint64_t trace_rng = 0;
+
+/******************************************************************************/
+
+/*******************************************************************************
+ * FUNCTION    : kes_set_trace
+ * DESCRIPTION : register a callback for tracing iteration processes
+ * INPUT       : - callback function "fn" (or NULL)
+ *               - pointer "user" passed to the callback
+ *               - "fraction" of traced solver calls
+ * OUTPUT      : error code
+ ******************************************************************************/
+kes_err_e kes_set_trace(
+    kes_trace_fn* fn,
+    void*         user,
+    const double  fraction
+    )
+{
+    if ( (kes_check_val( fraction ) != KES_ERR_NOERR) ||
+         (fraction < 0.0) || (fraction > 1.0) )
+    {
+        return( KES_ERR_BADVAL );
+    } // end if
+
+    /* scale to 53 bit threshold, keep tiny fractions enabled */
+    uint64_t level = (uint64_t)(fraction * 9007199254740992.0);
+    if ( (level == 0) && (fraction > 0.0) )
+    {
+        level = 1;
+    } // end if
+
+    /* disable tracing while callback is replaced */
+    __atomic_store_n( &kes_trace_level, 0, __ATOMIC_RELEASE );
+    __atomic_store_n( &trace_fn, fn, __ATOMIC_RELEASE );
+    __atomic_store_n( &trace_user, user, __ATOMIC_RELEASE );
+    __atomic_store_n( &kes_trace_level, ((fn != NULL) ? level : 0),
+                      __ATOMIC_RELEASE );
+
+#if KES_TRACE_DEBUG
+    printf("%s: fraction = %lf, level = %lu\n",
+           __func__, fraction, (unsigned long)level);
+#endif
+
+    return( KES_ERR_NOERR );
+} // end kes_set_trace
+
+/******************************************************************************/
+
+/*******************************************************************************
+ * FUNCTION    : kes_trace_print
+ * DESCRIPTION : trace callback printing records to a stream
+ * INPUT       : - pointer "rec" to trace record
+ *               - stream "user" of type FILE* (or NULL for stdout)
+ * OUTPUT      : none
+ ******************************************************************************/
+void kes_trace_print(
+    const kes_trace_t* rec,
+    void*              user
+    )
+{
+    FILE* out = ((user != NULL) ? (FILE*)user : stdout);
+
+    fprintf(out, "solver %2d: e = %lf, M = %lf, iter = %3d, x = %.17g, "
+            "Deltax = %e, Deltaf = %e\n", (int)rec->solver, rec->ecc, rec->ma,
+            rec->iteration, rec->x, rec->deltax, rec->deltaf);
+} // end kes_trace_print
+
+/******************************************************************************/
+
+/*******************************************************************************
+ * FUNCTION    : kes_trace_sample
+ * DESCRIPTION : decide if the current solver call is traced
+ * INPUT       : sampling threshold "level" in units of 2^-53
+ * OUTPUT      : 1 if traced, 0 otherwise
+ ******************************************************************************/
+int kes_trace_sample(
+    const uint64_t level
+    )
+{
+    uint64_t x = trace_rng;
+
+    /* seed with splitmix64 of a global counter, state must not be zero */
+    if ( x == 0 )
+    {
+        x  = __atomic_add_fetch( &trace_seed, 0x9E3779B97F4A7C15ULL,
+                                 __ATOMIC_RELAXED );
+        x  = (x ^ (x >> 30)) * 0xBF58476D1CE4E5B9ULL;
+        x  = (x ^ (x >> 27)) * 0x94D049BB133111EBULL;
+        x ^= (x >> 31);
+        x |= 1;
+    } // end if
+
+    /* xorshift64* generator, upper 53 bits are compared with threshold */
+    x ^= x >> 12;
+    x ^= x << 25;
+    x ^= x >> 27;
+    trace_rng = x;
+
+    return( ((x * 0x2545F4914F6CDD1DULL) >> 11) < level );
+} // end kes_trace_sample
+
+/******************************************************************************/
+
+/*******************************************************************************
+ * FUNCTION    : kes_trace_emit
+ * DESCRIPTION : pass one record to the registered callback
+ * INPUT       : - "solver" method performing the iteration
+ *               - "iteration" counter
+ *               - eccentricity "ecc" and mean anomaly "ma"
+ *               - current value "x" of iteration variable
+ *               - error residuals "deltax" and "deltaf"
+ * OUTPUT      : none
+ ******************************************************************************/
+void kes_trace_emit(
+    const kes_sol_e solver,
+    const int       iteration,
+    const double    ecc,
+    const double    ma,
+    const double    x,
+    const double    deltax,
+    const double    deltaf
+    )
+{
+    kes_trace_fn* fn = __atomic_load_n( &trace_fn, __ATOMIC_ACQUIRE );
+
+    if ( fn != NULL )
+    {
+        const kes_trace_t rec = {
+            .solver    = solver,
+            .iteration = iteration,
+            .ecc       = ecc,
+            .ma        = ma,
+            .x         = x,
+            .deltax    = deltax,
+            .deltaf    = deltaf
+        };
+
+        fn( &rec, __atomic_load_n( &trace_user, __ATOMIC_ACQUIRE ) );
+    } // end if
+} // end kes_trace_emit
+
+/******************************************************************************/
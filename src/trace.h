@@ -0,0 +1,189 @@
+/***************************************************************************//**
+ * @file    trace.h
+ * @brief   runtime tracing of iteration processes
+ * @author  Bazso Akos
+ * @version 2026.10
+ *
+ * @copyright
+ * Copyright (C) 2019 Bazso Akos
+ *
+ * This file is part of libkes.
+ *
+ * libkes is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * libkes is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with libkes.  If not, see <https://www.gnu.org/licenses/>.
+ *
+ ******************************************************************************/
+#pragma once
+#ifndef KES_TRACE__H
+#define KES_TRACE__H
+
+/* include standard headers */
+#include <stdint.h>
+
+/* include module headers */
+#include "error.h"
+#include "solver.h"
+
+/******************************************************************************/
+
+/*** declare data structures ***/
+
+/*!
+ * @brief record of one step of an iteration process
+ * @details iteration 0 holds the starter value, deltax and deltaf are zero
+ * for steps without evaluation of the residuals
+ */
+typedef struct
+{
+    kes_sol_e solver;    ///< solver method performing the iteration
+    int       iteration; ///< iteration counter
+    double    ecc;       ///< eccentricity
+    double    ma;        ///< (reduced) mean anomaly
+    double    x;         ///< current value of iteration variable
+    double    deltax;    ///< error residual |x(n+1) - x(n)|
+    double    deltaf;    ///< error residual of Kepler Equation
+} kes_trace_t;
+
+
+/*!
+ * @brief prototype declaration for trace callback functions
+ * @details called once per record, \a user is the pointer given to
+ * kes_set_trace(); callbacks may run concurrently in several threads
+ */
+typedef void kes_trace_fn(
+    const kes_trace_t* rec,
+    void*              user
+);
+
+/******************************************************************************/
+
+/*** declare global variables ***/
+
+/* sampling threshold in units of 2^-53, 0 = tracing disabled
+ * NOTE internal use only, see kes_set_trace()
+ */
+extern uint64_t kes_trace_level;
+
+/******************************************************************************/
+
+/*** function declarations ***/
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/*!
+ * @brief register a callback for tracing iteration processes
+ * @details each call of a solver method is traced with probability
+ * \a fraction, decided once per call by a per-thread random generator;
+ * records of a traced call are passed to \a fn at every iteration;
+ * fn = NULL or fraction = 0 disables tracing (default), which costs a
+ * single load per solver call; vectorized batch solves are not traced and
+ * iterations with a fixed count (see kes_set_fixiter()) report the starter
+ * only;
+ * NOTE do not change the callback while other threads are solving
+ * @param[in] fn callback function (or NULL)
+ * @param[in] user pointer passed to the callback
+ * @param[in] fraction fraction of traced solver calls (0 <= fraction <= 1)
+ * @return error code from enum #kes_err_e;
+ * KES_ERR_NOERR indicates success, KES_ERR_BADVAL indicates error
+ */
+kes_err_e kes_set_trace(
+    kes_trace_fn* fn,
+    void*         user,
+    const double  fraction
+);
+
+
+/*!
+ * @brief trace callback printing records to a stream
+ * @param[in] rec pointer to trace record
+ * @param[in] user stream of type FILE* (or NULL for stdout)
+ */
+void kes_trace_print(
+    const kes_trace_t* rec,
+    void*              user
+);
+
+
+/*!
+ * @brief decide if the current solver call is traced
+ * @details draws from the per-thread random generator
+ * NOTE internal use only, see kes_trace_begin()
+ * @param[in] level sampling threshold (level > 0)
+ * @return 1 if traced, 0 otherwise
+ */
+int kes_trace_sample(
+    const uint64_t level
+);
+
+
+/*!
+ * @brief pass one record to the registered callback
+ * NOTE internal use only, see kes_trace_step()
+ */
+void kes_trace_emit(
+    const kes_sol_e solver,
+    const int       iteration,
+    const double    ecc,
+    const double    ma,
+    const double    x,
+    const double    deltax,
+    const double    deltaf
+);
+
+#ifdef __cplusplus
+}
+#endif
+
+/******************************************************************************/
+
+/*** inline functions ***/
+
+/*!
+ * @brief start tracing of a solver call
+ * @return 1 if the call is traced, 0 otherwise
+ */
+static inline int kes_trace_begin(void)
+{
+    const uint64_t level = __atomic_load_n( &kes_trace_level,
+                                            __ATOMIC_RELAXED );
+
+    return( (level != 0) && kes_trace_sample( level ) );
+} // end kes_trace_begin
+
+
+/*!
+ * @brief trace one step of an iteration process
+ * @param[in] on result of kes_trace_begin()
+ */
+static inline void kes_trace_step(
+    const int       on,
+    const kes_sol_e solver,
+    const int       iteration,
+    const double    ecc,
+    const double    ma,
+    const double    x,
+    const double    deltax,
+    const double    deltaf
+    )
+{
+    if ( on )
+    {
+        kes_trace_emit( solver, iteration, ecc, ma, x, deltax, deltaf );
+    } // end if
+} // end kes_trace_step
+
+/******************************************************************************/
+
+#endif  /* KES_TRACE__H */
@@ -0,0 +1,529 @@
+/***************************************************************************//**
+ * @file    univ.c
+ * @brief   universal-variable batch solver for all conic sections
+ * @details with perihelion distance q = 1 and gravitational parameter
+ *          mu = 1, the time t since perihelion and the universal anomaly s
+ *          are related by t = s + e * U3(s) for every eccentricity, where
+ *          U3(s) = s^3 * c3(a*s^2) with a = 1-e and the Stumpff function
+ *          c3(z) = (sqrt(z) - sin(sqrt(z))) / sqrt(z)^3, i.e. the same
+ *          iteration covers elliptic (a > 0), parabolic (a = 0) and
+ *          hyperbolic orbits (a < 0); the Stumpff functions, the starter
+ *          and the conversions are evaluated by both formulas of the
+ *          domains and selected by kes_vec_blend(), such that all loops
+ *          over lanes are free of data-dependent branches
+ * @author  Bazso Akos
+ * @version 2026.10
+ *
+ * @copyright
+ * Copyright (C) 2019 Bazso Akos
+ *
+ * This file is part of libkes.
+ *
+ * libkes is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * libkes is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with libkes.  If not, see <https://www.gnu.org/licenses/>.
+ *
+ ******************************************************************************/
+
+/* include standard headers */
+#include <math.h>
+#include <stdint.h>
+#include <string.h>
+
+/* include module headers */
+#include "univ.h"
+#include "const.h"
+#include "utils.h"
+#include "vecmath.h"
+#include "vecore.h"
+
+/******************************************************************************/
+
+/* threshold of eccentricity between domains, same as in kes_check_ecc() */
+static const double ecc_min = 1e-10;
+
+/* sqrt(2) and 1/sqrt(2) */
+static const double sqrt2   = 1.41421356237309504880;
+static const double sqrt1_2 = 0.70710678118654752440;
+
+/* fixed number of iterations selected by KES_FIX_AUTO, worst case reaching
+ * KES_STD_TOL on a dense grid in 0 <= ecc <= 1E4, 0 <= ma <= pi for
+ * elliptic and 1E-12 <= ma <= 1E12 for other orbits plus one iteration
+ * as margin
+ */
+static const int univ_fixauto = 5;
+
+/******************************************************************************/
+
+/*******************************************************************************
+ *  FUNCTION    : kes_univ_stumpff
+ *  DESCRIPTION : calculate U2(s) = s^2 * c2(a*s^2) and U3(s) = s^3 * c3(a*s^2)
+ *                for all signs of a without cancellation
+ *  INPUT       : - pointer to U2(s), U3(s)
+ *                - parameter a = 1-e of the conic section
+ *                - universal anomaly s
+ *  OUTPUT      : none
+ *  REFERENCE   : Taylor series in z = a*s^2 for |z| < 1, closed forms with
+ *                w = sqrt(|z|) otherwise, e.g. c2(z) = (1 - cos(w)) / z,
+ *                c3(z) = (w - sin(w)) / w^3 for z > 0 and
+ *                c2(z) = (cosh(w) - 1) / |z|, c3(z) = (sinh(w) - w) / w^3
+ *                for z < 0
+ ******************************************************************************/
+static KES_VEC_INLINE void kes_univ_stumpff(
+    double*      u2,
+    double*      u3,
+    const double a,
+    const double s
+    )
+{
+    /* coefficients 1/n! of Taylor polynomials */
+    static const double p2  = 1.0 / 2.0;
+    static const double p3  = 1.0 / 6.0;
+    static const double p4  = 1.0 / 24.0;
+    static const double p5  = 1.0 / 120.0;
+    static const double p6  = 1.0 / 720.0;
+    static const double p7  = 1.0 / 5040.0;
+    static const double p8  = 1.0 / 40320.0;
+    static const double p9  = 1.0 / 362880.0;
+    static const double p10 = 1.0 / 3628800.0;
+    static const double p11 = 1.0 / 39916800.0;
+    static const double p12 = 1.0 / 479001600.0;
+    static const double p13 = 1.0 / 6227020800.0;
+    static const double p14 = 1.0 / 87178291200.0;
+    static const double p15 = 1.0 / 1307674368000.0;
+    static const double p16 = 1.0 / 20922789888000.0;
+    static const double p17 = 1.0 / 355687428096000.0;
+    static const double p18 = 1.0 / 6402373705728000.0;
+    static const double p19 = 1.0 / 121645100408832000.0;
+
+    const double s2 = s * s;
+    const double z  = a * s2;
+    const double az = fabs(z);
+
+    /* series c2(z) = 1/2! - z/4! + ... + z^8/18!,
+     *        c3(z) = 1/3! - z/5! + ... + z^8/19! for |z| < 1
+     */
+    const double c2s = p2 - z * (p4 - z * (p6 - z * (p8 - z * (p10 -
+                       z * (p12 - z * (p14 - z * (p16 - z * p18)))))));
+    const double c3s = p3 - z * (p5 - z * (p7 - z * (p9 - z * (p11 -
+                       z * (p13 - z * (p15 - z * (p17 - z * p19)))))));
+
+    /* closed forms (with dummy divisors for |z| < 1),
+     * NOTE w <= pi for elliptic, w <= 710 for hyperbolic orbits
+     */
+    const double w  = kes_vec_sqrt( az );
+    double       sx, cx, shm, chm;
+    kes_vec_sincos( &sx, &cx, w );
+    kes_vec_sinhcoshm( &shm, &chm, w );
+    const double iz  = 1.0 / kes_vec_blend( az - 1.0, 1.0, az );
+    const double iw  = 1.0 / kes_vec_blend( az - 1.0, 1.0, w );
+    const double c2b = kes_vec_blend( z, chm, 1.0 - cx ) * iz;
+    const double c3b = kes_vec_blend( z, shm, w - sx ) * iz * iw;
+
+    /* select series for |z| < 1 */
+    *u2 = s2 * kes_vec_blend( az - 1.0, c2s, c2b );
+    *u3 = s2 * s * kes_vec_blend( az - 1.0, c3s, c3b );
+
+    return;
+} // end kes_univ_stumpff
+
+/******************************************************************************/
+
+/*******************************************************************************
+ *  FUNCTION    : kes_univ_setup
+ *  DESCRIPTION : parameters and starting value of the universal iteration
+ *  INPUT       : - eccentricity "ecc" (ecc >= 0)
+ *                - mean anomaly "ma"
+ *                - pointer to eccentricity "eu" of the iteration
+ *                  (1 for parabolic orbits)
+ *                - pointer to parameter "a" = 1-e (0 for parabolic orbits)
+ *                - pointer to reduced mean anomaly "mr", |mr| <= pi for
+ *                  elliptic orbits, mr = ma otherwise
+ *                - pointer to time since perihelion "t" = |mr| / |a|^(3/2)
+ *                  (sqrt(2)*|mr| for parabolic orbits)
+ *                - pointer to scale "g" of s to the anomaly, sqrt(|a|)
+ *                  (sqrt(2) for parabolic orbits)
+ *                - pointer to starting value "s0" >= 0
+ *  OUTPUT      : none
+ ******************************************************************************/
+static inline void kes_univ_setup(
+    const double ecc,
+    const double ma,
+    double*      eu,
+    double*      a,
+    double*      mr,
+    double*      t,
+    double*      g,
+    double*      s0
+    )
+{
+    /* domains as in kes_check_ecc(): e = 1, a = 0 in the parabolic band */
+    const double e1 = 1.0 - ecc;
+    *a  = kes_vec_blend( ecc - (1.0 - ecc_min), e1,
+                         kes_vec_blend( (1.0 + ecc_min) - ecc, e1, 0.0 ) );
+    *eu = kes_vec_blend( fabs(*a) - KES_VEC_DBL_MIN, 1.0, ecc );
+
+    /* reduce mean anomaly of elliptic orbits to [-pi:pi] */
+    const double k = (ma * (0.5 * M_1_PI) + KES_VEC_RNDMAGIC) -
+                     KES_VEC_RNDMAGIC;
+    *mr = kes_vec_blend( KES_VEC_DBL_MIN - *a,
+                         (ma - k * (4.0 * KES_VEC_PIO2_HI)) -
+                         k * (4.0 * KES_VEC_PIO2_LO), ma );
+
+    /* time since perihelion */
+    const double aa = fabs(*a);
+    const double sa = kes_vec_sqrt( aa );
+    const double am = fabs(*mr);
+    *t = am / kes_vec_blend( aa - KES_VEC_DBL_MIN, sqrt1_2, aa * sa );
+    *g = kes_vec_blend( aa - KES_VEC_DBL_MIN, sqrt2, sa );
+
+    /* cubic approximation s + e*s^3/6 = t, i.e. s^3 + 3*p*s - 2*q = 0,
+     * exact for parabolic, lower bound for elliptic and upper bound for
+     * hyperbolic orbits (same root as in kes_stm_hyp()),
+     * NOTE avoid overflow for huge t and tiny eccentricities
+     */
+    const double ec = kes_vec_blend( *eu - 1E-100, 1E-100, *eu );
+    const double p  = 2.0 / ec;
+    const double q  = 3.0 * (*t) / ec;
+    double       r  = kes_vec_cbrt( kes_vec_blend( q - 1E150,
+                          q + kes_vec_sqrt( q * q + p * p * p ), 2.0 * q ) );
+    r *= r;
+    const double sc = 2.0 * q / (r + p + p * p / r);
+
+    /* hyperbolic orbits: smaller of the upper bound and one fixed-point step
+     * H = asinh((M + H) / e) from there
+     */
+    const double sh = kes_vec_asinh( (am + sa * sc) / ec ) / sa;
+    *s0 = kes_vec_blend( *a, kes_vec_blend( sh - sc, sh, sc ), sc );
+
+    return;
+} // end kes_univ_setup
+
+/******************************************************************************/
+
+/*******************************************************************************
+ *  FUNCTION    : kes_univ_core
+ *  DESCRIPTION : one Laguerre-Conway step for the universal Kepler Equation
+ *                f(s) = s + e * U3(s) - t = 0
+ *  INPUT       : - eccentricity "ecc"
+ *                - parameter "a" = 1-e
+ *                - time since perihelion "t"
+ *                - old value of iteration variable "s"
+ *                - pointer to Newton correction |f(s) / f'(s)| at "s"
+ *  OUTPUT      : update to iteration variable s+ds
+ *  REFERENCE   : Conway (1986), Celestial Mechanics 39, p.199-211
+ ******************************************************************************/
+static KES_VEC_INLINE double kes_univ_core(
+    const double ecc,
+    const double a,
+    const double t,
+    const double s,
+    double*      fn
+    )
+{
+    double u2, u3;
+    kes_univ_stumpff( &u2, &u3, a, s );
+
+    /* f(s), f'(s) = 1 + e*U2(s) >= 1 and f''(s) = e*U1(s) */
+    const double f0 = (s - t) + ecc * u3;
+    const double f1 = 1.0 + ecc * u2;
+    const double f2 = ecc * (s - a * u3);
+
+    /* Laguerre's method of degree n = 5, NOTE f1 > 0 */
+    const double d  = kes_vec_sqrt( fabs( 16.0 * f1 * f1 - 20.0 * f0 * f2 ) );
+    *fn = fabs(f0) / f1;
+
+    return( s - 5.0 * f0 / (f1 + d) );
+} // end kes_univ_core
+
+/******************************************************************************/
+
+/*******************************************************************************
+ *  FUNCTION    : kes_univ_result
+ *  DESCRIPTION : anomaly of kesolver() from the universal anomaly
+ *  INPUT       : - eccentricity "ecc" and mean anomaly "ma"
+ *                - parameter "a" = 1-e
+ *                - reduced mean anomaly "mr"
+ *                - scale "g" and universal anomaly "s" >= 0
+ *  OUTPUT      : E in [0:2*pi], true anomaly or H (in radians),
+ *                M for circular orbits
+ ******************************************************************************/
+static inline double kes_univ_result(
+    const double ecc,
+    const double ma,
+    const double a,
+    const double mr,
+    const double g,
+    const double s
+    )
+{
+    /* parabolic orbits: true anomaly from s = sqrt(2) * tan(v/2) */
+    const double x = copysign( kes_vec_blend( fabs(a) - KES_VEC_DBL_MIN,
+                                              2.0 * kes_vec_atan2( s, sqrt2 ),
+                                              g * s ), mr );
+
+    /* elliptic orbits: E in [0:2*pi] as for kes_reduce_side() */
+    const double y = kes_vec_blend( KES_VEC_DBL_MIN - a,
+                                    kes_vec_blend( x + KES_VEC_DBL_MIN,
+                                                   x + M_2PI, x ), x );
+
+    /* circular orbits: E = M as in kesolver() */
+    return( kes_vec_blend( (ecc - ecc_min) - KES_VEC_DBL_MIN, ma, y ) );
+} // end kes_univ_result
+
+/******************************************************************************/
+
+/*******************************************************************************
+ *  FUNCTION    : kes_vunivcore
+ *  DESCRIPTION : vectorized Laguerre-Conway step for the universal Kepler
+ *                Equation
+ *  INPUT       : - eccentricities "ecc", parameters "a" = 1-e
+ *                - times since perihelion "t"
+ *                - old values of iteration variable "s0"
+ *                - new values of iteration variable "s1"
+ *                - Newton corrections "fn" at the old values
+ *  OUTPUT      : none
+ ******************************************************************************/
+KES_VEC_DISPATCH
+static void kes_vunivcore(
+    const double* restrict ecc,
+    const double* restrict a,
+    const double* restrict t,
+    const double* restrict s0,
+    double* restrict       s1,
+    double* restrict       fn
+    )
+{
+    for (int l = 0; l < KES_VEC_LEN; l++)
+    {
+        s1[l] = kes_univ_core( ecc[l], a[l], t[l], s0[l], &fn[l] );
+    } // end for
+} // end kes_vunivcore
+
+/******************************************************************************/
+
+/*******************************************************************************
+ *  FUNCTION    : kes_vsolve_univ
+ *  DESCRIPTION : vectorized universal-variable solver, lanes are iterated
+ *                until all of them have converged
+ *  INPUT       : - eccentricities "ecc", parameters "a" = 1-e
+ *                - times since perihelion "t" and scales "g"
+ *                - starting values and solutions "s"
+ *                - number of iterations "count"
+ *                - pointer "data" to checked input parameters
+ *                - resolved fixed number of iterations "fixiter"
+ *  OUTPUT      : none
+ ******************************************************************************/
+static void kes_vsolve_univ(
+    const double* restrict ecc,
+    const double* restrict a,
+    const double* restrict t,
+    const double* restrict g,
+    double* restrict       s,
+    int* restrict          count,
+    const kes_input_t*     data,
+    const int              fixiter
+    )
+{
+    double snew[KES_VEC_LEN]; /* updated iteration variables */
+    double fn[KES_VEC_LEN];   /* Newton corrections at the old iterates */
+    int    todo[KES_VEC_LEN]; /* lane is still iterating? */
+
+    /* fixed number of iterations without the stopping criteria */
+    if ( fixiter > 0 )
+    {
+        for (int n = 0; n < fixiter; n++)
+        {
+            kes_vunivcore( ecc, a, t, s, snew, fn );
+            for (int l = 0; l < KES_VEC_LEN; l++)
+            {
+                s[l] = snew[l];
+            } // end for
+        } // end for
+
+        for (int l = 0; l < KES_VEC_LEN; l++)
+        {
+            count[l] = fixiter;
+        } // end for
+
+        return;
+    } // end if
+
+    /* initialize lanes */
+    for (int l = 0; l < KES_VEC_LEN; l++)
+    {
+        count[l] = 0;
+        todo[l]  = 1;
+    } // end for
+
+    /* main iteration loop, errors are measured in the anomaly */
+    const double tolx    = data->tolx;
+    const double tolf    = data->tolf;
+    const int    maxiter = data->maxiter;
+    int          active;
+
+    do
+    {
+        kes_vunivcore( ecc, a, t, s, snew, fn );
+
+        active = 0;
+        for (int l = 0; l < KES_VEC_LEN; l++)
+        {
+            const double deltax = fabs(snew[l] - s[l]) * g[l];
+            const double deltaf = fn[l] * g[l];
+
+            /* converged lanes keep their results */
+            s[l]     = (todo[l] ? snew[l] : s[l]);
+            count[l] += todo[l];
+            todo[l]  = todo[l] &&
+                       (deltax   > tolx * fmax(1.0, snew[l] * g[l])) &&
+                       (deltaf   > tolf) &&
+                       (count[l] < maxiter);
+            active  |= todo[l];
+        } // end for
+    } while ( active ); // end do
+
+    return;
+} // end kes_vsolve_univ
+
+/******************************************************************************/
+
+/*******************************************************************************
+ *  FUNCTION    : kesolver_batch_univ
+ *  DESCRIPTION : universal-variable batch solver for Kepler Equation,
+ *                all elements of a block of KES_VEC_LEN share the lanes of
+ *                one iteration regardless of their eccentricity domain
+ *  INPUT       : - number of elements "n"
+ *                - eccentricity array "ecc" with stride "incecc"
+ *                  (incecc = 0 uses the same eccentricity for all elements)
+ *                - mean anomaly array "ma" (in radians)
+ *                - solution array "ea" (in radians)
+ *                - pointer "data" to input parameters (may be NULL)
+ *                - optional arrays "status" and "iterations" (may be NULL)
+ *  OUTPUT      : KES_ERR_NOERR if all elements were solved successfully,
+ *                otherwise error code of the first failing element
+ ******************************************************************************/
+kes_err_e kesolver_batch_univ(
+    const size_t       n,
+    const double*      ecc,
+    const size_t       incecc,
+    const double*      ma,
+    double*            ea,
+    const kes_input_t* data,
+    kes_err_e*         status,
+    int*               iterations
+    )
+{
+    kes_err_e ret = KES_ERR_NOERR;
+
+    /* lanes of one block */
+    kes_err_e lerr[KES_VEC_LEN];   /* error code */
+    double    lecc[KES_VEC_LEN];   /* eccentricity */
+    double    leu[KES_VEC_LEN];    /* eccentricity of the iteration */
+    double    lma[KES_VEC_LEN];    /* mean anomaly */
+    double    la[KES_VEC_LEN];     /* parameter 1-e */
+    double    lmr[KES_VEC_LEN];    /* reduced mean anomaly */
+    double    lt[KES_VEC_LEN];     /* time since perihelion */
+    double    lg[KES_VEC_LEN];     /* scale of the universal anomaly */
+    double    ls[KES_VEC_LEN];     /* universal anomaly */
+    int       lcount[KES_VEC_LEN]; /* number of iterations */
+
+    /* nothing to do for empty arrays */
+    if ( n == 0 )
+    {
+        return( ret );
+    } // end if
+
+    /* private copy of input parameters, check and set defaults once */
+    kes_input_t work = ((data != NULL) ? *data : kes_new_input());
+    kes_check_input( &work );
+    const int   fixiter = ((work.fixiter == KES_FIX_AUTO) ?
+                           univ_fixauto : work.fixiter);
+
+    for (size_t i0 = 0; i0 < n; i0 += KES_VEC_LEN)
+    {
+        const size_t lanes = ((n - i0 > KES_VEC_LEN) ? KES_VEC_LEN : n - i0);
+
+        /* check inputs, invalid elements and unused lanes get harmless
+         * dummy values
+         */
+        for (size_t l = 0; l < KES_VEC_LEN; l++)
+        {
+            lerr[l] = KES_ERR_BADVAL;
+            if ( l < lanes )
+            {
+                const double e = ecc[(i0 + l) * incecc];
+                const double m = ma[i0 + l];
+
+                if (
+                    (kes_check_val( e ) != KES_ERR_NOERR) ||
+                    (kes_check_val( m ) != KES_ERR_NOERR)
+                ) {
+                    lerr[l] = KES_ERR_BADVAL;
+                } // end if
+                else if ( e < 0.0 )
+                {
+                    lerr[l] = KES_ERR_BADECC;
+                } // end if
+                else
+                {
+                    lerr[l] = KES_ERR_NOERR;
+                    lecc[l] = e;
+                    lma[l]  = m;
+                } // end else
+            } // end if
+
+            if ( lerr[l] != KES_ERR_NOERR )
+            {
+                lecc[l] = 0.5;
+                lma[l]  = 1.0;
+            } // end if
+        } // end for
+
+        /* set up and solve all lanes at once */
+        for (int l = 0; l < KES_VEC_LEN; l++)
+        {
+            kes_univ_setup( lecc[l], lma[l], &leu[l], &la[l], &lmr[l], &lt[l],
+                            &lg[l], &ls[l] );
+        } // end for
+
+        kes_vsolve_univ( leu, la, lt, lg, ls, lcount, &work, fixiter );
+
+        for (size_t l = 0; l < lanes; l++)
+        {
+            const size_t i = i0 + l;
+            ea[i] = ((lerr[l] == KES_ERR_NOERR) ?
+                     kes_univ_result( lecc[l], lma[l], la[l], lmr[l], lg[l],
+                                      ls[l] ) : 0.0);
+
+            /* optional per-element outputs */
+            if ( status != NULL )
+            {
+                status[i] = lerr[l];
+            } // end if
+            if ( iterations != NULL )
+            {
+                iterations[i] = ((lerr[l] == KES_ERR_NOERR) ? lcount[l] : 0);
+            } // end if
+
+            /* remember first error */
+            if ( (ret == KES_ERR_NOERR) && (lerr[l] != KES_ERR_NOERR) )
+            {
+                ret = lerr[l];
+            } // end if
+        } // end for
+    } // end for
+
+    return( ret );
+} // end kesolver_batch_univ
+
+/******************************************************************************/
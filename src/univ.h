@@ -0,0 +1,91 @@
+/***************************************************************************//**
+ * @file    univ.h
+ * @brief   universal-variable batch solver for all conic sections
+ * @author  Bazso Akos
+ * @version 2026.10
+ *
+ * @copyright
+ * Copyright (C) 2019 Bazso Akos
+ *
+ * This file is part of libkes.
+ *
+ * libkes is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * libkes is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with libkes.  If not, see <https://www.gnu.org/licenses/>.
+ *
+ ******************************************************************************/
+#pragma once
+#ifndef KES_UNIV__H
+#define KES_UNIV__H
+
+/* include standard headers */
+#include <stddef.h>
+
+/* include module headers */
+#include "error.h"
+#include "input.h"
+
+/******************************************************************************/
+
+/*** function declarations ***/
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/*!
+ * @brief universal-variable batch solver for Kepler Equation
+ * @details solves elliptic, parabolic and hyperbolic elements by the same
+ * iteration, i.e. without partitioning a mixed batch by eccentricity domain:
+ * with perihelion distance and gravitational parameter scaled to 1, the
+ * universal anomaly s solves s + e * s^3 * c3(a*s^2) = t by the
+ * Laguerre-Conway method, where a = 1-e and c3 is a Stumpff function, and
+ * t = M / |1-e|^(3/2) (or sqrt(2)*M for parabolic orbits); the solutions
+ * are the same anomalies as from kesolver(), i.e. E in [0:2*pi] for
+ * elliptic, the true anomaly for parabolic (|1-e| <= 1E-10) and H for
+ * hyperbolic orbits; the near-parabolic band needs no special treatment;
+ * convergence is tested on the anomaly with "tolx" relative to
+ * max(1, |x|) and on the residual converted to the anomaly with "tolf",
+ * KES_FIX_AUTO selects a fixed number of iterations for all elements;
+ * NOTE valid for |M| / |1-e|^(3/2) < 1E300 and, for elliptic orbits,
+ * |M| < 1E15
+ * @param[in] n number of elements
+ * @param[in] ecc array of eccentricities
+ * @param[in] incecc stride of array \a ecc;
+ * use 0 for a single eccentricity common to all elements, 1 for an array
+ * @param[in] ma array of mean anomalies (in radians)
+ * @param[out] ea array of solutions to Kepler Equation
+ * @param[in] data pointer to data structure of type #kes_input_t
+ * (or NULL for default settings)
+ * @param[out] status optional array of per-element error codes (or NULL)
+ * @param[out] iterations optional array of per-element iterations (or NULL)
+ * @return error code from enum #kes_err_e;
+ * KES_ERR_NOERR if all elements were solved, else code of first failure
+ */
+kes_err_e kesolver_batch_univ(
+    const size_t       n,
+    const double*      ecc,
+    const size_t       incecc,
+    const double*      ma,
+    double*            ea,
+    const kes_input_t* data,
+    kes_err_e*         status,
+    int*               iterations
+);
+
+#ifdef __cplusplus
+}
+#endif
+
+/******************************************************************************/
+
+#endif  /* KES_UNIV__H */
@@ -25,9 +25,14 @@
  * along with libkes.  If not, see <https://www.gnu.org/licenses/>.
  *
  ******************************************************************************/
+/* include standard headers */
+#include <math.h>
+
 /* include module headers */
 #include "utils.h"
 #include "const.h"
+#include "vecmath.h"
+#include "vecore.h"
 
 /******************************************************************************/
 
@@ -128,47 +133,256 @@ inline kes_err_e kes_check_val(const double x)
 
 /******************************************************************************/
 
+/*******************************************************************************
+ *  FUNCTION    : kes_reduce_huge
+ *  DESCRIPTION : reduce huge angles to interval [-pi:pi]
+ *  INPUT       : angle x (finite, in radians)
+ *  OUTPUT      : angle x modulo 2*pi (in radians)
+ *  NOTE          sin() and cos() of the C library reduce their arguments
+ *                with the digits of pi needed for any x (e.g. Payne-Hanek
+ *                in glibc), the angle follows from them to a few ulp
+ ******************************************************************************/
+static double kes_reduce_huge(const double x)
+{
+    return( atan2( sin(x), cos(x) ) );
+} // end kes_reduce_huge
+
+/******************************************************************************/
+
 /*******************************************************************************
  *  FUNCTION    : kes_reduce
- *  DESCRIPTION : reduce mean anomaly to interval [-pi:pi)
+ *  DESCRIPTION : reduce mean anomaly to interval [-pi:pi]
  *  INPUT       : angle x (in radians)
  *  OUTPUT      : angle x modulo 2*pi (in radians)
+ *  REFERENCE   : see kes_vec_reduce() in vecmath.h
  ******************************************************************************/
 inline double kes_reduce(double x)
 {
-    if ( kes_check_val(x) == KES_ERR_NOERR )
+    if ( fabs(x) < KES_VEC_REDUCE_MAX )
+    {
+        /* x modulo (2*pi) without division and rounding errors of 2*pi */
+        x = kes_vec_reduce( x );
+    } // end if
+    else if ( kes_check_val(x) == KES_ERR_NOERR )
     {
-        /* x modulo (2*pi) */
-        x -= floor(x / M_2PI) * M_2PI;
+        x = kes_reduce_huge( x );
+    } // end if
 
-        // if x >  pi : x - 2*pi
-        x = ((x >  M_PI) ? x - M_2PI : x);
+    return( x );
+} // end kes_reduce
 
-        // if x < -pi : x + 2*pi
-        x = ((x < -M_PI) ? x + M_2PI : x);
+/******************************************************************************/
 
-        /*** TODO FIXME after rebound/tools.c
-         * while (x < -M_PI) x += M_2PI;
-         * while (x >  M_PI) x -= M_2PI;
-         ***/
+/*******************************************************************************
+ *  FUNCTION    : kes_reduce_nt
+ *  DESCRIPTION : reduce mean anomaly M = n * t to interval [-pi:pi], from
+ *                the exact product of mean motion and time
+ *  INPUT       : - mean motion "mm" (in radians per unit of time)
+ *                - time "t" since perihelion passage
+ *  OUTPUT      : angle n * t modulo 2*pi (in radians)
+ *  REFERENCE   : see kes_vec_mul2() and kes_vec_reduce2() in vecmath.h
+ ******************************************************************************/
+inline double kes_reduce_nt(
+    const double mm,
+    const double t
+    )
+{
+    double       lo;
+    const double hi = kes_vec_mul2( mm, t, &lo );
+
+    if ( fabs(hi) < KES_VEC_REDUCE_MAX )
+    {
+        return( kes_vec_reduce2( hi, lo ) );
+    } // end if
+    else if ( kes_check_val(hi) == KES_ERR_NOERR )
+    {
+        return( kes_reduce( kes_reduce_huge( hi ) + lo ) );
     } // end if
 
-    return( x );
-} // end kes_reduce
+    return( hi );
+} // end kes_reduce_nt
+
+/******************************************************************************/
+
+/*******************************************************************************
+ *  FUNCTION    : kes_vreduce
+ *  DESCRIPTION : vectorized reduction of KES_VEC_LEN mean anomalies
+ *  INPUT       : - mean anomalies "ma" (|ma| < KES_VEC_REDUCE_MAX)
+ *                - reduced mean anomalies "redma"
+ *  OUTPUT      : none
+ ******************************************************************************/
+KES_VEC_DISPATCH
+static void kes_vreduce(
+    const double* restrict ma,
+    double* restrict       redma
+    )
+{
+    for (int l = 0; l < KES_VEC_LEN; l++)
+    {
+        redma[l] = kes_vec_reduce( ma[l] );
+    } // end for
+} // end kes_vreduce
+
+/******************************************************************************/
+
+/*******************************************************************************
+ *  FUNCTION    : kes_vreduce_nt
+ *  DESCRIPTION : vectorized reduction of KES_VEC_LEN mean anomalies n * t
+ *  INPUT       : - mean motions "mm"
+ *                - times "t"
+ *                - reduced mean anomalies "redma"
+ *  OUTPUT      : none
+ ******************************************************************************/
+KES_VEC_DISPATCH
+static void kes_vreduce_nt(
+    const double* restrict mm,
+    const double* restrict t,
+    double* restrict       redma
+    )
+{
+    for (int l = 0; l < KES_VEC_LEN; l++)
+    {
+        double       lo;
+        const double hi = kes_vec_mul2( mm[l], t[l], &lo );
+        redma[l] = kes_vec_reduce2( hi, lo );
+    } // end for
+} // end kes_vreduce_nt
+
+/******************************************************************************/
+
+/*******************************************************************************
+ *  FUNCTION    : kes_reduce_batch
+ *  DESCRIPTION : reduce arrays of mean anomalies to interval [-pi:pi],
+ *                blocks of KES_VEC_LEN elements are reduced by the
+ *                vectorized reduction of kes_reduce()
+ *  INPUT       : - number of elements "n"
+ *                - array of mean anomalies "ma" (in radians)
+ *                - array "redma" to return the reduced mean anomalies
+ *                  (may be the same array as "ma")
+ *  OUTPUT      : error code (see error.h)
+ ******************************************************************************/
+kes_err_e kes_reduce_batch(
+    const size_t  n,
+    const double* ma,
+    double*       redma
+    )
+{
+    double    lx[KES_VEC_LEN]; /* mean anomalies of lanes */
+    double    lr[KES_VEC_LEN]; /* reduced mean anomalies of lanes */
+    kes_err_e err = KES_ERR_NOERR;
+
+    for (size_t i0 = 0; i0 < n; i0 += KES_VEC_LEN)
+    {
+        const int lanes = ((n - i0 > KES_VEC_LEN) ?
+                           KES_VEC_LEN : (int)(n - i0));
+
+        /* full blocks without copies of the inputs, partial blocks are
+         * filled with zeros; NOTE results are stored after the block is
+         * checked, i.e. the arrays may be the same
+         */
+        const double* x = &ma[i0];
+        if ( lanes < KES_VEC_LEN )
+        {
+            for (int l = 0; l < KES_VEC_LEN; l++)
+            {
+                lx[l] = ((l < lanes) ? ma[i0 + l] : 0.0);
+            } // end for
+            x = lx;
+        } // end if
+
+        kes_vreduce( x, lr );
+
+        for (int l = 0; l < lanes; l++)
+        {
+            /* rare huge and invalid values, scalar fallback */
+            if ( !(fabs(x[l]) < KES_VEC_REDUCE_MAX) )
+            {
+                lr[l] = kes_reduce( x[l] );
+                err   = (((err == KES_ERR_NOERR) &&
+                          (kes_check_val( x[l] ) != KES_ERR_NOERR)) ?
+                         KES_ERR_BADVAL : err);
+            } // end if
+            redma[i0 + l] = lr[l];
+        } // end for
+    } // end for
+
+    return( err );
+} // end kes_reduce_batch
+
+/******************************************************************************/
+
+/*******************************************************************************
+ *  FUNCTION    : kes_reduce_nt_batch
+ *  DESCRIPTION : reduce arrays of mean anomalies M = n * t to interval
+ *                [-pi:pi], from the exact products of mean motions and
+ *                times, in blocks of KES_VEC_LEN elements
+ *  INPUT       : - number of elements "n"
+ *                - array of mean motions "mm" with stride "incmm"
+ *                  (0 = common mean motion)
+ *                - array of times "t" since perihelion passage
+ *                - array "redma" to return the reduced mean anomalies
+ *                  (may be the same array as "t")
+ *  OUTPUT      : error code (see error.h)
+ ******************************************************************************/
+kes_err_e kes_reduce_nt_batch(
+    const size_t  n,
+    const double* mm,
+    const size_t  incmm,
+    const double* t,
+    double*       redma
+    )
+{
+    double    lm[KES_VEC_LEN]; /* mean motions of lanes */
+    double    lt[KES_VEC_LEN]; /* times of lanes */
+    double    lr[KES_VEC_LEN]; /* reduced mean anomalies of lanes */
+    kes_err_e err = KES_ERR_NOERR;
+
+    for (size_t i0 = 0; i0 < n; i0 += KES_VEC_LEN)
+    {
+        const int lanes = ((n - i0 > KES_VEC_LEN) ?
+                           KES_VEC_LEN : (int)(n - i0));
+
+        /* collect lanes, unused lanes are zero */
+        for (int l = 0; l < KES_VEC_LEN; l++)
+        {
+            lm[l] = ((l < lanes) ? mm[(i0 + l) * incmm] : 0.0);
+            lt[l] = ((l < lanes) ? t[i0 + l] : 0.0);
+        } // end for
+
+        kes_vreduce_nt( lm, lt, lr );
+
+        for (int l = 0; l < lanes; l++)
+        {
+            /* rare huge and invalid values, scalar fallback */
+            const double m = lm[l] * lt[l];
+            if ( !(fabs(m) < KES_VEC_REDUCE_MAX) )
+            {
+                lr[l] = kes_reduce_nt( lm[l], lt[l] );
+                err   = (((err == KES_ERR_NOERR) &&
+                          (kes_check_val( m ) != KES_ERR_NOERR)) ?
+                         KES_ERR_BADVAL : err);
+            } // end if
+            redma[i0 + l] = lr[l];
+        } // end for
+    } // end for
+
+    return( err );
+} // end kes_reduce_nt_batch
 
 /******************************************************************************/
 
 /*******************************************************************************
  *  FUNCTION    : kes_sincos
  *  DESCRIPTION : calculate the values of functions sin(x) and cos(x) by
- *                a single call to tan(x/2),
+ *                a single argument reduction and two minimax polynomials,
+ *                fallback to the standard library for huge arguments
  *  NOTE          if "ecc" <  0, then sin(x), cos(x) are returned,
  *                if "ecc" >= 0, then ecc*sin(x), ecc*cos(x) are returned
  *  INPUT       : - pointer to sin(x), cos(x)
  *                - angle x (in radians)
  *                - eccentricity ecc
  *  OUTPUT      : none
- *  REFERENCE   : Press et al., Numerical Recipes
+ *  REFERENCE   : fdlibm, see kes_vec_sincos() in vecmath.h
  ******************************************************************************/
 inline void kes_sincos(
     double*      sx,
@@ -177,11 +391,15 @@ inline void kes_sincos(
     const double ecc
     )
 {
-    const double tx = tan(0.5 * x);          // tan(x/2)
-    const double cd = 1.0 / (1.0 + tx * tx); // common denominator
-
-    *cx = (1.0 - tx * tx) * cd;              // cos(x)
-    *sx = 2.0 * tx * cd;                     // sin(x)
+    if ( fabs(x) < KES_VEC_SINCOS_MAX )
+    {
+        kes_vec_sincos( sx, cx, x );         // sin(x), cos(x)
+    } // end if
+    else
+    {
+        *sx = sin(x);
+        *cx = cos(x);
+    } // end else
 
     if ( ecc >= 0.0 )
     {
@@ -194,12 +412,96 @@ inline void kes_sincos(
 
 /******************************************************************************/
 
+/*******************************************************************************
+ *  FUNCTION    : kes_sincos_fast
+ *  DESCRIPTION : calculate the values of functions sin(x) and cos(x) with
+ *                reduced accuracy (absolute error about 1E-12)
+ *  NOTE          if "ecc" <  0, then sin(x), cos(x) are returned,
+ *                if "ecc" >= 0, then ecc*sin(x), ecc*cos(x) are returned
+ *  INPUT       : - pointer to sin(x), cos(x)
+ *                - angle x (in radians)
+ *                - eccentricity ecc
+ *  OUTPUT      : none
+ *  REFERENCE   : see kes_vec_sincos_fast() in vecmath.h
+ ******************************************************************************/
+inline void kes_sincos_fast(
+    double*      sx,
+    double*      cx,
+    const double x,
+    const double ecc
+    )
+{
+    if ( fabs(x) < KES_VEC_SINCOS_MAX )
+    {
+        kes_vec_sincos_fast( sx, cx, x );    // sin(x), cos(x)
+    } // end if
+    else
+    {
+        *sx = sin(x);
+        *cx = cos(x);
+    } // end else
+
+    if ( ecc >= 0.0 )
+    {
+        *cx *= ecc;                          // ecc*cos(x)
+        *sx *= ecc;                          // ecc*sin(x)
+    } // end if
+
+    return;
+} // end kes_sincos_fast
+
+/******************************************************************************/
+
+/*******************************************************************************
+ *  FUNCTION    : kes_sinhcosh
+ *  DESCRIPTION : calculate the values of functions sinh(x) and cosh(x) from
+ *                a single exponential, fallback to the standard library for
+ *                huge arguments
+ *  NOTE          if "ecc" <  0, then sinh(x), cosh(x) are returned,
+ *                if "ecc" >= 0, then ecc*sinh(x), ecc*cosh(x) are returned
+ *  INPUT       : - pointer to sinh(x), cosh(x)
+ *                - argument x
+ *                - eccentricity ecc
+ *  OUTPUT      : none
+ *  REFERENCE   : see kes_vec_sinhcoshm() in vecmath.h
+ ******************************************************************************/
+inline void kes_sinhcosh(
+    double*      shx,
+    double*      chx,
+    const double x,
+    const double ecc
+    )
+{
+    if ( fabs(x) < KES_VEC_SINHCOSH_MAX )
+    {
+        kes_vec_sinhcoshm( shx, chx, x );    // sinh(x) - x, cosh(x) - 1
+        *shx += x;
+        *chx += 1.0;
+    } // end if
+    else
+    {
+        *shx = sinh(x);
+        *chx = cosh(x);
+    } // end else
+
+    if ( ecc >= 0.0 )
+    {
+        *chx *= ecc;                         // ecc*cosh(x)
+        *shx *= ecc;                         // ecc*sinh(x)
+    } // end if
+
+    return;
+} // end kes_sinhcosh
+
+/******************************************************************************/
+
 /*******************************************************************************
  *  FUNCTION    : kes_trueanom
  *  DESCRIPTION : calculate the true anomaly for elliptic or hyperbolic case
  *  INPUT       : - eccentricity ecc
  *                - angle x (in radians) ... solution of Kepler's equation for
- *                  elliptic or hyperbolic eccentric anomaly
+ *                  elliptic or hyperbolic eccentric anomaly, or true anomaly
+ *                  in the parabolic case (returned unchanged)
  *  OUTPUT      : true anomaly (in radians)
  ******************************************************************************/
 inline double kes_trueanom(
@@ -207,7 +509,13 @@ inline double kes_trueanom(
     const double x
     )
 {
-    /* TODO FIXME kes_check_ecc() for KES_ECC_CIRC or KES_ECC_PAR */
+    kes_err_e status;
+
+    /* parabolic case: kesolver() returns the true anomaly */
+    if ( kes_check_ecc( ecc, &status ) == KES_ECC_PAR )
+    {
+        return( x );
+    } // end if
 
     if ( ecc < 1.0 )
     {
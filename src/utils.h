@@ -27,6 +27,9 @@
 #ifndef KES_UTILS__H
 #define KES_UTILS__H
 
+/* include standard headers */
+#include <stddef.h>
+
 /* include module headers */
 #include "error.h"
 
@@ -48,6 +51,82 @@ typedef enum
     KES_ECC_HYP      ///< hyperbolic case : e > 1
 } kes_ecc_e;
 
+
+/*!
+ * @brief accuracy tiers for trigonometric functions
+ * @details selects the sin/cos kernel used by the iteration methods,
+ * see kes_set_trig()
+ */
+typedef enum
+{
+    KES_TRIG_FULL = 0, ///< full accuracy, about 1 ulp (default)
+    KES_TRIG_FAST,     ///< reduced accuracy, about 1E-12, for early iterations
+
+    KES_TRIG_TOTAL     ///< total number of accuracy tiers
+} kes_trig_e;
+
+
+/*!
+ * @brief convergence tests of the iteration methods
+ * @details selects when the residual of the Kepler Equation is evaluated,
+ * see kes_set_conv()
+ */
+typedef enum
+{
+    KES_CONV_FULL = 0, ///< residual of each new iterate (default)
+    KES_CONV_LEAN,     ///< residual of the previous iterate from the step
+
+    KES_CONV_TOTAL     ///< total number of convergence tests
+} kes_conv_e;
+
+/******************************************************************************/
+
+/*!
+ * @brief stopping rules of the iteration methods
+ * @details selects if the known order of convergence predicts the error of
+ * the next iterate, and the tolerance it is compared to, see kes_set_stop()
+ */
+typedef enum
+{
+    KES_STOP_DELTA = 0, ///< observe |x(n+1)-x(n)| <= tolx (default)
+    KES_STOP_ORDER,     ///< predicted error of x(n+1) <= tolx
+    KES_STOP_ORDER_REL, ///< predicted error of x(n+1) <= tolx * |x(n+1)|
+    KES_STOP_ORDER_ULP, ///< same with tolx/DBL_EPSILON ulp of x(n+1)
+
+    KES_STOP_TOTAL      ///< total number of stopping rules
+} kes_stop_e;
+
+
+/*!
+ * @brief orders of partial derivatives of the solution
+ * @details selects which partial derivatives of the eccentric anomaly are
+ * returned with the solution, see kes_set_deriv()
+ */
+typedef enum
+{
+    KES_DERIV_NONE = 0, ///< no derivatives (default)
+    KES_DERIV_FIRST,    ///< dE/dM and dE/de
+    KES_DERIV_SECOND,   ///< also d2E/dM2, d2E/dMde and d2E/de2
+
+    KES_DERIV_TOTAL     ///< total number of derivative orders
+} kes_deriv_e;
+
+
+/*!
+ * @brief starter methods for the hyperbolic Kepler Equation
+ * @details selects the starting value of the hyperbolic solvers, see
+ * kes_set_hstarter() and kes_starter_hyp()
+ */
+typedef enum
+{
+    KES_HSTM_BOUND = 0, ///< smaller of cubic and asinh upper bound (default)
+    KES_HSTM_CUBIC,     ///< cubic approximation, upper bound for small H
+    KES_HSTM_ASINH,     ///< two fixed-point steps of asinh, lower bound
+    KES_HSTM_LOG,       ///< logarithm for large M from Danby (1987)
+
+    KES_HSTM_TOTAL      ///< total number of hyperbolic starter methods
+} kes_hstm_e;
+
 /******************************************************************************/
 
 /*** function declarations ***/
@@ -78,12 +157,71 @@ kes_err_e kes_check_val(const double x);
 
 /*!
  * @brief reduce input angle to range [-pi:pi]
+ * @details x - k*2*pi with nearest integer k, from a multiplication by
+ * 1/(2*pi) and 2*pi split into four parts (Cody-Waite), i.e. exact up to
+ * the rounding of the result for |x| < 2^27 * 2*pi (about 8.4E8), larger
+ * angles are reduced by sin() and cos() of the C library; NAN and INF are
+ * returned unchanged
  * @param x angle (in radians)
  * @return reduced angle
  */
 double kes_reduce(double x);
 
 
+/*!
+ * @brief reduce mean anomaly M = n*t to range [-pi:pi]
+ * @details same as kes_reduce(), but M is the exact product of mean motion
+ * and time, i.e. without the rounding error of n*t, which exceeds 1E-10
+ * once M grows to about 1E6
+ * @param mm mean motion n (in radians per unit of time)
+ * @param t time since perihelion passage
+ * @return reduced mean anomaly (in radians)
+ */
+double kes_reduce_nt(
+    const double mm,
+    const double t
+);
+
+
+/*!
+ * @brief reduce arrays of mean anomalies to range [-pi:pi]
+ * @details same results as kes_reduce() for each element, vectorized
+ * @param[in] n number of elements
+ * @param[in] ma array of n mean anomalies (in radians)
+ * @param[out] redma array of n reduced mean anomalies, may be \a ma
+ * @return error code from enum #kes_err_e, KES_ERR_BADVAL if any mean
+ * anomaly is NAN or INF (returned unchanged)
+ */
+kes_err_e kes_reduce_batch(
+    const size_t  n,
+    const double* ma,
+    double*       redma
+);
+
+
+/*!
+ * @brief reduce arrays of mean anomalies M = n*t to range [-pi:pi]
+ * @details same results as kes_reduce_nt() for each element, vectorized;
+ * the products n*t are exact by Dekker's method, i.e. without fused
+ * multiply-add; use with the batch solvers for long propagations
+ * @param[in] n number of elements
+ * @param[in] mm array of mean motions (in radians per unit of time)
+ * @param[in] incmm stride of mm: 1 for one mean motion per element, 0 for
+ * a common mean motion mm[0]
+ * @param[in] t array of n times since perihelion passage
+ * @param[out] redma array of n reduced mean anomalies, may be \a t
+ * @return error code from enum #kes_err_e, KES_ERR_BADVAL if any product
+ * n*t is NAN or INF (returned unchanged)
+ */
+kes_err_e kes_reduce_nt_batch(
+    const size_t  n,
+    const double* mm,
+    const size_t  incmm,
+    const double* t,
+    double*       redma
+);
+
+
 /*!
  * @brief calculate sin(x) and cos(x) simultaneously
  * @details if parameter \a ecc < 0 then returns {sin(x), cos(x)};
@@ -102,10 +240,47 @@ void kes_sincos(
 );
 
 
+/*!
+ * @brief calculate sinh(x) and cosh(x) simultaneously
+ * @details if parameter \a ecc < 0 then returns {sinh(x), cosh(x)};
+ * if parameter \a ecc >= 0 then returns {ecc*sinh(x), ecc*cosh(x)};
+ * both from a single exponential, accurate to a few ulp
+ * @param[out] shx pointer for sinh(x)
+ * @param[out] chx pointer for cosh(x)
+ * @param[in] x input value
+ * @param[in] ecc eccentricity
+ * @return sinh(x), cosh(x)
+ */
+void kes_sinhcosh(
+    double*      shx,
+    double*      chx,
+    const double x,
+    const double ecc
+);
+
+
+/*!
+ * @brief calculate sin(x) and cos(x) simultaneously with reduced accuracy
+ * @details same as kes_sincos(), but absolute error is about 1E-12
+ * @param[out] sx pointer for sin(x)
+ * @param[out] cx pointer for cos(x)
+ * @param[in] x input value
+ * @param[in] ecc eccentricity
+ * @return sin(x), cos(x)
+ */
+void kes_sincos_fast(
+    double*      sx,
+    double*      cx,
+    const double x,
+    const double ecc
+);
+
+
 /*!
  * @brief calculate the true anomaly for the elliptic or hyperbolic case
  * @param[in] ecc eccentricity
- * @param[in] x elliptic or hyperbolic eccentric anomaly (in radians)
+ * @param[in] x elliptic or hyperbolic eccentric anomaly (in radians); in the
+ *              parabolic case the true anomaly, which is returned unchanged
  * @return true anomaly (in radians)
  */
 double kes_trueanom(
@@ -0,0 +1,894 @@
+/***************************************************************************//**
+ * @file    vecmath.h
+ * @brief   branch-free math kernels for vectorized solver functions
+ * @details all functions are written without data-dependent branches and
+ *          without calls to the math library, so that loops over them can
+ *          be vectorized by the compiler
+ * @author  Bazso Akos
+ * @version 2026.10
+ *
+ * @copyright
+ * Copyright (C) 2019 Bazso Akos
+ *
+ * This file is part of libkes.
+ *
+ * libkes is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * libkes is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with libkes.  If not, see <https://www.gnu.org/licenses/>.
+ *
+ ******************************************************************************/
+#pragma once
+#ifndef KES_VECMATH__H
+#define KES_VECMATH__H
+
+/* include standard headers */
+#include <math.h>
+#include <stdint.h>
+#include <string.h>
+
+/******************************************************************************/
+
+/*** internal constants ***/
+
+/* 1.5 * 2^52: adding and subtracting rounds to nearest integer */
+#define KES_VEC_RNDMAGIC  6755399441055744.0
+
+/* 2 / pi */
+#define KES_VEC_2_PI      0.636619772367581343075535053490057448
+
+/* pi/2 split into three parts (after fdlibm's __ieee754_rem_pio2) */
+#define KES_VEC_PIO2_1    1.57079632673412561417e+00 /* first 33 bits   */
+#define KES_VEC_PIO2_2    6.07710050630396597660e-11 /* second 33 bits  */
+#define KES_VEC_PIO2_2T   2.02226624879595063154e-21 /* pi/2 - (1 + 2) */
+
+/* upper bound of |x| for accurate argument reduction: 2^20 * pi/2 */
+#define KES_VEC_SINCOS_MAX 1647099.3291652855
+
+/* 1 / (2*pi) */
+#define KES_VEC_1_2PI     1.59154943091895345608e-01
+
+/* 2*pi split into four parts of 26 bits (Cody & Waite), k * part is exact
+ * for integers |k| < 2^27
+ */
+#define KES_VEC_2PI_1     6.28318524360656738281e+00 /* first 26 bits   */
+#define KES_VEC_2PI_2     6.35730188491834269371e-08 /* second 26 bits  */
+#define KES_VEC_2PI_3     2.44929357282143770041e-16 /* third 26 bits   */
+#define KES_VEC_2PI_4     2.54732682209011309897e-24 /* fourth 26 bits  */
+
+/* upper bound of |x| for exact reduction modulo 2*pi: 2^27 * 2*pi */
+#define KES_VEC_REDUCE_MAX 843314856.532626152039
+
+/* 1 / ln(2) */
+#define KES_VEC_1_LN2     1.44269504088896338700e+00
+
+/* ln(2) split into two parts (after fdlibm's __ieee754_exp) */
+#define KES_VEC_LN2_HI    6.93147180369123816490e-01 /* first 32 bits   */
+#define KES_VEC_LN2_LO    1.90821492927058770002e-10 /* ln2 - hi       */
+
+/* upper bound of |x| for sinh(x), cosh(x) without overflow */
+#define KES_VEC_SINHCOSH_MAX 710.0
+
+/* smallest positive normal number DBL_MIN = 2^-1022 */
+#define KES_VEC_DBL_MIN   2.22507385850720138309e-308
+
+/* pi/2 split into two parts (after fdlibm's atan) */
+#define KES_VEC_PIO2_HI   1.57079632679489655800e+00
+#define KES_VEC_PIO2_LO   6.12323399573676603587e-17
+
+/* 1.5 * 2^23: adding and subtracting rounds to nearest integer (float) */
+#define KES_VEC_RNDMAGICF 12582912.0f
+
+/* pi/2 split into three parts of type float (after Cephes' sinf) */
+#define KES_VEC_PIO2F_1   1.5703125f                 /* first 8 bits    */
+#define KES_VEC_PIO2F_2   4.837512969970703125E-4f   /* second 11 bits  */
+#define KES_VEC_PIO2F_3   7.54978995489188216E-8f    /* pi/2 - (1 + 2) */
+
+/* upper bound of |x| for accurate argument reduction of type float */
+#define KES_VEC_SINCOSF_MAX 8192.0f
+
+/******************************************************************************/
+
+/*******************************************************************************
+ *  FUNCTION    : kes_vec_quadrant
+ *  DESCRIPTION : map sin(r), cos(r) of the reduced argument r = x - k * pi/2
+ *                to sin(x), cos(x); odd quadrants swap sin and cos, signs
+ *                follow from quadrant number
+ *  INPUT       : - pointer to sin(x), cos(x)
+ *                - polynomial approximations "ps" = sin(r), "pc" = cos(r)
+ *                - lower bits "q" of quadrant number k
+ *  OUTPUT      : none
+ *  NOTE bit masks instead of conditional expressions, compilers need 64-bit
+ *       integer comparisons (SSE4.1) to vectorize those
+ ******************************************************************************/
+static inline void kes_vec_quadrant(
+    double*        sx,
+    double*        cx,
+    const double   ps,
+    const double   pc,
+    const uint64_t q
+    )
+{
+    uint64_t bs, bc;
+    memcpy( &bs, &ps, sizeof(bs) );
+    memcpy( &bc, &pc, sizeof(bc) );
+
+    /* all bits set for odd quadrants, zero otherwise */
+    const uint64_t swap = (uint64_t)0 - (q & 1);
+    uint64_t       us   = (bc & swap) | (bs & ~swap);
+    uint64_t       uc   = (bs & swap) | (bc & ~swap);
+
+    /* flip sign bits */
+    us ^= ((q    ) & 2) << 62;
+    uc ^= ((q + 1) & 2) << 62;
+    memcpy( sx, &us, sizeof(us) );
+    memcpy( cx, &uc, sizeof(uc) );
+
+    return;
+} // end kes_vec_quadrant
+
+/******************************************************************************/
+
+/*******************************************************************************
+ *  FUNCTION    : kes_vec_quadrantf
+ *  DESCRIPTION : same as kes_vec_quadrant() for values of type float
+ *  INPUT       : - pointer to sin(x), cos(x)
+ *                - polynomial approximations "ps" = sin(r), "pc" = cos(r)
+ *                - lower bits "q" of quadrant number k
+ *  OUTPUT      : none
+ ******************************************************************************/
+static inline void kes_vec_quadrantf(
+    float*         sx,
+    float*         cx,
+    const float    ps,
+    const float    pc,
+    const uint32_t q
+    )
+{
+    uint32_t bs, bc;
+    memcpy( &bs, &ps, sizeof(bs) );
+    memcpy( &bc, &pc, sizeof(bc) );
+
+    /* all bits set for odd quadrants, zero otherwise */
+    const uint32_t swap = (uint32_t)0 - (q & 1);
+    uint32_t       us   = (bc & swap) | (bs & ~swap);
+    uint32_t       uc   = (bs & swap) | (bc & ~swap);
+
+    /* flip sign bits */
+    us ^= ((q    ) & 2) << 30;
+    uc ^= ((q + 1) & 2) << 30;
+    memcpy( sx, &us, sizeof(us) );
+    memcpy( cx, &uc, sizeof(uc) );
+
+    return;
+} // end kes_vec_quadrantf
+
+/******************************************************************************/
+
+/*******************************************************************************
+ *  FUNCTION    : kes_vec_sincos
+ *  DESCRIPTION : calculate sin(x) and cos(x) simultaneously,
+ *                accurate to about 1 ulp for |x| < 2^20 * pi/2
+ *  INPUT       : - pointer to sin(x), cos(x)
+ *                - angle x (in radians)
+ *  OUTPUT      : none
+ *  REFERENCE   : minimax polynomials on [-pi/4:pi/4] from fdlibm
+ *                (__kernel_sin, __kernel_cos)
+ ******************************************************************************/
+static inline void kes_vec_sincos(
+    double*      sx,
+    double*      cx,
+    const double x
+    )
+{
+    /* coefficients for sin(r) = r + r^3 * P(r^2) */
+    static const double s1 = -1.66666666666666324348e-01;
+    static const double s2 =  8.33333333332248946124e-03;
+    static const double s3 = -1.98412698298579493134e-04;
+    static const double s4 =  2.75573137070700676789e-06;
+    static const double s5 = -2.50507602534068634195e-08;
+    static const double s6 =  1.58969099521155010221e-10;
+
+    /* coefficients for cos(r) = 1 - r^2/2 + r^4 * Q(r^2) */
+    static const double c1 =  4.16666666666666019037e-02;
+    static const double c2 = -1.38888888888741095749e-03;
+    static const double c3 =  2.48015872894767294178e-05;
+    static const double c4 = -2.75573143513906633035e-07;
+    static const double c5 =  2.08757232129817482790e-09;
+    static const double c6 = -1.13596475577881948265e-11;
+
+    /* quadrant k = round(x / (pi/2)), integer part kept in lower bits of t */
+    const double t = x * KES_VEC_2_PI + KES_VEC_RNDMAGIC;
+    const double k = t - KES_VEC_RNDMAGIC;
+    uint64_t     q;
+    memcpy( &q, &t, sizeof(q) );
+
+    /* reduced argument r = x - k * pi/2 with |r| <= pi/4 */
+    const double r  = ((x - k * KES_VEC_PIO2_1) - k * KES_VEC_PIO2_2)
+                      - k * KES_VEC_PIO2_2T;
+    const double z  = r * r;
+
+    /* polynomial approximations on [-pi/4:pi/4] */
+    const double ps = r + r * z * (s1 + z * (s2 + z * (s3 + z * (s4 +
+                      z * (s5 + z * s6)))));
+    const double hz = 0.5 * z;
+    const double w  = 1.0 - hz;
+    const double pc = w + (((1.0 - w) - hz) + z * z * (c1 + z * (c2 +
+                      z * (c3 + z * (c4 + z * (c5 + z * c6))))));
+
+    /* odd quadrants swap sin and cos, signs follow from quadrant number */
+    kes_vec_quadrant( sx, cx, ps, pc, q );
+
+    return;
+} // end kes_vec_sincos
+
+/******************************************************************************/
+
+/*******************************************************************************
+ *  FUNCTION    : kes_vec_sincos_fast
+ *  DESCRIPTION : calculate sin(x) and cos(x) simultaneously with reduced
+ *                accuracy, absolute error below 1E-12 for |x| < 2^20 * pi/2
+ *  INPUT       : - pointer to sin(x), cos(x)
+ *                - angle x (in radians)
+ *  OUTPUT      : none
+ *  REFERENCE   : polynomials of degree 11 (sin) and 8 (cos) interpolating
+ *                in the zeros of Chebyshev polynomials on [-pi/4:pi/4]
+ ******************************************************************************/
+static inline void kes_vec_sincos_fast(
+    double*      sx,
+    double*      cx,
+    const double x
+    )
+{
+    /* coefficients for sin(r) = r + r^3 * P(r^2) */
+    static const double s1 = -1.66666666666638846328e-01;
+    static const double s2 =  8.33333333107922312466e-03;
+    static const double s3 = -1.98412669169859657648e-04;
+    static const double s4 =  2.75559909295653188103e-06;
+    static const double s5 = -2.48056362418347624592e-08;
+
+    /* coefficients for cos(r) = 1 - r^2/2 + r^4 * Q(r^2) */
+    static const double c1 =  4.16666666643212002530e-02;
+    static const double c2 = -1.38888876720167893722e-03;
+    static const double c3 =  2.48006003771567283848e-05;
+    static const double c4 = -2.73009592039014691404e-07;
+
+    /* quadrant k = round(x / (pi/2)), integer part kept in lower bits of t */
+    const double t = x * KES_VEC_2_PI + KES_VEC_RNDMAGIC;
+    const double k = t - KES_VEC_RNDMAGIC;
+    uint64_t     q;
+    memcpy( &q, &t, sizeof(q) );
+
+    /* reduced argument r = x - k * pi/2, two parts of pi/2 are sufficient */
+    const double r  = (x - k * KES_VEC_PIO2_1) - k * KES_VEC_PIO2_2;
+    const double z  = r * r;
+
+    /* polynomial approximations on [-pi/4:pi/4] */
+    const double ps = r + r * z * (s1 + z * (s2 + z * (s3 + z * (s4 +
+                      z * s5))));
+    const double pc = 1.0 - 0.5 * z + z * z * (c1 + z * (c2 + z * (c3 +
+                      z * c4)));
+
+    /* odd quadrants swap sin and cos, signs follow from quadrant number */
+    kes_vec_quadrant( sx, cx, ps, pc, q );
+
+    return;
+} // end kes_vec_sincos_fast
+
+/******************************************************************************/
+
+/*******************************************************************************
+ *  FUNCTION    : kes_vec_blend
+ *  DESCRIPTION : select one of two values by the sign bit of a condition,
+ *                branch-free replacement of (c < 0.0) ? a : b
+ *  INPUT       : - condition "c"
+ *                - values "a", "b"
+ *  OUTPUT      : a if the sign bit of c is set, b otherwise
+ *  NOTE floating point comparisons in conditional expressions may raise
+ *       exceptions, compilers keep them behind jumps and do not vectorize
+ ******************************************************************************/
+static inline double kes_vec_blend(
+    const double c,
+    const double a,
+    const double b
+    )
+{
+    uint64_t mask, ba, bb;
+    double   res;
+
+    memcpy( &mask, &c, sizeof(mask) );
+    memcpy( &ba,   &a, sizeof(ba) );
+    memcpy( &bb,   &b, sizeof(bb) );
+
+    /* all bits set if c is negative, zero otherwise */
+    mask = (uint64_t)0 - (mask >> 63);
+    ba   = (ba & mask) | (bb & ~mask);
+    memcpy( &res, &ba, sizeof(res) );
+
+    return( res );
+} // end kes_vec_blend
+
+/******************************************************************************/
+
+/*******************************************************************************
+ *  FUNCTION    : kes_vec_blendf
+ *  DESCRIPTION : same as kes_vec_blend() for values of type float
+ *  INPUT       : - condition "c"
+ *                - values "a", "b"
+ *  OUTPUT      : a if the sign bit of c is set, b otherwise
+ ******************************************************************************/
+static inline float kes_vec_blendf(
+    const float c,
+    const float a,
+    const float b
+    )
+{
+    uint32_t mask, ba, bb;
+    float    res;
+
+    memcpy( &mask, &c, sizeof(mask) );
+    memcpy( &ba,   &a, sizeof(ba) );
+    memcpy( &bb,   &b, sizeof(bb) );
+
+    /* all bits set if c is negative, zero otherwise */
+    mask = (uint32_t)0 - (mask >> 31);
+    ba   = (ba & mask) | (bb & ~mask);
+    memcpy( &res, &ba, sizeof(res) );
+
+    return( res );
+} // end kes_vec_blendf
+
+/******************************************************************************/
+
+/*******************************************************************************
+ *  FUNCTION    : kes_vec_sqrt
+ *  DESCRIPTION : calculate the square root of x >= 0, accurate to about 1 ulp
+ *                for finite x (including subnormal numbers and zero)
+ *  INPUT       : argument x
+ *  OUTPUT      : sqrt(x)
+ *  REFERENCE   : 5 bit starter of 1/sqrt(x) from the exponent, three Newton
+ *                steps of 1/sqrt(x) and a final Newton step of sqrt(x)
+ *  NOTE the C library function sqrt() sets errno for x < 0, compilers keep
+ *       the call behind a branch and do not vectorize it
+ ******************************************************************************/
+static inline double kes_vec_sqrt(
+    const double x
+    )
+{
+    /* scale subnormal numbers by 2^54, i.e. the result by 2^27 */
+    const double up = kes_vec_blend( x - KES_VEC_DBL_MIN,
+                                     18014398509481984.0, 1.0 );
+    const double dn = kes_vec_blend( x - KES_VEC_DBL_MIN,
+                                     7.450580596923828125E-9, 1.0 );
+    const double sx = x * up;
+
+    /* starter of y = 1/sqrt(x) with a relative error below 3.5% */
+    uint64_t     bits;
+    memcpy( &bits, &sx, sizeof(bits) );
+    bits = (uint64_t)0x5fe6eb50c7b537a9u - (bits >> 1);
+    double       y;
+    memcpy( &y, &bits, sizeof(y) );
+
+    /* Newton steps y = y * (3 - x * y^2) / 2, relative error below 4E-11 */
+    const double hx = 0.5 * sx;
+    y *= 1.5 - hx * y * y;
+    y *= 1.5 - hx * y * y;
+    y *= 1.5 - hx * y * y;
+
+    /* Newton step of s = sqrt(x), NOTE x = 0 gives s = 0 */
+    const double s = sx * y;
+
+    return( (s + 0.5 * y * (sx - s * s)) * dn );
+} // end kes_vec_sqrt
+
+/******************************************************************************/
+
+/*******************************************************************************
+ *  FUNCTION    : kes_vec_cbrt
+ *  DESCRIPTION : calculate the real cube root of x, accurate to about 1 ulp
+ *                for finite x (including subnormal numbers and zero)
+ *  INPUT       : argument x
+ *  OUTPUT      : cbrt(x)
+ *  REFERENCE   : 5 bit starter from the exponent, polynomial refinement to
+ *                23 bits and one Newton step (after FreeBSD's s_cbrt.c)
+ *  NOTE the starter divides the upper 32 bits by 3, compilers vectorize this
+ *       as multiplication, not so a 64-bit integer division
+ ******************************************************************************/
+static inline double kes_vec_cbrt(
+    const double x
+    )
+{
+    /* bias of exponent in upper 32 bits: (1023 - 1023/3 - 0.03306235651)
+     * * 2^20, chosen such that the error of the starter is below 2^-5
+     */
+    static const uint32_t B1 = 715094163u;
+
+    /* coefficients of the polynomial refinement */
+    static const double P0 =  1.87595182427177009643e+00;
+    static const double P1 = -1.88497979543377169875e+00;
+    static const double P2 =  1.62142972010535446614e+00;
+    static const double P3 = -7.58397934778766047437e-01;
+    static const double P4 =  1.45996192886612446982e-01;
+
+    /* scale subnormal numbers by 2^54, i.e. the result by 2^18 */
+    const double ax  = fabs(x);
+    const double up  = kes_vec_blend( ax - KES_VEC_DBL_MIN, 18014398509481984.0,
+                                      1.0 );
+    const double dn  = kes_vec_blend( ax - KES_VEC_DBL_MIN, 3.814697265625E-6,
+                                      1.0 );
+    const double sx  = ax * up;
+
+    /* starter: divide exponent by 3 */
+    uint64_t     bits;
+    memcpy( &bits, &sx, sizeof(bits) );
+    const uint64_t hi = (uint64_t)((uint32_t)(bits >> 32) / 3u + B1) << 32;
+    double       t;
+    memcpy( &t, &hi, sizeof(t) );
+
+    /* polynomial refinement to 23 bits, NOTE zero gives NaN, masked below */
+    double       r   = (t * t) * (t / sx);
+    t *= (P0 + r * (P1 + r * P2)) + ((r * r) * r) * (P3 + r * P4);
+
+    /* round t away from zero to 23 bits, such that t^2 is exact */
+    memcpy( &bits, &t, sizeof(bits) );
+    bits = (bits + 0x80000000u) & 0xffffffffc0000000u;
+    memcpy( &t, &bits, sizeof(t) );
+
+    /* one Newton step to 53 bits */
+    const double s   = t * t;
+    r = sx / s;
+    r = (r - t) / (t + t + r);
+    t = (t + t * r) * dn;
+
+    /* all bits cleared for x = +-0, set otherwise */
+    memcpy( &bits, &ax, sizeof(bits) );
+    const uint64_t mask = (uint64_t)0 - (((uint64_t)0 - bits) >> 63);
+    memcpy( &bits, &t, sizeof(bits) );
+    bits &= mask;
+    memcpy( &t, &bits, sizeof(t) );
+
+    return( copysign( t, x ) );
+} // end kes_vec_cbrt
+
+/******************************************************************************/
+
+/*******************************************************************************
+ *  FUNCTION    : kes_vec_atan2
+ *  DESCRIPTION : calculate the angle atan2(y,x) in [-pi:pi] of the point
+ *                (x,y), accurate to about 2 ulp for finite x, y
+ *  INPUT       : - ordinate y
+ *                - abscissa x
+ *  OUTPUT      : atan2(y,x) (in radians)
+ *  REFERENCE   : minimax polynomial for |t| < 7/16 and the reduction to
+ *                atan(0.5) and atan(1) from fdlibm (s_atan.c)
+ *  NOTE atan2(+-0,+-0) gives +-0 or +-pi, as in the C library
+ ******************************************************************************/
+static inline double kes_vec_atan2(
+    const double y,
+    const double x
+    )
+{
+    /* hi and lo parts of atan(0.5), atan(1) */
+    static const double atanhi[3] = {
+        0.0, 4.63647609000806093515e-01, 7.85398163397448278999e-01
+    };
+    static const double atanlo[3] = {
+        0.0, 2.26987774529616870924e-17, 3.06161699786838301793e-17
+    };
+
+    /* coefficients of atan(t) = t - t^3 * P(t^2) */
+    static const double aT0  =  3.33333333333329318027e-01;
+    static const double aT1  = -1.99999999998764832476e-01;
+    static const double aT2  =  1.42857142725034663711e-01;
+    static const double aT3  = -1.11111104054623557880e-01;
+    static const double aT4  =  9.09088713343650656196e-02;
+    static const double aT5  = -7.69187620504482999495e-02;
+    static const double aT6  =  6.66107313738753120669e-02;
+    static const double aT7  = -5.83357013379057348645e-02;
+    static const double aT8  =  4.97687799461593236017e-02;
+    static const double aT9  = -3.65315727442169155270e-02;
+    static const double aT10 =  1.62858201153657823623e-02;
+
+    /* angle a = atan(u/v) in [0:pi/4] with u = min(|x|,|y|), v = max() */
+    const double ax = fabs(x);
+    const double ay = fabs(y);
+    const double u  = kes_vec_blend( ay - ax, ay, ax );
+    const double v  = kes_vec_blend( ay - ax, ax, ay );
+
+    /* reduction of u/v in [0:7/16], [7/16:11/16], [11/16:1] to |t| < 7/16,
+     * the tiny terms select the first range and t = 0/1 for x = y = 0
+     * NOTE DBL_MIN instead of subnormal numbers, operations with those are
+     *      slow on most processors
+     */
+    const double c1 = (16.0 * u - 7.0 * v) - KES_VEC_DBL_MIN;
+    const double c2 = (16.0 * u - 11.0 * v) - KES_VEC_DBL_MIN;
+    const double tn = kes_vec_blend( c1, u, kes_vec_blend( c2, 2.0 * u - v,
+                                                           u - v ) );
+    const double td = kes_vec_blend( c1, v, kes_vec_blend( c2, 2.0 * v + u,
+                                                           v + u ) );
+    const double hi = kes_vec_blend( c1, atanhi[0], kes_vec_blend( c2,
+                                     atanhi[1], atanhi[2] ) );
+    const double lo = kes_vec_blend( c1, atanlo[0], kes_vec_blend( c2,
+                                     atanlo[1], atanlo[2] ) );
+    const double t  = tn / kes_vec_blend( 0.0 - td, td, 1.0 );
+
+    /* polynomial split in even and odd terms */
+    const double z  = t * t;
+    const double w  = z * z;
+    const double s1 = z * (aT0 + w * (aT2 + w * (aT4 + w * (aT6 +
+                      w * (aT8 + w * aT10)))));
+    const double s2 = w * (aT1 + w * (aT3 + w * (aT5 + w * (aT7 +
+                      w * aT9))));
+    double       a  = hi - ((t * (s1 + s2) - lo) - t);
+
+    /* octants: atan(|y|/|x|) = pi/2 - a for |y| > |x|, then pi - a for
+     * negative x (including -0) and finally sign of y
+     */
+    a = kes_vec_blend( ax - ay, (KES_VEC_PIO2_HI - a) + KES_VEC_PIO2_LO, a );
+    a = kes_vec_blend( x, (2.0 * KES_VEC_PIO2_HI - a) + 2.0 * KES_VEC_PIO2_LO,
+                       a );
+
+    return( copysign( a, y ) );
+} // end kes_vec_atan2
+
+/******************************************************************************/
+
+/*******************************************************************************
+ *  FUNCTION    : kes_vec_reduce2
+ *  DESCRIPTION : reduce an angle x + xlo, given as sum of a double and a
+ *                small correction, to the interval [-pi:pi]
+ *  INPUT       : - angle x (|x| < KES_VEC_REDUCE_MAX)
+ *                - correction xlo (|xlo| <= ulp(x))
+ *  OUTPUT      : x + xlo - k * 2*pi with nearest integer k (in radians),
+ *                accurate to about 1 ulp of pi
+ *  REFERENCE   : Cody & Waite (1980), k from a multiplication by 1/(2*pi),
+ *                2*pi split into four parts with exact products k * part
+ ******************************************************************************/
+static inline double kes_vec_reduce2(
+    const double x,
+    const double xlo
+    )
+{
+    /* k = round(x / (2*pi)), NOTE x - k * part1 is exact */
+    const double k = (x * KES_VEC_1_2PI + KES_VEC_RNDMAGIC) - KES_VEC_RNDMAGIC;
+    double       r = (((x - k * KES_VEC_2PI_1) - k * KES_VEC_2PI_2) -
+                      k * KES_VEC_2PI_3) - k * KES_VEC_2PI_4;
+    r += xlo;
+
+    /* the rounded quotient may miss by one close to odd multiples of pi */
+    const double pi = 2.0 * KES_VEC_PIO2_HI;
+    r = kes_vec_blend( pi - r, (r - KES_VEC_2PI_1) - KES_VEC_2PI_2, r );
+    r = kes_vec_blend( r + pi, (r + KES_VEC_2PI_1) + KES_VEC_2PI_2, r );
+
+    return( r );
+} // end kes_vec_reduce2
+
+/******************************************************************************/
+
+/*******************************************************************************
+ *  FUNCTION    : kes_vec_reduce
+ *  DESCRIPTION : reduce an angle to the interval [-pi:pi]
+ *  INPUT       : angle x (|x| < KES_VEC_REDUCE_MAX)
+ *  OUTPUT      : x - k * 2*pi with nearest integer k (in radians)
+ ******************************************************************************/
+static inline double kes_vec_reduce(
+    const double x
+    )
+{
+    return( kes_vec_reduce2( x, 0.0 ) );
+} // end kes_vec_reduce
+
+/******************************************************************************/
+
+/*******************************************************************************
+ *  FUNCTION    : kes_vec_mul2
+ *  DESCRIPTION : exact product of two doubles as unevaluated sum p + q
+ *  INPUT       : - factors a, b (|a * b| < 2^996)
+ *                - pointer to low part q of the product
+ *  OUTPUT      : rounded product p = a * b
+ *  REFERENCE   : Dekker (1971), factors split into halves of 26 bits by
+ *                Veltkamp's method, i.e. without a fused multiply-add
+ ******************************************************************************/
+static inline double kes_vec_mul2(
+    const double a,
+    const double b,
+    double*      q
+    )
+{
+    static const double split = 134217729.0; /* 2^27 + 1 */
+
+    const double p  = a * b;
+    const double ca = split * a;
+    const double ah = ca - (ca - a);
+    const double al = a - ah;
+    const double cb = split * b;
+    const double bh = cb - (cb - b);
+    const double bl = b - bh;
+
+    *q = (((ah * bh - p) + ah * bl) + al * bh) + al * bl;
+
+    return( p );
+} // end kes_vec_mul2
+
+/******************************************************************************/
+
+/*******************************************************************************
+ *  FUNCTION    : kes_vec_sinhcoshm
+ *  DESCRIPTION : calculate sinh(x) - x and cosh(x) - 1 simultaneously,
+ *                without cancellation for small |x|, such that
+ *                sinh(x), cosh(x) are accurate to a few ulp for |x| <= 710
+ *  INPUT       : - pointer to sinh(x) - x, cosh(x) - 1
+ *                - argument x (larger values of |x| are clamped)
+ *  OUTPUT      : none
+ *  REFERENCE   : exp(|x|)/2 from Taylor polynomial of degree 13 on
+ *                [-ln2/2:ln2/2], Taylor series for |x| < 1
+ ******************************************************************************/
+static inline void kes_vec_sinhcoshm(
+    double*      shm,
+    double*      chm,
+    const double x
+    )
+{
+    /* coefficients 1/n! of Taylor polynomials */
+    static const double p2  = 1.0 / 2.0;
+    static const double p3  = 1.0 / 6.0;
+    static const double p4  = 1.0 / 24.0;
+    static const double p5  = 1.0 / 120.0;
+    static const double p6  = 1.0 / 720.0;
+    static const double p7  = 1.0 / 5040.0;
+    static const double p8  = 1.0 / 40320.0;
+    static const double p9  = 1.0 / 362880.0;
+    static const double p10 = 1.0 / 3628800.0;
+    static const double p11 = 1.0 / 39916800.0;
+    static const double p12 = 1.0 / 479001600.0;
+    static const double p13 = 1.0 / 6227020800.0;
+    static const double p14 = 1.0 / 87178291200.0;
+    static const double p15 = 1.0 / 1307674368000.0;
+    static const double p16 = 1.0 / 20922789888000.0;
+    static const double p17 = 1.0 / 355687428096000.0;
+    static const double p18 = 1.0 / 6402373705728000.0;
+    static const double p19 = 1.0 / 121645100408832000.0;
+    static const double p20 = 1.0 / 2432902008176640000.0;
+
+    const double ax = kes_vec_blend( fabs(x) - KES_VEC_SINHCOSH_MAX,
+                                     fabs(x), KES_VEC_SINHCOSH_MAX );
+
+    /* k = round(|x| / ln2), integer part kept in lower bits of t */
+    const double t = ax * KES_VEC_1_LN2 + KES_VEC_RNDMAGIC;
+    const double k = t - KES_VEC_RNDMAGIC;
+    uint64_t     q;
+    memcpy( &q, &t, sizeof(q) );
+
+    /* reduced argument r = |x| - k * ln2 with |r| <= ln2/2 */
+    const double r = (ax - k * KES_VEC_LN2_HI) - k * KES_VEC_LN2_LO;
+
+    /* exp(|x|)/2 = exp(r) * 2^(k-1), NOTE 0 <= k <= 1025 */
+    const double pe = 1.0 + r + r * r * (p2 + r * (p3 + r * (p4 + r * (p5 +
+                      r * (p6 + r * (p7 + r * (p8 + r * (p9 + r * (p10 +
+                      r * (p11 + r * (p12 + r * p13)))))))))));
+    const uint64_t bits = ((q & 0x7ffu) + 1022u) << 52;
+    double         scale;
+    memcpy( &scale, &bits, sizeof(scale) );
+    const double eh = pe * scale;
+    const double ei = 0.25 / eh;
+
+    /* series sinh(x) - x = x^3/3! + ... + x^19/19!,
+     *        cosh(x) - 1 = x^2/2! + ... + x^20/20! for |x| < 1
+     */
+    const double z  = x * x;
+    const double ss = x * z * (p3 + z * (p5 + z * (p7 + z * (p9 +
+                      z * (p11 + z * (p13 + z * (p15 + z * (p17 +
+                      z * p19))))))));
+    const double cs = z * (p2 + z * (p4 + z * (p6 + z * (p8 + z * (p10 +
+                      z * (p12 + z * (p14 + z * (p16 + z * (p18 +
+                      z * p20)))))))));
+    const double se = copysign( (eh - ei) - ax, x );
+
+    const double ce = (eh + ei) - 1.0;
+
+    /* select series for |x| < 1, exponential branch otherwise */
+    *shm = kes_vec_blend( ax - 1.0, ss, se );
+    *chm = kes_vec_blend( ax - 1.0, cs, ce );
+
+    return;
+} // end kes_vec_sinhcoshm
+
+/******************************************************************************/
+
+/*******************************************************************************
+ *  FUNCTION    : kes_vec_log1p
+ *  DESCRIPTION : calculate log(1 + x) without cancellation for small |x|,
+ *                accurate to about 2 ulp for finite x > -1 + DBL_EPSILON
+ *  INPUT       : argument x
+ *  OUTPUT      : log(1 + x)
+ *  REFERENCE   : 1 + x = m * 2^k with sqrt(2)/2 <= m < sqrt(2), minimax
+ *                polynomial of log(m) in s = (m-1)/(m+1) and correction of
+ *                the rounding error of 1 + x (after fdlibm's s_log1p.c)
+ ******************************************************************************/
+static inline double kes_vec_log1p(
+    const double x
+    )
+{
+    /* coefficients of the minimax polynomial */
+    static const double Lg1 = 6.666666666666735130e-01;
+    static const double Lg2 = 3.999999999940941908e-01;
+    static const double Lg3 = 2.857142874366239149e-01;
+    static const double Lg4 = 2.222219843214978396e-01;
+    static const double Lg5 = 1.818357216161805012e-01;
+    static const double Lg6 = 1.531383769920937332e-01;
+    static const double Lg7 = 1.479819860511658591e-01;
+
+    /* exponent k and mantissa 1 <= m < 2 of u = 1 + x from its bits */
+    const double u = 1.0 + x;
+    uint64_t     bits, kbits, mbits;
+    double       k, m;
+    memcpy( &bits, &u, sizeof(bits) );
+    kbits = (bits >> 52) | 0x4330000000000000u;
+    mbits = (bits & 0x000fffffffffffffu) | 0x3ff0000000000000u;
+    memcpy( &k, &kbits, sizeof(k) );
+    memcpy( &m, &mbits, sizeof(m) );
+    k -= 4503599627370496.0 + 1023.0;
+
+    /* m in [sqrt(2)/2:sqrt(2)] */
+    const double c = m - 1.41421356237309504880;
+    m = kes_vec_blend( c, m, 0.5 * m );
+    k = kes_vec_blend( c, k, k + 1.0 );
+
+    /* rounding error of u relative to u, i.e. log(1 + x) = log(u) + d */
+    const double d = kes_vec_blend( 0.5 - k, 1.0 - (u - x),
+                                    x - (u - 1.0) ) / u;
+
+    /* log(m) = f - f^2/2 + s * (f^2/2 + R(s^2)) with f = m - 1 */
+    const double f    = m - 1.0;
+    const double hfsq = 0.5 * f * f;
+    const double s    = f / (2.0 + f);
+    const double z    = s * s;
+    const double r    = z * (Lg1 + z * (Lg2 + z * (Lg3 + z * (Lg4 + z * (Lg5 +
+                        z * (Lg6 + z * Lg7))))));
+
+    return( k * KES_VEC_LN2_HI - ((hfsq - (s * (hfsq + r) +
+            (k * KES_VEC_LN2_LO + d))) - f) );
+} // end kes_vec_log1p
+
+/******************************************************************************/
+
+/*******************************************************************************
+ *  FUNCTION    : kes_vec_asinh
+ *  DESCRIPTION : calculate the inverse hyperbolic sine, accurate to a few ulp
+ *                for finite x
+ *  INPUT       : argument x
+ *  OUTPUT      : asinh(x)
+ *  REFERENCE   : asinh(|x|) = log1p(|x| + x^2 / (1 + sqrt(1 + x^2)))
+ ******************************************************************************/
+static inline double kes_vec_asinh(
+    const double x
+    )
+{
+    /* NOTE avoid overflow of x^2, log(2*|x|) is exact to 1E-300 there */
+    const double ax = fabs(x);
+    const double t  = kes_vec_blend( ax - 1E150,
+                          ax + ax * ax / (1.0 + kes_vec_sqrt( 1.0 + ax * ax )),
+                          2.0 * ax );
+
+    return( copysign( kes_vec_log1p( t ), x ) );
+} // end kes_vec_asinh
+
+/******************************************************************************/
+
+/*******************************************************************************
+ *  FUNCTION    : kes_vec_sincosm
+ *  DESCRIPTION : calculate x - sin(x) and 1 - cos(x) simultaneously,
+ *                without cancellation for small |x|
+ *  INPUT       : - pointer to x - sin(x), 1 - cos(x)
+ *                - angle x (in radians)
+ *  OUTPUT      : none
+ *  REFERENCE   : Taylor series for |x| < 1, kes_vec_sincos() otherwise
+ ******************************************************************************/
+static inline void kes_vec_sincosm(
+    double*      sm,
+    double*      cm,
+    const double x
+    )
+{
+    /* coefficients 1/n! of Taylor polynomials */
+    static const double p2  = 1.0 / 2.0;
+    static const double p3  = 1.0 / 6.0;
+    static const double p4  = 1.0 / 24.0;
+    static const double p5  = 1.0 / 120.0;
+    static const double p6  = 1.0 / 720.0;
+    static const double p7  = 1.0 / 5040.0;
+    static const double p8  = 1.0 / 40320.0;
+    static const double p9  = 1.0 / 362880.0;
+    static const double p10 = 1.0 / 3628800.0;
+    static const double p11 = 1.0 / 39916800.0;
+    static const double p12 = 1.0 / 479001600.0;
+    static const double p13 = 1.0 / 6227020800.0;
+    static const double p14 = 1.0 / 87178291200.0;
+    static const double p15 = 1.0 / 1307674368000.0;
+    static const double p16 = 1.0 / 20922789888000.0;
+    static const double p17 = 1.0 / 355687428096000.0;
+    static const double p18 = 1.0 / 6402373705728000.0;
+    static const double p19 = 1.0 / 121645100408832000.0;
+    static const double p20 = 1.0 / 2432902008176640000.0;
+
+    double sx, cx;
+    kes_vec_sincos( &sx, &cx, x );
+
+    /* series x - sin(x) = x^3/3! - ... + x^19/19!,
+     *        1 - cos(x) = x^2/2! - ... - x^20/20! for |x| < 1
+     */
+    const double z  = x * x;
+    const double ss = x * z * (p3 - z * (p5 - z * (p7 - z * (p9 -
+                      z * (p11 - z * (p13 - z * (p15 - z * (p17 -
+                      z * p19))))))));
+    const double cs = z * (p2 - z * (p4 - z * (p6 - z * (p8 - z * (p10 -
+                      z * (p12 - z * (p14 - z * (p16 - z * (p18 -
+                      z * p20)))))))));
+
+    /* select series for |x| < 1, direct evaluation otherwise */
+    *sm = kes_vec_blend( fabs(x) - 1.0, ss, x - sx );
+    *cm = kes_vec_blend( fabs(x) - 1.0, cs, 1.0 - cx );
+
+    return;
+} // end kes_vec_sincosm
+
+/******************************************************************************/
+
+/*******************************************************************************
+ *  FUNCTION    : kes_vec_sincosf
+ *  DESCRIPTION : calculate sin(x) and cos(x) of type float simultaneously,
+ *                accurate to about 1 ulp for |x| < KES_VEC_SINCOSF_MAX
+ *  INPUT       : - pointer to sin(x), cos(x)
+ *                - angle x (in radians)
+ *  OUTPUT      : none
+ *  REFERENCE   : minimax polynomials on [-pi/4:pi/4] from Cephes
+ *                (sinf, cosf)
+ ******************************************************************************/
+static inline void kes_vec_sincosf(
+    float*      sx,
+    float*      cx,
+    const float x
+    )
+{
+    /* coefficients for sin(r) = r + r^3 * P(r^2) */
+    static const float s1 = -1.6666654611E-1f;
+    static const float s2 =  8.3321608736E-3f;
+    static const float s3 = -1.9515295891E-4f;
+
+    /* coefficients for cos(r) = 1 - r^2/2 + r^4 * Q(r^2) */
+    static const float c1 =  4.166664568298827E-2f;
+    static const float c2 = -1.388731625493765E-3f;
+    static const float c3 =  2.443315711809948E-5f;
+
+    /* quadrant k = round(x / (pi/2)), integer part kept in lower bits of t */
+    const float t = x * (float)KES_VEC_2_PI + KES_VEC_RNDMAGICF;
+    const float k = t - KES_VEC_RNDMAGICF;
+    uint32_t    q;
+    memcpy( &q, &t, sizeof(q) );
+
+    /* reduced argument r = x - k * pi/2 with |r| <= pi/4 */
+    const float r  = ((x - k * KES_VEC_PIO2F_1) - k * KES_VEC_PIO2F_2)
+                     - k * KES_VEC_PIO2F_3;
+    const float z  = r * r;
+
+    /* polynomial approximations on [-pi/4:pi/4] */
+    const float ps = r + r * z * (s1 + z * (s2 + z * s3));
+    const float pc = 1.0f - 0.5f * z + z * z * (c1 + z * (c2 + z * c3));
+
+    /* odd quadrants swap sin and cos, signs follow from quadrant number */
+    kes_vec_quadrantf( sx, cx, ps, pc, q );
+
+    return;
+} // end kes_vec_sincosf
+
+/******************************************************************************/
+
+#endif  /* KES_VECMATH__H */
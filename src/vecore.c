@@ -0,0 +1,782 @@
+/***************************************************************************//**
+ * @file    vecore.c
+ * @brief   vectorized iteration methods for batch solver functions
+ * @details the functions process KES_VEC_LEN independent lanes at once;
+ *          all loops are free of library calls and data-dependent branches,
+ *          such that they are vectorized by the compiler for the target
+ *          instruction set (SSE2, AVX2, AVX-512, NEON, ...)
+ * @author  Bazso Akos
+ * @version 2026.10
+ *
+ * @copyright
+ * Copyright (C) 2019 Bazso Akos
+ *
+ * This file is part of libkes.
+ *
+ * libkes is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * libkes is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with libkes.  If not, see <https://www.gnu.org/licenses/>.
+ *
+ ******************************************************************************/
+
+/* include standard headers */
+#include <math.h>
+
+/* include module headers */
+#include "vecore.h"
+#include "const.h"
+#include "vecmath.h"
+#include "itercore.h"
+
+/******************************************************************************/
+
+/* use verbose debug output? 0 = no (default), 1 = yes */
+#define KES_VECORE_DEBUG 0
+
+/******************************************************************************/
+
+/* tiny increment to denominator, same as in module itercore.c */
+static const double addzero = 1.0e-19;
+
+/* switch from KES_TRIG_FAST to full accuracy below this |x(n+1)-x(n)|
+ * for methods of order 2 to 5, same values as in the scalar solvers
+ */
+static const double trig_switch[6] = {0.0, 0.0, 1E-3, 5E-2, 0.2, 0.3};
+
+/******************************************************************************/
+
+/*** REFERENCE : Danby & Burkardt (1983), Celestial Mechanics 31, p.95-107 ***/
+
+/*******************************************************************************
+ *  FUNCTION    : kes_vec_core_res
+ *  DESCRIPTION : single lane of iteration methods of order 2 to 5,
+ *                same formulas as kes_itercore2 ... kes_itercore5
+ *  INPUT       : - order of iteration method (2 <= order <= 5)
+ *                - use "fast" sin/cos with reduced accuracy (0 or 1)
+ *                - eccentricity "ecc"
+ *                - mean anomaly "ma" (in radians)
+ *                - old value of iteration variable "x0"
+ *                - pointer "f0x" to return M - x0 + e*sin(x0)
+ *                - pointers "es0", "ec0" to return e*sin(x0), e*cos(x0)
+ *  OUTPUT      : update to iteration variable x0+dx
+ ******************************************************************************/
+static inline double kes_vec_core_res(
+    const int    order,
+    const int    fast,
+    const double ecc,
+    const double ma,
+    const double x0,
+    double*      f0x,
+    double*      es0,
+    double*      ec0
+    )
+{
+    double sx, cx; /* sin(x), cos(x) */
+    double dx;     /* increment deltax */
+
+    /* calculate sin, cos */
+    if ( fast )
+    {
+        kes_vec_sincos_fast( &sx, &cx, x0 );
+    } // end if
+    else
+    {
+        kes_vec_sincos( &sx, &cx, x0 );
+    } // end else
+    const double esx = ecc * sx;
+    const double ecx = ecc * cx;
+
+    /* evaluate Kepler Equation: 0th and 1st derivative */
+    const double f0 = ma - x0 + esx;
+    const double f1 = 1.0 - ecx + addzero;
+    *f0x = f0;
+    *es0 = esx;
+    *ec0 = ecx;
+
+    /* delta1: eq. (16) */
+    dx = f0 / f1;
+
+    if ( order >= 3 )
+    {
+        /* delta2: eq. (17) */
+        const double f2 = esx / 2.0;
+        dx = f0 / (f1 + dx * f2);
+
+        if ( order >= 4 )
+        {
+            /* delta3: eq. (18) */
+            const double f3 = ecx / 6.0;
+            dx = f0 / (f1 + dx * (f2 + dx * f3));
+
+            if ( order >= 5 )
+            {
+                /* delta4: eq. (19) */
+                const double f4 = -esx / 24.0;
+                dx = f0 / (f1 + dx * (f2 + dx * (f3 + dx * f4)));
+            } // end if
+        } // end if
+    } // end if
+
+    return( x0 + dx );
+} // end kes_vec_core_res
+
+/******************************************************************************/
+
+/*******************************************************************************
+ *  FUNCTION    : kes_vec_core
+ *  DESCRIPTION : same as kes_vec_core_res without the residual
+ *  INPUT       : - order of iteration method (2 <= order <= 5)
+ *                - use "fast" sin/cos with reduced accuracy (0 or 1)
+ *                - eccentricity "ecc"
+ *                - mean anomaly "ma" (in radians)
+ *                - old value of iteration variable "x0"
+ *  OUTPUT      : update to iteration variable x0+dx
+ ******************************************************************************/
+static inline double kes_vec_core(
+    const int    order,
+    const int    fast,
+    const double ecc,
+    const double ma,
+    const double x0
+    )
+{
+    double f0, es, ec;
+
+    return( kes_vec_core_res( order, fast, ecc, ma, x0, &f0, &es, &ec ) );
+} // end kes_vec_core
+
+/******************************************************************************/
+
+/*******************************************************************************
+ *  FUNCTION    : kes_vitercore2
+ *  DESCRIPTION : vectorized iteration method: Newton-Raphson
+ *  INPUT       : - eccentricities "ecc"
+ *                - mean anomalies "ma" (in radians)
+ *                - old values of iteration variable "x0"
+ *                - new values of iteration variable "x1"
+ *  OUTPUT      : none
+ ******************************************************************************/
+KES_VEC_DISPATCH
+void kes_vitercore2(
+    const double* restrict ecc,
+    const double* restrict ma,
+    const double* restrict x0,
+    double* restrict       x1
+    )
+{
+    for (int l = 0; l < KES_VEC_LEN; l++)
+    {
+        x1[l] = kes_vec_core( 2, 0, ecc[l], ma[l], x0[l] );
+    } // end for
+} // end kes_vitercore2
+
+/******************************************************************************/
+
+/*******************************************************************************
+ *  FUNCTION    : kes_vitercore3
+ *  DESCRIPTION : vectorized iteration method: Halley
+ *  INPUT       : - eccentricities "ecc"
+ *                - mean anomalies "ma" (in radians)
+ *                - old values of iteration variable "x0"
+ *                - new values of iteration variable "x1"
+ *  OUTPUT      : none
+ ******************************************************************************/
+KES_VEC_DISPATCH
+void kes_vitercore3(
+    const double* restrict ecc,
+    const double* restrict ma,
+    const double* restrict x0,
+    double* restrict       x1
+    )
+{
+    for (int l = 0; l < KES_VEC_LEN; l++)
+    {
+        x1[l] = kes_vec_core( 3, 0, ecc[l], ma[l], x0[l] );
+    } // end for
+} // end kes_vitercore3
+
+/******************************************************************************/
+
+/*******************************************************************************
+ *  FUNCTION    : kes_vitercore4
+ *  DESCRIPTION : vectorized iteration method: Danby-Burkardt of order 4
+ *  INPUT       : - eccentricities "ecc"
+ *                - mean anomalies "ma" (in radians)
+ *                - old values of iteration variable "x0"
+ *                - new values of iteration variable "x1"
+ *  OUTPUT      : none
+ ******************************************************************************/
+KES_VEC_DISPATCH
+void kes_vitercore4(
+    const double* restrict ecc,
+    const double* restrict ma,
+    const double* restrict x0,
+    double* restrict       x1
+    )
+{
+    for (int l = 0; l < KES_VEC_LEN; l++)
+    {
+        x1[l] = kes_vec_core( 4, 0, ecc[l], ma[l], x0[l] );
+    } // end for
+} // end kes_vitercore4
+
+/******************************************************************************/
+
+/*******************************************************************************
+ *  FUNCTION    : kes_vitercore5
+ *  DESCRIPTION : vectorized iteration method: Danby-Burkardt of order 5
+ *  INPUT       : - eccentricities "ecc"
+ *                - mean anomalies "ma" (in radians)
+ *                - old values of iteration variable "x0"
+ *                - new values of iteration variable "x1"
+ *  OUTPUT      : none
+ ******************************************************************************/
+KES_VEC_DISPATCH
+void kes_vitercore5(
+    const double* restrict ecc,
+    const double* restrict ma,
+    const double* restrict x0,
+    double* restrict       x1
+    )
+{
+    for (int l = 0; l < KES_VEC_LEN; l++)
+    {
+        x1[l] = kes_vec_core( 5, 0, ecc[l], ma[l], x0[l] );
+    } // end for
+} // end kes_vitercore5
+
+/******************************************************************************/
+
+/*******************************************************************************
+ *  FUNCTION    : kes_vitercore_fast
+ *  DESCRIPTION : vectorized iteration methods with fast sin/cos
+ *  INPUT       : - order of iteration method (2 <= order <= 5)
+ *                - eccentricities "ecc"
+ *                - mean anomalies "ma" (in radians)
+ *                - old values of iteration variable "x0"
+ *                - new values of iteration variable "x1"
+ *  OUTPUT      : none
+ ******************************************************************************/
+KES_VEC_DISPATCH
+static void kes_vitercore_fast(
+    const int              order,
+    const double* restrict ecc,
+    const double* restrict ma,
+    const double* restrict x0,
+    double* restrict       x1
+    )
+{
+    /* NOTE constant order in each loop allows vectorization */
+    switch ( order )
+    {
+        case 2:
+            for (int l = 0; l < KES_VEC_LEN; l++)
+            {
+                x1[l] = kes_vec_core( 2, 1, ecc[l], ma[l], x0[l] );
+            } // end for
+            break;
+
+        case 3:
+            for (int l = 0; l < KES_VEC_LEN; l++)
+            {
+                x1[l] = kes_vec_core( 3, 1, ecc[l], ma[l], x0[l] );
+            } // end for
+            break;
+
+        case 4:
+            for (int l = 0; l < KES_VEC_LEN; l++)
+            {
+                x1[l] = kes_vec_core( 4, 1, ecc[l], ma[l], x0[l] );
+            } // end for
+            break;
+
+        default:
+            for (int l = 0; l < KES_VEC_LEN; l++)
+            {
+                x1[l] = kes_vec_core( 5, 1, ecc[l], ma[l], x0[l] );
+            } // end for
+            break;
+    } // end switch
+} // end kes_vitercore_fast
+
+/******************************************************************************/
+
+/*******************************************************************************
+ *  FUNCTION    : kes_vitercore_res
+ *  DESCRIPTION : vectorized iteration methods returning the residuals
+ *                of the old values, see kes_set_conv(), and sin/cos there
+ *  INPUT       : - order of iteration method (2 <= order <= 5)
+ *                - eccentricities "ecc"
+ *                - mean anomalies "ma" (in radians)
+ *                - old values of iteration variable "x0"
+ *                - new values of iteration variable "x1"
+ *                - results "f0" of M - x0 + ecc*sin(x0)
+ *                - results "es", "ec" of ecc*sin(x0), ecc*cos(x0)
+ *  OUTPUT      : none
+ ******************************************************************************/
+KES_VEC_DISPATCH
+static void kes_vitercore_res(
+    const int              order,
+    const double* restrict ecc,
+    const double* restrict ma,
+    const double* restrict x0,
+    double* restrict       x1,
+    double* restrict       f0,
+    double* restrict       es,
+    double* restrict       ec
+    )
+{
+    /* NOTE constant order in each loop allows vectorization */
+    switch ( order )
+    {
+        case 2:
+            for (int l = 0; l < KES_VEC_LEN; l++)
+            {
+                x1[l] = kes_vec_core_res( 2, 0, ecc[l], ma[l], x0[l], &f0[l],
+                                         &es[l], &ec[l] );
+            } // end for
+            break;
+
+        case 3:
+            for (int l = 0; l < KES_VEC_LEN; l++)
+            {
+                x1[l] = kes_vec_core_res( 3, 0, ecc[l], ma[l], x0[l], &f0[l],
+                                         &es[l], &ec[l] );
+            } // end for
+            break;
+
+        case 4:
+            for (int l = 0; l < KES_VEC_LEN; l++)
+            {
+                x1[l] = kes_vec_core_res( 4, 0, ecc[l], ma[l], x0[l], &f0[l],
+                                         &es[l], &ec[l] );
+            } // end for
+            break;
+
+        default:
+            for (int l = 0; l < KES_VEC_LEN; l++)
+            {
+                x1[l] = kes_vec_core_res( 5, 0, ecc[l], ma[l], x0[l], &f0[l],
+                                         &es[l], &ec[l] );
+            } // end for
+            break;
+    } // end switch
+} // end kes_vitercore_res
+
+/******************************************************************************/
+
+/*******************************************************************************
+ *  FUNCTION    : kes_vkeq_ell
+ *  DESCRIPTION : vectorized evaluation of elliptic Kepler Equation
+ *  INPUT       : - eccentricities "ecc"
+ *                - mean anomalies "ma" (in radians)
+ *                - eccentric anomalies "x" (in radians)
+ *                - results "fx" of x - ecc*sin(x) - ma
+ *                - results "es", "ec" of ecc*sin(x), ecc*cos(x)
+ *  OUTPUT      : none
+ ******************************************************************************/
+KES_VEC_DISPATCH
+static void kes_vkeq_ell(
+    const double* restrict ecc,
+    const double* restrict ma,
+    const double* restrict x,
+    double* restrict       fx,
+    double* restrict       es,
+    double* restrict       ec
+    )
+{
+    for (int l = 0; l < KES_VEC_LEN; l++)
+    {
+        double sx, cx;
+        kes_vec_sincos( &sx, &cx, x[l] );
+        es[l] = ecc[l] * sx;
+        ec[l] = ecc[l] * cx;
+        fx[l] = x[l] - es[l] - ma[l];
+    } // end for
+} // end kes_vkeq_ell
+
+/******************************************************************************/
+
+/*******************************************************************************
+ *  FUNCTION    : kes_vmarkley
+ *  DESCRIPTION : vectorized starter of Markley's method, see markley.c
+ *  INPUT       : - eccentricities "ecc"
+ *                - mean anomalies "ma" (in radians)
+ *                - starter values "x"
+ *  OUTPUT      : none
+ ******************************************************************************/
+static void kes_vmarkley(
+    const double* restrict ecc,
+    const double* restrict ma,
+    double* restrict       x
+    )
+{
+    /* calculate parameters */
+    const double ad0 = 1.0 / (M_PISQ - 6.0);
+    const double ak  = 1.6 * M_PI * ad0;
+    const double ad  = ad0 * 3.0 * M_PISQ;
+
+    for (int l = 0; l < KES_VEC_LEN; l++)
+    {
+        const double e = ecc[l];
+        const double m = ma[l];
+
+        /* alpha(e,M), d, q, r : eqs. (20), (5), (9), (10) */
+        const double a = ad + ak * (M_PI - m) / (1.0 + e);
+        const double d = 3.0 * (1.0 - e) + a * e;
+        const double q = 2.0 * a * d * (1.0 - e) - m * m;
+        const double r = 3.0 * a * d * (d - 1.0 + e) * m + m * m * m;
+
+        /* w^(2/3) : eq. (14) */
+        double       w = cbrt( fabs(r) + sqrt(q * q * q + r * r) );
+        w *= w;
+
+        /* starter value x0 from Pade approximation */
+        x[l] = ((w > 0.0) ? (2.0 * r * w / (w * w + q * w + q * q) + m) / d :
+                0.0);
+    } // end for
+} // end kes_vmarkley
+
+/******************************************************************************/
+
+/*******************************************************************************
+ *  FUNCTION    : kes_vmikkola
+ *  DESCRIPTION : vectorized starter of Mikkola's method, see mikkola.c
+ *  INPUT       : - eccentricities "ecc"
+ *                - mean anomalies "ma" (in radians)
+ *                - starter values "x"
+ *  OUTPUT      : none
+ ******************************************************************************/
+static void kes_vmikkola(
+    const double* restrict ecc,
+    const double* restrict ma,
+    double* restrict       x
+    )
+{
+    for (int l = 0; l < KES_VEC_LEN; l++)
+    {
+        const double e = ecc[l];
+        const double m = ma[l];
+
+        /* solve cubic equation s^3 + 3*a*s - 2*b = 0 */
+        const double a0 = 1.0 / (0.5 + 4.0 * e);
+        const double b  = 0.5 * m * a0;
+        const double a  = a0 * (1.0 - e);
+        const double c  = cbrt( sqrt(a * a * a + b * b) + b );
+
+        /* sol. of cubic approx. with correction term O(s^5) */
+        double       s  = ((c > 0.0) ? c - a / c : 0.0);
+        double       s2 = s * s;
+        s += -0.078 * s * s2 * s2 / (1.0 + e);
+        s2 = s * s;
+
+        /* starting approx. */
+        x[l] = m + e * s * (3.0 - 4.0 * s2);
+    } // end for
+} // end kes_vmikkola
+
+/******************************************************************************/
+
+/*******************************************************************************
+ *  FUNCTION    : kes_get_isa
+ *  DESCRIPTION : name of the instruction set selected for the vectorized
+ *                kernels
+ *  INPUT       : none
+ *  OUTPUT      : pointer to constant string
+ *  NOTE same order of preference as the resolvers of KES_VEC_DISPATCH
+ ******************************************************************************/
+const char* kes_get_isa(void)
+{
+#if defined(__GNUC__) && !defined(__clang__) && (__GNUC__ >= 6) && \
+    defined(__x86_64__) && defined(__ELF__) && !defined(KES_NO_DISPATCH)
+    __builtin_cpu_init();
+    if ( __builtin_cpu_supports( "avx512f" ) )
+    {
+        return( "avx512f" );
+    } // end if
+    if ( __builtin_cpu_supports( "avx2" ) )
+    {
+        return( "avx2" );
+    } // end if
+    return( "sse2" );
+#elif defined(__aarch64__)
+    return( "neon" );
+#else
+    return( "generic" );
+#endif
+} // end kes_get_isa
+
+/******************************************************************************/
+
+/*******************************************************************************
+ *  FUNCTION    : kes_vsolve_supported
+ *  DESCRIPTION : check if solver method has a vectorized implementation
+ *  INPUT       : solver method "iter" from enum kes_sol_e
+ *  OUTPUT      : 1 if supported, 0 otherwise
+ ******************************************************************************/
+int kes_vsolve_supported(
+    const kes_sol_e iter
+    )
+{
+    switch ( iter )
+    {
+        case KES_SOL_NEWRAP:
+        case KES_SOL_HALLEY:
+        case KES_SOL_DANBUR4:
+        case KES_SOL_DANBUR5:
+        case KES_SOL_MARKLEY:
+        case KES_SOL_MIKKOLA:
+            return( 1 );
+        default:
+            return( 0 );
+    } // end switch
+} // end kes_vsolve_supported
+
+/******************************************************************************/
+
+/*******************************************************************************
+ *  FUNCTION    : kes_vsolve_ell
+ *  DESCRIPTION : vectorized solver for elliptic Kepler Equation,
+ *                lanes are iterated until all of them have converged
+ *  INPUT       : - solver method "iter" from enum kes_sol_e
+ *                - eccentricities "ecc"
+ *                - reduced mean anomalies "ma" (in radians)
+ *                - "starter" values
+ *                - solutions "x"
+ *                - number of iterations "count"
+ *                - pointer "data" to input parameters
+ *                - sin/cos of the last step "trig" (or NULL)
+ *  OUTPUT      : none
+ ******************************************************************************/
+void kes_vsolve_ell(
+    const kes_sol_e        iter,
+    const double* restrict ecc,
+    const double* restrict ma,
+    const double* restrict starter,
+    double* restrict       x,
+    int* restrict          count,
+    const kes_input_t*     data,
+    kes_vtrig_t* restrict  trig
+    )
+{
+    void (*core)( const double* restrict, const double* restrict,
+                  const double* restrict, double* restrict );
+
+    double xnew[KES_VEC_LEN]; /* updated iteration variables */
+    double fx[KES_VEC_LEN];   /* residuals of Kepler Equation */
+    double corr[KES_VEC_LEN]; /* correction factors for deltaf */
+    int    todo[KES_VEC_LEN]; /* lane is still iterating? */
+    double tx[KES_VEC_LEN];   /* iterate of sin/cos of the step */
+    double tes[KES_VEC_LEN];  /* e*sin(tx) */
+    double tec[KES_VEC_LEN];  /* e*cos(tx) */
+
+    /* methods of order 5 with special starter: single correction step */
+    if ( (iter == KES_SOL_MARKLEY) || (iter == KES_SOL_MIKKOLA) )
+    {
+        if ( iter == KES_SOL_MARKLEY )
+        {
+            kes_vmarkley( ecc, ma, xnew );
+        } // end if
+        else
+        {
+            kes_vmikkola( ecc, ma, xnew );
+        } // end else
+
+        if ( trig != NULL )
+        {
+            kes_vitercore_res( 5, ecc, ma, xnew, x, fx, trig->es, trig->ec );
+        } // end if
+        else
+        {
+            kes_vitercore5( ecc, ma, xnew, x );
+        } // end else
+
+        for (int l = 0; l < KES_VEC_LEN; l++)
+        {
+            count[l] = 1;
+            if ( trig != NULL )
+            {
+                trig->x[l] = xnew[l];
+            } // end if
+        } // end for
+
+        return;
+    } // end if
+
+    /* select iteration method */
+    int order;
+    switch ( iter )
+    {
+        case KES_SOL_NEWRAP:  core = kes_vitercore2; order = 2; break;
+        case KES_SOL_HALLEY:  core = kes_vitercore3; order = 3; break;
+        case KES_SOL_DANBUR4: core = kes_vitercore4; order = 4; break;
+        default:              core = kes_vitercore5; order = 5; break;
+    } // end switch
+
+    /* fast sin/cos for early iterations */
+    int fast = (data->trig == KES_TRIG_FAST);
+
+    /* fixed number of iterations without evaluation of residuals,
+     * NOTE last iteration always with full accuracy
+     */
+    if ( data->fixiter > 0 )
+    {
+        for (int l = 0; l < KES_VEC_LEN; l++)
+        {
+            x[l] = starter[l];
+        } // end for
+        for (int n = 0; n < data->fixiter; n++)
+        {
+            if ( fast && (n < data->fixiter - 1) )
+            {
+                kes_vitercore_fast( order, ecc, ma, x, xnew );
+            } // end if
+            else if ( (trig != NULL) && (n == data->fixiter - 1) )
+            {
+                /* keep sin/cos of the last step */
+                kes_vitercore_res( order, ecc, ma, x, xnew, fx, trig->es,
+                                   trig->ec );
+                for (int l = 0; l < KES_VEC_LEN; l++)
+                {
+                    trig->x[l] = x[l];
+                } // end for
+            } // end if
+            else
+            {
+                core( ecc, ma, x, xnew );
+            } // end else
+            for (int l = 0; l < KES_VEC_LEN; l++)
+            {
+                x[l] = xnew[l];
+            } // end for
+        } // end for
+
+        for (int l = 0; l < KES_VEC_LEN; l++)
+        {
+            count[l] = data->fixiter;
+        } // end for
+
+        return;
+    } // end if
+
+    /* initialize lanes */
+    for (int l = 0; l < KES_VEC_LEN; l++)
+    {
+        x[l]     = starter[l];
+        count[l] = 0;
+        todo[l]  = 1;
+        corr[l]  = ecc[l] / (1.0 - ecc[l]);
+    } // end for
+
+    /* main iteration loop, same stopping criteria as scalar solvers */
+    const double tolx    = data->tolx;
+    const double tolf    = data->tolf;
+    const int    maxiter = data->maxiter;
+    int          active;
+
+    int          rough;  /* last step with fast sin/cos ? */
+    double       maxdx;  /* largest increment of active lanes */
+
+    /* residuals of the old values from the iteration step ? */
+    const int    lean    = (data->conv == KES_CONV_LEAN);
+
+    /* stop on the error predicted by the order of convergence ? */
+    const int    predict = (data->stop != KES_STOP_DELTA);
+
+    do
+    {
+        if ( fast )
+        {
+            kes_vitercore_fast( order, ecc, ma, x, xnew );
+        } // end if
+        else if ( lean )
+        {
+            kes_vitercore_res( order, ecc, ma, x, xnew, fx, tes, tec );
+        } // end if
+        else
+        {
+            core( ecc, ma, x, xnew );
+        } // end else
+
+        /* residuals of xnew, in lean mode residuals of x from the step
+         * (none for a step with fast sin/cos), and the iterate of the
+         * sin/cos with full accuracy which come with them
+         */
+        if ( !lean )
+        {
+            kes_vkeq_ell( ecc, ma, xnew, fx, tes, tec );
+            for (int l = 0; l < KES_VEC_LEN; l++)
+            {
+                tx[l] = xnew[l];
+            } // end for
+        } // end if
+        else if ( fast )
+        {
+            for (int l = 0; l < KES_VEC_LEN; l++)
+            {
+                fx[l]  = HUGE_VAL;
+                tx[l]  = NAN;
+                tes[l] = tec[l] = 0.0;
+            } // end for
+        } // end if
+        else
+        {
+            for (int l = 0; l < KES_VEC_LEN; l++)
+            {
+                tx[l] = x[l];
+            } // end for
+        } // end else
+
+        rough  = fast;
+        active = 0;
+        maxdx  = 0.0;
+        for (int l = 0; l < KES_VEC_LEN; l++)
+        {
+            /* update error residuals */
+            const double deltax = fabs(xnew[l] - x[l]);
+            const double deltaf = fabs(fx[l]) * corr[l];
+            const int    done   = predict && (!rough) &&
+                                  kes_stop_order( data->stop, order, ecc[l],
+                                                  xnew[l], deltax, tolx );
+
+            /* largest increment of lanes still iterating */
+            maxdx    = ((todo[l] && (deltax > maxdx)) ? deltax : maxdx);
+
+            /* sin/cos of the last step of lanes still iterating */
+            if ( (trig != NULL) && todo[l] )
+            {
+                trig->x[l]  = tx[l];
+                trig->es[l] = tes[l];
+                trig->ec[l] = tec[l];
+            } // end if
+
+            /* converged lanes keep their results,
+             * a step with fast sin/cos cannot confirm convergence in x
+             */
+            x[l]     = (todo[l] ? xnew[l] : x[l]);
+            count[l] += todo[l];
+            todo[l]  = todo[l] &&
+                       ((deltax  > tolx) || rough) &&
+                       (deltaf   > tolf) &&
+                       (!done) &&
+                       (count[l] < maxiter);
+            active  |= todo[l];
+        } // end for
+
+        /* switch to full accuracy close to the solution */
+        fast = fast && (maxdx > trig_switch[order]);
+    } while ( active ); // end do
+
+    return;
+} // end kes_vsolve_ell
+
+/******************************************************************************/
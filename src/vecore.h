@@ -0,0 +1,194 @@
+/***************************************************************************//**
+ * @file    vecore.h
+ * @brief   vectorized iteration methods for batch solver functions
+ * @author  Bazso Akos
+ * @version 2026.10
+ *
+ * @copyright
+ * Copyright (C) 2019 Bazso Akos
+ *
+ * This file is part of libkes.
+ *
+ * libkes is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * libkes is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with libkes.  If not, see <https://www.gnu.org/licenses/>.
+ *
+ ******************************************************************************/
+#pragma once
+#ifndef KES_VECORE__H
+#define KES_VECORE__H
+
+/* include module headers */
+#include "input.h"
+#include "solver.h"
+
+/******************************************************************************/
+
+/*** declare constants ***/
+
+/*!
+ * @brief number of lanes processed per call of a vectorized function,
+ *        covers one AVX-512 or two AVX2 registers of type double
+ */
+#define KES_VEC_LEN 8
+
+/*!
+ * @brief runtime dispatch of the vectorized kernels
+ * @details on x86-64 with GCC and an ELF target each kernel is compiled for
+ * AVX-512F, AVX2 and the SSE2 baseline, the version for the CPU is selected
+ * by an ifunc resolver when the library is loaded, see kes_get_isa();
+ * other targets compile the kernels once for the baseline of the build, e.g.
+ * NEON on AArch64; define KES_NO_DISPATCH to disable the clones;
+ * KES_VEC_INLINE marks large helpers of a kernel, which are no longer called
+ * once after cloning, but have to be inlined in each version
+ * NOTE all versions give identical results, the library is compiled
+ * without contraction to FMA (-std=c99 implies -ffp-contract=off)
+ */
+#if defined(__GNUC__) && !defined(__clang__) && (__GNUC__ >= 6) && \
+    defined(__x86_64__) && defined(__ELF__) && !defined(KES_NO_DISPATCH)
+#define KES_VEC_DISPATCH \
+    __attribute__((target_clones("avx512f", "avx2", "default")))
+#define KES_VEC_INLINE   inline __attribute__((always_inline))
+#else
+#define KES_VEC_DISPATCH
+#define KES_VEC_INLINE   inline
+#endif
+
+/******************************************************************************/
+
+/*** declare data structures ***/
+
+/*!
+ * @brief sin/cos of the last step of each lane of kes_vsolve_ell()
+ * @details same meaning as #kes_trig_t of module kepeq.h for all lanes,
+ * i.e. the partial derivatives and warm starts need no further sin/cos
+ */
+typedef struct
+{
+    double x[KES_VEC_LEN];  ///< iterate of the last step (NAN if unknown)
+    double es[KES_VEC_LEN]; ///< e*sin(x)
+    double ec[KES_VEC_LEN]; ///< e*cos(x)
+} kes_vtrig_t;
+
+/******************************************************************************/
+
+/*** declare functions ***/
+
+/*!
+ * @brief name of the instruction set selected for the vectorized kernels
+ * @return "avx512f", "avx2" or "sse2" on x86-64 with runtime dispatch,
+ * otherwise "neon" on AArch64 or "generic"
+ */
+const char* kes_get_isa(void);
+
+/*!
+ * @brief vectorized Newton-Raphson iteration step (order 2)
+ * @details all arrays hold KES_VEC_LEN elements
+ * @param[in] ecc   eccentricities
+ * @param[in] ma    mean anomalies (in radians)
+ * @param[in] x0    old values of the iteration variable
+ * @param[out] x1   updated values of the iteration variable
+ */
+void kes_vitercore2(
+    const double* restrict ecc,
+    const double* restrict ma,
+    const double* restrict x0,
+    double* restrict       x1
+    );
+
+/*!
+ * @brief vectorized Halley iteration step (order 3)
+ * @details all arrays hold KES_VEC_LEN elements
+ * @param[in] ecc   eccentricities
+ * @param[in] ma    mean anomalies (in radians)
+ * @param[in] x0    old values of the iteration variable
+ * @param[out] x1   updated values of the iteration variable
+ */
+void kes_vitercore3(
+    const double* restrict ecc,
+    const double* restrict ma,
+    const double* restrict x0,
+    double* restrict       x1
+    );
+
+/*!
+ * @brief vectorized Danby-Burkardt iteration step (order 4)
+ * @details all arrays hold KES_VEC_LEN elements
+ * @param[in] ecc   eccentricities
+ * @param[in] ma    mean anomalies (in radians)
+ * @param[in] x0    old values of the iteration variable
+ * @param[out] x1   updated values of the iteration variable
+ */
+void kes_vitercore4(
+    const double* restrict ecc,
+    const double* restrict ma,
+    const double* restrict x0,
+    double* restrict       x1
+    );
+
+/*!
+ * @brief vectorized Danby-Burkardt iteration step (order 5)
+ * @details all arrays hold KES_VEC_LEN elements
+ * @param[in] ecc   eccentricities
+ * @param[in] ma    mean anomalies (in radians)
+ * @param[in] x0    old values of the iteration variable
+ * @param[out] x1   updated values of the iteration variable
+ */
+void kes_vitercore5(
+    const double* restrict ecc,
+    const double* restrict ma,
+    const double* restrict x0,
+    double* restrict       x1
+    );
+
+/*!
+ * @brief check if a solver method has a vectorized implementation
+ * @param[in] iter  solver method from enum kes_sol_e
+ * @return 1 if kes_vsolve_ell() supports the method, 0 otherwise
+ */
+int kes_vsolve_supported(
+    const kes_sol_e iter
+    );
+
+/*!
+ * @brief vectorized solver for the elliptic Kepler Equation
+ * @details all arrays hold KES_VEC_LEN elements, mean anomalies have to be
+ *          reduced to the range 0 <= ma <= pi; unused lanes must be filled
+ *          with valid dummy values
+ * @param[in] iter      solver method from enum kes_sol_e
+ * @param[in] ecc       eccentricities (0 < ecc < 1)
+ * @param[in] ma        reduced mean anomalies (in radians)
+ * @param[in] starter   starter values (ignored by Markley's and Mikkola's
+ *                      method)
+ * @param[out] x        solutions (in radians)
+ * @param[out] count    number of iterations per lane
+ * @param[in] data      pointer to input parameters for stopping criteria
+ *                      (tolf, tolx, maxiter) or fixed iterations (fixiter),
+ *                      accuracy tier of sin/cos (trig) and convergence
+ *                      test (conv)
+ * @param[out] trig     sin/cos of the last step with full accuracy of each
+ *                      lane (or NULL if not needed)
+ */
+void kes_vsolve_ell(
+    const kes_sol_e        iter,
+    const double* restrict ecc,
+    const double* restrict ma,
+    const double* restrict starter,
+    double* restrict       x,
+    int* restrict          count,
+    const kes_input_t*     data,
+    kes_vtrig_t* restrict  trig
+    );
+
+/******************************************************************************/
+
+#endif  /* KES_VECORE__H */
@@ -26,11 +26,22 @@
  * along with libkes.  If not, see <https://www.gnu.org/licenses/>.
  *
  ******************************************************************************/
+/* POSIX mmap() and fstat() */
+#define _POSIX_C_SOURCE 200809L
+
  /* include standard headers */
+#include <fcntl.h>
+#include <stddef.h>
+#include <stdint.h>
 #include <stdio.h>
+#include <string.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
 
 /* include module headers */
 #include "version.h"
+#include "starter.h"
 
 /******************************************************************************/
 
@@ -51,6 +62,35 @@
 
 /******************************************************************************/
 
+/*** table file of starter KES_STM_ES15 ***/
+
+/* version of the file layout, increase on any change of kes_tabfile_t */
+#define KES_TABFILE_FORMAT 1
+
+/* tag of byte order, read back as another value on a different host */
+#define KES_TABFILE_ORDER  0x01020304U
+
+/* header of table file, followed by the table data
+ * NOTE 72 bytes, i.e. the data is aligned to 8 bytes in a mapped file
+ */
+typedef struct
+{
+    char     magic[8];  // file tag "KESTAB" plus two NUL bytes
+    uint32_t order;     // KES_TABFILE_ORDER in byte order of the writer
+    uint32_t format;    // KES_TABFILE_FORMAT
+    uint32_t major;     // library major version
+    uint32_t minor;     // library minor version
+    uint32_t dims[3];   // grid intervals in x and t, values per node
+    uint32_t reserved;  // zero
+    double   par[2];    // parameters t_c and e_c of the corner region
+    uint64_t nbytes;    // size of the table data in bytes
+    uint64_t checksum;  // FNV-1a hash of the table data
+} kes_tabfile_t;
+
+static const char kes_tabfile_magic[8] = "KESTAB";
+
+/******************************************************************************/
+
 /*******************************************************************************
  *  FUNCTION    : kes_version
  *  DESCRIPTION : print the library's version number to stdout
@@ -110,3 +150,190 @@ inline int kes_get_minor_version(void)
 } // end kes_get_minor_version
 
 /******************************************************************************/
+
+/*******************************************************************************
+ *  FUNCTION    : kes_tabfile_hash
+ *  DESCRIPTION : FNV-1a hash of a block of memory
+ *  INPUT       : - pointer "data" to block
+ *                - size "nbytes" of block in bytes
+ *  OUTPUT      : 64-bit hash value
+ ******************************************************************************/
+static uint64_t kes_tabfile_hash(
+    const void*  data,
+    const size_t nbytes
+    )
+{
+    const unsigned char* p = data;
+    uint64_t             h = 14695981039346656037ULL;
+
+    for (size_t i = 0; i < nbytes; i++)
+    {
+        h = (h ^ p[i]) * 1099511628211ULL;
+    } // end for
+
+    return( h );
+} // end kes_tabfile_hash
+
+/******************************************************************************/
+
+/*******************************************************************************
+ *  FUNCTION    : kes_tabfile_header
+ *  DESCRIPTION : fill header of table file for this library
+ *  INPUT       : pointer "hdr" to header
+ *  OUTPUT      : none
+ ******************************************************************************/
+static void kes_tabfile_header(kes_tabfile_t* hdr)
+{
+    int dims[3];
+
+    memset( hdr, 0, sizeof(kes_tabfile_t) );
+    memcpy( hdr->magic, kes_tabfile_magic, sizeof(hdr->magic) );
+    hdr->order  = KES_TABFILE_ORDER;
+    hdr->format = KES_TABFILE_FORMAT;
+    hdr->major  = KES_VERSION_MAJOR;
+    hdr->minor  = KES_VERSION_MINOR;
+    hdr->nbytes = kes_starter_table_shape( dims, hdr->par );
+    for (int k = 0; k < 3; k++)
+    {
+        hdr->dims[k] = (uint32_t)dims[k];
+    } // end for
+} // end kes_tabfile_header
+
+/******************************************************************************/
+
+/*******************************************************************************
+ *  FUNCTION    : kes_table_save
+ *  DESCRIPTION : write table of starter KES_STM_ES15 to a file
+ *  INPUT       : name "path" of the table file
+ *  OUTPUT      : error code
+ ******************************************************************************/
+kes_err_e kes_table_save(const char* path)
+{
+    kes_tabfile_t hdr;
+    char          tmp[4096];
+
+    if ( (path == NULL) ||
+         (snprintf(tmp, sizeof(tmp), "%s.tmp", path) >= (int)sizeof(tmp)) )
+    {
+        return( KES_ERR_BADFILE );
+    } // end if
+
+    const double* data = kes_starter_table_data();
+    kes_tabfile_header( &hdr );
+    hdr.checksum = kes_tabfile_hash( data, hdr.nbytes );
+
+    FILE* file = fopen(tmp, "wb");
+    if ( file == NULL )
+    {
+        return( KES_ERR_BADFILE );
+    } // end if
+
+    const int ok = ((fwrite(&hdr, sizeof(hdr), 1, file) == 1) &&
+                    (fwrite(data, hdr.nbytes, 1, file) == 1));
+
+    /* replace old file only if the new one is complete */
+    if ( (fclose(file) != 0) || !ok || (rename(tmp, path) != 0) )
+    {
+        remove( tmp );
+        return( KES_ERR_BADFILE );
+    } // end if
+
+#if KES_VERSION_DEBUG
+    printf("kes_table_save: wrote %lu bytes to %s\n",
+           (unsigned long)(sizeof(hdr) + hdr.nbytes), path);
+#endif
+
+    return( KES_ERR_NOERR );
+} // end kes_table_save
+
+/******************************************************************************/
+
+/*******************************************************************************
+ *  FUNCTION    : kes_table_map
+ *  DESCRIPTION : map a table file read-only and validate it
+ *  INPUT       : - name "path" of the table file
+ *                - pointer "status" to return error code (may be NULL)
+ *  OUTPUT      : pointer to table data, NULL on error
+ ******************************************************************************/
+const double* kes_table_map(
+    const char* path,
+    kes_err_e*  status
+    )
+{
+    kes_tabfile_t ref;
+    struct stat   st;
+    void*         map = MAP_FAILED;
+
+    if ( status != NULL )
+    {
+        *status = KES_ERR_BADFILE;
+    } // end if
+
+    const int fd = ((path != NULL) ? open(path, O_RDONLY) : -1);
+    if ( fd < 0 )
+    {
+        return( NULL );
+    } // end if
+
+    /* NOTE the mapping stays valid after closing the file descriptor */
+    kes_tabfile_header( &ref );
+    const size_t size = sizeof(ref) + ref.nbytes;
+    if ( (fstat(fd, &st) == 0) && ((size_t)st.st_size == size) )
+    {
+        map = mmap(NULL, size, PROT_READ, MAP_SHARED, fd, 0);
+    } // end if
+    close( fd );
+
+    if ( map == MAP_FAILED )
+    {
+        return( NULL );
+    } // end if
+
+    /* header must match this library, checksum must match the data */
+    const kes_tabfile_t* hdr  = map;
+    const double*        data = (const double*)(hdr + 1);
+    if ( (memcmp(hdr, &ref, offsetof(kes_tabfile_t, checksum)) != 0) ||
+         (kes_tabfile_hash(data, ref.nbytes) != hdr->checksum) )
+    {
+#if KES_VERSION_DEBUG
+        printf("kes_table_map: %s is invalid for this library\n", path);
+#endif
+        munmap( map, size );
+        return( NULL );
+    } // end if
+
+    if ( status != NULL )
+    {
+        *status = KES_ERR_NOERR;
+    } // end if
+
+    return( data );
+} // end kes_table_map
+
+/******************************************************************************/
+
+/*******************************************************************************
+ *  FUNCTION    : kes_table_load
+ *  DESCRIPTION : use a table file for starter KES_STM_ES15
+ *  INPUT       : name "path" of the table file
+ *  OUTPUT      : error code
+ ******************************************************************************/
+kes_err_e kes_table_load(const char* path)
+{
+    kes_err_e     status;
+    const double* data = kes_table_map(path, &status);
+
+    /* a table in use is kept, release the mapping again */
+    if ( (data != NULL) && !kes_starter_table_attach(data) )
+    {
+        int    dims[3];
+        double par[2];
+        munmap( (void*)((const kes_tabfile_t*)data - 1),
+                sizeof(kes_tabfile_t) + kes_starter_table_shape(dims, par) );
+    } // end if
+
+    return( status );
+} // end kes_table_load
+
+/******************************************************************************/
+
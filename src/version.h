@@ -27,6 +27,9 @@
 #ifndef KES_VERSION__H
 #define KES_VERSION__H
 
+/* include module headers */
+#include "error.h"
+
 /******************************************************************************/
 
 /*** function declarations ***/
@@ -55,6 +58,47 @@ int kes_get_major_version(void);
  */
 int kes_get_minor_version(void);
 
+
+/*!
+ * @brief write the lookup table of starter KES_STM_ES15 to a table file
+ * @details the table is built if necessary; the file starts with a header
+ * holding format and library version, grid parameters, byte order and a
+ * checksum of the data; it is written to "<path>.tmp" first and renamed,
+ * i.e. processes mapping an older file keep a consistent table
+ * @param[in] path name of the table file
+ * @return error code from enum #kes_err_e,
+ * KES_ERR_NOERR indicates success, KES_ERR_BADFILE indicates error
+ */
+kes_err_e kes_table_save(const char* path);
+
+
+/*!
+ * @brief map a table file read-only as lookup table of KES_STM_ES15
+ * @details the file is validated against format and library version, grid
+ * parameters, byte order and checksum; the pages are shared with all
+ * processes mapping the same file and stay mapped until program exit;
+ * call this before the first use of KES_STM_ES15, afterwards the table in
+ * use is kept; alternatively name the file in the environment variable
+ * KES_TABLE_FILE, it is then mapped on first use
+ * @param[in] path name of the table file
+ * @return error code from enum #kes_err_e,
+ * KES_ERR_NOERR indicates success, KES_ERR_BADFILE indicates a missing,
+ * damaged or outdated file (e.g. of another library version)
+ */
+kes_err_e kes_table_load(const char* path);
+
+
+/*!
+ * @brief map and validate a table file, see kes_table_load()
+ * @param[in] path name of the table file
+ * @param[out] status pointer to return error code (may be NULL)
+ * @return pointer to the table data, NULL on error
+ */
+const double* kes_table_map(
+    const char* path,
+    kes_err_e*  status
+);
+
 #ifdef __cplusplus
 }
 #endif
@@ -0,0 +1,305 @@
+/***************************************************************************//**
+ * @file    vecore.c
+ * @file    vstarter.c
+ * @brief   vectorized starter methods for batch starter and solver functions
+ * @details same formulas as the starter methods in starter.c, written
+ *          without data-dependent branches and with the math kernels of
+ *          vecmath.h, such that loops over KES_VEC_LEN lanes are vectorized
+ *          by the compiler
+ * @author  Bazso Akos
+ * @version 2026.10
+ *
+ * @copyright
+ * Copyright (C) 2019 Bazso Akos
+ *
+ * This file is part of libkes.
+ *
+ * libkes is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * libkes is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with libkes.  If not, see <https://www.gnu.org/licenses/>.
+ *
+ ******************************************************************************/
+
+/* include standard headers */
+#include <math.h>
+
+/* include module headers */
+#include "vstarter.h"
+#include "const.h"
+#include "vecmath.h"
+
+/******************************************************************************/
+
+/*** REFERENCE : see the scalar starter methods stm_s0 ... stm_s14 ***/
+
+/* S02 : E0 = M + e * sin(M) */
+static inline double kes_vstm_s2(
+    const double ecc,
+    const double ma
+    )
+{
+    double sx, cx;
+    kes_vec_sincos( &sx, &cx, ma );
+
+    return( ma + ecc * sx );
+} // end kes_vstm_s2
+
+/* S03 : E0 = M + e * sin(M) * (1 + e * cos(M)) */
+static inline double kes_vstm_s3(
+    const double ecc,
+    const double ma
+    )
+{
+    double sx, cx;
+    kes_vec_sincos( &sx, &cx, ma );
+
+    return( ma + ecc * sx * (1.0 + ecc * cx) );
+} // end kes_vstm_s3
+
+/* S05 : E0 = M + e * sin(M) / (1 - sin(M + e) + sin(M)) */
+static inline double kes_vstm_s5(
+    const double ecc,
+    const double ma
+    )
+{
+    double sx, cx, sy, cy;
+    kes_vec_sincos( &sx, &cx, ma );
+    kes_vec_sincos( &sy, &cy, ma + ecc );
+
+    return( ma + ecc * sx / (1.0 - sy + sx) );
+} // end kes_vstm_s5
+
+/* S07 : E0 = min{M/(1-e), M + e, (M + e * pi) / (1 + e)}
+ * NOTE M/(1-e) is skipped for e >= 1, fmin() would skip NaN for 0/0
+ */
+static inline double kes_vstm_s7(
+    const double ecc,
+    const double ma
+    )
+{
+    const double s4  = ma + ecc;
+    const double s6  = (ma + ecc * M_PI) / (1.0 + ecc);
+    const double tmp = kes_vec_blend( ecc - 1.0, ma / (1.0 - ecc), s4 );
+    const double min = kes_vec_blend( tmp - s4, tmp, s4 );
+
+    return( kes_vec_blend( min - s6, min, s6 ) );
+} // end kes_vstm_s7
+
+/* S08 : E0 = S03 + lambda * e^4 * (pi - S03), lambda = 1 / (20 * pi) */
+static inline double kes_vstm_s8(
+    const double ecc,
+    const double ma
+    )
+{
+    const double lambda = (0.05 * M_1_PI);
+    const double x      = kes_vstm_s3( ecc, ma );
+
+    return( x + lambda * ecc * ecc * ecc * ecc * (M_PI - x) );
+} // end kes_vstm_s8
+
+/* S09 : E0 = M + e * sin(M) / (1 - 2 * e * cos(M) + e^2)^(1/2)
+ * NOTE M for e >= 1 or M <= 0, denominator 1 avoids 0/0 at (e,M) = (1,0)
+ */
+static inline double kes_vstm_s9(
+    const double ecc,
+    const double ma
+    )
+{
+    double sx, cx;
+    kes_vec_sincos( &sx, &cx, ma );
+
+    const double d = kes_vec_sqrt( 1.0 - 2.0 * ecc * cx + ecc * ecc );
+    const double x = ma + ecc * sx / kes_vec_blend( 0.0 - d, d, 1.0 );
+
+    /* NOTE 0.0 - M is negative only for M > 0, unlike -M */
+    return( kes_vec_blend( ecc - 1.0, kes_vec_blend( 0.0 - ma, x, ma ), ma ) );
+} // end kes_vstm_s9
+
+/* S10 : E0 = s - q / s, q = 2 * (1 - e) / e, r = 3 * M / e,
+ *       s = cbrt(sqrt(r^2 + q^3) + r)
+ * NOTE M for e <= 0
+ */
+static inline double kes_vstm_s10(
+    const double ecc,
+    const double ma
+    )
+{
+    const double q = 2.0 * (1.0 - ecc) / ecc;
+    const double r = 3.0 * ma / ecc;
+    const double s = kes_vec_cbrt( kes_vec_sqrt( q * q * q + r * r ) + r );
+
+    return( kes_vec_blend( 0.0 - ecc, s - q / s, ma ) );
+} // end kes_vstm_s10
+
+/* S11 : fourth order series in e divided by a cube root, see stm_s11
+ * NOTE M for e >= 1
+ */
+static inline double kes_vstm_s11(
+    const double ecc,
+    const double ma
+    )
+{
+    static const double a  = -0.922267802364199155721E-1;
+    static const double b  =  0.830041022127779240149E+0; /* b = -9*a; */
+    static const double c  = -0.184453560472839831144E+0; /* c =  2*a; */
+
+    double sinx, cosx;
+    kes_vec_sincos( &sinx, &cosx, ma );
+
+    const double e1    = 1.0 - ecc;
+    const double cos2x = (2.0 * cosx * cosx - 1.0);
+    const double ecosx = ecc * cosx;
+    const double esinx = ecc * sinx;
+
+    const double x = ma + esinx * (
+                         1.0 +
+                         ecosx * 2.0 / 3.0 +
+                         ecc * ecc * (1.0 - 48.0 * cosx + 19.0 * cos2x) / 36.0 +
+                         ecc * ecc * ecc * (a + b * cosx + c * cos2x)
+                     ) / kes_vec_cbrt( 1.0 - (1.0 + ecc * e1 * (1.0 + e1) *
+                                       (1.0 + e1)) * ecosx );
+
+    return( kes_vec_blend( ecc - 1.0, x, ma ) );
+} // end kes_vstm_s11
+
+/* S12 : E0 = e * E(0,e=1) + (1 - e) * M */
+static inline double kes_vstm_s12(
+    const double ecc,
+    const double ma
+    )
+{
+    const double a = (M_PI-1.0)*(M_PI-1.0)/(M_PI+2.0/3.0);
+    const double b = 2.0*(M_PI-1.0/6.0)*(M_PI-1.0/6.0)/(M_PI+2.0/3.0);
+    const double w = M_PI - ma;
+
+    return( ecc * (M_PI - a * w / (b - w)) + (1.0 - ecc) * ma );
+} // end kes_vstm_s12
+
+/* S13 : E0 = arctan( sin(y) / (cos(y) - e) ), y = M + sin(x) - x,
+ *       x = arctan( e*sin(M) / (1 - e*cos(M)) )
+ */
+static inline double kes_vstm_s13(
+    const double ecc,
+    const double ma
+    )
+{
+    double sx, cx;
+    kes_vec_sincos( &sx, &cx, ma );
+
+    double x = kes_vec_atan2( ecc * sx, 1.0 - ecc * cx );
+    kes_vec_sincos( &sx, &cx, x );
+    x = ma + sx - x;
+    kes_vec_sincos( &sx, &cx, x );
+
+    return( kes_vec_atan2( sx, cx - ecc ) );
+} // end kes_vstm_s13
+
+/* S14 : E0 = M + e * [ (pi^2*M)^(1/3) - pi*sin(M)/15 - M ] */
+static inline double kes_vstm_s14(
+    const double ecc,
+    const double ma
+    )
+{
+    double sx, cx;
+    kes_vec_sincos( &sx, &cx, ma );
+
+    return( ma + ecc * (kes_vec_cbrt( M_PISQ * ma ) - M_PI * sx / 15.0 - ma) );
+} // end kes_vstm_s14
+
+/******************************************************************************/
+
+/*******************************************************************************
+ *  FUNCTION    : kes_vstarter_supported
+ *  DESCRIPTION : check if starter method has a vectorized implementation
+ *  INPUT       : starter method "type" from enum kes_stm_e
+ *  OUTPUT      : 1 if supported, 0 otherwise
+ *  NOTE the tabulated starter KES_STM_ES15 needs gathers from its table and
+ *       remains scalar
+ ******************************************************************************/
+int kes_vstarter_supported(
+    const kes_stm_e type
+    )
+{
+    return( (type > KES_STM_NONE) && (type < KES_STM_ES15) );
+} // end kes_vstarter_supported
+
+/******************************************************************************/
+
+/* evaluate expression "expr" of e, m on all lanes, one loop per method */
+#define KES_VSTM_LANES(expr) \
+    for (int l = 0; l < KES_VEC_LEN; l++) \
+    { \
+        const double e = ecc[l]; \
+        const double m = ma[l]; \
+        x[l] = (expr); \
+    }
+
+/*******************************************************************************
+ *  FUNCTION    : kes_vstarter
+ *  DESCRIPTION : vectorized starter methods, method is selected once for
+ *                all lanes
+ *  INPUT       : - starter method "type" from enum kes_stm_e
+ *                - eccentricities "ecc"
+ *                - mean anomalies "ma" (in radians)
+ *                - starter values "x"
+ *  OUTPUT      : none
+ ******************************************************************************/
+KES_VEC_DISPATCH
+void kes_vstarter(
+    const kes_stm_e        type,
+    const double* restrict ecc,
+    const double* restrict ma,
+    double* restrict       x
+    )
+{
+    switch ( type )
+    {
+        case KES_STM_ES00:
+        {
+            for (int l = 0; l < KES_VEC_LEN; l++)
+            {
+                x[l] = M_PI;
+            } // end for
+            break;
+        } // end case
+
+        case KES_STM_ES01:
+        {
+            for (int l = 0; l < KES_VEC_LEN; l++)
+            {
+                x[l] = ma[l];
+            } // end for
+            break;
+        } // end case
+
+        case KES_STM_ES02: KES_VSTM_LANES( kes_vstm_s2( e, m ) );   break;
+        case KES_STM_ES03: KES_VSTM_LANES( kes_vstm_s3( e, m ) );   break;
+        case KES_STM_ES04: KES_VSTM_LANES( m + e );                 break;
+        case KES_STM_ES05: KES_VSTM_LANES( kes_vstm_s5( e, m ) );   break;
+        case KES_STM_ES06: KES_VSTM_LANES( (m + e * M_PI) / (1.0 + e) ); break;
+        case KES_STM_ES07: KES_VSTM_LANES( kes_vstm_s7( e, m ) );   break;
+        case KES_STM_ES08: KES_VSTM_LANES( kes_vstm_s8( e, m ) );   break;
+        case KES_STM_ES09: KES_VSTM_LANES( kes_vstm_s9( e, m ) );   break;
+        case KES_STM_ES10: KES_VSTM_LANES( kes_vstm_s10( e, m ) );  break;
+        case KES_STM_ES11: KES_VSTM_LANES( kes_vstm_s11( e, m ) );  break;
+        case KES_STM_ES12: KES_VSTM_LANES( kes_vstm_s12( e, m ) );  break;
+        case KES_STM_ES13: KES_VSTM_LANES( kes_vstm_s13( e, m ) );  break;
+        case KES_STM_ES14: KES_VSTM_LANES( kes_vstm_s14( e, m ) );  break;
+        default:           KES_VSTM_LANES( m + e );                 break;
+    } // end switch
+
+    return;
+} // end kes_vstarter
+
+#undef KES_VSTM_LANES
+
+/******************************************************************************/
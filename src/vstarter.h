@@ -0,0 +1,66 @@
+/***************************************************************************//**
+ * @file    vstarter.h
+ * @brief   vectorized starter methods for batch starter and solver functions
+ * @author  Bazso Akos
+ * @version 2026.10
+ *
+ * @copyright
+ * Copyright (C) 2019 Bazso Akos
+ *
+ * This file is part of libkes.
+ *
+ * libkes is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * libkes is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with libkes.  If not, see <https://www.gnu.org/licenses/>.
+ *
+ ******************************************************************************/
+#pragma once
+#ifndef KES_VSTARTER__H
+#define KES_VSTARTER__H
+
+/* include module headers */
+#include "starter.h"
+#include "vecore.h"
+
+/******************************************************************************/
+
+/*** declare functions ***/
+
+/*!
+ * @brief check if a starter method has a vectorized implementation
+ * @param[in] type  starter method from enum kes_stm_e
+ * @return 1 if kes_vstarter() supports the method, 0 otherwise
+ */
+int kes_vstarter_supported(
+    const kes_stm_e type
+    );
+
+/*!
+ * @brief vectorized starter methods
+ * @details all arrays hold KES_VEC_LEN elements, the results agree with
+ *          kes_starter() to a few ulp
+ * @param[in] type  starter method from enum kes_stm_e, see
+ *                  kes_vstarter_supported()
+ * @param[in] ecc   eccentricities
+ * @param[in] ma    mean anomalies (in radians)
+ * @param[out] x    starter values
+ */
+void kes_vstarter(
+    const kes_stm_e        type,
+    const double* restrict ecc,
+    const double* restrict ma,
+    double* restrict       x
+    );
+
+/******************************************************************************/
+
+#endif  /* KES_VSTARTER__H */
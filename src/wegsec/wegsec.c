@@ -30,6 +30,7 @@
 /* include module headers */
 #include "wegsec.h"
 #include "debug.h"
+#include "trace.h"
 #include "kepeq.h"
 
 /******************************************************************************/
@@ -57,32 +58,27 @@ wegsec(
     double       y0, y1, y2;     /* function evaluation y=f(x) */
     //swap;
 
-    /* correction factor for absolute error deltaf */
-    const double corr = ecc / (1.0 - ecc);
+    /* correction factor for absolute error deltaf (precomputed if available) */
+    const double corr = ((res->terms != NULL) ?
+                         res->terms->corr : ecc / (1.0 - ecc));
 
     /* reset error residuals */
     deltax = deltaf = 0.0;
-#if KES_SHOW_ITER_STATS
     res->nbrSinEval = res->nbrCosEval = res->nbrFktEval = 0;
-#endif
 
-#if KES_ITER_DEBUG
-    KES_DEBUG_STM("wegsec", ecc, ma, starter);
-#endif
+    /* trace iteration process? */
+    const int trace = kes_trace_begin();
+    kes_trace_step( trace, KES_SOL_WEGSEC, 0, ecc, ma, starter, 0.0, 0.0 );
 
     /* first starting point (x0,y0) */
     x0 = starter;
     y0 = ma + ecc * sin(x0); // f(x0)
-#if KES_SHOW_ITER_STATS
     ++(res->nbrSinEval);
-#endif
 
     /* second starting point (x1,y1) */
     x1 = y0;                 // next point
     y1 = ma + ecc * sin(x1); // f(x1)
-#if KES_SHOW_ITER_STATS
     ++(res->nbrSinEval);
-#endif
 
     /*** TODO FIXME
      * - check if f(x1) is a solution
@@ -92,25 +88,24 @@ wegsec(
     /* main iteration loop */
     do
     {
-        /* new refinement step via equations on page 176 */
-        x2 = x1 + (x1 - x0) / ((x0 - y0)/(x1 - y1) - 1.0);
+        /* new refinement step via equations on page 176,
+         * NOTE fixed-point step if the secant is degenerate, e.g. for an
+         * exact starter (x0 = x1 = y0 gives 0/0)
+         */
+        const double den = (x0 - y0)/(x1 - y1) - 1.0;
+        x2 = ((fabs(den) > 0.0) ? x1 + (x1 - x0) / den : y1);
         y2 = ma + ecc * sin(x2); // f(x2)
-#if KES_SHOW_ITER_STATS
     ++(res->nbrSinEval);
-#endif
 
         ++count;
 
         /* update error residuals */
         deltax = fabs(x1 - x2);
         deltaf = fabs( kes_keq_ell(ecc, ma, x2) ) * corr;
-#if KES_SHOW_ITER_STATS
         ++(res->nbrSinEval); ++(res->nbrFktEval);
-#endif
 
-#if KES_ITER_DEBUG
-    KES_DEBUG_SOL("wegsec", count, deltax, deltaf);
-#endif
+        kes_trace_step( trace, KES_SOL_WEGSEC, count, ecc, ma,
+                        x2, deltax, deltaf );
 
         /* shift old/new variables */
         x0 = x1; x1 = x2;